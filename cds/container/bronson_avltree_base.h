@@ -0,0 +1,261 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_BRONSON_AVLTREE_BASE_H
+#define __CDS_CONTAINER_BRONSON_AVLTREE_BASE_H
+
+#include <cds/container/base.h>
+#include <cds/opt/options.h>
+#include <cds/urcu/options.h>
+#include <cds/lock/spinlock.h>
+#include <cds/cxx11_atomic.h>
+#include <cds/backoff_strategy.h>
+
+namespace cds { namespace container {
+
+    /// BronsonAVLTree related declarations
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace bronson_avltree {
+
+        //@cond
+        namespace details {
+
+            // Node version: the lowest bits are the flags, the rest is the counter of the changes
+            typedef uint64_t    version_type ;
+
+            static const version_type   unlinked        = 1 ;   // The node is removed from the tree
+            static const version_type   shrinking       = 2 ;   // The node is being moved down by a rotation
+            static const version_type   version_flags   = unlinked | shrinking ;
+            static const version_type   version_increment = 4 ;
+
+            // The links of a tree node.
+            // The root holder of the tree has the links only, any other node has a key too.
+            template <typename Node, typename Value, typename Lock>
+            struct link_node
+            {
+                typedef Node    node_type   ;
+                typedef Value   value_type  ;
+                typedef Lock    lock_type   ;
+
+                CDS_ATOMIC::atomic< int >               m_nHeight   ;   // The height of the subtree, 0 for empty subtree
+                CDS_ATOMIC::atomic< version_type >      m_nVersion  ;   // The version of the node, see version flags above
+                CDS_ATOMIC::atomic< link_node * >       m_pParent   ;
+                CDS_ATOMIC::atomic< node_type * >       m_pLeft     ;
+                CDS_ATOMIC::atomic< node_type * >       m_pRight    ;
+                CDS_ATOMIC::atomic< value_type * >      m_pValue    ;   // NULL for routing node
+                lock_type                               m_Lock      ;   // The lock of the node; it is used only by the writers
+
+                link_node()
+                    : m_nHeight( 0 )
+                    , m_nVersion( 0 )
+                    , m_pParent( null_ptr<link_node *>() )
+                    , m_pLeft( null_ptr<node_type *>() )
+                    , m_pRight( null_ptr<node_type *>() )
+                    , m_pValue( null_ptr<value_type *>() )
+                {}
+
+                node_type * child( int nDir, CDS_ATOMIC::memory_order order ) const
+                {
+                    return nDir < 0 ? m_pLeft.load( order ) : m_pRight.load( order ) ;
+                }
+
+                void child( int nDir, node_type * pChild, CDS_ATOMIC::memory_order order )
+                {
+                    if ( nDir < 0 )
+                        m_pLeft.store( pChild, order ) ;
+                    else
+                        m_pRight.store( pChild, order ) ;
+                }
+            };
+
+            // Tree node
+            template <typename Key, typename Value, typename Lock>
+            struct node: public link_node< node<Key, Value, Lock>, Value, Lock >
+            {
+                typedef Key     key_type    ;
+                key_type const  m_key       ;
+
+                node( key_type const& key )
+                    : m_key( key )
+                {}
+            };
+
+        } // namespace details
+        //@endcond
+
+        /// BronsonAVLTreeMap internal statistics
+        struct stat {
+            typedef cds::atomicity::event_counter   event_counter ; ///< Event counter type
+
+            event_counter   m_nFindSuccess          ; ///< Count of success \p find() call
+            event_counter   m_nFindFailed           ; ///< Count of failed \p find() call
+            event_counter   m_nFindRetry            ; ///< Count of retries during finding
+            event_counter   m_nFindWaitShrinking    ; ///< Count of waiting until shrinking completed during finding
+
+            event_counter   m_nInsertSuccess        ; ///< Count of inserting data node
+            event_counter   m_nInsertFailed         ; ///< Count of failed insertion (the key is already in the tree)
+            event_counter   m_nReuseRoutingNode     ; ///< Count of insertion into routing node
+            event_counter   m_nEnsureExist          ; ///< Count of \p ensure() call for existing key
+            event_counter   m_nEnsureNew            ; ///< Count of \p ensure() call that inserts new key
+            event_counter   m_nUpdateRetry          ; ///< Count of retries of insert/ensure
+            event_counter   m_nUpdateWaitShrinking  ; ///< Count of waiting until shrinking completed during insert/ensure/erase
+
+            event_counter   m_nEraseSuccess         ; ///< Count of successful erasing
+            event_counter   m_nEraseFailed          ; ///< Count of failed erasing (the key is not found)
+            event_counter   m_nEraseRetry           ; ///< Count of retries of erasing
+            event_counter   m_nMakeRoutingNode      ; ///< Count of erasing that turns a node with two children to routing node
+
+            event_counter   m_nUnlinkNode           ; ///< Count of nodes unlinked from the tree
+            event_counter   m_nRotateRight          ; ///< Count of single right rotations
+            event_counter   m_nRotateLeft           ; ///< Count of single left rotations
+            event_counter   m_nRotateRightOverLeft  ; ///< Count of double rotations (left-right)
+            event_counter   m_nRotateLeftOverRight  ; ///< Count of double rotations (right-left)
+
+            //@cond
+            void onFindSuccess()            { ++m_nFindSuccess          ; }
+            void onFindFailed()             { ++m_nFindFailed           ; }
+            void onFindRetry()              { ++m_nFindRetry            ; }
+            void onFindWaitShrinking()      { ++m_nFindWaitShrinking    ; }
+
+            void onInsertSuccess()          { ++m_nInsertSuccess        ; }
+            void onInsertFailed()           { ++m_nInsertFailed         ; }
+            void onReuseRoutingNode()       { ++m_nReuseRoutingNode     ; }
+            void onEnsureExist()            { ++m_nEnsureExist          ; }
+            void onEnsureNew()              { ++m_nEnsureNew            ; }
+            void onUpdateRetry()            { ++m_nUpdateRetry          ; }
+            void onUpdateWaitShrinking()    { ++m_nUpdateWaitShrinking  ; }
+
+            void onEraseSuccess()           { ++m_nEraseSuccess         ; }
+            void onEraseFailed()            { ++m_nEraseFailed          ; }
+            void onEraseRetry()             { ++m_nEraseRetry           ; }
+            void onMakeRoutingNode()        { ++m_nMakeRoutingNode      ; }
+
+            void onUnlinkNode()             { ++m_nUnlinkNode           ; }
+            void onRotateRight()            { ++m_nRotateRight          ; }
+            void onRotateLeft()             { ++m_nRotateLeft           ; }
+            void onRotateRightOverLeft()    { ++m_nRotateRightOverLeft  ; }
+            void onRotateLeftOverRight()    { ++m_nRotateLeftOverRight  ; }
+            //@endcond
+        };
+
+        /// BronsonAVLTreeMap empty statistics
+        struct empty_stat {
+            //@cond
+            void onFindSuccess()            const {}
+            void onFindFailed()             const {}
+            void onFindRetry()              const {}
+            void onFindWaitShrinking()      const {}
+
+            void onInsertSuccess()          const {}
+            void onInsertFailed()           const {}
+            void onReuseRoutingNode()       const {}
+            void onEnsureExist()            const {}
+            void onEnsureNew()              const {}
+            void onUpdateRetry()            const {}
+            void onUpdateWaitShrinking()    const {}
+
+            void onEraseSuccess()           const {}
+            void onEraseFailed()            const {}
+            void onEraseRetry()             const {}
+            void onMakeRoutingNode()        const {}
+
+            void onUnlinkNode()             const {}
+            void onRotateRight()            const {}
+            void onRotateLeft()             const {}
+            void onRotateRightOverLeft()    const {}
+            void onRotateLeftOverRight()    const {}
+            //@endcond
+        };
+
+        /// BronsonAVLTreeMap traits
+        struct type_traits
+        {
+            /// Key comparison functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+
+                The functor should be able to compare <tt>(Q, key_type)</tt>
+                where \p Q is a type of the key passed to the search functions.
+            */
+            typedef opt::none                       compare     ;
+
+            /// specifies binary predicate used for key compare.
+            /**
+                Default is \p std::less<key_type>.
+            */
+            typedef opt::none                       less        ;
+
+            /// Item counter
+            /**
+                The type for item counting feature.
+                Default is no item counter (\ref atomicity::empty_item_counter)
+            */
+            typedef atomicity::empty_item_counter   item_counter;
+
+            /// C++ memory ordering model
+            /**
+                List of available memory ordering see opt::memory_model
+            */
+            typedef opt::v::relaxed_ordering        memory_model    ;
+
+            /// Allocator for the tree nodes and for the key-value pairs
+            typedef CDS_DEFAULT_ALLOCATOR           allocator ;
+
+            /// Node lock
+            /**
+                The lock is acquired only by the writers, the readers do not lock anything.
+                Default is cds::lock::Spin
+            */
+            typedef cds::lock::Spin                 lock_type ;
+
+            /// Back-off strategy used to wait until a concurrent rotation is completed
+            /**
+                If the option is not specified, the cds::backoff::Default is used.
+            */
+            typedef cds::backoff::Default           back_off    ;
+
+            /// Internal statistics
+            typedef empty_stat                      stat ;
+
+            /// RCU deadlock checking policy
+            /**
+                List of available options see opt::rcu_check_deadlock
+            */
+            typedef opt::v::rcu_throw_deadlock      rcu_check_deadlock ;
+        };
+
+        /// Metafunction converting option list to BronsonAVLTreeMap traits
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options list see \ref cds_nonintrusive_BronsonAVLTreeMap_rcu "BronsonAVLTreeMap".
+        */
+        template <CDS_DECL_OPTIONS10>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, CDS_OPTIONS10 >::type
+                ,CDS_OPTIONS10
+            >::type   type ;
+#   endif
+        };
+
+    } // namespace bronson_avltree
+
+    // Forward declaration
+    template <class GC, typename Key, typename T, typename Traits = bronson_avltree::type_traits >
+    class BronsonAVLTreeMap  ;
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_BRONSON_AVLTREE_BASE_H
@@ -0,0 +1,1402 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_BRONSON_AVLTREE_MAP_RCU_H
+#define __CDS_CONTAINER_BRONSON_AVLTREE_MAP_RCU_H
+
+#include <cds/container/bronson_avltree_base.h>
+#include <cds/gc/details/retired_batch.h>
+#include <cds/urcu/details/check_deadlock.h>
+#include <cds/lock/scoped_lock.h>
+#include <cds/opt/compare.h>
+#include <cds/ref.h>
+#include <cds/details/std/memory.h>
+
+namespace cds { namespace container {
+
+    /// Bronson et al AVL-tree (template specialization for \ref cds_urcu_desc "RCU")
+    /** @ingroup cds_nonintrusive_map
+        @ingroup cds_nonintrusive_tree
+        @anchor cds_nonintrusive_BronsonAVLTreeMap_rcu
+
+        Source:
+            - [2010] N.Bronson, J.Casper, H.Chafi, K.Olukotun "A Practical Concurrent Binary Search Tree"
+
+        This is a concurrent AVL tree with relaxed balance and optimistic concurrency control.
+        The readers do not lock anything and do not perform any atomic read-modify-write operation:
+        each node has a version number that is changed when the node is moved down by a rotation,
+        a reader validates the version of the node after reading its child and retries
+        from the nearest valid node when the version has been changed.
+        The writers use fine-grained node locks (see \p opt::lock_type option);
+        a rotation locks only the nodes it changes.
+
+        Removing a key from a node having two children does not unlink the node: the node becomes
+        a <i>routing</i> node without value. The routing node is unlinked later when it has less than
+        two children, or it is reused when the same key is inserted again. So, the nodes and the values
+        are allocated separately: the map stores its key-value pair as <tt>std::pair< Key const, T ></tt>
+        in a separate memory block.
+
+        The balance is relaxed: a writer repairs the heights and rotates the nodes on its way up to the root,
+        and concurrent writers may leave the tree slightly out of strict AVL balance.
+        Without concurrent updates the tree is a strict AVL tree.
+
+        The unlinked nodes and the values removed are passed to RCU after the read-side critical section
+        is finished. The functions that can retire memory (\p insert, \p ensure, \p erase, \p clear)
+        must be called outside of RCU lock; the check is performed by \p opt::rcu_check_deadlock policy.
+        All functions lock RCU internally.
+
+        Template arguments:
+        - \p RCU - one of \ref cds_urcu_gc "RCU type"
+        - \p Key - key type
+        - \p T - mapped type
+        - \p Traits - type traits. See bronson_avltree::type_traits for explanation.
+
+        It is possible to declare option-based tree with cds::container::bronson_avltree::make_traits metafunction
+        instead of \p Traits template argument.
+        Template argument list \p Options of cds::container::bronson_avltree::make_traits metafunction are:
+        - opt::compare - key compare functor. No default functor is provided.
+            If the option is not specified, \p %opt::less is used.
+        - opt::less - specifies binary predicate used for key compare. At least \p %opt::compare or \p %opt::less should be defined.
+        - opt::item_counter - the type of item counting feature. Default is \ref atomicity::empty_item_counter that is no item counting.
+        - opt::memory_model - C++ memory ordering model. Can be opt::v::relaxed_ordering (relaxed memory model, the default)
+            or opt::v::sequential_consistent (sequentially consisnent memory model).
+        - opt::allocator - the allocator for the tree nodes and for the key-value pairs. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - opt::lock_type - node lock. Default is cds::lock::Spin.
+        - opt::back_off - back-off strategy used to wait until a concurrent rotation is completed.
+            Default is cds::backoff::Default.
+        - opt::stat - internal statistics. Available types: bronson_avltree::stat, bronson_avltree::empty_stat (the default)
+        - opt::rcu_check_deadlock - a deadlock checking policy. Default is opt::v::rcu_throw_deadlock
+
+        The class does not support iterators.
+
+        @note Before including <tt><cds/container/bronson_avltree_map_rcu.h></tt> you should include appropriate RCU header file,
+        see \ref cds_urcu_gc "RCU type" for list of existing RCU class and corresponding header files.
+    */
+    template <
+        typename RCU,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        typename Traits = bronson_avltree::type_traits
+#else
+        typename Traits
+#endif
+    >
+    class BronsonAVLTreeMap< cds::urcu::gc< RCU >, Key, T, Traits >
+    {
+    public:
+        typedef cds::urcu::gc< RCU >    gc          ;   ///< Garbage collector
+        typedef Key                     key_type    ;   ///< Key type
+        typedef T                       mapped_type ;   ///< Mapped type
+        typedef std::pair< key_type const, mapped_type > value_type ;   ///< Key-value pair stored in the map
+        typedef Traits                  options     ;   ///< Traits template parameter
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator  ;    ///< key compare functor based on opt::compare and opt::less option setter.
+#   else
+        typedef typename opt::details::make_comparator< key_type, options >::type key_comparator ;
+#   endif
+
+        typedef typename options::item_counter      item_counter    ;   ///< Item counting policy used
+        typedef typename options::memory_model      memory_model    ;   ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename options::allocator         allocator_type  ;   ///< Allocator for the nodes and for the key-value pairs
+        typedef typename options::lock_type         lock_type       ;   ///< Node lock
+        typedef typename options::back_off          back_off        ;   ///< Back-off strategy
+        typedef typename options::stat              stat            ;   ///< internal statistics type
+        typedef typename options::rcu_check_deadlock    rcu_check_deadlock ; ///< Deadlock checking policy
+
+        typedef typename gc::scoped_lock    rcu_lock ;  ///< RCU scoped lock
+
+    protected:
+        //@cond
+        typedef bronson_avltree::details::node< key_type, value_type, lock_type >      node_type ;
+        typedef bronson_avltree::details::link_node< node_type, value_type, lock_type > link_node ;
+        typedef bronson_avltree::details::version_type  version_type ;
+
+        typedef cds::details::Allocator< node_type, allocator_type >    cxx_node_allocator ;
+        typedef cds::details::Allocator< value_type, allocator_type >   cxx_value_allocator ;
+
+        typedef cds::urcu::details::check_deadlock_policy< gc, rcu_check_deadlock>   check_deadlock_policy ;
+        typedef cds::gc::details::retired_batch< gc >   retired_batch ;
+        typedef cds::lock::scoped_lock< lock_type >     node_scoped_lock ;
+
+        struct node_disposer {
+            void operator()( node_type * p ) const
+            {
+                cxx_node_allocator().Delete( p ) ;
+            }
+        };
+
+        struct value_disposer {
+            void operator()( value_type * p ) const
+            {
+                cxx_value_allocator().Delete( p ) ;
+            }
+        };
+
+        typedef std::unique_ptr< value_type, value_disposer >    scoped_value_ptr ;
+
+        // Result of internal find/update/remove operations
+        enum operation_result {
+            op_failed,      // the key is not found (find, erase) or the key exists (insert)
+            op_inserted,    // new item has been inserted
+            op_found,       // the item has been found (ensure, erase)
+            op_retry        // the version of the node has been changed, retry from the parent
+        };
+
+        // Result of node_condition()
+        enum {
+            unlink_required     = -1,
+            rebalance_required  = -2,
+            nothing_required    = -3
+        };
+
+        struct empty_insert_functor {
+            void operator()( value_type& ) const
+            {}
+        };
+
+        struct empty_ensure_functor {
+            void operator()( bool, value_type& ) const
+            {}
+        };
+
+        struct empty_erase_functor {
+            void operator()( value_type& ) const
+            {}
+        };
+
+        struct empty_find_functor {
+            void operator()( value_type& ) const
+            {}
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        link_node       m_Root          ;   ///< Root holder, the tree is its right subtree
+        item_counter    m_ItemCounter   ;   ///< Item counter
+        mutable stat    m_stat          ;   ///< Internal statistics
+        //@endcond
+
+    public:
+        /// Creates empty map
+        BronsonAVLTreeMap()
+        {}
+
+        /// Destroys the map
+        /**
+            The destructor frees all nodes and items of the map immediately, it does not use RCU.
+        */
+        ~BronsonAVLTreeMap()
+        {
+            destroy( m_Root.m_pRight.load( memory_model::memory_order_relaxed )) ;
+        }
+
+    public:
+        /// Inserts new node with \p key and default value
+        /**
+            The function creates a node with \p key and default value, and then inserts the node created into the map.
+
+            Preconditions:
+            - The \ref key_type should be constructible from a value of type \p K.
+            - The \ref mapped_type should be default-constructible.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+            scoped_value_ptr pVal( cxx_value_allocator().New( key, mapped_type() )) ;
+            return insert_value( pVal, empty_insert_functor() ) ;
+        }
+
+        /// Inserts new node
+        /**
+            The function creates a node with copy of \p val value
+            and then inserts the node created into the map.
+
+            Preconditions:
+            - The \ref key_type should be constructible from \p key of type \p K.
+            - The \ref mapped_type should be constructible from \p val of type \p V.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+
+            Returns \p true if \p val is inserted into the map, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            scoped_value_ptr pVal( cxx_value_allocator().New( key, val )) ;
+            return insert_value( pVal, empty_insert_functor() ) ;
+        }
+
+        /// Inserts new node and initialize it by a functor
+        /**
+            This function inserts new node with key \p key and if inserting is successful then it calls
+            \p func functor with signature
+            \code
+                struct functor {
+                    void operator()( value_type& item )  ;
+                };
+            \endcode
+
+            The argument \p item of user-defined functor \p func is the reference
+            to the map's item inserted:
+                - <tt>item.first</tt> is a const reference to item's key that cannot be changed.
+                - <tt>item.second</tt> is a reference to item's value that may be changed.
+
+            The user-defined functor can be passed by reference using <tt>boost::ref</tt>
+            and it is called only if inserting is successful.
+
+            The key_type should be constructible from value of type \p K.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        template <typename K, typename Func>
+        bool insert_key( K const& key, Func func )
+        {
+            scoped_value_ptr pVal( cxx_value_allocator().New( key, mapped_type() )) ;
+            return insert_value( pVal, func ) ;
+        }
+
+#   ifdef CDS_EMPLACE_SUPPORT
+        /// For key \p key inserts data of type \ref mapped_type constructed with <tt>std::forward<Args>(args)...</tt>
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+
+            @note This function is available only for compiler that supports
+            variadic template and move semantics
+        */
+        template <typename K, typename... Args>
+        bool emplace( K&& key, Args&&... args )
+        {
+            scoped_value_ptr pVal( cxx_value_allocator().MoveNew( std::forward<K>(key), mapped_type( std::forward<Args>(args)... ))) ;
+            return insert_value( pVal, empty_insert_functor() ) ;
+        }
+#   endif
+
+        /// Ensures that the \p key exists in the map
+        /**
+            If the \p key not found in the map, then the new item created from \p key
+            is inserted into the map (note that in this case the \ref key_type should be
+            constructible from type \p K).
+            Otherwise, the functor \p func is called with item found.
+            The functor \p Func interface is:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, value_type& item ) ;
+                };
+            \endcode
+
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - item of the map
+
+            The functor may change any fields of the \p item.second that is \ref mapped_type.
+
+            You may pass \p func argument by reference using <tt>boost::ref</tt>.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is true if operation is successfull,
+            \p second is true if new item has been added or \p false if the item with \p key
+            already is in the map.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> ensure( K const& key, Func func )
+        {
+            check_deadlock_policy::check() ;
+
+            scoped_value_ptr pVal( cxx_value_allocator().New( key, mapped_type() )) ;
+            retired_batch retired ;
+            node_type * pNewNode = null_ptr<node_type *>() ;
+            int nResult ;
+            {
+                rcu_lock l ;
+                nResult = do_update( pVal.get(), true, func, pNewNode, retired ) ;
+                if ( nResult == op_inserted )
+                    cds::unref(func)( true, *pVal.release() ) ;
+            }
+            free_node( pNewNode ) ;
+            retired.retire() ;
+            return std::make_pair( true, nResult == op_inserted ) ;
+        }
+
+        /// Delete \p key from the map
+        /**\anchor cds_nonintrusive_BronsonAVLTreeMap_rcu_erase_val
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+
+            Return \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return erase_( key, key_comparator(), empty_erase_functor() ) ;
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_BronsonAVLTreeMap_rcu_erase_val "erase(K const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool erase_with( K const& key, Less pred )
+        {
+            return erase_( key, cds::opt::details::make_comparator_from_less<Less>(), empty_erase_functor() ) ;
+        }
+
+        /// Delete \p key from the map
+        /** \anchor cds_nonintrusive_BronsonAVLTreeMap_rcu_erase_func
+
+            The function searches an item with key \p key, deletes it from the map and calls \p f functor
+            for the item deleted. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()(value_type& item) { ... }
+            };
+            \endcode
+            The functor may be passed by reference using <tt>boost:ref</tt>
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+            return erase_( key, key_comparator(), f ) ;
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_BronsonAVLTreeMap_rcu_erase_func "erase(K const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        bool erase_with( K const& key, Less pred, Func f )
+        {
+            return erase_( key, cds::opt::details::make_comparator_from_less<Less>(), f ) ;
+        }
+
+        /// Find the key \p key
+        /** \anchor cds_nonintrusive_BronsonAVLTreeMap_rcu_find_cfunc
+
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item ) ;
+            };
+            \endcode
+            where \p item is the item found.
+
+            You can pass \p f argument by reference using <tt>boost::ref</tt> or cds::ref.
+
+            The functor may change \p item.second. Note that the function is only guarantee
+            that \p item cannot be disposed during functor is executing.
+            The function does not serialize simultaneous access to the map \p item.
+
+            The function applies RCU lock internally.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+            rcu_lock l ;
+            return do_find( key, key_comparator(), f ) ;
+        }
+
+        /// Finds the key \p val using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_BronsonAVLTreeMap_rcu_find_cfunc "find(K const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        bool find_with( K const& key, Less pred, Func f )
+        {
+            rcu_lock l ;
+            return do_find( key, cds::opt::details::make_comparator_from_less<Less>(), f ) ;
+        }
+
+        /// Find the key \p key
+        /** \anchor cds_nonintrusive_BronsonAVLTreeMap_rcu_find_val
+
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+
+            The function applies RCU lock internally.
+        */
+        template <typename K>
+        bool find( K const& key )
+        {
+            empty_find_functor f ;
+            rcu_lock l ;
+            return do_find( key, key_comparator(), f ) ;
+        }
+
+        /// Finds the key \p val using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_BronsonAVLTreeMap_rcu_find_val "find(K const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool find_with( K const& key, Less pred )
+        {
+            empty_find_functor f ;
+            rcu_lock l ;
+            return do_find( key, cds::opt::details::make_comparator_from_less<Less>(), f ) ;
+        }
+
+        /// Clears the map
+        /**
+            The function erases the items one by one, so it is not atomic:
+            the map may be non-empty after \p clear() if concurrent insertions are performed.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        void clear()
+        {
+            check_deadlock_policy::check() ;
+
+            empty_erase_functor f ;
+            retired_batch retired ;
+            while ( true ) {
+                bool bFound = false ;
+                {
+                    rcu_lock l ;
+                    // In quiescent state a routing node has two children, so the leftmost path leads to an item
+                    node_type * pNode = m_Root.m_pRight.load( memory_model::memory_order_acquire ) ;
+                    while ( pNode && !pNode->m_pValue.load( memory_model::memory_order_acquire )) {
+                        node_type * pLeft = pNode->m_pLeft.load( memory_model::memory_order_acquire ) ;
+                        pNode = pLeft ? pLeft : pNode->m_pRight.load( memory_model::memory_order_acquire ) ;
+                    }
+                    if ( pNode ) {
+                        bFound = true ;
+                        // pNode cannot be reclaimed until RCU is unlocked
+                        do_remove( pNode->m_key, key_comparator(), f, retired ) ;
+                    }
+                }
+                if ( !bFound )
+                    break ;
+            }
+            retired.retire() ;
+        }
+
+        /// Checks if the map is empty
+        bool empty() const
+        {
+            return m_Root.m_pRight.load( memory_model::memory_order_relaxed ) == null_ptr<node_type *>() ;
+        }
+
+        /// Returns item count in the map
+        /**
+            Only leaf nodes containing user data are counted.
+
+            The value returned depends on item counter type provided by \p Traits template parameter.
+            If it is atomicity::empty_item_counter this function always returns 0.
+            Therefore, the function is not suitable for checking the tree emptiness, use \ref empty
+            member function for this purpose.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter ;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_stat ;
+        }
+
+        /// Checks internal consistency (not atomic, not thread-safe)
+        /**
+            The debugging function checks the order of the keys and the parent links of the nodes.
+            The AVL balance is not checked since the balance is relaxed under concurrent updates.
+            The function should be called when no other thread changes the map.
+        */
+        bool check_consistency() const
+        {
+            return check_consistency( &m_Root, m_Root.m_pRight.load( memory_model::memory_order_relaxed )) ;
+        }
+
+    protected:
+        //@cond
+        static int height( link_node const * pNode )
+        {
+            return pNode ? pNode->m_nHeight.load( memory_model::memory_order_acquire ) : 0 ;
+        }
+
+        static node_type * to_node( link_node * pNode )
+        {
+            return static_cast<node_type *>( pNode ) ;
+        }
+
+        static void begin_change( link_node * pNode, version_type nVersion )
+        {
+            pNode->m_nVersion.store( nVersion | bronson_avltree::details::shrinking, memory_model::memory_order_release ) ;
+        }
+
+        static void end_change( link_node * pNode, version_type nVersion )
+        {
+            // Clears the shrinking flag and increments the version counter
+            pNode->m_nVersion.store( nVersion + bronson_avltree::details::version_increment, memory_model::memory_order_release ) ;
+        }
+
+        static void wait_until_shrink_completed( link_node const * pNode, version_type nVersion )
+        {
+            if ( nVersion & bronson_avltree::details::shrinking ) {
+                back_off bkoff ;
+                while ( pNode->m_nVersion.load( memory_model::memory_order_acquire ) == nVersion )
+                    bkoff() ;
+            }
+        }
+
+        static bool is_changing( version_type nVersion )
+        {
+            return (nVersion & bronson_avltree::details::version_flags) != 0 ;
+        }
+
+        static bool is_unlinked( link_node const * pNode )
+        {
+            return (pNode->m_nVersion.load( memory_model::memory_order_acquire ) & bronson_avltree::details::unlinked) != 0 ;
+        }
+
+        void free_node( node_type * pNode )
+        {
+            if ( pNode )
+                cxx_node_allocator().Delete( pNode ) ;
+        }
+
+        void destroy( node_type * pNode )
+        {
+            if ( pNode ) {
+                destroy( pNode->m_pLeft.load( memory_model::memory_order_relaxed )) ;
+                destroy( pNode->m_pRight.load( memory_model::memory_order_relaxed )) ;
+                value_type * pVal = pNode->m_pValue.load( memory_model::memory_order_relaxed ) ;
+                if ( pVal )
+                    value_disposer()( pVal ) ;
+                cxx_node_allocator().Delete( pNode ) ;
+            }
+        }
+
+        template <typename Func>
+        bool insert_value( scoped_value_ptr& pVal, Func func )
+        {
+            check_deadlock_policy::check() ;
+
+            retired_batch retired ;
+            node_type * pNewNode = null_ptr<node_type *>() ;
+            empty_ensure_functor fEnsure ;
+            bool bRet ;
+            {
+                rcu_lock l ;
+                bRet = do_update( pVal.get(), false, fEnsure, pNewNode, retired ) == op_inserted ;
+                if ( bRet )
+                    cds::unref(func)( *pVal.release() ) ;
+            }
+            free_node( pNewNode ) ;
+            retired.retire() ;
+            return bRet ;
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool erase_( Q const& key, Compare cmp, Func f )
+        {
+            check_deadlock_policy::check() ;
+
+            retired_batch retired ;
+            bool bRet ;
+            {
+                rcu_lock l ;
+                bRet = do_remove( key, cmp, f, retired ) ;
+            }
+            retired.retire() ;
+            return bRet ;
+        }
+
+        // Find
+        // RCU should be locked
+
+        template <typename Q, typename Compare, typename Func>
+        bool do_find( Q const& key, Compare cmp, Func& f ) const
+        {
+            while ( true ) {
+                node_type * pRoot = m_Root.m_pRight.load( memory_model::memory_order_acquire ) ;
+                if ( !pRoot ) {
+                    m_stat.onFindFailed() ;
+                    return false ;
+                }
+
+                version_type nVersion = pRoot->m_nVersion.load( memory_model::memory_order_acquire ) ;
+                if ( is_changing( nVersion )) {
+                    m_stat.onFindWaitShrinking() ;
+                    wait_until_shrink_completed( pRoot, nVersion ) ;
+                }
+                else if ( pRoot == m_Root.m_pRight.load( memory_model::memory_order_acquire )) {
+                    int nResult = try_find( key, cmp, f, pRoot, nVersion ) ;
+                    if ( nResult != op_retry ) {
+                        if ( nResult == op_found ) {
+                            m_stat.onFindSuccess() ;
+                            return true ;
+                        }
+                        m_stat.onFindFailed() ;
+                        return false ;
+                    }
+                }
+                m_stat.onFindRetry() ;
+            }
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        int try_find( Q const& key, Compare& cmp, Func& f, node_type * pNode, version_type nVersion ) const
+        {
+            int nCmp = cmp( key, pNode->m_key ) ;
+            if ( nCmp == 0 ) {
+                value_type * pVal = pNode->m_pValue.load( memory_model::memory_order_acquire ) ;
+                if ( pVal ) {
+                    cds::unref(f)( *pVal ) ;
+                    return op_found ;
+                }
+                return op_failed ;
+            }
+
+            while ( true ) {
+                node_type * pChild = pNode->child( nCmp, memory_model::memory_order_acquire ) ;
+                if ( pNode->m_nVersion.load( memory_model::memory_order_acquire ) != nVersion )
+                    return op_retry ;
+                if ( !pChild )
+                    return op_failed ;
+
+                version_type nChildVersion = pChild->m_nVersion.load( memory_model::memory_order_acquire ) ;
+                if ( is_changing( nChildVersion )) {
+                    m_stat.onFindWaitShrinking() ;
+                    wait_until_shrink_completed( pChild, nChildVersion ) ;
+                }
+                else if ( pChild == pNode->child( nCmp, memory_model::memory_order_acquire )) {
+                    // pChild is still the child of pNode, and pNode has not been changed
+                    if ( pNode->m_nVersion.load( memory_model::memory_order_acquire ) != nVersion )
+                        return op_retry ;
+
+                    int nResult = try_find( key, cmp, f, pChild, nChildVersion ) ;
+                    if ( nResult != op_retry )
+                        return nResult ;
+                }
+                m_stat.onFindRetry() ;
+            }
+        }
+
+        // Insert/ensure
+        // RCU should be locked
+
+        template <typename Func>
+        int do_update( value_type * pVal, bool bEnsure, Func& func, node_type *& pNewNode, retired_batch& retired )
+        {
+            key_comparator cmp ;
+            while ( true ) {
+                node_type * pRoot = m_Root.m_pRight.load( memory_model::memory_order_acquire ) ;
+                if ( !pRoot ) {
+                    if ( try_insert_root( pVal, bEnsure, pNewNode ))
+                        return op_inserted ;
+                }
+                else {
+                    version_type nVersion = pRoot->m_nVersion.load( memory_model::memory_order_acquire ) ;
+                    if ( is_changing( nVersion )) {
+                        m_stat.onUpdateWaitShrinking() ;
+                        wait_until_shrink_completed( pRoot, nVersion ) ;
+                    }
+                    else if ( pRoot == m_Root.m_pRight.load( memory_model::memory_order_acquire )) {
+                        int nResult = try_update( pVal->first, cmp, pVal, bEnsure, func, pRoot, nVersion, pNewNode, retired ) ;
+                        if ( nResult != op_retry )
+                            return nResult ;
+                    }
+                }
+                m_stat.onUpdateRetry() ;
+            }
+        }
+
+        void alloc_node( node_type *& pNewNode, value_type * pVal )
+        {
+            // The node is allocated outside of any node lock and it is reused on retry
+            if ( !pNewNode )
+                pNewNode = cxx_node_allocator().New( pVal->first ) ;
+        }
+
+        void init_node( node_type * pNewNode, link_node * pParent, value_type * pVal )
+        {
+            pNewNode->m_nHeight.store( 1, memory_model::memory_order_relaxed ) ;
+            pNewNode->m_pParent.store( pParent, memory_model::memory_order_relaxed ) ;
+            pNewNode->m_pValue.store( pVal, memory_model::memory_order_relaxed ) ;
+        }
+
+        void on_inserted( bool bEnsure )
+        {
+            ++m_ItemCounter ;
+            if ( bEnsure )
+                m_stat.onEnsureNew() ;
+            else
+                m_stat.onInsertSuccess() ;
+        }
+
+        bool try_insert_root( value_type * pVal, bool bEnsure, node_type *& pNewNode )
+        {
+            alloc_node( pNewNode, pVal ) ;
+            {
+                node_scoped_lock l( m_Root.m_Lock ) ;
+                if ( m_Root.m_pRight.load( memory_model::memory_order_relaxed ) != null_ptr<node_type *>() )
+                    return false ;
+
+                init_node( pNewNode, &m_Root, pVal ) ;
+                m_Root.m_pRight.store( pNewNode, memory_model::memory_order_release ) ;
+            }
+            pNewNode = null_ptr<node_type *>() ;
+            on_inserted( bEnsure ) ;
+            return true ;
+        }
+
+        template <typename Compare, typename Func>
+        int try_update( key_type const& key, Compare& cmp, value_type * pVal, bool bEnsure, Func& func,
+            node_type * pNode, version_type nVersion, node_type *& pNewNode, retired_batch& retired )
+        {
+            int nCmp = cmp( key, pNode->m_key ) ;
+            if ( nCmp == 0 )
+                return try_update_node( pVal, bEnsure, func, pNode ) ;
+
+            while ( true ) {
+                node_type * pChild = pNode->child( nCmp, memory_model::memory_order_acquire ) ;
+                if ( pNode->m_nVersion.load( memory_model::memory_order_acquire ) != nVersion )
+                    return op_retry ;
+
+                if ( !pChild ) {
+                    // Insert new leaf as the child of pNode
+                    alloc_node( pNewNode, pVal ) ;
+                    link_node * pDamaged ;
+                    {
+                        node_scoped_lock l( pNode->m_Lock ) ;
+                        if ( pNode->m_nVersion.load( memory_model::memory_order_acquire ) != nVersion )
+                            return op_retry ;
+                        if ( pNode->child( nCmp, memory_model::memory_order_relaxed ))
+                            continue ;  // the child has been inserted by another thread
+
+                        init_node( pNewNode, pNode, pVal ) ;
+                        pNode->child( nCmp, pNewNode, memory_model::memory_order_release ) ;
+                        pDamaged = fix_height_locked( pNode ) ;
+                    }
+                    pNewNode = null_ptr<node_type *>() ;
+                    on_inserted( bEnsure ) ;
+                    fix_height_and_rebalance( pDamaged, retired ) ;
+                    return op_inserted ;
+                }
+
+                version_type nChildVersion = pChild->m_nVersion.load( memory_model::memory_order_acquire ) ;
+                if ( is_changing( nChildVersion )) {
+                    m_stat.onUpdateWaitShrinking() ;
+                    wait_until_shrink_completed( pChild, nChildVersion ) ;
+                }
+                else if ( pChild == pNode->child( nCmp, memory_model::memory_order_acquire )) {
+                    if ( pNode->m_nVersion.load( memory_model::memory_order_acquire ) != nVersion )
+                        return op_retry ;
+
+                    int nResult = try_update( key, cmp, pVal, bEnsure, func, pChild, nChildVersion, pNewNode, retired ) ;
+                    if ( nResult != op_retry )
+                        return nResult ;
+                }
+                m_stat.onUpdateRetry() ;
+            }
+        }
+
+        template <typename Func>
+        int try_update_node( value_type * pVal, bool bEnsure, Func& func, node_type * pNode )
+        {
+            value_type * pOld = pNode->m_pValue.load( memory_model::memory_order_acquire ) ;
+            if ( !pOld ) {
+                // Routing node: the key is absent, the value can be placed into the node
+                {
+                    node_scoped_lock l( pNode->m_Lock ) ;
+                    if ( is_unlinked( pNode ))
+                        return op_retry ;
+
+                    pOld = pNode->m_pValue.load( memory_model::memory_order_relaxed ) ;
+                    if ( !pOld )
+                        pNode->m_pValue.store( pVal, memory_model::memory_order_release ) ;
+                }
+                if ( !pOld ) {
+                    m_stat.onReuseRoutingNode() ;
+                    on_inserted( bEnsure ) ;
+                    return op_inserted ;
+                }
+            }
+
+            // The key exists
+            if ( bEnsure ) {
+                cds::unref(func)( false, *pOld ) ;
+                m_stat.onEnsureExist() ;
+                return op_found ;
+            }
+            m_stat.onInsertFailed() ;
+            return op_failed ;
+        }
+
+        // Erase
+        // RCU should be locked
+
+        template <typename Q, typename Compare, typename Func>
+        bool do_remove( Q const& key, Compare cmp, Func& f, retired_batch& retired )
+        {
+            while ( true ) {
+                node_type * pRoot = m_Root.m_pRight.load( memory_model::memory_order_acquire ) ;
+                if ( !pRoot ) {
+                    m_stat.onEraseFailed() ;
+                    return false ;
+                }
+
+                version_type nVersion = pRoot->m_nVersion.load( memory_model::memory_order_acquire ) ;
+                if ( is_changing( nVersion )) {
+                    m_stat.onUpdateWaitShrinking() ;
+                    wait_until_shrink_completed( pRoot, nVersion ) ;
+                }
+                else if ( pRoot == m_Root.m_pRight.load( memory_model::memory_order_acquire )) {
+                    int nResult = try_remove( key, cmp, f, &m_Root, pRoot, nVersion, retired ) ;
+                    if ( nResult != op_retry ) {
+                        if ( nResult == op_found ) {
+                            m_stat.onEraseSuccess() ;
+                            return true ;
+                        }
+                        m_stat.onEraseFailed() ;
+                        return false ;
+                    }
+                }
+                m_stat.onEraseRetry() ;
+            }
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        int try_remove( Q const& key, Compare& cmp, Func& f, link_node * pParent, node_type * pNode, version_type nVersion, retired_batch& retired )
+        {
+            int nCmp = cmp( key, pNode->m_key ) ;
+            if ( nCmp == 0 )
+                return try_remove_node( pParent, pNode, f, retired ) ;
+
+            while ( true ) {
+                node_type * pChild = pNode->child( nCmp, memory_model::memory_order_acquire ) ;
+                if ( pNode->m_nVersion.load( memory_model::memory_order_acquire ) != nVersion )
+                    return op_retry ;
+                if ( !pChild )
+                    return op_failed ;
+
+                version_type nChildVersion = pChild->m_nVersion.load( memory_model::memory_order_acquire ) ;
+                if ( is_changing( nChildVersion )) {
+                    m_stat.onUpdateWaitShrinking() ;
+                    wait_until_shrink_completed( pChild, nChildVersion ) ;
+                }
+                else if ( pChild == pNode->child( nCmp, memory_model::memory_order_acquire )) {
+                    if ( pNode->m_nVersion.load( memory_model::memory_order_acquire ) != nVersion )
+                        return op_retry ;
+
+                    int nResult = try_remove( key, cmp, f, pNode, pChild, nChildVersion, retired ) ;
+                    if ( nResult != op_retry )
+                        return nResult ;
+                }
+                m_stat.onEraseRetry() ;
+            }
+        }
+
+        template <typename Func>
+        int try_remove_node( link_node * pParent, node_type * pNode, Func& f, retired_batch& retired )
+        {
+            if ( !pNode->m_pValue.load( memory_model::memory_order_acquire ))
+                return op_failed ;
+
+            value_type * pOld ;
+            if ( !pNode->m_pLeft.load( memory_model::memory_order_acquire ) || !pNode->m_pRight.load( memory_model::memory_order_acquire )) {
+                // The node has one child at most, it can be unlinked
+                link_node * pDamaged ;
+                {
+                    node_scoped_lock lp( pParent->m_Lock ) ;
+                    if ( is_unlinked( pParent ) || pNode->m_pParent.load( memory_model::memory_order_acquire ) != pParent )
+                        return op_retry ;
+
+                    {
+                        node_scoped_lock ln( pNode->m_Lock ) ;
+                        pOld = pNode->m_pValue.load( memory_model::memory_order_relaxed ) ;
+                        if ( !pOld )
+                            return op_failed ;
+                        if ( !try_unlink_locked( pParent, pNode, retired ))
+                            return op_retry ;
+                    }
+                    pDamaged = fix_height_locked( pParent ) ;
+                }
+                on_removed( pOld, f, retired ) ;
+                fix_height_and_rebalance( pDamaged, retired ) ;
+            }
+            else {
+                // The node has two children: make it a routing node
+                {
+                    node_scoped_lock ln( pNode->m_Lock ) ;
+                    if ( is_unlinked( pNode ))
+                        return op_retry ;
+
+                    pOld = pNode->m_pValue.load( memory_model::memory_order_relaxed ) ;
+                    if ( !pOld )
+                        return op_failed ;
+                    if ( !pNode->m_pLeft.load( memory_model::memory_order_relaxed ) || !pNode->m_pRight.load( memory_model::memory_order_relaxed ))
+                        return op_retry ;   // the node can be unlinked now
+
+                    pNode->m_pValue.store( null_ptr<value_type *>(), memory_model::memory_order_release ) ;
+                }
+                m_stat.onMakeRoutingNode() ;
+                on_removed( pOld, f, retired ) ;
+            }
+            return op_found ;
+        }
+
+        template <typename Func>
+        void on_removed( value_type * pVal, Func& f, retired_batch& retired )
+        {
+            --m_ItemCounter ;
+            cds::unref(f)( *pVal ) ;
+            retired.template push< value_disposer >( pVal ) ;
+        }
+
+        // Unlinks pNode having one child at most. pParent and pNode should be locked
+        bool try_unlink_locked( link_node * pParent, node_type * pNode, retired_batch& retired )
+        {
+            node_type * pParentLeft = pParent->m_pLeft.load( memory_model::memory_order_relaxed ) ;
+            node_type * pParentRight = pParent->m_pRight.load( memory_model::memory_order_relaxed ) ;
+            if ( pParentLeft != pNode && pParentRight != pNode )
+                return false ;  // pNode is no longer the child of pParent
+
+            node_type * pLeft = pNode->m_pLeft.load( memory_model::memory_order_relaxed ) ;
+            node_type * pRight = pNode->m_pRight.load( memory_model::memory_order_relaxed ) ;
+            if ( pLeft && pRight )
+                return false ;  // splicing is no longer possible
+
+            node_type * pSplice = pLeft ? pLeft : pRight ;
+            if ( pParentLeft == pNode )
+                pParent->m_pLeft.store( pSplice, memory_model::memory_order_release ) ;
+            else
+                pParent->m_pRight.store( pSplice, memory_model::memory_order_release ) ;
+            if ( pSplice )
+                pSplice->m_pParent.store( pParent, memory_model::memory_order_release ) ;
+
+            pNode->m_nVersion.store( bronson_avltree::details::unlinked, memory_model::memory_order_release ) ;
+            pNode->m_pValue.store( null_ptr<value_type *>(), memory_model::memory_order_release ) ;
+
+            retired.template push< node_disposer >( pNode ) ;
+            m_stat.onUnlinkNode() ;
+            return true ;
+        }
+
+        // Rebalancing
+
+        int node_condition( link_node * pNode ) const
+        {
+            node_type * pLeft = pNode->m_pLeft.load( memory_model::memory_order_acquire ) ;
+            node_type * pRight = pNode->m_pRight.load( memory_model::memory_order_acquire ) ;
+
+            if ( (!pLeft || !pRight) && !pNode->m_pValue.load( memory_model::memory_order_acquire ))
+                return unlink_required ;
+
+            int h = pNode->m_nHeight.load( memory_model::memory_order_acquire ) ;
+            int hL = height( pLeft ) ;
+            int hR = height( pRight ) ;
+            int hNew = 1 + std::max( hL, hR ) ;
+            int nBalance = hL - hR ;
+
+            if ( nBalance < -1 || nBalance > 1 )
+                return rebalance_required ;
+
+            return h != hNew ? hNew : nothing_required ;
+        }
+
+        // pNode should be locked
+        // Returns the next node to be fixed or NULL
+        link_node * fix_height_locked( link_node * pNode )
+        {
+            int h = node_condition( pNode ) ;
+            switch ( h ) {
+                case rebalance_required:
+                case unlink_required:
+                    return pNode ;
+                case nothing_required:
+                    return null_ptr<link_node *>() ;
+                default:
+                    pNode->m_nHeight.store( h, memory_model::memory_order_release ) ;
+                    return pNode->m_pParent.load( memory_model::memory_order_relaxed ) ;
+            }
+        }
+
+        void fix_height_and_rebalance( link_node * pNode, retired_batch& retired )
+        {
+            // The root holder has no parent, so it is never rebalanced
+            while ( pNode && pNode->m_pParent.load( memory_model::memory_order_acquire )) {
+                int nCond = node_condition( pNode ) ;
+                if ( nCond == nothing_required || is_unlinked( pNode ))
+                    return ;
+
+                if ( nCond != unlink_required && nCond != rebalance_required ) {
+                    node_scoped_lock l( pNode->m_Lock ) ;
+                    pNode = fix_height_locked( pNode ) ;
+                }
+                else {
+                    link_node * pParent = pNode->m_pParent.load( memory_model::memory_order_acquire ) ;
+                    assert( pParent != null_ptr<link_node *>() ) ;
+
+                    node_scoped_lock lp( pParent->m_Lock ) ;
+                    if ( !is_unlinked( pParent ) && pNode->m_pParent.load( memory_model::memory_order_acquire ) == pParent ) {
+                        node_scoped_lock ln( pNode->m_Lock ) ;
+                        pNode = rebalance_locked( pParent, to_node( pNode ), retired ) ;
+                    }
+                    // otherwise, retry
+                }
+            }
+        }
+
+        // pParent and pNode should be locked
+        link_node * rebalance_locked( link_node * pParent, node_type * pNode, retired_batch& retired )
+        {
+            node_type * pLeft = pNode->m_pLeft.load( memory_model::memory_order_relaxed ) ;
+            node_type * pRight = pNode->m_pRight.load( memory_model::memory_order_relaxed ) ;
+
+            if ( (!pLeft || !pRight) && !pNode->m_pValue.load( memory_model::memory_order_relaxed )) {
+                // Routing node with one child at most should be unlinked
+                if ( try_unlink_locked( pParent, pNode, retired ))
+                    return fix_height_locked( pParent ) ;
+                return pNode ;  // retry
+            }
+
+            int h = pNode->m_nHeight.load( memory_model::memory_order_relaxed ) ;
+            int hL = height( pLeft ) ;
+            int hR = height( pRight ) ;
+            int hNew = 1 + std::max( hL, hR ) ;
+            int nBalance = hL - hR ;
+
+            if ( nBalance > 1 )
+                return rebalance_to_right_locked( pParent, pNode, pLeft, hR ) ;
+            if ( nBalance < -1 )
+                return rebalance_to_left_locked( pParent, pNode, pRight, hL ) ;
+            if ( hNew != h ) {
+                pNode->m_nHeight.store( hNew, memory_model::memory_order_release ) ;
+                // pParent is already locked
+                return fix_height_locked( pParent ) ;
+            }
+            return null_ptr<link_node *>() ;
+        }
+
+        link_node * rebalance_to_right_locked( link_node * pParent, node_type * pNode, node_type * pLeft, int hR )
+        {
+            // pParent and pNode are locked
+            node_scoped_lock l( pLeft->m_Lock ) ;
+
+            int hL = pLeft->m_nHeight.load( memory_model::memory_order_relaxed ) ;
+            if ( hL - hR <= 1 )
+                return pNode ;  // retry
+
+            node_type * pLRight = pLeft->m_pRight.load( memory_model::memory_order_relaxed ) ;
+            int hLL = height( pLeft->m_pLeft.load( memory_model::memory_order_relaxed )) ;
+            int hLR = height( pLRight ) ;
+            if ( hLL >= hLR ) {
+                // Rotation is sufficient
+                return rotate_right_locked( pParent, pNode, pLeft, hR, hLL, pLRight, hLR ) ;
+            }
+
+            {
+                // pLRight is not NULL since hLR > hLL >= 0
+                node_scoped_lock lr( pLRight->m_Lock ) ;
+
+                int hLR2 = pLRight->m_nHeight.load( memory_model::memory_order_relaxed ) ;
+                if ( hLL >= hLR2 )
+                    return rotate_right_locked( pParent, pNode, pLeft, hR, hLL, pLRight, hLR2 ) ;
+
+                int hLRL = height( pLRight->m_pLeft.load( memory_model::memory_order_relaxed )) ;
+                int nBalance = hLL - hLRL ;
+                if ( nBalance >= -1 && nBalance <= 1
+                    && !((hLL == 0 || hLRL == 0) && !pLeft->m_pValue.load( memory_model::memory_order_relaxed )))
+                {
+                    // Double rotation is sufficient
+                    return rotate_right_over_left_locked( pParent, pNode, pLeft, hR, hLL, pLRight, hLRL ) ;
+                }
+            }
+
+            // Focus on pLeft, pNode will be balanced later
+            return rebalance_to_left_locked( pNode, pLeft, pLRight, hLL ) ;
+        }
+
+        link_node * rebalance_to_left_locked( link_node * pParent, node_type * pNode, node_type * pRight, int hL )
+        {
+            // pParent and pNode are locked
+            node_scoped_lock l( pRight->m_Lock ) ;
+
+            int hR = pRight->m_nHeight.load( memory_model::memory_order_relaxed ) ;
+            if ( hL - hR >= -1 )
+                return pNode ;  // retry
+
+            node_type * pRLeft = pRight->m_pLeft.load( memory_model::memory_order_relaxed ) ;
+            int hRL = height( pRLeft ) ;
+            int hRR = height( pRight->m_pRight.load( memory_model::memory_order_relaxed )) ;
+            if ( hRR >= hRL )
+                return rotate_left_locked( pParent, pNode, pRight, hL, hRR, pRLeft, hRL ) ;
+
+            {
+                // pRLeft is not NULL since hRL > hRR >= 0
+                node_scoped_lock lr( pRLeft->m_Lock ) ;
+
+                int hRL2 = pRLeft->m_nHeight.load( memory_model::memory_order_relaxed ) ;
+                if ( hRR >= hRL2 )
+                    return rotate_left_locked( pParent, pNode, pRight, hL, hRR, pRLeft, hRL2 ) ;
+
+                int hRLR = height( pRLeft->m_pRight.load( memory_model::memory_order_relaxed )) ;
+                int nBalance = hRR - hRLR ;
+                if ( nBalance >= -1 && nBalance <= 1
+                    && !((hRR == 0 || hRLR == 0) && !pRight->m_pValue.load( memory_model::memory_order_relaxed )))
+                {
+                    return rotate_left_over_right_locked( pParent, pNode, pRight, hL, hRR, pRLeft, hRLR ) ;
+                }
+            }
+
+            return rebalance_to_right_locked( pNode, pRight, pRLeft, hRR ) ;
+        }
+
+        // Replaces pOld child of pParent with pNew. pParent should be locked
+        static void replace_child( link_node * pParent, node_type * pOld, node_type * pNew )
+        {
+            if ( pParent->m_pLeft.load( memory_model::memory_order_relaxed ) == pOld )
+                pParent->m_pLeft.store( pNew, memory_model::memory_order_release ) ;
+            else
+                pParent->m_pRight.store( pNew, memory_model::memory_order_release ) ;
+        }
+
+        link_node * rotate_right_locked( link_node * pParent, node_type * pNode, node_type * pLeft, int hR, int hLL, node_type * pLRight, int hLR )
+        {
+            version_type nodeVersion = pNode->m_nVersion.load( memory_model::memory_order_relaxed ) ;
+
+            begin_change( pNode, nodeVersion ) ;
+
+            pNode->m_pLeft.store( pLRight, memory_model::memory_order_release ) ;
+            if ( pLRight )
+                pLRight->m_pParent.store( pNode, memory_model::memory_order_release ) ;
+
+            pLeft->m_pRight.store( pNode, memory_model::memory_order_release ) ;
+            pNode->m_pParent.store( pLeft, memory_model::memory_order_release ) ;
+
+            replace_child( pParent, pNode, pLeft ) ;
+            pLeft->m_pParent.store( pParent, memory_model::memory_order_release ) ;
+
+            // fix up heights
+            int hNode = 1 + std::max( hLR, hR ) ;
+            pNode->m_nHeight.store( hNode, memory_model::memory_order_release ) ;
+            pLeft->m_nHeight.store( 1 + std::max( hLL, hNode ), memory_model::memory_order_release ) ;
+
+            end_change( pNode, nodeVersion ) ;
+            m_stat.onRotateRight() ;
+
+            // Check the damaged nodes: pNode, then pLeft
+            int nodeBalance = hLR - hR ;
+            if ( nodeBalance < -1 || nodeBalance > 1 )
+                return pNode ;
+            if ( (!pLRight || hR == 0) && !pNode->m_pValue.load( memory_model::memory_order_relaxed ))
+                return pNode ;  // pNode should be unlinked
+
+            int leftBalance = hLL - hNode ;
+            if ( leftBalance < -1 || leftBalance > 1 )
+                return pLeft ;
+            if ( hLL == 0 && !pLeft->m_pValue.load( memory_model::memory_order_relaxed ))
+                return pLeft ;
+
+            return fix_height_locked( pParent ) ;
+        }
+
+        link_node * rotate_left_locked( link_node * pParent, node_type * pNode, node_type * pRight, int hL, int hRR, node_type * pRLeft, int hRL )
+        {
+            version_type nodeVersion = pNode->m_nVersion.load( memory_model::memory_order_relaxed ) ;
+
+            begin_change( pNode, nodeVersion ) ;
+
+            pNode->m_pRight.store( pRLeft, memory_model::memory_order_release ) ;
+            if ( pRLeft )
+                pRLeft->m_pParent.store( pNode, memory_model::memory_order_release ) ;
+
+            pRight->m_pLeft.store( pNode, memory_model::memory_order_release ) ;
+            pNode->m_pParent.store( pRight, memory_model::memory_order_release ) ;
+
+            replace_child( pParent, pNode, pRight ) ;
+            pRight->m_pParent.store( pParent, memory_model::memory_order_release ) ;
+
+            int hNode = 1 + std::max( hL, hRL ) ;
+            pNode->m_nHeight.store( hNode, memory_model::memory_order_release ) ;
+            pRight->m_nHeight.store( 1 + std::max( hNode, hRR ), memory_model::memory_order_release ) ;
+
+            end_change( pNode, nodeVersion ) ;
+            m_stat.onRotateLeft() ;
+
+            int nodeBalance = hRL - hL ;
+            if ( nodeBalance < -1 || nodeBalance > 1 )
+                return pNode ;
+            if ( (!pRLeft || hL == 0) && !pNode->m_pValue.load( memory_model::memory_order_relaxed ))
+                return pNode ;
+
+            int rightBalance = hRR - hNode ;
+            if ( rightBalance < -1 || rightBalance > 1 )
+                return pRight ;
+            if ( hRR == 0 && !pRight->m_pValue.load( memory_model::memory_order_relaxed ))
+                return pRight ;
+
+            return fix_height_locked( pParent ) ;
+        }
+
+        link_node * rotate_right_over_left_locked( link_node * pParent, node_type * pNode, node_type * pLeft, int hR, int hLL, node_type * pLRight, int hLRL )
+        {
+            version_type nodeVersion = pNode->m_nVersion.load( memory_model::memory_order_relaxed ) ;
+            version_type leftVersion = pLeft->m_nVersion.load( memory_model::memory_order_relaxed ) ;
+
+            node_type * pLRL = pLRight->m_pLeft.load( memory_model::memory_order_relaxed ) ;
+            node_type * pLRR = pLRight->m_pRight.load( memory_model::memory_order_relaxed ) ;
+            int hLRR = height( pLRR ) ;
+
+            begin_change( pNode, nodeVersion ) ;
+            begin_change( pLeft, leftVersion ) ;
+
+            // fix up pNode links
+            pNode->m_pLeft.store( pLRR, memory_model::memory_order_release ) ;
+            if ( pLRR )
+                pLRR->m_pParent.store( pNode, memory_model::memory_order_release ) ;
+
+            // fix up pLeft links
+            pLeft->m_pRight.store( pLRL, memory_model::memory_order_release ) ;
+            if ( pLRL )
+                pLRL->m_pParent.store( pLeft, memory_model::memory_order_release ) ;
+
+            // fix up pLRight links
+            pLRight->m_pLeft.store( pLeft, memory_model::memory_order_release ) ;
+            pLeft->m_pParent.store( pLRight, memory_model::memory_order_release ) ;
+            pLRight->m_pRight.store( pNode, memory_model::memory_order_release ) ;
+            pNode->m_pParent.store( pLRight, memory_model::memory_order_release ) ;
+
+            // fix up pParent links
+            replace_child( pParent, pNode, pLRight ) ;
+            pLRight->m_pParent.store( pParent, memory_model::memory_order_release ) ;
+
+            // fix up heights
+            int hNode = 1 + std::max( hLRR, hR ) ;
+            pNode->m_nHeight.store( hNode, memory_model::memory_order_release ) ;
+            int hLeft = 1 + std::max( hLL, hLRL ) ;
+            pLeft->m_nHeight.store( hLeft, memory_model::memory_order_release ) ;
+            pLRight->m_nHeight.store( 1 + std::max( hLeft, hNode ), memory_model::memory_order_release ) ;
+
+            end_change( pNode, nodeVersion ) ;
+            end_change( pLeft, leftVersion ) ;
+            m_stat.onRotateRightOverLeft() ;
+
+            // pLeft has been checked by the caller, check pNode and pLRight
+            int nodeBalance = hLRR - hR ;
+            if ( nodeBalance < -1 || nodeBalance > 1 )
+                return pNode ;
+            if ( (!pLRR || hR == 0) && !pNode->m_pValue.load( memory_model::memory_order_relaxed ))
+                return pNode ;
+
+            int lrBalance = hLeft - hNode ;
+            if ( lrBalance < -1 || lrBalance > 1 )
+                return pLRight ;
+
+            return fix_height_locked( pParent ) ;
+        }
+
+        link_node * rotate_left_over_right_locked( link_node * pParent, node_type * pNode, node_type * pRight, int hL, int hRR, node_type * pRLeft, int hRLR )
+        {
+            version_type nodeVersion = pNode->m_nVersion.load( memory_model::memory_order_relaxed ) ;
+            version_type rightVersion = pRight->m_nVersion.load( memory_model::memory_order_relaxed ) ;
+
+            node_type * pRLL = pRLeft->m_pLeft.load( memory_model::memory_order_relaxed ) ;
+            node_type * pRLR = pRLeft->m_pRight.load( memory_model::memory_order_relaxed ) ;
+            int hRLL = height( pRLL ) ;
+
+            begin_change( pNode, nodeVersion ) ;
+            begin_change( pRight, rightVersion ) ;
+
+            pNode->m_pRight.store( pRLL, memory_model::memory_order_release ) ;
+            if ( pRLL )
+                pRLL->m_pParent.store( pNode, memory_model::memory_order_release ) ;
+
+            pRight->m_pLeft.store( pRLR, memory_model::memory_order_release ) ;
+            if ( pRLR )
+                pRLR->m_pParent.store( pRight, memory_model::memory_order_release ) ;
+
+            pRLeft->m_pRight.store( pRight, memory_model::memory_order_release ) ;
+            pRight->m_pParent.store( pRLeft, memory_model::memory_order_release ) ;
+            pRLeft->m_pLeft.store( pNode, memory_model::memory_order_release ) ;
+            pNode->m_pParent.store( pRLeft, memory_model::memory_order_release ) ;
+
+            replace_child( pParent, pNode, pRLeft ) ;
+            pRLeft->m_pParent.store( pParent, memory_model::memory_order_release ) ;
+
+            int hNode = 1 + std::max( hL, hRLL ) ;
+            pNode->m_nHeight.store( hNode, memory_model::memory_order_release ) ;
+            int hRight = 1 + std::max( hRLR, hRR ) ;
+            pRight->m_nHeight.store( hRight, memory_model::memory_order_release ) ;
+            pRLeft->m_nHeight.store( 1 + std::max( hNode, hRight ), memory_model::memory_order_release ) ;
+
+            end_change( pNode, nodeVersion ) ;
+            end_change( pRight, rightVersion ) ;
+            m_stat.onRotateLeftOverRight() ;
+
+            int nodeBalance = hRLL - hL ;
+            if ( nodeBalance < -1 || nodeBalance > 1 )
+                return pNode ;
+            if ( (!pRLL || hL == 0) && !pNode->m_pValue.load( memory_model::memory_order_relaxed ))
+                return pNode ;
+
+            int rlBalance = hRight - hNode ;
+            if ( rlBalance < -1 || rlBalance > 1 )
+                return pRLeft ;
+
+            return fix_height_locked( pParent ) ;
+        }
+
+        bool check_consistency( link_node const * pParent, node_type * pNode ) const
+        {
+            if ( !pNode )
+                return true ;
+
+            if ( pNode->m_pParent.load( memory_model::memory_order_relaxed ) != pParent )
+                return false ;
+
+            key_comparator cmp ;
+            node_type * pLeft = pNode->m_pLeft.load( memory_model::memory_order_relaxed ) ;
+            node_type * pRight = pNode->m_pRight.load( memory_model::memory_order_relaxed ) ;
+            if ( pLeft && cmp( pLeft->m_key, pNode->m_key ) >= 0 )
+                return false ;
+            if ( pRight && cmp( pNode->m_key, pRight->m_key ) >= 0 )
+                return false ;
+
+            return check_consistency( pNode, pLeft ) && check_consistency( pNode, pRight ) ;
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_BRONSON_AVLTREE_MAP_RCU_H
@@ -126,6 +126,35 @@ namespace cds { namespace container {
         using intrusive::cuckoo::list   ;
         using intrusive::cuckoo::vector ;
 
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Optimistic lock-free search option
+        /**
+            If \p Enable is \p true, \p find reads the probe sets without locking
+            under per-stripe version counters, see \ref intrusive::cuckoo::optimistic_find.
+            The option requires \p cuckoo::vector probe set and trivially destructible key.
+            Default is \p false.
+        */
+        template <bool Enable>
+        struct optimistic_find
+        {};
+#else
+        using intrusive::cuckoo::optimistic_find ;
+#endif
+
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Probe set fingerprint option
+        /**
+            For \p cuckoo::vector probe set only: the probe set keeps the hash fingerprints of its items
+            of type \p Fingerprint in contiguous array and matches them by SIMD instructions before comparing the keys,
+            see \ref intrusive::cuckoo::fingerprint.
+        */
+        template <typename Fingerprint = uint8_t>
+        struct fingerprint
+        {};
+#else
+        using intrusive::cuckoo::fingerprint ;
+#endif
+
         /// Type traits for CuckooSet and CuckooMap classes
         struct type_traits
         {
@@ -200,6 +229,12 @@ namespace cds { namespace container {
 
             /// Internal statistics
             typedef empty_stat                  stat ;
+
+            /// Optimistic lock-free search. See \ref optimistic_find option for explanation
+            static bool const optimistic_find = false ;
+
+            /// Probe set fingerprint type. See \ref fingerprint option for explanation
+            typedef opt::none                   fingerprint ;
         };
 
         /// Metafunction converting option list to CuckooSet/CuckooMap traits
@@ -14,6 +14,7 @@
 
 #include <cds/container/cuckoo_base.h>
 #include <cds/details/binary_functor_wrapper.h>
+#include <boost/type_traits/has_trivial_destructor.hpp>
 
 namespace cds { namespace container {
 
@@ -216,6 +217,13 @@ namespace cds { namespace container {
             Default is \p cuckoo::list.
         - opt::stat - internal statistics. Possibly types: cuckoo::stat, cuckoo::empty_stat.
             Default is cuckoo::empty_stat
+        - \ref intrusive::cuckoo::optimistic_find "cuckoo::optimistic_find" - if \p true, \p find reads the probe sets
+            without locking under per-stripe version counters. The erased items are freed immediately,
+            so the option is allowed only for \p cuckoo::vector probe set and trivially destructible
+            \p key_type, like integral keys. Default is \p false.
+        - \ref intrusive::cuckoo::fingerprint "cuckoo::fingerprint" - for <tt>cuckoo::vector<Capacity></tt> probe set only:
+            keep the hash fingerprints of the items in contiguous array of the probe set and match them
+            by SIMD instructions before comparing the keys. Default is \p opt::none (no fingerprints).
 
        <b>Examples</b>
 
@@ -537,6 +545,8 @@ namespace cds { namespace container {
         /// Destructor clears the map
         ~CuckooMap()
         {
+            // Optimistic find may read the key of the node freed by concurrent erase
+            static_assert( (!base_class::c_bOptimisticFind || boost::has_trivial_destructor<key_type>::value), "cuckoo::optimistic_find option requires trivially destructible key_type" ) ;
             clear() ;
         }
 
@@ -14,6 +14,7 @@
 
 #include <cds/container/cuckoo_base.h>
 #include <cds/details/binary_functor_wrapper.h>
+#include <boost/type_traits/has_trivial_destructor.hpp>
 
 namespace cds { namespace container {
 
@@ -188,6 +189,13 @@ namespace cds { namespace container {
             Default is \p cuckoo::list.
         - opt::stat - internal statistics. Possibly types: cuckoo::stat, cuckoo::empty_stat.
             Default is cuckoo::empty_stat
+        - \ref intrusive::cuckoo::optimistic_find "cuckoo::optimistic_find" - if \p true, \p find reads the probe sets
+            without locking under per-stripe version counters. The erased items are freed immediately,
+            so the option is allowed only for \p cuckoo::vector probe set and trivially destructible
+            \p value_type, like integral keys. Default is \p false.
+        - \ref intrusive::cuckoo::fingerprint "cuckoo::fingerprint" - for <tt>cuckoo::vector<Capacity></tt> probe set only:
+            keep the hash fingerprints of the items in contiguous array of the probe set and match them
+            by SIMD instructions before comparing the keys. Default is \p opt::none (no fingerprints).
 
         <b>Examples</b>
 
@@ -579,6 +587,8 @@ namespace cds { namespace container {
         /// Destructor clears the set
         ~CuckooSet()
         {
+            // Optimistic find may read the key of the node freed by concurrent erase
+            static_assert( (!base_class::c_bOptimisticFind || boost::has_trivial_destructor<value_type>::value), "cuckoo::optimistic_find option requires trivially destructible value_type" ) ;
             clear() ;
         }
 
@@ -913,11 +923,7 @@ namespace cds { namespace container {
         template <typename Q>
         bool find( Q const& val )
         {
-#       ifdef CDS_CXX11_LAMBDA_SUPPORT
-            return base_class::find( val, [](node_type&, Q const&) {}) ;
-#       else
-            return base_class::find( val, empty_find_functor()) ;
-#       endif
+            return base_class::find( val ) ;
         }
 
         /// Find the key \p val using \p pred predicate for comparing
@@ -931,11 +937,7 @@ namespace cds { namespace container {
         template <typename Q, typename Predicate>
         bool find_with( Q const& val, Predicate pred )
         {
-#       ifdef CDS_CXX11_LAMBDA_SUPPORT
-            return base_class::find_with( val, typename maker::template predicate_wrapper<Predicate, bool>(), [](node_type&, Q const&) {}) ;
-#       else
-            return base_class::find_with( val, typename maker::template predicate_wrapper<Predicate, bool>(), empty_find_functor()) ;
-#       endif
+            return base_class::find_with( val, typename maker::template predicate_wrapper<Predicate, bool>() ) ;
         }
 
         /// Clears the set
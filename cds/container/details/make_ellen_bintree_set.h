@@ -0,0 +1,93 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_DETAILS_MAKE_ELLEN_BINTREE_SET_H
+#define __CDS_CONTAINER_DETAILS_MAKE_ELLEN_BINTREE_SET_H
+
+#include <cds/container/ellen_bintree_base.h>
+#include <cds/details/binary_functor_wrapper.h>
+#include <cds/details/allocator.h>
+
+//@cond
+namespace cds { namespace container { namespace details {
+
+    template <typename GC, typename Key, typename T, typename Traits>
+    struct make_ellen_bintree_set
+    {
+        typedef GC      gc ;
+        typedef Key     key_type    ;
+        typedef T       value_type  ;
+        typedef Traits  type_traits ;
+
+        typedef cds::intrusive::ellen_bintree::node< gc >   intrusive_node_type ;
+        struct node_type: public intrusive_node_type
+        {
+            typedef intrusive_node_type     base_class          ;
+            typedef value_type              stored_value_type   ;
+
+            value_type m_Value ;
+
+            template <typename Q>
+            node_type( Q const& v )
+                : m_Value(v)
+            {}
+
+#       ifdef CDS_EMPLACE_SUPPORT
+            template <typename Q, typename... Args>
+            node_type( Q&& q, Args&&... args )
+                : m_Value( std::forward<Q>(q), std::forward<Args>(args)... )
+            {}
+#       endif
+
+        private:
+            node_type() ;   // no default ctor
+        };
+
+        typedef cds::details::Allocator< node_type, typename type_traits::allocator > node_allocator ;
+
+        struct node_deallocator {
+            void operator ()( node_type * pNode )
+            {
+                node_allocator().Delete( pNode ) ;
+            }
+        };
+
+        struct value_accessor
+        {
+            value_type const& operator()( node_type const& node ) const
+            {
+                return node.m_Value ;
+            }
+        };
+        typedef typename opt::details::make_comparator< value_type, type_traits >::type key_comparator ;
+
+        struct node_key_extractor {
+            void operator()( key_type& dest, node_type const& src ) const
+            {
+                typename type_traits::key_extractor()( dest, src.m_Value ) ;
+            }
+        };
+
+        typedef typename cds::intrusive::ellen_bintree::make_traits<
+            cds::opt::type_traits< type_traits >
+            ,cds::intrusive::opt::hook< intrusive::ellen_bintree::base_hook< cds::opt::gc< gc > > >
+            ,cds::intrusive::opt::disposer< node_deallocator >
+            ,cds::intrusive::ellen_bintree::key_extractor< node_key_extractor >
+            ,cds::opt::compare< cds::details::compare_wrapper< node_type, key_comparator, value_accessor > >
+        >::type intrusive_type_traits ;
+
+        typedef cds::intrusive::EllenBinTree< gc, key_type, node_type, intrusive_type_traits >   type ;
+    };
+
+}}} // namespace cds::container::details
+//@endcond
+
+#endif // #ifndef __CDS_CONTAINER_DETAILS_MAKE_ELLEN_BINTREE_SET_H
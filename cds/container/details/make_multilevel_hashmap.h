@@ -0,0 +1,94 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_DETAILS_MAKE_MULTILEVEL_HASHMAP_H
+#define __CDS_CONTAINER_DETAILS_MAKE_MULTILEVEL_HASHMAP_H
+
+#include <cds/container/multilevel_hashmap_base.h>
+#include <cds/details/allocator.h>
+
+//@cond
+namespace cds { namespace container { namespace details {
+
+    template <typename GC, typename K, typename T, typename Traits>
+    struct make_multilevel_hashmap
+    {
+        typedef GC      gc ;
+        typedef K       key_type    ;
+        typedef T       mapped_type ;
+        typedef std::pair< key_type const, mapped_type> value_type  ;
+        typedef Traits  type_traits ;
+
+        typedef typename cds::opt::v::hash_selector< typename type_traits::hash >::type hasher ;
+        typedef typename type_traits::hash_type hash_type ;
+
+        struct node_type
+        {
+            typedef value_type  stored_value_type ;
+
+            hash_type const m_hash  ;
+            value_type      m_Value ;
+
+            template <typename Q>
+            node_type( hash_type const& h, Q const& key )
+                : m_hash( h )
+                , m_Value( std::make_pair( key, mapped_type() ))
+            {}
+
+            template <typename Q, typename U>
+            node_type( hash_type const& h, Q const& key, U const& val )
+                : m_hash( h )
+                , m_Value( std::make_pair( key, val ))
+            {}
+
+#       ifdef CDS_EMPLACE_SUPPORT
+            template <typename Q, typename... Args>
+            node_type( hash_type const& h, Q&& key, Args&&... args )
+                : m_hash( h )
+                , m_Value( std::forward<Q>(key), std::move( mapped_type( std::forward<Args>(args)... )))
+            {}
+#       endif
+
+        private:
+            node_type() ;   // no default ctor
+        };
+
+        typedef typename type_traits::allocator::template rebind< node_type >::other   allocator_type ;
+        typedef cds::details::Allocator< node_type, allocator_type >    cxx_node_allocator ;
+
+        struct node_deallocator {
+            void operator ()( node_type * pNode )
+            {
+                cxx_node_allocator().Delete( pNode ) ;
+            }
+        };
+
+        struct hash_accessor
+        {
+            hash_type const& operator()( node_type const& node ) const
+            {
+                return node.m_hash ;
+            }
+        };
+
+        typedef typename cds::intrusive::multilevel_hashset::make_traits<
+            cds::opt::type_traits< type_traits >
+            ,cds::intrusive::multilevel_hashset::hash_accessor< hash_accessor >
+            ,cds::intrusive::opt::disposer< node_deallocator >
+        >::type intrusive_type_traits ;
+
+        typedef cds::intrusive::MultiLevelHashSet< gc, node_type, intrusive_type_traits >   type ;
+    };
+
+}}} // namespace cds::container::details
+//@endcond
+
+#endif // __CDS_CONTAINER_DETAILS_MAKE_MULTILEVEL_HASHMAP_H
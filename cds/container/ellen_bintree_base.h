@@ -0,0 +1,139 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_ELLEN_BINTREE_BASE_H
+#define __CDS_CONTAINER_ELLEN_BINTREE_BASE_H
+
+#include <cds/intrusive/ellen_bintree_base.h>
+#include <cds/container/base.h>
+
+namespace cds { namespace container {
+
+    /// EllenBinTree related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace ellen_bintree {
+
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Typedef for intrusive::ellen_bintree::key_extractor option setter
+        template <typename KeyExtractor> struct key_extractor {};
+#else
+        using cds::intrusive::ellen_bintree::key_extractor ;
+#endif
+
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Typedef for intrusive::ellen_bintree::stat class
+        class stat {};
+#else
+        using cds::intrusive::ellen_bintree::stat ;
+#endif
+
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Typedef for intrusive::ellen_bintree::empty_stat class
+        class empty_stat {};
+#else
+        using cds::intrusive::ellen_bintree::empty_stat ;
+#endif
+
+        /// Type traits for EllenBinTreeSet and EllenBinTreeMap classes
+        struct type_traits
+        {
+            /// Key extracting functor (only for EllenBinTreeSet)
+            /**
+                The functor copies the key from the value into the internal node of the tree:
+                \code
+                struct key_extractor {
+                    void operator()( key_type& dest, value_type const& src ) ;
+                };
+                \endcode
+                The option is mandatory for EllenBinTreeSet. EllenBinTreeMap ignores it:
+                the key of the map is the first member of the pair stored.
+            */
+            typedef opt::none                       key_extractor ;
+
+            /// Key comparison functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+
+                For EllenBinTreeSet the functor should be able to compare <tt>(value_type, value_type)</tt>,
+                <tt>(value_type, key_type)</tt> and <tt>(Q, key_type)</tt>, <tt>(Q, value_type)</tt> where \p Q
+                is a type of the key passed to the search functions. For EllenBinTreeMap the functor compares the keys.
+            */
+            typedef opt::none                       compare     ;
+
+            /// specifies binary predicate used for key compare.
+            /**
+                Default is \p std::less<T>.
+            */
+            typedef opt::none                       less        ;
+
+            /// Item counter
+            /**
+                The type for item counting feature.
+                Default is no item counter (\ref atomicity::empty_item_counter)
+            */
+            typedef atomicity::empty_item_counter   item_counter;
+
+            /// C++ memory ordering model
+            /**
+                List of available memory ordering see opt::memory_model
+            */
+            typedef opt::v::relaxed_ordering        memory_model    ;
+
+            /// Allocator for the leaf nodes, the internal nodes and the update descriptors
+            typedef CDS_DEFAULT_ALLOCATOR           allocator ;
+
+            /// back-off strategy used
+            /**
+                If the option is not specified, the cds::backoff::Default is used.
+            */
+            typedef cds::backoff::Default           back_off    ;
+
+            /// Internal statistics
+            typedef empty_stat                      stat ;
+
+            /// RCU deadlock checking policy (only for RCU-based EllenBinTreeSet and EllenBinTreeMap)
+            /**
+                List of available options see opt::rcu_check_deadlock
+            */
+            typedef opt::v::rcu_throw_deadlock      rcu_check_deadlock ;
+        };
+
+        /// Metafunction converting option list to EllenBinTreeSet and EllenBinTreeMap traits
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options list see \ref EllenBinTreeSet.
+        */
+        template <CDS_DECL_OPTIONS10>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, CDS_OPTIONS10 >::type
+                ,CDS_OPTIONS10
+            >::type   type ;
+#   endif
+        };
+
+    } // namespace ellen_bintree
+
+    // Forward declaration
+    template <class GC, typename Key, typename T, typename Traits = ellen_bintree::type_traits >
+    class EllenBinTreeSet  ;
+
+    // Forward declaration
+    template <class GC, typename Key, typename T, typename Traits = ellen_bintree::type_traits >
+    class EllenBinTreeMap  ;
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_ELLEN_BINTREE_BASE_H
@@ -0,0 +1,562 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_ELLEN_BINTREE_MAP_IMPL_H
+#define __CDS_CONTAINER_ELLEN_BINTREE_MAP_IMPL_H
+
+#include <cds/details/functor_wrapper.h>
+#include <cds/details/binary_functor_wrapper.h>
+
+namespace cds { namespace container {
+
+    /// Map based on Ellen's et al binary search tree
+    /** @ingroup cds_nonintrusive_map
+        @ingroup cds_nonintrusive_tree
+        \anchor cds_nonintrusive_EllenBinTreeMap
+
+        Source:
+            - [2010] F.Ellen, P.Fatourou, E.Ruppert, F.van Breugel "Non-blocking Binary Search Tree"
+
+        The map stores <tt>std::pair<Key const, T></tt> in the leaves of unbalanced leaf-oriented binary search tree;
+        the internal nodes keep the copies of the keys. Unlike \ref cds_nonintrusive_EllenBinTreeSet "EllenBinTreeSet",
+        the map does not need the key extractor: the key is the first member of the pair.
+
+        Template arguments:
+        - \p GC - Garbage collector used: gc::HP, gc::PTB or \ref cds_urcu_gc "RCU type"
+        - \p Key - key type
+        - \p T - value type to be stored in the map
+        - \p Traits - type traits. See ellen_bintree::type_traits for explanation.
+
+        It is possible to declare option-based tree with cds::container::ellen_bintree::make_traits metafunction
+        instead of \p Traits template argument. The options are the same as for
+        \ref cds_nonintrusive_EllenBinTreeSet "EllenBinTreeSet" except ellen_bintree::key_extractor
+        that is not used. opt::compare and opt::less options specify the comparison of the keys.
+
+        \note There are several specializations of \p %EllenBinTreeMap for each \p GC. You should include:
+        - <tt><cds/container/ellen_bintree_map_hp.h></tt> for gc::HP garbage collector
+        - <tt><cds/container/ellen_bintree_map_ptb.h></tt> for gc::PTB garbage collector
+        - <tt><cds/container/ellen_bintree_map_rcu.h></tt> for \ref cds_urcu_gc "RCU type".
+            For RCU-based map the functions that remove items (\p erase, \p extract_min, \p extract_max, \p clear)
+            must be called outside of RCU lock.
+
+        The map has no iterators.
+    */
+    template <
+        typename GC,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        typename Traits = ellen_bintree::type_traits
+#else
+        typename Traits
+#endif
+    >
+    class EllenBinTreeMap:
+#ifdef CDS_DOXYGEN_INVOKED
+        protected intrusive::EllenBinTree< GC, Key, std::pair<Key const, T>, Traits >
+#else
+        protected details::make_ellen_bintree_map< GC, Key, T, Traits >::type
+#endif
+    {
+        //@cond
+        typedef details::make_ellen_bintree_map< GC, Key, T, Traits >    maker ;
+        typedef typename maker::type base_class ;
+        //@endcond
+
+    public:
+        typedef typename base_class::gc          gc  ; ///< Garbage collector used
+        typedef Key     key_type    ;   ///< Key type
+        typedef T       mapped_type ;   ///< Mapped type
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef std::pair< Key const, T> value_type   ;   ///< Value type stored in the map
+#   else
+        typedef typename maker::value_type  value_type  ;
+#   endif
+        typedef Traits  options     ;   ///< Options specified
+
+        typedef typename base_class::back_off       back_off        ;   ///< Back-off strategy used
+        typedef typename options::allocator         allocator_type  ;   ///< Allocator type used for allocate/deallocate the nodes
+        typedef typename base_class::item_counter   item_counter    ;   ///< Item counting policy used
+        typedef typename maker::key_comparator      key_comparator  ;   ///< key comparision functor
+        typedef typename base_class::memory_model   memory_model    ;   ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename options::stat              stat            ;   ///< internal statistics type
+
+    protected:
+        //@cond
+        typedef typename maker::node_type           node_type       ;
+        typedef typename maker::node_allocator      node_allocator  ;
+
+        typedef std::unique_ptr< node_type, typename maker::node_deallocator >    scoped_node_ptr ;
+        //@endcond
+
+    protected:
+        //@cond
+#   ifndef CDS_CXX11_LAMBDA_SUPPORT
+        struct empty_insert_functor
+        {
+            void operator()( value_type& ) const
+            {}
+        };
+
+        template <typename Q>
+        class insert_value_functor
+        {
+            Q const&    m_val   ;
+        public:
+            insert_value_functor( Q const & v)
+                : m_val(v)
+            {}
+
+            void operator()( value_type& item )
+            {
+                item.second = m_val ;
+            }
+        };
+
+        template <typename Func>
+        class insert_key_wrapper: protected cds::details::functor_wrapper<Func>
+        {
+            typedef cds::details::functor_wrapper<Func> base_class ;
+        public:
+            insert_key_wrapper( Func f ): base_class(f) {}
+
+            void operator()( node_type& item )
+            {
+                base_class::get()( item.m_Value ) ;
+            }
+        };
+
+        template <typename Func>
+        class ensure_wrapper: protected cds::details::functor_wrapper<Func>
+        {
+            typedef cds::details::functor_wrapper<Func> base_class ;
+        public:
+            ensure_wrapper( Func f) : base_class(f) {}
+
+            void operator()( bool bNew, node_type& item, node_type const& )
+            {
+                base_class::get()( bNew, item.m_Value ) ;
+            }
+        };
+
+        template <typename Func>
+        struct erase_functor
+        {
+            Func        m_func  ;
+
+            erase_functor( Func f )
+                : m_func(f)
+            {}
+
+            void operator()( node_type& node )
+            {
+                cds::unref(m_func)( node.m_Value )  ;
+            }
+        };
+
+        template <typename Func>
+        class find_wrapper: protected cds::details::functor_wrapper<Func>
+        {
+            typedef cds::details::functor_wrapper<Func> base_class ;
+        public:
+            find_wrapper( Func f )
+                : base_class(f)
+            {}
+
+            template <typename Q>
+            void operator()( node_type& item, Q& val )
+            {
+                base_class::get()( item.m_Value ) ;
+            }
+        };
+#   endif  // #ifndef CDS_CXX11_LAMBDA_SUPPORT
+        //@endcond
+
+    public:
+        /// Default ctor
+        EllenBinTreeMap()
+            : base_class()
+        {}
+
+        /// Clears the map
+        ~EllenBinTreeMap()
+        {}
+
+    public:
+        /// Inserts new node with key and default value
+        /**
+            The function creates a node with \p key and default value, and then inserts the node created into the map.
+
+            Preconditions:
+            - The \ref key_type should be constructible from a value of type \p K.
+                In trivial case, \p K is equal to \ref key_type.
+            - The \ref mapped_type should be default-constructible.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return insert_key( key, [](value_type&){} )    ;
+#       else
+            return insert_key( key, empty_insert_functor() )   ;
+#       endif
+        }
+
+        /// Inserts new node
+        /**
+            The function creates a node with copy of \p val value
+            and then inserts the node created into the map.
+
+            Preconditions:
+            - The \ref key_type should be constructible from \p key of type \p K.
+            - The \ref mapped_type should be constructible from \p val of type \p V.
+
+            Returns \p true if \p val is inserted into the map, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            scoped_node_ptr pNode( node_allocator().New( key, val )) ;
+            if ( base_class::insert( *pNode )) {
+                pNode.release() ;
+                return true     ;
+            }
+            return false ;
+        }
+
+        /// Inserts new node and initialize it by a functor
+        /**
+            This function inserts new node with key \p key and if inserting is successful then it calls
+            \p func functor with signature
+            \code
+                struct functor {
+                    void operator()( value_type& item )  ;
+                };
+            \endcode
+
+            The argument \p item of user-defined functor \p func is the reference
+            to the map's item inserted:
+                - <tt>item.first</tt> is a const reference to item's key that cannot be changed.
+                - <tt>item.second</tt> is a reference to item's value that may be changed.
+
+            The user-defined functor can be passed by reference using <tt>boost::ref</tt>
+            and it is called only if inserting is successful.
+
+            The key_type should be constructible from value of type \p K.
+        */
+        template <typename K, typename Func>
+        bool insert_key( const K& key, Func func )
+        {
+            scoped_node_ptr pNode( node_allocator().New( key )) ;
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            if ( base_class::insert( *pNode, [&func]( node_type& item ) { cds::unref(func)( item.m_Value ); } ))
+#       else
+            insert_key_wrapper<Func> wrapper(func) ;
+            if ( base_class::insert( *pNode, cds::ref(wrapper) ))
+#endif
+            {
+                pNode.release() ;
+                return true     ;
+            }
+            return false ;
+        }
+
+#   ifdef CDS_EMPLACE_SUPPORT
+        /// For key \p key inserts data of type \ref value_type constructed with <tt>std::forward<Args>(args)...</tt>
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+
+            @note This function is available only for compiler that supports
+            variadic template and move semantics
+        */
+        template <typename K, typename... Args>
+        bool emplace( K&& key, Args&&... args )
+        {
+            scoped_node_ptr pNode( node_allocator().MoveNew( std::forward<K>(key), std::forward<Args>(args)... )) ;
+            if ( base_class::insert( *pNode )) {
+                pNode.release() ;
+                return true     ;
+            }
+            return false ;
+        }
+#   endif
+
+        /// Ensures that the \p key exists in the map
+        /**
+            The operation performs inserting or changing data with lock-free manner.
+
+            If the \p key not found in the map, then the new item created from \p key
+            is inserted into the map (note that in this case the \ref key_type should be
+            constructible from type \p K).
+            Otherwise, the functor \p func is called with item found.
+            The functor \p Func may be a function with signature:
+            \code
+                void func( bool bNew, value_type& item ) ;
+            \endcode
+            or a functor:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, value_type& item ) ;
+                };
+            \endcode
+
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - item of the map
+
+            The functor may change any fields of the \p item.second that is \ref mapped_type.
+
+            You may pass \p func argument by reference using <tt>boost::ref</tt>.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is true if operation is successfull,
+            \p second is true if new item has been added or \p false if the item with \p key
+            already is in the map.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> ensure( K const& key, Func func )
+        {
+            scoped_node_ptr pNode( node_allocator().New( key )) ;
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            std::pair<bool, bool> res = base_class::ensure( *pNode,
+                [&func](bool bNew, node_type& item, node_type const& ){ cds::unref(func)( bNew, item.m_Value ); }
+            ) ;
+#       else
+            ensure_wrapper<Func> wrapper( func )   ;
+            std::pair<bool, bool> res = base_class::ensure( *pNode, cds::ref(wrapper) ) ;
+#       endif
+            if ( res.first && res.second )
+                pNode.release() ;
+            return res ;
+        }
+
+        /// Delete \p key from the map
+        /** \anchor cds_nonintrusive_EllenBinTreeMap_erase_val
+
+            Return \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return base_class::erase(key) ;
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeMap_erase_val "erase(K const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool erase_with( K const& key, Less pred )
+        {
+            return base_class::erase_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor >()) ;
+        }
+
+        /// Delete \p key from the map
+        /** \anchor cds_nonintrusive_EllenBinTreeMap_erase_func
+
+            The function searches an item with key \p key, calls \p f functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()(value_type& item) { ... }
+            };
+            \endcode
+            The functor may be passed by reference using <tt>boost:ref</tt>
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::erase( key, [&f]( node_type& node) { cds::unref(f)( node.m_Value ); } ) ;
+#       else
+            erase_functor<Func> wrapper(f) ;
+            return base_class::erase( key, cds::ref(wrapper)) ;
+#       endif
+        }
+
+        /// Deletes the item from the map using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeMap_erase_func "erase(K const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        bool erase_with( K const& key, Less pred, Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::erase_with( key,
+                cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor >(),
+                [&f]( node_type& node) { cds::unref(f)( node.m_Value ); } ) ;
+#       else
+            erase_functor<Func> wrapper(f) ;
+            return base_class::erase_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor >(), cds::ref(wrapper)) ;
+#       endif
+        }
+
+        /// Extracts an item with minimal key from the map
+        /** \anchor cds_nonintrusive_EllenBinTreeMap_extract_min
+            The function unlinks the item with the leftmost key, calls the functor \p f for it
+            and then deletes the item. The functor interface is:
+            \code
+            struct functor {
+                void operator()( value_type& item ) ;
+            };
+            \endcode
+
+            Returns \p false if the map is empty.
+
+            @note The key extracted is <i>nearly</i> minimal: a concurrent thread can insert a lesser key
+            while the function unlinks the leftmost item.
+        */
+        template <typename Func>
+        bool extract_min( Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::extract_min( [&f]( node_type& node) { cds::unref(f)( node.m_Value ); } ) ;
+#       else
+            erase_functor<Func> wrapper(f) ;
+            return base_class::extract_min( cds::ref(wrapper)) ;
+#       endif
+        }
+
+        /// Extracts an item with maximal key from the map
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeMap_extract_min "extract_min"
+            for the item with the rightmost key.
+        */
+        template <typename Func>
+        bool extract_max( Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::extract_max( [&f]( node_type& node) { cds::unref(f)( node.m_Value ); } ) ;
+#       else
+            erase_functor<Func> wrapper(f) ;
+            return base_class::extract_max( cds::ref(wrapper)) ;
+#       endif
+        }
+
+        /// Find the key \p key
+        /** \anchor cds_nonintrusive_EllenBinTreeMap_find_cfunc
+
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item ) ;
+            };
+            \endcode
+            where \p item is the item found.
+
+            You can pass \p f argument by reference using <tt>boost::ref</tt> or cds::ref.
+
+            The functor may change \p item.second.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::find( key, [&f](node_type& item, K const& ) { cds::unref(f)( item.m_Value );}) ;
+#       else
+            find_wrapper<Func> wrapper(f)       ;
+            return base_class::find( key, cds::ref(wrapper) )   ;
+#       endif
+        }
+
+        /// Finds the key \p val using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeMap_find_cfunc "find(K const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less, typename Func>
+        bool find_with( K const& key, Less pred, Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::find_with( key,
+                cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor >(),
+                [&f](node_type& item, K const& ) { cds::unref(f)( item.m_Value );}) ;
+#       else
+            find_wrapper<Func> wrapper(f)       ;
+            return base_class::find_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor >(), cds::ref(wrapper) )   ;
+#       endif
+        }
+
+        /// Find the key \p key
+        /** \anchor cds_nonintrusive_EllenBinTreeMap_find_val
+
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+        */
+        template <typename K>
+        bool find( K const& key ) const
+        {
+            return base_class::find( key ) ;
+        }
+
+        /// Finds the key \p val using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeMap_find_val "find(K const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool find_with( K const& key, Less pred ) const
+        {
+            return base_class::find_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor >() ) ;
+        }
+
+        /// Clears the map (non-atomic)
+        void clear()
+        {
+            base_class::clear() ;
+        }
+
+        /// Checks if the map is empty
+        bool empty() const
+        {
+            return base_class::empty() ;
+        }
+
+        /// Returns item count in the map
+        /**
+            The value returned depends on item counter type provided by \p Traits template parameter.
+            If it is atomicity::empty_item_counter this function always returns 0.
+            Therefore, the function is not suitable for checking the map emptiness, use \ref empty
+            member function for this purpose.
+        */
+        size_t size() const
+        {
+            return base_class::size()    ;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return base_class::statistics() ;
+        }
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_ELLEN_BINTREE_MAP_IMPL_H
@@ -0,0 +1,20 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_ELLEN_BINTREE_MAP_RCU_H
+#define __CDS_CONTAINER_ELLEN_BINTREE_MAP_RCU_H
+
+#include <cds/container/ellen_bintree_base.h>
+#include <cds/intrusive/ellen_bintree_rcu.h>
+#include <cds/container/details/make_ellen_bintree_map.h>
+#include <cds/container/ellen_bintree_map_impl.h>
+
+#endif  // #ifndef __CDS_CONTAINER_ELLEN_BINTREE_MAP_RCU_H
@@ -0,0 +1,600 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_ELLEN_BINTREE_SET_IMPL_H
+#define __CDS_CONTAINER_ELLEN_BINTREE_SET_IMPL_H
+
+#include <cds/details/binary_functor_wrapper.h>
+
+namespace cds { namespace container {
+
+    /// Set based on Ellen's et al binary search tree
+    /** @ingroup cds_nonintrusive_map
+        @ingroup cds_nonintrusive_tree
+        \anchor cds_nonintrusive_EllenBinTreeSet
+
+        Source:
+            - [2010] F.Ellen, P.Fatourou, E.Ruppert, F.van Breugel "Non-blocking Binary Search Tree"
+
+        The set is a leaf-oriented binary search tree: the values are stored in the leaves,
+        the internal nodes contain the copies of the keys and route the search.
+        The tree is not balanced. See \ref cds_intrusive_EllenBinTree "intrusive EllenBinTree" for the algorithm description.
+
+        The set stores the values of type \p T; the internal nodes of the tree keep the keys of type \p Key
+        obtained from the value by the ellen_bintree::key_extractor functor. Usually, \p Key is a part of \p T.
+
+        Template arguments:
+        - \p GC - Garbage collector used: gc::HP, gc::PTB or \ref cds_urcu_gc "RCU type"
+        - \p Key - key type, a subset of \p T
+        - \p T - type to be stored in the set
+        - \p Traits - type traits. See ellen_bintree::type_traits for explanation.
+
+        It is possible to declare option-based tree with cds::container::ellen_bintree::make_traits metafunction
+        instead of \p Traits template argument.
+        Template argument list \p Options of cds::container::ellen_bintree::make_traits metafunction are:
+        - ellen_bintree::key_extractor - key extracting functor, mandatory option. The functor has the following prototype:
+            \code
+                struct key_extractor {
+                    void operator ()( Key& dest, T const& src ) ;
+                };
+            \endcode
+            It should initialize \p dest key from \p src data. The functor is used to initialize internal nodes.
+        - opt::compare - key comparison functor. No default functor is provided.
+            If the option is not specified, the opt::less is used.
+        - opt::less - specifies binary predicate used for key comparison. Default is \p std::less<T>.
+        - opt::item_counter - the type of item counting feature. Default is \ref atomicity::empty_item_counter that is no item counting.
+        - opt::memory_model - C++ memory ordering model. Can be opt::v::relaxed_ordering (relaxed memory model, the default)
+            or opt::v::sequential_consistent (sequentially consisnent memory model).
+        - opt::allocator - allocator for the leaves, the internal nodes and the update descriptors. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - opt::back_off - back-off strategy used. If the option is not specified, the cds::backoff::Default is used.
+        - opt::stat - internal statistics. Available types: ellen_bintree::stat, ellen_bintree::empty_stat (the default)
+        - opt::rcu_check_deadlock - a deadlock checking policy for RCU-based tree. Default is opt::v::rcu_throw_deadlock
+
+        @warning The tree requires 7 hazard pointers per thread for gc::HP.
+
+        \note There are several specializations of \p %EllenBinTreeSet for each \p GC. You should include:
+        - <tt><cds/container/ellen_bintree_set_hp.h></tt> for gc::HP garbage collector
+        - <tt><cds/container/ellen_bintree_set_ptb.h></tt> for gc::PTB garbage collector
+        - <tt><cds/container/ellen_bintree_set_rcu.h></tt> for \ref cds_urcu_gc "RCU type".
+            For RCU-based set the functions that remove items (\p erase, \p extract_min, \p extract_max, \p clear)
+            must be called outside of RCU lock.
+
+        The set has no iterators.
+    */
+    template <
+        typename GC,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        typename Traits = ellen_bintree::type_traits
+#else
+        typename Traits
+#endif
+    >
+    class EllenBinTreeSet:
+#ifdef CDS_DOXYGEN_INVOKED
+        protected intrusive::EllenBinTree< GC, Key, T, Traits >
+#else
+        protected details::make_ellen_bintree_set< GC, Key, T, Traits >::type
+#endif
+    {
+        //@cond
+        typedef details::make_ellen_bintree_set< GC, Key, T, Traits >    maker ;
+        typedef typename maker::type base_class ;
+        //@endcond
+
+    public:
+        typedef typename base_class::gc          gc  ; ///< Garbage collector used
+        typedef Key     key_type    ;   ///< type of a key stored in internal nodes; key is a part of \p value_type
+        typedef T       value_type  ;   ///< @anchor cds_container_EllenBinTreeSet_value_type Value type stored in the set
+        typedef Traits  options     ;   ///< Options specified
+
+        typedef typename base_class::back_off       back_off        ;   ///< Back-off strategy used
+        typedef typename options::allocator         allocator_type  ;   ///< Allocator type used for allocate/deallocate the nodes
+        typedef typename base_class::item_counter   item_counter    ;   ///< Item counting policy used
+        typedef typename maker::key_comparator      key_comparator  ;   ///< key comparision functor
+        typedef typename base_class::memory_model   memory_model    ;   ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename options::stat              stat            ;   ///< internal statistics type
+        typedef typename options::key_extractor     key_extractor   ;   ///< key extracting functor
+
+    protected:
+        //@cond
+        typedef typename maker::node_type           node_type       ;
+        typedef typename maker::node_allocator      node_allocator  ;
+
+        typedef std::unique_ptr< node_type, typename maker::node_deallocator >    scoped_node_ptr ;
+        //@endcond
+
+    protected:
+        //@cond
+#   ifndef CDS_CXX11_LAMBDA_SUPPORT
+        template <typename Func>
+        struct insert_functor
+        {
+            Func        m_func  ;
+
+            insert_functor ( Func f )
+                : m_func(f)
+            {}
+
+            void operator()( node_type& node )
+            {
+                cds::unref(m_func)( node.m_Value )  ;
+            }
+        };
+
+        template <typename Q, typename Func>
+        struct ensure_functor
+        {
+            Func        m_func  ;
+            Q const&    m_arg   ;
+
+            ensure_functor( Q const& arg, Func f )
+                : m_func(f)
+                , m_arg( arg )
+            {}
+
+            void operator ()( bool bNew, node_type& node, node_type& )
+            {
+                cds::unref(m_func)( bNew, node.m_Value, m_arg ) ;
+            }
+        };
+
+        template <typename Func>
+        struct find_functor
+        {
+            Func    m_func  ;
+
+            find_functor( Func f )
+                : m_func(f)
+            {}
+
+            template <typename Q>
+            void operator ()( node_type& node, Q& val )
+            {
+                cds::unref(m_func)( node.m_Value, val ) ;
+            }
+        };
+
+        template <typename Func>
+        struct erase_functor
+        {
+            Func        m_func  ;
+
+            erase_functor( Func f )
+                : m_func(f)
+            {}
+
+            void operator()( node_type const& node )
+            {
+                cds::unref(m_func)( node.m_Value )  ;
+            }
+        };
+#   endif  // ifndef CDS_CXX11_LAMBDA_SUPPORT
+        //@endcond
+
+    public:
+        /// Default ctor
+        EllenBinTreeSet()
+            : base_class()
+        {}
+
+        /// Clears the set
+        ~EllenBinTreeSet()
+        {}
+
+    public:
+        /// Inserts new node
+        /**
+            The function creates a node with copy of \p val value
+            and then inserts the node created into the set.
+
+            The type \p Q should contain at least the complete key for the node.
+            The object of \ref value_type should be constructible from a value of type \p Q.
+            In trivial case, \p Q is equal to \ref value_type.
+
+            Returns \p true if \p val is inserted into the set, \p false otherwise.
+        */
+        template <typename Q>
+        bool insert( Q const& val )
+        {
+            scoped_node_ptr sp( node_allocator().New( val )) ;
+            if ( base_class::insert( *sp.get() )) {
+                sp.release()    ;
+                return true     ;
+            }
+            return false ;
+        }
+
+        /// Inserts new node
+        /**
+            The function allows to split creating of new item into two part:
+            - create item with key only
+            - insert new item into the set
+            - if inserting is success, calls  \p f functor to initialize value-fields of \p val.
+
+            The functor signature is:
+            \code
+                void func( value_type& val ) ;
+            \endcode
+            where \p val is the item inserted. User-defined functor \p f should guarantee that during changing
+            \p val no any other changes could be made on this set's item by concurrent threads.
+            The user-defined functor is called only if the inserting is success. It may be passed by reference
+            using <tt>boost::ref</tt>
+        */
+        template <typename Q, typename Func>
+        bool insert( Q const& val, Func f )
+        {
+            scoped_node_ptr sp( node_allocator().New( val )) ;
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            if ( base_class::insert( *sp.get(), [&f]( node_type& val ) { cds::unref(f)( val.m_Value ); } ))
+#       else
+            insert_functor<Func> wrapper(f) ;
+            if ( base_class::insert( *sp, cds::ref(wrapper) ))
+#       endif
+            {
+                sp.release()    ;
+                return true     ;
+            }
+            return false ;
+        }
+
+        /// Ensures that the item exists in the set
+        /**
+            The operation performs inserting or changing data with lock-free manner.
+
+            If the \p val key not found in the set, then the new item created from \p val
+            is inserted into the set. Otherwise, the functor \p func is called with the item found.
+            The functor \p Func should be a function with signature:
+            \code
+                void func( bool bNew, value_type& item, const Q& val ) ;
+            \endcode
+            or a functor:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, value_type& item, const Q& val ) ;
+                };
+            \endcode
+
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - item of the set
+            - \p val - argument \p key passed into the \p ensure function
+
+            The functor may change non-key fields of the \p item; however, \p func must guarantee
+            that during changing no any other modifications could be made on this item by concurrent threads.
+
+            You may pass \p func argument by reference using <tt>boost::ref</tt>.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is true if operation is successfull,
+            \p second is true if new item has been added or \p false if the item with \p key
+            already is in the set.
+        */
+        template <typename Q, typename Func>
+        std::pair<bool, bool> ensure( const Q& val, Func func )
+        {
+            scoped_node_ptr sp( node_allocator().New( val )) ;
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            std::pair<bool, bool> bRes = base_class::ensure( *sp,
+                [&func, &val](bool bNew, node_type& node, node_type&){ cds::unref(func)( bNew, node.m_Value, val ); }) ;
+#       else
+            ensure_functor<Q, Func> wrapper( val, func )    ;
+            std::pair<bool, bool> bRes = base_class::ensure( *sp, cds::ref(wrapper)) ;
+#       endif
+            if ( bRes.first && bRes.second )
+                sp.release() ;
+            return bRes ;
+        }
+
+#   ifdef CDS_EMPLACE_SUPPORT
+        /// Inserts data of type \ref cds_container_EllenBinTreeSet_value_type "value_type" constructed with <tt>std::forward<Args>(args)...</tt>
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+
+            @note This function is available only for compiler that supports
+            variadic template and move semantics
+        */
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            scoped_node_ptr sp( node_allocator().MoveNew( std::forward<Args>(args)... )) ;
+            if ( base_class::insert( *sp.get() )) {
+                sp.release()    ;
+                return true     ;
+            }
+            return false ;
+        }
+#   endif
+
+        /// Delete \p key from the set
+        /** \anchor cds_nonintrusive_EllenBinTreeSet_erase_val
+
+            The set item comparator should be able to compare the type \p value_type
+            and the type \p Q.
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename Q>
+        bool erase( Q const& key )
+        {
+            return base_class::erase( key ) ;
+        }
+
+        /// Deletes the item from the set using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeSet_erase_val "erase(Q const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool erase_with( Q const& key, Less pred )
+        {
+            return base_class::erase_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >() ) ;
+        }
+
+        /// Delete \p key from the set
+        /** \anchor cds_nonintrusive_EllenBinTreeSet_erase_func
+
+            The function searches an item with key \p key, calls \p f functor
+            and deletes the item. If \p key is not found, the functor is not called.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()(value_type const& val) ;
+            };
+            \endcode
+            The functor may be passed by reference using <tt>boost:ref</tt>
+
+            Return \p true if key is found and deleted, \p false otherwise
+        */
+        template <typename Q, typename Func>
+        bool erase( Q const& key, Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::erase( key, [&f]( node_type const& node) { cds::unref(f)( node.m_Value ); } ) ;
+#       else
+            erase_functor<Func> wrapper(f) ;
+            return base_class::erase( key, cds::ref(wrapper)) ;
+#       endif
+        }
+
+        /// Deletes the item from the set using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeSet_erase_func "erase(Q const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less, typename Func>
+        bool erase_with( Q const& key, Less pred, Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::erase_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >(),
+                [&f]( node_type const& node) { cds::unref(f)( node.m_Value ); } ) ;
+#       else
+            erase_functor<Func> wrapper(f) ;
+            return base_class::erase_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >(),
+                cds::ref(wrapper)) ;
+#       endif
+        }
+
+        /// Extracts an item with minimal key from the set
+        /** \anchor cds_nonintrusive_EllenBinTreeSet_extract_min
+            The function unlinks the leftmost item of the tree, calls the functor \p f for it
+            and then deletes the item. The functor interface is:
+            \code
+            struct functor {
+                void operator()( value_type const& val ) ;
+            };
+            \endcode
+            The functor may copy the value out of the set.
+
+            Returns \p false if the set is empty.
+
+            @note Due the concurrent nature of the set, the function extracts <i>nearly</i> minimum key:
+            during unlinking, a concurrent thread may insert an item with key less than the key of the item extracted.
+        */
+        template <typename Func>
+        bool extract_min( Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::extract_min( [&f]( node_type const& node) { cds::unref(f)( node.m_Value ); } ) ;
+#       else
+            erase_functor<Func> wrapper(f) ;
+            return base_class::extract_min( cds::ref(wrapper)) ;
+#       endif
+        }
+
+        /// Extracts an item with maximal key from the set
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeSet_extract_min "extract_min"
+            for the rightmost item of the tree.
+        */
+        template <typename Func>
+        bool extract_max( Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::extract_max( [&f]( node_type const& node) { cds::unref(f)( node.m_Value ); } ) ;
+#       else
+            erase_functor<Func> wrapper(f) ;
+            return base_class::extract_max( cds::ref(wrapper)) ;
+#       endif
+        }
+
+        /// Find the key \p val
+        /** \anchor cds_nonintrusive_EllenBinTreeSet_find_func
+
+            The function searches the item with key equal to \p val and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item, Q& val ) ;
+            };
+            \endcode
+            where \p item is the item found, \p val is the <tt>find</tt> function argument.
+
+            You may pass \p f argument by reference using <tt>boost::ref</tt> or cds::ref.
+
+            The functor may change non-key fields of \p item. Note that the functor is only guarantee
+            that \p item cannot be disposed during functor is executing.
+            The functor does not serialize simultaneous access to the set's \p item. If such access is
+            possible you must provide your own synchronization schema on item level to exclude unsafe item modifications.
+
+            The function returns \p true if \p val is found, \p false otherwise.
+        */
+        template <typename Q, typename Func>
+        bool find( Q& val, Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::find( val, [&f]( node_type& node, Q& v ) { cds::unref(f)( node.m_Value, v ); });
+#       else
+            find_functor<Func> wrapper(f) ;
+            return base_class::find( val, cds::ref(wrapper)) ;
+#       endif
+        }
+
+        /// Finds the key \p val using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeSet_find_func "find(Q&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less, typename Func>
+        bool find_with( Q& val, Less pred, Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::find_with( val, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >(),
+                [&f]( node_type& node, Q& v ) { cds::unref(f)( node.m_Value, v ); } );
+#       else
+            find_functor<Func> wrapper(f) ;
+            return base_class::find_with( val, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >(), cds::ref(wrapper)) ;
+#       endif
+        }
+
+        /// Find the key \p val
+        /** \anchor cds_nonintrusive_EllenBinTreeSet_find_cfunc
+
+            The function searches the item with key equal to \p val and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item, Q const& val ) ;
+            };
+            \endcode
+            where \p item is the item found, \p val is the <tt>find</tt> function argument.
+
+            You may pass \p f argument by reference using <tt>boost::ref</tt> or cds::ref.
+
+            The function returns \p true if \p val is found, \p false otherwise.
+        */
+        template <typename Q, typename Func>
+        bool find( Q const& val, Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::find( val, [&f]( node_type& node, Q const& v ) { cds::unref(f)( node.m_Value, v ); });
+#       else
+            find_functor<Func> wrapper(f) ;
+            return base_class::find( val, cds::ref(wrapper)) ;
+#       endif
+        }
+
+        /// Finds the key \p val using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeSet_find_cfunc "find(Q const&, Func)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less, typename Func>
+        bool find_with( Q const& val, Less pred, Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::find_with( val, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >(),
+                [&f]( node_type& node, Q const& v ) { cds::unref(f)( node.m_Value, v ); } );
+#       else
+            find_functor<Func> wrapper(f) ;
+            return base_class::find_with( val, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >(),
+                cds::ref(wrapper)) ;
+#       endif
+        }
+
+        /// Find the key \p val
+        /** \anchor cds_nonintrusive_EllenBinTreeSet_find_val
+
+            The function searches the item with key equal to \p val
+            and returns \p true if it is found, and \p false otherwise.
+        */
+        template <typename Q>
+        bool find( Q const& val ) const
+        {
+            return base_class::find( val )  ;
+        }
+
+        /// Finds the key \p val using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_EllenBinTreeSet_find_val "find(Q const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p Less must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool find_with( Q const& val, Less pred ) const
+        {
+            return base_class::find_with( val, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >());
+        }
+
+        /// Clears the set (non-atomic)
+        /**
+            The function unlinks all items from the tree.
+            The function is not atomic, thus, in multi-threaded environment with parallel insertions
+            this sequence
+            \code
+            set.clear() ;
+            assert( set.empty() ) ;
+            \endcode
+            the assertion could be raised.
+        */
+        void clear()
+        {
+            base_class::clear() ;
+        }
+
+        /// Checks if the set is empty
+        bool empty() const
+        {
+            return base_class::empty() ;
+        }
+
+        /// Returns item count in the set
+        /**
+            The value returned depends on item counter type provided by \p Traits template parameter.
+            If it is atomicity::empty_item_counter this function always returns 0.
+            Therefore, the function is not suitable for checking the set emptiness, use \ref empty
+            member function for this purpose.
+        */
+        size_t size() const
+        {
+            return base_class::size() ;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return base_class::statistics() ;
+        }
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_ELLEN_BINTREE_SET_IMPL_H
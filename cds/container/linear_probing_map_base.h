@@ -0,0 +1,150 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_LINEAR_PROBING_MAP_BASE_H
+#define __CDS_CONTAINER_LINEAR_PROBING_MAP_BASE_H
+
+#include <cds/container/base.h>
+#include <cds/opt/hash.h>
+
+namespace cds { namespace container {
+
+    /// LinearProbingMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace linear_probing_map {
+
+        /// LinearProbingMap internal statistics
+        struct stat {
+            typedef cds::atomicity::event_counter   event_counter ; ///< Event counter type
+
+            event_counter   m_nInsertSuccess        ; ///< Count of success insertion
+            event_counter   m_nInsertFailed         ; ///< Count of failed insertion (the key is found)
+            event_counter   m_nEnsureNew            ; ///< Count of \p ensure call that inserts new item
+            event_counter   m_nEnsureExisting       ; ///< Count of \p ensure call that replaces the value of existing item
+            event_counter   m_nEraseSuccess         ; ///< Count of successful \p erase call
+            event_counter   m_nEraseFailed          ; ///< Count of failed \p erase call
+            event_counter   m_nFindSuccess          ; ///< Count of successful \p find call
+            event_counter   m_nFindFailed           ; ///< Count of failed \p find call
+
+            event_counter   m_nCellReused           ; ///< Count of insertions into the cell of previously erased item with the same key
+            event_counter   m_nRedirect             ; ///< Count of operations that find a migrated cell and retry in the new table
+            event_counter   m_nMigrationStart       ; ///< Count of migrations started
+            event_counter   m_nMigrationCollision   ; ///< Count of attempts to start the migration that has been started by other thread
+            event_counter   m_nTableGrow            ; ///< Count of migrations into the table of double capacity
+            event_counter   m_nTablePurge           ; ///< Count of migrations into the table of the same capacity (erased cells purging)
+            event_counter   m_nChunkMigrated        ; ///< Count of the chunks of cells migrated
+
+            //@cond
+            void onInsertSuccess()      { ++m_nInsertSuccess    ; }
+            void onInsertFailed()       { ++m_nInsertFailed     ; }
+            void onEnsureNew()          { ++m_nEnsureNew        ; }
+            void onEnsureExisting()     { ++m_nEnsureExisting   ; }
+            void onEraseSuccess()       { ++m_nEraseSuccess     ; }
+            void onEraseFailed()        { ++m_nEraseFailed      ; }
+            void onFindSuccess()        { ++m_nFindSuccess      ; }
+            void onFindFailed()         { ++m_nFindFailed       ; }
+
+            void onCellReused()         { ++m_nCellReused       ; }
+            void onRedirect()           { ++m_nRedirect         ; }
+            void onMigrationStart()     { ++m_nMigrationStart   ; }
+            void onMigrationCollision() { ++m_nMigrationCollision; }
+            void onTableGrow()          { ++m_nTableGrow        ; }
+            void onTablePurge()         { ++m_nTablePurge       ; }
+            void onChunkMigrated()      { ++m_nChunkMigrated    ; }
+            //@endcond
+        };
+
+        /// LinearProbingMap empty internal statistics
+        struct empty_stat {
+            //@cond
+            void onInsertSuccess()      const {}
+            void onInsertFailed()       const {}
+            void onEnsureNew()          const {}
+            void onEnsureExisting()     const {}
+            void onEraseSuccess()       const {}
+            void onEraseFailed()        const {}
+            void onFindSuccess()        const {}
+            void onFindFailed()         const {}
+
+            void onCellReused()         const {}
+            void onRedirect()           const {}
+            void onMigrationStart()     const {}
+            void onMigrationCollision() const {}
+            void onTableGrow()          const {}
+            void onTablePurge()         const {}
+            void onChunkMigrated()      const {}
+            //@endcond
+        };
+
+        /// Type traits for LinearProbingMap class
+        struct type_traits
+        {
+            /// Hash functor
+            /**
+                The hash functor maps the key to \p size_t value.
+                Default is \p opt::v::hash (<tt>std::hash</tt>). The map mixes the bits
+                of the hash value before probing, so an identity hash of integral keys is good enough.
+            */
+            typedef opt::none   hash ;
+
+            /// Item counter
+            /**
+                The \p size() and \p empty() member functions depend on the item counting,
+                so, the default is atomicity::item_counter.
+            */
+            typedef atomicity::item_counter item_counter ;
+
+            /// C++ memory ordering model
+            /**
+                List of available memory ordering see opt::memory_model
+            */
+            typedef opt::v::relaxed_ordering    memory_model ;
+
+            /// Back-off strategy used while waiting for the migration of the table to be finished
+            typedef cds::backoff::Default       back_off ;
+
+            /// Allocator for the cell tables
+            typedef CDS_DEFAULT_ALLOCATOR       allocator ;
+
+            /// Internal statistics
+            /**
+                Possible types: \ref linear_probing_map::stat, \ref linear_probing_map::empty_stat (the default)
+            */
+            typedef empty_stat                  stat ;
+        };
+
+        /// Metafunction converting option list to LinearProbingMap traits
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options list see \ref LinearProbingMap.
+        */
+        template <CDS_DECL_OPTIONS6>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, CDS_OPTIONS6 >::type
+                ,CDS_OPTIONS6
+            >::type   type ;
+#   endif
+        };
+
+    } // namespace linear_probing_map
+
+    // Forward declaration
+    template < class GC, typename Key, typename Value, class Traits = linear_probing_map::type_traits >
+    class LinearProbingMap ;
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_LINEAR_PROBING_MAP_BASE_H
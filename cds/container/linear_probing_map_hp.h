@@ -0,0 +1,19 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_LINEAR_PROBING_MAP_HP_H
+#define __CDS_CONTAINER_LINEAR_PROBING_MAP_HP_H
+
+#include <cds/gc/hp.h>
+#include <cds/container/linear_probing_map_base.h>
+#include <cds/container/linear_probing_map_impl.h>
+
+#endif  // #ifndef __CDS_CONTAINER_LINEAR_PROBING_MAP_HP_H
@@ -0,0 +1,732 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_LINEAR_PROBING_MAP_IMPL_H
+#define __CDS_CONTAINER_LINEAR_PROBING_MAP_IMPL_H
+
+#include <limits>
+#include <cds/int_algo.h>
+#include <cds/ref.h>
+#include <cds/details/std/type_traits.h>
+
+namespace cds { namespace container {
+
+    /// Open-addressing hash map for word-sized keys and values with cooperative resizing
+    /** @ingroup cds_nonintrusive_map
+        \anchor cds_nonintrusive_LinearProbingMap
+
+        Source:
+            - [2007] Cliff Click "A Lock-Free Wait-Free Hash Table"
+            - [2016] Jeff Preshing "Junction: concurrent data structures in C++"
+
+        The map keeps the keys and the values in a flat power-of-two array of cells,
+        each cell is a pair of atomic words <tt>{ key, value }</tt>. The collisions are resolved by linear probing.
+        The map has no nodes, so the search touches only the cells of the probe sequence
+        and needs no per-item memory reclamation: the only object protected by the garbage collector
+        is the cell table itself, one guard per operation.
+
+        The key and the value must be integral types of at most word size.
+        Three bit patterns are reserved and must not be used as the key or as the value:
+        - <tt>std::numeric_limits<Key>::max()</tt> is the key of an empty cell
+        - <tt>std::numeric_limits<Value>::max()</tt> is the value of an empty or erased cell
+        - <tt>std::numeric_limits<Value>::max() - 1</tt> marks the cell that is moved into the new table
+
+        <b>Insertion</b> claims an empty cell of the probe sequence by CAS on the key and then publishes
+        the value by CAS. Once the key is stored the cell is never emptied, so a probe sequence is never broken.
+
+        <b>Deletion</b> resets the value of the cell by CAS and leaves the key in place; there is no special tombstone state.
+        A later insertion of the same key reuses the cell. The cells of erased keys are purged when the table is migrated.
+
+        <b>Resizing</b>. When the count of the cells with a key exceeds 3/4 of the capacity, the inserting thread
+        starts the migration: it sets the successor of the current table from \p NULL to the reserved "allocating" mark by CAS.
+        Only the thread that wins the CAS counts the live items and allocates the new table, then it publishes the new table
+        as the successor. The new table has double capacity, or the same capacity if the live items occupy at most half
+        of the table (the rest of the used cells hold erased keys).
+        The old cells are moved cooperatively: each thread that meets the migration claims the chunks of cells
+        by atomic increment of the cursor and moves them; the moved cell is marked by the reserved "redirect" value.
+        The thread that finishes the last chunk publishes the new table and retires the old one via \p GC.
+        An operation that meets a moved cell helps to finish the migration and then retries in the new table.
+
+        <b>Progress guarantee</b>. The map is not lock-free. While the new table is being allocated, and while
+        the last claimed chunks are being moved, the other threads that meet the migration wait with \p back_off strategy.
+        If the migrating thread is preempted, the insertions and the operations on the moved cells are blocked until it resumes.
+        The operations that do not meet the migration do not wait.
+
+        The map has no iterators.
+
+        Template parameters:
+        - \p GC - safe memory reclamation schema used for the cell tables. Can be \p gc::HP, \p gc::PTB or \p gc::EBR
+        - \p Key - key type, an integral type of at most word size
+        - \p Value - mapped type, an integral type of at most word size
+        - \p Traits - type traits, default is \p linear_probing_map::type_traits.
+            Instead of defining \p Traits struct you may use option-based syntax with \p linear_probing_map::make_traits metafunction.
+
+        Options (see \p linear_probing_map::type_traits):
+        - \p opt::hash - hash functor, default is \p opt::v::hash
+        - \p opt::allocator - allocator for the cell tables
+        - \p opt::item_counter, \p opt::memory_model, \p opt::back_off - as usual
+        - \p opt::stat - internal statistics, \p linear_probing_map::stat or \p linear_probing_map::empty_stat (the default)
+
+        There are header files for each \p GC type:
+        - <tt><cds/container/linear_probing_map_hp.h></tt> - for \p gc::HP
+        - <tt><cds/container/linear_probing_map_ptb.h></tt> - for \p gc::PTB
+        - <tt><cds/container/linear_probing_map_ebr.h></tt> - for \p gc::EBR
+    */
+    template <
+        class GC,
+        typename Key,
+        typename Value,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = linear_probing_map::type_traits
+#else
+        class Traits
+#endif
+    >
+    class LinearProbingMap
+    {
+    public:
+        typedef GC      gc          ;   ///< Garbage collector used for the cell tables
+        typedef Key     key_type    ;   ///< Key type
+        typedef Value   mapped_type ;   ///< Mapped type
+        typedef Traits  options     ;   ///< Options specified
+
+        typedef typename cds::opt::v::hash_selector< typename options::hash >::type hasher ;   ///< Hash functor
+        typedef typename options::item_counter      item_counter    ;   ///< Item counting policy used
+        typedef typename options::memory_model      memory_model    ;   ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename options::back_off          back_off        ;   ///< Back-off strategy
+        typedef typename options::allocator         allocator_type  ;   ///< Allocator type
+        typedef typename options::stat              stat            ;   ///< Internal statistics type
+
+        static_assert( std::numeric_limits<key_type>::is_integer && std::numeric_limits<key_type>::digits >= 8
+            && sizeof(key_type) <= sizeof(void *), "Key must be an integral type of at most word size" ) ;
+        static_assert( std::numeric_limits<mapped_type>::is_integer && std::numeric_limits<mapped_type>::digits >= 8
+            && sizeof(mapped_type) <= sizeof(void *), "Value must be an integral type of at most word size" ) ;
+
+    protected:
+        //@cond
+        static size_t const c_nMinCapacity      = 16    ;   // minimal capacity of the table
+        static size_t const c_nMigrateChunk     = 256   ;   // count of cells migrated by one claim
+        static size_t const c_nPurgeCapacity    = 1024  ;   // minimal capacity of the table that may be purged without growing
+
+        typedef CDS_ATOMIC::atomic< key_type >      atomic_key      ;
+        typedef CDS_ATOMIC::atomic< mapped_type >   atomic_value    ;
+
+        struct cell {
+            atomic_key      key     ;
+            atomic_value    value   ;
+        };
+
+        struct table {
+            size_t const                    nCapacity       ;   // power of two
+            size_t const                    nChunkCount     ;   // count of migration chunks
+            CDS_ATOMIC::atomic< table * >   pNext           ;   // the table the cells are migrated to
+            char                            pad1_[ cds::c_nCacheLineSize ] ;
+            CDS_ATOMIC::atomic<size_t>      nCellsUsed      ;   // count of cells with a key
+            char                            pad2_[ cds::c_nCacheLineSize ] ;
+            CDS_ATOMIC::atomic<size_t>      nMigrateCursor  ;   // next chunk to migrate
+            char                            pad3_[ cds::c_nCacheLineSize ] ;
+            CDS_ATOMIC::atomic<size_t>      nMigrateDone    ;   // count of migrated chunks
+            char                            pad4_[ cds::c_nCacheLineSize ] ;
+            cell                            cells[1]        ;   // actual size is nCapacity
+
+            explicit table( size_t nCap )
+                : nCapacity( nCap )
+                , nChunkCount( (nCap + c_nMigrateChunk - 1) / c_nMigrateChunk )
+            {}
+        };
+
+        typedef typename allocator_type::template rebind<unsigned char>::other  raw_allocator ;
+        typedef typename gc::Guard  guard_type ;
+
+        struct table_disposer {
+            void operator()( table * pTable )
+            {
+                free_table( pTable ) ;
+            }
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        CDS_ATOMIC::atomic< table * >   m_pTable        ;
+        item_counter                    m_ItemCounter   ;
+        stat                            m_Stat          ;
+        //@endcond
+
+    public:
+        /// Creates the map
+        /**
+            The initial capacity of the table is enough to keep \p nExpectedItemCount items without resizing.
+        */
+        LinearProbingMap(
+            size_t nExpectedItemCount = 64    ///< expected count of the items in the map
+        )
+        {
+            size_t nCap = cds::beans::ceil2( nExpectedItemCount * 4 / 3 + 1 ) ;
+            if ( nCap < c_nMinCapacity )
+                nCap = c_nMinCapacity ;
+            m_pTable.store( alloc_table( nCap ), memory_model::memory_order_release ) ;
+        }
+
+        /// Destroys the map
+        ~LinearProbingMap()
+        {
+            table * pTable = m_pTable.load( memory_model::memory_order_relaxed ) ;
+            assert( pTable->pNext.load( memory_model::memory_order_relaxed ) == null_ptr<table *>() ) ;
+            free_table( pTable ) ;
+        }
+
+        /// Inserts the \p key with default value
+        /**
+            The mapped value is <tt>mapped_type()</tt>.
+            Returns \p true if inserting successful, \p false otherwise (the key is already in the map).
+        */
+        bool insert( key_type key )
+        {
+            return insert( key, mapped_type() ) ;
+        }
+
+        /// Inserts new item
+        /**
+            The function inserts the pair <tt>(key, val)</tt> if the \p key is not found in the map.
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        bool insert( key_type key, mapped_type val )
+        {
+            assert( is_valid_key( key ) && is_valid_value( val )) ;
+
+            guard_type guard ;
+            mapped_type old ;
+            if ( do_insert( key, val, false, old, guard )) {
+                ++m_ItemCounter ;
+                m_Stat.onInsertSuccess() ;
+                return true ;
+            }
+            m_Stat.onInsertFailed() ;
+            return false ;
+        }
+
+        /// Ensures that the \p key maps to \p val
+        /**
+            If the \p key is not found in the map, the pair <tt>(key, val)</tt> is inserted.
+            Otherwise, the value of the existing item is replaced with \p val.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successful,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already exists.
+        */
+        std::pair<bool, bool> ensure( key_type key, mapped_type val )
+        {
+            assert( is_valid_key( key ) && is_valid_value( val )) ;
+
+            guard_type guard ;
+            mapped_type old ;
+            if ( do_insert( key, val, true, old, guard )) {
+                ++m_ItemCounter ;
+                m_Stat.onEnsureNew() ;
+                return std::make_pair( true, true ) ;
+            }
+            m_Stat.onEnsureExisting() ;
+            return std::make_pair( true, false ) ;
+        }
+
+        /// Deletes \p key from the map
+        /** \anchor cds_nonintrusive_LinearProbingMap_erase_val
+            Returns \p true if \p key is found and deleted, \p false otherwise
+        */
+        bool erase( key_type key )
+        {
+            return erase( key, empty_functor() ) ;
+        }
+
+        /// Deletes the item from the map
+        /**
+            The function searches an item with key equal to \p key, deletes it
+            and calls the functor \p f with the key and the erased value:
+            \code
+            struct functor {
+                void operator()( key_type key, mapped_type val ) ;
+            };
+            \endcode
+            The functor may be passed by reference using <tt>boost:ref</tt>.
+
+            Returns \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename Func>
+        bool erase( key_type key, Func f )
+        {
+            guard_type guard ;
+            mapped_type val ;
+            if ( do_erase( key, val, guard )) {
+                --m_ItemCounter ;
+                m_Stat.onEraseSuccess() ;
+                cds::unref( f )( key, val ) ;
+                return true ;
+            }
+            m_Stat.onEraseFailed() ;
+            return false ;
+        }
+
+        /// Finds the \p key
+        /** \anchor cds_nonintrusive_LinearProbingMap_find_val
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        bool find( key_type key )
+        {
+            return find( key, empty_functor() ) ;
+        }
+
+        /// Finds the \p key and calls the functor \p f with the key and the current value
+        /**
+            The functor interface is:
+            \code
+            struct functor {
+                void operator()( key_type key, mapped_type val ) ;
+            };
+            \endcode
+            The functor receives a copy of the value; since the value is a single word,
+            the copy is consistent even if the item is changed concurrently.
+            The functor may be passed by reference using <tt>boost:ref</tt>.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename Func>
+        bool find( key_type key, Func f )
+        {
+            guard_type guard ;
+            mapped_type val ;
+            if ( do_find( key, val, guard )) {
+                m_Stat.onFindSuccess() ;
+                cds::unref( f )( key, val ) ;
+                return true ;
+            }
+            m_Stat.onFindFailed() ;
+            return false ;
+        }
+
+        /// Clears the map
+        /**
+            The function erases all items of the map. The capacity of the table is not changed;
+            the cells of erased keys are purged by the next migration.
+        */
+        void clear()
+        {
+            guard_type guard ;
+            back_off bkoff ;
+            while ( true ) {
+                table * pTable = guard.protect( m_pTable ) ;
+                if ( clear_table( pTable ))
+                    break ;
+
+                // A cell is moved to the new table, clear the new one
+                m_Stat.onRedirect() ;
+                help_migrate( pTable, bkoff ) ;
+            }
+        }
+
+        /// Checks if the map is empty
+        /**
+            Emptiness is checked by item counting: if item count is zero then the map is empty.
+            Thus, the correct item counting feature is an important part of the map implementation.
+        */
+        bool empty() const
+        {
+            return size() == 0 ;
+        }
+
+        /// Returns item count in the map
+        size_t size() const
+        {
+            return m_ItemCounter ;
+        }
+
+        /// Returns the capacity of the current cell table
+        size_t capacity() const
+        {
+            guard_type guard ;
+            return guard.protect( m_pTable )->nCapacity ;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat ;
+        }
+
+    protected:
+        //@cond
+        struct empty_functor {
+            void operator()( key_type, mapped_type ) const
+            {}
+        };
+
+        static key_type empty_key()
+        {
+            return (std::numeric_limits<key_type>::max)() ;
+        }
+
+        static mapped_type null_value()
+        {
+            return (std::numeric_limits<mapped_type>::max)() ;
+        }
+
+        static mapped_type redirect_value()
+        {
+            return (std::numeric_limits<mapped_type>::max)() - 1 ;
+        }
+
+        // The successor mark of the table whose successor is being allocated by start_migrate
+        static table * allocating_table()
+        {
+            return reinterpret_cast<table *>( static_cast<uptr_atomic_t>( 1 )) ;
+        }
+
+        static bool is_valid_key( key_type key )
+        {
+            return key != empty_key() ;
+        }
+
+        static bool is_valid_value( mapped_type val )
+        {
+            return val != null_value() && val != redirect_value() ;
+        }
+
+        static size_t hash_index( key_type key, size_t nMask )
+        {
+            // The hash of integral key is often the key itself, mix it before masking
+            size_t h = hasher()( key ) ;
+#       if CDS_BUILD_BITS == 64
+            h ^= h >> 33 ;
+            h *= 0xff51afd7ed558ccdULL ;
+            h ^= h >> 33 ;
+            h *= 0xc4ceb9fe1a85ec53ULL ;
+            h ^= h >> 33 ;
+#       else
+            h ^= h >> 16 ;
+            h *= 0x85ebca6bU ;
+            h ^= h >> 13 ;
+            h *= 0xc2b2ae35U ;
+            h ^= h >> 16 ;
+#       endif
+            return h & nMask ;
+        }
+
+        static size_t table_bytes( size_t nCapacity )
+        {
+            return sizeof(table) + sizeof(cell) * (nCapacity - 1) ;
+        }
+
+        static table * alloc_table( size_t nCapacity )
+        {
+            assert( cds::beans::is_power2( nCapacity )) ;
+
+            unsigned char * pMem = raw_allocator().allocate( table_bytes( nCapacity )) ;
+            table * pTable = new( pMem ) table( nCapacity ) ;
+            // cells[0] is constructed by table ctor
+            for ( size_t i = 1; i < nCapacity; ++i )
+                new( pTable->cells + i ) cell ;
+            for ( size_t i = 0; i < nCapacity; ++i ) {
+                pTable->cells[i].key.store( empty_key(), CDS_ATOMIC::memory_order_relaxed ) ;
+                pTable->cells[i].value.store( null_value(), CDS_ATOMIC::memory_order_relaxed ) ;
+            }
+            pTable->pNext.store( null_ptr<table *>(), CDS_ATOMIC::memory_order_relaxed ) ;
+            pTable->nCellsUsed.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+            pTable->nMigrateCursor.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+            pTable->nMigrateDone.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+            return pTable ;
+        }
+
+        static void free_table( table * pTable )
+        {
+            size_t const nCapacity = pTable->nCapacity ;
+            for ( size_t i = 1; i < nCapacity; ++i )
+                pTable->cells[i].~cell() ;
+            pTable->~table() ;
+            raw_allocator().deallocate( reinterpret_cast<unsigned char *>( pTable ), table_bytes( nCapacity )) ;
+        }
+
+        // Erases all items of pTable. Returns false if a moved cell is found
+        bool clear_table( table * pTable )
+        {
+            for ( size_t i = 0; i < pTable->nCapacity; ++i ) {
+                atomic_value& cellValue = pTable->cells[i].value ;
+                mapped_type v = cellValue.load( memory_model::memory_order_acquire ) ;
+                while ( v != null_value() ) {
+                    if ( v == redirect_value() )
+                        return false ;
+                    if ( cellValue.compare_exchange_weak( v, null_value(), memory_model::memory_order_acq_rel, CDS_ATOMIC::memory_order_acquire )) {
+                        --m_ItemCounter ;
+                        break ;
+                    }
+                }
+            }
+            return true ;
+        }
+
+        // Inserts (key, val). If bUpdate is true and the key exists, its value is replaced with val.
+        // Returns true if new item is added; otherwise old contains the previous value of the key
+        bool do_insert( key_type key, mapped_type val, bool bUpdate, mapped_type& old, guard_type& guard )
+        {
+            back_off bkoff ;
+            while ( true ) {
+                table * pTable = guard.protect( m_pTable ) ;
+                if ( pTable->pNext.load( memory_model::memory_order_acquire ) != null_ptr<table *>() ) {
+                    // new items go into the new table
+                    help_migrate( pTable, bkoff ) ;
+                    continue ;
+                }
+
+                size_t const nMask = pTable->nCapacity - 1 ;
+                size_t idx = hash_index( key, nMask ) ;
+                bool bMigrate = true ;
+                for ( size_t nProbe = 0; nProbe <= nMask; ++nProbe, idx = (idx + 1) & nMask ) {
+                    cell& c = pTable->cells[idx] ;
+                    key_type k = c.key.load( memory_model::memory_order_acquire ) ;
+                    if ( k == empty_key() ) {
+                        if ( pTable->nCellsUsed.load( memory_model::memory_order_relaxed ) >= pTable->nCapacity / 4 * 3 )
+                            break ;     // the table is overloaded
+                        if ( c.key.compare_exchange_strong( k, key, memory_model::memory_order_acq_rel, CDS_ATOMIC::memory_order_acquire ))
+                            pTable->nCellsUsed.fetch_add( 1, memory_model::memory_order_relaxed ) ;
+                        else if ( k != key )
+                            continue ;  // the cell has been claimed by another key
+                    }
+                    else if ( k != key )
+                        continue ;
+
+                    // The cell of the key is found
+                    mapped_type v = c.value.load( memory_model::memory_order_acquire ) ;
+                    while ( true ) {
+                        if ( v == redirect_value() )
+                            break ;
+                        if ( v == null_value() ) {
+                            if ( c.value.compare_exchange_weak( v, val, memory_model::memory_order_acq_rel, CDS_ATOMIC::memory_order_acquire )) {
+                                if ( k == key )
+                                    m_Stat.onCellReused() ;
+                                return true ;
+                            }
+                        }
+                        else if ( !bUpdate ) {
+                            old = v ;
+                            return false ;
+                        }
+                        else if ( c.value.compare_exchange_weak( v, val, memory_model::memory_order_acq_rel, CDS_ATOMIC::memory_order_acquire )) {
+                            old = v ;
+                            return false ;
+                        }
+                    }
+
+                    // The cell is moved to the new table
+                    m_Stat.onRedirect() ;
+                    bMigrate = false ;
+                    break ;
+                }
+
+                if ( bMigrate )
+                    start_migrate( pTable ) ;
+                help_migrate( pTable, bkoff ) ;
+            }
+        }
+
+        bool do_erase( key_type key, mapped_type& val, guard_type& guard )
+        {
+            back_off bkoff ;
+            while ( true ) {
+                table * pTable = guard.protect( m_pTable ) ;
+                cell * pCell = find_cell( pTable, key ) ;
+                if ( !pCell )
+                    return false ;
+
+                mapped_type v = pCell->value.load( memory_model::memory_order_acquire ) ;
+                while ( v != redirect_value() ) {
+                    if ( v == null_value() )
+                        return false ;
+                    if ( pCell->value.compare_exchange_weak( v, null_value(), memory_model::memory_order_acq_rel, CDS_ATOMIC::memory_order_acquire )) {
+                        val = v ;
+                        return true ;
+                    }
+                }
+
+                m_Stat.onRedirect() ;
+                help_migrate( pTable, bkoff ) ;
+            }
+        }
+
+        bool do_find( key_type key, mapped_type& val, guard_type& guard )
+        {
+            back_off bkoff ;
+            while ( true ) {
+                table * pTable = guard.protect( m_pTable ) ;
+                cell * pCell = find_cell( pTable, key ) ;
+                if ( !pCell )
+                    return false ;
+
+                mapped_type v = pCell->value.load( memory_model::memory_order_acquire ) ;
+                if ( v == null_value() )
+                    return false ;
+                if ( v != redirect_value() ) {
+                    val = v ;
+                    return true ;
+                }
+
+                m_Stat.onRedirect() ;
+                help_migrate( pTable, bkoff ) ;
+            }
+        }
+
+        // Returns the cell of key or NULL if the key is not in pTable
+        cell * find_cell( table * pTable, key_type key ) const
+        {
+            size_t const nMask = pTable->nCapacity - 1 ;
+            size_t idx = hash_index( key, nMask ) ;
+            for ( size_t nProbe = 0; nProbe <= nMask; ++nProbe, idx = (idx + 1) & nMask ) {
+                key_type k = pTable->cells[idx].key.load( memory_model::memory_order_acquire ) ;
+                if ( k == key )
+                    return pTable->cells + idx ;
+                if ( k == empty_key() )
+                    return null_ptr<cell *>() ;
+            }
+            return null_ptr<cell *>() ;
+        }
+
+        // Allocates the successor of pTable and installs it
+        void start_migrate( table * pTable )
+        {
+            // Only one thread allocates the new table, the other threads wait for it in help_migrate
+            table * pExpected = null_ptr<table *>() ;
+            if ( !pTable->pNext.compare_exchange_strong( pExpected, allocating_table(), memory_model::memory_order_acquire, CDS_ATOMIC::memory_order_relaxed )) {
+                m_Stat.onMigrationCollision() ;
+                return ;
+            }
+
+            // Estimate the count of live items to choose the capacity
+            size_t nLive = 0 ;
+            for ( size_t i = 0; i < pTable->nCapacity; ++i ) {
+                mapped_type v = pTable->cells[i].value.load( memory_model::memory_order_relaxed ) ;
+                if ( v != null_value() && v != redirect_value() )
+                    ++nLive ;
+            }
+
+            size_t nCapacity = pTable->nCapacity ;
+            bool const bPurge = nCapacity >= c_nPurgeCapacity && nLive * 2 <= nCapacity ;
+            if ( !bPurge )
+                nCapacity *= 2 ;
+
+            table * pNew ;
+            try {
+                pNew = alloc_table( nCapacity ) ;
+            }
+            catch ( ... ) {
+                // Let another thread try again
+                pTable->pNext.store( null_ptr<table *>(), memory_model::memory_order_release ) ;
+                throw ;
+            }
+            pTable->pNext.store( pNew, memory_model::memory_order_release ) ;
+
+            m_Stat.onMigrationStart() ;
+            if ( bPurge )
+                m_Stat.onTablePurge() ;
+            else
+                m_Stat.onTableGrow() ;
+        }
+
+        // Helps to migrate pTable and waits until the new table is published
+        // pTable should be guarded by the caller
+        void help_migrate( table * pTable, back_off& bkoff )
+        {
+            table * pNext = pTable->pNext.load( memory_model::memory_order_acquire ) ;
+            if ( pNext == allocating_table() ) {
+                // Wait until the new table is allocated by other thread
+                bkoff.reset() ;
+                while ( (pNext = pTable->pNext.load( memory_model::memory_order_acquire )) == allocating_table() )
+                    bkoff() ;
+            }
+            if ( !pNext ) {
+                // The allocation of the new table has failed, the caller retries
+                return ;
+            }
+
+            size_t const nChunkCount = pTable->nChunkCount ;
+            while ( true ) {
+                size_t nChunk = pTable->nMigrateCursor.fetch_add( 1, memory_model::memory_order_relaxed ) ;
+                if ( nChunk >= nChunkCount )
+                    break ;
+
+                size_t const nLast = (nChunk + 1) * c_nMigrateChunk < pTable->nCapacity ? (nChunk + 1) * c_nMigrateChunk : pTable->nCapacity ;
+                for ( size_t i = nChunk * c_nMigrateChunk; i < nLast; ++i )
+                    migrate_cell( pTable->cells[i], pNext ) ;
+                m_Stat.onChunkMigrated() ;
+
+                if ( pTable->nMigrateDone.fetch_add( 1, memory_model::memory_order_acq_rel ) + 1 == nChunkCount ) {
+                    // The last chunk is migrated: publish the new table
+                    m_pTable.store( pNext, memory_model::memory_order_release ) ;
+                    gc::template retire<table_disposer>( pTable ) ;
+                    return ;
+                }
+            }
+
+            // Wait until the migration is finished by other threads
+            bkoff.reset() ;
+            while ( m_pTable.load( memory_model::memory_order_acquire ) == pTable )
+                bkoff() ;
+        }
+
+        // Moves the cell into pNew and marks it as redirected
+        static void migrate_cell( cell& c, table * pNew )
+        {
+            mapped_type v = c.value.load( memory_model::memory_order_acquire ) ;
+            cell * pDest = null_ptr<cell *>() ;
+            while ( true ) {
+                if ( v == null_value() ) {
+                    // The cell is empty or erased; if pDest is set, the key has been erased after copying
+                    if ( pDest )
+                        pDest->value.store( null_value(), memory_model::memory_order_relaxed ) ;
+                    if ( c.value.compare_exchange_strong( v, redirect_value(), memory_model::memory_order_acq_rel, CDS_ATOMIC::memory_order_acquire ))
+                        return ;
+                    continue ;
+                }
+                assert( v != redirect_value() ) ;
+
+                if ( !pDest ) {
+                    // Only the migrating thread writes to pNew while the migration is in progress,
+                    // and the key occurs in the old table once, so the key is absent in pNew
+                    key_type key = c.key.load( memory_model::memory_order_relaxed ) ;
+                    assert( key != empty_key() ) ;
+                    pDest = claim_cell( pNew, key ) ;
+                }
+
+                pDest->value.store( v, memory_model::memory_order_relaxed ) ;
+                if ( c.value.compare_exchange_strong( v, redirect_value(), memory_model::memory_order_acq_rel, CDS_ATOMIC::memory_order_acquire ))
+                    return ;
+                // The value has been changed concurrently, copy it again
+            }
+        }
+
+        static cell * claim_cell( table * pNew, key_type key )
+        {
+            size_t const nMask = pNew->nCapacity - 1 ;
+            size_t idx = hash_index( key, nMask ) ;
+            while ( true ) {
+                cell& c = pNew->cells[idx] ;
+                key_type k = empty_key() ;
+                if ( c.key.compare_exchange_strong( k, key, memory_model::memory_order_relaxed, CDS_ATOMIC::memory_order_relaxed )) {
+                    pNew->nCellsUsed.fetch_add( 1, memory_model::memory_order_relaxed ) ;
+                    return &c ;
+                }
+                assert( k != key ) ;
+                idx = (idx + 1) & nMask ;
+            }
+        }
+        //@endcond
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_LINEAR_PROBING_MAP_IMPL_H
@@ -13,6 +13,7 @@
 #define __CDS_CONTAINER_MICHAEL_LIST_IMPL_H
 
 #include <cds/details/std/memory.h>
+#include <cds/gc/guarded_ptr.h>
 
 namespace cds { namespace container {
 
@@ -138,6 +139,20 @@ namespace cds { namespace container {
 #   endif
         //@endcond
 
+    private:
+        //@cond
+        struct node_to_value_cast {
+            value_type * operator()( node_type * p ) const
+            {
+                return p ? &p->m_Value : null_ptr<value_type *>() ;
+            }
+        };
+        //@endcond
+
+    public:
+        /// Guarded pointer to the list item, see \ref get and \ref extract
+        typedef cds::gc::guarded_ptr< gc, node_type, value_type, node_to_value_cast > guarded_ptr ;
+
     private:
         //@cond
         static value_type& node_to_value( node_type& n )
@@ -442,6 +457,50 @@ namespace cds { namespace container {
             return insert_at( head(), key, func )    ;
         }
 
+        /// Insert hint (finger) for the sequence of inserting, see \ref cds::intrusive::MichaelList::insert_hint
+        typedef typename base_class::insert_hint    insert_hint ;
+
+        /// Inserts new node using the insert hint
+        /**
+            The function is the same as \ref insert( Q const& ) but the search of
+            the insert position begins from the node stored in \p hint by previous call.
+            The hint should not be shared between threads.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename Q>
+        bool insert( insert_hint& hint, Q const& val )
+        {
+            scoped_node_ptr pNode( alloc_node( val )) ;
+            if ( base_class::insert( hint, *pNode )) {
+                pNode.release() ;
+                return true ;
+            }
+            return false    ;
+        }
+
+        /// Inserts the sequence of values
+        /**
+            The function inserts the copies of values from the range [\p first, \p last) in the list.
+            Each insert continues the search from the previous item, so the function is intended
+            for the ranges sorted in ascending order of keys (or nearly sorted).
+
+            The object of \ref value_type should be constructible from <tt>*first</tt>.
+
+            Returns the number of items inserted.
+        */
+        template <typename Iterator>
+        size_t insert_sorted( Iterator first, Iterator last )
+        {
+            insert_hint hint ;
+            size_t nCount = 0 ;
+            for ( ; first != last; ++first ) {
+                if ( insert( hint, *first ))
+                    ++nCount ;
+            }
+            return nCount ;
+        }
+
         /// Ensures that the \p key exists in the list
         /**
             The operation performs inserting or changing data with lock-free manner.
@@ -571,6 +630,79 @@ namespace cds { namespace container {
             return erase_at( head(), key, typename options::template less_wrapper<Less>::type(), f ) ;
         }
 
+        /// Extracts the item from the list with specified \p key
+        /** \anchor cds_nonintrusive_MichaelList_hp_extract
+            The function searches an item with key equal to \p key,
+            unlinks it from the list, and returns it in \p dest parameter.
+            If the item with key equal to \p key is not found the function returns \p false.
+
+            The value is not copied: \p dest points to the value stored in the list.
+            The node is freed by garbage collector \p GC when returned \ref guarded_ptr object
+            will be destroyed or released.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+
+            Usage:
+            \code
+            typedef cds::container::MichaelList< cds::gc::HP, foo, my_traits > ord_list ;
+            ord_list theList ;
+            // ...
+            {
+                ord_list::guarded_ptr gp ;
+                if ( theList.extract( gp, 5 )) {
+                    // Deal with gp
+                    // ...
+                }
+                // Destructor of gp releases internal HP guard
+            }
+            \endcode
+        */
+        template <typename Q>
+        bool extract( guarded_ptr& dest, Q const& key )
+        {
+            return extract_at( head(), dest.guard(), key, intrusive_key_comparator() ) ;
+        }
+
+        /// Extracts the item from the list using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_MichaelList_hp_extract "extract(guarded_ptr&, Q const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the list.
+        */
+        template <typename Q, typename Less>
+        bool extract_with( guarded_ptr& dest, Q const& key, Less pred )
+        {
+            return extract_at( head(), dest.guard(), key, typename options::template less_wrapper<Less>::type() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Extracts the item with specified \p key and returns the guarded pointer to it
+        /**
+            The function is an analog of \ref cds_nonintrusive_MichaelList_hp_extract "extract(guarded_ptr&, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr extract( Q const& key )
+        {
+            guarded_ptr gp ;
+            extract( gp, key ) ;
+            return gp ;
+        }
+
+        /// Extracts the item using \p pred predicate and returns the guarded pointer to it
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr extract_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            extract_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Find the key \p key
         /** \anchor cds_nonintrusive_MichaelList_hp_find_val
             The function searches the item with key equal to \p key
@@ -676,6 +808,65 @@ namespace cds { namespace container {
             return find_at( head(), val, typename options::template less_wrapper<Less>::type(), f )  ;
         }
 
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /** \anchor cds_nonintrusive_MichaelList_hp_get
+            The function searches the item with key equal to \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if \p key is found, and \p false otherwise.
+            If \p key is not found the \p ptr parameter is not changed.
+
+            Unlike \p find() the value is not copied and no functor is called: \p ptr points to the value
+            stored in the list, the guard prevents the item from being freed while \p ptr is alive.
+            The function does not serialize simultaneous access to the item found.
+            @note Each \p guarded_ptr object uses one GC's guard which can be limited resource.
+        */
+        template <typename Q>
+        bool get( guarded_ptr& ptr, Q const& key )
+        {
+            return get_at( head(), ptr.guard(), key, intrusive_key_comparator() ) ;
+        }
+
+        /// Finds the key \p key and returns the guarded pointer to the item found using \p pred predicate
+        /**
+            The function is an analog of \ref cds_nonintrusive_MichaelList_hp_get "get( guarded_ptr& ptr, Q const&)"
+            but \p pred is used for comparing the keys.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the list.
+        */
+        template <typename Q, typename Less>
+        bool get_with( guarded_ptr& ptr, Q const& key, Less pred )
+        {
+            return get_at( head(), ptr.guard(), key, typename options::template less_wrapper<Less>::type() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /**
+            The function is an analog of \ref cds_nonintrusive_MichaelList_hp_get "get( guarded_ptr& ptr, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr get( Q const& key )
+        {
+            guarded_ptr gp ;
+            get( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the key \p key using \p pred predicate and returns the guarded pointer to the item found
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr get_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            get_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Check if the list is empty
         bool empty() const
         {
@@ -801,12 +992,24 @@ namespace cds { namespace container {
             return ret  ;
         }
 
+        template <typename Q, typename Compare>
+        bool extract_at( head_type& refHead, typename gc::Guard& dest, Q const& key, Compare cmp )
+        {
+            return base_class::extract_at( refHead, dest, key, cmp ) ;
+        }
+
         template <typename Q, typename Compare>
         bool find_at( head_type& refHead, Q const& key, Compare cmp )
         {
             return base_class::find_at( refHead, key, cmp ) ;
         }
 
+        template <typename Q, typename Compare>
+        bool get_at( head_type& refHead, typename gc::Guard& guard, Q const& key, Compare cmp )
+        {
+            return base_class::get_at( refHead, guard, key, cmp ) ;
+        }
+
         template <typename Q, typename Compare, typename Func>
         bool find_at( head_type& refHead, Q& val, Compare cmp, Func f )
         {
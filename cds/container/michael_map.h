@@ -26,9 +26,13 @@ namespace cds { namespace container {
 
         Michael's hash table algorithm is based on lock-free ordered list and it is very simple.
         The main structure is an array \p T of size \p M. Each element in \p T is basically a pointer
-        to a hash bucket, implemented as a singly linked list. The array of buckets cannot be dynamically expanded.
+        to a hash bucket, implemented as a singly linked list. By default the array of buckets cannot be dynamically expanded.
         However, each bucket may contain unbounded number of items.
 
+        If michael_map::resizable option is \p true the array of buckets is doubled when the average
+        item count per bucket exceeds the load factor. The items are migrated to the new array incrementally,
+        see michael_set::details::resizable_bucket_table.
+
         Template parameters are:
         - \p GC - Garbage collector used. You may use any \ref cds_garbage_collector "Garbage collector"
             from the \p libcds library.
@@ -45,6 +49,8 @@ namespace cds { namespace container {
         - opt::hash - mandatory option, specifies hash functor.
         - opt::item_counter - optional, specifies item counting policy. See michael_map::type_traits for explanation.
         - opt::allocator - optional, bucket table allocator. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - michael_map::resizable - optional, selects fixed-size or resizable bucket table. Default is \p false.
+        - opt::back_off - optional, back-off strategy for resizable bucket table. Default is cds::backoff::Default.
 
         Many of the class function take a key argument of type \p K that in general is not \ref key_type.
         \p key_type and an argument of template type \p K must meet the following requirements:
@@ -66,6 +72,8 @@ namespace cds { namespace container {
         The iterator object is thread-safe: the element pointed by the iterator object is guarded,
         so, the element cannot be reclaimed while the iterator object is alive.
         However, passing an iterator object between threads is dangerous.
+        For resizable bucket table the iterators are invalidated by the table resizing,
+        so you should not insert items into the map while iterating.
 
         \warning Due to concurrent nature of Michael's set it is not guarantee that you can iterate
         all elements in the set: any concurrent deletion can exclude the element
@@ -189,31 +197,45 @@ namespace cds { namespace container {
         typedef typename cds::opt::v::hash_selector< typename options::hash >::type   hash ;
         typedef typename options::item_counter          item_counter    ;   ///< Item counter type
 
-        /// Bucket table allocator
-        typedef cds::details::Allocator< bucket_type, typename options::allocator >  bucket_table_allocator ;
+    protected:
+        //@cond
+        /// Copies an item into the new bucket table when the table is resized
+        struct bucket_relocator {
+            template <typename Iterator>
+            void operator()( bucket_type * pBuckets, size_t nMask, Iterator it ) const
+            {
+                pBuckets[ hash()( it.key() ) & nMask ].insert( it.key(), it.val() ) ;
+            }
+        };
+        //@endcond
+
+    public:
+        /// Bucket table implementation
+        typedef typename michael_set::details::bucket_table_selector<
+            options::resizable
+            , bucket_type
+            , bucket_relocator
+            , opt::allocator< typename options::allocator >
+            , opt::back_off< typename options::back_off >
+        >::type bucket_table ;
 
     protected:
         item_counter    m_ItemCounter   ;   ///< Item counter
         hash            m_HashFunctor   ;   ///< Hash functor
 
-        bucket_type *   m_Buckets       ;   ///< bucket table
-
-    private:
-        //@cond
-        const size_t    m_nHashBitmask ;
-        //@endcond
+        bucket_table    m_Buckets       ;   ///< bucket table
 
     protected:
         /// Calculates hash value of \p key
         size_t hash_value( key_type const & key ) const
         {
-            return m_HashFunctor( key ) & m_nHashBitmask   ;
+            return m_HashFunctor( key ) ;
         }
 
         /// Returns the bucket (ordered list) for \p key
-        bucket_type&    bucket( key_type const& key )
+        typename bucket_table::scoped_bucket bucket( key_type const& key )
         {
-            return m_Buckets[ hash_value( key ) ]  ;
+            return m_Buckets.bucket( hash_value( key )) ;
         }
 
     protected:
@@ -327,7 +349,8 @@ namespace cds { namespace container {
         */
         iterator begin()
         {
-            return iterator( m_Buckets[0].begin(), m_Buckets, m_Buckets + bucket_count() )    ;
+            bucket_type * pBuckets = m_Buckets.buckets() ;
+            return iterator( pBuckets[0].begin(), pBuckets, pBuckets + bucket_count() )    ;
         }
 
         /// Returns an iterator that addresses the location succeeding the last element in a map
@@ -338,7 +361,8 @@ namespace cds { namespace container {
         */
         iterator end()
         {
-            return iterator( m_Buckets[bucket_count() - 1].end(), m_Buckets + bucket_count() - 1, m_Buckets + bucket_count() )   ;
+            bucket_type * pBuckets = m_Buckets.buckets() ;
+            return iterator( pBuckets[bucket_count() - 1].end(), pBuckets + bucket_count() - 1, pBuckets + bucket_count() )   ;
         }
 
         /// Returns a forward const iterator addressing the first element in a map
@@ -369,11 +393,13 @@ namespace cds { namespace container {
         //@cond
         const_iterator get_const_begin() const
         {
-            return const_iterator( const_cast<bucket_type const&>(m_Buckets[0]).begin(), m_Buckets, m_Buckets + bucket_count() )    ;
+            bucket_type * pBuckets = m_Buckets.buckets() ;
+            return const_iterator( const_cast<bucket_type const&>(pBuckets[0]).begin(), pBuckets, pBuckets + bucket_count() )    ;
         }
         const_iterator get_const_end() const
         {
-            return const_iterator( const_cast<bucket_type const&>(m_Buckets[bucket_count() - 1]).end(), m_Buckets + bucket_count() - 1, m_Buckets + bucket_count() )   ;
+            bucket_type * pBuckets = m_Buckets.buckets() ;
+            return const_iterator( const_cast<bucket_type const&>(pBuckets[bucket_count() - 1]).end(), pBuckets + bucket_count() - 1, pBuckets + bucket_count() )   ;
         }
         //@endcond
 
@@ -387,26 +413,25 @@ namespace cds { namespace container {
             Note, that many popular STL hash map implementation uses load factor 1.
 
             The ctor defines hash table size as rounding <tt>nMacItemCount / nLoadFactor</tt> up to nearest power of two.
+            For resizable bucket table (michael_map::resizable option) it is the initial size of the table;
+            the table is doubled when the item count exceeds <tt>bucket_count() * nLoadFactor</tt>.
         */
         MichaelHashMap(
             size_t nMaxItemCount,   ///< estimation of max item count in the hash map
             size_t nLoadFactor      ///< load factor: estimation of max number of items in the bucket
-        ) : m_nHashBitmask( michael_map::details::init_hash_bitmask( nMaxItemCount, nLoadFactor ))
+        ) : m_Buckets( nMaxItemCount, nLoadFactor )
         {
             // GC and OrderedList::gc must be the same
             static_assert(( std::is_same<gc, typename bucket_type::gc>::value ), "GC and OrderedList::gc must be the same")  ;
 
             // atomicity::empty_item_counter is not allowed as a item counter
             static_assert(( !std::is_same<item_counter, atomicity::empty_item_counter>::value ), "atomicity::empty_item_counter is not allowed as a item counter")  ;
-
-            m_Buckets = bucket_table_allocator().NewArray( bucket_count() ) ;
         }
 
         /// Clears hash map and destroys it
         ~MichaelHashMap()
         {
             clear() ;
-            bucket_table_allocator().Delete( m_Buckets, bucket_count() ) ;
         }
 
         /// Inserts new node with key and default value
@@ -423,9 +448,9 @@ namespace cds { namespace container {
         template <typename K>
         bool insert( const K& key )
         {
-            const bool bRet = bucket( key ).insert( key ) ;
+            const bool bRet = bucket( key )->insert( key ) ;
             if ( bRet )
-                ++m_ItemCounter ;
+                m_Buckets.grow( ++m_ItemCounter ) ;
             return bRet ;
         }
 
@@ -443,9 +468,9 @@ namespace cds { namespace container {
         template <typename K, typename V>
         bool insert( K const& key, V const& val )
         {
-            const bool bRet = bucket( key ).insert( key, val ) ;
+            const bool bRet = bucket( key )->insert( key, val ) ;
             if ( bRet )
-                ++m_ItemCounter ;
+                m_Buckets.grow( ++m_ItemCounter ) ;
             return bRet ;
         }
 
@@ -482,9 +507,9 @@ namespace cds { namespace container {
         template <typename K, typename Func>
         bool insert_key( const K& key, Func func )
         {
-            const bool bRet = bucket( key ).insert_key( key, func ) ;
+            const bool bRet = bucket( key )->insert_key( key, func ) ;
             if ( bRet )
-                ++m_ItemCounter ;
+                m_Buckets.grow( ++m_ItemCounter ) ;
             return bRet ;
         }
 
@@ -525,9 +550,9 @@ namespace cds { namespace container {
         template <typename K, typename Func>
         std::pair<bool, bool> ensure( K const& key, Func func )
         {
-            std::pair<bool, bool> bRet = bucket( key ).ensure( key, func )    ;
+            std::pair<bool, bool> bRet = bucket( key )->ensure( key, func )    ;
             if ( bRet.first && bRet.second )
-                ++m_ItemCounter ;
+                m_Buckets.grow( ++m_ItemCounter ) ;
             return bRet ;
         }
 
@@ -544,9 +569,9 @@ namespace cds { namespace container {
         template <typename K, typename... Args>
         bool emplace( K&& key, Args&&... args )
         {
-            const bool bRet = bucket( key ).emplace( std::forward<K>(key), std::forward<Args>(args)... ) ;
+            const bool bRet = bucket( key )->emplace( std::forward<K>(key), std::forward<Args>(args)... ) ;
             if ( bRet )
-                ++m_ItemCounter ;
+                m_Buckets.grow( ++m_ItemCounter ) ;
             return bRet ;
         }
 #   endif
@@ -559,7 +584,7 @@ namespace cds { namespace container {
         template <typename K>
         bool erase( K const& key )
         {
-            const bool bRet = bucket( key ).erase( key )    ;
+            const bool bRet = bucket( key )->erase( key )    ;
             if ( bRet )
                 --m_ItemCounter ;
             return bRet ;
@@ -575,7 +600,7 @@ namespace cds { namespace container {
         template <typename K, typename Less>
         bool erase_with( K const& key, Less pred )
         {
-            const bool bRet = bucket( key ).erase_with( key, pred )    ;
+            const bool bRet = bucket( key )->erase_with( key, pred )    ;
             if ( bRet )
                 --m_ItemCounter ;
             return bRet ;
@@ -600,7 +625,7 @@ namespace cds { namespace container {
         template <typename K, typename Func>
         bool erase( K const& key, Func f )
         {
-            const bool bRet = bucket( key ).erase( key, f )    ;
+            const bool bRet = bucket( key )->erase( key, f )    ;
             if ( bRet )
                 --m_ItemCounter ;
             return bRet ;
@@ -616,7 +641,7 @@ namespace cds { namespace container {
         template <typename K, typename Less, typename Func>
         bool erase_with( K const& key, Less pred, Func f )
         {
-            const bool bRet = bucket( key ).erase_with( key, pred, f )    ;
+            const bool bRet = bucket( key )->erase_with( key, pred, f )    ;
             if ( bRet )
                 --m_ItemCounter ;
             return bRet ;
@@ -646,7 +671,7 @@ namespace cds { namespace container {
         template <typename K, typename Func>
         bool find( K const& key, Func f )
         {
-            return bucket( key ).find( key, f )  ;
+            return bucket( key )->find( key, f )  ;
         }
 
         /// Finds the key \p val using \p pred predicate for searching
@@ -659,7 +684,7 @@ namespace cds { namespace container {
         template <typename K, typename Less, typename Func>
         bool find_with( K const& key, Less pred, Func f )
         {
-            return bucket( key ).find_with( key, pred, f )  ;
+            return bucket( key )->find_with( key, pred, f )  ;
         }
 
         /// Finds the key \p key
@@ -670,7 +695,7 @@ namespace cds { namespace container {
         template <typename K>
         bool find( K const& key )
         {
-            return bucket( key ).find( key )  ;
+            return bucket( key )->find( key )  ;
         }
 
         /// Finds the key \p val using \p pred predicate for searching
@@ -683,7 +708,7 @@ namespace cds { namespace container {
         template <typename K, typename Less>
         bool find_with( K const& key, Less pred )
         {
-            return bucket( key ).find_with( key, pred )  ;
+            return bucket( key )->find_with( key, pred )  ;
         }
 
         /// Clears the map (non-atomic)
@@ -698,7 +723,7 @@ namespace cds { namespace container {
         void clear()
         {
             for ( size_t i = 0; i < bucket_count(); ++i )
-                m_Buckets[i].clear()  ;
+                m_Buckets.bucket( i )->clear()  ;
             m_ItemCounter.reset()   ;
         }
 
@@ -720,13 +745,13 @@ namespace cds { namespace container {
 
         /// Returns the size of hash table
         /**
-            Since MichaelHashMap cannot dynamically extend the hash table size,
-            the value returned is an constant depending on object initialization parameters;
+            For fixed-size bucket table the value returned is an constant depending on object initialization parameters;
             see MichaelHashMap::MichaelHashMap for explanation.
+            For resizable bucket table the function returns the size of current table.
         */
         size_t bucket_count() const
         {
-            return m_nHashBitmask + 1   ;
+            return m_Buckets.bucket_count() ;
         }
     };
 }}  // namespace cds::container
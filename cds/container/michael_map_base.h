@@ -24,6 +24,7 @@ namespace cds { namespace container {
         typedef container::michael_set::type_traits  type_traits    ;
 
         using container::michael_set::make_traits   ;
+        using container::michael_set::resizable     ;
 
         //@cond
         namespace details {
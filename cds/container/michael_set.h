@@ -26,9 +26,13 @@ namespace cds { namespace container {
 
         Michael's hash table algorithm is based on lock-free ordered list and it is very simple.
         The main structure is an array \p T of size \p M. Each element in \p T is basically a pointer
-        to a hash bucket, implemented as a singly linked list. The array of buckets cannot be dynamically expanded.
+        to a hash bucket, implemented as a singly linked list. By default the array of buckets cannot be dynamically expanded.
         However, each bucket may contain unbounded number of items.
 
+        If michael_set::resizable option is \p true the array of buckets is doubled when the average
+        item count per bucket exceeds the load factor. The items are migrated to the new array incrementally,
+        see michael_set::details::resizable_bucket_table.
+
         Template parameters are:
         - \p GC - Garbage collector used. You may use any \ref cds_garbage_collector "Garbage collector"
             from the \p libcds library.
@@ -44,6 +48,8 @@ namespace cds { namespace container {
         - opt::hash - mandatory option, specifies hash functor.
         - opt::item_counter - optional, specifies item counting policy. See michael_set::type_traits for explanation.
         - opt::allocator - optional, bucket table allocator. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - michael_set::resizable - optional, selects fixed-size or resizable bucket table. Default is \p false.
+        - opt::back_off - optional, back-off strategy for resizable bucket table. Default is cds::backoff::Default.
 
         There are the specializations:
         - for \ref cds_urcu_desc "RCU" - declared in <tt>cd/container/michael_set_rcu.h</tt>,
@@ -87,6 +93,8 @@ namespace cds { namespace container {
         The iterator object is thread-safe: the element pointed by the iterator object is guarded,
         so, the element cannot be reclaimed while the iterator object is alive.
         However, passing an iterator object between threads is dangerous.
+        For resizable bucket table the iterators are invalidated by the table resizing,
+        so you should not insert items into the set while iterating.
 
         \warning Due to concurrent nature of Michael's set it is not guarantee that you can iterate
         all elements in the set: any concurrent deletion can exclude the element
@@ -204,34 +212,49 @@ namespace cds { namespace container {
         /// Hash functor for \ref value_type and all its derivatives that you use
         typedef typename cds::opt::v::hash_selector< typename options::hash >::type   hash ;
         typedef typename options::item_counter          item_counter    ;   ///< Item counter type
+        typedef typename bucket_type::guarded_ptr       guarded_ptr     ;   ///< Guarded pointer, see \ref get and \ref extract
+
+    protected:
+        //@cond
+        /// Copies an item into the new bucket table when the table is resized
+        struct bucket_relocator {
+            template <typename Iterator>
+            void operator()( bucket_type * pBuckets, size_t nMask, Iterator it ) const
+            {
+                pBuckets[ hash()( *it ) & nMask ].insert( *it ) ;
+            }
+        };
+        //@endcond
 
-        /// Bucket table allocator
-        typedef cds::details::Allocator< bucket_type, typename options::allocator >  bucket_table_allocator ;
+    public:
+        /// Bucket table implementation
+        typedef typename michael_set::details::bucket_table_selector<
+            options::resizable
+            , bucket_type
+            , bucket_relocator
+            , opt::allocator< typename options::allocator >
+            , opt::back_off< typename options::back_off >
+        >::type bucket_table ;
 
     protected:
         item_counter    m_ItemCounter   ;   ///< Item counter
         hash            m_HashFunctor   ;   ///< Hash functor
 
-        bucket_type *   m_Buckets       ;   ///< bucket table
-
-    private:
-        //@cond
-        const size_t    m_nHashBitmask ;
-        //@endcond
+        bucket_table    m_Buckets       ;   ///< bucket table
 
     protected:
         /// Calculates hash value of \p key
         template <typename Q>
         size_t hash_value( Q const& key ) const
         {
-            return m_HashFunctor( key ) & m_nHashBitmask   ;
+            return m_HashFunctor( key ) ;
         }
 
         /// Returns the bucket (ordered list) for \p key
         template <typename Q>
-        bucket_type&    bucket( Q const& key )
+        typename bucket_table::scoped_bucket bucket( Q const& key )
         {
-            return m_Buckets[ hash_value( key ) ]  ;
+            return m_Buckets.bucket( hash_value( key )) ;
         }
 
     public:
@@ -247,7 +270,8 @@ namespace cds { namespace container {
         */
         iterator begin()
         {
-            return iterator( m_Buckets[0].begin(), m_Buckets, m_Buckets + bucket_count() )    ;
+            bucket_type * pBuckets = m_Buckets.buckets() ;
+            return iterator( pBuckets[0].begin(), pBuckets, pBuckets + bucket_count() )    ;
         }
 
         /// Returns an iterator that addresses the location succeeding the last element in a set
@@ -258,7 +282,8 @@ namespace cds { namespace container {
         */
         iterator end()
         {
-            return iterator( m_Buckets[bucket_count() - 1].end(), m_Buckets + bucket_count() - 1, m_Buckets + bucket_count() )   ;
+            bucket_type * pBuckets = m_Buckets.buckets() ;
+            return iterator( pBuckets[bucket_count() - 1].end(), pBuckets + bucket_count() - 1, pBuckets + bucket_count() )   ;
         }
 
         /// Returns a forward const iterator addressing the first element in a set
@@ -289,11 +314,13 @@ namespace cds { namespace container {
         //@cond
         const_iterator get_const_begin() const
         {
-            return const_iterator( const_cast<bucket_type const&>(m_Buckets[0]).begin(), m_Buckets, m_Buckets + bucket_count() )    ;
+            bucket_type * pBuckets = m_Buckets.buckets() ;
+            return const_iterator( const_cast<bucket_type const&>(pBuckets[0]).begin(), pBuckets, pBuckets + bucket_count() )    ;
         }
         const_iterator get_const_end() const
         {
-            return const_iterator( const_cast<bucket_type const&>(m_Buckets[bucket_count() - 1]).end(), m_Buckets + bucket_count() - 1, m_Buckets + bucket_count() )   ;
+            bucket_type * pBuckets = m_Buckets.buckets() ;
+            return const_iterator( const_cast<bucket_type const&>(pBuckets[bucket_count() - 1]).end(), pBuckets + bucket_count() - 1, pBuckets + bucket_count() )   ;
         }
         //@endcond
 
@@ -307,26 +334,25 @@ namespace cds { namespace container {
             Note, that many popular STL hash map implementation uses load factor 1.
 
             The ctor defines hash table size as rounding <tt>nMacItemCount / nLoadFactor</tt> up to nearest power of two.
+            For resizable bucket table (michael_set::resizable option) it is the initial size of the table;
+            the table is doubled when the item count exceeds <tt>bucket_count() * nLoadFactor</tt>.
         */
         MichaelHashSet(
             size_t nMaxItemCount,   ///< estimation of max item count in the hash set
             size_t nLoadFactor      ///< load factor: estimation of max number of items in the bucket
-        ) : m_nHashBitmask( michael_set::details::init_hash_bitmask( nMaxItemCount, nLoadFactor ))
+        ) : m_Buckets( nMaxItemCount, nLoadFactor )
         {
             // GC and OrderedList::gc must be the same
             static_assert(( std::is_same<gc, typename bucket_type::gc>::value ), "GC and OrderedList::gc must be the same")  ;
 
             // atomicity::empty_item_counter is not allowed as a item counter
             static_assert(( !std::is_same<item_counter, atomicity::empty_item_counter>::value ), "atomicity::empty_item_counter is not allowed as a item counter")  ;
-
-            m_Buckets = bucket_table_allocator().NewArray( bucket_count() ) ;
         }
 
         /// Clear hash set and destroy it
         ~MichaelHashSet()
         {
             clear() ;
-            bucket_table_allocator().Delete( m_Buckets, bucket_count() ) ;
         }
 
         /// Inserts new node
@@ -343,9 +369,9 @@ namespace cds { namespace container {
         template <typename Q>
         bool insert( Q const& val )
         {
-            const bool bRet = bucket( val ).insert( val ) ;
+            const bool bRet = bucket( val )->insert( val ) ;
             if ( bRet )
-                ++m_ItemCounter ;
+                m_Buckets.grow( ++m_ItemCounter ) ;
             return bRet ;
         }
 
@@ -368,9 +394,9 @@ namespace cds { namespace container {
         template <typename Q, typename Func>
         bool insert( Q const& val, Func f )
         {
-            const bool bRet = bucket( val ).insert( val, f )    ;
+            const bool bRet = bucket( val )->insert( val, f )    ;
             if ( bRet )
-                ++m_ItemCounter ;
+                m_Buckets.grow( ++m_ItemCounter ) ;
             return bRet ;
         }
 
@@ -408,9 +434,9 @@ namespace cds { namespace container {
         template <typename Q, typename Func>
         std::pair<bool, bool> ensure( const Q& val, Func func )
         {
-            std::pair<bool, bool> bRet = bucket( val ).ensure( val, func )    ;
+            std::pair<bool, bool> bRet = bucket( val )->ensure( val, func )    ;
             if ( bRet.first && bRet.second )
-                ++m_ItemCounter ;
+                m_Buckets.grow( ++m_ItemCounter ) ;
             return bRet ;
         }
 
@@ -425,9 +451,9 @@ namespace cds { namespace container {
         template <typename... Args>
         bool emplace( Args&&... args )
         {
-            bool bRet = bucket( value_type(std::forward<Args>(args)...) ).emplace( std::forward<Args>(args)... ) ;
+            bool bRet = bucket( value_type(std::forward<Args>(args)...) )->emplace( std::forward<Args>(args)... ) ;
             if ( bRet )
-                ++m_ItemCounter ;
+                m_Buckets.grow( ++m_ItemCounter ) ;
             return bRet ;
         }
 #   endif
@@ -445,7 +471,7 @@ namespace cds { namespace container {
         template <typename Q>
         bool erase( Q const& key )
         {
-            const bool bRet = bucket( key ).erase( key )    ;
+            const bool bRet = bucket( key )->erase( key )    ;
             if ( bRet )
                 --m_ItemCounter ;
             return bRet ;
@@ -461,7 +487,7 @@ namespace cds { namespace container {
         template <typename Q, typename Less>
         bool erase_with( Q const& key, Less pred )
         {
-            const bool bRet = bucket( key ).erase_with( key, pred )    ;
+            const bool bRet = bucket( key )->erase_with( key, pred )    ;
             if ( bRet )
                 --m_ItemCounter ;
             return bRet ;
@@ -491,7 +517,7 @@ namespace cds { namespace container {
         template <typename Q, typename Func>
         bool erase( Q const& key, Func f )
         {
-            const bool bRet = bucket( key ).erase( key, f )    ;
+            const bool bRet = bucket( key )->erase( key, f )    ;
             if ( bRet )
                 --m_ItemCounter ;
             return bRet ;
@@ -507,12 +533,91 @@ namespace cds { namespace container {
         template <typename Q, typename Less, typename Func>
         bool erase_with( Q const& key, Less pred, Func f )
         {
-            const bool bRet = bucket( key ).erase_with( key, pred, f )    ;
+            const bool bRet = bucket( key )->erase_with( key, pred, f )    ;
+            if ( bRet )
+                --m_ItemCounter ;
+            return bRet ;
+        }
+
+        /// Extracts the item from the set with specified \p key
+        /** \anchor cds_nonintrusive_MichaelSet_extract
+            The function searches an item with key equal to \p key,
+            unlinks it from the set, and returns it in \p dest parameter.
+            If the item with key equal to \p key is not found the function returns \p false.
+
+            The value is not copied: \p dest points to the value stored in the set.
+            The node is freed by garbage collector \p GC when returned \ref guarded_ptr object
+            will be destroyed or released.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+
+            Usage:
+            \code
+            typedef cds::container::MichaelHashSet< cds::gc::PTB, bucket_list, my_traits > michael_set ;
+            michael_set theSet ;
+            // ...
+            {
+                michael_set::guarded_ptr gp ;
+                if ( theSet.extract( gp, 5 )) {
+                    // Deal with gp
+                    // ...
+                }
+                // Destructor of gp releases internal PTB guard
+            }
+            \endcode
+        */
+        template <typename Q>
+        bool extract( guarded_ptr& dest, Q const& key )
+        {
+            const bool bRet = bucket( key )->extract( dest, key ) ;
+            if ( bRet )
+                --m_ItemCounter ;
+            return bRet ;
+        }
+
+        /// Extracts the item from the set using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_MichaelSet_extract "extract(guarded_ptr&, Q const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool extract_with( guarded_ptr& dest, Q const& key, Less pred )
+        {
+            const bool bRet = bucket( key )->extract_with( dest, key, pred ) ;
             if ( bRet )
                 --m_ItemCounter ;
             return bRet ;
         }
 
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Extracts the item with specified \p key and returns the guarded pointer to it
+        /**
+            The function is an analog of \ref cds_nonintrusive_MichaelSet_extract "extract(guarded_ptr&, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr extract( Q const& key )
+        {
+            guarded_ptr gp ;
+            extract( gp, key ) ;
+            return gp ;
+        }
+
+        /// Extracts the item using \p pred predicate and returns the guarded pointer to it
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr extract_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            extract_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Finds the key \p val
         /** \anchor cds_nonintrusive_MichaelSet_find_func
 
@@ -543,7 +648,7 @@ namespace cds { namespace container {
         template <typename Q, typename Func>
         bool find( Q& val, Func f )
         {
-            return bucket( val ).find( val, f )  ;
+            return bucket( val )->find( val, f )  ;
         }
 
         /// Finds the key \p val using \p pred predicate for searching
@@ -556,7 +661,7 @@ namespace cds { namespace container {
         template <typename Q, typename Less, typename Func>
         bool find_with( Q& val, Less pred, Func f )
         {
-            return bucket( val ).find_with( val, pred, f )  ;
+            return bucket( val )->find_with( val, pred, f )  ;
         }
 
         /// Finds the key \p val
@@ -586,7 +691,7 @@ namespace cds { namespace container {
         template <typename Q, typename Func>
         bool find( Q const& val, Func f )
         {
-            return bucket( val ).find( val, f )  ;
+            return bucket( val )->find( val, f )  ;
         }
 
         /// Finds the key \p val using \p pred predicate for searching
@@ -599,7 +704,7 @@ namespace cds { namespace container {
         template <typename Q, typename Less, typename Func>
         bool find_with( Q const& val, Less pred, Func f )
         {
-            return bucket( val ).find_with( val, pred, f )  ;
+            return bucket( val )->find_with( val, pred, f )  ;
         }
 
         /// Finds the key \p val
@@ -613,7 +718,7 @@ namespace cds { namespace container {
         template <typename Q>
         bool find( Q const& val )
         {
-            return bucket( val ).find( val )  ;
+            return bucket( val )->find( val )  ;
         }
 
         /// Finds the key \p val using \p pred predicate for searching
@@ -626,9 +731,68 @@ namespace cds { namespace container {
         template <typename Q, typename Less>
         bool find_with( Q const& val, Less pred )
         {
-            return bucket( val ).find_with( val, pred )  ;
+            return bucket( val )->find_with( val, pred )  ;
+        }
+
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /** \anchor cds_nonintrusive_MichaelSet_get
+            The function searches the item with key equal to \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if \p key is found, and \p false otherwise.
+            If \p key is not found the \p ptr parameter is not changed.
+
+            Unlike \p find() the value is not copied and no functor is called: \p ptr points to the value
+            stored in the set, the guard prevents the item from being freed while \p ptr is alive.
+            The function does not serialize simultaneous access to the item found.
+            @note Each \p guarded_ptr object uses one GC's guard which can be limited resource.
+        */
+        template <typename Q>
+        bool get( guarded_ptr& ptr, Q const& key )
+        {
+            return bucket( key )->get( ptr, key ) ;
+        }
+
+        /// Finds the key \p key and returns the guarded pointer to the item found using \p pred predicate
+        /**
+            The function is an analog of \ref cds_nonintrusive_MichaelSet_get "get( guarded_ptr& ptr, Q const&)"
+            but \p pred is used for comparing the keys.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool get_with( guarded_ptr& ptr, Q const& key, Less pred )
+        {
+            return bucket( key )->get_with( ptr, key, pred ) ;
         }
 
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /**
+            The function is an analog of \ref cds_nonintrusive_MichaelSet_get "get( guarded_ptr& ptr, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr get( Q const& key )
+        {
+            guarded_ptr gp ;
+            get( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the key \p key using \p pred predicate and returns the guarded pointer to the item found
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr get_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            get_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Clears the set (non-atomic)
         /**
             The function erases all items from the set.
@@ -641,7 +805,7 @@ namespace cds { namespace container {
         void clear()
         {
             for ( size_t i = 0; i < bucket_count(); ++i )
-                m_Buckets[i].clear()  ;
+                m_Buckets.bucket( i )->clear()  ;
             m_ItemCounter.reset()   ;
         }
 
@@ -663,13 +827,13 @@ namespace cds { namespace container {
 
         /// Returns the size of hash table
         /**
-            Since MichaelHashSet cannot dynamically extend the hash table size,
-            the value returned is an constant depending on object initialization parameters;
+            For fixed-size bucket table the value returned is an constant depending on object initialization parameters;
             see MichaelHashSet::MichaelHashSet for explanation.
+            For resizable bucket table the function returns the size of current table.
         */
         size_t bucket_count() const
         {
-            return m_nHashBitmask + 1   ;
+            return m_Buckets.bucket_count() ;
         }
     };
 
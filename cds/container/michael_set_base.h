@@ -13,6 +13,8 @@
 #define __CDS_CONTAINER_MICHAEL_SET_BASE_H
 
 #include <cds/intrusive/michael_set_base.h>
+#include <cds/details/allocator.h>
+#include <cds/backoff_strategy.h>
 
 namespace cds { namespace container {
 
@@ -21,25 +23,496 @@ namespace cds { namespace container {
     */
     namespace michael_set {
 
-        /// Type traits for MichaelHashSet class (typedef for cds::intrusive::michael_set::type_traits)
-        typedef intrusive::michael_set::type_traits  type_traits    ;
+        /// Type traits for MichaelHashSet class
+        /**
+            The traits are the same as cds::intrusive::michael_set::type_traits
+            plus some additional properties.
+        */
+        struct type_traits: public intrusive::michael_set::type_traits
+        {
+            /// Resizable bucket table
+            /**
+                \p false (the default) - the bucket table has fixed size defined in the constructor,
+                see michael_set::details::static_bucket_table.
+
+                \p true - the bucket table is doubled when the average item count per bucket exceeds
+                the load factor. The items are migrated to the new table bucket by bucket,
+                each operation helps to migrate, see michael_set::details::resizable_bucket_table.
+                The resizable bucket table is supported only for gc::HP, gc::HRC and gc::PTB
+                (<tt>cds/container/michael_set.h</tt> and <tt>cds/container/michael_map.h</tt>).
+            */
+            static const bool resizable = false ;
+
+            /// Back-off strategy used to wait for a bucket migration
+            /**
+                The option is used only for resizable bucket table.
+                Default is cds::backoff::Default.
+            */
+            typedef cds::backoff::Default   back_off    ;
+        };
+
+        /// [value-option] Resizable bucket table option
+        /**
+            The option selects the bucket table implementation.
+            Possible values of \p Value are:
+            - \p false - the fixed-size \ref details::static_bucket_table "bucket table" (the default)
+            - \p true - the \ref details::resizable_bucket_table "resizable bucket table"
+
+            See type_traits::resizable.
+        */
+        template <bool Value>
+        struct resizable
+        {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                enum { resizable = Value }  ;
+            };
+            //@endcond
+        };
 
         /// Metafunction converting option list to traits struct
         /**
-            This is a synonym for intrusive::michael_set::make_traits
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+
+            Available \p Options:
+            - opt::hash - mandatory option, specifies hash functor.
+            - opt::item_counter - optional, specifies item counting policy. See type_traits::item_counter
+                for default type.
+            - opt::allocator - optional, bucket table allocator. Default is \ref CDS_DEFAULT_ALLOCATOR.
+            - michael_set::resizable - optional, selects fixed-size or resizable bucket table. Default is \p false.
+            - opt::back_off - optional, back-off strategy to wait for a bucket migration
+                of the resizable bucket table. Default is cds::backoff::Default
+
+            See \ref MichaelHashSet, \ref type_traits.
         */
-        template <CDS_DECL_OPTIONS3>
+        template <CDS_DECL_OPTIONS5>
         struct make_traits {
-            typedef typename intrusive::michael_set::make_traits<CDS_OPTIONS3>::type type  ;   ///< Result of metafunction
+            typedef typename cds::opt::make_options< type_traits, CDS_OPTIONS5>::type type  ;   ///< Result of metafunction
         };
 
-        //@cond
+        /// Implementation details
         namespace details {
+            //@cond
             using intrusive::michael_set::details::init_hash_bitmask    ;
             using intrusive::michael_set::details::list_iterator_selector   ;
             using intrusive::michael_set::details::iterator ;
-        }
-        //@endcond
+            //@endcond
+
+            /// Fixed-size bucket table
+            /**
+                The table size is defined in the constructor and cannot be changed.
+
+                Template parameters:
+                - \p OrderedList - ordered list type used as the bucket
+                - \p Relocator - unused, for compatibility with resizable_bucket_table
+                - \p Options - options
+
+                \p Options are:
+                - \p opt::allocator - allocator used to allocate bucket table. Default is \ref CDS_DEFAULT_ALLOCATOR
+            */
+            template <typename OrderedList, typename Relocator, CDS_DECL_OPTIONS2>
+            class static_bucket_table
+            {
+                //@cond
+                struct default_options
+                {
+                    typedef CDS_DEFAULT_ALLOCATOR       allocator   ;
+                };
+                typedef typename opt::make_options< default_options, CDS_OPTIONS2 >::type   options ;
+                //@endcond
+
+            public:
+                typedef OrderedList bucket_type ;   ///< Bucket type
+
+                /// Bucket table allocator
+                typedef cds::details::Allocator< bucket_type, typename options::allocator >  bucket_table_allocator ;
+
+                /// Bucket accessor returned by \ref bucket function
+                class scoped_bucket
+                {
+                    bucket_type&    m_Bucket    ;
+                public:
+                    //@cond
+                    explicit scoped_bucket( bucket_type& b )
+                        : m_Bucket( b )
+                    {}
+                    //@endcond
+
+                    /// Returns pointer to the bucket
+                    bucket_type * operator ->() const
+                    {
+                        return &m_Bucket    ;
+                    }
+                };
+
+            protected:
+                //@cond
+                const size_t    m_nHashBitmask  ;
+                bucket_type *   m_Buckets       ;
+                //@endcond
+
+            public:
+                /// Constructs the table of <tt>nMaxItemCount / nLoadFactor</tt> buckets rounded up to power of two
+                static_bucket_table( size_t nMaxItemCount, size_t nLoadFactor )
+                    : m_nHashBitmask( init_hash_bitmask( nMaxItemCount, nLoadFactor ))
+                {
+                    m_Buckets = bucket_table_allocator().NewArray( bucket_count() ) ;
+                }
+
+                /// Destroys the table
+                ~static_bucket_table()
+                {
+                    bucket_table_allocator().Delete( m_Buckets, bucket_count() ) ;
+                }
+
+                /// Returns the bucket for hash value \p nHash
+                scoped_bucket bucket( size_t nHash )
+                {
+                    return scoped_bucket( m_Buckets[ nHash & m_nHashBitmask ] ) ;
+                }
+
+                /// Item count has been changed. Does nothing since the table cannot be expanded
+                void grow( size_t /*nItemCount*/ )
+                {}
+
+                /// Returns pointer to the bucket array
+                bucket_type * buckets() const
+                {
+                    return m_Buckets    ;
+                }
+
+                /// Returns the bucket count
+                size_t bucket_count() const
+                {
+                    return m_nHashBitmask + 1   ;
+                }
+            };
+
+            /// Resizable bucket table
+            /**
+                When the average item count per bucket exceeds the load factor the table of doubled size
+                is allocated and becomes current. The items of the previous table are migrated to the new one
+                bucket by bucket: each operation first migrates the bucket of the previous table where its key lives
+                and helps to migrate one more bucket, so there is no global stop-the-world phase.
+                The new table is not expanded until the migration is finished.
+
+                Each bucket has a state word that counts the operations in progress on the bucket.
+                The thread that migrates the bucket marks it as frozen, waits until the operations in progress
+                are finished, copies the items into the buckets of the new table by means of \p Relocator
+                and clears the bucket. The operations that meet the frozen bucket are redirected to the new table.
+                Only the thread that migrates a bucket and the operations on that bucket wait for each other;
+                the other buckets are not affected.
+
+                The previous tables are not freed until the table is destroyed since some threads can still
+                read their bucket state. The size of all previous tables is less than the size of the current table.
+
+                Template parameters:
+                - \p OrderedList - ordered list type used as the bucket
+                - \p Relocator - the functor that copies an item of the previous table into the new one:
+                    \code
+                    struct relocator {
+                        // Inserts the copy of item pointed by it into bucket table pBuckets with bucket mask nMask
+                        template <typename Iterator>
+                        void operator()( OrderedList * pBuckets, size_t nMask, Iterator it ) const ;
+                    };
+                    \endcode
+                - \p Options - options
+
+                \p Options are:
+                - \p opt::allocator - allocator used to allocate bucket table. Default is \ref CDS_DEFAULT_ALLOCATOR
+                - \p opt::back_off - back-off strategy used to wait for a bucket migration. Default is cds::backoff::Default
+            */
+            template <typename OrderedList, typename Relocator, CDS_DECL_OPTIONS2>
+            class resizable_bucket_table
+            {
+                //@cond
+                struct default_options
+                {
+                    typedef CDS_DEFAULT_ALLOCATOR       allocator   ;
+                    typedef cds::backoff::Default       back_off    ;
+                };
+                typedef typename opt::make_options< default_options, CDS_OPTIONS2 >::type   options ;
+                //@endcond
+
+            public:
+                typedef OrderedList bucket_type ;   ///< Bucket type
+                typedef Relocator   relocator   ;   ///< Item relocator
+                typedef typename options::back_off  back_off    ;   ///< back-off strategy
+
+                /// Bucket table allocator
+                typedef cds::details::Allocator< bucket_type, typename options::allocator >  bucket_table_allocator ;
+
+            protected:
+                //@cond
+                // Bucket state: bit 0 - the bucket is frozen, bit 1 - the bucket is migrated,
+                // other bits are the count of operations in progress on the bucket
+                typedef CDS_ATOMIC::atomic<size_t>  bucket_state    ;
+                enum {
+                    c_nFrozen   = 1,
+                    c_nMigrated = 2,
+                    c_nOpInc    = 4
+                };
+
+                struct table
+                {
+                    size_t const                nMask       ;   // bucket count - 1
+                    bucket_type *               pBuckets    ;
+                    bucket_state *              pState      ;
+                    CDS_ATOMIC::atomic<table *> pPrev       ;   // the table being migrated into this one
+                    CDS_ATOMIC::atomic<size_t>  nCursor     ;   // the next bucket of pPrev to migrate
+                    CDS_ATOMIC::atomic<size_t>  nMigrated   ;   // count of migrated buckets of pPrev
+                    table *                     pRetired    ;   // previous table, freed in the destructor
+
+                    table( size_t nBucketCount, table * prev )
+                        : nMask( nBucketCount - 1 )
+                        , pPrev( prev )
+                        , nCursor( 0 )
+                        , nMigrated( 0 )
+                        , pRetired( prev )
+                    {}
+                };
+
+                typedef cds::details::Allocator< table, typename options::allocator >           table_allocator ;
+                typedef cds::details::Allocator< bucket_state, typename options::allocator >    state_allocator ;
+                //@endcond
+
+            public:
+                /// Bucket accessor returned by \ref bucket function
+                /**
+                    The accessor counts the operation in progress on the bucket:
+                    the bucket cannot be migrated while the accessor is alive.
+                */
+                class scoped_bucket
+                {
+                    bucket_type *           m_pBucket   ;
+                    mutable bucket_state *  m_pState    ;
+                public:
+                    //@cond
+                    scoped_bucket( bucket_type& b, bucket_state& s )
+                        : m_pBucket( &b )
+                        , m_pState( &s )
+                    {}
+
+                    scoped_bucket( scoped_bucket const& src )
+                        : m_pBucket( src.m_pBucket )
+                        , m_pState( src.m_pState )
+                    {
+                        src.m_pState = null_ptr<bucket_state *>() ;
+                    }
+
+                    ~scoped_bucket()
+                    {
+                        if ( m_pState )
+                            m_pState->fetch_sub( c_nOpInc, CDS_ATOMIC::memory_order_release ) ;
+                    }
+                    //@endcond
+
+                    /// Returns pointer to the bucket
+                    bucket_type * operator ->() const
+                    {
+                        return m_pBucket    ;
+                    }
+
+                private:
+                    //@cond
+                    scoped_bucket& operator =( scoped_bucket const& ) ;
+                    //@endcond
+                };
+
+            protected:
+                //@cond
+                const size_t                    m_nLoadFactor   ;
+                CDS_ATOMIC::atomic<table *>     m_pTable        ;
+                CDS_ATOMIC::atomic<bool>        m_bResizing     ;
+                //@endcond
+
+            protected:
+                //@cond
+                static table * alloc_table( size_t nBucketCount, table * pPrev )
+                {
+                    table * t = table_allocator().New( nBucketCount, pPrev ) ;
+                    t->pBuckets = bucket_table_allocator().NewArray( nBucketCount ) ;
+                    t->pState = state_allocator().NewArray( nBucketCount, size_t(0) ) ;
+                    return t ;
+                }
+
+                static void free_table( table * t )
+                {
+                    bucket_table_allocator().Delete( t->pBuckets, t->nMask + 1 ) ;
+                    state_allocator().Delete( t->pState, t->nMask + 1 ) ;
+                    table_allocator().Delete( t ) ;
+                }
+
+                static void migrate_bucket( table * t, table * pPrev, size_t nBucket )
+                {
+                    bucket_state& state = pPrev->pState[ nBucket ] ;
+                    size_t s = state.load( CDS_ATOMIC::memory_order_acquire ) ;
+                    if ( s & c_nMigrated )
+                        return ;
+
+                    if ( !( s & c_nFrozen ))
+                        s = state.fetch_or( c_nFrozen, CDS_ATOMIC::memory_order_acq_rel ) ;
+                    if ( s & c_nFrozen ) {
+                        // Another thread is migrating the bucket
+                        back_off bkoff ;
+                        while ( !( state.load( CDS_ATOMIC::memory_order_acquire ) & c_nMigrated ))
+                            bkoff() ;
+                        return ;
+                    }
+
+                    // Wait for the operations in progress
+                    {
+                        back_off bkoff ;
+                        while ( state.load( CDS_ATOMIC::memory_order_acquire ) >= c_nOpInc )
+                            bkoff() ;
+                    }
+
+                    bucket_type& src = pPrev->pBuckets[ nBucket ] ;
+                    relocator r ;
+                    for ( typename bucket_type::iterator it = src.begin(); it != src.end(); ++it )
+                        r( t->pBuckets, t->nMask, it ) ;
+                    src.clear() ;
+
+                    state.fetch_or( c_nMigrated, CDS_ATOMIC::memory_order_release ) ;
+                    if ( t->nMigrated.fetch_add( 1, CDS_ATOMIC::memory_order_acq_rel ) == pPrev->nMask )
+                        t->pPrev.store( null_ptr<table *>(), CDS_ATOMIC::memory_order_release ) ;
+                }
+
+                static void help_migrate( table * t, table * pPrev, size_t nHash )
+                {
+                    // Migrate the bucket of the key
+                    migrate_bucket( t, pPrev, nHash & pPrev->nMask ) ;
+
+                    // Help to migrate one more bucket
+                    if ( t->nCursor.load( CDS_ATOMIC::memory_order_relaxed ) <= pPrev->nMask ) {
+                        size_t nBucket = t->nCursor.fetch_add( 1, CDS_ATOMIC::memory_order_relaxed ) ;
+                        if ( nBucket <= pPrev->nMask )
+                            migrate_bucket( t, pPrev, nBucket ) ;
+                    }
+                }
+
+                // Finishes the migration in progress and returns current table
+                table * complete_migration() const
+                {
+                    table * t = m_pTable.load( CDS_ATOMIC::memory_order_acquire ) ;
+                    table * pPrev = t->pPrev.load( CDS_ATOMIC::memory_order_acquire ) ;
+                    if ( pPrev ) {
+                        for ( size_t nBucket = 0; nBucket <= pPrev->nMask; ++nBucket )
+                            migrate_bucket( t, pPrev, nBucket ) ;
+                    }
+                    return t ;
+                }
+                //@endcond
+
+            public:
+                /// Constructs the table of <tt>nMaxItemCount / nLoadFactor</tt> buckets rounded up to power of two
+                /**
+                    The table is doubled when item count exceeds <tt>bucket_count() * nLoadFactor</tt>.
+                */
+                resizable_bucket_table( size_t nMaxItemCount, size_t nLoadFactor )
+                    : m_nLoadFactor( nLoadFactor > 0 ? nLoadFactor : (size_t) 1 )
+                    , m_bResizing( false )
+                {
+                    m_pTable.store( alloc_table( init_hash_bitmask( nMaxItemCount, nLoadFactor ) + 1, null_ptr<table *>() ),
+                        CDS_ATOMIC::memory_order_release ) ;
+                }
+
+                /// Destroys the table
+                ~resizable_bucket_table()
+                {
+                    table * t = m_pTable.load( CDS_ATOMIC::memory_order_relaxed ) ;
+                    while ( t ) {
+                        table * pRetired = t->pRetired ;
+                        free_table( t ) ;
+                        t = pRetired ;
+                    }
+                }
+
+                /// Returns the bucket for hash value \p nHash
+                /**
+                    If a migration is in progress the function migrates the bucket of the previous table
+                    corresponding to \p nHash and helps to migrate one more bucket.
+                */
+                scoped_bucket bucket( size_t nHash )
+                {
+                    back_off bkoff ;
+                    while ( true ) {
+                        table * t = m_pTable.load( CDS_ATOMIC::memory_order_acquire ) ;
+                        table * pPrev = t->pPrev.load( CDS_ATOMIC::memory_order_acquire ) ;
+                        if ( pPrev )
+                            help_migrate( t, pPrev, nHash ) ;
+
+                        size_t const nBucket = nHash & t->nMask ;
+                        bucket_state& state = t->pState[ nBucket ] ;
+                        if ( !( state.fetch_add( c_nOpInc, CDS_ATOMIC::memory_order_acquire ) & c_nFrozen ))
+                            return scoped_bucket( t->pBuckets[ nBucket ], state ) ;
+
+                        // The table is being migrated into the new one
+                        state.fetch_sub( c_nOpInc, CDS_ATOMIC::memory_order_release ) ;
+                        bkoff() ;
+                    }
+                }
+
+                /// Item count has been changed. Doubles the table if the load factor is exceeded
+                /**
+                    The new table is installed only if no migration is in progress.
+                */
+                void grow( size_t nItemCount )
+                {
+                    table * t = m_pTable.load( CDS_ATOMIC::memory_order_relaxed ) ;
+                    if ( nItemCount <= (t->nMask + 1) * m_nLoadFactor
+                        || t->pPrev.load( CDS_ATOMIC::memory_order_relaxed ) != null_ptr<table *>() )
+                    {
+                        return ;
+                    }
+
+                    if ( m_bResizing.exchange( true, CDS_ATOMIC::memory_order_acquire ))
+                        return ;    // another thread is resizing
+
+                    t = m_pTable.load( CDS_ATOMIC::memory_order_acquire ) ;
+                    if ( nItemCount > (t->nMask + 1) * m_nLoadFactor
+                        && t->pPrev.load( CDS_ATOMIC::memory_order_acquire ) == null_ptr<table *>() )
+                    {
+                        m_pTable.store( alloc_table( (t->nMask + 1) * 2, t ), CDS_ATOMIC::memory_order_release ) ;
+                    }
+                    m_bResizing.store( false, CDS_ATOMIC::memory_order_release ) ;
+                }
+
+                /// Returns pointer to the bucket array of current table
+                /**
+                    The function finishes the migration in progress.
+                    The result is valid until the next resizing.
+                */
+                bucket_type * buckets() const
+                {
+                    return complete_migration()->pBuckets   ;
+                }
+
+                /// Returns the bucket count of current table
+                size_t bucket_count() const
+                {
+                    return m_pTable.load( CDS_ATOMIC::memory_order_acquire )->nMask + 1 ;
+                }
+            };
+
+            //@cond
+            template <bool Resizable, typename OrderedList, typename Relocator, CDS_DECL_OPTIONS2>
+            struct bucket_table_selector ;
+
+            template <typename OrderedList, typename Relocator, CDS_SPEC_OPTIONS2>
+            struct bucket_table_selector< false, OrderedList, Relocator, CDS_OPTIONS2>
+            {
+                typedef static_bucket_table< OrderedList, Relocator, CDS_OPTIONS2>  type    ;
+            };
+
+            template <typename OrderedList, typename Relocator, CDS_SPEC_OPTIONS2>
+            struct bucket_table_selector< true, OrderedList, Relocator, CDS_OPTIONS2>
+            {
+                typedef resizable_bucket_table< OrderedList, Relocator, CDS_OPTIONS2>  type    ;
+            };
+            //@endcond
+        }   // namespace details
     }
 
     //@cond
@@ -175,6 +175,9 @@ namespace cds { namespace container {
             // atomicity::empty_item_counter is not allowed as a item counter
             static_assert(( !std::is_same<item_counter, atomicity::empty_item_counter>::value ), "atomicity::empty_item_counter is not allowed as a item counter")  ;
 
+            // Resizable bucket table is not supported for gc::nogc
+            static_assert(( !options::resizable ), "Resizable bucket table is not supported for gc::nogc")  ;
+
             m_Buckets = bucket_table_allocator().NewArray( bucket_count() ) ;
         }
 
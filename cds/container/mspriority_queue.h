@@ -0,0 +1,336 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_MSPRIORITY_QUEUE_H
+#define __CDS_CONTAINER_MSPRIORITY_QUEUE_H
+
+#include <cds/container/base.h>
+#include <cds/intrusive/mspriority_queue.h>
+#include <cds/details/allocator.h>
+#include <cds/details/std/memory.h>
+
+namespace cds { namespace container {
+
+    /// MSPriorityQueue related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace mspriority_queue {
+
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Synonym for cds::intrusive::mspriority_queue::stat
+        typedef cds::intrusive::mspriority_queue::stat<> stat ;
+
+        /// Synonym for cds::intrusive::mspriority_queue::empty_stat
+        typedef cds::intrusive::mspriority_queue::empty_stat empty_stat ;
+#else
+        using cds::intrusive::mspriority_queue::stat        ;
+        using cds::intrusive::mspriority_queue::empty_stat  ;
+#endif
+
+        /// MSPriorityQueue traits
+        /**
+            The traits for \p %cds::container::MSPriorityQueue is the same as for
+            \p %cds::intrusive::MSPriorityQueue (see \p %cds::intrusive::mspriority_queue::type_traits)
+            plus some additional properties.
+        */
+        struct type_traits: public cds::intrusive::mspriority_queue::type_traits
+        {
+            /// The allocator use to allocate memory for values
+            typedef CDS_DEFAULT_ALLOCATOR   allocator ;
+        };
+
+        /// Metafunction converting option list to traits
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+
+            See \ref MSPriorityQueue, \ref type_traits, \ref cds::opt::make_options.
+        */
+        template <CDS_DECL_OPTIONS8>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, CDS_OPTIONS8 >::type
+                ,CDS_OPTIONS8
+            >::type   type ;
+#   endif
+        };
+    }   // namespace mspriority_queue
+
+    /// Michael & Scott array-based lock-based concurrent priority queue heap
+    /** @ingroup cds_nonintrusive_queue
+        Source:
+            - [1996] G.Hunt, M.Michael, S. Parthasarathy, M.Scott
+                "An efficient algorithm for concurrent priority queue heaps"
+
+        \p %MSPriorityQueue augments the standard array-based heap data structure with
+        a mutual-exclusion lock on the heap's size and locks on each node in the heap.
+        Each node also has a tag that indicates whether
+        it is empty, valid, or in a transient state due to an update to the heap
+        by an inserting thread.
+        The algorithm allows concurrent insertions and deletions in opposite directions,
+        without risking deadlock and without the need for special server threads.
+        It also uses a "bit-reversal" technique to scatter accesses across the fringe
+        of the tree to reduce contention.
+
+        This class is a wrapper over \ref cds::intrusive::MSPriorityQueue that allocates
+        a copy of the value pushed in dynamic memory. The heap array itself has fixed capacity
+        defined by the buffer.
+
+        The priority queue is max-priority: \p pop() extracts the item with the greatest
+        priority according to the comparator.
+
+        Template parameters:
+        - \p T - type to be stored in the list. The priority is a part of \p T type.
+        - \p Traits - type traits. See mspriority_queue::type_traits for explanation.
+
+        It is possible to declare option-based queue with \p cds::container::mspriority_queue::make_traits
+        metafunction instead of \p Traits template argument.
+        Template argument of the function \p Options is:
+        - opt::buffer - the buffer type for heap array. Possible type are: opt::v::static_buffer, opt::v::dynamic_buffer.
+            Default is \p %opt::v::dynamic_buffer.
+            You may specify any type of values for the buffer since at instantiation time
+            the \p buffer::rebind member metafunction is called to change the type of values stored in the buffer.
+        - opt::compare - priority compare functor. No default functor is provided.
+            If the option is not specified, the opt::less is used.
+        - opt::less - specifies binary predicate used for priority compare. Default is \p std::less<T>.
+        - opt::lock_type - lock type. Default is cds::lock::Spin.
+        - opt::back_off - back-off strategy. Default is cds::backoff::yield
+        - opt::allocator - allocator (like \p std::allocator) for the values of queue's items.
+            Default is \ref CDS_DEFAULT_ALLOCATOR
+        - opt::stat - internal statistics. Available types: mspriority_queue::stat, mspriority_queue::empty_stat (the default)
+
+        Example:
+        \code
+        #include <cds/container/mspriority_queue.h>
+
+        // Max-priority queue of int, capacity is 1024, dynamically allocated heap array
+        typedef cds::container::MSPriorityQueue< int,
+            cds::container::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< int > >
+            >::type
+        > int_pqueue ;
+        int_pqueue q( 1024 ) ;
+
+        // Min-priority queue of int, capacity is 256, statically allocated heap array
+        typedef cds::container::MSPriorityQueue< int,
+            cds::container::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::static_buffer< int, 256 > >
+                ,cds::opt::less< std::greater<int> >
+            >::type
+        > int_min_pqueue ;
+        int_min_pqueue qmin( 0 ) ;
+        \endcode
+    */
+    template <typename T, class Traits = mspriority_queue::type_traits >
+    class MSPriorityQueue: protected cds::intrusive::MSPriorityQueue< T, Traits >
+    {
+        //@cond
+        typedef cds::intrusive::MSPriorityQueue< T, Traits > base_class ;
+        //@endcond
+    public:
+        typedef T           value_type  ;   ///< Value type stored in the queue
+        typedef Traits      options     ;   ///< Traits template parameter
+
+        typedef typename base_class::key_comparator key_comparator ; ///< priority comparing functor based on opt::compare and opt::less option setter.
+        typedef typename base_class::lock_type lock_type;   ///< heap's size lock type
+        typedef typename base_class::back_off  back_off ;   ///< Back-off strategy
+        typedef typename base_class::stat      stat     ;   ///< internal statistics type
+        typedef typename options::allocator::template rebind<value_type>::other allocator_type ; ///< Value allocator
+
+    protected:
+        //@cond
+        typedef cds::details::Allocator< value_type, allocator_type >  cxx_allocator ;
+
+        struct value_deleter {
+            void operator()( value_type * p ) const
+            {
+                cxx_allocator().Delete( p ) ;
+            }
+        };
+        typedef std::unique_ptr<value_type, value_deleter> scoped_ptr ;
+
+        struct assign_functor {
+            value_type& m_dest ;
+
+            assign_functor( value_type& dest )
+                : m_dest( dest )
+            {}
+
+            void operator()( value_type& src )
+            {
+                m_dest = src ;
+            }
+        };
+
+        struct empty_functor {
+            void operator()( value_type& ) const
+            {}
+        };
+        //@endcond
+
+    public:
+        /// Constructs empty priority queue
+        /**
+            For cds::opt::v::static_buffer the \p nCapacity parameter is ignored.
+        */
+        MSPriorityQueue( size_t nCapacity )
+            : base_class( nCapacity )
+        {}
+
+        /// Clears priority queue and destructs the object
+        ~MSPriorityQueue()
+        {
+            clear() ;
+        }
+
+        /// Inserts a item into priority queue
+        /**
+            If the priority queue is full, the function returns \p false,
+            no item has been added.
+            Otherwise, the function inserts the copy of \p val into the heap
+            and returns \p true.
+
+            The function use copy constructor to create new heap item from \p val.
+        */
+        bool push( value_type const& val )
+        {
+            scoped_ptr pVal( cxx_allocator().New( val )) ;
+            if ( base_class::push( *(pVal.get()) )) {
+                pVal.release() ;
+                return true ;
+            }
+            return false ;
+        }
+
+#   ifdef CDS_EMPLACE_SUPPORT
+        /// Inserts a item into priority queue
+        /**
+            If the priority queue is full, the function returns \p false,
+            no item has been added.
+            Otherwise, the function inserts a new item created from \p args arguments
+            into the heap and returns \p true.
+
+            This function is available only for compiler that supports
+            variadic template and move semantics
+        */
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            scoped_ptr pVal( cxx_allocator().MoveNew( std::forward<Args>(args)... )) ;
+            if ( base_class::push( *(pVal.get()) )) {
+                pVal.release() ;
+                return true ;
+            }
+            return false ;
+        }
+#   endif
+
+        /// Extracts item with high priority
+        /**
+            If the priority queue is empty, the function returns \p false.
+            Otherwise, it returns \p true and \p dest contains the copy of extracted item.
+            The item is deallocated from the heap.
+        */
+        bool pop( value_type& dest )
+        {
+            return pop_with( assign_functor( dest )) ;
+        }
+
+        /// Extracts an item with high priority
+        /**
+            If the priority queue is empty, the function returns \p false.
+            Otherwise, it returns \p true and the functor \p f is called for the item extracted.
+            \p Func interface is:
+            \code
+                struct extractor {
+                    void operator()( value_type& item ) ;
+                };
+            \endcode
+            The functor can be passed by reference using <tt>boost:ref</tt>.
+            The item is deallocated after the functor \p f returns.
+        */
+        template <typename Func>
+        bool pop_with( Func f )
+        {
+            value_type * pVal = base_class::pop() ;
+            if ( pVal ) {
+                scoped_ptr p( pVal ) ;
+                cds::unref(f)( *pVal ) ;
+                return true ;
+            }
+            return false ;
+        }
+
+        /// Clears the queue (not atomic)
+        /**
+            This function is no atomic, but thread-safe
+        */
+        void clear()
+        {
+            clear_with( empty_functor() ) ;
+        }
+
+        /// Clears the queue (not atomic)
+        /**
+            This function is no atomic, but thread-safe.
+
+            For each item removed the functor \p f is called.
+            \p Func interface is:
+            \code
+                struct clear_functor
+                {
+                    void operator()( value_type& item ) ;
+                };
+            \endcode
+            A lambda function or a function pointer can be used as \p f.
+        */
+        template <typename Func>
+        void clear_with( Func f )
+        {
+            while ( pop_with( f )) ;
+        }
+
+        /// Checks is the priority queue is empty
+        bool empty() const
+        {
+            return base_class::empty() ;
+        }
+
+        /// Checks if the priority queue is full
+        bool full() const
+        {
+            return base_class::full() ;
+        }
+
+        /// Returns current size of priority queue
+        size_t size() const
+        {
+            return base_class::size() ;
+        }
+
+        /// Return capacity of the priority queue
+        size_t capacity() const
+        {
+            return base_class::capacity() ;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return base_class::statistics() ;
+        }
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_MSPRIORITY_QUEUE_H
@@ -0,0 +1,197 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_MULTILEVEL_HASHMAP_BASE_H
+#define __CDS_CONTAINER_MULTILEVEL_HASHMAP_BASE_H
+
+#include <cds/intrusive/multilevel_hashset_base.h>
+#include <cds/container/base.h>
+#include <cds/opt/hash.h>
+
+namespace cds { namespace container {
+
+    /// MultiLevelHashMap related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace multilevel_hashmap {
+
+#ifdef CDS_DOXYGEN_INVOKED
+        /// Typedef for intrusive::multilevel_hashset::hash_type option setter
+        template <typename T> struct hash_type {};
+        /// Typedef for intrusive::multilevel_hashset::stat class
+        class stat {};
+        /// Typedef for intrusive::multilevel_hashset::empty_stat class
+        class empty_stat {};
+        /// Typedef for intrusive::multilevel_hashset::level_statistics struct
+        struct level_statistics {};
+#else
+        using cds::intrusive::multilevel_hashset::hash_type ;
+        using cds::intrusive::multilevel_hashset::stat ;
+        using cds::intrusive::multilevel_hashset::empty_stat ;
+        using cds::intrusive::multilevel_hashset::level_statistics ;
+#endif
+
+        /// Type traits for MultiLevelHashMap class
+        struct type_traits
+        {
+            /// Hash functor
+            /**
+                The hash functor maps the key to the value of \ref hash_type.
+                The hash functor must be perfect: different keys must have different hash values,
+                since the map distinguishes the keys by their hash values only.
+                Default is \p opt::v::hash (<tt>std::hash</tt>) that is perfect for integral keys.
+            */
+            typedef opt::none   hash ;
+
+            /// Hash value type
+            /**
+                The type of the value returned by \ref hash functor. Default is \p size_t.
+            */
+            typedef size_t      hash_type ;
+
+            /// Hash comparing functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+                If \p less is not specified too, the hash values are compared bitwise.
+            */
+            typedef opt::none   compare ;
+
+            /// Binary predicate to compare the hash values
+            typedef opt::none   less ;
+
+            /// Item counter
+            /**
+                The \p empty() member function depends on the item counting,
+                so, the default is atomicity::item_counter.
+            */
+            typedef atomicity::item_counter item_counter ;
+
+            /// C++ memory ordering model
+            /**
+                List of available memory ordering see opt::memory_model
+            */
+            typedef opt::v::relaxed_ordering    memory_model ;
+
+            /// Back-off strategy
+            typedef cds::backoff::Default       back_off ;
+
+            /// Allocator for the map nodes and for the array nodes
+            typedef CDS_DEFAULT_ALLOCATOR       allocator ;
+
+            /// Internal statistics
+            /**
+                Possible types: \ref multilevel_hashmap::stat, \ref multilevel_hashmap::empty_stat (the default)
+            */
+            typedef empty_stat                  stat ;
+
+            /// RCU deadlock checking policy (only for RCU-based MultiLevelHashMap)
+            /**
+                List of available options see opt::rcu_check_deadlock
+            */
+            typedef opt::v::rcu_throw_deadlock  rcu_check_deadlock ;
+        };
+
+        /// Metafunction converting option list to MultiLevelHashMap traits
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options list see \ref MultiLevelHashMap.
+        */
+        template <CDS_DECL_OPTIONS10>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, CDS_OPTIONS10 >::type
+                ,CDS_OPTIONS10
+            >::type   type ;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+
+            template <typename IntrusiveIterator>
+            class iterator
+            {
+                template <typename> friend class iterator ;
+
+                typedef IntrusiveIterator                       intrusive_iterator  ;
+                typedef typename intrusive_iterator::value_type node_type           ;
+                typedef typename node_type::stored_value_type   value_type          ;
+                static bool const c_isConst = intrusive_iterator::c_isConst ;
+
+                typedef typename std::conditional< c_isConst, value_type const *, value_type *>::type   value_ptr ;
+                typedef typename std::conditional< c_isConst, value_type const &, value_type &>::type   value_ref ;
+
+                intrusive_iterator      m_It ;
+
+            public: // for internal use only!!!
+                iterator( intrusive_iterator const& it )
+                    : m_It( it )
+                {}
+
+            public:
+                iterator()
+                    : m_It()
+                {}
+
+                iterator( iterator const& s)
+                    : m_It( s.m_It )
+                {}
+
+                value_ptr operator ->() const
+                {
+                    return &( m_It.operator->()->m_Value ) ;
+                }
+
+                value_ref operator *() const
+                {
+                    return m_It.operator*().m_Value ;
+                }
+
+                /// Pre-increment
+                iterator& operator ++()
+                {
+                    ++m_It ;
+                    return *this;
+                }
+
+                iterator& operator = (iterator const& src)
+                {
+                    m_It = src.m_It ;
+                    return *this    ;
+                }
+
+                template <typename It>
+                bool operator ==(iterator<It> const& i ) const
+                {
+                    return m_It == i.m_It ;
+                }
+                template <typename It>
+                bool operator !=(iterator<It> const& i ) const
+                {
+                    return !( *this == i )  ;
+                }
+            };
+
+        } // namespace details
+        //@endcond
+
+    } // namespace multilevel_hashmap
+
+    // Forward declaration
+    template < class GC, typename Key, typename T, class Traits = multilevel_hashmap::type_traits >
+    class MultiLevelHashMap ;
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_MULTILEVEL_HASHMAP_BASE_H
@@ -0,0 +1,20 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_MULTILEVEL_HASHMAP_EBR_H
+#define __CDS_CONTAINER_MULTILEVEL_HASHMAP_EBR_H
+
+#include <cds/container/multilevel_hashmap_base.h>
+#include <cds/intrusive/multilevel_hashset_ebr.h>
+#include <cds/container/details/make_multilevel_hashmap.h>
+#include <cds/container/multilevel_hashmap_impl.h>
+
+#endif  // #ifndef __CDS_CONTAINER_MULTILEVEL_HASHMAP_EBR_H
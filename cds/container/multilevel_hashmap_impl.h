@@ -0,0 +1,502 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_MULTILEVEL_HASHMAP_IMPL_H
+#define __CDS_CONTAINER_MULTILEVEL_HASHMAP_IMPL_H
+
+#include <cds/details/functor_wrapper.h>
+#include <cds/details/std/memory.h>
+
+namespace cds { namespace container {
+
+    /// Lock-free multi-level hash map
+    /** @ingroup cds_nonintrusive_map
+        \anchor cds_nonintrusive_MultiLevelHashMap_hp
+
+        Source:
+            - [2013] Steven Feldman, Pierre LaBorde, Damian Dechev "Concurrent Multi-level Arrays:
+                Wait-free Extensible Hash Maps"
+
+        The map is based on \ref cds_intrusive_MultiLevelHashSet_hp "intrusive MultiLevelHashSet":
+        the hash value of the key is split into the chunks of bits, each chunk is an index in an array
+        of the corresponding level of the tree. When two keys collide in a slot the slot is converted
+        to the array node of the next level, so the map grows without any global rehashing and
+        a resizing never blocks concurrent operations.
+
+        The map requires a <b>perfect</b> hash functor: different keys must have different hash values.
+        The keys are never compared, two keys with equal hash values are treated as equal.
+        The default hash functor <tt>std::hash</tt> is perfect for integral keys if \p sizeof(Key) <= sizeof(size_t).
+        For other key types you may use a cryptographic hash (with \p multilevel_hashmap::hash_type option
+        specifying the type of hash value, for example, a fixed-size array of bytes) or any other bijection.
+
+        Template parameters:
+        - \p GC - safe memory reclamation schema. Can be \p gc::HP, \p gc::PTB, \p gc::EBR
+            or one of \ref cds_urcu_type "RCU type".
+        - \p Key - key type
+        - \p T - mapped type
+        - \p Traits - type traits, default is \p multilevel_hashmap::type_traits.
+            Instead of defining \p Traits struct you may use option-based syntax with \p multilevel_hashmap::make_traits metafunction.
+
+        Options (see \p multilevel_hashmap::type_traits):
+        - \p opt::hash - perfect hash functor, default is \p opt::v::hash
+        - \p multilevel_hashmap::hash_type - the type of hash value, default is \p size_t
+        - \p opt::compare, \p opt::less - hash value comparing functor, default is bitwise comparing
+        - \p opt::allocator - allocator for the map nodes and for the array nodes
+        - \p opt::item_counter, \p opt::memory_model, \p opt::back_off - as usual
+        - \p opt::stat - internal statistics, \p multilevel_hashmap::stat or \p multilevel_hashmap::empty_stat (the default)
+        - \p opt::rcu_check_deadlock - deadlock checking policy for RCU-based map
+
+        The size of the head array and of the array nodes is specified by constructor's arguments.
+
+        There are header files for each \p GC type:
+        - <tt><cds/container/multilevel_hashmap_hp.h></tt> - for \p gc::HP
+        - <tt><cds/container/multilevel_hashmap_ptb.h></tt> - for \p gc::PTB
+        - <tt><cds/container/multilevel_hashmap_ebr.h></tt> - for \p gc::EBR
+        - <tt><cds/container/multilevel_hashmap_rcu.h></tt> - for \ref cds_urcu_type "RCU type".
+            The RCU-based map is built on \ref cds_intrusive_MultiLevelHashSet_rcu "RCU-based MultiLevelHashSet":
+            \p erase and \p clear may synchronize RCU and should not be called under RCU lock,
+            the iterating should be performed under RCU lock.
+            Before including this header you should include appropriate RCU header file.
+
+        <b>Iterators</b>
+
+        The map supports forward iterators. The iterator of the map based on \p gc::HP, \p gc::PTB or \p gc::EBR
+        guards the item it points to, so the item cannot be freed while the iterator is alive.
+        The iterator is not a snapshot: the items inserted or deleted concurrently may or may not be visited.
+        Note that each iterator object holds a guard; for \p gc::HP the count of guards is a limited resource,
+        so you should not keep many iterators at the same time.
+    */
+    template <
+        class GC,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = multilevel_hashmap::type_traits
+#else
+        class Traits
+#endif
+    >
+    class MultiLevelHashMap:
+#ifdef CDS_DOXYGEN_INVOKED
+        protected intrusive::MultiLevelHashSet< GC, std::pair<Key const, T>, Traits >
+#else
+        protected details::make_multilevel_hashmap< GC, Key, T, Traits >::type
+#endif
+    {
+        //@cond
+        typedef details::make_multilevel_hashmap< GC, Key, T, Traits >  maker ;
+        typedef typename maker::type base_class ;
+        //@endcond
+    public:
+        typedef typename base_class::gc gc  ;   ///< Garbage collector used
+        typedef Key     key_type    ;   ///< Key type
+        typedef T       mapped_type ;   ///< Mapped type
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef std::pair< Key const, T> value_type ;   ///< Value type stored in the map
+#   else
+        typedef typename maker::value_type  value_type  ;
+#   endif
+        typedef Traits  options     ;   ///< Options specified
+
+        typedef typename maker::hasher              hasher          ;   ///< Hash functor
+        typedef typename maker::hash_type           hash_type       ;   ///< Hash value type
+        typedef typename base_class::back_off       back_off        ;   ///< Back-off strategy used
+        typedef typename options::allocator         allocator_type  ;   ///< Allocator type
+        typedef typename base_class::item_counter   item_counter    ;   ///< Item counting policy used
+        typedef typename base_class::memory_model   memory_model    ;   ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename base_class::stat           stat            ;   ///< Internal statistics type
+        typedef typename base_class::level_statistics level_statistics ;  ///< Level statistics, see \ref get_level_statistics
+
+    protected:
+        //@cond
+        typedef typename maker::node_type           node_type       ;
+        typedef typename maker::cxx_node_allocator  cxx_node_allocator ;
+
+        typedef std::unique_ptr< node_type, typename maker::node_deallocator >    scoped_node_ptr ;
+
+        template <typename K>
+        static hash_type hash_key( K const& key )
+        {
+            return hasher()( key ) ;
+        }
+        //@endcond
+
+    protected:
+        //@cond
+#   ifndef CDS_CXX11_LAMBDA_SUPPORT
+        struct empty_insert_functor
+        {
+            void operator()( value_type& ) const
+            {}
+        };
+
+        template <typename Func>
+        class insert_key_wrapper: protected cds::details::functor_wrapper<Func>
+        {
+            typedef cds::details::functor_wrapper<Func> base_class ;
+        public:
+            insert_key_wrapper( Func f ): base_class(f) {}
+
+            void operator()( node_type& item )
+            {
+                base_class::get()( item.m_Value ) ;
+            }
+        };
+
+        template <typename Func>
+        class ensure_wrapper: protected cds::details::functor_wrapper<Func>
+        {
+            typedef cds::details::functor_wrapper<Func> base_class ;
+        public:
+            ensure_wrapper( Func f) : base_class(f) {}
+
+            void operator()( bool bNew, node_type& item, node_type const& )
+            {
+                base_class::get()( bNew, item.m_Value ) ;
+            }
+        };
+
+        template <typename Func>
+        struct erase_functor
+        {
+            Func        m_func  ;
+
+            erase_functor( Func f )
+                : m_func(f)
+            {}
+
+            void operator()( node_type& node )
+            {
+                cds::unref(m_func)( node.m_Value )  ;
+            }
+        };
+
+        template <typename Func>
+        class find_wrapper: protected cds::details::functor_wrapper<Func>
+        {
+            typedef cds::details::functor_wrapper<Func> base_class ;
+        public:
+            find_wrapper( Func f )
+                : base_class(f)
+            {}
+
+            void operator()( node_type& item )
+            {
+                base_class::get()( item.m_Value ) ;
+            }
+        };
+#   endif  // #ifndef CDS_CXX11_LAMBDA_SUPPORT
+        //@endcond
+
+    public:
+        /// Creates empty map
+        /**
+            The function creates the head array of <tt>2 ** head_bits</tt> slots;
+            each array node created on collision has <tt>2 ** array_bits</tt> slots.
+            See \ref cds_intrusive_MultiLevelHashSet_hp "MultiLevelHashSet" for the limits of the arguments.
+        */
+        MultiLevelHashMap( size_t head_bits = 8, size_t array_bits = 4 )
+            : base_class( head_bits, array_bits )
+        {}
+
+        /// Destroys the map and frees all items
+        ~MultiLevelHashMap()
+        {}
+
+    public:
+        /// Iterator type
+        typedef multilevel_hashmap::details::iterator< typename base_class::iterator >  iterator        ;
+
+        /// Const iterator type
+        typedef multilevel_hashmap::details::iterator< typename base_class::const_iterator >   const_iterator  ;
+
+        /// Returns a forward iterator addressing the first element in a map
+        iterator begin()
+        {
+            return iterator( base_class::begin() )    ;
+        }
+
+        /// Returns a forward const iterator addressing the first element in a map
+        //@{
+        const_iterator begin() const
+        {
+            return const_iterator( base_class::begin() ) ;
+        }
+        const_iterator cbegin()
+        {
+            return const_iterator( base_class::cbegin() ) ;
+        }
+        //@}
+
+        /// Returns a forward iterator that addresses the location succeeding the last element in a map.
+        iterator end()
+        {
+            return iterator( base_class::end() )   ;
+        }
+
+        /// Returns a forward const iterator that addresses the location succeeding the last element in a map.
+        //@{
+        const_iterator end() const
+        {
+            return const_iterator( base_class::end() ) ;
+        }
+        const_iterator cend()
+        {
+            return const_iterator( base_class::cend() ) ;
+        }
+        //@}
+
+    public:
+        /// Inserts new node with key and default value
+        /**
+            The function creates a node with \p key and default value, and then inserts the node created into the map.
+
+            Preconditions:
+            - The \ref key_type should be constructible from a value of type \p K.
+            - The \ref mapped_type should be default-constructible.
+            - The hash functor should return the same hash value for \p key and for \ref key_type constructed from \p key.
+
+            Returns \p true if inserting successful, \p false otherwise.
+        */
+        template <typename K>
+        bool insert( K const& key )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return insert_key( key, [](value_type&){} )    ;
+#       else
+            return insert_key( key, empty_insert_functor() )   ;
+#       endif
+        }
+
+        /// Inserts new node
+        /**
+            The function creates a node with copy of \p val value
+            and then inserts the node created into the map.
+
+            Returns \p true if \p val is inserted into the map, \p false otherwise.
+        */
+        template <typename K, typename V>
+        bool insert( K const& key, V const& val )
+        {
+            scoped_node_ptr pNode( cxx_node_allocator().New( hash_key( key ), key, val )) ;
+            if ( base_class::insert( *pNode )) {
+                pNode.release() ;
+                return true     ;
+            }
+            return false ;
+        }
+
+        /// Inserts new node and initialize it by a functor
+        /**
+            This function inserts new node with key \p key and if inserting is successful then it calls
+            \p func functor with signature
+            \code
+                struct functor {
+                    void operator()( value_type& item )  ;
+                };
+            \endcode
+            The functor may change <tt>item.second</tt>. The user-defined functor can be passed by reference
+            using <tt>boost::ref</tt> and it is called only if inserting is successful.
+
+            Note that the item is already visible for other threads when the functor is called.
+        */
+        template <typename K, typename Func>
+        bool insert_key( const K& key, Func func )
+        {
+            scoped_node_ptr pNode( cxx_node_allocator().New( hash_key( key ), key )) ;
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            if ( base_class::insert( *pNode, [&func]( node_type& item ) { cds::unref(func)( item.m_Value ); } ))
+#       else
+            insert_key_wrapper<Func> wrapper(func) ;
+            if ( base_class::insert( *pNode, cds::ref(wrapper) ))
+#endif
+            {
+                pNode.release() ;
+                return true     ;
+            }
+            return false ;
+        }
+
+#   ifdef CDS_EMPLACE_SUPPORT
+        /// For key \p key inserts data of type \ref value_type constructed with <tt>std::forward<Args>(args)...</tt>
+        /**
+            Returns \p true if inserting successful, \p false otherwise.
+
+            @note This function is available only for compiler that supports
+            variadic template and move semantics
+        */
+        template <typename K, typename... Args>
+        bool emplace( K&& key, Args&&... args )
+        {
+            hash_type h = hash_key( key ) ;
+            scoped_node_ptr pNode( cxx_node_allocator().MoveNew( h, std::forward<K>(key), std::forward<Args>(args)... )) ;
+            if ( base_class::insert( *pNode )) {
+                pNode.release() ;
+                return true     ;
+            }
+            return false ;
+        }
+#   endif
+
+        /// Ensures that the \p key exists in the map
+        /**
+            If the \p key is not found in the map, then the new item created from \p key
+            is inserted into the map. Otherwise, the functor \p func is called with item found.
+            The functor \p Func interface is:
+            \code
+                struct my_functor {
+                    void operator()( bool bNew, value_type& item ) ;
+                };
+            \endcode
+            where \p bNew is \p true if the item has been inserted, \p false otherwise.
+
+            Returns <tt> std::pair<bool, bool> </tt> where \p first is \p true if operation is successfull,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already is in the map.
+        */
+        template <typename K, typename Func>
+        std::pair<bool, bool> ensure( K const& key, Func func )
+        {
+            scoped_node_ptr pNode( cxx_node_allocator().New( hash_key( key ), key )) ;
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            std::pair<bool, bool> res = base_class::ensure( *pNode,
+                [&func](bool bNew, node_type& item, node_type const& ){ cds::unref(func)( bNew, item.m_Value ); }
+            ) ;
+#       else
+            ensure_wrapper<Func> wrapper( func )   ;
+            std::pair<bool, bool> res = base_class::ensure( *pNode, cds::ref(wrapper) ) ;
+#       endif
+            if ( res.first && res.second )
+                pNode.release() ;
+            return res ;
+        }
+
+        /// Delete \p key from the map
+        /** \anchor cds_nonintrusive_MultiLevelHashMap_erase_val
+
+            Return \p true if \p key is found and deleted, \p false otherwise
+        */
+        template <typename K>
+        bool erase( K const& key )
+        {
+            return base_class::erase( hash_key( key )) ;
+        }
+
+        /// Delete \p key from the map
+        /**
+            The function is an analog of \ref cds_nonintrusive_MultiLevelHashMap_erase_val "erase(K const&)"
+            but calls \p f functor for the item found before deleting:
+            \code
+            struct extractor {
+                void operator()(value_type& item) { ... }
+            };
+            \endcode
+            The functor may be passed by reference using <tt>boost:ref</tt>
+        */
+        template <typename K, typename Func>
+        bool erase( K const& key, Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::erase( hash_key( key ), [&f]( node_type& node) { cds::unref(f)( node.m_Value ); } ) ;
+#       else
+            erase_functor<Func> wrapper(f) ;
+            return base_class::erase( hash_key( key ), cds::ref(wrapper)) ;
+#       endif
+        }
+
+        /// Find the key \p key
+        /**
+            The function searches the item with key equal to \p key and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item ) ;
+            };
+            \endcode
+            The functor may change \p item.second. Note that the functor is only guarantee
+            that \p item cannot be disposed during functor is executing.
+            The functor does not serialize simultaneous access to the map's \p item.
+
+            The function returns \p true if \p key is found, \p false otherwise.
+        */
+        template <typename K, typename Func>
+        bool find( K const& key, Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::find( hash_key( key ), [&f](node_type& item) { cds::unref(f)( item.m_Value );}) ;
+#       else
+            find_wrapper<Func> wrapper(f)       ;
+            return base_class::find( hash_key( key ), cds::ref(wrapper) )   ;
+#       endif
+        }
+
+        /// Find the key \p key
+        /**
+            The function searches the item with key equal to \p key
+            and returns \p true if it is found, and \p false otherwise.
+        */
+        template <typename K>
+        bool find( K const& key )
+        {
+            return base_class::find( hash_key( key )) ;
+        }
+
+        /// Clears the map (non-atomic)
+        /**
+            The items are removed one by one and passed to the garbage collector by one batch.
+        */
+        void clear()
+        {
+            base_class::clear() ;
+        }
+
+        /// Checks if the map is empty
+        /**
+            Emptiness is checked by item counting: if item count is zero then the map is empty.
+        */
+        bool empty() const
+        {
+            return base_class::empty() ;
+        }
+
+        /// Returns item count in the map
+        size_t size() const
+        {
+            return base_class::size()    ;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return base_class::statistics() ;
+        }
+
+        /// Returns the size of the head array
+        size_t head_size() const
+        {
+            return base_class::head_size() ;
+        }
+
+        /// Returns the size of the array node
+        size_t array_node_size() const
+        {
+            return base_class::array_node_size() ;
+        }
+
+        /// Collects tree level statistics into \p stat
+        void get_level_statistics( std::vector< level_statistics >& stat ) const
+        {
+            base_class::get_level_statistics( stat ) ;
+        }
+    };
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_MULTILEVEL_HASHMAP_IMPL_H
@@ -14,6 +14,8 @@
 
 #include <cds/intrusive/skip_list_base.h>
 #include <cds/container/base.h>
+#include <cds/lock/spinlock.h>
+#include <cds/lock/scoped_lock.h>
 
 namespace cds { namespace container {
 
@@ -57,6 +59,86 @@ namespace cds { namespace container {
         using cds::intrusive::skip_list::empty_stat ;
 #endif
 
+        //@cond
+        namespace details {
+            template <unsigned int Capacity, typename Lock, typename Allocator, size_t NodeSize, size_t TowerItemSize>
+            class per_height_node_pool ;
+
+            struct empty_node_pool
+            {
+                static unsigned char * allocate( unsigned int /*nHeight*/ )
+                {
+                    return null_ptr<unsigned char *>() ;
+                }
+                static bool deallocate( unsigned char * /*p*/, unsigned int /*nHeight*/ )
+                {
+                    return false ;
+                }
+            };
+        } // namespace details
+        //@endcond
+
+        /// Node pool is not used
+        /**
+            This is default value of skip_list::node_pool option.
+            Each node is allocated from and freed to skip-list's allocator.
+        */
+        struct no_node_pool
+        {
+            //@cond
+            template <typename Allocator, size_t NodeSize, size_t TowerItemSize>
+            struct rebind {
+                typedef details::empty_node_pool other ;
+            };
+            //@endcond
+        };
+
+        /// Per-height free-list pool of skip-list nodes
+        /**
+            A node of the container skip-list is allocated together with its tower
+            in single memory block whose size depends on the node height.
+            This pool keeps a free-list of released blocks for each height
+            and reuses them on node allocation, so insert/erase-intensive workloads
+            do not stress the allocator.
+
+            The pool is global: it is shared by all skip-lists that have
+            the same node size and the same allocator.
+            Each free-list keeps no more than \p Capacity blocks, the excess blocks
+            are freed to the allocator. The free-lists are protected by \p Lock,
+            default is cds::lock::Spin.
+
+            The blocks cached are not freed to the allocator at program termination
+            since the allocator may be destroyed before the pool.
+
+            Use this type with skip_list::node_pool option.
+        */
+        template <unsigned int Capacity = 1024, typename Lock = cds::lock::Spin>
+        struct per_height_pool
+        {
+            static unsigned int const c_nCapacity = Capacity ;  ///< Max count of blocks kept for each height
+
+            //@cond
+            template <typename Allocator, size_t NodeSize, size_t TowerItemSize>
+            struct rebind {
+                typedef details::per_height_node_pool< Capacity, Lock, Allocator, NodeSize, TowerItemSize > other ;
+            };
+            //@endcond
+        };
+
+        /// Option setter for node pool
+        /**
+            Possible \p Type are skip_list::no_node_pool (the default) and skip_list::per_height_pool.
+        */
+        template <typename Type>
+        struct node_pool {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                typedef Type node_pool ;
+            };
+            //@endcond
+        };
+
         /// Type traits for SkipListSet class
         struct type_traits
         {
@@ -99,6 +181,13 @@ namespace cds { namespace container {
             /// Allocator for skip-list nodes, \p std::allocator interface
             typedef CDS_DEFAULT_ALLOCATOR           allocator ;
 
+            /// Node pool
+            /**
+                See skip_list::node_pool option setter.
+                Default is skip_list::no_node_pool
+            */
+            typedef no_node_pool                    node_pool ;
+
             /// back-off strategy used
             /**
                 If the option is not specified, the cds::backoff::Default is used.
@@ -140,6 +229,79 @@ namespace cds { namespace container {
         //@cond
         namespace details {
 
+            template <unsigned int Capacity, typename Lock, typename Allocator, size_t NodeSize, size_t TowerItemSize>
+            class per_height_node_pool
+            {
+                typedef Lock lock_type ;
+                typedef cds::lock::scoped_lock< lock_type > scoped_lock ;
+
+                struct free_block {
+                    free_block *    m_pNext ;
+                };
+
+                struct free_list {
+                    lock_type       m_Lock  ;
+                    free_block *    m_pHead ;
+                    unsigned int    m_nSize ;
+                    char            m_pad[ cds::c_nCacheLineSize ] ; // keeps free-lists of adjacent heights in different cache lines
+
+                    free_list()
+                        : m_pHead( null_ptr<free_block *>() )
+                        , m_nSize( 0 )
+                    {}
+                };
+
+                free_list   m_FreeList[ cds::intrusive::skip_list::c_nHeightLimit ] ;
+
+                static per_height_node_pool s_Pool ;
+
+            public:
+                static CDS_CONSTEXPR size_t node_size( unsigned int nHeight ) CDS_NOEXCEPT
+                {
+                    return NodeSize + (nHeight - 1) * TowerItemSize ;
+                }
+
+                static unsigned char * allocate( unsigned int nHeight )
+                {
+                    assert( nHeight > 0 && nHeight <= cds::intrusive::skip_list::c_nHeightLimit ) ;
+
+                    {
+                        free_list& fl = s_Pool.m_FreeList[ nHeight - 1 ] ;
+                        scoped_lock al( fl.m_Lock ) ;
+                        free_block * p = fl.m_pHead ;
+                        if ( p ) {
+                            fl.m_pHead = p->m_pNext ;
+                            --fl.m_nSize ;
+                            return reinterpret_cast<unsigned char *>( p ) ;
+                        }
+                    }
+                    return Allocator().allocate( node_size( nHeight )) ;
+                }
+
+                static bool deallocate( unsigned char * pMem, unsigned int nHeight )
+                {
+                    assert( nHeight > 0 && nHeight <= cds::intrusive::skip_list::c_nHeightLimit ) ;
+
+                    {
+                        free_list& fl = s_Pool.m_FreeList[ nHeight - 1 ] ;
+                        scoped_lock al( fl.m_Lock ) ;
+                        if ( fl.m_nSize < Capacity ) {
+                            free_block * p = reinterpret_cast<free_block *>( pMem ) ;
+                            p->m_pNext = fl.m_pHead ;
+                            fl.m_pHead = p ;
+                            ++fl.m_nSize ;
+                            return true ;
+                        }
+                    }
+                    Allocator().deallocate( pMem, node_size( nHeight )) ;
+                    return true ;
+                }
+            };
+
+            template <unsigned int Capacity, typename Lock, typename Allocator, size_t NodeSize, size_t TowerItemSize>
+            per_height_node_pool< Capacity, Lock, Allocator, NodeSize, TowerItemSize >
+                per_height_node_pool< Capacity, Lock, Allocator, NodeSize, TowerItemSize >::s_Pool ;
+
             template <typename Node, typename Traits>
             class node_allocator
             {
@@ -155,12 +317,20 @@ namespace cds { namespace container {
                 static size_t const c_nNodePadding = sizeof(node_type) % c_nTowerItemSize ;
                 static size_t const c_nNodeSize = sizeof(node_type) + (c_nNodePadding ? (c_nTowerItemSize - c_nNodePadding) : 0) ;
 
+                typedef typename type_traits::node_pool::template rebind< tower_allocator_type, c_nNodeSize, c_nTowerItemSize >::other node_pool ;
+
                 static CDS_CONSTEXPR size_t node_size( unsigned int nHeight ) CDS_NOEXCEPT
                 {
                     return c_nNodeSize + (nHeight - 1) * c_nTowerItemSize ;
                 }
                 static unsigned char * alloc_space( unsigned int nHeight )
                 {
+                    unsigned char * pMem = node_pool::allocate( nHeight ) ;
+                    if ( pMem ) {
+                        assert( (((uintptr_t) pMem) & (alignof(node_type) - 1)) == 0 ) ;
+                        return pMem ;
+                    }
+
                     if ( nHeight > 1 ) {
                         unsigned char * pMem = tower_allocator_type().allocate( node_size(nHeight) ) ;
 
@@ -176,6 +346,8 @@ namespace cds { namespace container {
                 static void free_space( unsigned char * p, unsigned int nHeight )
                 {
                     assert( p != null_ptr<unsigned char *>() ) ;
+                    if ( node_pool::deallocate( p, nHeight ))
+                        return ;
                     if ( nHeight == 1 )
                         node_allocator_type().deallocate( reinterpret_cast<node_type *>(p), 1 ) ;
                     else
@@ -13,6 +13,7 @@
 #define __CDS_CONTAINER_SKIP_LIST_MAP_IMPL_H
 
 #include <cds/details/functor_wrapper.h>
+#include <cds/gc/guarded_ptr.h>
 
 namespace cds { namespace container {
 
@@ -59,6 +60,9 @@ namespace cds { namespace container {
             user-provided one. See skip_list::random_level_generator option description for explanation.
             Default is \p %skip_list::turbo_pascal.
         - opt::allocator - allocator for skip-list node. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - skip_list::node_pool - the pool of released nodes. A node and its tower are allocated in single memory block
+            which size depends on the node height; skip_list::per_height_pool reuses the blocks released
+            instead of returning them to the allocator. Default is skip_list::no_node_pool.
         - opt::back_off - back-off strategy used. If the option is not specified, the cds::backoff::Default is used.
         - opt::stat - internal statistics. Available types: skip_list::stat, skip_list::empty_stat (the default)
 
@@ -165,8 +169,18 @@ namespace cds { namespace container {
 
         typedef std::unique_ptr< node_type, typename maker::node_deallocator >    scoped_node_ptr ;
 
+        struct node_to_value_cast {
+            value_type * operator()( node_type * p ) const
+            {
+                return p ? &p->m_Value : null_ptr<value_type *>() ;
+            }
+        };
         //@endcond
 
+    public:
+        /// Guarded pointer to the map item, see \ref lower_bound and \ref upper_bound
+        typedef cds::gc::guarded_ptr< gc, node_type, value_type, node_to_value_cast > guarded_ptr ;
+
     protected:
         //@cond
         unsigned int random_level()
@@ -614,6 +628,249 @@ namespace cds { namespace container {
             return base_class::find_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor >() ) ;
         }
 
+        /// Finds the first item which key is not less than \p key
+        /** \anchor cds_nonintrusive_SkipListMap_hp_lower_bound
+            The function searches the first item which key is not less than \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if such item is found. If all items of the map are less
+            than \p key the function returns \p false and the \p ptr parameter is not changed.
+
+            The item stays guarded until \p ptr is released.
+            Use \ref range_cursor to iterate the items starting from the bound.
+        */
+        template <typename K>
+        bool lower_bound( guarded_ptr& ptr, K const& key )
+        {
+            return base_class::bound_( ptr.guard(), key, typename base_class::key_comparator() ) != null_ptr<node_type *>() ;
+        }
+
+        /// Finds the first item which key is not less than \p key using \p pred predicate
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListMap_hp_lower_bound "lower_bound( guarded_ptr& ptr, K const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool lower_bound_with( guarded_ptr& ptr, K const& key, Less pred )
+        {
+            return base_class::bound_( ptr.guard(), key,
+                cds::opt::details::make_comparator_from_less< cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor > >() ) != null_ptr<node_type *>() ;
+        }
+
+        /// Finds the first item which key is greater than \p key
+        /** \anchor cds_nonintrusive_SkipListMap_hp_upper_bound
+            The function searches the first item which key is greater than \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if such item is found. If no item is greater
+            than \p key the function returns \p false and the \p ptr parameter is not changed.
+        */
+        template <typename K>
+        bool upper_bound( guarded_ptr& ptr, K const& key )
+        {
+            return base_class::bound_( ptr.guard(), key,
+                intrusive::skip_list::details::upper_bound_comparator< typename base_class::key_comparator >() ) != null_ptr<node_type *>() ;
+        }
+
+        /// Finds the first item which key is greater than \p key using \p pred predicate
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListMap_hp_upper_bound "upper_bound( guarded_ptr& ptr, K const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        bool upper_bound_with( guarded_ptr& ptr, K const& key, Less pred )
+        {
+            return base_class::bound_( ptr.guard(), key,
+                intrusive::skip_list::details::upper_bound_comparator<
+                    cds::opt::details::make_comparator_from_less< cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor > >
+                >() ) != null_ptr<node_type *>() ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Finds the first item which key is not less than \p key and returns the guarded pointer to it
+        /**
+            The guarded pointer returned is empty if all items are less than \p key.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename K>
+        guarded_ptr lower_bound( K const& key )
+        {
+            guarded_ptr gp ;
+            lower_bound( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the first item which key is not less than \p key using \p pred predicate and returns the guarded pointer to it
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename K, typename Less>
+        guarded_ptr lower_bound_with( K const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            lower_bound_with( gp, key, pred ) ;
+            return gp ;
+        }
+
+        /// Finds the first item which key is greater than \p key and returns the guarded pointer to it
+        /**
+            The guarded pointer returned is empty if no item is greater than \p key.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename K>
+        guarded_ptr upper_bound( K const& key )
+        {
+            guarded_ptr gp ;
+            upper_bound( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the first item which key is greater than \p key using \p pred predicate and returns the guarded pointer to it
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename K, typename Less>
+        guarded_ptr upper_bound_with( K const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            upper_bound_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
+        /// Forward range cursor
+        /** \anchor cds_nonintrusive_SkipListMap_hp_range_cursor
+            The cursor traverses the map in key order and is safe under concurrent insertions and deletions.
+            The current item of the cursor is guarded, so it cannot be reclaimed while the cursor points to it.
+            When the current item is deleted by another thread, \ref next() searches the successor
+            of the current key from the head of the skip-list.
+            See \ref cds_intrusive_SkipListSet_hp_range_cursor "intrusive range_cursor" for details.
+
+            Usage (scan the keys in range <tt>[a, b)</tt>):
+            \code
+            typedef cds::container::SkipListMap< cds::gc::HP, int, foo, my_traits > skip_list ;
+            skip_list theMap ;
+            // ...
+            skip_list::range_cursor cur( theMap ) ;
+            for ( bool bOk = cur.lower_bound( a ); bOk && cur->first < b; bOk = cur.next() ) {
+                // Deal with *cur
+            }
+            \endcode
+
+            The cursor uses one GC's guard; \ref next() uses one more guard temporarily.
+            The cursor object should not be passed to another thread.
+        */
+        class range_cursor
+        {
+            //@cond
+            SkipListMap&    m_Set   ;
+            guarded_ptr     m_gp    ;
+            //@endcond
+
+        public:
+            /// Creates empty cursor for map \p s
+            explicit range_cursor( SkipListMap& s )
+                : m_Set( s )
+            {}
+
+            /// Positions the cursor to the first (minimal) item of the map
+            /**
+                Returns \p false if the map is empty; in this case the cursor becomes empty.
+            */
+            bool first()
+            {
+                return set( m_Set.base_class::bound_( m_gp.guard(), 0, intrusive::skip_list::details::first_node_comparator() ) != null_ptr<node_type *>() ) ;
+            }
+
+            /// Positions the cursor to the first item which key is not less than \p key
+            /**
+                Returns \p false if all items are less than \p key; in this case the cursor becomes empty.
+            */
+            template <typename K>
+            bool lower_bound( K const& key )
+            {
+                return set( m_Set.lower_bound( m_gp, key )) ;
+            }
+
+            /// Positions the cursor to the first item which key is not less than \p key using \p pred predicate
+            template <typename K, typename Less>
+            bool lower_bound_with( K const& key, Less pred )
+            {
+                return set( m_Set.lower_bound_with( m_gp, key, pred )) ;
+            }
+
+            /// Positions the cursor to the first item which key is greater than \p key
+            /**
+                Returns \p false if no item is greater than \p key; in this case the cursor becomes empty.
+            */
+            template <typename K>
+            bool upper_bound( K const& key )
+            {
+                return set( m_Set.upper_bound( m_gp, key )) ;
+            }
+
+            /// Positions the cursor to the first item which key is greater than \p key using \p pred predicate
+            template <typename K, typename Less>
+            bool upper_bound_with( K const& key, Less pred )
+            {
+                return set( m_Set.upper_bound_with( m_gp, key, pred )) ;
+            }
+
+            /// Moves the cursor to the next item
+            /**
+                The cursor must not be empty.
+                Returns \p false if the current item is the last one; in this case the cursor becomes empty.
+            */
+            bool next()
+            {
+                assert( !empty() ) ;
+                return set( m_Set.base_class::cursor_next_( m_gp.guard() ) != null_ptr<node_type *>() ) ;
+            }
+
+            /// Returns a pointer to the current item or \p NULL if the cursor is empty
+            value_type * get() const
+            {
+                return m_gp.get() ;
+            }
+
+            /// Returns a pointer to the current item
+            value_type * operator ->() const
+            {
+                return m_gp.get() ;
+            }
+
+            /// Returns a reference to the current item
+            value_type& operator *() const
+            {
+                return *m_gp ;
+            }
+
+            /// Checks if the cursor is empty
+            bool empty() const
+            {
+                return m_gp.empty() ;
+            }
+
+            /// Clears the cursor; the current item may be reclaimed after that
+            void release()
+            {
+                m_gp.release() ;
+            }
+
+        private:
+            //@cond
+            bool set( bool bFound )
+            {
+                if ( !bFound )
+                    m_gp.release() ;
+                return bFound ;
+            }
+
+            range_cursor( range_cursor const& ) CDS_DELETE_SPECIFIER ;
+            range_cursor& operator=( range_cursor const& ) CDS_DELETE_SPECIFIER ;
+            //@endcond
+        };
+
         /// Clears the map
         void clear()
         {
@@ -62,6 +62,9 @@ namespace cds { namespace container {
             user-provided one. See skip_list::random_level_generator option description for explanation.
             Default is \p %skip_list::turbo_pascal.
         - opt::allocator - allocator for skip-list node. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - skip_list::node_pool - the pool of released nodes. A node and its tower are allocated in single memory block
+            which size depends on the node height; skip_list::per_height_pool reuses the blocks released
+            instead of returning them to the allocator. Default is skip_list::no_node_pool.
         - opt::back_off - back-off strategy used. If the option is not specified, the cds::backoff::Default is used.
         - opt::stat - internal statistics. Available types: skip_list::stat, skip_list::empty_stat (the default)
         - opt::rcu_check_deadlock - a deadlock checking policy. Default is opt::v::rcu_throw_deadlock
@@ -156,6 +159,11 @@ namespace cds { namespace container {
 
         typedef std::unique_ptr< node_type, typename maker::node_deallocator >    scoped_node_ptr ;
 
+        static value_type * to_value_ptr( node_type * pNode )
+        {
+            return pNode ? &pNode->m_Value : null_ptr<value_type *>() ;
+        }
+
         //@endcond
 
     protected:
@@ -621,6 +629,182 @@ namespace cds { namespace container {
             return base_class::find_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor >() ) ;
         }
 
+        /// Finds the first item which key is not less than \p key
+        /** \anchor cds_nonintrusive_SkipListMap_rcu_lower_bound
+            The function searches the first item which key is not less than \p key
+            and returns the pointer to the item found.
+            If all items of the map are less than \p key the function returns \p NULL.
+
+            RCU should be locked before call the function.
+            Returned pointer is valid while RCU is locked.
+            Use \ref range_cursor to iterate the items starting from the bound.
+        */
+        template <typename K>
+        value_type * lower_bound( K const& key )
+        {
+            return to_value_ptr( base_class::lower_bound( key )) ;
+        }
+
+        /// Finds the first item which key is not less than \p key using \p pred predicate
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListMap_rcu_lower_bound "lower_bound(K const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        value_type * lower_bound_with( K const& key, Less pred )
+        {
+            return to_value_ptr( base_class::lower_bound_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor >() )) ;
+        }
+
+        /// Finds the first item which key is greater than \p key
+        /** \anchor cds_nonintrusive_SkipListMap_rcu_upper_bound
+            The function searches the first item which key is greater than \p key
+            and returns the pointer to the item found.
+            If no item is greater than \p key the function returns \p NULL.
+
+            RCU should be locked before call the function.
+            Returned pointer is valid while RCU is locked.
+        */
+        template <typename K>
+        value_type * upper_bound( K const& key )
+        {
+            return to_value_ptr( base_class::upper_bound( key )) ;
+        }
+
+        /// Finds the first item which key is greater than \p key using \p pred predicate
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListMap_rcu_upper_bound "upper_bound(K const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the map.
+        */
+        template <typename K, typename Less>
+        value_type * upper_bound_with( K const& key, Less pred )
+        {
+            return to_value_ptr( base_class::upper_bound_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor >() )) ;
+        }
+
+        /// Forward range cursor
+        /** \anchor cds_nonintrusive_SkipListMap_rcu_range_cursor
+            The cursor traverses the map in key order and is safe under concurrent insertions and deletions.
+            RCU should be locked while the cursor is used; the current item of the cursor is valid while RCU is locked.
+            When the current item is deleted by another thread, \ref next() searches the successor
+            of the current key from the head of the skip-list.
+            See \ref cds_intrusive_SkipListSet_rcu_range_cursor "intrusive range_cursor" for details.
+
+            Usage (scan the keys in range <tt>[a, b)</tt>):
+            \code
+            typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_type ;
+            typedef cds::container::SkipListMap< rcu_type, int, foo, my_traits > skip_list ;
+            skip_list theMap ;
+            // ...
+            {
+                rcu_type::scoped_lock sl ;
+                skip_list::range_cursor cur( theMap ) ;
+                for ( bool bOk = cur.lower_bound( a ); bOk && cur->first < b; bOk = cur.next() ) {
+                    // Deal with *cur
+                }
+            }
+            \endcode
+        */
+        class range_cursor
+        {
+            //@cond
+            typedef typename base_class::range_cursor   intrusive_cursor ;
+            intrusive_cursor    m_Cursor ;
+            //@endcond
+
+        public:
+            /// Creates empty cursor for map \p s
+            explicit range_cursor( SkipListMap& s )
+                : m_Cursor( s )
+            {}
+
+            /// Positions the cursor to the first (minimal) item of the map
+            /**
+                Returns \p false if the map is empty; in this case the cursor becomes empty.
+            */
+            bool first()
+            {
+                return m_Cursor.first() ;
+            }
+
+            /// Positions the cursor to the first item which key is not less than \p key
+            /**
+                Returns \p false if all items are less than \p key; in this case the cursor becomes empty.
+            */
+            template <typename K>
+            bool lower_bound( K const& key )
+            {
+                return m_Cursor.lower_bound( key ) ;
+            }
+
+            /// Positions the cursor to the first item which key is not less than \p key using \p pred predicate
+            template <typename K, typename Less>
+            bool lower_bound_with( K const& key, Less pred )
+            {
+                return m_Cursor.lower_bound_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor >() ) ;
+            }
+
+            /// Positions the cursor to the first item which key is greater than \p key
+            /**
+                Returns \p false if no item is greater than \p key; in this case the cursor becomes empty.
+            */
+            template <typename K>
+            bool upper_bound( K const& key )
+            {
+                return m_Cursor.upper_bound( key ) ;
+            }
+
+            /// Positions the cursor to the first item which key is greater than \p key using \p pred predicate
+            template <typename K, typename Less>
+            bool upper_bound_with( K const& key, Less pred )
+            {
+                return m_Cursor.upper_bound_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::key_accessor >() ) ;
+            }
+
+            /// Moves the cursor to the next item
+            /**
+                The cursor must not be empty.
+                Returns \p false if the current item is the last one; in this case the cursor becomes empty.
+            */
+            bool next()
+            {
+                return m_Cursor.next() ;
+            }
+
+            /// Returns a pointer to the current item or \p NULL if the cursor is empty
+            value_type * get() const
+            {
+                return to_value_ptr( m_Cursor.get() ) ;
+            }
+
+            /// Returns a pointer to the current item
+            value_type * operator ->() const
+            {
+                return get() ;
+            }
+
+            /// Returns a reference to the current item
+            value_type& operator *() const
+            {
+                assert( !empty() ) ;
+                return *get() ;
+            }
+
+            /// Checks if the cursor is empty
+            bool empty() const
+            {
+                return m_Cursor.empty() ;
+            }
+
+            /// Clears the cursor
+            void release()
+            {
+                m_Cursor.release() ;
+            }
+        };
+
         /// Clears the map
         void clear()
         {
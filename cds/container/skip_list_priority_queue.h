@@ -0,0 +1,327 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_SKIP_LIST_PRIORITY_QUEUE_H
+#define __CDS_CONTAINER_SKIP_LIST_PRIORITY_QUEUE_H
+
+#include <cds/container/skip_list_base.h>
+#include <cds/cxx11_atomic.h>
+#include <cds/os/timer.h>
+#include <cds/ref.h>
+
+namespace cds { namespace container {
+
+    /// SkipListPriorityQueue related definitions
+    /** @ingroup cds_nonintrusive_helper
+    */
+    namespace skip_list_priority_queue {
+
+        /// Strict pop mode
+        /**
+            \p pop() always extracts the item with minimal key.
+            All concurrent \p pop() calls compete for the first item of the skip-list.
+        */
+        struct strict
+        {
+            /// Returns the count of items to step over before extracting (always 0)
+            unsigned int operator()() const
+            {
+                return 0 ;
+            }
+        };
+
+        /// Relaxed pop mode
+        /**
+            \p pop() steps over a random count of items in range <tt>[0..SprayWidth)</tt>
+            from the head of the skip-list and extracts the item found.
+            Concurrent \p pop() calls are spread over the first \p SprayWidth items,
+            that decreases the contention on the head of the list under heavy load.
+            The price is that \p pop() can extract an item that is not minimal one
+            but one of \p SprayWidth minimal items.
+
+            This is a simplified version of the "spraying" approach described in
+            - [2015] D.Alistarh, J.Kopinsky, J.Li, N.Shavit "The SprayList: A Scalable Relaxed Priority Queue"
+        */
+        template <unsigned int SprayWidth = 16>
+        class relaxed
+        {
+            //@cond
+            CDS_ATOMIC::atomic<unsigned int>    m_nSeed ;
+            //@endcond
+
+        public:
+            static unsigned int const c_nSprayWidth = SprayWidth ;  ///< Spray width
+            static_assert( c_nSprayWidth > 0, "SprayWidth must be greater than 0" ) ;
+
+            /// Initializes the random generator
+            relaxed()
+            {
+                m_nSeed.store( (unsigned int) cds::OS::Timer::random_seed() | 1, CDS_ATOMIC::memory_order_relaxed ) ;
+            }
+
+            /// Returns the count of items to step over before extracting
+            unsigned int operator()()
+            {
+                // xorshift; data race on the seed is harmless here
+                unsigned int x = m_nSeed.load( CDS_ATOMIC::memory_order_relaxed ) ;
+                x ^= x << 13 ;
+                x ^= x >> 17 ;
+                x ^= x << 5  ;
+                m_nSeed.store( x, CDS_ATOMIC::memory_order_relaxed ) ;
+                return x % c_nSprayWidth ;
+            }
+        };
+
+        /// Option setter for pop mode
+        /**
+            Possible values are skip_list_priority_queue::strict (the default) and skip_list_priority_queue::relaxed
+        */
+        template <typename Type>
+        struct pop_mode {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                typedef Type pop_mode ;
+            };
+            //@endcond
+        };
+
+        /// Type traits for SkipListPriorityQueue class
+        /**
+            The traits extend skip_list::type_traits with \p pop_mode option.
+        */
+        struct type_traits: public skip_list::type_traits
+        {
+            /// Pop mode: skip_list_priority_queue::strict or skip_list_priority_queue::relaxed
+            typedef strict  pop_mode ;
+        };
+
+        /// Metafunction converting option list to SkipListPriorityQueue traits
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options list see \ref SkipListPriorityQueue.
+        */
+        template <CDS_DECL_OPTIONS10>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, CDS_OPTIONS10 >::type
+                ,CDS_OPTIONS10
+            >::type   type ;
+#   endif
+        };
+
+    } // namespace skip_list_priority_queue
+
+    /// Lock-free priority queue based on skip-list
+    /** @ingroup cds_nonintrusive_queue
+        The priority queue is a thin wrapper over \ref cds_nonintrusive_SkipListSet_hp "SkipListSet":
+        \p push() inserts the item into the skip-list, \p pop() extracts the item with minimal key.
+        To get max-priority queue specify reverse comparator, for example, <tt>std::greater<T></tt>.
+
+        Since the skip-list is a set, the queue cannot contain two items with equal keys:
+        \p push() returns \p false if an item with the same key is already in the queue.
+        If your priorities are not unique make the key composite, for example, <tt>(priority, task id)</tt>.
+
+        <b>Source</b>
+            - [2000] I.Lotan, N.Shavit "Skiplist-Based Concurrent Priority Queues"
+            - [2015] D.Alistarh, J.Kopinsky, J.Li, N.Shavit "The SprayList: A Scalable Relaxed Priority Queue"
+
+        <b>Template arguments</b>
+        - \p GC - Garbage collector used: gc::HP, gc::PTB or \ref cds_urcu_gc "RCU type"
+        - \p T - type to be stored in the queue
+        - \p Traits - type traits. See skip_list_priority_queue::type_traits for explanation.
+
+        It is possible to declare option-based queue with skip_list_priority_queue::make_traits metafunction
+        instead of \p Traits template argument. In addition to \ref cds_nonintrusive_SkipListSet_hp "SkipListSet" options
+        the following option is supported:
+        - skip_list_priority_queue::pop_mode - pop mode: skip_list_priority_queue::strict (the default)
+            or skip_list_priority_queue::relaxed
+
+        \note Before including <tt><cds/container/skip_list_priority_queue.h></tt> you should include
+        the header of \p SkipListSet for the garbage collector you use:
+        - <tt><cds/container/skip_list_set_hp.h></tt> for gc::HP
+        - <tt><cds/container/skip_list_set_ptb.h></tt> for gc::PTB
+        - <tt><cds/container/skip_list_set_rcu.h></tt> for \ref cds_urcu_gc "RCU type".
+            For RCU-based queue \p push() and \p pop() must be called outside of RCU lock.
+
+        Example:
+        \code
+        #include <cds/container/skip_list_set_hp.h>
+        #include <cds/container/skip_list_priority_queue.h>
+
+        struct task {
+            unsigned int    nPriority ;
+            unsigned int    nId ;
+            // ...
+        };
+        struct task_less {
+            bool operator()( task const& t1, task const& t2 ) const
+            {
+                return t1.nPriority < t2.nPriority || (t1.nPriority == t2.nPriority && t1.nId < t2.nId) ;
+            }
+        };
+
+        typedef cds::container::SkipListPriorityQueue< cds::gc::HP, task,
+            cds::container::skip_list_priority_queue::make_traits<
+                cds::opt::less< task_less >
+                ,cds::container::skip_list_priority_queue::pop_mode< cds::container::skip_list_priority_queue::relaxed<> >
+            >::type
+        > task_queue ;
+        \endcode
+    */
+    template <
+        class GC,
+        typename T,
+        typename Traits = skip_list_priority_queue::type_traits
+    >
+    class SkipListPriorityQueue:
+        protected SkipListSet< GC, T, Traits >
+    {
+        //@cond
+        typedef SkipListSet< GC, T, Traits >    base_class ;
+        //@endcond
+
+    public:
+        typedef typename base_class::gc             gc          ;   ///< Garbage collector used
+        typedef T                                   value_type  ;   ///< type of value stored in the queue
+        typedef Traits                              options     ;   ///< Options specified
+
+        typedef typename base_class::key_comparator key_comparator  ;   ///< key comparison functor
+        typedef typename base_class::item_counter   item_counter    ;   ///< Item counting policy used
+        typedef typename base_class::stat           stat            ;   ///< internal statistics type
+        typedef typename options::pop_mode          pop_mode        ;   ///< Pop mode
+
+    protected:
+        //@cond
+        pop_mode    m_PopMode   ;
+
+#   ifndef CDS_CXX11_LAMBDA_SUPPORT
+        struct assign_functor
+        {
+            value_type& m_dest ;
+
+            assign_functor( value_type& dest )
+                : m_dest( dest )
+            {}
+
+            void operator()( value_type& item )
+            {
+                m_dest = item ;
+            }
+        };
+#   endif
+        //@endcond
+
+    public:
+        /// Default ctor
+        SkipListPriorityQueue()
+        {}
+
+        /// Destructor destroys the queue object
+        ~SkipListPriorityQueue()
+        {}
+
+        /// Inserts new item \p val into the queue
+        /**
+            Returns \p false if an item with the same key is already in the queue.
+        */
+        bool push( value_type const& val )
+        {
+            return base_class::insert( val ) ;
+        }
+
+#   ifdef CDS_EMPLACE_SUPPORT
+        /// Inserts new item constructed in-place from \p args
+        /**
+            Returns \p false if an item with the same key is already in the queue.
+
+            This function is available only for compiler that supports
+            variadic template and move semantics
+        */
+        template <typename... Args>
+        bool emplace( Args&&... args )
+        {
+            return base_class::emplace( std::forward<Args>(args)... ) ;
+        }
+#   endif
+
+        /// Extracts the item with minimal key from the queue
+        /**
+            The item extracted is copied to \p dest.
+            In relaxed mode the item extracted is one of \p SprayWidth minimal items.
+            Returns \p false if the queue is empty.
+        */
+        bool pop( value_type& dest )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return pop_with( [&dest]( value_type& item ) { dest = item ; } ) ;
+#       else
+            return pop_with( assign_functor( dest )) ;
+#       endif
+        }
+
+        /// Extracts the item with minimal key from the queue and calls \p f for it
+        /**
+            The functor \p Func interface:
+            \code
+            struct functor {
+                void operator()( value_type& item ) ;
+            };
+            \endcode
+            The functor may be passed by reference using <tt>boost:ref</tt>.
+
+            The functor is called when the item has been logically deleted, so no other thread
+            can pop the same item. The functor can move the non-key fields of the item out
+            but it must not change the key since concurrent searching can still read it.
+
+            Returns \p false if the queue is empty.
+        */
+        template <typename Func>
+        bool pop_with( Func f )
+        {
+            return base_class::extract_min_( f, m_PopMode() ) ;
+        }
+
+        /// Checks if the queue is empty
+        bool empty() const
+        {
+            return base_class::empty() ;
+        }
+
+        /// Returns item count in the queue
+        /**
+            The value returned depends on item counter type provided by \p Traits template parameter.
+            If it is atomicity::empty_item_counter this function always returns 0.
+        */
+        size_t size() const
+        {
+            return base_class::size() ;
+        }
+
+        /// Clears the queue (non-atomic)
+        void clear()
+        {
+            base_class::clear() ;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return base_class::statistics() ;
+        }
+    };
+
+}} // namespace cds::container
+
+#endif // #ifndef __CDS_CONTAINER_SKIP_LIST_PRIORITY_QUEUE_H
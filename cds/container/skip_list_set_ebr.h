@@ -0,0 +1,20 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_SKIP_LIST_MAP_EBR_H
+#define __CDS_CONTAINER_SKIP_LIST_MAP_EBR_H
+
+#include <cds/container/skip_list_base.h>
+#include <cds/intrusive/skip_list_ebr.h>
+#include <cds/container/details/make_skip_list_set.h>
+#include <cds/container/skip_list_set_impl.h>
+
+#endif  // #ifndef __CDS_CONTAINER_SKIP_LIST_MAP_EBR_H
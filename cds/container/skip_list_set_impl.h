@@ -13,6 +13,7 @@
 #define __CDS_CONTAINER_SKIP_LIST_SET_IMPL_H
 
 #include <cds/details/binary_functor_wrapper.h>
+#include <cds/gc/guarded_ptr.h>
 
 namespace cds { namespace container {
 
@@ -58,6 +59,9 @@ namespace cds { namespace container {
             user-provided one. See skip_list::random_level_generator option description for explanation.
             Default is \p %skip_list::turbo_pascal.
         - opt::allocator - allocator for skip-list node. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - skip_list::node_pool - the pool of released nodes. A node and its tower are allocated in single memory block
+            which size depends on the node height; skip_list::per_height_pool reuses the blocks released
+            instead of returning them to the allocator. Default is skip_list::no_node_pool.
         - opt::back_off - back-off strategy used. If the option is not specified, the cds::backoff::Default is used.
         - opt::stat - internal statistics. Available types: skip_list::stat, skip_list::empty_stat (the default)
 
@@ -155,8 +159,18 @@ namespace cds { namespace container {
 
         typedef std::unique_ptr< node_type, typename maker::node_deallocator >    scoped_node_ptr ;
 
+        struct node_to_value_cast {
+            value_type * operator()( node_type * p ) const
+            {
+                return p ? &p->m_Value : null_ptr<value_type *>() ;
+            }
+        };
         //@endcond
 
+    public:
+        /// Guarded pointer to the set item, see \ref get and \ref extract
+        typedef cds::gc::guarded_ptr< gc, node_type, value_type, node_to_value_cast > guarded_ptr ;
+
     protected:
         //@cond
         unsigned int random_level()
@@ -230,8 +244,47 @@ namespace cds { namespace container {
                 cds::unref(m_func)( node.m_Value )  ;
             }
         };
+
+        template <typename Func>
+        struct extract_functor
+        {
+            Func        m_func  ;
+
+            extract_functor( Func f )
+                : m_func(f)
+            {}
+
+            void operator()( node_type& node )
+            {
+                cds::unref(m_func)( node.m_Value )  ;
+            }
+        };
 #   endif  // ifndef CDS_CXX11_LAMBDA_SUPPORT
 
+        // Extracts the item with minimal key (or nearly minimal if nSkip > 0) and calls f( value_type& ) for it
+        template <typename Func>
+        bool extract_min_( Func f, unsigned int nSkip )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::extract_min_( [&f]( node_type& node ) { cds::unref(f)( node.m_Value ); }, nSkip ) ;
+#       else
+            extract_functor<Func> wrapper(f) ;
+            return base_class::extract_min_( cds::ref(wrapper), nSkip ) ;
+#       endif
+        }
+
+        // Extracts the item with maximal key and calls f( value_type& ) for it
+        template <typename Func>
+        bool extract_max_( Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::extract_max_( [&f]( node_type& node ) { cds::unref(f)( node.m_Value ); } ) ;
+#       else
+            extract_functor<Func> wrapper(f) ;
+            return base_class::extract_max_( cds::ref(wrapper) ) ;
+#       endif
+        }
+
         //@endcond
 
     public:
@@ -343,6 +396,50 @@ namespace cds { namespace container {
             return false ;
         }
 
+        /// Insert hint (finger) for the sequence of inserting, see \ref cds::intrusive::SkipListSet::insert_hint
+        typedef typename base_class::insert_hint    insert_hint ;
+
+        /// Inserts new node using the insert hint
+        /**
+            The function is the same as \ref insert( Q const& ) but the search of
+            the insert position begins from the position stored in \p hint by previous call.
+            The hint should not be shared between threads.
+
+            Returns \p true if \p val is inserted into the set, \p false otherwise.
+        */
+        template <typename Q>
+        bool insert( insert_hint& hint, Q const& val )
+        {
+            scoped_node_ptr sp( node_allocator().New( random_level(), val )) ;
+            if ( base_class::insert( hint, *sp.get() )) {
+                sp.release()    ;
+                return true     ;
+            }
+            return false ;
+        }
+
+        /// Inserts the sequence of values
+        /**
+            The function inserts the copies of values from the range [\p first, \p last) in the set.
+            Each insert continues the search from the position of the previous item,
+            so the function is intended for the ranges sorted in ascending order of keys (or nearly sorted).
+
+            The object of \ref value_type should be constructible from <tt>*first</tt>.
+
+            Returns the number of items inserted.
+        */
+        template <typename Iterator>
+        size_t insert_sorted( Iterator first, Iterator last )
+        {
+            insert_hint hint ;
+            size_t nCount = 0 ;
+            for ( ; first != last; ++first ) {
+                if ( insert( hint, *first ))
+                    ++nCount ;
+            }
+            return nCount ;
+        }
+
         /// Ensures that the item exists in the set
         /**
             The operation performs inserting or changing data with lock-free manner.
@@ -491,6 +588,149 @@ namespace cds { namespace container {
 #       endif
         }
 
+        /// Extracts the item from the set with specified \p key
+        /** \anchor cds_nonintrusive_SkipListSet_hp_extract
+            The function searches an item with key equal to \p key,
+            unlinks it from the set, and returns it in \p dest parameter.
+            If the item with key equal to \p key is not found the function returns \p false.
+
+            The value is not copied: \p dest points to the value stored in the set.
+            The node is freed by garbage collector \p GC when returned \ref guarded_ptr object
+            will be destroyed or released.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+
+            Usage:
+            \code
+            typedef cds::container::SkipListSet< cds::gc::HP, foo, my_traits > skip_list ;
+            skip_list theSet ;
+            // ...
+            {
+                skip_list::guarded_ptr gp ;
+                if ( theSet.extract( gp, 5 )) {
+                    // Deal with gp
+                    // ...
+                }
+                // Destructor of gp releases internal HP guard
+            }
+            \endcode
+        */
+        template <typename Q>
+        bool extract( guarded_ptr& dest, Q const& key )
+        {
+            return base_class::extract_( dest.guard(), key, typename base_class::key_comparator() ) ;
+        }
+
+        /// Extracts the item from the set using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_hp_extract "extract(guarded_ptr&, Q const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool extract_with( guarded_ptr& dest, Q const& key, Less pred )
+        {
+            return base_class::extract_( dest.guard(), key, cds::opt::details::make_comparator_from_less< cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor > >() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Extracts the item with specified \p key and returns the guarded pointer to it
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_hp_extract "extract(guarded_ptr&, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr extract( Q const& key )
+        {
+            guarded_ptr gp ;
+            extract( gp, key ) ;
+            return gp ;
+        }
+
+        /// Extracts the item using \p pred predicate and returns the guarded pointer to it
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr extract_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            extract_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
+        /// Extracts an item with minimal key from the set
+        /** \anchor cds_nonintrusive_SkipListSet_hp_extract_min
+            The function searches an item with minimal key, unlinks it from the set, and returns it in \p dest parameter.
+            If the skip-list is empty the function returns \p false.
+
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+
+            Usage:
+            \code
+            typedef cds::container::SkipListSet< cds::gc::HP, foo, my_traits >  skip_list ;
+            skip_list theList ;
+            // ...
+            {
+                skip_list::guarded_ptr gp ;
+                if ( theList.extract_min( gp )) {
+                    // Deal with gp
+                    //...
+                }
+                // Destructor of gp releases internal HP guard and frees the item
+            }
+            \endcode
+        */
+        bool extract_min( guarded_ptr& dest )
+        {
+            return base_class::extract_min_( typename base_class::guard_assign_functor( dest.guard() ), 0 ) ;
+        }
+
+        /// Extracts an item with maximal key from the set
+        /** \anchor cds_nonintrusive_SkipListSet_hp_extract_max
+            The function searches an item with maximal key, unlinks it from the set, and returns it in \p dest parameter.
+            If the skip-list is empty the function returns \p false.
+
+            The search of the last item passes over the whole height of the skip-list,
+            so the function is slightly slower than \ref cds_nonintrusive_SkipListSet_hp_extract_min "extract_min".
+
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+        */
+        bool extract_max( guarded_ptr& dest )
+        {
+            return base_class::extract_max_( typename base_class::guard_assign_functor( dest.guard() )) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Extracts an item with minimal key and returns the guarded pointer to it
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_hp_extract_min "extract_min(guarded_ptr&)".
+            The guarded pointer returned is empty if the set is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        guarded_ptr extract_min()
+        {
+            guarded_ptr gp ;
+            extract_min( gp ) ;
+            return gp ;
+        }
+
+        /// Extracts an item with maximal key and returns the guarded pointer to it
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_hp_extract_max "extract_max(guarded_ptr&)".
+            The guarded pointer returned is empty if the set is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        guarded_ptr extract_max()
+        {
+            guarded_ptr gp ;
+            extract_max( gp ) ;
+            return gp ;
+        }
+#   endif
+
         /// Find the key \p val
         /** \anchor cds_nonintrusive_SkipListSet_find_func
 
@@ -631,6 +871,308 @@ namespace cds { namespace container {
             return base_class::find_with( val, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >());
         }
 
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /** \anchor cds_nonintrusive_SkipListSet_hp_get
+            The function searches the item with key equal to \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if \p key is found, and \p false otherwise.
+            If \p key is not found the \p ptr parameter is not changed.
+
+            Unlike \p find() the value is not copied and no functor is called: \p ptr points to the value
+            stored in the set, the guard prevents the item from being freed while \p ptr is alive.
+            The function does not serialize simultaneous access to the item found.
+            @note Each \p guarded_ptr object uses one GC's guard which can be limited resource.
+        */
+        template <typename Q>
+        bool get( guarded_ptr& ptr, Q const& key )
+        {
+            return base_class::get_with_( ptr.guard(), key, typename base_class::key_comparator() ) ;
+        }
+
+        /// Finds the key \p key and returns the guarded pointer to the item found using \p pred predicate
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_hp_get "get( guarded_ptr& ptr, Q const&)"
+            but \p pred is used for comparing the keys.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool get_with( guarded_ptr& ptr, Q const& key, Less pred )
+        {
+            return base_class::get_with_( ptr.guard(), key, cds::opt::details::make_comparator_from_less< cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor > >() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_hp_get "get( guarded_ptr& ptr, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr get( Q const& key )
+        {
+            guarded_ptr gp ;
+            get( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the key \p key using \p pred predicate and returns the guarded pointer to the item found
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr get_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            get_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
+        /// Finds the first item which key is not less than \p key
+        /** \anchor cds_nonintrusive_SkipListSet_hp_lower_bound
+            The function searches the first item which key is not less than \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if such item is found. If all items of the set are less
+            than \p key the function returns \p false and the \p ptr parameter is not changed.
+
+            The item stays guarded until \p ptr is released.
+            Use \ref range_cursor to iterate the items starting from the bound.
+        */
+        template <typename K>
+        bool lower_bound( guarded_ptr& ptr, K const& key )
+        {
+            return base_class::bound_( ptr.guard(), key, typename base_class::key_comparator() ) != null_ptr<node_type *>() ;
+        }
+
+        /// Finds the first item which key is not less than \p key using \p pred predicate
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_hp_lower_bound "lower_bound( guarded_ptr& ptr, K const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename K, typename Less>
+        bool lower_bound_with( guarded_ptr& ptr, K const& key, Less pred )
+        {
+            return base_class::bound_( ptr.guard(), key,
+                cds::opt::details::make_comparator_from_less< cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor > >() ) != null_ptr<node_type *>() ;
+        }
+
+        /// Finds the first item which key is greater than \p key
+        /** \anchor cds_nonintrusive_SkipListSet_hp_upper_bound
+            The function searches the first item which key is greater than \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if such item is found. If no item is greater
+            than \p key the function returns \p false and the \p ptr parameter is not changed.
+        */
+        template <typename K>
+        bool upper_bound( guarded_ptr& ptr, K const& key )
+        {
+            return base_class::bound_( ptr.guard(), key,
+                intrusive::skip_list::details::upper_bound_comparator< typename base_class::key_comparator >() ) != null_ptr<node_type *>() ;
+        }
+
+        /// Finds the first item which key is greater than \p key using \p pred predicate
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_hp_upper_bound "upper_bound( guarded_ptr& ptr, K const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename K, typename Less>
+        bool upper_bound_with( guarded_ptr& ptr, K const& key, Less pred )
+        {
+            return base_class::bound_( ptr.guard(), key,
+                intrusive::skip_list::details::upper_bound_comparator<
+                    cds::opt::details::make_comparator_from_less< cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor > >
+                >() ) != null_ptr<node_type *>() ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Finds the first item which key is not less than \p key and returns the guarded pointer to it
+        /**
+            The guarded pointer returned is empty if all items are less than \p key.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename K>
+        guarded_ptr lower_bound( K const& key )
+        {
+            guarded_ptr gp ;
+            lower_bound( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the first item which key is not less than \p key using \p pred predicate and returns the guarded pointer to it
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename K, typename Less>
+        guarded_ptr lower_bound_with( K const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            lower_bound_with( gp, key, pred ) ;
+            return gp ;
+        }
+
+        /// Finds the first item which key is greater than \p key and returns the guarded pointer to it
+        /**
+            The guarded pointer returned is empty if no item is greater than \p key.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename K>
+        guarded_ptr upper_bound( K const& key )
+        {
+            guarded_ptr gp ;
+            upper_bound( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the first item which key is greater than \p key using \p pred predicate and returns the guarded pointer to it
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename K, typename Less>
+        guarded_ptr upper_bound_with( K const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            upper_bound_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
+        /// Forward range cursor
+        /** \anchor cds_nonintrusive_SkipListSet_hp_range_cursor
+            The cursor traverses the set in key order and is safe under concurrent insertions and deletions.
+            The current item of the cursor is guarded, so it cannot be reclaimed while the cursor points to it.
+            When the current item is deleted by another thread, \ref next() searches the successor
+            of the current key from the head of the skip-list.
+            See \ref cds_intrusive_SkipListSet_hp_range_cursor "intrusive range_cursor" for details.
+
+            Usage (scan the keys in range <tt>[a, b)</tt>):
+            \code
+            typedef cds::container::SkipListSet< cds::gc::HP, foo, my_traits > skip_list ;
+            skip_list theSet ;
+            // ...
+            skip_list::range_cursor cur( theSet ) ;
+            for ( bool bOk = cur.lower_bound( a ); bOk && cur->key() < b; bOk = cur.next() ) {
+                // Deal with *cur
+            }
+            \endcode
+
+            The cursor uses one GC's guard; \ref next() uses one more guard temporarily.
+            The cursor object should not be passed to another thread.
+        */
+        class range_cursor
+        {
+            //@cond
+            SkipListSet&    m_Set   ;
+            guarded_ptr     m_gp    ;
+            //@endcond
+
+        public:
+            /// Creates empty cursor for set \p s
+            explicit range_cursor( SkipListSet& s )
+                : m_Set( s )
+            {}
+
+            /// Positions the cursor to the first (minimal) item of the set
+            /**
+                Returns \p false if the set is empty; in this case the cursor becomes empty.
+            */
+            bool first()
+            {
+                return set( m_Set.base_class::bound_( m_gp.guard(), 0, intrusive::skip_list::details::first_node_comparator() ) != null_ptr<node_type *>() ) ;
+            }
+
+            /// Positions the cursor to the first item which key is not less than \p key
+            /**
+                Returns \p false if all items are less than \p key; in this case the cursor becomes empty.
+            */
+            template <typename K>
+            bool lower_bound( K const& key )
+            {
+                return set( m_Set.lower_bound( m_gp, key )) ;
+            }
+
+            /// Positions the cursor to the first item which key is not less than \p key using \p pred predicate
+            template <typename K, typename Less>
+            bool lower_bound_with( K const& key, Less pred )
+            {
+                return set( m_Set.lower_bound_with( m_gp, key, pred )) ;
+            }
+
+            /// Positions the cursor to the first item which key is greater than \p key
+            /**
+                Returns \p false if no item is greater than \p key; in this case the cursor becomes empty.
+            */
+            template <typename K>
+            bool upper_bound( K const& key )
+            {
+                return set( m_Set.upper_bound( m_gp, key )) ;
+            }
+
+            /// Positions the cursor to the first item which key is greater than \p key using \p pred predicate
+            template <typename K, typename Less>
+            bool upper_bound_with( K const& key, Less pred )
+            {
+                return set( m_Set.upper_bound_with( m_gp, key, pred )) ;
+            }
+
+            /// Moves the cursor to the next item
+            /**
+                The cursor must not be empty.
+                Returns \p false if the current item is the last one; in this case the cursor becomes empty.
+            */
+            bool next()
+            {
+                assert( !empty() ) ;
+                return set( m_Set.base_class::cursor_next_( m_gp.guard() ) != null_ptr<node_type *>() ) ;
+            }
+
+            /// Returns a pointer to the current item or \p NULL if the cursor is empty
+            value_type * get() const
+            {
+                return m_gp.get() ;
+            }
+
+            /// Returns a pointer to the current item
+            value_type * operator ->() const
+            {
+                return m_gp.get() ;
+            }
+
+            /// Returns a reference to the current item
+            value_type& operator *() const
+            {
+                return *m_gp ;
+            }
+
+            /// Checks if the cursor is empty
+            bool empty() const
+            {
+                return m_gp.empty() ;
+            }
+
+            /// Clears the cursor; the current item may be reclaimed after that
+            void release()
+            {
+                m_gp.release() ;
+            }
+
+        private:
+            //@cond
+            bool set( bool bFound )
+            {
+                if ( !bFound )
+                    m_gp.release() ;
+                return bFound ;
+            }
+
+            range_cursor( range_cursor const& ) CDS_DELETE_SPECIFIER ;
+            range_cursor& operator=( range_cursor const& ) CDS_DELETE_SPECIFIER ;
+            //@endcond
+        };
+
         /// Clears the set (non-atomic).
         /**
             The function deletes all items from the set.
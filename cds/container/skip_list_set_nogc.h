@@ -134,6 +134,9 @@ namespace cds { namespace container {
             user-provided one. See skip_list::random_level_generator option description for explanation.
             Default is \p %skip_list::turbo_pascal.
         - opt::allocator - allocator for skip-list node. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - skip_list::node_pool - the pool of released nodes. A node and its tower are allocated in single memory block
+            which size depends on the node height; skip_list::per_height_pool reuses the blocks released
+            instead of returning them to the allocator. Default is skip_list::no_node_pool.
         - opt::back_off - back-off strategy used. If the option is not specified, the cds::backoff::Default is used.
         - opt::stat - internal statistics. Available types: skip_list::stat, skip_list::empty_stat (the default)
     */
@@ -59,6 +59,9 @@ namespace cds { namespace container {
             user-provided one. See skip_list::random_level_generator option description for explanation.
             Default is \p %skip_list::turbo_pascal.
         - opt::allocator - allocator for skip-list node. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - skip_list::node_pool - the pool of released nodes. A node and its tower are allocated in single memory block
+            which size depends on the node height; skip_list::per_height_pool reuses the blocks released
+            instead of returning them to the allocator. Default is skip_list::no_node_pool.
         - opt::back_off - back-off strategy used. If the option is not specified, the cds::backoff::Default is used.
         - opt::stat - internal statistics. Available types: skip_list::stat, skip_list::empty_stat (the default)
         - opt::rcu_check_deadlock - a deadlock checking policy. Default is opt::v::rcu_throw_deadlock
@@ -187,6 +190,11 @@ namespace cds { namespace container {
 
         typedef std::unique_ptr< node_type, typename maker::node_deallocator >    scoped_node_ptr ;
 
+        static value_type * to_value_ptr( node_type * pNode )
+        {
+            return pNode ? &pNode->m_Value : null_ptr<value_type *>() ;
+        }
+
         //@endcond
 
     protected:
@@ -262,8 +270,47 @@ namespace cds { namespace container {
                 cds::unref(m_func)( node.m_Value )  ;
             }
         };
+
+        template <typename Func>
+        struct extract_functor
+        {
+            Func        m_func  ;
+
+            extract_functor( Func f )
+                : m_func(f)
+            {}
+
+            void operator()( node_type& node )
+            {
+                cds::unref(m_func)( node.m_Value )  ;
+            }
+        };
 #   endif  // ifndef CDS_CXX11_LAMBDA_SUPPORT
 
+        // Extracts the item with minimal key (or nearly minimal if nSkip > 0) and calls f( value_type& ) for it
+        template <typename Func>
+        bool extract_min_( Func f, unsigned int nSkip )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::extract_min_( [&f]( node_type& node ) { cds::unref(f)( node.m_Value ); }, nSkip ) ;
+#       else
+            extract_functor<Func> wrapper(f) ;
+            return base_class::extract_min_( cds::ref(wrapper), nSkip ) ;
+#       endif
+        }
+
+        // Extracts the item with maximal key and calls f( value_type& ) for it
+        template <typename Func>
+        bool extract_max_( Func f )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return base_class::extract_max_( [&f]( node_type& node ) { cds::unref(f)( node.m_Value ); } ) ;
+#       else
+            extract_functor<Func> wrapper(f) ;
+            return base_class::extract_max_( cds::ref(wrapper) ) ;
+#       endif
+        }
+
         //@endcond
 
     public:
@@ -534,6 +581,47 @@ namespace cds { namespace container {
 #       endif
         }
 
+        /// Extracts an item with minimal key from the set
+        /** \anchor cds_nonintrusive_SkipListSet_rcu_extract_min
+            The function searches an item with minimal key, unlinks it from the set
+            and calls \p f functor for the item unlinked.
+
+            The functor \p Func interface:
+            \code
+            struct extractor {
+                void operator()( value_type& val ) ;
+            };
+            \endcode
+            The functor may be passed by reference using <tt>boost:ref</tt>
+
+            The functor is called under RCU lock when the item has been logically deleted, so no other thread
+            can extract the same item. The functor may copy the item or move its non-key fields out;
+            the key must not be changed since concurrent searching can still read it.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+
+            If the skip-list is empty the function returns \p false.
+        */
+        template <typename Func>
+        bool extract_min( Func f )
+        {
+            return extract_min_( f, 0 ) ;
+        }
+
+        /// Extracts an item with maximal key from the set
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_rcu_extract_min "extract_min(Func)"
+            for the item with maximal key. The search of the last item passes over the whole height of the skip-list,
+            so the function is slightly slower than \p extract_min.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        template <typename Func>
+        bool extract_max( Func f )
+        {
+            return extract_max_( f ) ;
+        }
+
         /// Find the key \p val
         /**
             @anchor cds_nonintrusive_SkipListSet_rcu_find_func
@@ -682,6 +770,182 @@ namespace cds { namespace container {
             return base_class::find_with( val, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >()) ;
         }
 
+        /// Finds the first item which key is not less than \p key
+        /** \anchor cds_nonintrusive_SkipListSet_rcu_lower_bound
+            The function searches the first item which key is not less than \p key
+            and returns the pointer to the item found.
+            If all items of the set are less than \p key the function returns \p NULL.
+
+            RCU should be locked before call the function.
+            Returned pointer is valid while RCU is locked.
+            Use \ref range_cursor to iterate the items starting from the bound.
+        */
+        template <typename K>
+        value_type * lower_bound( K const& key )
+        {
+            return to_value_ptr( base_class::lower_bound( key )) ;
+        }
+
+        /// Finds the first item which key is not less than \p key using \p pred predicate
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_rcu_lower_bound "lower_bound(K const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename K, typename Less>
+        value_type * lower_bound_with( K const& key, Less pred )
+        {
+            return to_value_ptr( base_class::lower_bound_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >() )) ;
+        }
+
+        /// Finds the first item which key is greater than \p key
+        /** \anchor cds_nonintrusive_SkipListSet_rcu_upper_bound
+            The function searches the first item which key is greater than \p key
+            and returns the pointer to the item found.
+            If no item is greater than \p key the function returns \p NULL.
+
+            RCU should be locked before call the function.
+            Returned pointer is valid while RCU is locked.
+        */
+        template <typename K>
+        value_type * upper_bound( K const& key )
+        {
+            return to_value_ptr( base_class::upper_bound( key )) ;
+        }
+
+        /// Finds the first item which key is greater than \p key using \p pred predicate
+        /**
+            The function is an analog of \ref cds_nonintrusive_SkipListSet_rcu_upper_bound "upper_bound(K const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename K, typename Less>
+        value_type * upper_bound_with( K const& key, Less pred )
+        {
+            return to_value_ptr( base_class::upper_bound_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >() )) ;
+        }
+
+        /// Forward range cursor
+        /** \anchor cds_nonintrusive_SkipListSet_rcu_range_cursor
+            The cursor traverses the set in key order and is safe under concurrent insertions and deletions.
+            RCU should be locked while the cursor is used; the current item of the cursor is valid while RCU is locked.
+            When the current item is deleted by another thread, \ref next() searches the successor
+            of the current key from the head of the skip-list.
+            See \ref cds_intrusive_SkipListSet_rcu_range_cursor "intrusive range_cursor" for details.
+
+            Usage (scan the keys in range <tt>[a, b)</tt>):
+            \code
+            typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_type ;
+            typedef cds::container::SkipListSet< rcu_type, foo, my_traits > skip_list ;
+            skip_list theSet ;
+            // ...
+            {
+                rcu_type::scoped_lock sl ;
+                skip_list::range_cursor cur( theSet ) ;
+                for ( bool bOk = cur.lower_bound( a ); bOk && cur->key() < b; bOk = cur.next() ) {
+                    // Deal with *cur
+                }
+            }
+            \endcode
+        */
+        class range_cursor
+        {
+            //@cond
+            typedef typename base_class::range_cursor   intrusive_cursor ;
+            intrusive_cursor    m_Cursor ;
+            //@endcond
+
+        public:
+            /// Creates empty cursor for set \p s
+            explicit range_cursor( SkipListSet& s )
+                : m_Cursor( s )
+            {}
+
+            /// Positions the cursor to the first (minimal) item of the set
+            /**
+                Returns \p false if the set is empty; in this case the cursor becomes empty.
+            */
+            bool first()
+            {
+                return m_Cursor.first() ;
+            }
+
+            /// Positions the cursor to the first item which key is not less than \p key
+            /**
+                Returns \p false if all items are less than \p key; in this case the cursor becomes empty.
+            */
+            template <typename K>
+            bool lower_bound( K const& key )
+            {
+                return m_Cursor.lower_bound( key ) ;
+            }
+
+            /// Positions the cursor to the first item which key is not less than \p key using \p pred predicate
+            template <typename K, typename Less>
+            bool lower_bound_with( K const& key, Less pred )
+            {
+                return m_Cursor.lower_bound_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >() ) ;
+            }
+
+            /// Positions the cursor to the first item which key is greater than \p key
+            /**
+                Returns \p false if no item is greater than \p key; in this case the cursor becomes empty.
+            */
+            template <typename K>
+            bool upper_bound( K const& key )
+            {
+                return m_Cursor.upper_bound( key ) ;
+            }
+
+            /// Positions the cursor to the first item which key is greater than \p key using \p pred predicate
+            template <typename K, typename Less>
+            bool upper_bound_with( K const& key, Less pred )
+            {
+                return m_Cursor.upper_bound_with( key, cds::details::predicate_wrapper< node_type, Less, typename maker::value_accessor >() ) ;
+            }
+
+            /// Moves the cursor to the next item
+            /**
+                The cursor must not be empty.
+                Returns \p false if the current item is the last one; in this case the cursor becomes empty.
+            */
+            bool next()
+            {
+                return m_Cursor.next() ;
+            }
+
+            /// Returns a pointer to the current item or \p NULL if the cursor is empty
+            value_type * get() const
+            {
+                return to_value_ptr( m_Cursor.get() ) ;
+            }
+
+            /// Returns a pointer to the current item
+            value_type * operator ->() const
+            {
+                return get() ;
+            }
+
+            /// Returns a reference to the current item
+            value_type& operator *() const
+            {
+                assert( !empty() ) ;
+                return *get() ;
+            }
+
+            /// Checks if the cursor is empty
+            bool empty() const
+            {
+                return m_Cursor.empty() ;
+            }
+
+            /// Clears the cursor
+            void release()
+            {
+                m_Cursor.release() ;
+            }
+        };
+
         /// Clears the set (non-atomic).
         /**
             The function deletes all items from the set.
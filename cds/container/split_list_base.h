@@ -24,6 +24,7 @@ namespace cds { namespace container {
     */
     namespace split_list {
         using intrusive::split_list::dynamic_bucket_table   ;
+        using intrusive::split_list::shrink_factor          ;
 
         //@cond
         namespace details {
@@ -559,6 +559,12 @@ namespace cds { namespace container {
         {
             return base_class::size() ;
         }
+
+        /// Returns current bucket count
+        size_t bucket_count() const
+        {
+            return base_class::bucket_count() ;
+        }
     };
 
 
@@ -615,6 +615,30 @@ namespace cds { namespace container {
         {
             return base_class::size() ;
         }
+
+        /// Returns current bucket count
+        size_t bucket_count() const
+        {
+            return base_class::bucket_count() ;
+        }
+
+        /// Shrinks the bucket table
+        /**
+            The function halves the bucket count while the average item count per bucket
+            is less than <tt>load_factor / shrink_factor</tt> (see split_list::shrink_factor option)
+            and releases the dummy nodes of the buckets removed.
+            The function is thread-safe and is called automatically by \p erase when the map becomes sparse.
+            If split_list::shrink_factor option is 0 (the default) the table is not shrunk.
+            See \ref cds::intrusive::SplitListSet::shrink() for details.
+
+            RCU \p synchronize method is called, therefore, RCU should not be locked.
+
+            Returns the number of buckets the table is reduced by.
+        */
+        size_t shrink()
+        {
+            return base_class::shrink() ;
+        }
     };
 
 
@@ -15,6 +15,7 @@
 #include <cds/intrusive/split_list.h>
 #include <cds/container/details/make_split_list_set.h>
 #include <cds/details/functor_wrapper.h>
+#include <cds/gc/guarded_ptr.h>
 
 namespace cds { namespace container {
 
@@ -164,6 +165,21 @@ namespace cds { namespace container {
         typedef typename options::cxx_node_allocator    cxx_node_allocator  ;
         typedef typename options::node_type             node_type           ;
 
+        struct node_to_value_cast {
+            value_type * operator()( node_type * p ) const
+            {
+                return p ? &p->m_Value : null_ptr<value_type *>() ;
+            }
+        };
+        //@endcond
+
+    public:
+        /// Guarded pointer to the set item, see \ref get and \ref extract
+        typedef cds::gc::guarded_ptr< gc, node_type, value_type, node_to_value_cast > guarded_ptr ;
+
+    protected:
+        //@cond
+
         template <typename Q>
         static node_type * alloc_node(Q const& v )
         {
@@ -629,6 +645,79 @@ namespace cds { namespace container {
 #       endif
         }
 
+        /// Extracts the item from the set with specified \p key
+        /** \anchor cds_nonintrusive_SplitListSet_hp_extract
+            The function searches an item with key equal to \p key,
+            unlinks it from the set, and returns it in \p dest parameter.
+            If the item with key equal to \p key is not found the function returns \p false.
+
+            The value is not copied: \p dest points to the value stored in the set.
+            The node is freed by garbage collector \p GC when returned \ref guarded_ptr object
+            will be destroyed or released.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+
+            Usage:
+            \code
+            typedef cds::container::SplitListSet< cds::gc::PTB, foo, foo_set_traits > splitlist_set ;
+            splitlist_set theSet ;
+            // ...
+            {
+                splitlist_set::guarded_ptr gp ;
+                if ( theSet.extract( gp, 5 )) {
+                    // Deal with gp
+                    // ...
+                }
+                // Destructor of gp releases internal PTB guard
+            }
+            \endcode
+        */
+        template <typename Q>
+        bool extract( guarded_ptr& dest, Q const& key )
+        {
+            return base_class::extract_( dest.guard(), key, typename base_class::key_comparator() ) ;
+        }
+
+        /// Extracts the item from the set using \p pred predicate for searching
+        /**
+            The function is an analog of \ref cds_nonintrusive_SplitListSet_hp_extract "extract(guarded_ptr&, Q const&)"
+            but \p pred is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool extract_with( guarded_ptr& dest, Q const& key, Less pred )
+        {
+            return base_class::extract_( dest.guard(), key, typename base_class::wrapped_ordered_list::template make_compare_from_less< typename options::template predicate_wrapper<Less>::type >() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Extracts the item with specified \p key and returns the guarded pointer to it
+        /**
+            The function is an analog of \ref cds_nonintrusive_SplitListSet_hp_extract "extract(guarded_ptr&, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr extract( Q const& key )
+        {
+            guarded_ptr gp ;
+            extract( gp, key ) ;
+            return gp ;
+        }
+
+        /// Extracts the item using \p pred predicate and returns the guarded pointer to it
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr extract_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            extract_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Finds the key \p val
         /** \anchor cds_nonintrusive_SplitListSet_find_func
 
@@ -746,6 +835,65 @@ namespace cds { namespace container {
             return base_class::find_with( val, typename options::template predicate_wrapper<Less>::type() )   ;
         }
 
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /** \anchor cds_nonintrusive_SplitListSet_hp_get
+            The function searches the item with key equal to \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if \p key is found, and \p false otherwise.
+            If \p key is not found the \p ptr parameter is not changed.
+
+            Unlike \p find() the value is not copied and no functor is called: \p ptr points to the value
+            stored in the set, the guard prevents the item from being freed while \p ptr is alive.
+            The function does not serialize simultaneous access to the item found.
+            @note Each \p guarded_ptr object uses one GC's guard which can be limited resource.
+        */
+        template <typename Q>
+        bool get( guarded_ptr& ptr, Q const& key )
+        {
+            return base_class::get_( ptr.guard(), key, typename base_class::key_comparator() ) ;
+        }
+
+        /// Finds the key \p key and returns the guarded pointer to the item found using \p pred predicate
+        /**
+            The function is an analog of \ref cds_nonintrusive_SplitListSet_hp_get "get( guarded_ptr& ptr, Q const&)"
+            but \p pred is used for comparing the keys.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool get_with( guarded_ptr& ptr, Q const& key, Less pred )
+        {
+            return base_class::get_( ptr.guard(), key, typename base_class::wrapped_ordered_list::template make_compare_from_less< typename options::template predicate_wrapper<Less>::type >() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /**
+            The function is an analog of \ref cds_nonintrusive_SplitListSet_hp_get "get( guarded_ptr& ptr, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr get( Q const& key )
+        {
+            guarded_ptr gp ;
+            get( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the key \p key using \p pred predicate and returns the guarded pointer to the item found
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr get_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            get_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Clears the set (non-atomic)
         /**
             The function unlink all items from the set.
@@ -771,6 +919,12 @@ namespace cds { namespace container {
         {
             return base_class::size()   ;
         }
+
+        /// Returns current bucket count
+        size_t bucket_count() const
+        {
+            return base_class::bucket_count() ;
+        }
     };
 
 
@@ -82,7 +82,8 @@ namespace cds { namespace container {
 
         The \p Options are:
             - opt::mutex_policy - concurrent access policy.
-                Available policies: intrusive::striped_set::striping, intrusive::striped_set::refinable.
+                Available policies: intrusive::striped_set::striping, intrusive::striped_set::rw_striping,
+                intrusive::striped_set::refinable.
                 Default is %striped_set::striping.
             - opt::hash - hash functor. Default option value see opt::v::hash_selector<opt::none> which selects default hash functor for
                 your compiler.
@@ -106,6 +107,9 @@ namespace cds { namespace container {
             - opt::copy_policy - the copy policy which is used to copy items from the old map to the new one when resizing.
                 The policy can be optionally used in adapted bucket container for performance reasons of resizing.
                 The detail of copy algorithm depends on type of bucket container and explains below.
+            - striped_set::incremental_resize - enables incremental resizing: the old and new bucket tables
+                are kept side by side and the items are migrated by a few buckets per update operation,
+                so no single operation pays for the whole rehash. Default is <tt>incremental_resize<false></tt>.
 
             \p opt::compare or \p opt::less options are used only in some \p Container class for searching an item.
             \p %opt::compare option has the highest priority: if \p %opt::compare is specified, \p %opt::less is not used.
@@ -284,6 +288,24 @@ namespace cds { namespace container {
                     <td>
                     </td>
                 </tr>
+                <tr>
+                    <td> \p cds::container::striped_set::flat_bucket</td>
+                    <td><tt><cds/container/striped_map/flat_bucket.h></tt></td>
+                    <td>\code
+                        #include <cds/container/striped_map/flat_bucket.h>
+                        #include <cds/container/striped_hash_map.h>
+                        typedef cds::container::StripedMap<
+                            cds::container::striped_set::flat_bucket< std::pair< const Key, T > >,
+                            cds::opt::hash< my_hash >,
+                            cds::opt::less< std::less<Key> >
+                        > striped_map ;
+                    \endcode
+                    </td>
+                    <td>
+                        The bucket is an open-addressing table storing the pairs inline.
+                        Template argument pack \p Options <b>must</b> contain cds::opt::less or cds::opt::compare for type \p Key
+                    </td>
+                </tr>
             </table>
 
 
@@ -438,6 +460,38 @@ namespace cds { namespace container {
                         } \endcode
                     </td>
                 </tr>
+                <tr>
+                    <td>
+                        - \p cds::container::striped_set::flat_bucket
+                    </td>
+                    <td>\code
+                        struct copy_item {
+                            void operator()( std::pair<const Key, T> * pDest, std::pair<const Key, T>& src )
+                            {
+                                new ( pDest ) std::pair<const Key, T>( src ) ;
+                            }
+                        } \endcode
+
+                        \code
+                        // The type T stored in the bucket must be swappable
+                        struct swap_item {
+                            void operator()( std::pair<const Key, T> * pDest, std::pair<const Key, T>& src )
+                            {
+                                new ( pDest ) std::pair<const Key, T>( src.first, T() ) ;
+                                std::swap( pDest->second, src.second ) ;
+                            }
+                        } \endcode
+
+                        \code
+                        struct move_item {
+                            void operator()( std::pair<const Key, T> * pDest, std::pair<const Key, T>& src )
+                            {
+                                new ( pDest ) std::pair<const Key, T>( std::move( src )) ;
+                            }
+                        } \endcode
+                        \p pDest points to raw storage in the new bucket.
+                    </td>
+                </tr>
             </table>
 
         <b>Advanced functions</b>
@@ -498,6 +552,11 @@ namespace cds { namespace container {
                 <td>-</td>
                 <td>-</td>
             </tr>
+            <tr>
+                <td> \p cds::container::striped_set::flat_bucket</td>
+                <td>+</td>
+                <td>+</td>
+            </tr>
         </table>
 
     **/
@@ -723,13 +782,13 @@ namespace cds { namespace container {
             bucket_type * pBucket   ;
             {
                 scoped_cell_lock sl( base_class::m_MutexPolicy, nHash ) ;
-                pBucket = base_class::bucket( nHash )   ;
+                pBucket = base_class::bucket_for_update( nHash )   ;
 
                 bOk = pBucket->emplace( std::forward<K>(key), std::forward<Args>(args)...)    ;
                 bResize = bOk && base_class::m_ResizingPolicy( ++base_class::m_ItemCounter, *this, *pBucket ) ;
             }
 
-            if ( bResize )
+            if ( base_class::need_resize( bResize ))
                 base_class::resize() ;
 
             return bOk  ;
@@ -776,13 +835,13 @@ namespace cds { namespace container {
             bucket_type * pBucket       ;
             {
                 scoped_cell_lock sl( base_class::m_MutexPolicy, nHash ) ;
-                pBucket = base_class::bucket( nHash )    ;
+                pBucket = base_class::bucket_for_update( nHash )    ;
 
                 result = pBucket->ensure( key, func )      ;
                 bResize = result.first && result.second && base_class::m_ResizingPolicy( ++base_class::m_ItemCounter, *this, *pBucket ) ;
             }
 
-            if ( bResize )
+            if ( base_class::need_resize( bResize ))
                 base_class::resize() ;
             return result       ;
         }
@@ -0,0 +1,272 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_STRIPED_MAP_FLAT_BUCKET_ADAPTER_H
+#define __CDS_CONTAINER_STRIPED_MAP_FLAT_BUCKET_ADAPTER_H
+
+#include <cds/container/striped_set/flat_bucket.h>
+
+//@cond
+namespace cds { namespace container {
+    namespace striped_set {
+
+        // Copy policy for map
+        template <typename K, typename T, typename Alloc>
+        struct copy_item_policy< flat_bucket< std::pair< K const, T >, Alloc > >
+        {
+            typedef std::pair< K const, T>  pair_type ;
+
+            void operator()( pair_type * pDest, pair_type& src )
+            {
+                new ( pDest ) pair_type( src ) ;
+            }
+        };
+
+        // Swap policy for map
+        template <typename K, typename T, typename Alloc>
+        struct swap_item_policy< flat_bucket< std::pair< K const, T >, Alloc > >
+        {
+            typedef std::pair< K const, T>  pair_type ;
+
+            void operator()( pair_type * pDest, pair_type& src )
+            {
+                new ( pDest ) pair_type( src.first, typename pair_type::second_type() ) ;
+                std::swap( pDest->second, src.second ) ;
+            }
+        };
+
+#ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        // Move policy for map
+        template <typename K, typename T, typename Alloc>
+        struct move_item_policy< flat_bucket< std::pair< K const, T >, Alloc > >
+        {
+            typedef std::pair< K const, T>  pair_type ;
+
+            void operator()( pair_type * pDest, pair_type& src )
+            {
+                new ( pDest ) pair_type( std::move( src )) ;
+            }
+        };
+#endif
+    } // namespace striped_set
+}} // namespace cds::container
+
+namespace cds { namespace intrusive { namespace striped_set {
+
+    /// flat_bucket adapter for hash map bucket
+    template <typename Key, typename T, class Alloc, CDS_SPEC_OPTIONS>
+    class adapt< cds::container::striped_set::flat_bucket< std::pair<Key const, T>, Alloc >, CDS_OPTIONS >
+    {
+    public:
+        typedef cds::container::striped_set::flat_bucket< std::pair<Key const, T>, Alloc >  container_type  ;   ///< underlying container type
+
+    private:
+        /// Adapted container type
+        class adapted_container: public cds::container::striped_set::adapted_sequential_container
+        {
+        public:
+            typedef typename container_type::value_type     value_type  ;   ///< value type stored in the container
+            typedef typename value_type::first_type         key_type    ;
+            typedef typename value_type::second_type        mapped_type ;
+
+            static bool const has_find_with = true     ;
+            static bool const has_erase_with = true    ;
+
+        private:
+            //@cond
+            typedef typename cds::opt::details::make_comparator_from_option_list< value_type, CDS_OPTIONS >::type key_comparator  ;
+            typedef typename cds::container::striped_set::details::make_hash_from_option_list< CDS_OPTIONS >::type hash ;
+
+            typedef cds::container::striped_set::details::flat_bucket_table< value_type, typename container_type::allocator_type, hash >  table_type ;
+
+            typedef typename cds::opt::select<
+                typename cds::opt::value<
+                    typename cds::opt::find_option<
+                        cds::opt::copy_policy< cds::container::striped_set::move_item >
+                        , CDS_OPTIONS
+                    >::type
+                >::copy_policy
+                , cds::container::striped_set::copy_item, cds::container::striped_set::copy_item_policy<container_type>
+                , cds::container::striped_set::swap_item, cds::container::striped_set::swap_item_policy<container_type>
+#ifdef CDS_MOVE_SEMANTICS_SUPPORT
+                , cds::container::striped_set::move_item, cds::container::striped_set::move_item_policy<container_type>
+#endif
+            >::type copy_item   ;
+
+            struct key_equal
+            {
+                template <typename Q>
+                bool operator()( value_type const& item, Q const& key ) const
+                {
+                    return key_comparator()( key, item.first ) == 0 ;
+                }
+            };
+
+            template <typename Less>
+            struct less_equal
+            {
+                Less    m_Less ;
+
+                less_equal( Less pred )
+                    : m_Less( pred )
+                {}
+
+                template <typename Q>
+                bool operator()( value_type const& item, Q const& key ) const
+                {
+                    return !m_Less( key, item.first ) && !m_Less( item.first, key ) ;
+                }
+            };
+            //@endcond
+
+        public:
+            typedef typename table_type::iterator       iterator        ;   ///< container iterator
+            typedef typename table_type::const_iterator const_iterator  ;   ///< container const iterator
+
+        private:
+            //@cond
+            table_type  m_Table ;
+            //@endcond
+
+        public:
+            template <typename Q, typename Func>
+            bool insert( const Q& key, Func f )
+            {
+                size_t const nHash = hash()( key ) ;
+                if ( m_Table.find( nHash, key, key_equal() ) != table_type::npos )
+                    return false ;
+
+                size_t nSlot = m_Table.prepare_insert( nHash ) ;
+                value_type * pItem = new ( m_Table.slot( nSlot )) value_type( key, mapped_type() ) ;
+                m_Table.commit_insert( nSlot, nHash )   ;
+                cds::unref( f )( *pItem )   ;
+                return true ;
+            }
+
+#           ifdef CDS_EMPLACE_SUPPORT
+            template <typename K, typename... Args>
+            bool emplace( K&& key, Args&&... args )
+            {
+                size_t const nHash = hash()( key ) ;
+                if ( m_Table.find( nHash, key, key_equal() ) != table_type::npos )
+                    return false ;
+
+                size_t nSlot = m_Table.prepare_insert( nHash ) ;
+                new ( m_Table.slot( nSlot )) value_type( std::forward<K>(key), std::move( mapped_type( std::forward<Args>(args)...) )) ;
+                m_Table.commit_insert( nSlot, nHash )   ;
+                return true ;
+            }
+#           endif
+
+            template <typename Q, typename Func>
+            std::pair<bool, bool> ensure( const Q& key, Func func )
+            {
+                size_t const nHash = hash()( key ) ;
+                size_t nSlot = m_Table.find( nHash, key, key_equal() ) ;
+                if ( nSlot != table_type::npos ) {
+                    // already exists
+                    cds::unref( func )( false, *m_Table.slot( nSlot ) ) ;
+                    return std::make_pair( true, false )    ;
+                }
+
+                // insert new
+                nSlot = m_Table.prepare_insert( nHash ) ;
+                value_type * pItem = new ( m_Table.slot( nSlot )) value_type( key, mapped_type() ) ;
+                m_Table.commit_insert( nSlot, nHash )   ;
+                cds::unref( func )( true, *pItem )  ;
+                return std::make_pair( true, true ) ;
+            }
+
+            template <typename Q, typename Func>
+            bool erase( Q const& key, Func f )
+            {
+                size_t nSlot = m_Table.find( hash()( key ), key, key_equal() ) ;
+                if ( nSlot == table_type::npos )
+                    return false ;
+
+                // key exists
+                cds::unref( f )( *m_Table.slot( nSlot ) ) ;
+                m_Table.erase( nSlot )  ;
+                return true ;
+            }
+
+            template <typename Q, typename Less, typename Func>
+            bool erase( Q const& key, Less pred, Func f )
+            {
+                size_t nSlot = m_Table.find( hash()( key ), key, less_equal<Less>( pred ) ) ;
+                if ( nSlot == table_type::npos )
+                    return false ;
+
+                // key exists
+                cds::unref( f )( *m_Table.slot( nSlot ) ) ;
+                m_Table.erase( nSlot )  ;
+                return true ;
+            }
+
+            template <typename Q, typename Func>
+            bool find( Q& val, Func f )
+            {
+                size_t nSlot = m_Table.find( hash()( val ), val, key_equal() ) ;
+                if ( nSlot == table_type::npos )
+                    return false ;
+
+                // key exists
+                cds::unref( f )( *m_Table.slot( nSlot ), val ) ;
+                return true ;
+            }
+
+            template <typename Q, typename Less, typename Func>
+            bool find( Q& val, Less pred, Func f )
+            {
+                size_t nSlot = m_Table.find( hash()( val ), val, less_equal<Less>( pred ) ) ;
+                if ( nSlot == table_type::npos )
+                    return false ;
+
+                // key exists
+                cds::unref( f )( *m_Table.slot( nSlot ), val ) ;
+                return true ;
+            }
+
+            void clear()
+            {
+                m_Table.clear() ;
+            }
+
+            iterator begin()                { return m_Table.begin(); }
+            const_iterator begin() const    { return m_Table.begin(); }
+            iterator end()                  { return m_Table.end(); }
+            const_iterator end() const      { return m_Table.end(); }
+
+            void move_item( adapted_container& /*from*/, iterator itWhat )
+            {
+                size_t const nHash = hash()( itWhat->first ) ;
+                assert( m_Table.find( nHash, itWhat->first, key_equal() ) == table_type::npos ) ;
+
+                size_t nSlot = m_Table.prepare_insert( nHash ) ;
+                copy_item()( m_Table.slot( nSlot ), *itWhat ) ;
+                m_Table.commit_insert( nSlot, nHash )   ;
+            }
+
+            size_t size() const
+            {
+                return m_Table.size() ;
+            }
+        };
+
+    public:
+        typedef adapted_container type ; ///< Result of \p adapt metafunction
+
+    };
+}}} // namespace cds::intrusive::striped_set
+
+//@endcond
+
+#endif // #ifndef __CDS_CONTAINER_STRIPED_MAP_FLAT_BUCKET_ADAPTER_H
@@ -43,7 +43,8 @@ namespace cds { namespace container {
 
         The \p Options are:
             - opt::mutex_policy - concurrent access policy.
-                Available policies: intrusive::striped_set::striping, intrusive::striped_set::refinable.
+                Available policies: intrusive::striped_set::striping, intrusive::striped_set::rw_striping,
+                intrusive::striped_set::refinable.
                 Default is %striped_set::striping.
             - opt::hash - hash functor. Default option value see opt::v::hash_selector<opt::none> which selects default hash functor for
                 your compiler.
@@ -67,6 +68,9 @@ namespace cds { namespace container {
             - opt::copy_policy - the copy policy which is used to copy items from the old set to the new one when resizing.
                 The policy can be optionally used in adapted bucket container for performance reasons of resizing.
                 The detail of copy algorithm depends on type of bucket container and explains below.
+            - striped_set::incremental_resize - enables incremental resizing: the old and new bucket tables
+                are kept side by side and the items are migrated by a few buckets per update operation,
+                so no single operation pays for the whole rehash. Default is <tt>incremental_resize<false></tt>.
 
             opt::compare or opt::less options are used in some \p Container class for searching an item.
             opt::compare option has the highest priority: if opt::compare is specified, opt::less is not used.
@@ -297,6 +301,26 @@ namespace cds { namespace container {
                         For the best result, \p h1 and \p h2 must be orthogonal i.e. <tt> h1(X) != h2(X) </tt> for any value \p X.
                     </td>
                 </tr>
+                <tr>
+                    <td> \p cds::container::striped_set::flat_bucket</td>
+                    <td><tt><cds/container/striped_set/flat_bucket.h></tt></td>
+                    <td>\code
+                        #include <cds/container/striped_set/flat_bucket.h>
+                        #include <cds/container/striped_hash_set.h>
+                        typedef cds::container::StripedSet<
+                            cds::container::striped_set::flat_bucket<T>,
+                            cds::opt::hash< my_hash >,
+                            cds::opt::less< std::less<T> >
+                        > striped_set ;
+                    \endcode
+                    </td>
+                    <td>
+                        The bucket is an open-addressing table storing the items inline.
+                        The table is not ordered; the hash functor \p my_hash of %StripedSet is used
+                        to place items inside the bucket.
+                        Template argument pack \p Options <b>must</b> contain cds::opt::less or cds::opt::compare for type \p T
+                    </td>
+                </tr>
             </table>
 
             You can use another container type as set's bucket.
@@ -420,6 +444,38 @@ namespace cds { namespace container {
                         } \endcode
                     </td>
                 </tr>
+                <tr>
+                    <td>
+                        - \p cds::container::striped_set::flat_bucket
+                    </td>
+                    <td>\code
+                        struct copy_item {
+                            void operator()( T * pDest, T& src )
+                            {
+                                new ( pDest ) T( src ) ;
+                            }
+                        } \endcode
+
+                        \code
+                        // The type T stored in the bucket must be swappable
+                        struct swap_item {
+                            void operator()( T * pDest, T& src )
+                            {
+                                new ( pDest ) T ;
+                                std::swap( *pDest, src ) ;
+                            }
+                        } \endcode
+
+                        \code
+                        struct move_item {
+                            void operator()( T * pDest, T& src )
+                            {
+                                new ( pDest ) T( std::move( src )) ;
+                            }
+                        } \endcode
+                        \p pDest points to raw storage in the new bucket.
+                    </td>
+                </tr>
             </table>
 
         <b>Advanced functions</b>
@@ -495,6 +551,11 @@ namespace cds { namespace container {
                     <td>-</td>
                     <td>-</td>
                 </tr>
+                <tr>
+                    <td> \p cds::container::striped_set::flat_bucket</td>
+                    <td>+</td>
+                    <td>+</td>
+                </tr>
             </table>
     */
     template <class Container, CDS_DECL_OPTIONS9>
@@ -636,12 +697,12 @@ namespace cds { namespace container {
             bucket_type * pBucket   ;
             {
                 scoped_cell_lock sl( base_class::m_MutexPolicy, nHash ) ;
-                pBucket = base_class::bucket( nHash )    ;
+                pBucket = base_class::bucket_for_update( nHash )    ;
                 bOk = pBucket->insert( val, f )            ;
                 bResize = bOk && base_class::m_ResizingPolicy( ++base_class::m_ItemCounter, *this, *pBucket ) ;
             }
 
-            if ( bResize )
+            if ( base_class::need_resize( bResize ))
                 base_class::resize()    ;
             return bOk  ;
         }
@@ -663,13 +724,13 @@ namespace cds { namespace container {
             bucket_type * pBucket   ;
             {
                 scoped_cell_lock sl( base_class::m_MutexPolicy, nHash ) ;
-                pBucket = base_class::bucket( nHash )    ;
+                pBucket = base_class::bucket_for_update( nHash )    ;
 
                 bOk = pBucket->emplace( std::forward<Args>(args)...)    ;
                 bResize = bOk && base_class::m_ResizingPolicy( ++base_class::m_ItemCounter, *this, *pBucket ) ;
             }
 
-            if ( bResize )
+            if ( base_class::need_resize( bResize ))
                 base_class::resize() ;
             return bOk  ;
         }
@@ -714,13 +775,13 @@ namespace cds { namespace container {
             bucket_type * pBucket       ;
             {
                 scoped_cell_lock sl( base_class::m_MutexPolicy, nHash ) ;
-                pBucket = base_class::bucket( nHash )    ;
+                pBucket = base_class::bucket_for_update( nHash )    ;
 
                 result = pBucket->ensure( val, func )      ;
                 bResize = result.first && result.second && base_class::m_ResizingPolicy( ++base_class::m_ItemCounter, *this, *pBucket ) ;
             }
 
-            if ( bResize )
+            if ( base_class::need_resize( bResize ))
                 base_class::resize() ;
             return result       ;
         }
@@ -788,7 +849,7 @@ namespace cds { namespace container {
             size_t nHash = base_class::hashing( key )        ;
             {
                 scoped_cell_lock sl( base_class::m_MutexPolicy, nHash );
-                bucket_type * pBucket = base_class::bucket( nHash )    ;
+                bucket_type * pBucket = base_class::bucket_for_update( nHash )    ;
 
                 bOk = pBucket->erase( key, f )             ;
             }
@@ -818,7 +879,7 @@ namespace cds { namespace container {
             size_t nHash = base_class::hashing( key )        ;
             {
                 scoped_cell_lock sl( base_class::m_MutexPolicy, nHash );
-                bucket_type * pBucket = base_class::bucket( nHash )    ;
+                bucket_type * pBucket = base_class::bucket_for_update( nHash )    ;
 
                 bOk = pBucket->erase( key, pred, f )              ;
             }
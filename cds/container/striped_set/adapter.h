@@ -200,8 +200,10 @@ namespace cds { namespace container {
         using cds::intrusive::striped_set::load_factor_resizing ;
         using cds::intrusive::striped_set::single_bucket_size_threshold ;
         using cds::intrusive::striped_set::no_resizing ;
+        using cds::intrusive::striped_set::incremental_resize ;
 
         using cds::intrusive::striped_set::striping ;
+        using cds::intrusive::striped_set::rw_striping ;
         using cds::intrusive::striped_set::refinable;
         //@endcond
 
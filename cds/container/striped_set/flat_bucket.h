@@ -0,0 +1,616 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_CONTAINER_STRIPED_SET_FLAT_BUCKET_ADAPTER_H
+#define __CDS_CONTAINER_STRIPED_SET_FLAT_BUCKET_ADAPTER_H
+
+#include <cds/container/striped_set/adapter.h>
+#include <cds/opt/hash.h>
+#include <cds/ref.h>
+#include <cds/details/make_const_type.h>
+#include <cds/user_setup/allocator.h>
+#include <new>          // placement new
+#include <cstring>      // memset
+#include <algorithm>    // std::swap
+#include <utility>      // std::pair
+
+namespace cds { namespace container { namespace striped_set {
+
+    /// Open-addressing flat bucket for StripedSet and StripedMap
+    /**
+        Unlike other bucket types that are node-based containers (\p std::list, \p std::set,
+        \p boost::unordered_set and so on), the \p %flat_bucket keeps its items inline
+        in a small open-addressing hash table with linear probing. Each slot of the table has
+        a one-byte control field containing a 7-bit fingerprint of the item's hash,
+        so the search compares only the items whose fingerprint is matched
+        and the negative lookups are usually resolved without touching the items at all.
+
+        The bucket table is allocated on first insertion and is grown twice when
+        the bucket is filled by 7/8. The empty bucket does not allocate any memory.
+
+        Template arguments:
+        - \p T - the type stored in the bucket. For \p StripedMap it must be <tt>std::pair< Key const, Value ></tt>
+        - \p Alloc - the allocator for the bucket's slot table
+
+        The hash functor is taken from \p opt::hash option of \p %StripedSet (\p %StripedMap),
+        the key comparison - from \p opt::compare or \p opt::less option that is mandatory for \p %flat_bucket.
+        The slot index and the fingerprint are built from the mixed hash value, so the hash functor
+        that is used for bucket selection by the set itself is suitable.
+
+        Example:
+        \code
+        #include <cds/container/striped_set/flat_bucket.h>
+        #include <cds/container/striped_set.h>
+
+        typedef cds::container::StripedSet<
+            cds::container::striped_set::flat_bucket< T >,
+            cds::opt::hash< my_hash >,
+            cds::opt::less< std::less<T> >
+        > striped_set ;
+        \endcode
+    */
+    template <typename T, class Alloc = CDS_DEFAULT_ALLOCATOR>
+    struct flat_bucket
+    {
+        typedef T       value_type      ;   ///< value type stored in the bucket
+        typedef Alloc   allocator_type  ;   ///< allocator of the bucket's slot table
+    };
+
+    //@cond
+    // Copy policy for flat_bucket
+    template <typename T, typename Alloc>
+    struct copy_item_policy< flat_bucket< T, Alloc > >
+    {
+        typedef T value_type ;
+
+        void operator()( value_type * pDest, value_type& src )
+        {
+            new ( pDest ) value_type( src ) ;
+        }
+    };
+
+    // Swap policy for flat_bucket
+    template <typename T, typename Alloc>
+    struct swap_item_policy< flat_bucket< T, Alloc > >
+    {
+        typedef T value_type ;
+
+        void operator()( value_type * pDest, value_type& src )
+        {
+            new ( pDest ) value_type ;
+            std::swap( *pDest, src )  ;
+        }
+    };
+
+#ifdef CDS_MOVE_SEMANTICS_SUPPORT
+    // Move policy for flat_bucket
+    template <typename T, typename Alloc>
+    struct move_item_policy< flat_bucket< T, Alloc > >
+    {
+        typedef T value_type ;
+
+        void operator()( value_type * pDest, value_type& src )
+        {
+            new ( pDest ) value_type( std::move( src )) ;
+        }
+    };
+#endif
+
+    namespace details {
+
+        // Hash functor from the option list of StripedSet
+        template <CDS_DECL_OPTIONS>
+        struct make_hash_from_option_list
+        {
+            struct default_traits {
+                typedef typename cds::opt::v::hash_selector< cds::opt::none >::type hash ;
+            };
+
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< default_traits, CDS_OPTIONS >::type
+                ,CDS_OPTIONS
+            >::type::hash   type ;
+        };
+
+        // Open-addressing table with linear probing and one-byte control field per slot:
+        //  0 - the slot is empty, 1 - the slot is deleted (tombstone), 0x80 | fingerprint - the slot is occupied.
+        // The table does not compare the keys itself; the search is parametrized by an equality predicate.
+        // Hash is the functor computing the hash of stored value, it is needed for rehashing.
+        template <typename T, class Alloc, class Hash>
+        class flat_bucket_table
+        {
+        public:
+            typedef T       value_type ;
+            typedef Hash    hash ;
+
+            static size_t const npos = ~size_t(0) ;
+
+        private:
+            typedef typename Alloc::template rebind< value_type >::other     slot_allocator  ;
+            typedef typename Alloc::template rebind< unsigned char >::other  ctrl_allocator  ;
+
+            static unsigned char const c_Empty    = 0 ;
+            static unsigned char const c_Deleted  = 1 ;
+            static unsigned char const c_Occupied = 0x80 ;
+
+            static size_t const c_nMinCapacity = 8 ;
+
+            unsigned char * m_pCtrl     ;   // control bytes
+            value_type *    m_pSlots    ;   // raw storage for items
+            size_t          m_nCapacity ;   // slot count, power of 2 or 0
+            size_t          m_nSize     ;   // occupied slot count
+            size_t          m_nDeleted  ;   // tombstone count
+
+        public:
+            template <bool IsConst>
+            class iterator_type
+            {
+                friend class flat_bucket_table ;
+                typedef typename cds::details::make_const_type< value_type, IsConst >::pointer     value_ptr ;
+                typedef typename cds::details::make_const_type< value_type, IsConst >::reference   value_ref ;
+
+                unsigned char const *   m_pCtrl ;
+                unsigned char const *   m_pEnd  ;
+                value_ptr               m_pSlot ;
+
+                iterator_type( unsigned char const * pCtrl, unsigned char const * pEnd, value_ptr pSlot )
+                    : m_pCtrl( pCtrl )
+                    , m_pEnd( pEnd )
+                    , m_pSlot( pSlot )
+                {
+                    skip() ;
+                }
+
+                void skip()
+                {
+                    while ( m_pCtrl != m_pEnd && *m_pCtrl < c_Occupied ) {
+                        ++m_pCtrl   ;
+                        ++m_pSlot   ;
+                    }
+                }
+
+            public:
+                iterator_type()
+                    : m_pCtrl( null_ptr<unsigned char const *>() )
+                    , m_pEnd( null_ptr<unsigned char const *>() )
+                    , m_pSlot( null_ptr<value_ptr>() )
+                {}
+
+                iterator_type( iterator_type<false> const& src )
+                    : m_pCtrl( src.m_pCtrl )
+                    , m_pEnd( src.m_pEnd )
+                    , m_pSlot( src.m_pSlot )
+                {}
+
+                value_ref operator *() const
+                {
+                    return *m_pSlot ;
+                }
+
+                value_ptr operator ->() const
+                {
+                    return m_pSlot ;
+                }
+
+                iterator_type& operator ++()
+                {
+                    ++m_pCtrl   ;
+                    ++m_pSlot   ;
+                    skip()      ;
+                    return *this ;
+                }
+
+                template <bool C>
+                bool operator ==( iterator_type<C> const& i ) const
+                {
+                    return m_pCtrl == i.m_pCtrl ;
+                }
+
+                template <bool C>
+                bool operator !=( iterator_type<C> const& i ) const
+                {
+                    return m_pCtrl != i.m_pCtrl ;
+                }
+
+                template <bool> friend class iterator_type ;
+            };
+
+            typedef iterator_type<false>    iterator        ;
+            typedef iterator_type<true>     const_iterator  ;
+
+        private:
+            static size_t mix( size_t nHash )
+            {
+                // The items of one bucket share the low bits of the hash,
+                // so all bits are mixed before taking the slot index and the fingerprint
+                nHash ^= nHash >> 16    ;
+                nHash *= 0x85ebca6bU    ;
+                nHash ^= nHash >> 13    ;
+                nHash *= 0xc2b2ae35U    ;
+                nHash ^= nHash >> 16    ;
+                return nHash ;
+            }
+
+            static unsigned char fingerprint( size_t nMixed )
+            {
+                return static_cast<unsigned char>( c_Occupied | ( nMixed >> ( sizeof(size_t) * 8 - 7 )) ) ;
+            }
+
+            size_t free_slot( size_t nMixed ) const
+            {
+                size_t const nMask = m_nCapacity - 1 ;
+                size_t nSlot = nMixed & nMask ;
+                while ( m_pCtrl[nSlot] >= c_Occupied )
+                    nSlot = ( nSlot + 1 ) & nMask ;
+                return nSlot ;
+            }
+
+            void rehash( size_t nNewCapacity )
+            {
+                unsigned char * pOldCtrl = m_pCtrl ;
+                value_type * pOldSlots = m_pSlots ;
+                size_t nOldCapacity = m_nCapacity ;
+
+                m_pCtrl = ctrl_allocator().allocate( nNewCapacity )   ;
+                m_pSlots = slot_allocator().allocate( nNewCapacity )  ;
+                m_nCapacity = nNewCapacity  ;
+                m_nDeleted = 0  ;
+                std::memset( m_pCtrl, c_Empty, nNewCapacity ) ;
+
+                for ( size_t i = 0; i < nOldCapacity; ++i ) {
+                    if ( pOldCtrl[i] >= c_Occupied ) {
+                        size_t nSlot = free_slot( mix( hash()( pOldSlots[i] ))) ;
+#               ifdef CDS_MOVE_SEMANTICS_SUPPORT
+                        new ( m_pSlots + nSlot ) value_type( std::move( pOldSlots[i] )) ;
+#               else
+                        new ( m_pSlots + nSlot ) value_type( pOldSlots[i] ) ;
+#               endif
+                        m_pCtrl[nSlot] = pOldCtrl[i]    ;
+                        pOldSlots[i].~value_type()      ;
+                    }
+                }
+
+                if ( nOldCapacity ) {
+                    ctrl_allocator().deallocate( pOldCtrl, nOldCapacity )  ;
+                    slot_allocator().deallocate( pOldSlots, nOldCapacity ) ;
+                }
+            }
+
+            // non-copyable
+            flat_bucket_table( flat_bucket_table const& ) ;
+            void operator =( flat_bucket_table const& ) ;
+
+        public:
+            flat_bucket_table()
+                : m_pCtrl( null_ptr<unsigned char *>() )
+                , m_pSlots( null_ptr<value_type *>() )
+                , m_nCapacity(0)
+                , m_nSize(0)
+                , m_nDeleted(0)
+            {}
+
+            ~flat_bucket_table()
+            {
+                clear() ;
+            }
+
+            /// Searches an item equal to \p key, returns its slot or \p npos
+            template <typename Q, typename Equal>
+            size_t find( size_t nHash, Q const& key, Equal eq ) const
+            {
+                if ( m_nSize == 0 )
+                    return npos ;
+
+                size_t const nMixed = mix( nHash ) ;
+                unsigned char const nFingerprint = fingerprint( nMixed ) ;
+                size_t const nMask = m_nCapacity - 1 ;
+
+                // The table always has an empty slot, so the loop is finite
+                for ( size_t nSlot = nMixed & nMask; ; nSlot = ( nSlot + 1 ) & nMask ) {
+                    unsigned char const nCtrl = m_pCtrl[nSlot] ;
+                    if ( nCtrl == c_Empty )
+                        return npos ;
+                    if ( nCtrl == nFingerprint && eq( m_pSlots[nSlot], key ))
+                        return nSlot ;
+                }
+            }
+
+            /// Returns raw storage for new item with hash \p nHash; the item must not be in the table
+            /**
+                The caller constructs the item in the slot returned and then calls \ref commit_insert.
+            */
+            size_t prepare_insert( size_t nHash )
+            {
+                if ( ( m_nSize + m_nDeleted + 1 ) * 8 > m_nCapacity * 7 ) {
+                    size_t nNewCapacity = m_nCapacity ? m_nCapacity : c_nMinCapacity ;
+                    while ( ( m_nSize + 1 ) * 2 > nNewCapacity )
+                        nNewCapacity *= 2 ;
+                    rehash( nNewCapacity ) ;
+                }
+                return free_slot( mix( nHash )) ;
+            }
+
+            void commit_insert( size_t nSlot, size_t nHash )
+            {
+                assert( m_pCtrl[nSlot] < c_Occupied ) ;
+                if ( m_pCtrl[nSlot] == c_Deleted )
+                    --m_nDeleted    ;
+                m_pCtrl[nSlot] = fingerprint( mix( nHash )) ;
+                ++m_nSize   ;
+            }
+
+            void erase( size_t nSlot )
+            {
+                assert( m_pCtrl[nSlot] >= c_Occupied ) ;
+                m_pSlots[nSlot].~value_type() ;
+                --m_nSize   ;
+
+                if ( m_nSize == 0 ) {
+                    // Cheap cleanup of all tombstones
+                    std::memset( m_pCtrl, c_Empty, m_nCapacity ) ;
+                    m_nDeleted = 0  ;
+                }
+                else if ( m_pCtrl[ ( nSlot + 1 ) & ( m_nCapacity - 1 ) ] == c_Empty ) {
+                    // No probe sequence passes through nSlot
+                    m_pCtrl[nSlot] = c_Empty    ;
+                }
+                else {
+                    m_pCtrl[nSlot] = c_Deleted  ;
+                    ++m_nDeleted    ;
+                }
+            }
+
+            value_type * slot( size_t nSlot )
+            {
+                return m_pSlots + nSlot ;
+            }
+
+            void clear()
+            {
+                if ( m_nCapacity ) {
+                    for ( size_t i = 0; i < m_nCapacity; ++i ) {
+                        if ( m_pCtrl[i] >= c_Occupied )
+                            m_pSlots[i].~value_type()  ;
+                    }
+                    ctrl_allocator().deallocate( m_pCtrl, m_nCapacity )  ;
+                    slot_allocator().deallocate( m_pSlots, m_nCapacity ) ;
+                    m_pCtrl = null_ptr<unsigned char *>()   ;
+                    m_pSlots = null_ptr<value_type *>()     ;
+                    m_nCapacity = m_nSize = m_nDeleted = 0  ;
+                }
+            }
+
+            size_t size() const
+            {
+                return m_nSize ;
+            }
+
+            iterator begin()                { return iterator( m_pCtrl, m_pCtrl + m_nCapacity, m_pSlots ); }
+            const_iterator begin() const    { return const_iterator( m_pCtrl, m_pCtrl + m_nCapacity, m_pSlots ); }
+            iterator end()                  { return iterator( m_pCtrl + m_nCapacity, m_pCtrl + m_nCapacity, m_pSlots + m_nCapacity ); }
+            const_iterator end() const      { return const_iterator( m_pCtrl + m_nCapacity, m_pCtrl + m_nCapacity, m_pSlots + m_nCapacity ); }
+        };
+
+    }   // namespace details
+    //@endcond
+
+}}} // namespace cds::container::striped_set
+
+//@cond
+namespace cds { namespace intrusive { namespace striped_set {
+
+    /// flat_bucket adapter for hash set bucket
+    template <typename T, class Alloc, CDS_SPEC_OPTIONS>
+    class adapt< cds::container::striped_set::flat_bucket< T, Alloc >, CDS_OPTIONS >
+    {
+    public:
+        typedef cds::container::striped_set::flat_bucket< T, Alloc >  container_type  ;   ///< underlying container type
+
+    private:
+        /// Adapted container type
+        class adapted_container: public cds::container::striped_set::adapted_sequential_container
+        {
+        public:
+            typedef typename container_type::value_type value_type  ;   ///< value type stored in the container
+
+            static bool const has_find_with = true     ;
+            static bool const has_erase_with = true    ;
+
+        private:
+            //@cond
+            typedef typename cds::opt::details::make_comparator_from_option_list< value_type, CDS_OPTIONS >::type key_comparator  ;
+            typedef typename cds::container::striped_set::details::make_hash_from_option_list< CDS_OPTIONS >::type hash ;
+
+            typedef cds::container::striped_set::details::flat_bucket_table< value_type, typename container_type::allocator_type, hash >  table_type ;
+
+            typedef typename cds::opt::select<
+                typename cds::opt::value<
+                    typename cds::opt::find_option<
+                        cds::opt::copy_policy< cds::container::striped_set::move_item >
+                        , CDS_OPTIONS
+                    >::type
+                >::copy_policy
+                , cds::container::striped_set::copy_item, cds::container::striped_set::copy_item_policy<container_type>
+                , cds::container::striped_set::swap_item, cds::container::striped_set::swap_item_policy<container_type>
+#ifdef CDS_MOVE_SEMANTICS_SUPPORT
+                , cds::container::striped_set::move_item, cds::container::striped_set::move_item_policy<container_type>
+#endif
+            >::type copy_item   ;
+
+            struct key_equal
+            {
+                template <typename Q>
+                bool operator()( value_type const& item, Q const& key ) const
+                {
+                    return key_comparator()( key, item ) == 0 ;
+                }
+            };
+
+            template <typename Less>
+            struct less_equal
+            {
+                Less    m_Less ;
+
+                less_equal( Less pred )
+                    : m_Less( pred )
+                {}
+
+                template <typename Q>
+                bool operator()( value_type const& item, Q const& key ) const
+                {
+                    return !m_Less( key, item ) && !m_Less( item, key ) ;
+                }
+            };
+            //@endcond
+
+        public:
+            typedef typename table_type::iterator       iterator        ;   ///< container iterator
+            typedef typename table_type::const_iterator const_iterator  ;   ///< container const iterator
+
+        private:
+            //@cond
+            table_type  m_Table ;
+            //@endcond
+
+        public:
+            template <typename Q, typename Func>
+            bool insert( const Q& val, Func f )
+            {
+                size_t const nHash = hash()( val ) ;
+                if ( m_Table.find( nHash, val, key_equal() ) != table_type::npos )
+                    return false ;
+
+                size_t nSlot = m_Table.prepare_insert( nHash ) ;
+                value_type * pItem = new ( m_Table.slot( nSlot )) value_type( val ) ;
+                m_Table.commit_insert( nSlot, nHash )   ;
+                cds::unref( f )( *pItem )   ;
+                return true ;
+            }
+
+#           ifdef CDS_EMPLACE_SUPPORT
+            template <typename... Args>
+            bool emplace( Args&&... args )
+            {
+                value_type val( std::forward<Args>(args)... )   ;
+                size_t const nHash = hash()( val ) ;
+                if ( m_Table.find( nHash, val, key_equal() ) != table_type::npos )
+                    return false ;
+
+                size_t nSlot = m_Table.prepare_insert( nHash ) ;
+                new ( m_Table.slot( nSlot )) value_type( std::move( val )) ;
+                m_Table.commit_insert( nSlot, nHash )   ;
+                return true ;
+            }
+#           endif
+
+            template <typename Q, typename Func>
+            std::pair<bool, bool> ensure( const Q& val, Func func )
+            {
+                size_t const nHash = hash()( val ) ;
+                size_t nSlot = m_Table.find( nHash, val, key_equal() ) ;
+                if ( nSlot != table_type::npos ) {
+                    // already exists
+                    cds::unref( func )( false, *m_Table.slot( nSlot ), val ) ;
+                    return std::make_pair( true, false )    ;
+                }
+
+                // insert new
+                nSlot = m_Table.prepare_insert( nHash ) ;
+                value_type * pItem = new ( m_Table.slot( nSlot )) value_type( val ) ;
+                m_Table.commit_insert( nSlot, nHash )   ;
+                cds::unref( func )( true, *pItem, val ) ;
+                return std::make_pair( true, true ) ;
+            }
+
+            template <typename Q, typename Func>
+            bool erase( const Q& key, Func f )
+            {
+                size_t nSlot = m_Table.find( hash()( key ), key, key_equal() ) ;
+                if ( nSlot == table_type::npos )
+                    return false ;
+
+                // key exists
+                cds::unref( f )( *m_Table.slot( nSlot ) ) ;
+                m_Table.erase( nSlot )  ;
+                return true ;
+            }
+
+            template <typename Q, typename Less, typename Func>
+            bool erase( const Q& key, Less pred, Func f )
+            {
+                size_t nSlot = m_Table.find( hash()( key ), key, less_equal<Less>( pred ) ) ;
+                if ( nSlot == table_type::npos )
+                    return false ;
+
+                // key exists
+                cds::unref( f )( *m_Table.slot( nSlot ) ) ;
+                m_Table.erase( nSlot )  ;
+                return true ;
+            }
+
+            template <typename Q, typename Func>
+            bool find( Q& val, Func f )
+            {
+                size_t nSlot = m_Table.find( hash()( val ), val, key_equal() ) ;
+                if ( nSlot == table_type::npos )
+                    return false ;
+
+                // key exists
+                cds::unref( f )( *m_Table.slot( nSlot ), val ) ;
+                return true ;
+            }
+
+            template <typename Q, typename Less, typename Func>
+            bool find( Q& val, Less pred, Func f )
+            {
+                size_t nSlot = m_Table.find( hash()( val ), val, less_equal<Less>( pred ) ) ;
+                if ( nSlot == table_type::npos )
+                    return false ;
+
+                // key exists
+                cds::unref( f )( *m_Table.slot( nSlot ), val ) ;
+                return true ;
+            }
+
+            void clear()
+            {
+                m_Table.clear() ;
+            }
+
+            iterator begin()                { return m_Table.begin(); }
+            const_iterator begin() const    { return m_Table.begin(); }
+            iterator end()                  { return m_Table.end(); }
+            const_iterator end() const      { return m_Table.end(); }
+
+            void move_item( adapted_container& /*from*/, iterator itWhat )
+            {
+                size_t const nHash = hash()( *itWhat ) ;
+                assert( m_Table.find( nHash, *itWhat, key_equal() ) == table_type::npos ) ;
+
+                size_t nSlot = m_Table.prepare_insert( nHash ) ;
+                copy_item()( m_Table.slot( nSlot ), *itWhat ) ;
+                m_Table.commit_insert( nSlot, nHash )   ;
+            }
+
+            size_t size() const
+            {
+                return m_Table.size() ;
+            }
+        };
+
+    public:
+        typedef adapted_container type ; ///< Result of \p adapt metafunction
+
+    };
+}}} // namespace cds::intrusive::striped_set
+//@endcond
+
+#endif // #ifndef __CDS_CONTAINER_STRIPED_SET_FLAT_BUCKET_ADAPTER_H
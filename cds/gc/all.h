@@ -15,5 +15,6 @@
 #include <cds/gc/hp.h>
 #include <cds/gc/hrc.h>
 #include <cds/gc/ptb.h>
+#include <cds/gc/ebr.h>
 
 #endif  // #ifndef __CDS_GC_ALL_H
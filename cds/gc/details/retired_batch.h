@@ -0,0 +1,104 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_GC_DETAILS_RETIRED_BATCH_H
+#define __CDS_GC_DETAILS_RETIRED_BATCH_H
+
+#include <cds/gc/details/retired_ptr.h>
+#include <cds/details/static_functor.h>
+#include <cds/details/allocator.h>
+#include <vector>
+
+namespace cds { namespace gc { namespace details {
+
+    /// Batch of retired pointers
+    /**
+        The batch accumulates pointers unlinked by a bulk operation (for example, \p clear() of a container)
+        and passes them to the garbage collector \p GC by single \p GC::retire_batch call.
+        Thus, the reclamation cycle (scan, liberate or RCU synchronization) is performed once per batch
+        instead of once per each \p nMaxRetiredPtrCount retired pointers.
+
+        The batch is thread-private. The pointers pushed must be unlinked from the container already;
+        \ref retire should be called outside of RCU read-side critical section for RCU-based \p GC.
+
+        Template arguments:
+        - \p GC - garbage collector type, it should support <tt>retire_batch( itFirst, itLast )</tt>
+            on the range of \p retired_ptr. For gc::HRC the specialization is provided, see hrc_decl.h
+        - \p Alloc - memory allocator, default is \ref CDS_DEFAULT_ALLOCATOR
+    */
+    template <class GC, class Alloc = CDS_DEFAULT_ALLOCATOR>
+    class retired_batch
+    {
+    public:
+        typedef GC  gc  ;   ///< Garbage collector
+
+    protected:
+        //@cond
+        typedef std::vector< retired_ptr, typename Alloc::template rebind<retired_ptr>::other > buffer_type ;
+        buffer_type     m_arr   ;
+        //@endcond
+
+    public:
+        //@cond
+        retired_batch()
+        {}
+
+        ~retired_batch()
+        {
+            retire() ;
+        }
+        //@endcond
+
+        /// Places pointer \p p with deleter \p pFunc to the batch
+        template <typename T>
+        void push( T * p, void (* pFunc)(T *) )
+        {
+            m_arr.push_back( retired_ptr( p, pFunc )) ;
+        }
+
+        /// Places pointer \p p with functor of type \p Disposer to the batch
+        template <class Disposer, typename T>
+        void push( T * p )
+        {
+            push( p, cds::details::static_functor<Disposer, T>::call ) ;
+        }
+
+        /// Passes all pointers of the batch to \p GC and clears the batch
+        void retire()
+        {
+            if ( !m_arr.empty() ) {
+                gc::retire_batch( m_arr.begin(), m_arr.end() ) ;
+                m_arr.clear() ;
+            }
+        }
+
+        /// Exchanges the content of the batch with \p other
+        void swap( retired_batch& other )
+        {
+            m_arr.swap( other.m_arr ) ;
+        }
+
+        /// Checks if the batch is empty
+        bool empty() const
+        {
+            return m_arr.empty() ;
+        }
+
+        /// Returns count of pointers in the batch
+        size_t size() const
+        {
+            return m_arr.size() ;
+        }
+    };
+
+}}} // namespace cds::gc::details
+
+#endif // #ifndef __CDS_GC_DETAILS_RETIRED_BATCH_H
@@ -0,0 +1,166 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_GC_DETAILS_RETIRED_MEMORY_H
+#define __CDS_GC_DETAILS_RETIRED_MEMORY_H
+
+#include <cds/cxx11_atomic.h>
+
+namespace cds { namespace gc { namespace details {
+
+    /// Snapshot of retired memory statistics
+    /**
+        The snapshot is returned by \p get_retired_memory_stat() function of \p cds::gc::HP, \p cds::gc::PTB
+        and of each \p cds::urcu::gc flavour.
+        The values are collected without any synchronization, so they are approximate in concurrent environment.
+    */
+    struct retired_memory_stat
+    {
+        size_t  nRetiredBytes       ;   ///< Bytes retired but not freed yet
+        size_t  nPeakRetiredBytes   ;   ///< Max value of \p nRetiredBytes reached
+        size_t  nCeiling            ;   ///< Current ceiling of retired memory, 0 - no limit
+        size_t  nCeilingHit         ;   ///< Count of forced reclamations because of the ceiling is exceeded
+
+        //@cond
+        retired_memory_stat()
+            : nRetiredBytes(0)
+            , nPeakRetiredBytes(0)
+            , nCeiling(0)
+            , nCeilingHit(0)
+        {}
+        //@endcond
+    };
+
+    /// Retired memory accounting
+    /**
+        The class counts the bytes of retired-but-not-freed objects. The size of a retired object is
+        taken from \ref retired_ptr::m_nSize; the objects of unknown size (\p m_nSize == 0) are not counted.
+
+        The ceiling is a soft limit: the garbage collector checks \ref exceeded() at retire time and,
+        if the ceiling is exceeded, forces the reclamation instead of deferring it.
+        The ceiling value 0 means "no limit" (the default).
+    */
+    class retired_memory
+    {
+        //@cond
+        CDS_ATOMIC::atomic<size_t>  m_nBytes    ;
+        CDS_ATOMIC::atomic<size_t>  m_nPeak     ;
+        CDS_ATOMIC::atomic<size_t>  m_nCeiling  ;
+        CDS_ATOMIC::atomic<size_t>  m_nCeilingHit   ;
+        //@endcond
+
+    public:
+        //@cond
+        retired_memory()
+        {
+            m_nBytes.store( 0, CDS_ATOMIC::memory_order_relaxed )       ;
+            m_nPeak.store( 0, CDS_ATOMIC::memory_order_relaxed )        ;
+            m_nCeiling.store( 0, CDS_ATOMIC::memory_order_relaxed )     ;
+            m_nCeilingHit.store( 0, CDS_ATOMIC::memory_order_relaxed )  ;
+        }
+        //@endcond
+
+        /// Adds \p nBytes to retired memory. Returns \p true if the ceiling is exceeded
+        bool add( size_t nBytes )
+        {
+            size_t nCur = m_nBytes.fetch_add( nBytes, CDS_ATOMIC::memory_order_relaxed ) + nBytes ;
+            update_peak( nCur ) ;
+            return exceeded( nCur ) ;
+        }
+
+        /// Subtracts \p nBytes from retired memory
+        void sub( size_t nBytes )
+        {
+            m_nBytes.fetch_sub( nBytes, CDS_ATOMIC::memory_order_relaxed ) ;
+        }
+
+        /// Sets retired memory to \p nBytes. Returns \p true if the ceiling is exceeded
+        /**
+            The function is intended for the garbage collectors that compute the total of retired memory
+            periodically (for example, Hazard Pointer GC computes it in the scan phase)
+        */
+        bool set( size_t nBytes )
+        {
+            m_nBytes.store( nBytes, CDS_ATOMIC::memory_order_relaxed ) ;
+            update_peak( nBytes ) ;
+            return exceeded( nBytes ) ;
+        }
+
+        /// Returns current count of retired bytes
+        size_t size() const
+        {
+            return m_nBytes.load( CDS_ATOMIC::memory_order_relaxed ) ;
+        }
+
+        /// Returns the ceiling, 0 - no limit
+        size_t ceiling() const
+        {
+            return m_nCeiling.load( CDS_ATOMIC::memory_order_relaxed ) ;
+        }
+
+        /// Sets the ceiling to \p nBytes, 0 - no limit
+        void ceiling( size_t nBytes )
+        {
+            m_nCeiling.store( nBytes, CDS_ATOMIC::memory_order_relaxed ) ;
+        }
+
+        /// Checks if current retired memory exceeds the ceiling
+        bool exceeded() const
+        {
+            return exceeded( size() ) ;
+        }
+
+        /// Checks if \p nBytes exceeds the ceiling
+        bool exceeded( size_t nBytes ) const
+        {
+            size_t nCeiling = ceiling() ;
+            return nCeiling && nBytes > nCeiling ;
+        }
+
+        /// Increments the counter of forced reclamations
+        void hit()
+        {
+            m_nCeilingHit.fetch_add( 1, CDS_ATOMIC::memory_order_relaxed ) ;
+        }
+
+        /// Checks if the ceiling is exceeded; if so, counts the forced reclamation and returns \p true
+        bool ceiling_hit()
+        {
+            if ( exceeded() ) {
+                hit() ;
+                return true ;
+            }
+            return false ;
+        }
+
+        /// Fills the statistics snapshot \p st
+        retired_memory_stat& get_stat( retired_memory_stat& st ) const
+        {
+            st.nRetiredBytes     = size()   ;
+            st.nPeakRetiredBytes = m_nPeak.load( CDS_ATOMIC::memory_order_relaxed ) ;
+            st.nCeiling          = ceiling();
+            st.nCeilingHit       = m_nCeilingHit.load( CDS_ATOMIC::memory_order_relaxed ) ;
+            return st ;
+        }
+
+    private:
+        //@cond
+        void update_peak( size_t nCur )
+        {
+            size_t nPeak = m_nPeak.load( CDS_ATOMIC::memory_order_relaxed ) ;
+            while ( nCur > nPeak && !m_nPeak.compare_exchange_weak( nPeak, nCur, CDS_ATOMIC::memory_order_relaxed, CDS_ATOMIC::memory_order_relaxed )) ;
+        }
+        //@endcond
+    };
+
+}}} // namespace cds::gc::details
+
+#endif // #ifndef __CDS_GC_DETAILS_RETIRED_MEMORY_H
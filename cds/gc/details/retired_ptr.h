@@ -31,6 +31,7 @@ namespace cds { namespace gc {
 
             pointer                 m_p    ;        ///< retired pointer
             free_retired_ptr_func   m_funcFree    ; ///< pointer to the destructor function
+            size_t                  m_nSize ;       ///< size of the object pointed by \p m_p in bytes, 0 if unknown
 
             /// Comparison of two retired pointers
             static bool less( const retired_ptr& p1, const retired_ptr& p2 )
@@ -42,19 +43,28 @@ namespace cds { namespace gc {
             retired_ptr()
                 : m_p( NULL )
                 , m_funcFree( NULL )
+                , m_nSize( 0 )
             {}
 
             /// Ctor
-            retired_ptr( pointer p, free_retired_ptr_func func )
+            /**
+                The object size \p nSize is used only for retired memory accounting, see \ref retired_memory.
+            */
+            retired_ptr( pointer p, free_retired_ptr_func func, size_t nSize = 0 )
                 : m_p( p ),
-                m_funcFree( func )
+                m_funcFree( func ),
+                m_nSize( nSize )
             {}
 
             /// Typecasting ctor
+            /**
+                The size of the object is assumed to be <tt>sizeof(T)</tt>
+            */
             template <typename T>
             retired_ptr( T * p, void (* pFreeFunc)(T *))
                 : m_p( reinterpret_cast<pointer>( p ) )
                 , m_funcFree( reinterpret_cast< free_retired_ptr_func >( pFreeFunc ))
+                , m_nSize( sizeof(T) )
             {}
 
             /// Assignment operator
@@ -62,6 +72,7 @@ namespace cds { namespace gc {
             {
                 m_p = s.m_p     ;
                 m_funcFree = s.m_funcFree   ;
+                m_nSize = s.m_nSize ;
                 return *this    ;
             }
 
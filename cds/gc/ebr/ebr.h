@@ -0,0 +1,661 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_GC_EBR_EBR_H
+#define __CDS_GC_EBR_EBR_H
+
+#include <cds/cxx11_atomic.h>
+#include <cds/os/thread.h>
+#include <cds/gc/details/retired_ptr.h>
+#include <cds/details/allocator.h>
+#include <cds/details/noncopyable.h>
+#include <iterator>     // std::distance
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC
+#   pragma warning(push)
+#   pragma warning(disable:4251)    // C4251: 'identifier' : class 'type' needs to have dll-interface to be used by clients of class 'type2'
+#endif
+
+namespace cds { namespace gc {
+
+    /// Epoch-based reclamation schema
+    /**
+        \par Sources:
+        - [2004] K. Fraser. Practical lock-freedom. PhD thesis, University of Cambridge, 2004
+        - [2007] T. E. Hart, P. E. McKenney, A. D. Brown, J. Walpole. Performance of memory reclamation
+            for lockless synchronization. Journal of Parallel and Distributed Computing, Vol.67, No.12, 2007
+
+        The cds::gc::ebr namespace and its members are internal representation of the epoch-based GC and should not be used directly.
+        Use cds::gc::EBR class in your code.
+
+        The GC maintains the global epoch counter. Each thread has a record in the global list of thread records;
+        the record contains the local epoch of the thread and the "active" flag.
+        A thread is active (that is, it is in the critical section) while it owns at least one guard.
+        When the thread becomes active it copies the global epoch to its local epoch; this is the only
+        store-load memory fence of the scheme. Unlike Hazard Pointers, the dereference of a guarded pointer
+        requires no fence at all: the guard just keeps the thread in the critical section.
+
+        A retired pointer is placed to the thread-private limbo list of the current global epoch.
+        The global epoch can be advanced from \p e to <tt>e + 1</tt> only when all active threads
+        have local epoch \p e. Therefore, the pointers retired in epoch \p e can be freed when the global epoch
+        reaches <tt>e + 2</tt>: no active thread can hold a reference to them. Each thread has three limbo lists
+        that are reused in round-robin manner.
+
+        The scheme is not robust: a thread that stays in the critical section too long (for example, a thread that holds
+        an iterator) blocks the advance of the global epoch, and no memory is freed until the thread leaves
+        the critical section.
+    */
+    namespace ebr {
+
+        // Forward declarations
+        class Guard ;
+        template <size_t Count> class GuardArray    ;
+        class ThreadGC  ;
+        class GarbageCollector  ;
+
+        /// Retired pointer type
+        typedef cds::gc::details::retired_ptr retired_ptr   ;
+
+        using cds::gc::details::free_retired_ptr_func   ;
+
+        /// Details of epoch-based reclamation
+        namespace details {
+
+            /// Count of limbo lists of the thread
+            static const size_t c_nLimboCount = 3 ;
+
+            /// Limbo list: the retired pointers of one epoch
+            /**
+                The list is thread-private. It is a growable array of retired pointers.
+            */
+            class limbo_list: public cds::details::noncopyable
+            {
+                typedef cds::details::Allocator< retired_ptr, CDS_DEFAULT_ALLOCATOR >  allocator_impl ;
+
+                retired_ptr *   m_arr       ;   ///< retired pointers
+                size_t          m_nCapacity ;   ///< capacity of \p m_arr
+                size_t          m_nSize     ;   ///< count of retired pointers
+                size_t          m_nEpoch    ;   ///< epoch of the pointers
+
+            public:
+                //@cond
+                limbo_list()
+                    : m_arr( null_ptr<retired_ptr *>() )
+                    , m_nCapacity( 0 )
+                    , m_nSize( 0 )
+                    , m_nEpoch( 0 )
+                {}
+
+                ~limbo_list()
+                {
+                    assert( m_nSize == 0 )  ;
+                    if ( m_arr )
+                        allocator_impl().Delete( m_arr, m_nCapacity )   ;
+                }
+                //@endcond
+
+                /// Epoch of the retired pointers in the list
+                size_t epoch() const
+                {
+                    return m_nEpoch ;
+                }
+
+                /// Sets new epoch of the list. The list must be empty
+                void epoch( size_t nEpoch )
+                {
+                    assert( m_nSize == 0 )  ;
+                    m_nEpoch = nEpoch   ;
+                }
+
+                /// Count of retired pointers in the list
+                size_t size() const
+                {
+                    return m_nSize  ;
+                }
+
+                /// Checks if the list is empty
+                bool empty() const
+                {
+                    return m_nSize == 0 ;
+                }
+
+                /// Appends retired pointer \p p
+                void push( retired_ptr const& p )
+                {
+                    if ( m_nSize == m_nCapacity )
+                        grow()  ;
+                    m_arr[ m_nSize++ ] = p  ;
+                }
+
+                /// Frees all retired pointers of the list and sets the epoch of the list to \p nNewEpoch
+                /**
+                    Returns the count of pointers freed
+                */
+                size_t free_all( size_t nNewEpoch )
+                {
+                    // A disposer may retire a pointer into this list,
+                    // so the array is detached from the list while the pointers are being freed
+                    retired_ptr * pArr = m_arr  ;
+                    size_t nCapacity = m_nCapacity  ;
+                    size_t nCount = m_nSize ;
+                    m_arr = null_ptr<retired_ptr *>()   ;
+                    m_nCapacity = m_nSize = 0   ;
+                    m_nEpoch = nNewEpoch    ;
+
+                    for ( size_t i = 0; i < nCount; ++i )
+                        pArr[i].free()  ;
+
+                    if ( m_arr == null_ptr<retired_ptr *>() ) {
+                        m_arr = pArr    ;
+                        m_nCapacity = nCapacity ;
+                    }
+                    else if ( pArr )
+                        allocator_impl().Delete( pArr, nCapacity )  ;
+                    return nCount   ;
+                }
+
+            private:
+                //@cond
+                void grow()
+                {
+                    size_t nCapacity = m_nCapacity ? m_nCapacity * 2 : 64   ;
+                    retired_ptr * pNew = allocator_impl().NewArray( nCapacity ) ;
+                    for ( size_t i = 0; i < m_nSize; ++i )
+                        pNew[i] = m_arr[i]  ;
+                    if ( m_arr )
+                        allocator_impl().Delete( m_arr, m_nCapacity )   ;
+                    m_arr = pNew    ;
+                    m_nCapacity = nCapacity ;
+                }
+                //@endcond
+            };
+
+            /// Thread record
+            /**
+                The record is allocated when the thread is attached to the GC. When the thread is detached,
+                its record is marked as free and can be reused by another thread. The limbo lists of the free record
+                are reclaimed by other threads or by the thread reusing the record.
+            */
+            struct thread_record
+            {
+                /// Local epoch of the thread: <tt>(epoch << 1) | active</tt>
+                CDS_ATOMIC::atomic<size_t>          m_nEpoch    ;
+                CDS_ATOMIC::atomic<OS::ThreadId>    m_idOwner   ;   ///< Owner thread id; 0 - the record is free
+                thread_record *                     m_pNext     ;   ///< next record in the list
+                limbo_list                          m_Limbo[ c_nLimboCount ] ;  ///< limbo lists, the list index is <tt>epoch % c_nLimboCount</tt>
+
+                //@cond
+                thread_record()
+                    : m_nEpoch( 0 )
+                    , m_idOwner( OS::nullThreadId() )
+                    , m_pNext( null_ptr<thread_record *>() )
+                {}
+                //@endcond
+
+                /// Total count of retired pointers in the limbo lists
+                size_t retired_count() const
+                {
+                    size_t nCount = 0   ;
+                    for ( size_t i = 0; i < c_nLimboCount; ++i )
+                        nCount += m_Limbo[i].size() ;
+                    return nCount   ;
+                }
+            };
+
+        } // namespace details
+
+        /// Auto guard
+        /**
+            The guard keeps the owner thread in the critical section from construction to destruction.
+            The pointer stored in the guard is thread-private: it is not visible to other threads
+            and it is not required for reclamation. It is stored only to support \p get() interface.
+        */
+        class Guard: public cds::details::noncopyable
+        {
+            //@cond
+            ThreadGC&   m_gc    ;
+            void *      m_p     ;
+            //@endcond
+
+        public:
+            /// Enters the critical section of \p gc
+            Guard( ThreadGC& gc )   ;   // inline
+            /// Leaves the critical section
+            ~Guard()    ;   // inline
+
+            /// Stores \p p to the guard
+            template <typename T>
+            T * operator =( T * p )
+            {
+                m_p = reinterpret_cast<void *>( p ) ;
+                return p    ;
+            }
+
+            /// Returns the pointer stored
+            void * get() const
+            {
+                return m_p  ;
+            }
+
+            /// Clears the guard
+            void clear()
+            {
+                m_p = null_ptr<void *>()    ;
+            }
+
+            /// Returns thread GC
+            ThreadGC& getGC() const
+            {
+                return m_gc ;
+            }
+        };
+
+        /// Array of guards
+        /**
+            The array enters the critical section once for all its \p Count slots.
+        */
+        template <size_t Count>
+        class GuardArray: public cds::details::noncopyable
+        {
+            //@cond
+            ThreadGC&   m_gc    ;
+            void *      m_arr[Count]    ;
+            //@endcond
+
+        public:
+            /// Rebind array for other size \p OtherCount
+            template <size_t OtherCount>
+            struct rebind {
+                typedef GuardArray<OtherCount>  other   ;   ///< rebinding result
+            };
+
+        public:
+            /// Enters the critical section of \p gc
+            GuardArray( ThreadGC& gc ) ;    // inline
+            /// Leaves the critical section
+            ~GuardArray()   ;   // inline
+
+            /// Stores \p p to the slot \p nIndex
+            template <typename T>
+            T * set( size_t nIndex, T * p )
+            {
+                assert( nIndex < Count )    ;
+                m_arr[nIndex] = reinterpret_cast<void *>( p )   ;
+                return p    ;
+            }
+
+            /// Returns the pointer stored in the slot \p nIndex
+            void * get( size_t nIndex ) const
+            {
+                assert( nIndex < Count )    ;
+                return m_arr[nIndex]    ;
+            }
+
+            /// Clears the slot \p nIndex
+            void clear( size_t nIndex )
+            {
+                assert( nIndex < Count )    ;
+                m_arr[nIndex] = null_ptr<void *>()  ;
+            }
+
+            /// Returns thread GC
+            ThreadGC& getGC() const
+            {
+                return m_gc ;
+            }
+
+            /// Capacity of the array
+            static CDS_CONSTEXPR size_t capacity()
+            {
+                return Count ;
+            }
+        };
+
+        /// Epoch-based memory manager (Garbage collector)
+        class CDS_EXPORT_API GarbageCollector
+        {
+        public:
+            typedef cds::atomicity::event_counter  event_counter   ;   ///< event counter type
+
+            /// Exception "No GarbageCollector object is created"
+            CDS_DECLARE_EXCEPTION( EBRManagerEmpty, "Global EBR GarbageCollector is NULL" )    ;
+
+            /// Internal GC statistics
+            struct InternalState
+            {
+                size_t      nGlobalEpoch        ;   ///< Current global epoch
+                size_t      nLimboThreshold     ;   ///< Limbo threshold (const)
+                size_t      nThreadRecCount     ;   ///< Count of thread records allocated
+                size_t      nThreadRecUsed      ;   ///< Count of thread records used
+                size_t      nRetiredPtrCount    ;   ///< Current count of retired pointers in the limbo lists
+
+                event_counter::value_type   evcScanCall         ;   ///< Count of scan calls
+                event_counter::value_type   evcEpochAdvance     ;   ///< Count of global epoch advances
+                event_counter::value_type   evcEpochBlocked     ;   ///< Count of failed attempts to advance the epoch because of an active thread
+                event_counter::value_type   evcFreedPtr         ;   ///< Count of retired pointers freed
+                event_counter::value_type   evcHelpFreedPtr     ;   ///< Count of retired pointers of free thread records freed by other threads
+            };
+
+        private:
+            //@cond
+            struct Statistics {
+                event_counter   m_ScanCall      ;
+                event_counter   m_EpochAdvance  ;
+                event_counter   m_EpochBlocked  ;
+                event_counter   m_FreedPtr      ;
+                event_counter   m_HelpFreedPtr  ;
+            };
+
+            static GarbageCollector *   m_pManager  ;   ///< GC global instance
+
+            CDS_ATOMIC::atomic<size_t>                      m_nGlobalEpoch  ;   ///< Global epoch
+            CDS_ATOMIC::atomic<details::thread_record *>    m_pListHead     ;   ///< Head of thread record list
+            const size_t    m_nLimboThreshold   ;   ///< Count of retired pointers of the thread to call scan
+
+            Statistics      m_Stat          ;   ///< Internal statistics
+            bool            m_bStatEnabled  ;   ///< true - statistics enabled
+            //@endcond
+
+        public:
+            /// Initializes EBR memory manager singleton
+            /**
+                This member function creates and initializes EBR global object.
+                The function should be called before using CDS data structure based on cds::gc::EBR GC. Usually,
+                this member function is called in the \p main() function.
+
+                \p nLimboThreshold - when the count of retired pointers of a thread reaches this value,
+                the thread tries to advance the global epoch and to free its limbo lists.
+                If the limbo lists cannot be freed (some thread stays in the critical section),
+                the next attempt is made after next \p nLimboThreshold retired pointers.
+            */
+            static void CDS_STDCALL Construct(
+                size_t nLimboThreshold = 1024   ///< Limbo threshold
+            ) ;
+
+            /// Destroys EBR memory manager
+            /**
+                The member function destroys EBR global object and frees all retired pointers.
+                After calling of this function you may \b NOT use CDS data structures based on cds::gc::EBR.
+                All threads should be detached before destroying the GC.
+            */
+            static void CDS_STDCALL Destruct()  ;
+
+            /// Returns pointer to GarbageCollector instance
+            /**
+                If EBR GC is not initialized, \p EBRManagerEmpty exception is thrown
+            */
+            static GarbageCollector&   instance()
+            {
+                if ( m_pManager == null_ptr<GarbageCollector *>() )
+                    throw EBRManagerEmpty()    ;
+                return *m_pManager   ;
+            }
+
+            /// Checks if global GC object is constructed and may be used
+            static bool isUsed() CDS_NOEXCEPT
+            {
+                return m_pManager != null_ptr<GarbageCollector *>()    ;
+            }
+
+            /// Returns limbo threshold defined in construction time
+            size_t getLimboThreshold() const
+            {
+                return m_nLimboThreshold    ;
+            }
+
+        public:
+            //@{
+            /// Internal interface
+
+            /// Allocates thread record for current thread
+            details::thread_record * AllocThreadRecord()  ;
+
+            /// Frees thread record \p pRec of current thread
+            void RetireThreadRecord( details::thread_record * pRec ) ;
+
+            /// Returns current global epoch
+            size_t epoch() const
+            {
+                return m_nGlobalEpoch.load( CDS_ATOMIC::memory_order_acquire )  ;
+            }
+
+            /// Reclamation cycle for \p pRec
+            /**
+                The function tries to advance the global epoch, then it frees the limbo lists of \p pRec
+                which are safe to free, and the limbo lists of free (not owned) thread records.
+            */
+            void Scan( details::thread_record * pRec )  ;
+            //@}
+
+        private:
+            //@cond
+            bool try_advance( size_t& nEpoch ) ;
+            size_t reclaim( details::thread_record * pRec, size_t nEpoch ) ;
+            void help_scan( details::thread_record * pThis, size_t nEpoch ) ;
+            //@endcond
+
+        public:
+            /// Get internal statistics
+            InternalState& getInternalState( InternalState& stat ) const ;
+
+            /// Checks if internal statistics enabled
+            bool              isStatisticsEnabled() const
+            {
+                return m_bStatEnabled   ;
+            }
+
+            /// Enables/disables internal statistics
+            bool  enableStatistics( bool bEnable )
+            {
+                bool bEnabled = m_bStatEnabled    ;
+                m_bStatEnabled = bEnable        ;
+                return bEnabled                    ;
+            }
+
+        private:
+            //@cond none
+            GarbageCollector( size_t nLimboThreshold )  ;
+            ~GarbageCollector() ;
+            //@endcond
+        };
+
+        /// Thread GC
+        /**
+            To use epoch-based reclamation schema each thread object must be linked with the object of ThreadGC class
+            that interacts with GarbageCollector global object. The linkage is performed by calling \ref cds_threading "cds::threading::Manager::attachThread()"
+            on the start of each thread that uses EBR GC. Before terminating the thread linked to EBR GC it is necessary to call
+            \ref cds_threading "cds::threading::Manager::detachThread()".
+
+            The critical section of the thread is reentrant: the thread is active while at least one guard is alive.
+        */
+        class ThreadGC: public cds::details::noncopyable
+        {
+            GarbageCollector&           m_gc            ;   ///< reference to GC singleton
+            details::thread_record *    m_pRec          ;   ///< thread record
+            size_t                      m_nNestCount    ;   ///< nesting level of the critical section
+            size_t                      m_nScanThreshold;   ///< retired pointer count to call scan
+
+        public:
+            ThreadGC()
+                : m_gc( GarbageCollector::instance() )
+                , m_pRec( null_ptr<details::thread_record *>() )
+                , m_nNestCount( 0 )
+                , m_nScanThreshold( 0 )
+            {}
+
+            /// Dtor calls fini()
+            ~ThreadGC()
+            {
+                fini()  ;
+            }
+
+            /// Initialization. Repeat call is available
+            void init()
+            {
+                if ( !m_pRec ) {
+                    m_pRec = m_gc.AllocThreadRecord() ;
+                    m_nScanThreshold = m_pRec->retired_count() + m_gc.getLimboThreshold() ;
+                }
+            }
+
+            /// Finalization. Repeat call is available
+            void fini()
+            {
+                if ( m_pRec ) {
+                    assert( m_nNestCount == 0 ) ;
+                    details::thread_record * pRec = m_pRec  ;
+                    m_pRec = null_ptr<details::thread_record *>() ;
+                    m_gc.RetireThreadRecord( pRec ) ;
+                }
+            }
+
+        public:
+            /// Enters the critical section
+            void enter()
+            {
+                assert( m_pRec != null_ptr<details::thread_record *>() )    ;
+                if ( m_nNestCount++ == 0 ) {
+                    // Announce the global epoch. If the epoch has been changed before the announcement
+                    // becomes visible, announce it again
+                    size_t nEpoch = m_gc.epoch()    ;
+                    for (;;) {
+                        m_pRec->m_nEpoch.store( (nEpoch << 1) | 1, CDS_ATOMIC::memory_order_relaxed )   ;
+                        CDS_ATOMIC::atomic_thread_fence( CDS_ATOMIC::memory_order_seq_cst ) ;
+                        size_t nCurEpoch = m_gc.epoch() ;
+                        if ( nCurEpoch == nEpoch )
+                            break   ;
+                        nEpoch = nCurEpoch  ;
+                    }
+                }
+            }
+
+            /// Leaves the critical section
+            void leave()
+            {
+                assert( m_nNestCount > 0 )  ;
+                if ( --m_nNestCount == 0 )
+                    m_pRec->m_nEpoch.store( 0, CDS_ATOMIC::memory_order_release )   ;
+            }
+
+            /// Checks if the thread is in the critical section
+            bool is_active() const
+            {
+                return m_nNestCount > 0 ;
+            }
+
+            /// Places retired pointer \p and its deleter \p pFunc into the limbo list for deferred reclamation
+            template <typename T>
+            void retirePtr( T * p, void (* pFunc)(T *) )
+            {
+                retirePtr( retired_ptr( p, pFunc ))    ;
+            }
+
+            /// Places retired pointer \p into the limbo list for deferred reclamation
+            void retirePtr( retired_ptr const& p )
+            {
+                limbo( current_epoch() ).push( p )  ;
+                check_threshold()   ;
+            }
+
+            /// Places the range [\p itFirst, \p itLast) of retired pointers into the limbo list
+            /**
+                The value type of \p ForwardIterator should be convertible to \ref retired_ptr.
+                The whole range goes to the limbo list of the same epoch, the threshold is checked once per range.
+            */
+            template <typename ForwardIterator>
+            void retirePtr( ForwardIterator itFirst, ForwardIterator itLast )
+            {
+                if ( itFirst == itLast )
+                    return  ;
+                details::limbo_list& l = limbo( current_epoch() )  ;
+                for ( ; itFirst != itLast; ++itFirst )
+                    l.push( *itFirst )  ;
+                check_threshold()   ;
+            }
+
+            //@cond
+            void scan()
+            {
+                m_gc.Scan( m_pRec ) ;
+                m_nScanThreshold = m_pRec->retired_count() + m_gc.getLimboThreshold() ;
+            }
+            //@endcond
+
+        private:
+            //@cond
+            size_t current_epoch() const
+            {
+                // The retired pointer is unlinked already. The fence orders the unlinking
+                // before the epoch reading, so any thread that can see the pointer has entered
+                // its critical section no later than the epoch read.
+                CDS_ATOMIC::atomic_thread_fence( CDS_ATOMIC::memory_order_seq_cst ) ;
+                return m_gc.epoch() ;
+            }
+
+            details::limbo_list& limbo( size_t nEpoch )
+            {
+                details::limbo_list& l = m_pRec->m_Limbo[ nEpoch % details::c_nLimboCount ] ;
+                if ( l.epoch() != nEpoch ) {
+                    // The list contains the pointers of epoch nEpoch - c_nLimboCount or older,
+                    // they are safe to free
+                    assert( l.empty() || l.epoch() + details::c_nLimboCount <= nEpoch ) ;
+                    if ( l.empty() )
+                        l.epoch( nEpoch )   ;
+                    else
+                        l.free_all( nEpoch )    ;
+                }
+                return l    ;
+            }
+
+            void check_threshold()
+            {
+                if ( m_pRec->retired_count() >= m_nScanThreshold )
+                    scan()  ;
+            }
+            //@endcond
+        };
+
+        //////////////////////////////////////////////////////////
+        // Inlines
+
+        inline Guard::Guard( ThreadGC& gc )
+            : m_gc( gc )
+            , m_p( null_ptr<void *>() )
+        {
+            gc.enter()  ;
+        }
+        inline Guard::~Guard()
+        {
+            m_gc.leave()    ;
+        }
+
+        template <size_t Count>
+        inline GuardArray<Count>::GuardArray( ThreadGC& gc )
+            : m_gc( gc )
+        {
+            for ( size_t i = 0; i < Count; ++i )
+                m_arr[i] = null_ptr<void *>()   ;
+            gc.enter()  ;
+        }
+        template <size_t Count>
+        inline GuardArray<Count>::~GuardArray()
+        {
+            m_gc.leave()    ;
+        }
+
+    }   // namespace ebr
+}}  // namespace cds::gc
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC
+#   pragma warning(pop)
+#endif
+
+#endif // #ifndef __CDS_GC_EBR_EBR_H
@@ -0,0 +1,459 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_GC_EBR_DECL_H
+#define __CDS_GC_EBR_DECL_H
+
+#include <cds/gc/ebr/ebr.h>
+#include <cds/details/marked_ptr.h>
+#include <cds/details/static_functor.h>
+
+namespace cds { namespace gc {
+
+    /// Epoch-based garbage collector
+    /**  @ingroup cds_garbage_collector
+        @headerfile cds/gc/ebr.h
+        This class is a wrapper for epoch-based reclamation (EBR) internal implementation, see cds::gc::ebr.
+
+        Sources:
+        - [2004] K. Fraser. Practical lock-freedom. PhD thesis, University of Cambridge, 2004
+        - [2007] T. E. Hart, P. E. McKenney, A. D. Brown, J. Walpole. Performance of memory reclamation
+            for lockless synchronization. Journal of Parallel and Distributed Computing, Vol.67, No.12, 2007
+
+        The class has the same interface as cds::gc::HP, so any container that supports cds::gc::HP
+        may be instantiated with cds::gc::EBR. The difference is in the guard semantics.
+        A guard of cds::gc::HP publishes the pointer guarded; that requires a store-load memory fence for each pointer protected.
+        A guard of cds::gc::EBR just keeps the current thread in the critical section:
+        the thread announces the global epoch when its first guard is constructed
+        and all pointers read while the thread owns a guard are safe. So \p protect is a simple atomic load.
+        The price is that a thread staying too long in the critical section blocks the reclamation
+        for all threads, and the count of retired pointers is unbounded in this case.
+
+        EBR is a good choice for read-mostly data structures with short operations.
+        Do not keep an iterator of a container based on cds::gc::EBR for a long time.
+
+        See \ref cds_how_to_use "How to use" section for details of garbage collector applying.
+    */
+    class EBR
+    {
+    public:
+        /// Native guarded pointer type
+        typedef void * guarded_pointer ;
+
+#ifdef CDS_CXX11_TEMPLATE_ALIAS_SUPPORT
+        /// Atomic reference
+        /**
+            @headerfile cds/gc/ebr.h
+        */
+        template <typename T> using atomic_ref = CDS_ATOMIC::atomic<T *> ;
+
+        /// Atomic type
+        /**
+            @headerfile cds/gc/ebr.h
+        */
+        template <typename T> using atomic_type = CDS_ATOMIC::atomic<T> ;
+
+        /// Atomic marked pointer
+        /**
+            @headerfile cds/gc/ebr.h
+        */
+        template <typename MarkedPtr> using atomic_marked_ptr = CDS_ATOMIC::atomic<MarkedPtr> ;
+#else
+        template <typename T>
+        class atomic_ref: public CDS_ATOMIC::atomic<T *>
+        {
+            typedef CDS_ATOMIC::atomic<T *> base_class ;
+        public:
+#   ifdef CDS_CXX11_EXPLICITLY_DEFAULTED_FUNCTION_SUPPORT
+            atomic_ref() = default;
+#   else
+            atomic_ref()
+                : base_class()
+            {}
+#   endif
+            explicit CDS_CONSTEXPR atomic_ref(T * p) CDS_NOEXCEPT
+                : base_class( p )
+            {}
+        };
+
+        template <typename T>
+        class atomic_type: public CDS_ATOMIC::atomic<T>
+        {
+            typedef CDS_ATOMIC::atomic<T> base_class ;
+        public:
+#   ifdef CDS_CXX11_EXPLICITLY_DEFAULTED_FUNCTION_SUPPORT
+            atomic_type() = default;
+#   else
+            atomic_type() CDS_NOEXCEPT
+                : base_class()
+            {}
+#   endif
+            explicit CDS_CONSTEXPR atomic_type(T const & v) CDS_NOEXCEPT
+                : base_class( v )
+            {}
+        };
+
+        template <typename MarkedPtr>
+        class atomic_marked_ptr: public CDS_ATOMIC::atomic<MarkedPtr>
+        {
+            typedef CDS_ATOMIC::atomic<MarkedPtr> base_class ;
+        public:
+#   ifdef CDS_CXX11_EXPLICITLY_DEFAULTED_FUNCTION_SUPPORT
+            atomic_marked_ptr() = default;
+#   else
+            atomic_marked_ptr()
+                : base_class()
+            {}
+#   endif
+            explicit CDS_CONSTEXPR atomic_marked_ptr(MarkedPtr val) CDS_NOEXCEPT
+                : base_class( val )
+            {}
+            explicit CDS_CONSTEXPR atomic_marked_ptr(typename MarkedPtr::value_type * p) CDS_NOEXCEPT
+                : base_class( p )
+            {}
+        };
+#endif
+
+        /// Retired pointer type
+        typedef cds::gc::details::retired_ptr   retired_ptr ;
+
+        /// Thread GC implementation for internal usage
+        typedef ebr::ThreadGC   thread_gc_impl  ;
+
+        /// Wrapper for ebr::ThreadGC class
+        /**
+            @headerfile cds/gc/ebr.h
+            This class performs automatically attaching/detaching epoch-based GC
+            for the current thread.
+        */
+        class thread_gc: public thread_gc_impl
+        {
+            //@cond
+            bool    m_bPersistent   ;
+            //@endcond
+        public:
+            /// Constructor
+            /**
+                The constructor attaches the current thread to the epoch-based GC
+                if it is not yet attached.
+                The \p bPersistent parameter specifies attachment persistence:
+                - \p true - the class destructor will not detach the thread from epoch-based GC.
+                - \p false (default) - the class destructor will detach the thread from epoch-based GC.
+            */
+            thread_gc(
+                bool    bPersistent = false
+            )   ;   // inline in ebr_impl.h
+
+            /// Destructor
+            /**
+                If the object has been created in persistent mode, the destructor does nothing.
+                Otherwise it detaches the current thread from epoch-based GC.
+            */
+            ~thread_gc()    ;   // inline in ebr_impl.h
+        };
+
+        /// Base for container node
+        /**
+            @headerfile cds/gc/ebr.h
+            This struct is empty for epoch-based GC
+        */
+        struct container_node
+        {};
+
+        /// Epoch-based guard
+        /**
+            @headerfile cds/gc/ebr.h
+            This class is a wrapper for ebr::Guard.
+            The constructor enters the critical section of the current thread, the destructor leaves it.
+        */
+        class Guard: public ebr::Guard
+        {
+            //@cond
+            typedef ebr::Guard base_class  ;
+            //@endcond
+
+        public:
+            //@cond
+            Guard() ;   // inline in ebr_impl.h
+            //@endcond
+
+            /// Protects a pointer of type <tt> atomic<T*> </tt>
+            /**
+                Return the value of \p toGuard
+
+                Since the thread is in the critical section, the function just loads \p toGuard
+                and stores it in the guard. No loop and no memory fence is needed.
+            */
+            template <typename T>
+            T protect( CDS_ATOMIC::atomic<T> const& toGuard )
+            {
+                T pCur = toGuard.load(CDS_ATOMIC::memory_order_acquire) ;
+                assign( pCur )  ;
+                return pCur ;
+            }
+
+            /// Protects a converted pointer of type <tt> atomic<T*> </tt>
+            /**
+                Return the value of \p toGuard
+
+                The function loads \p toGuard and stores result of \p f functor to the guard.
+
+                The function is useful for intrusive containers when \p toGuard is a node pointer
+                that should be converted to a pointer to the value type before guarding.
+                The parameter \p f of type Func is a functor that makes this conversion:
+                \code
+                    struct functor {
+                        value_type * operator()( T * p ) ;
+                    };
+                \endcode
+            */
+            template <typename T, class Func>
+            T protect( CDS_ATOMIC::atomic<T> const& toGuard, Func f )
+            {
+                T pCur = toGuard.load(CDS_ATOMIC::memory_order_acquire) ;
+                assign( f( pCur ) ) ;
+                return pCur ;
+            }
+
+            /// Store \p p to the guard
+            template <typename T>
+            T * assign( T * p )
+            {
+                return base_class::operator =(p) ;
+            }
+
+            /// Store marked pointer \p p to the guard
+            template <typename T, int BITMASK>
+            T * assign( cds::details::marked_ptr<T, BITMASK> p )
+            {
+                return base_class::operator =( p.ptr() ) ;
+            }
+
+            /// Copy from \p src guard to \p this guard
+            void copy( Guard const& src )
+            {
+                assign( src.get_native() ) ;
+            }
+
+            /// Clear value of the guard
+            void clear()
+            {
+                base_class::clear() ;
+            }
+
+            /// Get the value currently stored
+            template <typename T>
+            T * get() const
+            {
+                return reinterpret_cast<T *>( get_native() )   ;
+            }
+
+            /// Get native guarded pointer stored
+            guarded_pointer get_native() const
+            {
+                return base_class::get() ;
+            }
+        };
+
+        /// Array of epoch-based guards
+        /**
+            @headerfile cds/gc/ebr.h
+            This class is a wrapper for ebr::GuardArray template.
+            Template parameter \p Count defines the size of the array.
+        */
+        template <size_t Count>
+        class GuardArray: public ebr::GuardArray<Count>
+        {
+            //@cond
+            typedef ebr::GuardArray<Count> base_class   ;
+            //@endcond
+        public:
+            /// Rebind array for other size \p OtherCount
+            template <size_t OtherCount>
+            struct rebind {
+                typedef GuardArray<OtherCount>  other   ;   ///< rebinding result
+            };
+
+        public:
+            //@cond
+            GuardArray()    ;   // inline in ebr_impl.h
+            //@endcond
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function loads \p toGuard and stores it to the slot \p nIndex
+            */
+            template <typename T>
+            T protect(size_t nIndex, CDS_ATOMIC::atomic<T> const& toGuard )
+            {
+                T pRet = toGuard.load(CDS_ATOMIC::memory_order_acquire) ;
+                assign( nIndex, pRet )  ;
+                return pRet ;
+            }
+
+            /// Protects a pointer of type \p atomic<T*>
+            /**
+                Return the value of \p toGuard
+
+                The function loads \p toGuard and stores result of \p f functor to the slot \p nIndex.
+                The functor \p f converts a node pointer to the pointer to the value type, see Guard::protect.
+            */
+            template <typename T, class Func>
+            T protect(size_t nIndex, CDS_ATOMIC::atomic<T> const& toGuard, Func f )
+            {
+                T pRet = toGuard.load(CDS_ATOMIC::memory_order_acquire) ;
+                assign( nIndex, f( pRet ))  ;
+                return pRet ;
+            }
+
+            /// Store \p to the slot \p nIndex
+            template <typename T>
+            T * assign( size_t nIndex, T * p )
+            {
+                return base_class::set(nIndex, p) ;
+            }
+
+            /// Store marked pointer \p p to the slot \p nIndex
+            template <typename T, int Bitmask>
+            T * assign( size_t nIndex, cds::details::marked_ptr<T, Bitmask> p )
+            {
+                return base_class::set( nIndex, p.ptr() ) ;
+            }
+
+            /// Copy guarded value from \p src guard to slot at index \p nIndex
+            void copy( size_t nIndex, Guard const& src )
+            {
+                assign( nIndex, src.get_native() ) ;
+            }
+
+            /// Copy guarded value from slot \p nSrcIndex to slot at index \p nDestIndex
+            void copy( size_t nDestIndex, size_t nSrcIndex )
+            {
+                assign( nDestIndex, get_native( nSrcIndex )) ;
+            }
+
+            /// Clear value of the slot \p nIndex
+            void clear( size_t nIndex)
+            {
+                base_class::clear( nIndex );
+            }
+
+            /// Get current value of slot \p nIndex
+            template <typename T>
+            T * get( size_t nIndex) const
+            {
+                return reinterpret_cast<T *>( get_native( nIndex ) )   ;
+            }
+
+            /// Get native guarded pointer stored
+            guarded_pointer get_native( size_t nIndex ) const
+            {
+                return base_class::get( nIndex ) ;
+            }
+
+            /// Capacity of the guard array
+            static CDS_CONSTEXPR size_t capacity()
+            {
+                return Count ;
+            }
+        };
+
+    public:
+        /// Initializes ebr::GarbageCollector singleton
+        /**
+            The constructor calls GarbageCollector::Construct with passed parameters.
+            See ebr::GarbageCollector::Construct for explanation of parameters meaning.
+        */
+        EBR(
+            size_t nLimboThreshold = 1024
+        )
+        {
+            ebr::GarbageCollector::Construct( nLimboThreshold ) ;
+        }
+
+        /// Terminates ebr::GarbageCollector singleton
+        /**
+            The destructor calls \code ebr::GarbageCollector::Destruct() \endcode
+        */
+        ~EBR()
+        {
+            ebr::GarbageCollector::Destruct()  ;
+        }
+
+        /// Checks if count of guards is no less than \p nCountNeeded
+        /**
+            The function always returns \p true since the guards of epoch-based GC
+            are thread-private and their count is unlimited.
+        */
+        static bool check_available_guards( size_t nCountNeeded, bool /*bRaiseException*/ = true )
+        {
+            CDS_UNUSED( nCountNeeded ) ;
+            return true ;
+        }
+
+        /// Retire pointer \p p with function \p pFunc
+        /**
+            The function places pointer \p p to the limbo list of the current epoch.
+            The pointer is freed when no thread can hold a reference to it, i.e. after two epoch advances.
+            Deleting the pointer is the function \p pFunc call.
+        */
+        template <typename T>
+        static void retire( T * p, void (* pFunc)(T *) )    ;   // inline in ebr_impl.h
+
+        /// Retire pointer \p p with functor of type \p Disposer
+        /**
+            See gc::HP::retire for \p Disposer requirements.
+        */
+        template <class Disposer, typename T>
+        static void retire( T * p )
+        {
+            retire( p, cds::details::static_functor<Disposer, T>::call ) ;
+        }
+
+        /// Retire the range [\p itFirst, \p itLast) of retired pointers
+        /**
+            The value type of \p ForwardIterator should be convertible to \ref retired_ptr.
+            The whole range is placed into the limbo list of the current epoch.
+
+            Usually, the function is called by cds::gc::details::retired_batch helper class.
+        */
+        template <typename ForwardIterator>
+        static void retire_batch( ForwardIterator itFirst, ForwardIterator itLast ) ;   // inline in ebr_impl.h
+
+        /// Checks if epoch-based GC is constructed and may be used
+        static bool isUsed()
+        {
+            return ebr::GarbageCollector::isUsed() ;
+        }
+
+        /// Forced GC cycle call for current thread
+        /**
+            Usually, this function should not be called directly.
+
+            \p scan makes one attempt to advance the global epoch and frees the pointers that are safe to free.
+            \p force_dispose advances the epoch twice, so all pointers retired by the current thread
+            before the call are freed if no thread is in the critical section.
+        */
+        //@{
+        static void scan()  ;   // inline in ebr_impl.h
+        static void force_dispose()
+        {
+            for ( size_t i = 1; i < ebr::details::c_nLimboCount; ++i )
+                scan() ;
+        }
+        //@}
+    };
+
+}} // namespace cds::gc
+
+#endif // #ifndef __CDS_GC_EBR_DECL_H
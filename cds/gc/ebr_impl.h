@@ -0,0 +1,64 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_GC_EBR_IMPL_H
+#define __CDS_GC_EBR_IMPL_H
+
+#include <cds/threading/model.h>
+
+//@cond
+namespace cds { namespace gc {
+
+    inline EBR::thread_gc::thread_gc(
+        bool    bPersistent
+        )
+        : m_bPersistent( bPersistent )
+    {
+        if ( !cds::threading::Manager::isThreadAttached() )
+            cds::threading::Manager::attachThread() ;
+    }
+
+    inline EBR::thread_gc::~thread_gc()
+    {
+        if ( !m_bPersistent )
+            cds::threading::Manager::detachThread() ;
+    }
+
+    inline EBR::Guard::Guard()
+        : Guard::base_class( cds::threading::getGC<EBR>() )
+    {}
+
+    template <size_t COUNT>
+    inline EBR::GuardArray<COUNT>::GuardArray()
+        : GuardArray::base_class( cds::threading::getGC<EBR>() )
+    {}
+
+    template <typename T>
+    inline void EBR::retire( T * p, void (* pFunc)(T *) )
+    {
+        cds::threading::getGC<EBR>().retirePtr( p, pFunc ) ;
+    }
+
+    template <typename ForwardIterator>
+    inline void EBR::retire_batch( ForwardIterator itFirst, ForwardIterator itLast )
+    {
+        cds::threading::getGC<EBR>().retirePtr( itFirst, itLast ) ;
+    }
+
+    inline void EBR::scan()
+    {
+        cds::threading::getGC<EBR>().scan()  ;
+    }
+
+}} // namespace cds::gc
+//@endcond
+
+#endif // #ifndef __CDS_GC_EBR_IMPL_H
@@ -19,6 +19,7 @@ namespace cds { namespace gc {
     class HP    ;
     class HRC   ;
     class PTB   ;
+    class EBR   ;
 
     class nogc  ;
 }} // namespace cds::gc
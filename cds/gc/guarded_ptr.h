@@ -0,0 +1,168 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_GC_GUARDED_PTR_H
+#define __CDS_GC_GUARDED_PTR_H
+
+#include <cds/details/defs.h>
+
+namespace cds { namespace gc {
+
+    //@cond
+    namespace details {
+        template <typename GuardedType, typename ValueType>
+        struct trivial_guarded_cast {
+            ValueType * operator()( GuardedType * p ) const
+            {
+                return p ;
+            }
+        };
+    } // namespace details
+    //@endcond
+
+    /// Guarded pointer
+    /**
+        A guarded pointer is a pair of the pointer and GC's guard.
+        Usually, it is used for returning a pointer to the item from an lock-free container.
+        The guard prevents the pointer to be early disposed (freed) by GC.
+        After destructing \p %guarded_ptr object the pointer can be disposed (freed) automatically at any time.
+
+        The guarded pointer is move-only: the copy constructor and the copy assignment are prohibited,
+        moving the guarded pointer copies the guarded value into the guard of the destination and
+        clears the guard of the source. If the compiler does not support move semantics
+        the guarded pointer can be passed only by reference.
+
+        Template arguments:
+        - \p GC - a garbage collector type like cds::gc::HP and any other from cds::gc namespace
+        - \p GuardedType - a type which the guard stores
+        - \p ValueType - a value type
+        - \p Cast - a functor for converting <tt>GuardedType*</tt> to <tt>ValueType*</tt>.
+            Default is the trivial conversion that requires \p GuardedType* be implicitly convertible to \p ValueType*.
+            For example, non-intrusive containers guard the node and use \p Cast functor to get the value
+            stored in the node:
+            \code
+            struct node_to_value_cast {
+                value_type * operator()( node_type * p ) const
+                {
+                    return p ? &p->m_Value : null_ptr<value_type *>() ;
+                }
+            };
+            \endcode
+
+        The guarded pointer stores a guard of \p GC, so it occupies one hazard pointer slot for gc::HP
+        while it is not empty. The object of \p %guarded_ptr should be destroyed in the thread
+        that has created it.
+
+        @note For intrusive containers the item obtained by \p extract() is unlinked from the container
+        but it is not yet passed to the disposer. The disposer is called by GC
+        after the guarded pointer is released.
+    */
+    template <class GC, typename GuardedType, typename ValueType = GuardedType,
+        typename Cast = details::trivial_guarded_cast< GuardedType, ValueType > >
+    class guarded_ptr
+    {
+    public:
+        typedef GC          gc           ;   ///< Garbage collector like cds::gc::HP and any other from cds::gc namespace
+        typedef GuardedType guarded_type ;   ///< Guarded type
+        typedef ValueType   value_type   ;   ///< Value type
+        typedef Cast        value_cast   ;   ///< Functor for casting \p guarded_type to \p value_type
+
+    private:
+        //@cond
+        typename gc::Guard  m_guard ;
+        //@endcond
+
+    public:
+        /// Creates empty guarded pointer
+        guarded_ptr()
+        {}
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Move constructor
+        guarded_ptr( guarded_ptr&& src )
+        {
+            m_guard.copy( src.m_guard ) ;
+            src.release() ;
+        }
+
+        /// Move assignment
+        guarded_ptr& operator=( guarded_ptr&& src )
+        {
+            if ( &src != this ) {
+                m_guard.copy( src.m_guard ) ;
+                src.release() ;
+            }
+            return *this ;
+        }
+#   endif
+
+        /// Clears the guarded pointer
+        /**
+            \ref release is called if guarded pointer is not \ref empty
+        */
+        ~guarded_ptr()
+        {
+            release() ;
+        }
+
+        /// Returns a pointer to guarded value
+        value_type * operator ->() const
+        {
+            return get() ;
+        }
+
+        /// Returns a reference to guarded value
+        value_type& operator *() const
+        {
+            assert( !empty() ) ;
+            return *get() ;
+        }
+
+        /// Returns a pointer to guarded value or \p NULL if the guarded pointer is empty
+        value_type * get() const
+        {
+            guarded_type * p = m_guard.template get<guarded_type>() ;
+            return p ? value_cast()( p ) : null_ptr<value_type *>() ;
+        }
+
+        /// Checks if the guarded pointer is \p NULL
+        bool empty() const
+        {
+            return m_guard.template get<guarded_type>() == null_ptr<guarded_type *>() ;
+        }
+
+        /// Clears guarded pointer
+        /**
+            After calling this function the pointer may be freed by GC at any time.
+        */
+        void release()
+        {
+            m_guard.clear() ;
+        }
+
+        //@cond
+        // For internal use only!!!
+        typename gc::Guard& guard()
+        {
+            return m_guard ;
+        }
+        //@endcond
+
+    private:
+        //@cond
+        guarded_ptr( guarded_ptr const& ) CDS_DELETE_SPECIFIER ;
+        guarded_ptr& operator=( guarded_ptr const& ) CDS_DELETE_SPECIFIER ;
+        //@endcond
+    };
+
+}} // namespace cds::gc
+
+#endif // #ifndef __CDS_GC_GUARDED_PTR_H
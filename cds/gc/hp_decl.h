@@ -111,6 +111,12 @@ namespace cds { namespace gc {
         };
 #endif
 
+        /// Retired pointer type
+        typedef cds::gc::details::retired_ptr   retired_ptr ;
+
+        /// Retired memory statistics, see \ref get_retired_memory_stat
+        typedef cds::gc::details::retired_memory_stat   retired_memory_stat ;
+
         /// Thread GC implementation for internal usage
         typedef hzp::ThreadGC   thread_gc_impl  ;
 
@@ -411,19 +417,32 @@ namespace cds { namespace gc {
             - \p nMaxThreadCount - max count of thread with using Hazard Pointer GC in your application. Default is 100.
             - \p nMaxRetiredPtrCount - capacity of array of retired pointers for each thread. Must be greater than
                 <tt> nHazardPtrCount * nMaxThreadCount </tt>. Default is <tt>2 * nHazardPtrCount * nMaxThreadCount </tt>.
+
+            If \p bDynamicHPRec is \p true, the count of threads and the count of hazard pointers per thread
+            are unlimited: hazard pointers are allocated in growable per-thread blocks of \p nHazardPtrCount items
+            and the records of terminated threads are removed from the HP list.
+            See \ref hzp::GarbageCollector::Construct for details.
+
+            If \p nDisposeQueueCapacity is not zero, the full retired arrays are reclaimed by the background
+            reclamation thread; up to \p nDisposeQueueCapacity arrays may wait for the thread,
+            after that the retiring thread scans its array itself.
         */
         HP(
             size_t nHazardPtrCount = 0,     ///< Hazard pointer count per thread
             size_t nMaxThreadCount = 0,     ///< Max count of simultaneous working thread in your application
             size_t nMaxRetiredPtrCount = 0, ///< Capacity of the array of retired objects for the thread
-            hzp::scan_type nScanType = hzp::inplace   ///< Scan type (see \ref hzp::scan_type enum)
+            hzp::scan_type nScanType = hzp::inplace,   ///< Scan type (see \ref hzp::scan_type enum)
+            bool bDynamicHPRec = false,     ///< Dynamic HP record pool mode
+            size_t nDisposeQueueCapacity = 0    ///< Capacity of the reclamation thread queue, 0 - no background reclamation
         )
         {
             hzp::GarbageCollector::Construct(
                 nHazardPtrCount,
                 nMaxThreadCount,
                 nMaxRetiredPtrCount,
-                nScanType
+                nScanType,
+                bDynamicHPRec,
+                nDisposeQueueCapacity
             )   ;
         }
 
@@ -443,7 +462,8 @@ namespace cds { namespace gc {
         */
         static bool check_available_guards( size_t nCountNeeded, bool bRaiseException = true )
         {
-            if ( hzp::GarbageCollector::instance().getHazardPointerCount() < nCountNeeded ) {
+            hzp::GarbageCollector& gc = hzp::GarbageCollector::instance() ;
+            if ( !gc.isDynamicHPRec() && gc.getHazardPointerCount() < nCountNeeded ) {
                 if ( bRaiseException )
                     throw cds::gc::too_little_hazard_pointers() ;
                 return false ;
@@ -512,6 +532,19 @@ namespace cds { namespace gc {
         template <class Disposer, typename T>
         static void retire( T * p ) ;   // inline in hp_impl.h
 
+        /// Retire the range [\p itFirst, \p itLast) of retired pointers
+        /**
+            The value type of \p ForwardIterator should be convertible to \ref retired_ptr.
+            The function places all pointers of the range to the retired array of current thread at once.
+            If the range does not fit into the array the array is grown temporarily and the whole range
+            is reclaimed by one scan. Thus, bulk deleting of \p N items costs one scan instead of
+            <tt>N / nMaxRetiredPtrCount</tt> scans.
+
+            Usually, the function is called by cds::gc::details::retired_batch helper class.
+        */
+        template <typename ForwardIterator>
+        static void retire_batch( ForwardIterator itFirst, ForwardIterator itLast ) ;   // inline in hp_impl.h
+
         /// Get current scan strategy
         /**
             See hzp::GarbageCollector::Scan for scan algo description
@@ -540,6 +573,23 @@ namespace cds { namespace gc {
             return hzp::GarbageCollector::isUsed() ;
         }
 
+        /// Sets the ceiling of retired memory in bytes, 0 - no limit
+        /**
+            When the size of retired-but-not-freed objects exceeds the ceiling,
+            the threads reclaim retired pointers synchronously on each retire.
+            See hzp::GarbageCollector::setRetiredMemoryCeiling for details.
+        */
+        static void set_retired_memory_ceiling( size_t nBytes )
+        {
+            hzp::GarbageCollector::instance().setRetiredMemoryCeiling( nBytes ) ;
+        }
+
+        /// Returns the snapshot of retired memory statistics
+        static retired_memory_stat& get_retired_memory_stat( retired_memory_stat& st )
+        {
+            return hzp::GarbageCollector::instance().getRetiredMemoryStat( st ) ;
+        }
+
 
         /// Forced GC cycle call for current thread
         /**
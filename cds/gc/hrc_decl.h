@@ -14,6 +14,7 @@
 
 #include <cds/gc/hrc/hrc.h>
 #include <cds/details/marked_ptr.h>
+#include <cds/gc/details/retired_batch.h>
 
 namespace cds { namespace gc {
 
@@ -845,6 +846,52 @@ namespace cds { namespace gc {
         }
         //@}
     };
+
+    namespace details {
+        /// Batch of retired pointers for gc::HRC
+        /**
+            HRC garbage collector retires container nodes only, the type-erased \p retired_ptr cannot be
+            accepted by HRC. So, this specialization of cds::gc::details::retired_batch retires
+            each pointer immediately when it is pushed.
+        */
+        template <class Alloc>
+        class retired_batch< HRC, Alloc >
+        {
+        public:
+            typedef HRC gc  ;   ///< Garbage collector
+
+        public:
+            /// Retires pointer \p p with deleter \p pFunc
+            template <typename T>
+            void push( T * p, void (* pFunc)(T *) )
+            {
+                gc::retire( p, pFunc ) ;
+            }
+
+            /// Retires pointer \p p with functor of type \p Disposer
+            template <class Disposer, typename T>
+            void push( T * p )
+            {
+                gc::retire<Disposer>( p ) ;
+            }
+
+            /// Does nothing
+            void retire()
+            {}
+
+            /// Always returns \p true
+            bool empty() const
+            {
+                return true ;
+            }
+
+            /// Always returns 0
+            size_t size() const
+            {
+                return 0 ;
+            }
+        };
+    } // namespace details
 }} // namespace cds::gc
 
 #endif // #ifndef __CDS_GC_HRC_DECL_H
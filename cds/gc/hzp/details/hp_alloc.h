@@ -190,7 +190,14 @@ namespace cds {
         /**
             The hazard pointer array is the free-list of unused hazard pointer for the thread.
             The array is managed as a stack.
-            The max size (capacity) of array is defined at ctor time and cannot be changed during object's lifetime
+
+            The hazard pointers are stored in the list of blocks. By default, the allocator
+            has only one block, the max size (capacity) of which is defined at ctor time
+            and cannot be changed during object's lifetime.
+            If the allocator is growable (\p bGrowable ctor argument), a new block is allocated
+            when the current block has no enough free hazard pointers.
+            The blocks are never freed until the allocator is destroyed, so other threads can safely
+            read the hazard pointers of the allocator walking the list of blocks (see \ref first_block).
 
             Each allocator object is thread-private.
 
@@ -208,23 +215,88 @@ namespace cds {
             typedef HPGuardT<hazard_ptr_type>   atomic_hazard_ptr   ;   ///< Atomic hazard pointer type
             typedef Allocator                   allocator_type      ;   ///< allocator type
 
+            /// Block of hazard pointers
+            class block
+            {
+                //@cond
+                friend class HPAllocator    ;
+                typedef cds::details::Allocator< atomic_hazard_ptr, allocator_type > allocator_impl ;
+
+                CDS_ATOMIC::atomic<block *> m_pNext     ;   ///< Next block
+                block *                     m_pPrev     ;   ///< Previous block (for owner thread only)
+                atomic_hazard_ptr *         m_arr       ;   ///< Hazard pointer array
+                const size_t                m_nCapacity ;   ///< Array capacity
+                size_t                      m_nTop      ;   ///< The top of stack
+                //@endcond
+
+            public:
+                //@cond
+                explicit block( size_t nCapacity )
+                    : m_pNext( null_ptr<block *>() )
+                    , m_pPrev( null_ptr<block *>() )
+                    , m_arr( allocator_impl().NewArray( nCapacity ))
+                    , m_nCapacity( nCapacity )
+                    , m_nTop( nCapacity )
+                {}
+
+                ~block()
+                {
+                    allocator_impl().Delete( m_arr, m_nCapacity )  ;
+                }
+                //@endcond
+
+                /// Returns next block. May be called by any thread
+                block * next() const CDS_NOEXCEPT
+                {
+                    return m_pNext.load( CDS_ATOMIC::memory_order_acquire ) ;
+                }
+
+                /// Returns block capacity
+                size_t capacity() const CDS_NOEXCEPT
+                {
+                    return m_nCapacity  ;
+                }
+
+                /// Returns to i-th hazard pointer of the block
+                atomic_hazard_ptr& operator []( size_t i )
+                {
+                    assert( i < capacity() )    ;
+                    return m_arr[i] ;
+                }
+
+                //@cond
+                bool empty() const CDS_NOEXCEPT
+                {
+                    return m_nTop == m_nCapacity ;
+                }
+
+                void make_free()
+                {
+                    for ( size_t i = 0; i < m_nCapacity; ++i )
+                        m_arr[ i ].clear() ;
+                    m_nTop = m_nCapacity ;
+                }
+                //@endcond
+            };
+
         private:
             //@cond
-            typedef cds::details::Allocator< atomic_hazard_ptr, allocator_type > allocator_impl ;
-
-            atomic_hazard_ptr * m_arrHazardPtr  ;   ///< Array of hazard pointers
-            size_t              m_nTop          ;   ///< The top of stack
-            const size_t        m_nCapacity     ;   ///< Array capacity
+            typedef cds::details::Allocator< block, allocator_type > block_allocator ;
 
+            block       m_FirstBlock    ;   ///< The first block of hazard pointers
+            block *     m_pCurBlock     ;   ///< Current block, the allocation is performed from it
+            const bool  m_bGrowable     ;   ///< The allocator can allocate new blocks
             //@endcond
 
         public:
             /// Default ctor
             explicit HPAllocator(
-                size_t  nCapacity            ///< max count of hazard pointer per thread
+                size_t  nCapacity,          ///< max count of hazard pointer per thread (initial block capacity if \p bGrowable)
+                bool    bGrowable = false   ///< \p true if new blocks of hazard pointers can be allocated when needed
                 )
-                : m_arrHazardPtr( alloc_array( nCapacity ) )
-                , m_nCapacity( nCapacity )
+                : m_FirstBlock( nCapacity )
+                , m_pCurBlock( &m_FirstBlock )
+                , m_bGrowable( bGrowable )
             {
                 make_free()    ;
             }
@@ -232,14 +304,21 @@ namespace cds {
             /// Dtor
             ~HPAllocator()
             {
-                allocator_impl a ;
-                a.Delete( m_arrHazardPtr, capacity() )  ;
+                block_allocator a   ;
+                block * pNext ;
+                for ( block * p = m_FirstBlock.m_pNext.load( CDS_ATOMIC::memory_order_relaxed ); p; p = pNext ) {
+                    pNext = p->m_pNext.load( CDS_ATOMIC::memory_order_relaxed ) ;
+                    a.Delete( p )   ;
+                }
             }
 
-            /// Get capacity of array
+            /// Get capacity of array (total capacity of all allocated blocks)
             size_t capacity() const CDS_NOEXCEPT
             {
-                return m_nCapacity  ;
+                size_t nCapacity = 0    ;
+                for ( block const * p = &m_FirstBlock; p; p = p->next() )
+                    nCapacity += p->capacity()  ;
+                return nCapacity  ;
             }
 
             /// Get size of array. The size is equal to the capacity of array
@@ -248,26 +327,47 @@ namespace cds {
                 return capacity()    ;
             }
 
+            /// Checks if the allocator can allocate new blocks
+            bool isGrowable() const CDS_NOEXCEPT
+            {
+                return m_bGrowable  ;
+            }
+
             /// Checks if all items are allocated
+            /**
+                Growable allocator is never full.
+            */
             bool isFull() const CDS_NOEXCEPT
             {
-                return m_nTop == 0;
+                return !m_bGrowable && m_pCurBlock->m_nTop == 0 ;
+            }
+
+            /// Returns the first block of hazard pointers
+            /**
+                The function may be called by any thread. The list of blocks can be traversed by \p block::next().
+            */
+            block * first_block() CDS_NOEXCEPT
+            {
+                return &m_FirstBlock    ;
             }
 
             /// Allocates hazard pointer
             atomic_hazard_ptr& alloc()
             {
-                assert( m_nTop > 0 )    ;
-                --m_nTop    ;
-                return m_arrHazardPtr[m_nTop]  ;
+                block * pBlock = m_pCurBlock ;
+                if ( pBlock->m_nTop == 0 )
+                    pBlock = next_block( 1 )    ;
+                --pBlock->m_nTop    ;
+                return pBlock->m_arr[pBlock->m_nTop]  ;
             }
 
             /// Frees previously allocated hazard pointer
             void free( atomic_hazard_ptr& hp )
             {
-                assert( m_nTop < capacity() )       ;
                 hp.clear()  ;
-                ++m_nTop    ;
+                block * pBlock = prev_block()   ;
+                assert( pBlock->m_nTop < pBlock->capacity() )       ;
+                ++pBlock->m_nTop    ;
                 CDS_COMPILER_RW_BARRIER ;   // ???
             }
 
@@ -279,9 +379,11 @@ namespace cds {
             template <size_t Count>
             void alloc( HPArrayT<hazard_ptr_type, Count>& arr )
             {
-                assert( m_nTop >= Count )   ;
-                m_nTop -= Count ;
-                arr.m_arr = m_arrHazardPtr + m_nTop   ;
+                block * pBlock = m_pCurBlock ;
+                if ( pBlock->m_nTop < Count )
+                    pBlock = next_block( Count )    ;
+                pBlock->m_nTop -= Count ;
+                arr.m_arr = pBlock->m_arr + pBlock->m_nTop   ;
             }
 
             /// Frees hazard pointer array
@@ -289,12 +391,13 @@ namespace cds {
                 Frees the array of hazard pointers allocated by previous call \p this->alloc.
             */
             template <size_t Count>
-            void free( const HPArrayT<hazard_ptr_type, Count>& arr )
+            void free( const HPArrayT<hazard_ptr_type, Count>& /*arr*/ )
             {
-                assert( m_nTop + Count <= capacity())   ;
-                for ( size_t i = m_nTop; i < m_nTop + Count; ++i )
-                    m_arrHazardPtr[ i ].clear() ;
-                m_nTop += Count ;
+                block * pBlock = prev_block()   ;
+                assert( pBlock->m_nTop + Count <= pBlock->capacity())   ;
+                for ( size_t i = pBlock->m_nTop; i < pBlock->m_nTop + Count; ++i )
+                    pBlock->m_arr[ i ].clear() ;
+                pBlock->m_nTop += Count ;
             }
 
             /// Makes all HP free
@@ -303,26 +406,55 @@ namespace cds {
                 make_free()    ;
             }
 
-            /// Returns to i-th hazard pointer
+            /// Returns to i-th hazard pointer of the first block
             atomic_hazard_ptr& operator []( size_t i )
             {
-                assert( i < capacity() )    ;
-                return m_arrHazardPtr[i]    ;
+                return m_FirstBlock[i]  ;
             }
 
         private:
             //@cond
             void make_free()
             {
-                for ( size_t i = 0; i < capacity(); ++i )
-                    m_arrHazardPtr[ i ].clear() ;
-                m_nTop = capacity() ;
+                for ( block * p = &m_FirstBlock; p; p = p->m_pNext.load( CDS_ATOMIC::memory_order_relaxed ))
+                    p->make_free()  ;
+                m_pCurBlock = &m_FirstBlock ;
+            }
+
+            // Makes the block next to current one as current. The block should have at least nCount hazard pointers.
+            // The blocks after current block are always free
+            block * next_block( size_t nCount )
+            {
+                assert( m_bGrowable )   ;
+
+                block * pCur = m_pCurBlock  ;
+                block * pNext = pCur->m_pNext.load( CDS_ATOMIC::memory_order_relaxed )  ;
+                assert( pNext == null_ptr<block *>() || pNext->empty() )    ;
+
+                if ( pNext == null_ptr<block *>() || pNext->capacity() < nCount ) {
+                    // Allocate new block and link it after current block.
+                    // The new block is published with release semantics since other threads can scan it
+                    block * pNew = block_allocator().New( nCount > m_FirstBlock.capacity() ? nCount : m_FirstBlock.capacity() ) ;
+                    pNew->m_pPrev = pCur    ;
+                    pNew->m_pNext.store( pNext, CDS_ATOMIC::memory_order_relaxed )  ;
+                    if ( pNext )
+                        pNext->m_pPrev = pNew   ;
+                    pCur->m_pNext.store( pNew, CDS_ATOMIC::memory_order_release )   ;
+                    pNext = pNew    ;
+                }
+
+                m_pCurBlock = pNext ;
+                return pNext    ;
             }
 
-            atomic_hazard_ptr * alloc_array( size_t nCapacity )
+            // Returns the block that contains the top of allocated hazard pointers
+            block * prev_block()
             {
-                allocator_impl a    ;
-                return a.NewArray( nCapacity )  ;
+                // The hazard pointers are freed in LIFO order, so if current block is empty
+                // the hazard pointer being freed belongs to the previous block
+                if ( m_pCurBlock->empty() && m_pCurBlock->m_pPrev )
+                    m_pCurBlock = m_pCurBlock->m_pPrev  ;
+                return m_pCurBlock  ;
             }
             //@endcond
         };
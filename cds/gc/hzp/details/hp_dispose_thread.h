@@ -0,0 +1,269 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_GC_HZP_DETAILS_HP_DISPOSE_THREAD_H
+#define __CDS_GC_HZP_DETAILS_HP_DISPOSE_THREAD_H
+
+#include <cds/gc/hzp/hzp.h>
+#include <cds/details/std/thread.h>
+#include <cds/details/std/mutex.h>
+#include <cds/details/std/condition_variable.h>
+#include <cds/details/aligned_type.h>
+#include <cds/details/allocator.h>
+#include <algorithm>    // std::copy
+
+//@cond
+namespace cds {
+    namespace gc{ namespace hzp { namespace details {
+
+        /// Reclamation thread for Hazard Pointer GC
+        /**
+            The object is created by GarbageCollector if the background reclamation is enabled.
+            When the retired array of a thread is full, the thread does not scan it itself.
+            Instead, the content of the array is copied to a chunk that is queued for the reclamation thread,
+            and the retiring thread continues its work with the empty array.
+
+            The reclamation thread owns its own HP record. It moves the retired pointers of the queued chunks
+            to the retired array of the record and performs Scan and HelpScan for it.
+            Since the reclamation thread is alive all the time, nobody can steal its retired pointers.
+
+            The queue is bounded by \p nMaxPending chunks. If the reclamation thread falls behind and the queue is full,
+            \ref push returns \p false and the retiring thread must scan itself. So, the count of retired pointers
+            waiting for the reclamation thread is limited by <tt>nMaxPending * nMaxRetiredPtrCount</tt>.
+        */
+        class dispose_thread
+        {
+            typedef cds_std::thread                     thread_type ;
+            typedef cds_std::mutex                      mutex_type  ;
+            typedef cds_std::condition_variable         condvar_type;
+            typedef cds_std::unique_lock< mutex_type >  unique_lock ;
+
+            /// Chunk of retired pointers handed off to the reclamation thread
+            struct retired_chunk
+            {
+                retired_chunk * m_pNext     ;   ///< next chunk in the queue or in the free list
+                retired_ptr *   m_arr       ;   ///< retired pointers
+                size_t          m_nCapacity ;   ///< capacity of \p m_arr
+                size_t          m_nSize     ;   ///< count of retired pointers in \p m_arr
+                size_t          m_nBytes    ;   ///< total size of retired objects in \p m_arr
+
+                explicit retired_chunk( size_t nCapacity )
+                    : m_pNext( null_ptr<retired_chunk *>() )
+                    , m_arr( cds::details::Allocator< retired_ptr >().NewArray( nCapacity ))
+                    , m_nCapacity( nCapacity )
+                    , m_nSize( 0 )
+                    , m_nBytes( 0 )
+                {}
+
+                ~retired_chunk()
+                {
+                    cds::details::Allocator< retired_ptr >().Delete( m_arr, m_nCapacity ) ;
+                }
+            };
+            typedef cds::details::Allocator< retired_chunk >  chunk_allocator ;
+
+            class dispose_thread_starter: public thread_type
+            {
+                static void thread_func( dispose_thread * pThis )
+                {
+                    pThis->execute() ;
+                }
+
+            public:
+                dispose_thread_starter( dispose_thread * pThis )
+                    : thread_type( thread_func, pThis )
+                {}
+            };
+
+            typedef char thread_placeholder[ sizeof(dispose_thread_starter) ] ;
+            cds::details::aligned_type< thread_placeholder, alignof( dispose_thread_starter ) >::type  m_threadPlaceholder ;
+            dispose_thread_starter *    m_DisposeThread ;
+
+            GarbageCollector&   m_gc            ;   ///< HP GC
+            const size_t        m_nMaxPending   ;   ///< max count of chunks in the queue
+
+            mutex_type          m_Mutex         ;
+            condvar_type        m_cvDataReady   ;
+
+            retired_chunk *     m_pQueueHead    ;   ///< queue of chunks waiting for the reclamation
+            retired_chunk *     m_pQueueTail    ;
+            size_t              m_nPending      ;   ///< count of chunks queued or being processed
+            retired_chunk *     m_pFreeList     ;   ///< processed chunks ready for reuse
+            bool                m_bQuit         ;
+            CDS_ATOMIC::atomic<size_t>  m_nPendingBytes ;   ///< total size of retired objects in the queue
+
+        private: // methods called from reclamation thread
+            void execute()
+            {
+                HPRec * pRec = m_gc.AllocateHPRec() ;
+                bool bQuit = false ;
+
+                while ( !bQuit ) {
+                    retired_chunk * pList ;
+                    {
+                        unique_lock lock( m_Mutex ) ;
+                        while ( !m_pQueueHead && !m_bQuit )
+                            m_cvDataReady.wait( lock ) ;
+
+                        pList = m_pQueueHead ;
+                        m_pQueueHead = m_pQueueTail = null_ptr<retired_chunk *>() ;
+                        bQuit = m_bQuit && !pList ;
+                    }
+
+                    if ( pList ) {
+                        retired_chunk * pLast = pList ;
+                        size_t nCount = 0 ;
+                        for ( retired_chunk * pChunk = pList; pChunk; pChunk = pChunk->m_pNext ) {
+                            dispose_chunk( pRec, pChunk ) ;
+                            pLast = pChunk ;
+                            ++nCount ;
+                        }
+                        m_gc.Scan( pRec )     ;
+                        m_gc.HelpScan( pRec ) ;
+
+                        unique_lock lock( m_Mutex ) ;
+                        pLast->m_pNext = m_pFreeList ;
+                        m_pFreeList = pList ;
+                        m_nPending -= nCount ;
+                    }
+                }
+
+                // The pointers that are still guarded remain in the record.
+                // They will be freed by HelpScan of other threads or by GC destructor
+                m_gc.RetireHPRec( pRec ) ;
+            }
+
+            void dispose_chunk( HPRec * pRec, retired_chunk * pChunk )
+            {
+                retired_vector& arr = pRec->m_arrRetired ;
+                retired_ptr * pEnd = pChunk->m_arr + pChunk->m_nSize ;
+                for ( retired_ptr * p = pChunk->m_arr; p != pEnd; ++p ) {
+                    arr.push( *p ) ;
+                    if ( arr.isFull() )
+                        m_gc.Scan( pRec ) ;
+                }
+                m_nPendingBytes.fetch_sub( pChunk->m_nBytes, CDS_ATOMIC::memory_order_relaxed ) ;
+                pChunk->m_nSize = 0 ;
+                pChunk->m_nBytes = 0 ;
+            }
+
+            retired_chunk * alloc_chunk( size_t nSize )
+            {
+                // The caller must lock m_Mutex
+                retired_chunk * pChunk = m_pFreeList ;
+                if ( pChunk ) {
+                    m_pFreeList = pChunk->m_pNext ;
+                    if ( pChunk->m_nCapacity >= nSize ) {
+                        pChunk->m_pNext = null_ptr<retired_chunk *>() ;
+                        return pChunk ;
+                    }
+                    chunk_allocator().Delete( pChunk ) ;
+                }
+                return chunk_allocator().New( nSize > m_gc.getMaxRetiredPtrCount() ? nSize : m_gc.getMaxRetiredPtrCount() ) ;
+            }
+
+            static void free_list( retired_chunk * pList )
+            {
+                retired_chunk * pNext ;
+                for ( ; pList; pList = pNext ) {
+                    pNext = pList->m_pNext ;
+                    chunk_allocator().Delete( pList ) ;
+                }
+            }
+
+        public:
+            dispose_thread( GarbageCollector& gc, size_t nMaxPending )
+                : m_DisposeThread( null_ptr<dispose_thread_starter *>() )
+                , m_gc( gc )
+                , m_nMaxPending( nMaxPending )
+                , m_pQueueHead( null_ptr<retired_chunk *>() )
+                , m_pQueueTail( null_ptr<retired_chunk *>() )
+                , m_nPending( 0 )
+                , m_pFreeList( null_ptr<retired_chunk *>() )
+                , m_bQuit( false )
+            {
+                m_nPendingBytes.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+            }
+
+            ~dispose_thread()
+            {
+                assert( m_DisposeThread == null_ptr<dispose_thread_starter *>() ) ;
+                assert( m_pQueueHead == null_ptr<retired_chunk *>() ) ;
+                free_list( m_pFreeList ) ;
+            }
+
+        public: // methods called from any thread
+            /// Starts reclamation thread
+            void start()
+            {
+                m_DisposeThread = new (&m_threadPlaceholder) dispose_thread_starter( this ) ;
+            }
+
+            /// Stops reclamation thread
+            /**
+                The thread reclaims all queued chunks before termination.
+            */
+            void stop()
+            {
+                {
+                    unique_lock lock( m_Mutex ) ;
+                    m_bQuit = true ;
+                }
+                m_cvDataReady.notify_one()  ;
+
+                m_DisposeThread->join() ;
+                m_DisposeThread->~dispose_thread_starter() ;
+                m_DisposeThread = null_ptr<dispose_thread_starter *>() ;
+            }
+
+            /// Returns total size of retired objects waiting for the reclamation thread
+            size_t pending_bytes() const
+            {
+                return m_nPendingBytes.load( CDS_ATOMIC::memory_order_relaxed ) ;
+            }
+
+            /// Hands off the content of \p arr to the reclamation thread
+            /**
+                On success \p arr becomes empty. If the queue is full the function returns \p false
+                and \p arr is not changed.
+            */
+            bool push( retired_vector& arr )
+            {
+                {
+                    unique_lock lock( m_Mutex ) ;
+                    if ( m_nPending >= m_nMaxPending || m_bQuit )
+                        return false ;
+
+                    retired_chunk * pChunk = alloc_chunk( arr.size() ) ;
+                    std::copy( arr.begin(), arr.end(), pChunk->m_arr ) ;
+                    pChunk->m_nSize = arr.size() ;
+                    pChunk->m_nBytes = arr.bytes() ;
+                    m_nPendingBytes.fetch_add( pChunk->m_nBytes, CDS_ATOMIC::memory_order_relaxed ) ;
+
+                    if ( m_pQueueTail )
+                        m_pQueueTail->m_pNext = pChunk ;
+                    else
+                        m_pQueueHead = pChunk ;
+                    m_pQueueTail = pChunk ;
+                    ++m_nPending ;
+                }
+                m_cvDataReady.notify_one() ;
+
+                arr.clear() ;
+                return true ;
+            }
+        };
+
+    } } }    // namespace gc::hzp::details
+}    // namespace cds
+//@endcond
+
+#endif // #ifndef __CDS_GC_HZP_DETAILS_HP_DISPOSE_THREAD_H
@@ -0,0 +1,172 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_GC_HZP_DETAILS_HP_HASH_SET_H
+#define __CDS_GC_HZP_DETAILS_HP_HASH_SET_H
+
+#include <cds/details/allocator.h>
+#include <cds/int_algo.h>
+#include <algorithm>    // std::fill
+
+//@cond
+namespace cds {
+    namespace gc{ namespace hzp { namespace details {
+
+        /// Open-addressing hash set of hazard pointers
+        /**
+            The set is used by \ref GarbageCollector::hashed_scan "hashed scan" algorithm.
+            Each HP record owns the set. The slot array is allocated by the first hashed scan
+            of the record (see \p allocate), so the records of the GC with other scan type
+            do not waste the memory, and the subsequent scans do not allocate any memory.
+
+            The set is thread-private: only the owner thread of HP record fills and searches it.
+            The set uses linear probing; \p NULL value denotes an empty slot.
+            The load factor is limited by 1/2, if the limit is reached \p insert returns \p false
+            and the caller should use another scan algorithm.
+
+            Template parameter:
+                \li Allocator - memory allocator class, default is \ref CDS_DEFAULT_ALLOCATOR
+        */
+        template <class Allocator = CDS_DEFAULT_ALLOCATOR>
+        class hazard_ptr_set
+        {
+            typedef cds::details::Allocator< void *, Allocator >    allocator_impl ;
+
+            void **         m_arrSlot   ;   ///< Slot array, \p NULL if it is not allocated yet
+            const size_t    m_nCapacity ;   ///< Slot count, power of 2
+            const size_t    m_nMaxSize  ;   ///< Max item count (load factor limit)
+            size_t          m_nSize     ;   ///< Current item count
+
+        private:
+            static void ** alloc_array( size_t nCapacity )
+            {
+                void ** p = allocator_impl().NewArray( nCapacity ) ;
+                std::fill( p, p + nCapacity, null_ptr<void *>() ) ;
+                return p ;
+            }
+
+            size_t slot( void * p ) const CDS_NOEXCEPT
+            {
+                // Pointers are aligned, so low bits are dropped before Fibonacci mixing
+                uptr_atomic_t h = reinterpret_cast<uptr_atomic_t>( p ) >> 3 ;
+                h ^= h >> 16 ;
+                h *= static_cast<uptr_atomic_t>( 0x9E3779B97F4A7C15ULL ) ;
+                h ^= h >> 16 ;
+                return static_cast<size_t>( h ) & (m_nCapacity - 1) ;
+            }
+
+        public:
+            /// Creates the set that can hold \p nMaxSize hazard pointers
+            explicit hazard_ptr_set( size_t nMaxSize )
+                : m_arrSlot( null_ptr<void **>() )
+                , m_nCapacity( cds::beans::ceil2( nMaxSize * 2 ))
+                , m_nMaxSize( cds::beans::ceil2( nMaxSize * 2 ) / 2 )
+                , m_nSize( 0 )
+            {}
+
+            ~hazard_ptr_set()
+            {
+                if ( m_arrSlot )
+                    allocator_impl().Delete( m_arrSlot, m_nCapacity ) ;
+            }
+
+            /// Allocates the slot array if it is not allocated yet
+            /**
+                The function should be called before \p insert.
+            */
+            void allocate()
+            {
+                if ( !m_arrSlot )
+                    m_arrSlot = alloc_array( m_nCapacity ) ;
+            }
+
+            /// Checks if the slot array is allocated
+            bool allocated() const CDS_NOEXCEPT
+            {
+                return m_arrSlot != null_ptr<void **>() ;
+            }
+
+            /// Slot count of the set
+            size_t capacity() const CDS_NOEXCEPT
+            {
+                return m_nCapacity ;
+            }
+
+            /// Current item count
+            size_t size() const CDS_NOEXCEPT
+            {
+                return m_nSize ;
+            }
+
+            /// Inserts non-null pointer \p p
+            /**
+                Returns \p false if the load factor limit is reached and \p p cannot be inserted.
+                \p nProbe is increased by the number of probed slots.
+            */
+            bool insert( void * p, size_t& nProbe ) CDS_NOEXCEPT
+            {
+                assert( p != null_ptr<void *>() ) ;
+                assert( allocated() ) ;
+
+                size_t nSlot = slot( p ) ;
+                for (;;) {
+                    ++nProbe ;
+                    void * pSlot = m_arrSlot[ nSlot ] ;
+                    if ( pSlot == p )
+                        return true ;
+                    if ( pSlot == null_ptr<void *>() )
+                        break ;
+                    nSlot = (nSlot + 1) & (m_nCapacity - 1) ;
+                }
+
+                if ( m_nSize >= m_nMaxSize )
+                    return false ;
+                m_arrSlot[ nSlot ] = p ;
+                ++m_nSize ;
+                return true ;
+            }
+
+            /// Checks if \p p is in the set
+            /**
+                \p nProbe is increased by the number of probed slots.
+            */
+            bool contains( void * p, size_t& nProbe ) const CDS_NOEXCEPT
+            {
+                if ( m_nSize == 0 )
+                    return false ;
+
+                size_t nSlot = slot( p ) ;
+                for (;;) {
+                    ++nProbe ;
+                    void * pSlot = m_arrSlot[ nSlot ] ;
+                    if ( pSlot == p )
+                        return true ;
+                    if ( pSlot == null_ptr<void *>() )
+                        return false ;
+                    nSlot = (nSlot + 1) & (m_nCapacity - 1) ;
+                }
+            }
+
+            /// Makes the set empty
+            void clear() CDS_NOEXCEPT
+            {
+                if ( m_nSize ) {
+                    std::fill( m_arrSlot, m_arrSlot + m_nCapacity, null_ptr<void *>() ) ;
+                    m_nSize = 0 ;
+                }
+            }
+        };
+
+    } } }    // namespace gc::hzp::details
+}    // namespace cds
+//@endcond
+
+#endif // #ifndef __CDS_GC_HZP_DETAILS_HP_HASH_SET_H
@@ -19,13 +19,17 @@ namespace cds {
         /* INLINES                                                              */
         /************************************************************************/
         inline retired_vector::retired_vector( const cds::gc::hzp::GarbageCollector& HzpMgr )
-            : m_arr( HzpMgr.getMaxRetiredPtrCount() ),
+            : m_arr( allocator_impl().NewArray( HzpMgr.getMaxRetiredPtrCount() )),
+            m_nCapacity( HzpMgr.getMaxRetiredPtrCount() ),
             m_nSize(0)
-        {}
+        {
+            m_nBytes.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+        }
 
         inline HPRec::HPRec( const cds::gc::hzp::GarbageCollector& HzpMgr )
-            : m_hzp( HzpMgr.getHazardPointerCount() ),
-            m_arrRetired( HzpMgr )
+            : m_hzp( HzpMgr.getHazardPointerCount(), HzpMgr.isDynamicHPRec() ),
+            m_arrRetired( HzpMgr ),
+            m_setHP( HzpMgr.getMaxThreadCount() * HzpMgr.getHazardPointerCount() )
         {}
 
     } } }    // namespace gc::hzp::details
@@ -15,7 +15,8 @@
 #include <cds/gc/hzp/details/hp_fwd.h>
 #include <cds/gc/hzp/details/hp_type.h>
 
-#include <cds/details/bounded_array.h>
+#include <cds/details/allocator.h>
+#include <cds/cxx11_atomic.h>
 
 namespace cds {
     namespace gc{ namespace hzp { namespace details {
@@ -30,37 +31,97 @@ namespace cds {
             The Hazard Pointer schema is build on thread-static arrays. For each HP-enabled thread the HP manager allocates
             array of retired pointers. The array belongs to the thread: owner thread writes to the array, other threads
             just read it.
+
+            The vector also counts the total size in bytes of the objects it contains (see \ref bytes).
+            Only the owner changes the counter, other threads may read it to compute the retired memory of the GC.
         */
         class retired_vector {
-            /// Underlying vector implementation
-            typedef cds::details::bounded_array<retired_ptr>    retired_vector_impl    ;
+            /// Underlying array allocator
+            typedef cds::details::Allocator< retired_ptr, CDS_DEFAULT_ALLOCATOR >  allocator_impl ;
+
+            retired_ptr *       m_arr       ;   ///< the array of retired pointers
+            size_t              m_nCapacity ;   ///< Capacity of \p m_arr
+            size_t              m_nSize     ;   ///< Current size of \p m_arr
+            CDS_ATOMIC::atomic<size_t>  m_nBytes ;  ///< Total size of the objects in \p m_arr, bytes
 
-            retired_vector_impl m_arr   ;   ///< the array of retired pointers
-            size_t              m_nSize ;   ///< Current size of \p m_arr
+        private:
+            //@cond
+            void reallocate( size_t nCapacity )
+            {
+                retired_ptr * pNew = allocator_impl().NewArray( nCapacity ) ;
+                for ( size_t i = 0; i < m_nSize; ++i )
+                    pNew[i] = m_arr[i] ;
+                allocator_impl().Delete( m_arr, m_nCapacity )   ;
+                m_arr = pNew    ;
+                m_nCapacity = nCapacity ;
+            }
+            //@endcond
 
         public:
             /// Iterator
-            typedef    retired_vector_impl::iterator    iterator    ;
+            typedef    retired_ptr *    iterator    ;
 
             /// Constructor
             retired_vector( const cds::gc::hzp::GarbageCollector& HzpMgr )    ;    // inline
             ~retired_vector()
-            {}
+            {
+                allocator_impl().Delete( m_arr, m_nCapacity )   ;
+            }
 
             /// Vector capacity.
             /**
-                The capacity is constant for any thread. It is defined by cds::gc::hzp::GarbageCollector.
+                The capacity is defined by cds::gc::hzp::GarbageCollector. It is constant for any thread
+                unless \ref cds::gc::hzp::GarbageCollector "dynamic HP record pool" mode is used.
+            */
+            size_t capacity() const     { return m_nCapacity; }
+
+            /// Increases the capacity of the vector up to \p nCapacity. Uses internally
+            /**
+                The caller should be an owner of the vector.
+            */
+            void grow( size_t nCapacity )
+            {
+                assert( nCapacity > m_nCapacity )  ;
+                reallocate( nCapacity ) ;
+            }
+
+            /// Decreases the capacity of the vector down to \p nCapacity. Uses internally
+            /**
+                The caller should be an owner of the vector. \p nCapacity must not be less than current size.
             */
-            size_t capacity() const     { return m_arr.capacity(); }
+            void shrink( size_t nCapacity )
+            {
+                assert( nCapacity < m_nCapacity )  ;
+                assert( m_nSize <= nCapacity )     ;
+                reallocate( nCapacity ) ;
+            }
 
             /// Current vector size (count of retired pointers in the vector)
             size_t size() const         { return m_nSize; }
 
             /// Set vector size. Uses internally
+            /**
+                The size of retired memory is recalculated for the first \p nSize items.
+            */
             void size( size_t nSize )
             {
                 assert( nSize <= capacity() )   ;
                 m_nSize = nSize     ;
+
+                size_t nBytes = 0   ;
+                for ( size_t i = 0; i < nSize; ++i )
+                    nBytes += m_arr[i].m_nSize ;
+                m_nBytes.store( nBytes, CDS_ATOMIC::memory_order_relaxed ) ;
+            }
+
+            /// Total size of the retired objects in the vector, in bytes
+            /**
+                Only the objects of known size are counted, see \ref cds::gc::details::retired_ptr::m_nSize.
+                Any thread may call this function.
+            */
+            size_t bytes() const
+            {
+                return m_nBytes.load( CDS_ATOMIC::memory_order_relaxed ) ;
             }
 
             /// Pushes retired pointer to the vector
@@ -69,6 +130,8 @@ namespace cds {
                 assert( m_nSize < capacity() )  ;
                 m_arr[ m_nSize ] = p            ;
                 ++m_nSize                       ;
+                // Only the owner thread changes the counter, so no RMW is needed
+                m_nBytes.store( m_nBytes.load( CDS_ATOMIC::memory_order_relaxed ) + p.m_nSize, CDS_ATOMIC::memory_order_relaxed ) ;
             }
 
             /// Checks if the vector is full (size() == capacity() )
@@ -78,14 +141,15 @@ namespace cds {
             }
 
             /// Begin iterator
-            iterator    begin()    { return m_arr.begin(); }
+            iterator    begin()    { return m_arr; }
             /// End iterator
-            iterator    end()    { return m_arr.begin() +  m_nSize ; }
+            iterator    end()    { return m_arr +  m_nSize ; }
 
             /// Clears the vector. After clearing, size() == 0
             void clear()
             {
                 m_nSize = 0 ;
+                m_nBytes.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
             }
         };
 
@@ -19,9 +19,13 @@
 #include <cds/gc/hzp/details/hp_fwd.h>
 #include <cds/gc/hzp/details/hp_alloc.h>
 #include <cds/gc/hzp/details/hp_retired.h>
+#include <cds/gc/hzp/details/hp_hash_set.h>
+#include <cds/gc/details/retired_memory.h>
 
 #include <vector>
+#include <iterator>     // std::distance
 #include <cds/details/noncopyable.h>
+#include <cds/lock/spinlock.h>
 
 #if CDS_COMPILER == CDS_COMPILER_MSVC
 #   pragma warning(push)
@@ -128,6 +132,7 @@ namespace cds {
             struct HPRec {
                 HPAllocator<hazard_pointer>    m_hzp        ; ///< array of hazard pointers. Implicit \ref CDS_DEFAULT_ALLOCATOR dependency
                 retired_vector            m_arrRetired ; ///< Retired pointer array
+                hazard_ptr_set<>          m_setHP      ; ///< Hazard pointer set for \ref GarbageCollector::hashed_scan "hashed scan", allocated on first use
 
                 /// Ctor
                 HPRec( const cds::gc::hzp::GarbageCollector& HzpMgr ) ;    // inline
@@ -140,6 +145,8 @@ namespace cds {
                     m_hzp.clear()    ;
                 }
             };
+
+            class dispose_thread ;  // see hp_dispose_thread.h
         }    // namespace details
 
         /// GarbageCollector::Scan phase strategy
@@ -148,7 +155,8 @@ namespace cds {
         */
         enum scan_type {
             classic,    ///< classic scan as described in Michael's works (see GarbageCollector::classic_scan)
-            inplace     ///< inplace scan without allocation (see GarbageCollector::inplace_scan)
+            inplace,    ///< inplace scan without allocation (see GarbageCollector::inplace_scan)
+            hashed      ///< scan based on per-thread hash set of hazard pointers (see GarbageCollector::hashed_scan)
         };
 
         /// Hazard Pointer singleton
@@ -171,17 +179,28 @@ namespace cds {
                 size_t              nHPCount                ;   ///< HP count per thread (const)
                 size_t              nMaxThreadCount         ;   ///< Max thread count (const)
                 size_t              nMaxRetiredPtrCount     ;   ///< Max retired pointer count per thread (const)
-                size_t              nHPRecSize              ;   ///< Size of HP record, bytes (const)
+                size_t              nHPRecSize              ;   ///< Size of HP record without the hazard pointer set of \ref hashed_scan "hashed scan", bytes (const)
 
                 size_t              nHPRecAllocated         ;   ///< Count of HP record allocations
                 size_t              nHPRecUsed              ;   ///< Count of HP record used
                 size_t              nTotalRetiredPtrCount   ;   ///< Current total count of retired pointers
                 size_t              nRetiredPtrInFreeHPRecs ;   ///< Count of retired pointer in free (unused) HP records
+                size_t              nTotalHPCount           ;   ///< Current total count of hazard pointers in HP records, i.e. the cost of Scan phase
+                size_t              nRemovedHPRecs          ;   ///< Count of HP records removed from the list but not deleted yet (dynamic mode only)
+                size_t              nHashedSetBytes         ;   ///< Total size of the hazard pointer sets allocated by \ref hashed_scan "hashed scan" in HP records, bytes
+                size_t              nRetiredBytes           ;   ///< Bytes of retired objects computed in the last Scan phase
+                size_t              nPeakRetiredBytes       ;   ///< Max value of \p nRetiredBytes
+                size_t              nRetiredBytesCeiling    ;   ///< Retired memory ceiling, 0 - no limit
 
                 event_counter::value_type   evcAllocHPRec   ;   ///< Count of HPRec allocations
                 event_counter::value_type   evcRetireHPRec  ;   ///< Count of HPRec retire events
                 event_counter::value_type   evcAllocNewHPRec;   ///< Count of new HPRec allocations from heap
                 event_counter::value_type   evcDeleteHPRec  ;   ///< Count of HPRec deletions
+                event_counter::value_type   evcRemoveHPRec  ;   ///< Count of HPRec removing from the HP list (dynamic mode only)
+                event_counter::value_type   evcGrowRetired  ;   ///< Count of retired array growing (dynamic mode only)
+                event_counter::value_type   evcRetireBatch  ;   ///< Count of retired pointer batches that exceed retired array capacity
+                event_counter::value_type   evcDeferScan    ;   ///< Count of retired arrays handed off to the reclamation thread (background mode only)
+                event_counter::value_type   evcDeferScanRejected;   ///< Count of hand-offs rejected because the reclamation thread queue is full (background mode only)
 
                 event_counter::value_type   evcScanCall     ;   ///< Count of Scan calling
                 event_counter::value_type   evcHelpScanCall ;   ///< Count of HelpScan calling
@@ -189,6 +208,11 @@ namespace cds {
 
                 event_counter::value_type   evcDeletedNode  ;   ///< Count of deleting of retired objects
                 event_counter::value_type   evcDeferredNode ;   ///< Count of objects that cannot be deleted in Scan phase because of a hazard_pointer guards it
+
+                event_counter::value_type   evcScanHPCount  ;   ///< Count of non-null hazard pointers collected in Scan phase
+                event_counter::value_type   evcScanProbeCount;  ///< Count of HP lookups (comparisons or hash probes) in Scan phase
+                event_counter::value_type   evcHashedScanFallback;  ///< Count of \p hashed scans that fall back to \p classic scan because of HP set overflow
+                event_counter::value_type   evcRetiredCeilingHit;   ///< Count of synchronous scans forced by the retired memory ceiling
             } ;
 
             /// No GarbageCollector object is created
@@ -204,6 +228,11 @@ namespace cds {
                 event_counter  m_RetireHPRec            ;    ///< Count of HPRec retire events
                 event_counter  m_AllocNewHPRec            ;    ///< Count of new HPRec allocations from heap
                 event_counter  m_DeleteHPRec            ;    ///< Count of HPRec deletions
+                event_counter  m_RemoveHPRec            ;    ///< Count of HPRec removing from the HP list
+                event_counter  m_GrowRetired            ;    ///< Count of retired array growing
+                event_counter  m_RetireBatch            ;    ///< Count of retired pointer batches that exceed retired array capacity
+                event_counter  m_DeferScan              ;    ///< Count of retired arrays handed off to the reclamation thread
+                event_counter  m_DeferScanRejected      ;    ///< Count of hand-offs rejected because the reclamation thread queue is full
 
                 event_counter  m_ScanCallCount            ;    ///< Count of Scan calling
                 event_counter  m_HelpScanCallCount        ;    ///< Count of HelpScan calling
@@ -211,21 +240,36 @@ namespace cds {
 
                 event_counter  m_DeletedNode            ;    ///< Count of retired objects deleting
                 event_counter  m_DeferredNode            ;    ///< Count of objects that cannot be deleted in Scan phase because of a hazard_pointer guards it
+
+                event_counter  m_ScanHPCount            ;    ///< Count of non-null hazard pointers collected in Scan phase
+                event_counter  m_ScanProbeCount         ;    ///< Count of HP lookups (comparisons or hash probes) in Scan phase
+                event_counter  m_HashedScanFallback     ;    ///< Count of \p hashed scans that fall back to \p classic scan
             };
 
+            /// Block of hazard pointers of HP record
+            typedef details::HPAllocator<hazard_pointer>::block hp_block ;
+
             /// Internal list of cds::gc::hzp::details::HPRec
             struct hplist_node: public details::HPRec
             {
-                hplist_node *                       m_pNextNode ; ///< next hazard ptr record in list
+                CDS_ATOMIC::atomic<hplist_node *>   m_pNextNode ; ///< next hazard ptr record in list
                 CDS_ATOMIC::atomic<OS::ThreadId>    m_idOwner   ; ///< Owner thread id; 0 - the record is free (not owned)
                 CDS_ATOMIC::atomic<bool>            m_bFree     ; ///< true if record if free (not owned)
+                CDS_ATOMIC::atomic<bool>            m_bRemoved  ; ///< true if record is removed from the list (dynamic mode only)
+                hplist_node *                       m_pNextRemoved ; ///< next record in the list of removed records
+                CDS_ATOMIC::atomic<size_t>          m_nTraverseEpoch ; ///< list epoch at the start of the owner's list traversal; 0 - no traversal (dynamic mode only)
+                size_t                              m_nRemoveEpoch ; ///< list epoch at the moment of removing the record (dynamic mode only)
 
                 //@cond
                 hplist_node( const GarbageCollector& HzpMgr )
                     : HPRec( HzpMgr ),
-                    m_pNextNode(NULL),
+                    m_pNextNode( null_ptr<hplist_node *>() ),
                     m_idOwner( OS::nullThreadId() ),
-                    m_bFree( true )
+                    m_bFree( true ),
+                    m_bRemoved( false ),
+                    m_pNextRemoved( null_ptr<hplist_node *>() ),
+                    m_nTraverseEpoch( 0 ),
+                    m_nRemoveEpoch( 0 )
                 {}
 
                 ~hplist_node()
@@ -236,6 +280,56 @@ namespace cds {
                 //@endcond
             };
 
+            /// Guard of HP list traversal
+            /**
+                In dynamic HP record pool mode the HP records can be removed from the list.
+                Each removing advances the list epoch, and the thread traversing the list announces
+                the epoch it has started at in its own HP record \p pRec.
+                A removed record is deleted when its removing epoch is less than any announced epoch,
+                so a long traversal delays the deletion of the records removed before it has started only.
+
+                The traversal without HP record (\p pRec is \p NULL) is serialized with removing
+                and deleting of HP records by \p m_RemoveLock.
+                Nested traversals of the same record are covered by the outermost one.
+            */
+            class list_traverse_guard
+            {
+                GarbageCollector&   m_gc    ;
+                hplist_node *       m_pRec  ;   // the record announced the traversal epoch
+                bool                m_bLocked ;
+            public:
+                //@cond
+                list_traverse_guard( GarbageCollector& gc, details::HPRec * pRec )
+                    : m_gc( gc )
+                    , m_pRec( null_ptr<hplist_node *>() )
+                    , m_bLocked( false )
+                {
+                    if ( m_gc.m_bDynamicHPRec ) {
+                        if ( pRec ) {
+                            hplist_node * pNode = static_cast<hplist_node *>( pRec ) ;
+                            if ( pNode->m_nTraverseEpoch.load( CDS_ATOMIC::memory_order_relaxed ) == 0 ) {
+                                pNode->m_nTraverseEpoch.store( m_gc.m_nListEpoch.load( CDS_ATOMIC::memory_order_acquire ), CDS_ATOMIC::memory_order_relaxed ) ;
+                                CDS_ATOMIC::atomic_thread_fence( CDS_ATOMIC::memory_order_seq_cst ) ;
+                                m_pRec = pNode ;
+                            }
+                        }
+                        else {
+                            m_gc.m_RemoveLock.lock() ;
+                            m_bLocked = true ;
+                        }
+                    }
+                }
+                ~list_traverse_guard()
+                {
+                    if ( m_pRec )
+                        m_pRec->m_nTraverseEpoch.store( 0, CDS_ATOMIC::memory_order_release ) ;
+                    if ( m_bLocked )
+                        m_gc.m_RemoveLock.unlock() ;
+                }
+                //@endcond
+            };
+            friend class list_traverse_guard ;
+
             CDS_ATOMIC::atomic<hplist_node *>   m_pListHead  ;  ///< Head of GC list
 
             static GarbageCollector *    m_pHZPManager  ;   ///< GC instance pointer
@@ -247,7 +341,13 @@ namespace cds {
             const size_t            m_nMaxThreadCount       ;   ///< max count of thread
             const size_t            m_nMaxRetiredPtrCount   ;   ///< max count of retired ptr per thread
             scan_type               m_nScanType             ;   ///< scan type (see \ref scan_type enum)
+            const bool              m_bDynamicHPRec         ;   ///< dynamic HP record pool mode
 
+            CDS_ATOMIC::atomic<size_t>  m_nListEpoch        ;   ///< HP list epoch, advanced by each removing of HP record (dynamic mode only)
+            cds::lock::Spin         m_RemoveLock            ;   ///< HP record removing lock (dynamic mode only)
+            hplist_node *           m_pRemovedList          ;   ///< list of removed HP records waiting for deletion (dynamic mode only)
+            details::dispose_thread *   m_pDisposeThread    ;   ///< reclamation thread (background mode only)
+            cds::gc::details::retired_memory    m_RetiredMemory ;   ///< retired memory accounting
 
         private:
             /// Ctor
@@ -255,7 +355,9 @@ namespace cds {
                 size_t nHazardPtrCount = 0,         ///< Hazard pointer count per thread
                 size_t nMaxThreadCount = 0,         ///< Max count of thread
                 size_t nMaxRetiredPtrCount = 0,     ///< Capacity of the array of retired objects
-                scan_type nScanType = inplace       ///< Scan type (see \ref scan_type enum)
+                scan_type nScanType = inplace,      ///< Scan type (see \ref scan_type enum)
+                bool bDynamicHPRec = false,         ///< Dynamic HP record pool mode
+                size_t nDisposeQueueCapacity = 0    ///< Capacity of the reclamation thread queue, 0 - no background reclamation
             )    ;
 
             /// Dtor
@@ -278,6 +380,19 @@ namespace cds {
 
             //@cond
             void detachAllThread()  ;
+
+            // Dynamic HP record pool mode
+            void remove_hprec( hplist_node * pNode ) ;
+            void delete_removed_hprec() ;
+            void grow_retired( details::HPRec * pRec ) ;
+
+            // Background reclamation mode
+            void start_dispose_thread() ;
+            void stop_dispose_thread() ;
+
+            // Retired memory accounting
+            void update_retired_memory( details::HPRec * pRec ) ;
+            size_t retired_bytes( details::HPRec * pRec ) const ;
             //@endcond
 
         public:
@@ -297,12 +412,39 @@ namespace cds {
                 \p nMaxRetiredPtrCount - capacity of array of retired pointers for each thread. Must be greater than
                                     \p nHazardPtrCount * \p nMaxThreadCount.
                                     Default is 2 * \p nHazardPtrCount * \p nMaxThreadCount.
+
+                If \p bDynamicHPRec is \p true, the GC works in <i>dynamic HP record pool</i> mode:
+                - \p nHazardPtrCount is the size of the block of hazard pointers. A thread allocates
+                  new block of hazard pointers when all hazard pointers of its record are in use,
+                  so the count of hazard pointers per thread is unlimited.
+                - \p nMaxThreadCount is just an estimation of thread count, the count of threads is unlimited.
+                - \p nMaxRetiredPtrCount is the initial capacity of array of retired pointers. The array of the thread
+                  is grown when the Scan phase cannot free at least half of the array.
+                - HP record of the terminated thread is removed from the HP list when it has no retired pointers.
+                  Thus, the cost of the Scan phase depends on the count of live threads,
+                  not on the maximum count of threads.
+
+                In dynamic mode the HP list traversal has additional atomic counter increment/decrement
+                to provide safe deletion of removed HP records.
+
+                If \p nDisposeQueueCapacity is not zero, the GC works in <i>background reclamation</i> mode.
+                The GC starts the reclamation thread that owns its own HP record. When the retired array of a thread is full,
+                the thread does not call Scan: the content of the array is handed off to the reclamation thread,
+                and the reclamation thread performs Scan and HelpScan. \p nDisposeQueueCapacity is the max count
+                of retired arrays waiting for the reclamation thread. If the reclamation thread falls behind
+                and the queue is full, the retiring thread performs Scan itself (back-pressure), so the count of
+                retired pointers waiting for reclamation is bounded by <tt>nDisposeQueueCapacity * nMaxRetiredPtrCount</tt>
+                plus the retired arrays of the threads.
+                In background mode the disposers of retired pointers are called from the reclamation thread,
+                so a disposer must not use thread-local data and must not retire pointers itself.
             */
             static void    CDS_STDCALL Construct(
                 size_t nHazardPtrCount = 0,     ///< Hazard pointer count per thread
                 size_t nMaxThreadCount = 0,     ///< Max count of simultaneous working thread in your application
                 size_t nMaxRetiredPtrCount = 0, ///< Capacity of the array of retired objects for the thread
-                scan_type nScanType = inplace   ///< Scan type (see \ref scan_type enum)
+                scan_type nScanType = inplace,  ///< Scan type (see \ref scan_type enum)
+                bool bDynamicHPRec = false,     ///< Dynamic HP record pool mode
+                size_t nDisposeQueueCapacity = 0    ///< Capacity of the reclamation thread queue, 0 - no background reclamation
             );
 
             /// Destroys global instance of GarbageCollector
@@ -339,6 +481,12 @@ namespace cds {
             /// Returns max size of retired objects array. It is defined in construction time
             size_t            getMaxRetiredPtrCount() const        { return m_nMaxRetiredPtrCount; }
 
+            /// Checks if the GC works in dynamic HP record pool mode
+            bool              isDynamicHPRec() const                { return m_bDynamicHPRec; }
+
+            /// Checks if the GC works in background reclamation mode
+            bool              isBackgroundReclamation() const      { return m_pDisposeThread != null_ptr<details::dispose_thread *>(); }
+
             // Internal statistics
 
             /// Get internal statistics
@@ -357,11 +505,12 @@ namespace cds {
 
             /// Checks that required hazard pointer count \p nRequiredCount is less or equal then max hazard pointer count
             /**
-                If \p nRequiredCount > getHazardPointerCount() then the exception HZPTooMany is thrown
+                If \p nRequiredCount > getHazardPointerCount() then the exception HZPTooMany is thrown.
+                In dynamic HP record pool mode the count of hazard pointers is unlimited.
             */
             static void checkHPCount( unsigned int nRequiredCount )
             {
-                if ( instance().getHazardPointerCount() < nRequiredCount )
+                if ( !instance().isDynamicHPRec() && instance().getHazardPointerCount() < nRequiredCount )
                     throw HZPTooMany()  ;
             }
 
@@ -382,6 +531,43 @@ namespace cds {
                 m_nScanType = nScanType ;
             }
 
+            /// Returns retired memory ceiling in bytes, 0 - no limit
+            size_t getRetiredMemoryCeiling() const
+            {
+                return m_RetiredMemory.ceiling() ;
+            }
+
+            /// Sets retired memory ceiling in bytes
+            /**
+                The size of retired-but-not-freed objects is summed over all HP records (and the queue
+                of the reclamation thread in background mode) at the end of each Scan phase.
+                On retire, the thread adds the size of its own retired array to that sum.
+                When the result exceeds \p nBytes, the background reclamation is bypassed and the thread
+                performs Scan and HelpScan immediately, so the retired memory is kept near the ceiling.
+
+                \p nBytes = 0 means no limit (the default). The ceiling can be changed on the fly.
+            */
+            void setRetiredMemoryCeiling( size_t nBytes )
+            {
+                m_RetiredMemory.ceiling( nBytes ) ;
+            }
+
+            /// Checks if retired memory exceeds the ceiling
+            /**
+                The retired memory is estimated as the sum computed in the last Scan phase
+                plus current size of the retired array of \p pRec.
+            */
+            bool isRetiredMemoryExceeded( details::HPRec * pRec ) const
+            {
+                return m_RetiredMemory.ceiling() && m_RetiredMemory.exceeded( m_RetiredMemory.size() + pRec->m_arrRetired.bytes() ) ;
+            }
+
+            /// Returns retired memory statistics
+            /**
+                The current size of retired memory is summed over all HP records at the call time.
+            */
+            cds::gc::details::retired_memory_stat& getRetiredMemoryStat( cds::gc::details::retired_memory_stat& st ) const ;
+
         public:    // Internals for threads
 
             /// Allocates Hazard Pointer GC record. For internal use only
@@ -398,6 +584,7 @@ namespace cds {
                 There are the following scan algorithm:
                 - \ref classic_scan allocates memory for internal use
                 - \ref inplace_scan does not allocate any memory
+                - \ref hashed_scan uses the hash set of HP record that is allocated by the first hashed scan of the record
 
                 Use \ref setScanType function to setup appropriate scan algorithm.
             */
@@ -407,12 +594,23 @@ namespace cds {
                     case inplace:
                         inplace_scan( pRec )   ;
                         break;
+                    case hashed:
+                        hashed_scan( pRec )    ;
+                        break;
                     default:
                         assert(false)   ;   // Forgotten something?..
                     case classic:
                         classic_scan( pRec )    ;
                         break;
                 }
+
+                if ( m_bDynamicHPRec && pRec->m_arrRetired.size() > pRec->m_arrRetired.capacity() / 2 )
+                    grow_retired( pRec )    ;
+
+                update_retired_memory( pRec ) ;
+
+                if ( m_bDynamicHPRec && m_pRemovedList )
+                    delete_removed_hprec()  ;
             }
 
             /// Helper scan routine
@@ -426,6 +624,39 @@ namespace cds {
             */
             void HelpScan( details::HPRec * pThis ) ;
 
+            /// Hands the retired array of \p pRec off to the reclamation thread
+            /**
+                The function is called internally by ThreadGC object instead of Scan when the retired array of the thread is full.
+                On success the retired array of \p pRec becomes empty.
+                The function returns \p false if the GC does not work in background reclamation mode
+                or if the queue of the reclamation thread is full; in that case the caller should call Scan itself.
+            */
+            bool DeferScan( details::HPRec * pRec ) ;
+
+            /// Performs synchronous Scan and HelpScan for \p pRec because of the retired memory ceiling is exceeded
+            /**
+                The function is called internally by ThreadGC object instead of DeferScan
+                when \ref isRetiredMemoryExceeded returns \p true.
+            */
+            void ForceScan( details::HPRec * pRec ) ;
+
+            /// Prepares retired array of \p pRec for the batch of \p nCount retired pointers
+            /**
+                If the batch does not fit into the retired array, the array is grown temporarily,
+                so the whole batch is reclaimed by single \ref Scan call.
+                The function returns the capacity of the array before growing;
+                pass it to \ref ReleaseRetired after the scan.
+
+                The function is called internally by ThreadGC::retirePtr for the range of retired pointers.
+            */
+            size_t ReserveRetired( details::HPRec * pRec, size_t nCount ) ;
+
+            /// Restores the capacity \p nCapacity of retired array of \p pRec after batch reclamation
+            /**
+                The array is not shrunk if the retired pointers remained after the scan do not fit into \p nCapacity.
+            */
+            void ReleaseRetired( details::HPRec * pRec, size_t nCapacity ) ;
+
         protected:
             /// Classic scan algorithm
             /**
@@ -459,6 +690,21 @@ namespace cds {
                 All operations are performed in-place.
             */
             void inplace_scan( details::HPRec * pRec );
+
+            /// Hash-based scan algorithm
+            /**
+                The algorithm is like \ref classic_scan but non-null hazard pointers are collected
+                into open-addressing hash set \p HPRec::m_setHP of the HP record.
+                The set is allocated by the first hashed scan of the record and is reused by subsequent scans,
+                so there is no memory allocation after the first scan and no sorting in the scan phase.
+                The search of each retired pointer takes O(1) on average instead of O(log n) binary search.
+
+                The capacity of the set is based on \p nMaxThreadCount * \p nHazardPtrCount.
+                If the HP list contains more non-null hazard pointers than the set can hold
+                (it is possible when the count of threads exceeds \p nMaxThreadCount)
+                the algorithm falls back to \ref classic_scan.
+            */
+            void hashed_scan( details::HPRec * pRec );
         };
 
         /// Thread's hazard pointer manager
@@ -537,7 +783,7 @@ namespace cds {
             template <typename T>
             void retirePtr( T * p, void (* pFunc)(T *) )
             {
-                retirePtr( details::retired_ptr( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc ) ) )    ;
+                retirePtr( details::retired_ptr( p, pFunc ))    ;
             }
 
             /// Places retired pointer \p into thread's array of retired pointer for deferred reclamation
@@ -545,10 +791,45 @@ namespace cds {
             {
                 m_pHzpRec->m_arrRetired.push( p ) ;
 
-                if ( m_pHzpRec->m_arrRetired.isFull() ) {
-                    // Max of retired pointer count is reached. Do scan
-                    scan()  ;
+                if ( m_HzpManager.isRetiredMemoryExceeded( m_pHzpRec ) ) {
+                    // Retired memory ceiling is exceeded - reclaim synchronously
+                    m_HzpManager.ForceScan( m_pHzpRec ) ;
                 }
+                else if ( m_pHzpRec->m_arrRetired.isFull() ) {
+                    // Max of retired pointer count is reached.
+                    // Pass the array to the reclamation thread or do scan
+                    if ( !m_HzpManager.DeferScan( m_pHzpRec ))
+                        scan()  ;
+                }
+            }
+
+            /// Places the range [\p itFirst, \p itLast) of retired pointers into thread's array of retired pointer
+            /**
+                The value type of \p ForwardIterator should be convertible to details::retired_ptr.
+                If the range does not fit into the retired array, the array is grown temporarily
+                and the whole range is reclaimed by one scan instead of one scan per each \p nMaxRetiredPtrCount pointers.
+            */
+            template <typename ForwardIterator>
+            void retirePtr( ForwardIterator itFirst, ForwardIterator itLast )
+            {
+                details::retired_vector& arr = m_pHzpRec->m_arrRetired ;
+                size_t nCount = static_cast<size_t>( std::distance( itFirst, itLast )) ;
+
+                if ( arr.size() + nCount < arr.capacity() ) {
+                    // The range fits into retired array
+                    for ( ; itFirst != itLast; ++itFirst )
+                        arr.push( *itFirst ) ;
+                    return ;
+                }
+
+                size_t nCapacity = m_HzpManager.ReserveRetired( m_pHzpRec, nCount ) ;
+                for ( ; itFirst != itLast; ++itFirst )
+                    arr.push( *itFirst ) ;
+                if ( m_HzpManager.isRetiredMemoryExceeded( m_pHzpRec ) )
+                    m_HzpManager.ForceScan( m_pHzpRec ) ;
+                else if ( !m_HzpManager.DeferScan( m_pHzpRec ))
+                    scan() ;
+                m_HzpManager.ReleaseRetired( m_pHzpRec, nCapacity ) ;
             }
 
             //@cond
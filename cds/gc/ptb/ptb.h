@@ -14,11 +14,13 @@
 
 #include <cds/cxx11_atomic.h>
 #include <cds/gc/details/retired_ptr.h>
+#include <cds/gc/details/retired_memory.h>
 #include <cds/details/aligned_allocator.h>
 #include <cds/details/allocator.h>
 #include <cds/details/noncopyable.h>
 
 #include <cds/lock/spinlock.h>
+#include <cds/user_setup/cache_line.h>
 
 #if CDS_COMPILER == CDS_COMPILER_MSVC
 #   pragma warning(push)
@@ -300,6 +302,17 @@ namespace cds { namespace gc {
                     return m_nItemCount.fetch_add( 1, CDS_ATOMIC::memory_order_relaxed ) + 1 ;
                 }
 
+                /// Pushes the list [\p head, \p tail] of \p nCount nodes linked by \p m_pNext field into the buffer. Returns current buffer size
+                size_t push_list( retired_ptr_node& head, retired_ptr_node& tail, size_t nCount )
+                {
+                    retired_ptr_node * pHead = m_pHead.load(CDS_ATOMIC::memory_order_acquire) ;
+                    do {
+                        tail.m_pNext = pHead ;
+                    } while ( !m_pHead.compare_exchange_weak( pHead, &head, CDS_ATOMIC::memory_order_release, CDS_ATOMIC::memory_order_relaxed ))    ;
+
+                    return m_nItemCount.fetch_add( nCount, CDS_ATOMIC::memory_order_relaxed ) + nCount ;
+                }
+
                 /// Result of \ref privatize function.
                 /**
                     The \p privatize function returns retired node list as \p first and the size of that list as \p second.
@@ -325,6 +338,34 @@ namespace cds { namespace gc {
                 }
             };
 
+            /// Partition of retired pointer buffer
+            /**
+                The retired pointers are distributed among the partitions by the hash of the pointer.
+                Each partition has its own liberate threshold and the hash table that is created by the first
+                liberate cycle of the partition and reused by the next ones.
+                Only one thread at a time may liberate a partition (\p m_bBusy flag), but different
+                partitions are liberated in parallel.
+            */
+            struct retired_partition
+            {
+                retired_ptr_buffer          m_Buffer    ;   ///< retired pointers of the partition
+                CDS_ATOMIC::atomic<size_t>  m_nThreshold;   ///< current liberate threshold of the partition
+                CDS_ATOMIC::atomic<bool>    m_bBusy     ;   ///< \p true if the partition is being liberated
+                CDS_ATOMIC::atomic<size_t>  m_nBytes    ;   ///< total size of retired objects in the partition
+                liberate_set *              m_pSet      ;   ///< liberate hash table, owned by the thread that holds \p m_bBusy
+
+                //@cond
+                char                        m_pad[ cds::c_nCacheLineSize ] ;   // keeps hot fields of adjacent partitions in different cache lines
+
+                retired_partition()
+                    : m_nThreshold( 0 )
+                    , m_bBusy( false )
+                    , m_nBytes( 0 )
+                    , m_pSet( null_ptr<liberate_set *>() )
+                {}
+                //@endcond
+            };
+
             /// Pool of retired pointers
             /**
                 The class acts as an allocator of retired node.
@@ -667,10 +708,22 @@ namespace cds { namespace gc {
             {
                 CDS_ATOMIC::atomic<size_t>  m_nGuardCount       ;   ///< Total guard count
                 CDS_ATOMIC::atomic<size_t>  m_nFreeGuardCount   ;   ///< Count of free guard
+                CDS_ATOMIC::atomic<size_t>  m_nLiberateCall     ;   ///< Count of liberate cycles
+                CDS_ATOMIC::atomic<size_t>  m_nLiberateBusy     ;   ///< Count of liberate calls skipped because the partition was being liberated by another thread
+                CDS_ATOMIC::atomic<size_t>  m_nFreedPtr         ;   ///< Count of retired pointer freed
+                CDS_ATOMIC::atomic<size_t>  m_nGuardedPtr       ;   ///< Count of retired pointer found guarded and returned to the buffer
+                CDS_ATOMIC::atomic<size_t>  m_nThresholdInc     ;   ///< Count of liberate threshold increasing
+                CDS_ATOMIC::atomic<size_t>  m_nThresholdDec     ;   ///< Count of liberate threshold decreasing
 
                 internal_stat()
                     : m_nGuardCount(0)
                     , m_nFreeGuardCount(0)
+                    , m_nLiberateCall(0)
+                    , m_nLiberateBusy(0)
+                    , m_nFreedPtr(0)
+                    , m_nGuardedPtr(0)
+                    , m_nThresholdInc(0)
+                    , m_nThresholdDec(0)
                 {}
             };
             //@endcond
@@ -684,17 +737,45 @@ namespace cds { namespace gc {
             {
                 size_t m_nGuardCount       ;   ///< Total guard count
                 size_t m_nFreeGuardCount   ;   ///< Count of free guard
+                size_t m_nRetiredPtrCount  ;   ///< Current count of retired pointers in all partitions (approximate)
+                size_t m_nLiberateCall     ;   ///< Count of liberate cycles
+                size_t m_nLiberateBusy     ;   ///< Count of liberate calls skipped because the partition was being liberated by another thread
+                size_t m_nFreedPtr         ;   ///< Count of retired pointer freed
+                size_t m_nGuardedPtr       ;   ///< Count of retired pointer found guarded and returned to the buffer
+                size_t m_nThresholdInc     ;   ///< Count of liberate threshold increasing
+                size_t m_nThresholdDec     ;   ///< Count of liberate threshold decreasing
+                size_t m_nRetiredBytes     ;   ///< Current size of retired objects in all partitions, bytes (approximate)
+                size_t m_nPeakRetiredBytes ;   ///< Max value of \p m_nRetiredBytes observed by liberate cycles
+                size_t m_nRetiredBytesCeiling ;    ///< Retired memory ceiling, 0 - no limit
+                size_t m_nRetiredCeilingHit;   ///< Count of liberate cycles forced by the retired memory ceiling
 
                 //@cond
                 InternalState()
                     : m_nGuardCount(0)
                     , m_nFreeGuardCount(0)
+                    , m_nRetiredPtrCount(0)
+                    , m_nLiberateCall(0)
+                    , m_nLiberateBusy(0)
+                    , m_nFreedPtr(0)
+                    , m_nGuardedPtr(0)
+                    , m_nThresholdInc(0)
+                    , m_nThresholdDec(0)
+                    , m_nRetiredBytes(0)
+                    , m_nPeakRetiredBytes(0)
+                    , m_nRetiredBytesCeiling(0)
+                    , m_nRetiredCeilingHit(0)
                 {}
 
                 InternalState& operator =( internal_stat const& s )
                 {
                     m_nGuardCount = s.m_nGuardCount.load(CDS_ATOMIC::memory_order_relaxed) ;
                     m_nFreeGuardCount = s.m_nFreeGuardCount.load(CDS_ATOMIC::memory_order_relaxed) ;
+                    m_nLiberateCall = s.m_nLiberateCall.load(CDS_ATOMIC::memory_order_relaxed) ;
+                    m_nLiberateBusy = s.m_nLiberateBusy.load(CDS_ATOMIC::memory_order_relaxed) ;
+                    m_nFreedPtr = s.m_nFreedPtr.load(CDS_ATOMIC::memory_order_relaxed) ;
+                    m_nGuardedPtr = s.m_nGuardedPtr.load(CDS_ATOMIC::memory_order_relaxed) ;
+                    m_nThresholdInc = s.m_nThresholdInc.load(CDS_ATOMIC::memory_order_relaxed) ;
+                    m_nThresholdDec = s.m_nThresholdDec.load(CDS_ATOMIC::memory_order_relaxed) ;
 
                     return *this ;
                 }
@@ -706,14 +787,16 @@ namespace cds { namespace gc {
 
             details::guard_allocator<>      m_GuardPool         ;   ///< Guard pool
             details::retired_ptr_pool<>     m_RetiredAllocator  ;   ///< Pool of free retired pointers
-            details::retired_ptr_buffer     m_RetiredBuffer     ;   ///< Retired pointer buffer for liberating
+            details::retired_partition *    m_arrPartition      ;   ///< Partitions of retired pointer buffer
+            const size_t                    m_nPartitionCount   ;   ///< Count of partitions, power of 2
             //CDS_ATOMIC::atomic<size_t>      m_nInLiberate       ;   ///< number of parallel \p liberate fnction call
 
-            CDS_ATOMIC::atomic<size_t>      m_nLiberateThreshold;   ///< Max size of retired pointer buffer to call liberate
+            const size_t    m_nLiberateThreshold;   ///< Initial (and minimal) liberate threshold of a partition
             const size_t    m_nInitialThreadGuardCount; ///< Initial count of guards allocated for ThreadGC
 
             internal_stat   m_stat  ;   ///< Internal statistics
             bool            m_bStatEnabled  ;   ///< Internal Statistics enabled
+            cds::gc::details::retired_memory    m_RetiredMemory ;   ///< Retired memory accounting
 
         public:
             /// Initializes PTB memory manager singleton
@@ -731,11 +814,23 @@ namespace cds { namespace gc {
                     is initialized the GC allocates local guard pool for the thread from common guard pool.
                     By perforce the local thread's guard pool is grown automatically from common pool.
                     When the thread terminated its guard pool is backed to common GC's pool.
-
+                \li \p nLiberatePartitionCount - count of partitions of retired pointer buffer, rounded up to power of 2.
+                    The retired pointers are distributed among the partitions by pointer hash, each partition
+                    has the liberate threshold <tt>nLiberateThreshold / nLiberatePartitionCount</tt> and
+                    is liberated separately, so several threads may liberate different partitions in parallel.
+                    Default is 1 that means the whole buffer is liberated by one thread at a time.
+
+                \par Adaptive threshold
+                If a liberate cycle of a partition cannot free any retired pointer (all of them are guarded)
+                the threshold of the partition is doubled to prevent useless cycles.
+                When the guards are released and the cycle frees more pointers than it keeps,
+                the threshold is halved back towards its initial value, so the retired memory does not
+                stay at the level reached by a temporary peak.
             */
             static void CDS_STDCALL Construct(
                 size_t nLiberateThreshold = 1024
                 , size_t nInitialThreadGuardCount = 8
+                , size_t nLiberatePartitionCount = 1
             ) ;
 
             /// Destroys PTB memory manager
@@ -795,14 +890,45 @@ namespace cds { namespace gc {
             template <typename T>
             void retirePtr( T * p, void (* pFunc)(T *) )
             {
-                retirePtr( retired_ptr( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc ) ) )    ;
+                retirePtr( retired_ptr( p, pFunc ))    ;
             }
 
             /// Places retired pointer \p into thread's array of retired pointer for deferred reclamation
             void retirePtr( const retired_ptr& p )
             {
-                if ( m_RetiredBuffer.push( m_RetiredAllocator.alloc(p)) >= m_nLiberateThreshold.load(CDS_ATOMIC::memory_order_relaxed) )
-                    liberate()  ;
+                details::retired_partition& part = partition( p.m_p ) ;
+                bool bCeiling = retire_bytes( part, p.m_nSize ) ;
+                if ( part.m_Buffer.push( m_RetiredAllocator.alloc(p)) >= part.m_nThreshold.load(CDS_ATOMIC::memory_order_relaxed) || bCeiling )
+                    liberate( part )  ;
+            }
+
+            /// Places the range [\p itFirst, \p itLast) of retired pointers into retired pointer buffer for deferred reclamation
+            /**
+                The value type of \p ForwardIterator should be convertible to \ref retired_ptr.
+                The range is linked to the chain and pushed into the partition of the first pointer by single CAS,
+                then \p liberate is called at most once for the whole range.
+            */
+            template <typename ForwardIterator>
+            void retirePtr( ForwardIterator itFirst, ForwardIterator itLast )
+            {
+                if ( itFirst == itLast )
+                    return ;
+
+                details::retired_ptr_node& head = m_RetiredAllocator.alloc( *itFirst ) ;
+                details::retired_ptr_node * pTail = &head   ;
+                size_t nCount = 1   ;
+                size_t nBytes = head.m_ptr.m_nSize ;
+                for ( ++itFirst; itFirst != itLast; ++itFirst, ++nCount ) {
+                    details::retired_ptr_node& node = m_RetiredAllocator.alloc( *itFirst ) ;
+                    pTail->m_pNext = &node  ;
+                    pTail = &node   ;
+                    nBytes += node.m_ptr.m_nSize ;
+                }
+
+                details::retired_partition& part = partition( head.m_ptr.m_p ) ;
+                bool bCeiling = retire_bytes( part, nBytes ) ;
+                if ( part.m_Buffer.push_list( head, *pTail, nCount ) >= part.m_nThreshold.load(CDS_ATOMIC::memory_order_relaxed) || bCeiling )
+                    liberate( part )  ;
             }
 
         protected:
@@ -810,9 +936,17 @@ namespace cds { namespace gc {
             /**
                 The main function of Pass The Buck algorithm. It tries to free retired pointers if they are not
                 trapped by any guard.
+                The function liberates all partitions of retired buffer except ones that are being
+                liberated by other threads now.
             */
             void liberate() ;
 
+            /// Liberates partition \p part
+            /**
+                If the partition is being liberated by another thread the function returns immediately.
+            */
+            void liberate( details::retired_partition& part ) ;
+
             //@}
 
         private:
@@ -820,13 +954,83 @@ namespace cds { namespace gc {
 #if 0
             void liberate( details::liberate_set& set ) ;
 #endif
+            details::retired_partition& partition( void * p )
+            {
+                // The partition is selected by middle bits of the pointer.
+                // liberate_set uses the high bits of Fibonacci hash, so the buckets are not correlated with the partition
+                uptr_atomic_t h = reinterpret_cast<uptr_atomic_t>( p ) >> 4 ;
+                h ^= h >> 8 ;
+                return m_arrPartition[ static_cast<size_t>( h ) & (m_nPartitionCount - 1) ] ;
+            }
+
+            // Accounts nBytes retired into the partition. Returns true if the partition exceeds its share of the ceiling
+            bool retire_bytes( details::retired_partition& part, size_t nBytes )
+            {
+                // The bytes are counted before the push, so a concurrent liberate never makes the counter negative
+                size_t nPartBytes = part.m_nBytes.fetch_add( nBytes, CDS_ATOMIC::memory_order_relaxed ) + nBytes ;
+                size_t nCeiling = m_RetiredMemory.ceiling() ;
+                if ( nCeiling && nPartBytes > nCeiling / m_nPartitionCount ) {
+                    m_RetiredMemory.hit() ;
+                    return true ;
+                }
+                return false ;
+            }
+
+            size_t retired_bytes() const
+            {
+                size_t nBytes = 0 ;
+                for ( size_t i = 0; i < m_nPartitionCount; ++i )
+                    nBytes += m_arrPartition[i].m_nBytes.load( CDS_ATOMIC::memory_order_relaxed ) ;
+                return nBytes ;
+            }
             //@endcond
 
         public:
             /// Get internal statistics
             InternalState& getInternalState(InternalState& stat) const
             {
-                return stat = m_stat   ;
+                stat = m_stat ;
+                stat.m_nRetiredPtrCount = 0 ;
+                for ( size_t i = 0; i < m_nPartitionCount; ++i )
+                    stat.m_nRetiredPtrCount += m_arrPartition[i].m_Buffer.size() ;
+
+                cds::gc::details::retired_memory_stat ms ;
+                getRetiredMemoryStat( ms ) ;
+                stat.m_nRetiredBytes        = ms.nRetiredBytes      ;
+                stat.m_nPeakRetiredBytes    = ms.nPeakRetiredBytes  ;
+                stat.m_nRetiredBytesCeiling = ms.nCeiling           ;
+                stat.m_nRetiredCeilingHit   = ms.nCeilingHit        ;
+                return stat ;
+            }
+
+            /// Returns retired memory ceiling in bytes, 0 - no limit
+            size_t getRetiredMemoryCeiling() const
+            {
+                return m_RetiredMemory.ceiling() ;
+            }
+
+            /// Sets retired memory ceiling in bytes
+            /**
+                Each partition of the retired buffer gets the equal share <tt>nBytes / nLiberatePartitionCount</tt>
+                of the ceiling. When the size of retired objects in a partition exceeds its share,
+                the retiring thread liberates the partition regardless of the liberate threshold.
+
+                \p nBytes = 0 means no limit (the default). The ceiling can be changed on the fly.
+            */
+            void setRetiredMemoryCeiling( size_t nBytes )
+            {
+                m_RetiredMemory.ceiling( nBytes ) ;
+            }
+
+            /// Returns retired memory statistics
+            /**
+                The current size is summed over the partitions at the call time, the peak is the max size
+                observed by liberate cycles and by the calls of this function.
+            */
+            cds::gc::details::retired_memory_stat& getRetiredMemoryStat( cds::gc::details::retired_memory_stat& st ) const
+            {
+                const_cast<cds::gc::details::retired_memory&>( m_RetiredMemory ).set( retired_bytes() ) ;
+                return m_RetiredMemory.get_stat( st ) ;
             }
 
             /// Checks if internal statistics enabled
@@ -845,7 +1049,7 @@ namespace cds { namespace gc {
 
         private:
             //@cond none
-            GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount )  ;
+            GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount, size_t nLiberatePartitionCount )  ;
             ~GarbageCollector() ;
             //@endcond
         };
@@ -113,6 +113,12 @@ namespace cds { namespace gc {
         };
 #endif
 
+        /// Retired pointer type
+        typedef cds::gc::details::retired_ptr   retired_ptr ;
+
+        /// Retired memory statistics, see \ref get_retired_memory_stat
+        typedef cds::gc::details::retired_memory_stat   retired_memory_stat ;
+
         /// Thread GC implementation for internal usage
         typedef ptb::ThreadGC   thread_gc_impl  ;
 
@@ -410,11 +416,13 @@ namespace cds { namespace gc {
         PTB(
             size_t nLiberateThreshold = 1024
             , size_t nInitialThreadGuardCount = 8
+            , size_t nLiberatePartitionCount = 1
         )
         {
             ptb::GarbageCollector::Construct(
                 nLiberateThreshold,
-                nInitialThreadGuardCount
+                nInitialThreadGuardCount,
+                nLiberatePartitionCount
             )   ;
         }
 
@@ -463,12 +471,43 @@ namespace cds { namespace gc {
             retire( p, cds::details::static_functor<Disposer, T>::call ) ;
         }
 
+        /// Retire the range [\p itFirst, \p itLast) of retired pointers
+        /**
+            The value type of \p ForwardIterator should be convertible to \ref retired_ptr.
+            The whole range is placed into the retired buffer at once, so the liberate procedure
+            is called at most once per range.
+
+            Usually, the function is called by cds::gc::details::retired_batch helper class.
+        */
+        template <typename ForwardIterator>
+        static void retire_batch( ForwardIterator itFirst, ForwardIterator itLast )
+        {
+            ptb::GarbageCollector::instance().retirePtr( itFirst, itLast )  ;
+        }
+
         /// Checks if Pass-the-Buck GC is constructed and may be used
         static bool isUsed()
         {
             return ptb::GarbageCollector::isUsed() ;
         }
 
+        /// Sets the ceiling of retired memory in bytes, 0 - no limit
+        /**
+            When a partition of the retired buffer holds more than its share of the ceiling,
+            the retiring thread liberates the partition immediately.
+            See ptb::GarbageCollector::setRetiredMemoryCeiling for details.
+        */
+        static void set_retired_memory_ceiling( size_t nBytes )
+        {
+            ptb::GarbageCollector::instance().setRetiredMemoryCeiling( nBytes ) ;
+        }
+
+        /// Returns the snapshot of retired memory statistics
+        static retired_memory_stat& get_retired_memory_stat( retired_memory_stat& st )
+        {
+            return ptb::GarbageCollector::instance().getRetiredMemoryStat( st ) ;
+        }
+
         /// Forced GC cycle call for current thread
         /**
             Usually, this function should not be called directly.
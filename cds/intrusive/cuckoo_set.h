@@ -22,10 +22,26 @@
 #include <cds/details/std/memory.h>
 #include <cds/details/functor_wrapper.h>
 #include <cds/lock/spinlock.h>
+#include <cds/bitop.h>
+#include <cds/os/timer.h>
+#include <vector>
 
 #include <cds/details/std/mutex.h>
 //#include <boost/thread/recursive_mutex.hpp>
 
+//@cond
+// SIMD matching of the probeset fingerprints, see cuckoo::fingerprint option
+#if CDS_PROCESSOR_ARCH == CDS_PROCESSOR_AMD64 \
+    || ( CDS_PROCESSOR_ARCH == CDS_PROCESSOR_X86 && ( defined(__SSE2__) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )))
+#   define CDS_CUCKOO_FINGERPRINT_SSE2
+#   include <emmintrin.h>
+#   ifdef __AVX2__
+#       define CDS_CUCKOO_FINGERPRINT_AVX2
+#       include <immintrin.h>
+#   endif
+#endif
+//@endcond
+
 namespace cds { namespace intrusive {
 
     /// CuckooSet-related definitions
@@ -79,6 +95,77 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        /// Option enabling optimistic lock-free search
+        /**
+            If \p Enable is \p true, the \p find functions of CuckooSet do not acquire the cell locks.
+            Instead, they read both candidate probesets optimistically under per-stripe version counters
+            and retry only when a concurrent modification, relocation or resizing of these probesets is detected.
+            The writers (\p insert, \p ensure, \p erase, \p unlink, relocating and resizing) still use
+            the mutex policy of the set and additionally increment the version counters of the stripes they change.
+
+            The \p find functions with a functor call the functor under the cell lock as usual:
+            the optimistic search is used to answer "not found" without locking, and
+            the plain <tt>find( val )</tt> is answered completely without locking.
+
+            The optimistic search reads the items that may be concurrently unlinked from the set.
+            So, when the option is enabled the memory of unlinked items must remain readable
+            while concurrent \p find is possible, and the key comparison must tolerate
+            reading the key of the item being changed. This is true, for example, for integral keys and
+            for items allocated from a type-stable pool. The bucket tables and version counters replaced by resizing
+            are kept until the set is destroyed, this costs at most the size of current bucket table.
+
+            The option requires \p cuckoo::vector probe set: the search in \p cuckoo::list probe set
+            follows the link of the item that may be already unlinked and reused, so this combination
+            is rejected at compile time. The containers (cds::container::CuckooSet, cds::container::CuckooMap)
+            free the erased items immediately, so for them the option is allowed only
+            if the key type is trivially destructible.
+
+            Default is \p false.
+        */
+        template <bool Enable>
+        struct optimistic_find
+        {
+            //@cond
+            template <typename Base>
+            struct pack: public Base {
+                static bool const optimistic_find = Enable ;
+            };
+            //@endcond
+        };
+
+        /// Option enabling the hash fingerprints in \p cuckoo::vector probeset
+        /**
+            If the option is specified, each \p cuckoo::vector<Capacity> probeset keeps a short fingerprint
+            of the hash value of its items in a contiguous array beside the item pointers.
+            The search compares the fingerprint of the key against the whole array at once
+            (with SSE2 or AVX2 instructions for \p Fingerprint of 8 or 16 bits on x86/amd64,
+            with the plain loop on other platforms and for other fingerprint types) and calls
+            the key predicate only for the items with equal fingerprint.
+            So, the search does not dereference the items of the probeset that surely have another key.
+
+            The fingerprint is derived from the high-order bits of the hash value, since the items of one probeset
+            share the low-order bits. The hash is computed only on insertion and relocating;
+            use cuckoo::store_hash to avoid rehashing the items on relocating and resizing.
+
+            \p Fingerprint is an unsigned integral type: \p uint8_t (the default for the option), \p uint16_t,
+            \p uint32_t. The wider fingerprint gives less false matches but takes more memory per probeset.
+            Default is \p opt::none - the probeset has no fingerprints.
+
+            The option is applicable only for \p cuckoo::vector probeset type.
+            The fingerprint probeset is not ordered even if \p opt::compare or \p opt::less is specified:
+            all items are inserted at the end of the probeset.
+        */
+        template <typename Fingerprint = uint8_t>
+        struct fingerprint
+        {
+            //@cond
+            template <typename Base>
+            struct pack: public Base {
+                typedef Fingerprint fingerprint ;
+            };
+            //@endcond
+        };
+
 
         //@cond
         // Probeset type placeholders
@@ -988,6 +1075,10 @@ namespace cds { namespace intrusive {
             counter_type    m_nFalseResizeCount     ;   ///< Count of false \p resize function call (when other thread has been resized the set)
             counter_type    m_nResizeSuccessNodeMove;   ///< Count of successfull node moving when resizing
             counter_type    m_nResizeRelocateCall   ;   ///< Count of \p relocate function call from \p resize function
+            counter_type    m_nResizeDuration       ;   ///< Total duration of resizing, in microseconds
+            counter_type    m_nResizeHelperCount    ;   ///< Count of threads that helped to resize instead of waiting for the end of resizing
+            counter_type    m_nResizeHelpedChunkCount;  ///< Count of bucket chunks moved by helping threads
+            counter_type    m_nResizeDeferredMove   ;   ///< Count of items deferred to the resizing thread because all their probesets were above the threshold
 
             counter_type    m_nInsertSuccess        ;   ///< Count of successfull \p insert function call
             counter_type    m_nInsertFailed         ;   ///< Count of failed \p insert function call
@@ -1016,6 +1107,9 @@ namespace cds { namespace intrusive {
             counter_type    m_nFindWithSuccess         ;   ///< Count of success \p find_with function call
             counter_type    m_nFindWithFailed          ;   ///< Count of failed \p find_with function call
 
+            counter_type    m_nFindOptimisticRetry     ;   ///< Count of optimistic search retries because of concurrent modification
+            counter_type    m_nFindOptimisticFallback  ;   ///< Count of optimistic search failures followed by locked search
+
             //@cond
             void    onRelocateCall()        { ++m_nRelocateCallCount; }
             void    onRelocateRound()       { ++m_nRelocateRoundCount; }
@@ -1028,6 +1122,10 @@ namespace cds { namespace intrusive {
             void    onFalseResizeCall()     { ++m_nFalseResizeCount; }
             void    onResizeSuccessMove()   { ++m_nResizeSuccessNodeMove; }
             void    onResizeRelocateCall()  { ++m_nResizeRelocateCall; }
+            void    onResizeDuration( size_t nMicroseconds ) { m_nResizeDuration += nMicroseconds; }
+            void    onResizeHelper()        { ++m_nResizeHelperCount; }
+            void    onResizeHelpedChunk()   { ++m_nResizeHelpedChunkCount; }
+            void    onResizeDeferredMove()  { ++m_nResizeDeferredMove; }
 
             void    onInsertSuccess()       { ++m_nInsertSuccess; }
             void    onInsertFailed()        { ++m_nInsertFailed; }
@@ -1052,6 +1150,9 @@ namespace cds { namespace intrusive {
 
             void    onFindWithSuccess()     { ++m_nFindWithSuccess; }
             void    onFindWithFailed()      { ++m_nFindWithFailed; }
+
+            void    onFindOptimisticRetry()    { ++m_nFindOptimisticRetry; }
+            void    onFindOptimisticFallback() { ++m_nFindOptimisticFallback; }
             //@endcond
         };
 
@@ -1069,6 +1170,10 @@ namespace cds { namespace intrusive {
             void    onFalseResizeCall()     const {}
             void    onResizeSuccessMove()   const {}
             void    onResizeRelocateCall()  const {}
+            void    onResizeDuration( size_t ) const {}
+            void    onResizeHelper()        const {}
+            void    onResizeHelpedChunk()   const {}
+            void    onResizeDeferredMove()  const {}
 
             void    onInsertSuccess()       const {}
             void    onInsertFailed()        const {}
@@ -1093,6 +1198,9 @@ namespace cds { namespace intrusive {
 
             void    onFindWithSuccess()     const {}
             void    onFindWithFailed()      const {}
+
+            void    onFindOptimisticRetry()    const {}
+            void    onFindOptimisticFallback() const {}
             //@endcond
         };
 
@@ -1170,6 +1278,12 @@ namespace cds { namespace intrusive {
 
             /// Internal statistics. Available statistics: cuckoo::stat, cuckoo::empty_stat
             typedef empty_stat                  stat ;
+
+            /// Optimistic lock-free search. See cuckoo::optimistic_find option for explanation
+            static bool const optimistic_find = false ;
+
+            /// Probeset fingerprint type. See cuckoo::fingerprint option for explanation
+            typedef opt::none                   fingerprint ;
         };
 
         /// Metafunction converting option list to CuckooSet traits
@@ -1276,7 +1390,7 @@ namespace cds { namespace intrusive {
                     return iterator()   ;
                 }
 
-                void insert_after( iterator it, node_type * p )
+                void insert_after( iterator it, node_type * p, size_t /*nHash*/ )
                 {
                     node_type * pPrev = it.pNode    ;
                     if ( pPrev ) {
@@ -1374,6 +1488,13 @@ namespace cds { namespace intrusive {
                     // alternative: low-level byte copying
                     //memmove( pFrom + 1, pFrom, (m_nSize - nFrom - 1) * sizeof(m_arrNode[0])) ;
                 }
+            public:
+                class iterator ;
+            protected:
+                static node_type ** slot( iterator it )
+                {
+                    return it.pArr ;
+                }
             public:
                 class iterator
                 {
@@ -1443,7 +1564,7 @@ namespace cds { namespace intrusive {
                     return iterator(m_arrNode + size()) ;
                 }
 
-                void insert_after( iterator it, node_type * p )
+                void insert_after( iterator it, node_type * p, size_t /*nHash*/ )
                 {
                     assert( m_nSize < c_nCapacity ) ;
                     assert( !it.pArr || (m_arrNode <= it.pArr && it.pArr <= m_arrNode + m_nSize)) ;
@@ -1537,6 +1658,24 @@ namespace cds { namespace intrusive {
                     pos.itFound = probeset.end() ;
                     return false ;
                 }
+
+                template <typename BucketEntry, typename Q, typename Compare>
+                static int find_optimistic( BucketEntry& probeset, unsigned int /*nTable*/, size_t /*nHash*/, Q const& val, Compare cmp, unsigned int nLimit )
+                {
+                    // Ordered version, the probeset is not locked and can be changed concurrently.
+                    // Returns 1 if found, 0 if not found, -1 if the probeset looks inconsistent
+                    typedef typename BucketEntry::iterator bucket_iterator ;
+
+                    unsigned int nCount = 0 ;
+                    for ( bucket_iterator it = probeset.begin(), itEnd = probeset.end(); it != itEnd; ++it ) {
+                        if ( ++nCount > nLimit || it.operator->() == null_ptr<typename BucketEntry::node_type *>() )
+                            return -1 ;
+                        int cmpRes = cmp( *NodeTraits::to_value_ptr(*it), val ) ;
+                        if ( cmpRes >= 0 )
+                            return cmpRes == 0 ? 1 : 0 ;
+                    }
+                    return 0 ;
+                }
             };
 
             template <typename NodeTraits>
@@ -1564,6 +1703,509 @@ namespace cds { namespace intrusive {
                     pos.itFound = probeset.end() ;
                     return false ;
                 }
+
+                template <typename BucketEntry, typename Q, typename EqualTo>
+                static int find_optimistic( BucketEntry& probeset, unsigned int nTable, size_t nHash, Q const& val, EqualTo eq, unsigned int nLimit )
+                {
+                    // Unordered version, the probeset is not locked and can be changed concurrently.
+                    // Returns 1 if found, 0 if not found, -1 if the probeset looks inconsistent
+                    typedef typename BucketEntry::iterator  bucket_iterator ;
+                    typedef typename BucketEntry::node_type node_type ;
+
+                    unsigned int nCount = 0 ;
+                    for ( bucket_iterator it = probeset.begin(), itEnd = probeset.end(); it != itEnd; ++it ) {
+                        if ( ++nCount > nLimit || it.operator->() == null_ptr<node_type *>() )
+                            return -1 ;
+                        if ( hash_ops<node_type, node_type::hash_array_size>::equal_to( *it, nTable, nHash ) && eq( *NodeTraits::to_value_ptr(*it), val ))
+                            return 1 ;
+                    }
+                    return 0 ;
+                }
+            };
+
+            // Fingerprint of hash value for fingerprint probeset
+            // The items of one probeset have the same low-order bits of the hash value (the bucket index),
+            // so the fingerprint is built from the high-order bits of hash multiplied by the golden ratio constant
+            template <typename Fingerprint>
+            struct fingerprint_traits
+            {
+                typedef Fingerprint fingerprint_type ;
+
+                static fingerprint_type make( size_t nHash )
+                {
+                    static_assert( sizeof(fingerprint_type) <= sizeof(size_t), "The fingerprint type is too large" ) ;
+#           if CDS_BUILD_BITS == 64
+                    size_t const nMul = (size_t) 0x9E3779B97F4A7C15ULL ;
+#           else
+                    size_t const nMul = 0x9E3779B9 ;
+#           endif
+                    return (fingerprint_type)(( nHash * nMul ) >> (( sizeof(size_t) - sizeof(fingerprint_type)) * 8 )) ;
+                }
+            };
+
+            // Fingerprint matching
+            // match() returns the bit mask of the items of pArr that are equal to fp, Count is the size of pArr
+            // Generic version is a plain loop
+            template <typename Fingerprint, unsigned int Count>
+            struct fingerprint_match
+            {
+                static unsigned int match( Fingerprint const * pArr, Fingerprint fp )
+                {
+                    unsigned int nMask = 0 ;
+                    for ( unsigned int i = 0; i < Count; ++i ) {
+                        if ( pArr[i] == fp )
+                            nMask |= 1U << i ;
+                    }
+                    return nMask ;
+                }
+            };
+
+#       ifdef CDS_CUCKOO_FINGERPRINT_SSE2
+            template <unsigned int Count>
+            struct fingerprint_match< uint8_t, Count >
+            {
+                static unsigned int match( uint8_t const * pArr, uint8_t fp )
+                {
+                    static_assert( Count % 16 == 0, "The fingerprint array must be padded to 16 bytes" ) ;
+                    unsigned int nMask = 0 ;
+#           ifdef CDS_CUCKOO_FINGERPRINT_AVX2
+                    if ( Count % 32 == 0 ) {
+                        __m256i const key = _mm256_set1_epi8( (char) fp ) ;
+                        for ( unsigned int i = 0; i < Count; i += 32 )
+                            nMask |= (unsigned int) _mm256_movemask_epi8( _mm256_cmpeq_epi8( _mm256_loadu_si256( reinterpret_cast<__m256i const *>( pArr + i )), key )) ;
+                        return nMask ;
+                    }
+#           endif
+                    __m128i const key = _mm_set1_epi8( (char) fp ) ;
+                    for ( unsigned int i = 0; i < Count; i += 16 )
+                        nMask |= ((unsigned int) _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const *>( pArr + i )), key ))) << i ;
+                    return nMask ;
+                }
+            };
+
+            template <unsigned int Count>
+            struct fingerprint_match< uint16_t, Count >
+            {
+                static unsigned int match( uint16_t const * pArr, uint16_t fp )
+                {
+                    static_assert( Count % 8 == 0, "The fingerprint array must be padded to 16 bytes" ) ;
+                    __m128i const key = _mm_set1_epi16( (short) fp ) ;
+                    __m128i const zero = _mm_setzero_si128() ;
+                    unsigned int nMask = 0 ;
+                    for ( unsigned int i = 0; i < Count; i += 8 ) {
+                        // packing 16-bit comparison results to 8-bit gives one bit per item in movemask
+                        __m128i cmp = _mm_cmpeq_epi16( _mm_loadu_si128( reinterpret_cast<__m128i const *>( pArr + i )), key ) ;
+                        nMask |= ((unsigned int) _mm_movemask_epi8( _mm_packs_epi16( cmp, zero )) & 0xFF ) << i ;
+                    }
+                    return nMask ;
+                }
+            };
+#       endif
+
+            template <typename Node, typename Probeset, typename Fingerprint>
+            class fingerprint_bucket_entry ;
+
+            // cuckoo::vector probeset with contiguous array of the hash fingerprints of its items.
+            // The item i has the fingerprint m_arrFingerprint[i]
+            template <typename Node, unsigned int Capacity, typename Fingerprint>
+            class fingerprint_bucket_entry<Node, cuckoo::vector<Capacity>, Fingerprint>: public bucket_entry<Node, cuckoo::vector<Capacity> >
+            {
+                typedef bucket_entry<Node, cuckoo::vector<Capacity> >   base_class ;
+            public:
+                typedef typename base_class::node_type  node_type   ;
+                typedef typename base_class::iterator   iterator    ;
+                typedef Fingerprint                     fingerprint_type ;
+                typedef fingerprint_traits< fingerprint_type > fp_traits ;
+
+                static unsigned int const c_nCapacity = base_class::c_nCapacity ;
+
+                // The fingerprint array is padded to 16 bytes to be compared by SIMD instructions
+                static unsigned int const c_nFingerprintCount = ( c_nCapacity * sizeof(fingerprint_type) + 15 ) / 16 * 16 / sizeof(fingerprint_type) ;
+
+            protected:
+                fingerprint_type    m_arrFingerprint[ c_nFingerprintCount ] ;
+
+            public:
+                fingerprint_bucket_entry()
+                {
+                    static_assert( c_nFingerprintCount <= 32, "cuckoo::vector capacity is too large for the fingerprint probeset" ) ;
+                    memset( m_arrFingerprint, 0, sizeof(m_arrFingerprint)) ;
+                }
+
+                iterator at( unsigned int nPos )
+                {
+                    return iterator( base_class::m_arrNode + nPos ) ;
+                }
+
+                void insert_after( iterator it, node_type * p, size_t nHash )
+                {
+                    node_type ** pPrev = base_class::slot( it ) ;
+                    unsigned int const nPos = pPrev ? (unsigned int)( pPrev - base_class::m_arrNode ) + 1 : 0 ;
+                    unsigned int const nSize = base_class::size() ;
+
+                    std::copy_backward( m_arrFingerprint + nPos, m_arrFingerprint + nSize, m_arrFingerprint + nSize + 1 ) ;
+                    m_arrFingerprint[ nPos ] = fp_traits::make( nHash ) ;
+                    base_class::insert_after( it, p, nHash ) ;
+                }
+
+                void remove( iterator itPrev, iterator itWhat )
+                {
+                    unsigned int const nPos = (unsigned int)( base_class::slot( itWhat ) - base_class::m_arrNode ) ;
+                    std::copy( m_arrFingerprint + nPos + 1, m_arrFingerprint + base_class::size(), m_arrFingerprint + nPos ) ;
+                    base_class::remove( itPrev, itWhat ) ;
+                }
+
+                // Returns the bit mask of first nSize items having the same fingerprint as nHash
+                unsigned int match( size_t nHash, unsigned int nSize ) const
+                {
+                    assert( nSize <= c_nCapacity ) ;
+                    return fingerprint_match< fingerprint_type, c_nFingerprintCount >::match( m_arrFingerprint, fp_traits::make( nHash ))
+                        & (unsigned int)(( atomic64u_t(1) << nSize ) - 1 ) ;
+                }
+            };
+
+            template <bool Ordered>
+            struct fingerprint_key_match ;
+
+            template <>
+            struct fingerprint_key_match<true>
+            {
+                template <typename T, typename Q, typename Compare>
+                static bool equal( T const& v, Q const& val, Compare cmp )
+                {
+                    return cmp( v, val ) == 0 ;
+                }
+            };
+
+            template <>
+            struct fingerprint_key_match<false>
+            {
+                template <typename T, typename Q, typename EqualTo>
+                static bool equal( T const& v, Q const& val, EqualTo eq )
+                {
+                    return eq( v, val ) ;
+                }
+            };
+
+            // Search in fingerprint probeset
+            // The fingerprint probeset is not ordered, the new item is appended to the end of the probeset
+            template <typename NodeTraits, bool Ordered>
+            struct contains_fingerprint
+            {
+                typedef fingerprint_key_match<Ordered>  key_match ;
+
+                template <typename BucketEntry, typename Position, typename Q, typename Predicate>
+                static bool find( BucketEntry& probeset, Position& pos, unsigned int /*nTable*/, size_t nHash, Q const& val, Predicate pred )
+                {
+                    typedef typename BucketEntry::iterator bucket_iterator ;
+
+                    unsigned int const nSize = probeset.size() ;
+                    for ( unsigned int nMask = probeset.match( nHash, nSize ); nMask; nMask &= nMask - 1 ) {
+                        unsigned int nPos = (unsigned int) cds::bitop::LSBnz( nMask ) ;
+                        bucket_iterator it = probeset.at( nPos ) ;
+                        if ( key_match::equal( *NodeTraits::to_value_ptr(*it), val, pred )) {
+                            pos.itFound = it ;
+                            pos.itPrev = nPos ? probeset.at( nPos - 1 ) : bucket_iterator() ;
+                            return true ;
+                        }
+                    }
+
+                    pos.itPrev = nSize ? probeset.at( nSize - 1 ) : bucket_iterator() ;
+                    pos.itFound = probeset.end() ;
+                    return false ;
+                }
+
+                template <typename BucketEntry, typename Q, typename Predicate>
+                static int find_optimistic( BucketEntry& probeset, unsigned int /*nTable*/, size_t nHash, Q const& val, Predicate pred, unsigned int nLimit )
+                {
+                    // The probeset is not locked and can be changed concurrently.
+                    // Returns 1 if found, 0 if not found, -1 if the probeset looks inconsistent
+                    typedef typename BucketEntry::node_type node_type ;
+
+                    unsigned int const nSize = probeset.size() ;
+                    if ( nSize > nLimit || nSize > BucketEntry::c_nCapacity )
+                        return -1 ;
+
+                    for ( unsigned int nMask = probeset.match( nHash, nSize ); nMask; nMask &= nMask - 1 ) {
+                        node_type * pNode = probeset.at( (unsigned int) cds::bitop::LSBnz( nMask )).operator->() ;
+                        if ( pNode == null_ptr<node_type *>() )
+                            return -1 ;
+                        if ( key_match::equal( *NodeTraits::to_value_ptr( *pNode ), val, pred ))
+                            return 1 ;
+                    }
+                    return 0 ;
+                }
+            };
+
+            // Per-stripe version counters for optimistic search
+            // There is one stripe per lock of the mutex policy for each table;
+            // the stripe of the hash value is (hash & stripe mask).
+            // A writer increments nBegin of its stripes after acquiring the cell lock
+            // and nEnd before releasing it. Two counters are used instead of single odd/even sequence
+            // since the thread relocating an item may own the same stripe twice.
+            // Resizing and clearing change the global sequence that is odd while the operation is in progress.
+            template <unsigned int Arity, class Alloc>
+            class stripe_version_table
+            {
+                struct stripe {
+                    CDS_ATOMIC::atomic<size_t>  nBegin  ;   // count of started modifications
+                    CDS_ATOMIC::atomic<size_t>  nEnd    ;   // count of finished modifications
+
+                    stripe()
+                        : nBegin(0)
+                        , nEnd(0)
+                    {}
+                };
+                typedef cds::details::Allocator< stripe, Alloc >  stripe_allocator ;
+
+                // The stripe arrays replaced by resizing; concurrent readers may still use them
+                struct retired_stripes {
+                    stripe *            arrStripe[ Arity ] ;
+                    size_t              nCapacity   ;
+                    retired_stripes *   pNext       ;
+                };
+                typedef cds::details::Allocator< retired_stripes, Alloc >  retired_allocator ;
+
+                stripe *                    m_arrStripe[ Arity ]   ;
+                size_t                      m_nMask     ;
+                CDS_ATOMIC::atomic<size_t>  m_nGlobal   ;
+                retired_stripes *           m_pRetired  ;
+
+            public:
+                struct snapshot {
+                    size_t          nGlobal     ;
+                    stripe const *  arrStripe[ Arity ] ;
+                    size_t          arrBegin[ Arity ]  ;
+                };
+
+            protected:
+                void allocate( size_t nStripeCount )
+                {
+                    assert( cds::beans::is_power2( nStripeCount )) ;
+                    stripe_allocator alloc ;
+                    for ( unsigned int i = 0; i < Arity; ++i )
+                        m_arrStripe[i] = alloc.NewArray( nStripeCount ) ;
+
+                    // the readers load m_nMask before m_arrStripe
+                    CDS_ATOMIC::atomic_thread_fence( CDS_ATOMIC::memory_order_release ) ;
+                    m_nMask = nStripeCount - 1 ;
+                }
+
+                static void free_stripes( stripe ** arrStripe, size_t nCapacity )
+                {
+                    stripe_allocator alloc ;
+                    for ( unsigned int i = 0; i < Arity; ++i )
+                        alloc.Delete( arrStripe[i], nCapacity ) ;
+                }
+
+            public:
+                stripe_version_table( size_t nStripeCount )
+                    : m_nMask( 0 )
+                    , m_nGlobal( 0 )
+                    , m_pRetired( null_ptr<retired_stripes *>() )
+                {
+                    allocate( nStripeCount ) ;
+                }
+
+                ~stripe_version_table()
+                {
+                    free_stripes( m_arrStripe, m_nMask + 1 ) ;
+
+                    retired_allocator alloc ;
+                    while ( m_pRetired ) {
+                        retired_stripes * p = m_pRetired ;
+                        m_pRetired = p->pNext ;
+                        free_stripes( p->arrStripe, p->nCapacity ) ;
+                        alloc.Delete( p ) ;
+                    }
+                }
+
+                // Must be called under begin_write_all()/end_write_all()
+                void resize( size_t nStripeCount )
+                {
+                    if ( nStripeCount == m_nMask + 1 )
+                        return ;
+
+                    retired_stripes * p = retired_allocator().New() ;
+                    memcpy( p->arrStripe, m_arrStripe, sizeof(m_arrStripe)) ;
+                    p->nCapacity = m_nMask + 1 ;
+                    p->pNext = m_pRetired ;
+                    m_pRetired = p ;
+
+                    allocate( nStripeCount ) ;
+                }
+
+                void begin_write( size_t const * arrHash )
+                {
+                    for ( unsigned int i = 0; i < Arity; ++i )
+                        m_arrStripe[i][ arrHash[i] & m_nMask ].nBegin.fetch_add( 1, CDS_ATOMIC::memory_order_acq_rel ) ;
+                    CDS_ATOMIC::atomic_thread_fence( CDS_ATOMIC::memory_order_release ) ;
+                }
+
+                void end_write( size_t const * arrHash )
+                {
+                    for ( unsigned int i = 0; i < Arity; ++i )
+                        m_arrStripe[i][ arrHash[i] & m_nMask ].nEnd.fetch_add( 1, CDS_ATOMIC::memory_order_release ) ;
+                }
+
+                void begin_write_all()
+                {
+                    m_nGlobal.fetch_add( 1, CDS_ATOMIC::memory_order_acq_rel ) ;
+                    CDS_ATOMIC::atomic_thread_fence( CDS_ATOMIC::memory_order_release ) ;
+                }
+
+                void end_write_all()
+                {
+                    m_nGlobal.fetch_add( 1, CDS_ATOMIC::memory_order_release ) ;
+                }
+
+                bool read_begin( snapshot& snap, size_t const * arrHash ) const
+                {
+                    snap.nGlobal = m_nGlobal.load( CDS_ATOMIC::memory_order_acquire ) ;
+                    if ( snap.nGlobal & 1 )
+                        return false ;
+
+                    size_t const nMask = m_nMask ;
+                    CDS_ATOMIC::atomic_thread_fence( CDS_ATOMIC::memory_order_acquire ) ;
+
+                    for ( unsigned int i = 0; i < Arity; ++i ) {
+                        stripe const * pStripe = m_arrStripe[i] + ( arrHash[i] & nMask ) ;
+                        // nEnd must be read before nBegin
+                        size_t nEnd = pStripe->nEnd.load( CDS_ATOMIC::memory_order_acquire ) ;
+                        snap.arrBegin[i] = pStripe->nBegin.load( CDS_ATOMIC::memory_order_acquire ) ;
+                        if ( snap.arrBegin[i] != nEnd )
+                            return false ;
+                        snap.arrStripe[i] = pStripe ;
+                    }
+                    return true ;
+                }
+
+                bool read_validate( snapshot const& snap ) const
+                {
+                    CDS_ATOMIC::atomic_thread_fence( CDS_ATOMIC::memory_order_acquire ) ;
+                    for ( unsigned int i = 0; i < Arity; ++i ) {
+                        if ( snap.arrStripe[i]->nBegin.load( CDS_ATOMIC::memory_order_relaxed ) != snap.arrBegin[i] )
+                            return false ;
+                    }
+                    return m_nGlobal.load( CDS_ATOMIC::memory_order_relaxed ) == snap.nGlobal ;
+                }
+            };
+
+            // Version table used when optimistic search is disabled
+            class empty_version_table
+            {
+            public:
+                struct snapshot {};
+
+            public:
+                empty_version_table( size_t )
+                {}
+
+                void begin_write( size_t const * )  {}
+                void end_write( size_t const * )    {}
+                void resize( size_t )               {}
+                void begin_write_all()  {}
+                void end_write_all()    {}
+
+                bool read_begin( snapshot&, size_t const * ) const
+                {
+                    return false ;
+                }
+                bool read_validate( snapshot const& ) const
+                {
+                    return false ;
+                }
+            };
+
+            // Writer locks: the mutex policy locks that maintain the version table
+            template <class MutexPolicy, class VersionTable>
+            class versioned_cell_lock: public MutexPolicy::scoped_cell_lock
+            {
+                typedef typename MutexPolicy::scoped_cell_lock base_class ;
+
+                VersionTable&   m_Versions  ;
+                size_t          m_arrHash[ MutexPolicy::c_nArity ] ;
+
+            public:
+                versioned_cell_lock( MutexPolicy& policy, VersionTable& versions, size_t const * arrHash )
+                    : base_class( policy, arrHash )
+                    , m_Versions( versions )
+                {
+                    // arrHash may be changed by the caller while the lock is held
+                    memcpy( m_arrHash, arrHash, sizeof(m_arrHash)) ;
+                    m_Versions.begin_write( m_arrHash ) ;
+                }
+
+                ~versioned_cell_lock()
+                {
+                    m_Versions.end_write( m_arrHash ) ;
+                }
+            };
+
+            template <class MutexPolicy, class VersionTable>
+            class versioned_cell_trylock: public MutexPolicy::scoped_cell_trylock
+            {
+                typedef typename MutexPolicy::scoped_cell_trylock base_class ;
+
+                VersionTable&   m_Versions  ;
+                size_t          m_arrHash[ MutexPolicy::c_nArity ] ;
+
+            public:
+                versioned_cell_trylock( MutexPolicy& policy, VersionTable& versions, size_t const * arrHash )
+                    : base_class( policy, arrHash )
+                    , m_Versions( versions )
+                {
+                    if ( base_class::locked() ) {
+                        memcpy( m_arrHash, arrHash, sizeof(m_arrHash)) ;
+                        m_Versions.begin_write( m_arrHash ) ;
+                    }
+                }
+
+                ~versioned_cell_trylock()
+                {
+                    if ( base_class::locked() )
+                        m_Versions.end_write( m_arrHash ) ;
+                }
+            };
+
+            template <class MutexPolicy, class VersionTable>
+            class versioned_full_lock: public MutexPolicy::scoped_full_lock
+            {
+                typedef typename MutexPolicy::scoped_full_lock base_class ;
+                VersionTable&   m_Versions  ;
+
+            public:
+                versioned_full_lock( MutexPolicy& policy, VersionTable& versions )
+                    : base_class( policy )
+                    , m_Versions( versions )
+                {
+                    m_Versions.begin_write_all() ;
+                }
+
+                ~versioned_full_lock()
+                {
+                    m_Versions.end_write_all() ;
+                }
+            };
+
+            template <class MutexPolicy, class VersionTable>
+            class versioned_resize_lock: public MutexPolicy::scoped_resize_lock
+            {
+                typedef typename MutexPolicy::scoped_resize_lock base_class ;
+                VersionTable&   m_Versions  ;
+
+            public:
+                versioned_resize_lock( MutexPolicy& policy, VersionTable& versions )
+                    : base_class( policy )
+                    , m_Versions( versions )
+                {
+                    m_Versions.begin_write_all() ;
+                }
+
+                ~versioned_resize_lock()
+                {
+                    m_Versions.end_write_all() ;
+                }
             };
 
         }   // namespace details
@@ -1610,6 +2252,14 @@ namespace cds { namespace intrusive {
             In current implementation, a probe set can be defined either as a (single-linked) list
             or as a fixed-sized vector, optionally ordered.
 
+            Resizing is cooperative. The resizing thread holds the resize lock of the mutex policy
+            and splits the old bucket tables into chunks of \ref c_nResizeChunkSize buckets.
+            Any thread that starts an operation while the set is being resized takes the free chunks
+            and moves their items into the new tables instead of waiting for the lock.
+            An item is moved only into a probe set below the threshold; other items are left to the resizing thread,
+            which moves them with relocating after all chunks are done.
+            See cuckoo::stat for the resize duration and helper counters.
+
             In description above two-table cuckoo hashing (<tt>k = 2</tt>) has been considered.
             We can generalize this approach for <tt>k >= 2</tt> when we have \p k hash functions
             <tt>h[0], ... h[k-1]</tt> and \p k tables <tt>table[0], ... table[k-1]</tt>.
@@ -1660,6 +2310,12 @@ namespace cds { namespace intrusive {
             freeing nodes. Default is intrusive::opt::v::empty_disposer
         - opt::stat - internal statistics. Possibly types: cuckoo::stat, cuckoo::empty_stat.
             Default is cuckoo::empty_stat
+        - cuckoo::optimistic_find - if \p true, \p find does not lock the cells but reads the probe sets
+            optimistically under per-stripe version counters. The option requires \p cuckoo::vector probe set.
+            Default is \p false. Read cuckoo::optimistic_find description for the requirements.
+        - cuckoo::fingerprint - for \p cuckoo::vector probe set only: keep the hash fingerprints of the items
+            in contiguous array of the probe set and match them by SIMD instructions before comparing the keys.
+            Default is \p opt::none (no fingerprints).
 
         The probe set options cuckoo::probeset_type and cuckoo::store_hash are taken from \p node type
         specified by \p opt::hook option.
@@ -1881,6 +2537,8 @@ namespace cds { namespace intrusive {
         static bool const c_isSorted = !( std::is_same< typename options::compare, opt::none >::value
                 && std::is_same< typename options::less, opt::none >::value ) ; ///< whether the probe set should be ordered
         static size_t const c_nArity = hash::size ; ///< the arity of cuckoo hashing: the number of hash functors provided; minimum 2.
+        static bool const c_bOptimisticFind = options::optimistic_find ; ///< whether \p find is optimistic lock-free, see cuckoo::optimistic_find
+        static bool const c_bFingerprint = !std::is_same< typename options::fingerprint, opt::none >::value ; ///< whether the probe set has hash fingerprints, see cuckoo::fingerprint
 
         /// Key equality functor; used only for unordered probe-set
         typedef typename opt::details::make_equal_to< value_type, options, !c_isSorted>::type key_equal_to ;
@@ -1903,12 +2561,21 @@ namespace cds { namespace intrusive {
         typedef typename node_type::probeset_type   probeset_type   ;
         static unsigned int const c_nNodeHashArraySize = node_type::hash_array_size ;
 
-        typedef typename mutex_policy::scoped_cell_lock     scoped_cell_lock    ;
-        typedef typename mutex_policy::scoped_cell_trylock  scoped_cell_trylock ;
-        typedef typename mutex_policy::scoped_full_lock     scoped_full_lock    ;
-        typedef typename mutex_policy::scoped_resize_lock   scoped_resize_lock  ;
-
-        typedef cuckoo::details::bucket_entry< node_type, probeset_type >   bucket_entry    ;
+        typedef typename std::conditional< c_bOptimisticFind
+            , cuckoo::details::stripe_version_table< c_nArity, allocator >
+            , cuckoo::details::empty_version_table
+        >::type version_table ;
+
+        typedef cuckoo::details::versioned_cell_lock< mutex_policy, version_table >     scoped_cell_lock    ;
+        typedef cuckoo::details::versioned_cell_trylock< mutex_policy, version_table >  scoped_cell_trylock ;
+        typedef cuckoo::details::versioned_full_lock< mutex_policy, version_table >     scoped_full_lock    ;
+        typedef cuckoo::details::versioned_resize_lock< mutex_policy, version_table >   scoped_resize_lock  ;
+        typedef typename mutex_policy::scoped_cell_lock     scoped_find_lock    ;   // find does not change the versions
+
+        typedef typename std::conditional< c_bFingerprint
+            , cuckoo::details::fingerprint_bucket_entry< node_type, probeset_type, typename options::fingerprint >
+            , cuckoo::details::bucket_entry< node_type, probeset_type >
+        >::type bucket_entry ;
         typedef typename bucket_entry::iterator                     bucket_iterator ;
         typedef cds::details::Allocator< bucket_entry, allocator >  bucket_table_allocator ;
 
@@ -1952,9 +2619,12 @@ namespace cds { namespace intrusive {
             bucket_iterator     itFound;
         };
 
-        typedef typename std::conditional< c_isSorted
-            , cuckoo::details::contains< node_traits, true >
-            , cuckoo::details::contains< node_traits, false >
+        typedef typename std::conditional< c_bFingerprint
+            , cuckoo::details::contains_fingerprint< node_traits, c_isSorted >
+            , typename std::conditional< c_isSorted
+                , cuckoo::details::contains< node_traits, true >
+                , cuckoo::details::contains< node_traits, false >
+            >::type
         >::type contains_action ;
 
         template <typename Predicate>
@@ -1969,6 +2639,9 @@ namespace cds { namespace intrusive {
         static unsigned int const   c_nDefaultProbesetSize = 4  ;   ///< default probeset size
         static size_t const         c_nDefaultInitialSize = 16  ;   ///< default initial size
         static unsigned int const   c_nRelocateLimit = c_nArity * 2 - 1 ;   ///< Count of attempts to relocate before giving up
+        static unsigned int const   c_nOptimisticFindLimit = 8  ;   ///< Count of attempts of optimistic search before falling back to locked search
+        static size_t const         c_nResizeChunkSize = 256    ;   ///< Count of buckets moved at once by a thread taking part in resizing
+        static unsigned int const   c_nResizeLockCount = 64     ;   ///< Count of bucket locks per table used while moving the items into new tables
 
     protected:
         bucket_entry *      m_BucketTable[ c_nArity ] ; ///< Bucket tables
@@ -1979,14 +2652,62 @@ namespace cds { namespace intrusive {
 
         hash            m_Hash              ;   ///< Hash functor tuple
         mutex_policy    m_MutexPolicy       ;   ///< concurrent access policy
+        version_table   m_Versions          ;   ///< stripe versions for optimistic search
         item_counter    m_ItemCounter       ;   ///< item counter
         mutable stat    m_Stat              ;   ///< internal statistics
 
+        //@cond
+        // Bucket tables replaced by resizing; used only for optimistic search
+        struct retired_bucket_tables {
+            bucket_entry *          pTable[ c_nArity ]  ;
+            size_t                  nCapacity   ;
+            retired_bucket_tables * pNext       ;
+        };
+        typedef cds::details::Allocator< retired_bucket_tables, allocator > retired_tables_allocator ;
+
+        retired_bucket_tables * m_pRetiredTables  ;
+
+        // Cooperative resizing
+        // The resizing thread holds the resize lock and publishes the old tables as chunks of c_nResizeChunkSize buckets.
+        // The threads that would be blocked by resizing help to move the chunks into new tables.
+        // The buckets of new tables are guarded by arrLock while the items are moved.
+        typedef std::vector< node_type *, typename allocator::template rebind< node_type * >::other > deferred_items ;
+
+        struct resize_state {
+            CDS_ATOMIC::atomic<bool>    bActive     ;   // resizing is in progress, the fields below are valid
+            CDS_ATOMIC::atomic<size_t>  nHelpers    ;   // count of threads that may read the resize state
+            CDS_ATOMIC::atomic<size_t>  nNextChunk  ;   // next chunk to move
+            CDS_ATOMIC::atomic<size_t>  nDoneChunks ;   // count of moved chunks
+            size_t                      nChunkCount ;   // total count of chunks
+            size_t                      nTableChunks;   // count of chunks per table
+            size_t                      nOldCapacity;   // size of old tables
+            bucket_entry *              pOldTable[ c_nArity ] ;
+
+            cds::lock::Spin             lockDeferred;
+            deferred_items              deferred    ;   // the items that cannot be moved without relocating
+
+            cds::lock::Spin             arrLock[ c_nArity ][ c_nResizeLockCount ] ;
+
+            resize_state()
+                : bActive( false )
+                , nHelpers( 0 )
+                , nNextChunk( 0 )
+                , nDoneChunks( 0 )
+                , nChunkCount( 0 )
+                , nTableChunks( 0 )
+                , nOldCapacity( 0 )
+            {}
+        };
+        resize_state    m_Resize ;
+        //@endcond
+
     protected:
         //@cond
         static void check_common_constraints()
         {
             static_assert( (c_nArity == mutex_policy::c_nArity), "The count of hash functors must be equal to mutex_policy arity" ) ;
+            static_assert( (!c_bFingerprint || std::is_same< probeset_class, cuckoo::vector_probeset_class >::value), "cuckoo::fingerprint option requires cuckoo::vector probeset type" ) ;
+            static_assert( (!c_bOptimisticFind || std::is_same< probeset_class, cuckoo::vector_probeset_class >::value), "cuckoo::optimistic_find option requires cuckoo::vector probeset type" ) ;
         }
 
         void check_probeset_properties() const
@@ -2032,10 +2753,14 @@ namespace cds { namespace intrusive {
         {
             assert( cds::beans::is_power2( nSize ) ) ;
 
-            m_nBucketMask = nSize - 1 ;
             bucket_table_allocator alloc ;
             for ( unsigned int i = 0; i < c_nArity; ++i )
                 m_BucketTable[i] = alloc.NewArray( nSize )  ;
+
+            // Optimistic search reads m_nBucketMask before m_BucketTable,
+            // so the bucket index never exceeds the size of the table it reads
+            CDS_ATOMIC::atomic_thread_fence( CDS_ATOMIC::memory_order_release ) ;
+            m_nBucketMask = nSize - 1 ;
         }
 
         static void free_bucket_tables( bucket_entry ** pTable, size_t nCapacity )
@@ -2049,6 +2774,25 @@ namespace cds { namespace intrusive {
         void free_bucket_tables()
         {
             free_bucket_tables( m_BucketTable, m_nBucketMask + 1 ) ;
+
+            retired_tables_allocator alloc ;
+            while ( m_pRetiredTables ) {
+                retired_bucket_tables * p = m_pRetiredTables ;
+                m_pRetiredTables = p->pNext ;
+                free_bucket_tables( p->pTable, p->nCapacity ) ;
+                alloc.Delete( p ) ;
+            }
+        }
+
+        void retire_bucket_tables( bucket_entry ** pTable, size_t nCapacity )
+        {
+            // Concurrent optimistic search may still read the old tables
+            // so they are freed only in the set destructor
+            retired_bucket_tables * p = retired_tables_allocator().New() ;
+            memcpy( p->pTable, pTable, sizeof(p->pTable)) ;
+            p->nCapacity = nCapacity ;
+            p->pNext = m_pRetiredTables ;
+            m_pRetiredTables = p ;
         }
 
         static unsigned int const c_nUndefTable = (unsigned int) -1 ;
@@ -2072,8 +2816,9 @@ namespace cds { namespace intrusive {
             hashing( arrHash, val )     ;
             position arrPos[ c_nArity ] ;
 
+            help_resize() ;
             {
-                scoped_cell_lock guard( m_MutexPolicy, arrHash ) ;
+                scoped_cell_lock guard( m_MutexPolicy, m_Versions, arrHash ) ;
 
                 unsigned int nTable = contains( arrPos, arrHash, val, pred ) ;
                 if ( nTable != c_nUndefTable ) {
@@ -2090,13 +2835,45 @@ namespace cds { namespace intrusive {
             return null_ptr<value_type *>() ;
         }
 
+        // Optimistic search without locking
+        // Returns 1 if found, 0 if not found, -1 if the result is unknown because of concurrent modifications
+        template <typename Q, typename Predicate>
+        int find_optimistic( Q const& val, Predicate pred, size_t const * arrHash )
+        {
+            typename version_table::snapshot snap ;
+            cds::backoff::pause bkoff ;
+
+            for ( unsigned int nAttempt = 0; nAttempt < c_nOptimisticFindLimit; ++nAttempt ) {
+                if ( m_Versions.read_begin( snap, arrHash )) {
+                    // m_nBucketMask must be read before m_BucketTable, see allocate_bucket_tables()
+                    size_t const nMask = m_nBucketMask ;
+                    CDS_ATOMIC::atomic_thread_fence( CDS_ATOMIC::memory_order_acquire ) ;
+
+                    int nResult = 0 ;
+                    for ( unsigned int i = 0; i < c_nArity && nResult == 0; ++i ) {
+                        bucket_entry& probeset = m_BucketTable[i][ arrHash[i] & nMask ] ;
+                        nResult = contains_action::find_optimistic( probeset, i, arrHash[i], val, pred, m_nProbesetSize ) ;
+                    }
+
+                    if ( nResult >= 0 && m_Versions.read_validate( snap ))
+                        return nResult ;
+                }
+
+                m_Stat.onFindOptimisticRetry() ;
+                bkoff() ;
+            }
+
+            m_Stat.onFindOptimisticFallback() ;
+            return -1 ;
+        }
+
         template <typename Q, typename Predicate, typename Func>
-        bool find_( Q& val, Predicate pred, Func f )
+        bool find_locked( Q& val, Predicate pred, Func f, size_t * arrHash )
         {
-            hash_array arrHash ;
             position arrPos[ c_nArity ] ;
-            hashing( arrHash, val ) ;
-            scoped_cell_lock sl( m_MutexPolicy, arrHash ) ;
+
+            help_resize() ;
+            scoped_find_lock sl( m_MutexPolicy, arrHash ) ;
 
             unsigned int nTable = contains( arrPos, arrHash, val, pred ) ;
             if ( nTable != c_nUndefTable ) {
@@ -2109,6 +2886,46 @@ namespace cds { namespace intrusive {
             return false ;
         }
 
+        template <typename Q, typename Predicate, typename Func>
+        bool find_( Q& val, Predicate pred, Func f )
+        {
+            hash_array arrHash ;
+            hashing( arrHash, val ) ;
+
+            // The functor is called under the cell lock,
+            // the optimistic search can only prove that the key is absent
+            if ( c_bOptimisticFind && find_optimistic( val, pred, arrHash ) == 0 ) {
+                m_Stat.onFindFailed() ;
+                return false ;
+            }
+
+            return find_locked( val, pred, f, arrHash ) ;
+        }
+
+        template <typename Q, typename Predicate>
+        bool find_( Q const& val, Predicate pred )
+        {
+            hash_array arrHash ;
+            hashing( arrHash, val ) ;
+
+            if ( c_bOptimisticFind ) {
+                int nResult = find_optimistic( val, pred, arrHash ) ;
+                if ( nResult >= 0 ) {
+                    if ( nResult )
+                        m_Stat.onFindSuccess() ;
+                    else
+                        m_Stat.onFindFailed() ;
+                    return nResult != 0 ;
+                }
+            }
+
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return find_locked( val, pred, [](value_type&, Q const& ) {}, arrHash ) ;
+#       else
+            return find_locked( val, pred, empty_find_functor(), arrHash ) ;
+#       endif
+        }
+
         bool relocate( unsigned int nTable, size_t * arrGoalHash )
         {
             // arrGoalHash contains hash values for relocating element
@@ -2122,7 +2939,7 @@ namespace cds { namespace intrusive {
                 m_Stat.onRelocateRound() ;
 
                 while ( true ) {
-                    scoped_cell_lock guard( m_MutexPolicy, arrGoalHash ) ;
+                    scoped_cell_lock guard( m_MutexPolicy, m_Versions, arrGoalHash ) ;
 
                     bucket_entry& refBucket = bucket( nTable, arrGoalHash[nTable] ) ;
                     if ( refBucket.size() < m_nProbesetThreshold ) {
@@ -2134,7 +2951,7 @@ namespace cds { namespace intrusive {
                     pVal = node_traits::to_value_ptr( *refBucket.begin() ) ;
                     copy_hash( arrHash, *pVal ) ;
 
-                    scoped_cell_trylock guard2( m_MutexPolicy, arrHash ) ;
+                    scoped_cell_trylock guard2( m_MutexPolicy, m_Versions, arrHash ) ;
                     if ( !guard2.locked() )
                         continue ;  // try one more time
 
@@ -2148,7 +2965,7 @@ namespace cds { namespace intrusive {
                         if ( bkt.size() < m_nProbesetThreshold ) {
                             position pos ;
                             contains_action::find( bkt, pos, i, arrHash[i], *pVal, key_predicate() ) ; // must return false!
-                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal )) ;
+                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal ), arrHash[i] ) ;
                             m_Stat.onSuccessRelocateRound() ;
                             return true     ;
                         }
@@ -2162,7 +2979,7 @@ namespace cds { namespace intrusive {
                         if ( bkt.size() < m_nProbesetSize ) {
                             position pos ;
                             contains_action::find( bkt, pos, i, arrHash[i], *pVal, key_predicate() ) ; // must return false!
-                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal )) ;
+                            bkt.insert_after( pos.itPrev, node_traits::to_node_ptr( pVal ), arrHash[i] ) ;
                             nTable = i  ;
                             memcpy( arrGoalHash, arrHash, sizeof(arrHash)) ;
                             m_Stat.onRelocateAboveThresholdRound() ;
@@ -2172,7 +2989,7 @@ namespace cds { namespace intrusive {
                     }
 
                     // all probeset is full, relocating fault
-                    refBucket.insert_after( typename bucket_entry::iterator(), node_traits::to_node_ptr( pVal )) ;
+                    refBucket.insert_after( typename bucket_entry::iterator(), node_traits::to_node_ptr( pVal ), arrHash[nTable] ) ;
                     m_Stat.onFailedRelocate() ;
                     return false ;
                 }
@@ -2182,65 +2999,162 @@ namespace cds { namespace intrusive {
             return false ;
         }
 
+        // Moves the item of old table into new tables when resizing.
+        // The item is moved only into probeset that is below the threshold,
+        // otherwise the item is deferred to be relocated by the resizing thread
+        void resize_move_item( node_type * pNode )
+        {
+            value_type& val = *node_traits::to_value_ptr( *pNode ) ;
+            hash_array arrHash ;
+            copy_hash( arrHash, val ) ;
+
+            for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                // The lock is derived from the bucket index, not from the hash:
+                // the table may have fewer buckets than c_nResizeLockCount
+                size_t const nBucket = arrHash[i] & m_nBucketMask ;
+                bucket_entry& refBucket = m_BucketTable[i][nBucket] ;
+                cds::lock::scoped_lock< cds::lock::Spin > sl( m_Resize.arrLock[i][ nBucket & (c_nResizeLockCount - 1) ] ) ;
+                if ( refBucket.size() < m_nProbesetThreshold ) {
+                    position pos ;
+                    contains_action::find( refBucket, pos, i, arrHash[i], val, key_predicate() ) ; // must return false!
+                    refBucket.insert_after( pos.itPrev, pNode, arrHash[i] ) ;
+                    m_Stat.onResizeSuccessMove() ;
+                    return ;
+                }
+            }
+
+            cds::lock::scoped_lock< cds::lock::Spin > sl( m_Resize.lockDeferred ) ;
+            m_Resize.deferred.push_back( pNode ) ;
+            m_Stat.onResizeDeferredMove() ;
+        }
+
+        void resize_move_chunks( bool bHelper )
+        {
+            typedef typename bucket_entry::iterator bucket_iterator ;
+
+            size_t nChunk ;
+            while ( ( nChunk = m_Resize.nNextChunk.fetch_add( 1, CDS_ATOMIC::memory_order_relaxed )) < m_Resize.nChunkCount ) {
+                bucket_entry * pTable = m_Resize.pOldTable[ nChunk / m_Resize.nTableChunks ] ;
+                size_t const nFrom = ( nChunk % m_Resize.nTableChunks ) * c_nResizeChunkSize ;
+                size_t const nTo = std::min( nFrom + c_nResizeChunkSize, m_Resize.nOldCapacity ) ;
+
+                for ( size_t k = nFrom; k < nTo; ++k ) {
+                    bucket_iterator itNext ;
+                    for ( bucket_iterator it = pTable[k].begin(), itEnd = pTable[k].end(); it != itEnd; it = itNext ) {
+                        itNext = it ;
+                        ++itNext    ;
+                        resize_move_item( &*it ) ;
+                    }
+                }
+
+                if ( bHelper )
+                    m_Stat.onResizeHelpedChunk() ;
+                m_Resize.nDoneChunks.fetch_add( 1, CDS_ATOMIC::memory_order_release ) ;
+            }
+        }
+
+        // Called by the thread that does not hold any cell lock:
+        // if the set is being resized, the thread helps to move the items instead of waiting for the cell lock
+        void help_resize()
+        {
+            if ( !m_Resize.bActive.load( CDS_ATOMIC::memory_order_relaxed ))
+                return ;
+
+            // The resizing thread does not finish until nHelpers is zero,
+            // so the resize state cannot be changed while we are reading it
+            m_Resize.nHelpers.fetch_add( 1, CDS_ATOMIC::memory_order_seq_cst ) ;
+            if ( m_Resize.bActive.load( CDS_ATOMIC::memory_order_seq_cst )) {
+                m_Stat.onResizeHelper() ;
+                resize_move_chunks( true ) ;
+            }
+            m_Resize.nHelpers.fetch_sub( 1, CDS_ATOMIC::memory_order_release ) ;
+        }
+
+        void resize_cooperative( bucket_entry ** pOldTable, size_t nOldCapacity )
+        {
+            // Resize lock is held, new bucket tables are allocated
+            m_Resize.nOldCapacity = nOldCapacity ;
+            m_Resize.nTableChunks = ( nOldCapacity + c_nResizeChunkSize - 1 ) / c_nResizeChunkSize ;
+            m_Resize.nChunkCount = m_Resize.nTableChunks * c_nArity ;
+            memcpy( m_Resize.pOldTable, pOldTable, sizeof(m_Resize.pOldTable)) ;
+            m_Resize.nNextChunk.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+            m_Resize.nDoneChunks.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+            m_Resize.bActive.store( true, CDS_ATOMIC::memory_order_seq_cst ) ;
+
+            resize_move_chunks( false ) ;
+
+            cds::backoff::pause bkoff ;
+            while ( m_Resize.nDoneChunks.load( CDS_ATOMIC::memory_order_acquire ) != m_Resize.nChunkCount )
+                bkoff() ;
+
+            m_Resize.bActive.store( false, CDS_ATOMIC::memory_order_seq_cst ) ;
+            while ( m_Resize.nHelpers.load( CDS_ATOMIC::memory_order_seq_cst ) != 0 )
+                bkoff() ;
+
+            // The deferred items are moved with relocating; the helpers have gone
+            hash_array arrHash ;
+            position arrPos[ c_nArity ] ;
+            for ( typename deferred_items::iterator itItem = m_Resize.deferred.begin(); itItem != m_Resize.deferred.end(); ++itItem ) {
+                value_type& val = *node_traits::to_value_ptr( **itItem ) ;
+                copy_hash( arrHash, val ) ;
+                contains( arrPos, arrHash, val, key_predicate() ) ; // must return c_nUndefTable
+
+                for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                    bucket_entry& refBucket = bucket( i, arrHash[i] ) ;
+                    if ( refBucket.size() < m_nProbesetThreshold ) {
+                        refBucket.insert_after( arrPos[i].itPrev, *itItem, arrHash[i] ) ;
+                        m_Stat.onResizeSuccessMove() ;
+                        goto do_next ;
+                    }
+                }
+
+                for ( unsigned int i = 0; i < c_nArity; ++i ) {
+                    bucket_entry& refBucket = bucket( i, arrHash[i] ) ;
+                    if ( refBucket.size() < m_nProbesetSize ) {
+                        refBucket.insert_after( arrPos[i].itPrev, *itItem, arrHash[i] ) ;
+                        assert( refBucket.size() > 1 )  ;
+                        copy_hash( arrHash, *node_traits::to_value_ptr( *refBucket.begin()) ) ;
+                        m_Stat.onResizeRelocateCall() ;
+                        relocate( i, arrHash )  ;
+                        break ;
+                    }
+                }
+            do_next: ;
+            }
+            m_Resize.deferred.clear() ;
+        }
+
         void resize()
         {
             m_Stat.onResizeCall() ;
 
+            // If other thread is resizing the set, help it before waiting for the resize lock
+            help_resize() ;
+
             size_t nOldCapacity = bucket_count()        ;
             bucket_entry *      pOldTable[ c_nArity ]   ;
             {
-                scoped_resize_lock guard( m_MutexPolicy )   ;
+                scoped_resize_lock guard( m_MutexPolicy, m_Versions )   ;
 
                 if ( nOldCapacity != bucket_count() ) {
                     m_Stat.onFalseResizeCall() ;
                     return ;
                 }
 
+                cds::OS::Timer timer ;
                 size_t nCapacity = nOldCapacity * 2         ;
 
                 m_MutexPolicy.resize( nCapacity )   ;
+                m_Versions.resize( m_MutexPolicy.lock_count() ) ;
                 memcpy( pOldTable, m_BucketTable, sizeof(pOldTable)) ;
                 allocate_bucket_tables( nCapacity )         ;
 
-                typedef typename bucket_entry::iterator bucket_iterator ;
-                hash_array arrHash ;
-                position arrPos[ c_nArity ] ;
-
-                for ( unsigned int nTable = 0; nTable < c_nArity; ++nTable ) {
-                    bucket_entry * pTable = pOldTable[nTable]   ;
-                    for ( size_t k = 0; k < nOldCapacity; ++k ) {
-                        bucket_iterator itNext ;
-                        for ( bucket_iterator it = pTable[k].begin(), itEnd = pTable[k].end(); it != itEnd; it = itNext ) {
-                            itNext = it ;
-                            ++itNext    ;
-
-                            value_type& val = *node_traits::to_value_ptr( *it ) ;
-                            copy_hash( arrHash, val ) ;
-                            contains( arrPos, arrHash, val, key_predicate() ) ; // must return c_nUndefTable
-
-                            for ( unsigned int i = 0; i < c_nArity; ++i ) {
-                                bucket_entry& refBucket = bucket( i, arrHash[i] ) ;
-                                if ( refBucket.size() < m_nProbesetThreshold ) {
-                                    refBucket.insert_after( arrPos[i].itPrev, &*it ) ;
-                                    m_Stat.onResizeSuccessMove() ;
-                                    goto do_next ;
-                                }
-                            }
-
-                            for ( unsigned int i = 0; i < c_nArity; ++i ) {
-                                bucket_entry& refBucket = bucket( i, arrHash[i] ) ;
-                                if ( refBucket.size() < m_nProbesetSize ) {
-                                    refBucket.insert_after( arrPos[i].itPrev, &*it ) ;
-                                    assert( refBucket.size() > 1 )  ;
-                                    copy_hash( arrHash, *node_traits::to_value_ptr( *refBucket.begin()) ) ;
-                                    m_Stat.onResizeRelocateCall() ;
-                                    relocate( i, arrHash )  ;
-                                    break ;
-                                }
-                            }
-                        do_next: ;
-                        }
-                    }
+                resize_cooperative( pOldTable, nOldCapacity ) ;
+                m_Stat.onResizeDuration( (size_t)( timer.duration() * 1.0E6 )) ;
+
+                if ( c_bOptimisticFind ) {
+                    retire_bucket_tables( pOldTable, nOldCapacity ) ;
+                    return ;
                 }
             }
             free_bucket_tables( pOldTable, nOldCapacity ) ;
@@ -2270,6 +3184,8 @@ namespace cds { namespace intrusive {
             : m_nProbesetSize( calc_probeset_size(0) )
             , m_nProbesetThreshold( m_nProbesetSize - 1 )
             , m_MutexPolicy( c_nDefaultInitialSize )
+            , m_Versions( m_MutexPolicy.lock_count() )
+            , m_pRetiredTables( null_ptr<retired_bucket_tables *>() )
         {
             check_common_constraints() ;
             check_probeset_properties();
@@ -2290,6 +3206,8 @@ namespace cds { namespace intrusive {
             : m_nProbesetSize( calc_probeset_size(nProbesetSize) )
             , m_nProbesetThreshold( nProbesetThreshold ? nProbesetThreshold : m_nProbesetSize - 1 )
             , m_MutexPolicy( cds::beans::ceil2(nInitialSize ? nInitialSize : c_nDefaultInitialSize ))
+            , m_Versions( m_MutexPolicy.lock_count() )
+            , m_pRetiredTables( null_ptr<retired_bucket_tables *>() )
         {
             check_common_constraints()  ;
             check_probeset_properties() ;
@@ -2308,6 +3226,8 @@ namespace cds { namespace intrusive {
             , m_nProbesetThreshold( m_nProbesetSize -1 )
             , m_Hash( h )
             , m_MutexPolicy( c_nDefaultInitialSize )
+            , m_Versions( m_MutexPolicy.lock_count() )
+            , m_pRetiredTables( null_ptr<retired_bucket_tables *>() )
         {
             check_common_constraints()  ;
             check_probeset_properties() ;
@@ -2330,6 +3250,8 @@ namespace cds { namespace intrusive {
             , m_nProbesetThreshold( nProbesetThreshold ? nProbesetThreshold : m_nProbesetSize - 1)
             , m_Hash( h )
             , m_MutexPolicy( cds::beans::ceil2(nInitialSize ? nInitialSize : c_nDefaultInitialSize ))
+            , m_Versions( m_MutexPolicy.lock_count() )
+            , m_pRetiredTables( null_ptr<retired_bucket_tables *>() )
         {
             check_common_constraints()  ;
             check_probeset_properties() ;
@@ -2349,6 +3271,8 @@ namespace cds { namespace intrusive {
             , m_nProbesetThreshold( m_nProbesetSize / 2 )
             , m_Hash( std::forward<hash_tuple_type>(h) )
             , m_MutexPolicy( c_nDefaultInitialSize )
+            , m_Versions( m_MutexPolicy.lock_count() )
+            , m_pRetiredTables( null_ptr<retired_bucket_tables *>() )
         {
             check_common_constraints()  ;
             check_probeset_properties() ;
@@ -2371,6 +3295,8 @@ namespace cds { namespace intrusive {
             , m_nProbesetThreshold( nProbesetThreshold ? nProbesetThreshold : m_nProbesetSize - 1)
             , m_Hash( std::forward<hash_tuple_type>(h) )
             , m_MutexPolicy( cds::beans::ceil2(nInitialSize ? nInitialSize : c_nDefaultInitialSize ))
+            , m_Versions( m_MutexPolicy.lock_count() )
+            , m_pRetiredTables( null_ptr<retired_bucket_tables *>() )
         {
             check_common_constraints()  ;
             check_probeset_properties() ;
@@ -2430,8 +3356,9 @@ namespace cds { namespace intrusive {
             store_hash( pNode, arrHash ) ;
 
             while (true) {
+                help_resize() ;
                 {
-                    scoped_cell_lock guard( m_MutexPolicy, arrHash ) ;
+                    scoped_cell_lock guard( m_MutexPolicy, m_Versions, arrHash ) ;
 
                     if ( contains( arrPos, arrHash, val, key_predicate() ) != c_nUndefTable ) {
                         m_Stat.onInsertFailed() ;
@@ -2441,7 +3368,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] ) ;
                         if ( refBucket.size() < m_nProbesetThreshold ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode ) ;
+                            refBucket.insert_after( arrPos[i].itPrev, pNode, arrHash[i] ) ;
                             cds::unref(f)( val )    ;
                             ++m_ItemCounter         ;
                             m_Stat.onInsertSuccess();
@@ -2452,7 +3379,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] ) ;
                         if ( refBucket.size() < m_nProbesetSize ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode ) ;
+                            refBucket.insert_after( arrPos[i].itPrev, pNode, arrHash[i] ) ;
                             cds::unref(f)( val );
                             ++m_ItemCounter     ;
                             nGoalTable = i      ;
@@ -2516,8 +3443,9 @@ namespace cds { namespace intrusive {
             store_hash( pNode, arrHash ) ;
 
             while (true) {
+                help_resize() ;
                 {
-                    scoped_cell_lock guard( m_MutexPolicy, arrHash ) ;
+                    scoped_cell_lock guard( m_MutexPolicy, m_Versions, arrHash ) ;
 
                     unsigned int nTable = contains( arrPos, arrHash, val, key_predicate() ) ;
                     if ( nTable != c_nUndefTable ) {
@@ -2532,7 +3460,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] ) ;
                         if ( refBucket.size() < m_nProbesetThreshold ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode ) ;
+                            refBucket.insert_after( arrPos[i].itPrev, pNode, arrHash[i] ) ;
                             cds::unref(func)( true, val, val ) ;
                             ++m_ItemCounter ;
                             m_Stat.onEnsureSuccess() ;
@@ -2543,7 +3471,7 @@ namespace cds { namespace intrusive {
                     for ( unsigned int i = 0; i < c_nArity; ++i ) {
                         bucket_entry& refBucket = bucket( i, arrHash[i] ) ;
                         if ( refBucket.size() < m_nProbesetSize ) {
-                            refBucket.insert_after( arrPos[i].itPrev, pNode ) ;
+                            refBucket.insert_after( arrPos[i].itPrev, pNode, arrHash[i] ) ;
                             cds::unref(func)( true, val, val ) ;
                             ++m_ItemCounter     ;
                             nGoalTable = i      ;
@@ -2585,8 +3513,9 @@ namespace cds { namespace intrusive {
             hashing( arrHash, val )     ;
             position arrPos[ c_nArity ] ;
 
+            help_resize() ;
             {
-                scoped_cell_lock guard( m_MutexPolicy, arrHash ) ;
+                scoped_cell_lock guard( m_MutexPolicy, m_Versions, arrHash ) ;
 
                 unsigned int nTable = contains( arrPos, arrHash, val, key_predicate() ) ;
                 if ( nTable != c_nUndefTable && node_traits::to_value_ptr(*arrPos[nTable].itFound) == &val ) {
@@ -2769,11 +3698,7 @@ namespace cds { namespace intrusive {
         template <typename Q>
         bool find( Q const& val )
         {
-#       ifdef CDS_CXX11_LAMBDA_SUPPORT
-            return find( val, [](value_type&, Q const& ) {} )    ;
-#       else
-            return find( val, empty_find_functor() )    ;
-#       endif
+            return find_( val, key_predicate() ) ;
         }
 
         /// Find the key \p val using \p pred predicate for comparing
@@ -2787,11 +3712,7 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Predicate>
         bool find_with( Q const& val, Predicate pred )
         {
-#       ifdef CDS_CXX11_LAMBDA_SUPPORT
-            return find_with( val, typename predicate_wrapper<Predicate>::type(), [](value_type& , Q const& ) {} )    ;
-#       else
-            return find_with( val, typename predicate_wrapper<Predicate>::type(), empty_find_functor() )    ;
-#       endif
+            return find_( val, typename predicate_wrapper<Predicate>::type() ) ;
         }
 
         /// Clears the set
@@ -2820,7 +3741,8 @@ namespace cds { namespace intrusive {
         void clear_and_dispose( Disposer oDisposer )
         {
             // locks entire array
-            scoped_full_lock sl( m_MutexPolicy )    ;
+            help_resize() ;
+            scoped_full_lock sl( m_MutexPolicy, m_Versions )    ;
 
 #       if !defined(CDS_CXX11_LAMBDA_SUPPORT) || (CDS_COMPILER == CDS_COMPILER_MSVC && CDS_COMPILER_VERSION == 1600)
             disposer_wrapper<Disposer> disp( oDisposer )   ;
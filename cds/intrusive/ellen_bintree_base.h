@@ -0,0 +1,540 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_INTRUSIVE_ELLEN_BINTREE_BASE_H
+#define __CDS_INTRUSIVE_ELLEN_BINTREE_BASE_H
+
+#include <cds/intrusive/base.h>
+#include <cds/opt/options.h>
+#include <cds/urcu/options.h>
+#include <cds/details/marked_ptr.h>
+#include <cds/details/allocator.h>
+
+namespace cds { namespace intrusive {
+
+    /// EllenBinTree related declarations
+    /** @ingroup cds_intrusive_helper
+    */
+    namespace ellen_bintree {
+
+        //@cond
+        template <class GC, typename Tag>
+        class node ;
+
+        template <typename Key, typename LeafNode>
+        class internal_node ;
+        //@endcond
+
+        /// Update descriptor
+        /**
+            The update descriptor is the record of an insert or delete operation in progress.
+            A pointer to the descriptor is placed (with a 2-bit state) into \p m_pUpdate field
+            of an internal node to flag or to mark the node; any thread that encounters the flag
+            can complete the operation by the information stored in the descriptor.
+
+            The descriptors are allocated by the tree and are reclaimed by the tree's garbage collector.
+        */
+        template <typename LeafNode, typename InternalNode>
+        struct update_desc
+        {
+            typedef LeafNode        leaf_node       ;   ///< Leaf node type
+            typedef InternalNode    internal_node   ;   ///< Internal node type
+            typedef typename leaf_node::base_class  tree_node   ;   ///< Base type of leaf and internal nodes
+
+            typedef cds::details::marked_ptr< update_desc, 3 > update_ptr ;    ///< Marked pointer to descriptor
+
+            /// State of the internal node: the lowest bits of \ref update_ptr
+            enum state {
+                Clean = 0,  ///< No operation is in progress on the node
+                DFlag = 1,  ///< The node is the grandparent of a leaf being deleted
+                IFlag = 2,  ///< The node is the parent of a leaf being replaced by new subtree
+                Mark  = 3   ///< The node is removed from the tree (permanent state)
+            };
+
+            //@cond
+            struct insert_info {
+                internal_node *     pParent     ;   // parent of the leaf; it is flagged by IFlag
+                internal_node *     pNew        ;   // new subtree: internal node with two leaves
+                tree_node *         pLeaf       ;   // the leaf replaced by pNew
+                bool                bRightLeaf  ;   // true if pLeaf is the right child of pParent
+            };
+
+            struct delete_info {
+                internal_node *     pGrandParent    ;   // flagged by DFlag
+                internal_node *     pParent         ;   // marked by Mark, it is removed together with pLeaf
+                tree_node *         pLeaf           ;   // the leaf being deleted
+                update_desc *       pUpdateParent   ;   // expected (Clean) update descriptor of pParent
+                bool                bRightParent    ;   // true if pParent is the right child of pGrandParent
+                bool                bRightLeaf      ;   // true if pLeaf is the right child of pParent
+                bool                bDisposeLeaf    ;   // true if pLeaf should be disposed, false if it is extracted
+            };
+
+            union {
+                insert_info     iInfo   ;
+                delete_info     dInfo   ;
+            };
+            //@endcond
+        };
+
+        /// Base class of leaf and internal nodes
+        /**
+            Template parameters:
+            - \p GC - garbage collector
+            - \p Tag - a tag used to distinguish between different implementation. An incomplete type may be used as a tag.
+        */
+        template <class GC, typename Tag = opt::none>
+        class basic_node
+        {
+        public:
+            typedef GC      gc  ;   ///< Garbage collector
+            typedef Tag     tag ;   ///< Tag
+
+            //@cond
+            enum flags {
+                internal        = 1,    // internal node
+                key_infinite1   = 2,    // sentinel key infinity-1
+                key_infinite2   = 4,    // sentinel key infinity-2
+                key_infinite    = key_infinite1 | key_infinite2
+            };
+
+            unsigned int    m_nFlags    ;
+            //@endcond
+
+        public:
+            /// Constructs leaf (\p bInternal == \p false) or internal node (\p bInternal == \p true)
+            explicit basic_node( bool bInternal = false )
+                : m_nFlags( bInternal ? internal : 0 )
+            {}
+
+            /// Checks if the node is a leaf
+            bool is_leaf() const
+            {
+                return !is_internal() ;
+            }
+
+            /// Checks if the node is internal
+            bool is_internal() const
+            {
+                return (m_nFlags & internal) != 0 ;
+            }
+
+            /// Returns infinite key: 0 if the node contains a regular key, 1 for infinity-1 sentinel, 2 for infinity-2 sentinel
+            int infinite_key() const
+            {
+                return (m_nFlags & key_infinite) ? ((m_nFlags & key_infinite1) ? 1 : 2) : 0 ;
+            }
+
+            //@cond
+            void infinite_key( int nInf )
+            {
+                m_nFlags &= ~key_infinite ;
+                switch ( nInf ) {
+                    case 1:
+                        m_nFlags |= key_infinite1 ;
+                        break;
+                    case 2:
+                        m_nFlags |= key_infinite2 ;
+                        break;
+                    default:
+                        break;
+                }
+            }
+            //@endcond
+        };
+
+        /// Ellen's binary tree leaf node (the hook of the intrusive tree)
+        /**
+            Template parameters:
+            - \p GC - garbage collector
+            - \p Tag - a tag used to distinguish between different implementation. An incomplete type may be used as a tag.
+        */
+        template <class GC, typename Tag = opt::none>
+        class node: public basic_node< GC, Tag >
+        {
+        public:
+            typedef basic_node< GC, Tag >   base_class  ;   ///< Base class of leaf and internal nodes
+            typedef GC      gc  ;   ///< Garbage collector
+            typedef Tag     tag ;   ///< Tag
+
+        public:
+            /// Default ctor
+            node()
+                : base_class( false )
+            {}
+        };
+
+        /// Ellen's binary tree internal node
+        /**
+            Template parameters:
+            - \p Key - key type. The internal node contains a copy of the key of some leaf,
+                thus \p Key should be default- and copy-constructible.
+            - \p LeafNode - leaf node type (see \ref node)
+        */
+        template <typename Key, typename LeafNode>
+        class internal_node: public LeafNode::base_class
+        {
+        public:
+            typedef Key         key_type    ;   ///< key type
+            typedef LeafNode    leaf_node   ;   ///< leaf node type
+            typedef typename leaf_node::base_class  tree_node   ;   ///< Base type of leaf and internal nodes
+            typedef ellen_bintree::update_desc< leaf_node, internal_node >  update_desc_type    ;   ///< Update descriptor type
+            typedef typename update_desc_type::update_ptr   update_ptr  ;   ///< Marked pointer to update descriptor
+
+            typedef CDS_ATOMIC::atomic< tree_node * >   atomic_child_ptr    ;   ///< Atomic pointer to child
+            typedef CDS_ATOMIC::atomic< update_ptr >    atomic_update_ptr   ;   ///< Atomic marked pointer to update descriptor
+
+            key_type            m_Key       ;   ///< Regular key
+            atomic_child_ptr    m_pLeft     ;   ///< Left subtree
+            atomic_child_ptr    m_pRight    ;   ///< Right subtree
+            atomic_update_ptr   m_pUpdate   ;   ///< Update descriptor with the state of the node
+
+        public:
+            /// Default ctor
+            internal_node()
+                : tree_node( true )
+                , m_Key()
+                , m_pLeft( null_ptr<tree_node *>() )
+                , m_pRight( null_ptr<tree_node *>() )
+                , m_pUpdate( update_ptr() )
+            {}
+
+            /// Returns left (\p bRight == \p false) or right (\p bRight == \p true) child pointer
+            atomic_child_ptr& child( bool bRight )
+            {
+                return bRight ? m_pRight : m_pLeft ;
+            }
+
+            //@cond
+            atomic_child_ptr const& child( bool bRight ) const
+            {
+                return bRight ? m_pRight : m_pLeft ;
+            }
+            //@endcond
+        };
+
+        //@cond
+        struct undefined_gc ;
+        struct default_hook {
+            typedef undefined_gc    gc  ;
+            typedef opt::none       tag ;
+        };
+        //@endcond
+
+        //@cond
+        template < typename HookType, CDS_DECL_OPTIONS2>
+        struct hook
+        {
+            typedef typename opt::make_options< default_hook, CDS_OPTIONS2>::type  options ;
+            typedef typename options::gc    gc  ;
+            typedef typename options::tag   tag ;
+            typedef node<gc, tag>           node_type   ;
+            typedef HookType                hook_type   ;
+        };
+        //@endcond
+
+        /// Base hook
+        /**
+            \p Options are:
+            - opt::gc - garbage collector used.
+            - opt::tag - tag
+        */
+        template < CDS_DECL_OPTIONS2 >
+        struct base_hook: public hook< opt::base_hook_tag, CDS_OPTIONS2 >
+        {};
+
+        /// Member hook
+        /**
+            \p MemberOffset defines offset in bytes of \ref node member into your structure.
+            Use \p offsetof macro to define \p MemberOffset
+
+            \p Options are:
+            - opt::gc - garbage collector used.
+            - opt::tag - tag
+        */
+        template < size_t MemberOffset, CDS_DECL_OPTIONS2 >
+        struct member_hook: public hook< opt::member_hook_tag, CDS_OPTIONS2 >
+        {
+            //@cond
+            static const size_t c_nMemberOffset = MemberOffset ;
+            //@endcond
+        };
+
+        /// Traits hook
+        /**
+            \p NodeTraits defines type traits for node.
+            See \ref node_traits for \p NodeTraits interface description
+
+            \p Options are:
+            - opt::gc - garbage collector used.
+            - opt::tag - tag
+        */
+        template <typename NodeTraits, CDS_DECL_OPTIONS2 >
+        struct traits_hook: public hook< opt::traits_hook_tag, CDS_OPTIONS2 >
+        {
+            //@cond
+            typedef NodeTraits node_traits ;
+            //@endcond
+        };
+
+        /// Key extracting functor option setter
+        /**
+            The internal nodes of the tree contain the copies of the keys of the leaves,
+            so the tree needs a functor that copies the key from the value:
+            \code
+            struct key_extractor {
+                void operator()( key_type& dest, value_type const& src ) ;
+            };
+            \endcode
+            There is no default key extractor, the option is mandatory.
+        */
+        template <typename KeyExtractor>
+        struct key_extractor {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                typedef KeyExtractor key_extractor ;
+            };
+            //@endcond
+        };
+
+        /// EllenBinTree internal statistics
+        struct stat {
+            typedef cds::atomicity::event_counter   event_counter ; ///< Event counter type
+
+            event_counter   m_nInternalNodeCreated  ; ///< Total count of created internal nodes
+            event_counter   m_nInternalNodeDeleted  ; ///< Total count of retired internal nodes
+            event_counter   m_nUpdateDescCreated    ; ///< Total count of created update descriptors
+            event_counter   m_nUpdateDescDeleted    ; ///< Total count of retired update descriptors
+            event_counter   m_nFindSuccess          ; ///< Count of success \p find call
+            event_counter   m_nFindFailed           ; ///< Count of failed \p find call
+            event_counter   m_nInsertSuccess        ; ///< Count of success insertion
+            event_counter   m_nInsertFailed         ; ///< Count of failed insertion (the key exists)
+            event_counter   m_nInsertRetries        ; ///< Count of unsuccessful retries of insertion
+            event_counter   m_nEnsureExist          ; ///< Count of \p ensure call for existed node
+            event_counter   m_nEnsureNew            ; ///< Count of \p ensure call for new node
+            event_counter   m_nEnsureRetries        ; ///< Count of unsuccessful retries of ensuring
+            event_counter   m_nEraseSuccess         ; ///< Count of successful erasing (including \p unlink and \p extract_min / \p extract_max)
+            event_counter   m_nEraseFailed          ; ///< Count of failed erasing
+            event_counter   m_nEraseRetries         ; ///< Count of unsuccessful retries of erasing
+            event_counter   m_nSearchRetries        ; ///< Count of search restarts caused by a removed parent node
+            event_counter   m_nHelpInsert           ; ///< Count of insert helping
+            event_counter   m_nHelpDelete           ; ///< Count of delete helping
+            event_counter   m_nHelpMark             ; ///< Count of helping to unlink a marked node
+            event_counter   m_nHelpBacktrack        ; ///< Count of delete backtracking (the parent of the leaf has been changed)
+
+            //@cond
+            void    onInternalNodeCreated()     { ++m_nInternalNodeCreated  ; }
+            void    onInternalNodeDeleted()     { ++m_nInternalNodeDeleted  ; }
+            void    onUpdateDescCreated()       { ++m_nUpdateDescCreated    ; }
+            void    onUpdateDescDeleted()       { ++m_nUpdateDescDeleted    ; }
+            void    onFindSuccess()             { ++m_nFindSuccess          ; }
+            void    onFindFailed()              { ++m_nFindFailed           ; }
+            void    onInsertSuccess()           { ++m_nInsertSuccess        ; }
+            void    onInsertFailed()            { ++m_nInsertFailed         ; }
+            void    onInsertRetry()             { ++m_nInsertRetries        ; }
+            void    onEnsureExist()             { ++m_nEnsureExist          ; }
+            void    onEnsureNew()               { ++m_nEnsureNew            ; }
+            void    onEnsureRetry()             { ++m_nEnsureRetries        ; }
+            void    onEraseSuccess()            { ++m_nEraseSuccess         ; }
+            void    onEraseFailed()             { ++m_nEraseFailed          ; }
+            void    onEraseRetry()              { ++m_nEraseRetries         ; }
+            void    onSearchRetry()             { ++m_nSearchRetries        ; }
+            void    onHelpInsert()              { ++m_nHelpInsert           ; }
+            void    onHelpDelete()              { ++m_nHelpDelete           ; }
+            void    onHelpMark()                { ++m_nHelpMark             ; }
+            void    onHelpBacktrack()           { ++m_nHelpBacktrack        ; }
+            //@endcond
+        };
+
+        /// EllenBinTree empty statistics
+        struct empty_stat {
+            //@cond
+            void    onInternalNodeCreated()     const {}
+            void    onInternalNodeDeleted()     const {}
+            void    onUpdateDescCreated()       const {}
+            void    onUpdateDescDeleted()       const {}
+            void    onFindSuccess()             const {}
+            void    onFindFailed()              const {}
+            void    onInsertSuccess()           const {}
+            void    onInsertFailed()            const {}
+            void    onInsertRetry()             const {}
+            void    onEnsureExist()             const {}
+            void    onEnsureNew()               const {}
+            void    onEnsureRetry()             const {}
+            void    onEraseSuccess()            const {}
+            void    onEraseFailed()             const {}
+            void    onEraseRetry()              const {}
+            void    onSearchRetry()             const {}
+            void    onHelpInsert()              const {}
+            void    onHelpDelete()              const {}
+            void    onHelpMark()                const {}
+            void    onHelpBacktrack()           const {}
+            //@endcond
+        };
+
+        /// Type traits for EllenBinTree class
+        struct type_traits
+        {
+            /// Hook used
+            /**
+                Possible values are: ellen_bintree::base_hook, ellen_bintree::member_hook, ellen_bintree::traits_hook.
+            */
+            typedef base_hook<>                     hook        ;
+
+            /// Key extracting functor
+            /**
+                You should explicit define a valid functor, see \ref ellen_bintree::key_extractor option setter.
+            */
+            typedef opt::none                       key_extractor ;
+
+            /// Key comparison functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+
+                The functor is applied to the pairs <tt>(value_type, value_type)</tt>, <tt>(value_type, key_type)</tt>
+                and <tt>(Q, key_type)</tt>, <tt>(Q, value_type)</tt> where \p Q is a type of the key passed to
+                the search functions.
+            */
+            typedef opt::none                       compare     ;
+
+            /// specifies binary predicate used for key compare.
+            /**
+                Default is \p std::less<T>.
+            */
+            typedef opt::none                       less        ;
+
+            /// Disposer
+            /**
+                The functor used for dispose removed items. Default is opt::v::empty_disposer.
+            */
+            typedef opt::v::empty_disposer          disposer    ;
+
+            /// Item counter
+            /**
+                The type for item counting feature.
+                Default is no item counter (\ref atomicity::empty_item_counter)
+            */
+            typedef atomicity::empty_item_counter   item_counter;
+
+            /// C++ memory ordering model
+            /**
+                List of available memory ordering see opt::memory_model
+            */
+            typedef opt::v::relaxed_ordering        memory_model    ;
+
+            /// Allocator for internal nodes and for update descriptors
+            typedef CDS_DEFAULT_ALLOCATOR           allocator ;
+
+            /// back-off strategy used
+            /**
+                If the option is not specified, the cds::backoff::Default is used.
+            */
+            typedef cds::backoff::Default           back_off    ;
+
+            /// Internal statistics
+            typedef empty_stat                      stat ;
+
+            /// RCU deadlock checking policy (only for \ref cds_intrusive_EllenBinTree_rcu "RCU-based EllenBinTree")
+            /**
+                List of available options see opt::rcu_check_deadlock
+            */
+            typedef opt::v::rcu_throw_deadlock      rcu_check_deadlock ;
+        };
+
+        /// Metafunction converting option list to EllenBinTree traits
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options list see \ref EllenBinTree.
+        */
+        template <CDS_DECL_OPTIONS12>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, CDS_OPTIONS12 >::type
+                ,CDS_OPTIONS12
+            >::type   type ;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+
+            // Search direction: go to the right subtree if the key is greater or equal to the key of internal node
+            template <typename Q, typename Compare, typename InternalNode>
+            struct key_direction {
+                Q const&    m_Key   ;
+                Compare     m_Cmp   ;
+
+                key_direction( Q const& key, Compare cmp )
+                    : m_Key( key )
+                    , m_Cmp( cmp )
+                {}
+
+                bool operator()( InternalNode const& node ) const
+                {
+                    // any regular key is less than infinite key
+                    return node.infinite_key() == 0 && m_Cmp( m_Key, node.m_Key ) >= 0 ;
+                }
+            };
+
+            // Search for the leftmost leaf
+            template <typename InternalNode>
+            struct min_direction {
+                bool operator()( InternalNode const& ) const
+                {
+                    return false ;
+                }
+            };
+
+            // Search for the rightmost leaf with regular key
+            template <typename InternalNode>
+            struct max_direction {
+                bool operator()( InternalNode const& node ) const
+                {
+                    // the right subtree of a node with infinite key contains the sentinel only
+                    return node.infinite_key() == 0 ;
+                }
+            };
+
+            template <typename Alloc, typename InternalNode, typename UpdateDesc>
+            struct node_allocators {
+                typedef cds::details::Allocator< InternalNode, typename Alloc::template rebind< InternalNode >::other > internal_node_allocator  ;
+                typedef cds::details::Allocator< UpdateDesc, typename Alloc::template rebind< UpdateDesc >::other >     update_desc_allocator    ;
+
+                struct internal_node_deleter {
+                    void operator()( InternalNode * p ) const
+                    {
+                        internal_node_allocator().Delete( p ) ;
+                    }
+                };
+
+                struct update_desc_deleter {
+                    void operator()( UpdateDesc * p ) const
+                    {
+                        update_desc_allocator().Delete( p ) ;
+                    }
+                };
+            };
+
+        } // namespace details
+        //@endcond
+
+    } // namespace ellen_bintree
+
+    // Forward declaration
+    template < class GC, typename Key, typename T, class Traits = ellen_bintree::type_traits >
+    class EllenBinTree ;
+
+}} // namespace cds::intrusive
+
+#endif // #ifndef __CDS_INTRUSIVE_ELLEN_BINTREE_BASE_H
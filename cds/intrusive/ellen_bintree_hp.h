@@ -0,0 +1,18 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_INTRUSIVE_ELLEN_BINTREE_HP_H
+#define __CDS_INTRUSIVE_ELLEN_BINTREE_HP_H
+
+#include <cds/gc/hp.h>
+#include <cds/intrusive/ellen_bintree_impl.h>
+
+#endif // #ifndef __CDS_INTRUSIVE_ELLEN_BINTREE_HP_H
@@ -0,0 +1,1130 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_INTRUSIVE_ELLEN_BINTREE_IMPL_H
+#define __CDS_INTRUSIVE_ELLEN_BINTREE_IMPL_H
+
+#include <cds/intrusive/ellen_bintree_base.h>
+#include <cds/opt/compare.h>
+#include <cds/ref.h>
+#include <cds/details/std/type_traits.h>
+#include <cds/details/std/memory.h>
+
+namespace cds { namespace intrusive {
+
+    /// Ellen's et al binary search tree
+    /** @ingroup cds_intrusive_map
+        @ingroup cds_intrusive_tree
+        @anchor cds_intrusive_EllenBinTree
+
+        Source:
+            - [2010] F.Ellen, P.Fatourou, E.Ruppert, F.van Breugel "Non-blocking Binary Search Tree"
+
+        %EllenBinTree is an unbalanced leaf-oriented binary search tree that implements the <i>set</i>
+        abstract data type. Nodes maintains child pointers but not parent pointers.
+        Every internal node has exactly two children, and all data of type \p T currently in
+        the tree are stored in the leaves. Internal nodes of the tree are used to direct \p find
+        operation along the path to the correct leaf. The keys (of \p Key type) stored in internal nodes
+        may or may not be in the set. \p Key type is a subset of \p T type.
+        There should be exactly defined a key extracting functor for converting object of type \p T to
+        object of type \p Key, see \ref ellen_bintree::key_extractor option.
+
+        Due to \p extract_min and \p extract_max member functions the \p %EllenBinTree can act as
+        a <i>priority queue</i>. In this case you should provide unique compound key, for example,
+        the priority value plus some uniformly distributed random value.
+
+        The tree consumes one leaf (the hook embedded into the item) and one internal node per item;
+        compare with a node of \ref cds_intrusive_SkipListSet_hp "SkipListSet" that contains a tower
+        up to 32 atomic pointers.
+
+        @warning The tree is not balanced: the insertion of ordered sequence of keys produces
+        a degenerate tree with linear search time.
+
+        The tree uses hazard pointers in the following manner: every search keeps the grandparent,
+        the parent, the leaf and the update descriptors of the parent and the grandparent guarded,
+        plus one guard for the update descriptor of the current operation and one guard for inserting item.
+        So, the tree requires \ref c_nHazardPtrCount hazard pointers per thread for gc::HP.
+
+        <b>Template arguments</b> :
+        - \p GC - garbage collector used, possible types are cds::gc::HP, cds::gc::PTB.
+            Note that cds::gc::HRC is not supported.
+        - \p Key - key type, a subset of \p T
+        - \p T - type to be stored in tree's leaf nodes. The type must be based on ellen_bintree::node
+            (for ellen_bintree::base_hook) or it must have a member of type ellen_bintree::node
+            (for ellen_bintree::member_hook).
+        - \p Traits - type traits. See ellen_bintree::type_traits for explanation.
+
+        It is possible to declare option-based tree with ellen_bintree::make_traits metafunction
+        instead of \p Traits template argument.
+        Template argument list \p Options of ellen_bintree::make_traits metafunction are:
+        - opt::hook - hook used. Possible values are: ellen_bintree::base_hook, ellen_bintree::member_hook, ellen_bintree::traits_hook.
+            If the option is not specified, <tt>ellen_bintree::base_hook<></tt> is used.
+        - ellen_bintree::key_extractor - key extracting functor, mandatory option. The functor has the following prototype:
+            \code
+                struct key_extractor {
+                    void operator ()( Key& dest, T const& src ) ;
+                };
+            \endcode
+            It should initialize \p dest key from \p src data. The functor is used to initialize internal nodes.
+        - opt::compare - key compare functor. No default functor is provided.
+            If the option is not specified, \p %opt::less is used.
+        - opt::less - specifies binary predicate used for key compare. At least \p %opt::compare or \p %opt::less should be defined.
+        - opt::disposer - the functor used for dispose removed nodes. Default is opt::v::empty_disposer. Due the nature
+            of GC schema the disposer may be called asynchronously.
+        - opt::item_counter - the type of item counting feature. Default is \ref atomicity::empty_item_counter that means no item counting.
+        - opt::memory_model - C++ memory ordering model. Can be opt::v::relaxed_ordering (relaxed memory model, the default)
+            or opt::v::sequential_consistent (sequentially consisnent memory model).
+        - opt::allocator - the allocator used for internal nodes and for update descriptors. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - opt::back_off - back-off strategy used. If the option is not specified, the cds::backoff::Default is used.
+        - opt::stat - internal statistics. Available types: ellen_bintree::stat, ellen_bintree::empty_stat (the default)
+
+        @note Before including <tt><cds/intrusive/ellen_bintree_impl.h></tt> you should include appropriate GC file,
+        or use the GC-specific header: <tt><cds/intrusive/ellen_bintree_hp.h></tt>, <tt><cds/intrusive/ellen_bintree_ptb.h></tt>.
+        For RCU-based tree see \ref cds_intrusive_EllenBinTree_rcu "EllenBinTree<RCU>".
+
+        <b>Usage</b>
+
+        \code
+        #include <cds/intrusive/ellen_bintree_hp.h>
+
+        struct Foo: public cds::intrusive::ellen_bintree::node< cds::gc::HP >
+        {
+            int     nKey    ;   // key
+            // other data
+        };
+
+        struct foo_key_extractor {
+            void operator()( int& key, Foo const& src ) const
+            {
+                key = src.nKey ;
+            }
+        };
+
+        struct foo_less {
+            bool operator()( Foo const& v1, Foo const& v2 ) const { return v1.nKey < v2.nKey ; }
+            bool operator()( Foo const& v, int k ) const { return v.nKey < k ; }
+            bool operator()( int k, Foo const& v ) const { return k < v.nKey ; }
+            bool operator()( int k1, int k2 ) const { return k1 < k2 ; }
+        };
+
+        typedef cds::intrusive::EllenBinTree< cds::gc::HP, int, Foo,
+            cds::intrusive::ellen_bintree::make_traits<
+                cds::intrusive::opt::hook< cds::intrusive::ellen_bintree::base_hook< cds::opt::gc< cds::gc::HP > > >
+                ,cds::intrusive::ellen_bintree::key_extractor< foo_key_extractor >
+                ,cds::opt::less< foo_less >
+            >::type
+        > foo_tree ;
+        \endcode
+    */
+    template < class GC,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = ellen_bintree::type_traits
+#else
+        class Traits
+#endif
+    >
+    class EllenBinTree
+    {
+    public:
+        typedef GC      gc          ;   ///< Garbage collector used
+        typedef Key     key_type    ;   ///< type of a key stored in internal nodes; key is a part of \p value_type
+        typedef T       value_type  ;   ///< type of value stored in the tree
+        typedef Traits  options     ;   ///< Traits template parameter
+
+        typedef typename options::hook      hook        ;   ///< hook type
+        typedef typename hook::node_type    leaf_node   ;   ///< leaf node type (the hook)
+        typedef typename leaf_node::base_class  tree_node   ;   ///< base of leaf and internal nodes
+        typedef ellen_bintree::internal_node< key_type, leaf_node > internal_node   ;   ///< internal node type
+        typedef typename internal_node::update_desc_type    update_desc ;   ///< update descriptor type
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator  ;    ///< key compare functor based on opt::compare and opt::less option setter.
+#   else
+        typedef typename opt::details::make_comparator< value_type, options >::type key_comparator  ;
+#   endif
+
+        typedef typename options::disposer  disposer    ;   ///< leaf node disposer
+        typedef typename get_node_traits< value_type, leaf_node, hook>::type node_traits ;  ///< node traits
+        typedef typename options::key_extractor key_extractor   ;   ///< key extracting functor
+
+        typedef typename options::item_counter  item_counter    ;   ///< Item counting policy used
+        typedef typename options::memory_model  memory_model    ;   ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename options::allocator     allocator_type  ;   ///< Allocator for internal nodes and update descriptors
+        typedef typename options::back_off      back_off        ;   ///< Back-off strategy
+        typedef typename options::stat          stat            ;   ///< internal statistics type
+
+        /// Count of hazard pointers required for the tree
+        static size_t const c_nHazardPtrCount = 7 ;
+
+    protected:
+        //@cond
+        typedef typename internal_node::update_ptr  update_ptr  ;
+
+        typedef ellen_bintree::details::node_allocators< allocator_type, internal_node, update_desc > node_allocators ;
+        typedef typename node_allocators::internal_node_allocator   cxx_internal_node_allocator ;
+        typedef typename node_allocators::update_desc_allocator     cxx_update_desc_allocator   ;
+        typedef typename node_allocators::internal_node_deleter     internal_node_deleter       ;
+        typedef typename node_allocators::update_desc_deleter       update_desc_deleter         ;
+
+        typedef std::unique_ptr< internal_node, internal_node_deleter >   unique_internal_node_ptr ;
+
+        struct search_result {
+            enum guard_index {
+                Guard_GrandParent,
+                Guard_Parent,
+                Guard_Leaf,
+                Guard_updGrandParent,
+                Guard_updParent,
+                Guard_temporary,
+
+                guard_count
+            };
+
+            typedef typename gc::template GuardArray< guard_count > guard_array ;
+            guard_array     guards  ;
+
+            internal_node *     pGrandParent    ;
+            internal_node *     pParent         ;
+            tree_node *         pLeaf           ;
+            update_ptr          updParent       ;
+            update_ptr          updGrandParent  ;
+            bool                bRightLeaf      ;   // true if pLeaf is right child of pParent, false otherwise
+            bool                bRightParent    ;   // true if pParent is right child of pGrandParent, false otherwise
+
+            search_result()
+                : pGrandParent( null_ptr<internal_node *>() )
+                , pParent( null_ptr<internal_node *>() )
+                , pLeaf( null_ptr<tree_node *>() )
+                , bRightLeaf( false )
+                , bRightParent( false )
+            {}
+        };
+
+        typedef typename search_result::guard_array guard_array ;
+
+        template <typename Q, typename Compare>
+        struct key_acceptor {
+            Q const&    m_Key   ;
+            Compare     m_Cmp   ;
+
+            key_acceptor( Q const& key, Compare cmp )
+                : m_Key( key )
+                , m_Cmp( cmp )
+            {}
+
+            bool operator()( tree_node * pLeaf ) const
+            {
+                return pLeaf->infinite_key() == 0 && m_Cmp( m_Key, *node_to_value( pLeaf )) == 0 ;
+            }
+        };
+
+        struct node_acceptor {
+            tree_node const *   m_pNode ;
+
+            explicit node_acceptor( leaf_node const * pNode )
+                : m_pNode( pNode )
+            {}
+
+            bool operator()( tree_node * pLeaf ) const
+            {
+                return pLeaf == m_pNode ;
+            }
+        };
+
+        struct regular_leaf_acceptor {
+            bool operator()( tree_node * pLeaf ) const
+            {
+                return pLeaf->infinite_key() == 0 ;
+            }
+        };
+
+        struct empty_insert_functor {
+            void operator()( value_type& )
+            {}
+        };
+
+        struct empty_erase_functor  {
+            void operator()( value_type& )
+            {}
+        };
+
+        struct empty_find_functor {
+            template <typename Q>
+            void operator()( value_type&, Q& )
+            {}
+        };
+
+        template <typename Func>
+        struct insert_at_ensure_functor {
+            Func m_func ;
+            insert_at_ensure_functor( Func f ) : m_func(f) {}
+
+            void operator()( value_type& item )
+            {
+                cds::unref( m_func)( true, item, item ) ;
+            }
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        internal_node       m_Root      ;   ///< Tree root node (key= Infinite2)
+        leaf_node           m_LeafInf1  ;   ///< Infinite leaf 1 (key= Infinite1)
+        leaf_node           m_LeafInf2  ;   ///< Infinite leaf 2 (key= Infinite2)
+
+        item_counter        m_ItemCounter   ;   ///< item counter
+        mutable stat        m_Stat          ;   ///< internal statistics
+        //@endcond
+
+    public:
+        /// Default constructor
+        EllenBinTree()
+        {
+            static_assert( (!std::is_same< key_extractor, opt::none >::value), "The key extractor option must be specified" ) ;
+            make_empty_tree() ;
+        }
+
+        /// Clears the tree
+        /**
+            The destructor is not thread-safe: no concurrent access to the tree is allowed.
+            The \ref disposer is called for each item in the tree.
+        */
+        ~EllenBinTree()
+        {
+            unsafe_clear() ;
+        }
+
+        /// Inserts new node
+        /**
+            The function inserts \p val in the tree if it does not contain
+            an item with key equal to \p val.
+
+            Returns \p true if \p val is placed into the tree, \p false otherwise.
+        */
+        bool insert( value_type& val )
+        {
+            return insert( val, empty_insert_functor() ) ;
+        }
+
+        /// Inserts new node
+        /**
+            This function is intended for derived non-intrusive containers.
+
+            The function allows to split creating of new item into two part:
+            - create item with key only
+            - insert new item into the tree
+            - if inserting is success, calls  \p f functor to initialize value-field of \p val.
+
+            The functor signature is:
+            \code
+                void func( value_type& val ) ;
+            \endcode
+            where \p val is the item inserted. User-defined functor \p f should guarantee that during changing
+            \p val no any other changes could be made on this tree's item by concurrent threads.
+            The user-defined functor is called only if the inserting is success and may be passed by reference
+            using <tt>boost::ref</tt>
+        */
+        template <typename Func>
+        bool insert( value_type& val, Func f )
+        {
+            typename gc::Guard guardInsert  ;
+            guardInsert.assign( &val ) ;
+
+            unique_internal_node_ptr pNewInternal ;
+            search_result res ;
+            back_off bkoff ;
+
+            for ( ;; ) {
+                if ( search( res, val, key_comparator() )) {
+                    if ( pNewInternal.get() )
+                        m_Stat.onInternalNodeDeleted() ;    // unique_internal_node_ptr deletes the node
+                    m_Stat.onInsertFailed() ;
+                    return false ;
+                }
+
+                if ( res.updParent.bits() != update_desc::Clean )
+                    help( res.updParent, res.pParent, res.guards, search_result::Guard_Leaf, search_result::Guard_updGrandParent ) ;
+                else {
+                    if ( !pNewInternal.get() )
+                        pNewInternal.reset( alloc_internal_node() ) ;
+
+                    if ( try_insert( val, pNewInternal.get(), res )) {
+                        cds::unref(f)( val ) ;
+                        pNewInternal.release()  ;   // internal node is linked into the tree
+                        break ;
+                    }
+                }
+
+                bkoff() ;
+                m_Stat.onInsertRetry() ;
+            }
+
+            ++m_ItemCounter ;
+            m_Stat.onInsertSuccess() ;
+            return true ;
+        }
+
+        /// Ensures that the \p val exists in the tree
+        /**
+            The operation performs inserting or changing data with lock-free manner.
+
+            If the item \p val is not found in the tree, then \p val is inserted into the tree.
+            Otherwise, the functor \p func is called with item found.
+            The functor signature is:
+            \code
+                void func( bool bNew, value_type& item, value_type& val ) ;
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - item of the tree
+            - \p val - argument \p val passed into the \p ensure function
+            If new item has been inserted (i.e. \p bNew is \p true) then \p item and \p val arguments
+            refer to the same thing.
+
+            The functor can change non-key fields of the \p item; however, \p func must guarantee
+            that during changing no any other modifications could be made on this item by concurrent threads.
+
+            You can pass \p func argument by value or by reference using <tt>boost::ref</tt> or cds::ref.
+
+            Returns std::pair<bool, bool> where \p first is \p true if operation is successfull,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already is in the tree.
+        */
+        template <typename Func>
+        std::pair<bool, bool> ensure( value_type& val, Func func )
+        {
+            typename gc::Guard guardInsert  ;
+            guardInsert.assign( &val ) ;
+
+            unique_internal_node_ptr pNewInternal ;
+            search_result res ;
+            back_off bkoff ;
+
+            for ( ;; ) {
+                if ( search( res, val, key_comparator() )) {
+                    cds::unref(func)( false, *node_to_value( res.pLeaf ), val ) ;
+                    if ( pNewInternal.get() )
+                        m_Stat.onInternalNodeDeleted() ;    // unique_internal_node_ptr deletes the node
+                    m_Stat.onEnsureExist() ;
+                    return std::make_pair( true, false ) ;
+                }
+
+                if ( res.updParent.bits() != update_desc::Clean )
+                    help( res.updParent, res.pParent, res.guards, search_result::Guard_Leaf, search_result::Guard_updGrandParent ) ;
+                else {
+                    if ( !pNewInternal.get() )
+                        pNewInternal.reset( alloc_internal_node() ) ;
+
+                    if ( try_insert( val, pNewInternal.get(), res )) {
+                        cds::unref(func)( true, val, val ) ;
+                        pNewInternal.release()  ;   // internal node is linked into the tree
+                        break ;
+                    }
+                }
+
+                bkoff() ;
+                m_Stat.onEnsureRetry() ;
+            }
+
+            ++m_ItemCounter ;
+            m_Stat.onEnsureNew() ;
+            return std::make_pair( true, true ) ;
+        }
+
+        /// Unlinks the item \p val from the tree
+        /**
+            The function searches the item \p val in the tree and unlink it from the tree
+            if it is found and is equal to \p val.
+
+            Difference between \ref erase and \p unlink functions: \p erase finds <i>a key</i>
+            and deletes the item found. \p unlink finds an item by key and deletes it
+            only if \p val is a node, i.e. the pointer to item found is equal to <tt> &val </tt>.
+
+            The \ref disposer specified in \p Traits class template parameter is called
+            by garbage collector \p GC asynchronously.
+
+            The function returns \p true if success and \p false otherwise.
+        */
+        bool unlink( value_type& val )
+        {
+            return erase_( ellen_bintree::details::key_direction< value_type, key_comparator, internal_node >( val, key_comparator() ),
+                node_acceptor( node_traits::to_node_ptr( val )),
+                empty_erase_functor() ) ;
+        }
+
+        /// Deletes the item from the tree
+        /** \anchor cds_intrusive_EllenBinTree_erase
+            The function searches an item with key equal to \p val in the tree,
+            unlinks it from the tree, and returns \p true.
+            If the item with key equal to \p val is not found the function return \p false.
+
+            Note the compare functor should accept a parameter of type \p Q that can be not the same as \p value_type.
+        */
+        template <typename Q>
+        bool erase( const Q& val )
+        {
+            return erase_( ellen_bintree::details::key_direction< Q, key_comparator, internal_node >( val, key_comparator() ),
+                key_acceptor< Q, key_comparator >( val, key_comparator() ),
+                empty_erase_functor() ) ;
+        }
+
+        /// Delete the item from the tree with comparing functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_erase "erase(Q const&)"
+            but \p pred predicate is used for key comparing.
+            \p Less has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the tree.
+        */
+        template <typename Q, typename Less>
+        bool erase_with( const Q& val, Less pred )
+        {
+            typedef cds::opt::details::make_comparator_from_less<Less> compare_functor ;
+            return erase_( ellen_bintree::details::key_direction< Q, compare_functor, internal_node >( val, compare_functor() ),
+                key_acceptor< Q, compare_functor >( val, compare_functor() ),
+                empty_erase_functor() ) ;
+        }
+
+        /// Deletes the item from the tree
+        /** \anchor cds_intrusive_EllenBinTree_erase_func
+            The function searches an item with key equal to \p val in the tree,
+            call \p f functor with item found, unlinks it from the tree, and returns \p true.
+            The \ref disposer specified in \p Traits class template parameter is called
+            by garbage collector \p GC asynchronously.
+
+            The \p Func interface is
+            \code
+            struct functor {
+                void operator()( value_type& item ) ;
+            };
+            \endcode
+            The functor may be passed by reference with <tt>boost:ref</tt>
+
+            If the item with key equal to \p val is not found the function return \p false.
+
+            Note the compare functor should accept a parameter of type \p Q that can be not the same as \p value_type.
+        */
+        template <typename Q, typename Func>
+        bool erase( Q const& val, Func f )
+        {
+            return erase_( ellen_bintree::details::key_direction< Q, key_comparator, internal_node >( val, key_comparator() ),
+                key_acceptor< Q, key_comparator >( val, key_comparator() ),
+                f ) ;
+        }
+
+        /// Delete the item from the tree with comparing functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_erase_func "erase(Q const&, Func)"
+            but \p pred predicate is used for key comparing.
+            \p Less has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the tree.
+        */
+        template <typename Q, typename Less, typename Func>
+        bool erase_with( Q const& val, Less pred, Func f )
+        {
+            typedef cds::opt::details::make_comparator_from_less<Less> compare_functor ;
+            return erase_( ellen_bintree::details::key_direction< Q, compare_functor, internal_node >( val, compare_functor() ),
+                key_acceptor< Q, compare_functor >( val, compare_functor() ),
+                f ) ;
+        }
+
+        /// Extracts an item with minimal key from the tree
+        /**
+            The function searches an item with minimal key, unlinks it, and calls the functor \p f
+            for the item unlinked:
+            \code
+            struct functor {
+                void operator()( value_type& item ) ;
+            };
+            \endcode
+            The item is protected by a hazard pointer while the functor is being called,
+            after that the \ref disposer is called for the item by garbage collector \p GC asynchronously.
+            The functor may be passed by reference with <tt>boost:ref</tt>
+
+            If the tree is empty the function returns \p false.
+
+            @note Due the concurrent nature of the tree, the function extracts <i>nearly</i> minimum key.
+            It means that the function gets leftmost leaf of the tree and tries to unlink it.
+            During unlinking, a concurrent thread may insert an item with key less than leftmost item's key.
+            So, the function returns the item with minimum key at the moment of tree traversing.
+        */
+        template <typename Func>
+        bool extract_min( Func f )
+        {
+            return erase_( ellen_bintree::details::min_direction< internal_node >(), regular_leaf_acceptor(), f ) ;
+        }
+
+        /// Extracts an item with minimal key from the tree and disposes it
+        bool extract_min()
+        {
+            return extract_min( empty_erase_functor() ) ;
+        }
+
+        /// Extracts an item with maximal key from the tree
+        /**
+            The function is an analog of \ref extract_min for the item with maximal key.
+
+            @note Due the concurrent nature of the tree, the function extracts <i>nearly</i> maximal key.
+            It means that the function gets rightmost leaf of the tree and tries to unlink it.
+            During unlinking, a concurrent thread may insert an item with key great than rightmost item's key.
+            So, the function returns the item with maximal key at the moment of tree traversing.
+        */
+        template <typename Func>
+        bool extract_max( Func f )
+        {
+            return erase_( ellen_bintree::details::max_direction< internal_node >(), regular_leaf_acceptor(), f ) ;
+        }
+
+        /// Extracts an item with maximal key from the tree and disposes it
+        bool extract_max()
+        {
+            return extract_max( empty_erase_functor() ) ;
+        }
+
+        /// Finds the key \p val
+        /** @anchor cds_intrusive_EllenBinTree_find_val
+            The function searches the item with key equal to \p val
+            and returns \p true if it is found, and \p false otherwise.
+
+            Note the compare functor specified for class \p Traits template parameter
+            should accept a parameter of type \p Q that can be not the same as \p value_type.
+        */
+        template <typename Q>
+        bool find( Q const& val ) const
+        {
+            return const_cast<EllenBinTree *>( this )->find_( val, key_comparator(), empty_find_functor() ) ;
+        }
+
+        /// Finds the key \p val with comparing functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_find_val "find(Q const&)"
+            but \p pred is used for key compare.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the tree.
+        */
+        template <typename Q, typename Less>
+        bool find_with( Q const& val, Less pred ) const
+        {
+            return const_cast<EllenBinTree *>( this )->find_( val, cds::opt::details::make_comparator_from_less<Less>(), empty_find_functor() ) ;
+        }
+
+        /// Finds the key \p val
+        /** @anchor cds_intrusive_EllenBinTree_find_func
+            The function searches the item with key equal to \p val and calls the functor \p f for the item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item, Q& val ) ;
+            };
+            \endcode
+            where \p item is the item found, \p val is the <tt>find</tt> function argument.
+
+            You can pass \p f argument by value or by reference using <tt>boost::ref</tt> or cds::ref.
+
+            The functor can change non-key fields of \p item. Note that the functor is only guarantee
+            that \p item cannot be disposed during functor is executing.
+            The functor does not serialize simultaneous access to the tree \p item. If such access is
+            possible you must provide your own synchronization schema on item level to exclude unsafe item modifications.
+
+            The function returns \p true if \p val is found, \p false otherwise.
+        */
+        template <typename Q, typename Func>
+        bool find( Q& val, Func f ) const
+        {
+            return const_cast<EllenBinTree *>( this )->find_( val, key_comparator(), f ) ;
+        }
+
+        /// Finds the key \p val with comparing functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_find_func "find(Q&, Func)"
+            but \p pred is used for key comparison.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the tree.
+        */
+        template <typename Q, typename Less, typename Func>
+        bool find_with( Q& val, Less pred, Func f ) const
+        {
+            return const_cast<EllenBinTree *>( this )->find_( val, cds::opt::details::make_comparator_from_less<Less>(), f ) ;
+        }
+
+        /// Finds the key \p val
+        /** @anchor cds_intrusive_EllenBinTree_find_cfunc
+            The function is an analog of \ref cds_intrusive_EllenBinTree_find_func "find(Q&, Func)"
+            for const argument \p val.
+        */
+        template <typename Q, typename Func>
+        bool find( Q const& val, Func f ) const
+        {
+            return const_cast<EllenBinTree *>( this )->find_( val, key_comparator(), f ) ;
+        }
+
+        /// Finds the key \p val with comparing functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_find_cfunc "find(Q const&, Func)"
+            but \p pred is used for key comparison.
+        */
+        template <typename Q, typename Less, typename Func>
+        bool find_with( Q const& val, Less pred, Func f ) const
+        {
+            return const_cast<EllenBinTree *>( this )->find_( val, cds::opt::details::make_comparator_from_less<Less>(), f ) ;
+        }
+
+        /// Checks if the tree is empty
+        bool empty() const
+        {
+            return m_Root.m_pLeft.load( memory_model::memory_order_relaxed )->is_leaf() ;
+        }
+
+        /// Returns item count in the tree
+        /**
+            Only leaf nodes containing user data are counted.
+
+            The value returned depends on item counter type provided by \p Traits template parameter.
+            If it is atomicity::empty_item_counter this function always returns 0.
+            Therefore, the function is not suitable for checking the tree emptiness, use \ref empty
+            member function for this purpose.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter ;
+        }
+
+        /// Clears the tree (thread safe, non-atomic)
+        /**
+            The function unlink all items from the tree by \ref extract_min.
+            The function is not atomic, i.e., in multi-threaded environment with parallel insertions
+            this sequence
+            \code
+            tree.clear() ;
+            assert( tree.empty() ) ;
+            \endcode
+            the assertion could be raised.
+
+            For each leaf the \ref disposer will be called after unlinking.
+        */
+        void clear()
+        {
+            while ( extract_min() ) ;
+        }
+
+        /// Clears the tree (not thread safe)
+        /**
+            This function is not thread safe and may be called only when no other thread deals with the tree.
+            The function is used in the tree destructor.
+        */
+        void unsafe_clear()
+        {
+            // Rotation-based traversal: the tree may be degenerate, so the recursion is not suitable
+            tree_node * pNode = m_Root.m_pLeft.load( memory_model::memory_order_relaxed ) ;
+            while ( pNode->is_internal() ) {
+                internal_node * pParent = static_cast<internal_node *>( pNode ) ;
+                tree_node * pLeft = pParent->m_pLeft.load( memory_model::memory_order_relaxed ) ;
+                if ( pLeft->is_internal() ) {
+                    // rotate right
+                    internal_node * pLeftInternal = static_cast<internal_node *>( pLeft ) ;
+                    pParent->m_pLeft.store( pLeftInternal->m_pRight.load( memory_model::memory_order_relaxed ), memory_model::memory_order_relaxed ) ;
+                    pLeftInternal->m_pRight.store( pParent, memory_model::memory_order_relaxed ) ;
+                    pNode = pLeftInternal ;
+                }
+                else {
+                    pNode = pParent->m_pRight.load( memory_model::memory_order_relaxed ) ;
+                    if ( pLeft->infinite_key() == 0 )
+                        disposer()( node_to_value( pLeft )) ;
+                    free_internal_node( pParent ) ;
+                }
+            }
+            if ( pNode->infinite_key() == 0 )
+                disposer()( node_to_value( pNode )) ;
+
+            free_update_desc( m_Root.m_pUpdate.load( memory_model::memory_order_relaxed ).ptr() ) ;
+            m_ItemCounter.reset() ;
+            make_empty_tree() ;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat ;
+        }
+
+    protected:
+        //@cond
+        void make_empty_tree()
+        {
+            m_Root.infinite_key( 2 ) ;
+            m_LeafInf1.infinite_key( 1 ) ;
+            m_LeafInf2.infinite_key( 2 ) ;
+            m_Root.m_pLeft.store( &m_LeafInf1, memory_model::memory_order_relaxed ) ;
+            m_Root.m_pRight.store( &m_LeafInf2, memory_model::memory_order_relaxed ) ;
+            m_Root.m_pUpdate.store( update_ptr(), memory_model::memory_order_release ) ;
+        }
+
+        static value_type * node_to_value( tree_node * pNode )
+        {
+            assert( pNode->is_leaf() && pNode->infinite_key() == 0 ) ;
+            return node_traits::to_value_ptr( static_cast<leaf_node *>( pNode )) ;
+        }
+
+        internal_node * alloc_internal_node() const
+        {
+            m_Stat.onInternalNodeCreated() ;
+            return cxx_internal_node_allocator().New() ;
+        }
+
+        void free_internal_node( internal_node * pNode ) const
+        {
+            update_desc * pDesc = pNode->m_pUpdate.load( memory_model::memory_order_relaxed ).ptr() ;
+            if ( pDesc )
+                free_update_desc( pDesc ) ;
+            cxx_internal_node_allocator().Delete( pNode ) ;
+            m_Stat.onInternalNodeDeleted() ;
+        }
+
+        update_desc * alloc_update_desc() const
+        {
+            m_Stat.onUpdateDescCreated() ;
+            return cxx_update_desc_allocator().New() ;
+        }
+
+        void free_update_desc( update_desc * pDesc ) const
+        {
+            if ( pDesc ) {
+                cxx_update_desc_allocator().Delete( pDesc ) ;
+                m_Stat.onUpdateDescDeleted() ;
+            }
+        }
+
+        void retire_node( internal_node * pNode ) const
+        {
+            m_Stat.onInternalNodeDeleted() ;
+            gc::template retire< internal_node_deleter >( pNode ) ;
+        }
+
+        static void retire_leaf( tree_node * pLeaf )
+        {
+            gc::template retire< disposer >( node_to_value( pLeaf )) ;
+        }
+
+        void retire_update_desc( update_desc * pDesc ) const
+        {
+            // The descriptor is retired when it is displaced from its owner node by a new operation.
+            // A descriptor cannot be displaced twice, so it is retired only once
+            m_Stat.onUpdateDescDeleted() ;
+            gc::template retire< update_desc_deleter >( pDesc ) ;
+        }
+
+        struct update_desc_accessor {
+            update_desc * operator()( update_ptr p ) const
+            {
+                return p.ptr() ;
+            }
+        };
+
+        static update_ptr protect_update( guard_array& guards, size_t nIndex, typename internal_node::atomic_update_ptr const& src )
+        {
+            return guards.protect( nIndex, src, update_desc_accessor() ) ;
+        }
+
+        template <typename Q, typename Compare>
+        bool search( search_result& res, Q const& val, Compare cmp ) const
+        {
+            search_( res, ellen_bintree::details::key_direction< Q, Compare, internal_node >( val, cmp )) ;
+            return key_acceptor< Q, Compare >( val, cmp )( res.pLeaf ) ;
+        }
+
+        template <typename Direction>
+        void search_( search_result& res, Direction dir ) const
+        {
+            internal_node * pParent         ;
+            internal_node * pGrandParent    ;
+            tree_node *     pLeaf           ;
+            update_ptr      updParent       ;
+            update_ptr      updGrandParent  ;
+            bool            bRightLeaf      ;
+            bool            bRightParent    ;
+
+        try_again:
+            pParent = null_ptr<internal_node *>() ;
+            pGrandParent = null_ptr<internal_node *>() ;
+            updParent = update_ptr() ;
+            bRightLeaf = false ;
+            bRightParent = false ;
+            pLeaf = const_cast<internal_node *>( &m_Root ) ;
+            res.guards.clear( search_result::Guard_Leaf ) ;
+            res.guards.clear( search_result::Guard_updParent ) ;
+
+            while ( pLeaf->is_internal() ) {
+                res.guards.copy( search_result::Guard_GrandParent, search_result::Guard_Parent ) ;
+                pGrandParent = pParent ;
+                res.guards.copy( search_result::Guard_Parent, search_result::Guard_Leaf ) ;
+                pParent = static_cast<internal_node *>( pLeaf ) ;
+                bRightParent = bRightLeaf ;
+                res.guards.copy( search_result::Guard_updGrandParent, search_result::Guard_updParent ) ;
+                updGrandParent = updParent ;
+
+                // The update field of the parent is read before the child pointer
+                updParent = protect_update( res.guards, search_result::Guard_updParent, pParent->m_pUpdate ) ;
+
+                bRightLeaf = dir( *pParent ) ;
+                pLeaf = res.guards.protect( search_result::Guard_Leaf, pParent->child( bRightLeaf )) ;
+
+                // The leaf is safely guarded only if pParent has not been removed from the tree:
+                // an internal node can be removed only after its marking
+                if ( pParent->m_pUpdate.load( memory_model::memory_order_acquire ).bits() == update_desc::Mark ) {
+                    help_marked_parent( res.guards, pGrandParent, pParent, bRightParent ) ;
+                    m_Stat.onSearchRetry() ;
+                    goto try_again ;
+                }
+            }
+
+            res.pGrandParent    = pGrandParent ;
+            res.pParent         = pParent ;
+            res.pLeaf           = pLeaf ;
+            res.updParent       = updParent ;
+            res.updGrandParent  = updGrandParent ;
+            res.bRightParent    = bRightParent ;
+            res.bRightLeaf      = bRightLeaf ;
+        }
+
+        void help_marked_parent( guard_array& guards, internal_node * pGrandParent, internal_node * pParent, bool bRightParent ) const
+        {
+            assert( pGrandParent != null_ptr<internal_node *>() ) ;    // the root is never marked
+
+            update_ptr updParent = protect_update( guards, search_result::Guard_updParent, pParent->m_pUpdate ) ;
+            assert( updParent.bits() == update_desc::Mark ) ;
+
+            // The descriptor is alive while pParent is in the tree, i.e. while the grandparent
+            // (that is not removed) points to pParent
+            if ( pGrandParent->child( bRightParent ).load( memory_model::memory_order_acquire ) == pParent
+                && pGrandParent->m_pUpdate.load( memory_model::memory_order_acquire ).bits() != update_desc::Mark )
+            {
+                m_Stat.onHelpMark() ;
+                help_marked( updParent.ptr() ) ;
+            }
+        }
+
+        // pOwner is guarded node that contains pUpdate in its m_pUpdate field;
+        // nAux1 and nAux2 are free guard slots
+        void help( update_ptr pUpdate, internal_node * pOwner, guard_array& guards, size_t nAux1, size_t nAux2 ) const
+        {
+            update_desc * pOp = pUpdate.ptr() ;
+            switch ( pUpdate.bits() ) {
+                case update_desc::IFlag:
+                    assert( pOp->iInfo.pParent == pOwner ) ;
+                    guards.assign( nAux1, pOp->iInfo.pLeaf ) ;
+                    if ( pOwner->m_pUpdate.load( memory_model::memory_order_acquire ) == pUpdate ) {
+                        m_Stat.onHelpInsert() ;
+                        help_insert( pOp ) ;
+                    }
+                    break;
+                case update_desc::DFlag:
+                    assert( pOp->dInfo.pGrandParent == pOwner ) ;
+                    guards.assign( nAux1, pOp->dInfo.pParent ) ;
+                    guards.assign( nAux2, pOp->dInfo.pUpdateParent ) ;
+                    // While pOwner is flagged the deleting thread keeps its guards, so pParent and
+                    // the expected update descriptor of pParent cannot be reused
+                    if ( pOwner->m_pUpdate.load( memory_model::memory_order_acquire ) == pUpdate ) {
+                        m_Stat.onHelpDelete() ;
+                        help_delete( pOp ) ;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        bool try_insert( value_type& val, internal_node * pNewInternal, search_result& res )
+        {
+            assert( res.updParent.bits() == update_desc::Clean ) ;
+
+            leaf_node * pNewLeaf = node_traits::to_node_ptr( val ) ;
+            tree_node * pLeaf = res.pLeaf ;
+
+            if ( pLeaf->infinite_key() || key_comparator()( val, *node_to_value( pLeaf )) < 0 ) {
+                // new leaf is the left child; the key of the internal node is the key of the leaf found
+                pNewInternal->infinite_key( pLeaf->infinite_key() ) ;
+                if ( pLeaf->infinite_key() == 0 )
+                    key_extractor()( pNewInternal->m_Key, *node_to_value( pLeaf )) ;
+                pNewInternal->m_pLeft.store( static_cast<tree_node *>( pNewLeaf ), memory_model::memory_order_relaxed ) ;
+                pNewInternal->m_pRight.store( pLeaf, memory_model::memory_order_release ) ;
+            }
+            else {
+                assert( key_comparator()( val, *node_to_value( pLeaf )) > 0 ) ;
+                pNewInternal->infinite_key( 0 ) ;
+                key_extractor()( pNewInternal->m_Key, val ) ;
+                pNewInternal->m_pLeft.store( pLeaf, memory_model::memory_order_relaxed ) ;
+                pNewInternal->m_pRight.store( static_cast<tree_node *>( pNewLeaf ), memory_model::memory_order_release ) ;
+            }
+
+            update_desc * pOp = alloc_update_desc() ;
+            pOp->iInfo.pParent = res.pParent ;
+            pOp->iInfo.pNew = pNewInternal ;
+            pOp->iInfo.pLeaf = pLeaf ;
+            pOp->iInfo.bRightLeaf = res.bRightLeaf ;
+
+            // the descriptor may be retired by another thread as soon as the operation is completed
+            res.guards.assign( search_result::Guard_temporary, pOp ) ;
+
+            update_ptr updCur( res.updParent.ptr() ) ;
+            if ( res.pParent->m_pUpdate.compare_exchange_strong( updCur, update_ptr( pOp, update_desc::IFlag ),
+                memory_model::memory_order_acq_rel, CDS_ATOMIC::memory_order_relaxed ))
+            {
+                if ( updCur.ptr() )
+                    retire_update_desc( updCur.ptr() ) ;
+                help_insert( pOp ) ;
+                return true ;
+            }
+
+            free_update_desc( pOp ) ;
+            return false ;
+        }
+
+        void help_insert( update_desc * pOp ) const
+        {
+            tree_node * pLeaf = pOp->iInfo.pLeaf ;
+            pOp->iInfo.pParent->child( pOp->iInfo.bRightLeaf ).compare_exchange_strong( pLeaf, static_cast<tree_node *>( pOp->iInfo.pNew ),
+                memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ) ;
+
+            update_ptr cur( pOp, update_desc::IFlag ) ;
+            pOp->iInfo.pParent->m_pUpdate.compare_exchange_strong( cur, update_ptr( pOp ),
+                memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ) ;
+        }
+
+        template <typename Direction, typename Accept, typename Func>
+        bool erase_( Direction dir, Accept accept, Func f )
+        {
+            search_result res ;
+            back_off bkoff ;
+
+            for ( ;; ) {
+                search_( res, dir ) ;
+                if ( !accept( res.pLeaf )) {
+                    m_Stat.onEraseFailed() ;
+                    return false ;
+                }
+
+                if ( res.updGrandParent.bits() != update_desc::Clean )
+                    help( res.updGrandParent, res.pGrandParent, res.guards, search_result::Guard_Leaf, search_result::Guard_updParent ) ;
+                else if ( res.updParent.bits() != update_desc::Clean )
+                    help( res.updParent, res.pParent, res.guards, search_result::Guard_Leaf, search_result::Guard_updGrandParent ) ;
+                else if ( try_delete( res )) {
+                    // the leaf is guarded, so it cannot be disposed while the functor is called
+                    cds::unref(f)( *node_to_value( res.pLeaf )) ;
+                    break ;
+                }
+
+                bkoff() ;
+                m_Stat.onEraseRetry() ;
+            }
+
+            --m_ItemCounter ;
+            m_Stat.onEraseSuccess() ;
+            return true ;
+        }
+
+        bool try_delete( search_result& res )
+        {
+            assert( res.pGrandParent != null_ptr<internal_node *>() ) ;
+            assert( res.updParent.bits() == update_desc::Clean ) ;
+            assert( res.updGrandParent.bits() == update_desc::Clean ) ;
+
+            update_desc * pOp = alloc_update_desc() ;
+            pOp->dInfo.pGrandParent = res.pGrandParent ;
+            pOp->dInfo.pParent = res.pParent ;
+            pOp->dInfo.pLeaf = res.pLeaf ;
+            pOp->dInfo.pUpdateParent = res.updParent.ptr() ;
+            pOp->dInfo.bRightParent = res.bRightParent ;
+            pOp->dInfo.bRightLeaf = res.bRightLeaf ;
+            pOp->dInfo.bDisposeLeaf = true ;
+
+            // the descriptor may be retired by another thread as soon as the operation is completed
+            res.guards.assign( search_result::Guard_temporary, pOp ) ;
+
+            update_ptr updGP( res.updGrandParent.ptr() ) ;
+            if ( res.pGrandParent->m_pUpdate.compare_exchange_strong( updGP, update_ptr( pOp, update_desc::DFlag ),
+                memory_model::memory_order_acq_rel, CDS_ATOMIC::memory_order_relaxed ))
+            {
+                if ( updGP.ptr() )
+                    retire_update_desc( updGP.ptr() ) ;
+                return help_delete( pOp ) ;
+            }
+
+            free_update_desc( pOp ) ;
+            return false ;
+        }
+
+        bool help_delete( update_desc * pOp ) const
+        {
+            update_ptr pUpdate( pOp->dInfo.pUpdateParent ) ;
+            update_ptr pMark( pOp, update_desc::Mark ) ;
+            if ( pOp->dInfo.pParent->m_pUpdate.compare_exchange_strong( pUpdate, pMark,
+                memory_model::memory_order_acq_rel, CDS_ATOMIC::memory_order_acquire ))
+            {
+                if ( pUpdate.ptr() )
+                    retire_update_desc( pUpdate.ptr() ) ;
+                help_marked( pOp ) ;
+                return true ;
+            }
+            else if ( pUpdate == pMark ) {
+                // some other thread has marked the parent
+                help_marked( pOp ) ;
+                return true ;
+            }
+
+            // The parent has been changed by another operation; backtrack: clean the grandparent
+            update_ptr pDel( pOp, update_desc::DFlag ) ;
+            pOp->dInfo.pGrandParent->m_pUpdate.compare_exchange_strong( pDel, update_ptr( pOp ),
+                memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ) ;
+            m_Stat.onHelpBacktrack() ;
+            return false ;
+        }
+
+        void help_marked( update_desc * pOp ) const
+        {
+            internal_node * pParent = pOp->dInfo.pParent ;
+
+            // The children of the marked node are never changed
+            tree_node * pOther = pParent->child( !pOp->dInfo.bRightLeaf ).load( memory_model::memory_order_acquire ) ;
+
+            tree_node * pExpected = pParent ;
+            if ( pOp->dInfo.pGrandParent->child( pOp->dInfo.bRightParent ).compare_exchange_strong( pExpected, pOther,
+                memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ))
+            {
+                retire_node( pParent ) ;
+                if ( pOp->dInfo.bDisposeLeaf )
+                    retire_leaf( pOp->dInfo.pLeaf ) ;
+            }
+
+            update_ptr pDel( pOp, update_desc::DFlag ) ;
+            pOp->dInfo.pGrandParent->m_pUpdate.compare_exchange_strong( pDel, update_ptr( pOp ),
+                memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ) ;
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool find_( Q& val, Compare cmp, Func f )
+        {
+            search_result res ;
+            if ( search( res, val, cmp )) {
+                cds::unref(f)( *node_to_value( res.pLeaf ), val ) ;
+                m_Stat.onFindSuccess() ;
+                return true ;
+            }
+
+            m_Stat.onFindFailed() ;
+            return false ;
+        }
+        //@endcond
+    };
+
+}} // namespace cds::intrusive
+
+#endif // #ifndef __CDS_INTRUSIVE_ELLEN_BINTREE_IMPL_H
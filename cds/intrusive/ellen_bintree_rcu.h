@@ -0,0 +1,1089 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_INTRUSIVE_ELLEN_BINTREE_RCU_H
+#define __CDS_INTRUSIVE_ELLEN_BINTREE_RCU_H
+
+#include <cds/intrusive/ellen_bintree_base.h>
+#include <cds/gc/details/retired_batch.h>
+#include <cds/urcu/details/check_deadlock.h>
+#include <cds/opt/compare.h>
+#include <cds/ref.h>
+#include <cds/details/std/type_traits.h>
+#include <cds/details/std/memory.h>
+
+namespace cds { namespace intrusive {
+
+    /// Ellen's et al binary search tree (template specialization for \ref cds_urcu_desc "RCU")
+    /** @ingroup cds_intrusive_map
+        @ingroup cds_intrusive_tree
+        @anchor cds_intrusive_EllenBinTree_rcu
+
+        Source:
+            - [2010] F.Ellen, P.Fatourou, E.Ruppert, F.van Breugel "Non-blocking Binary Search Tree"
+
+        See \ref cds_intrusive_EllenBinTree "EllenBinTree" for the algorithm description and for the list of options.
+        The RCU specialization has the same interface with the following differences:
+        - all functions lock RCU internally. The internal nodes and the update descriptors displaced by an operation
+            are passed to RCU after unlocking; if the caller holds RCU lock, they are deferred until the next
+            operation called outside of RCU read-side critical section;
+        - the functions that dispose the item (\p erase, \p unlink, \p clear and \p extract_min / \p extract_max
+            with a functor) must be called outside of RCU lock, the check is performed by opt::rcu_check_deadlock policy;
+        - \ref get, \ref extract, \p extract_min() and \p extract_max() without arguments
+            require RCU to be locked by the caller; the item extracted is not disposed.
+
+        Unlike the hazard pointer version, the search does not restart on the nodes being removed,
+        so the readers never write shared memory.
+
+        Template arguments:
+        - \p RCU - one of \ref cds_urcu_gc "RCU type"
+        - \p Key - key type, a subset of \p T
+        - \p T - type to be stored in tree's leaf nodes, see \ref cds_intrusive_EllenBinTree "EllenBinTree"
+        - \p Traits - type traits. See ellen_bintree::type_traits for explanation.
+
+        @note Before including <tt><cds/intrusive/ellen_bintree_rcu.h></tt> you should include appropriate RCU header file,
+        see \ref cds_urcu_gc "RCU type" for list of existing RCU class and corresponding header files.
+    */
+    template <
+        class RCU,
+        typename Key,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = ellen_bintree::type_traits
+#else
+        class Traits
+#endif
+    >
+    class EllenBinTree< cds::urcu::gc< RCU >, Key, T, Traits >
+    {
+    public:
+        typedef cds::urcu::gc< RCU >    gc          ;   ///< RCU garbage collector
+        typedef Key     key_type    ;   ///< type of a key stored in internal nodes; key is a part of \p value_type
+        typedef T       value_type  ;   ///< type of value stored in the tree
+        typedef Traits  options     ;   ///< Traits template parameter
+
+        typedef typename options::hook      hook        ;   ///< hook type
+        typedef typename hook::node_type    leaf_node   ;   ///< leaf node type (the hook)
+        typedef typename leaf_node::base_class  tree_node   ;   ///< base of leaf and internal nodes
+        typedef ellen_bintree::internal_node< key_type, leaf_node > internal_node   ;   ///< internal node type
+        typedef typename internal_node::update_desc_type    update_desc ;   ///< update descriptor type
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator  ;    ///< key compare functor based on opt::compare and opt::less option setter.
+#   else
+        typedef typename opt::details::make_comparator< value_type, options >::type key_comparator  ;
+#   endif
+
+        typedef typename options::disposer  disposer    ;   ///< leaf node disposer
+        typedef typename get_node_traits< value_type, leaf_node, hook>::type node_traits ;  ///< node traits
+        typedef typename options::key_extractor key_extractor   ;   ///< key extracting functor
+
+        typedef typename options::item_counter  item_counter    ;   ///< Item counting policy used
+        typedef typename options::memory_model  memory_model    ;   ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename options::allocator     allocator_type  ;   ///< Allocator for internal nodes and update descriptors
+        typedef typename options::back_off      back_off        ;   ///< Back-off strategy
+        typedef typename options::stat          stat            ;   ///< internal statistics type
+        typedef typename options::rcu_check_deadlock    rcu_check_deadlock ; ///< Deadlock checking policy
+
+        typedef typename gc::scoped_lock    rcu_lock ;  ///< RCU scoped lock
+
+    protected:
+        //@cond
+        typedef typename internal_node::update_ptr  update_ptr  ;
+        typedef cds::urcu::details::check_deadlock_policy< gc, rcu_check_deadlock>   check_deadlock_policy ;
+        typedef cds::gc::details::retired_batch< gc >   retired_batch ;
+
+        typedef ellen_bintree::details::node_allocators< allocator_type, internal_node, update_desc > node_allocators ;
+        typedef typename node_allocators::internal_node_allocator   cxx_internal_node_allocator ;
+        typedef typename node_allocators::update_desc_allocator     cxx_update_desc_allocator   ;
+        typedef typename node_allocators::internal_node_deleter     internal_node_deleter       ;
+        typedef typename node_allocators::update_desc_deleter       update_desc_deleter         ;
+
+        typedef std::unique_ptr< internal_node, internal_node_deleter >   unique_internal_node_ptr ;
+
+        // The retired pointers collected inside RCU lock by extract-like functions
+        struct deferred_batch {
+            retired_batch       batch   ;
+            deferred_batch *    pNext   ;
+        };
+        typedef cds::details::Allocator< deferred_batch, typename allocator_type::template rebind< deferred_batch >::other > cxx_deferred_allocator ;
+
+        struct search_result {
+            internal_node *     pGrandParent    ;
+            internal_node *     pParent         ;
+            tree_node *         pLeaf           ;
+            update_ptr          updParent       ;
+            update_ptr          updGrandParent  ;
+            bool                bRightLeaf      ;   // true if pLeaf is right child of pParent, false otherwise
+            bool                bRightParent    ;   // true if pParent is right child of pGrandParent, false otherwise
+
+            search_result()
+                : pGrandParent( null_ptr<internal_node *>() )
+                , pParent( null_ptr<internal_node *>() )
+                , pLeaf( null_ptr<tree_node *>() )
+                , bRightLeaf( false )
+                , bRightParent( false )
+            {}
+        };
+
+        template <typename Q, typename Compare>
+        struct key_acceptor {
+            Q const&    m_Key   ;
+            Compare     m_Cmp   ;
+
+            key_acceptor( Q const& key, Compare cmp )
+                : m_Key( key )
+                , m_Cmp( cmp )
+            {}
+
+            bool operator()( tree_node * pLeaf ) const
+            {
+                return pLeaf->infinite_key() == 0 && m_Cmp( m_Key, *node_to_value( pLeaf )) == 0 ;
+            }
+        };
+
+        struct node_acceptor {
+            tree_node const *   m_pNode ;
+
+            explicit node_acceptor( leaf_node const * pNode )
+                : m_pNode( pNode )
+            {}
+
+            bool operator()( tree_node * pLeaf ) const
+            {
+                return pLeaf == m_pNode ;
+            }
+        };
+
+        struct regular_leaf_acceptor {
+            bool operator()( tree_node * pLeaf ) const
+            {
+                return pLeaf->infinite_key() == 0 ;
+            }
+        };
+
+        struct empty_insert_functor {
+            void operator()( value_type& )
+            {}
+        };
+
+        struct empty_erase_functor  {
+            void operator()( value_type& )
+            {}
+        };
+
+        struct empty_find_functor {
+            template <typename Q>
+            void operator()( value_type&, Q& )
+            {}
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        internal_node       m_Root      ;   ///< Tree root node (key= Infinite2)
+        leaf_node           m_LeafInf1  ;   ///< Infinite leaf 1 (key= Infinite1)
+        leaf_node           m_LeafInf2  ;   ///< Infinite leaf 2 (key= Infinite2)
+
+        item_counter        m_ItemCounter   ;   ///< item counter
+        mutable stat        m_Stat          ;   ///< internal statistics
+
+        CDS_ATOMIC::atomic< deferred_batch *>   m_pDeferred ;   ///< Retired pointers deferred by the functions called inside RCU lock
+        //@endcond
+
+    public:
+        /// Default constructor
+        EllenBinTree()
+            : m_pDeferred( null_ptr<deferred_batch *>() )
+        {
+            static_assert( (!std::is_same< key_extractor, opt::none >::value), "The key extractor option must be specified" ) ;
+            make_empty_tree() ;
+        }
+
+        /// Clears the tree
+        /**
+            The destructor is not thread-safe: no concurrent access to the tree is allowed.
+            The \ref disposer is called for each item in the tree.
+        */
+        ~EllenBinTree()
+        {
+            unsafe_clear() ;
+            flush_deferred() ;
+        }
+
+        /// Inserts new node
+        /**
+            The function inserts \p val in the tree if it does not contain
+            an item with key equal to \p val.
+
+            The function locks RCU internally.
+
+            Returns \p true if \p val is placed into the tree, \p false otherwise.
+        */
+        bool insert( value_type& val )
+        {
+            return insert( val, empty_insert_functor() ) ;
+        }
+
+        /// Inserts new node
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree "EllenBinTree::insert( value_type&, Func )".
+            The functor \p f is called under RCU lock.
+        */
+        template <typename Func>
+        bool insert( value_type& val, Func f )
+        {
+            retired_batch retired ;
+            bool bRet ;
+            {
+                rcu_lock l ;
+                bRet = insert_( val, f, retired ) ;
+            }
+            dispose( retired ) ;
+            return bRet ;
+        }
+
+        /// Ensures that the \p val exists in the tree
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree "EllenBinTree::ensure".
+            The functor \p func is called under RCU lock.
+
+            Returns std::pair<bool, bool> where \p first is \p true if operation is successfull,
+            \p second is \p true if new item has been added or \p false if the item with \p key
+            already is in the tree.
+        */
+        template <typename Func>
+        std::pair<bool, bool> ensure( value_type& val, Func func )
+        {
+            retired_batch retired ;
+            std::pair<bool, bool> bRet ;
+            {
+                rcu_lock l ;
+                bRet = ensure_( val, func, retired ) ;
+            }
+            dispose( retired ) ;
+            return bRet ;
+        }
+
+        /// Unlinks the item \p val from the tree
+        /**
+            The function searches the item \p val in the tree and unlink it from the tree
+            if it is found and is equal to \p val.
+
+            The \ref disposer specified in \p Traits class template parameter is called
+            by RCU garbage collector. RCU \p synchronize method can be called,
+            so the function must be called outside of RCU lock.
+            The function can throw cds::urcu::rcu_deadlock exception if deadlock is encountered and
+            deadlock checking policy is opt::v::rcu_throw_deadlock.
+
+            The function returns \p true if success and \p false otherwise.
+        */
+        bool unlink( value_type& val )
+        {
+            return erase_( ellen_bintree::details::key_direction< value_type, key_comparator, internal_node >( val, key_comparator() ),
+                node_acceptor( node_traits::to_node_ptr( val )),
+                empty_erase_functor() ) ;
+        }
+
+        /// Deletes the item from the tree
+        /** \anchor cds_intrusive_EllenBinTree_rcu_erase
+            The function searches an item with key equal to \p val in the tree,
+            unlinks it from the tree, and returns \p true.
+            If the item with key equal to \p val is not found the function return \p false.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        template <typename Q>
+        bool erase( const Q& val )
+        {
+            return erase_( ellen_bintree::details::key_direction< Q, key_comparator, internal_node >( val, key_comparator() ),
+                key_acceptor< Q, key_comparator >( val, key_comparator() ),
+                empty_erase_functor() ) ;
+        }
+
+        /// Delete the item from the tree with comparing functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_erase "erase(Q const&)"
+            but \p pred predicate is used for key comparing.
+            \p Less has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the tree.
+        */
+        template <typename Q, typename Less>
+        bool erase_with( const Q& val, Less pred )
+        {
+            typedef cds::opt::details::make_comparator_from_less<Less> compare_functor ;
+            return erase_( ellen_bintree::details::key_direction< Q, compare_functor, internal_node >( val, compare_functor() ),
+                key_acceptor< Q, compare_functor >( val, compare_functor() ),
+                empty_erase_functor() ) ;
+        }
+
+        /// Deletes the item from the tree
+        /** \anchor cds_intrusive_EllenBinTree_rcu_erase_func
+            The function searches an item with key equal to \p val in the tree,
+            call \p f functor with item found, unlinks it from the tree, and returns \p true.
+            The functor is called under RCU lock:
+            \code
+            struct functor {
+                void operator()( value_type& item ) ;
+            };
+            \endcode
+
+            If the item with key equal to \p val is not found the function return \p false.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        template <typename Q, typename Func>
+        bool erase( Q const& val, Func f )
+        {
+            return erase_( ellen_bintree::details::key_direction< Q, key_comparator, internal_node >( val, key_comparator() ),
+                key_acceptor< Q, key_comparator >( val, key_comparator() ),
+                f ) ;
+        }
+
+        /// Delete the item from the tree with comparing functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_erase_func "erase(Q const&, Func)"
+            but \p pred predicate is used for key comparing.
+        */
+        template <typename Q, typename Less, typename Func>
+        bool erase_with( Q const& val, Less pred, Func f )
+        {
+            typedef cds::opt::details::make_comparator_from_less<Less> compare_functor ;
+            return erase_( ellen_bintree::details::key_direction< Q, compare_functor, internal_node >( val, compare_functor() ),
+                key_acceptor< Q, compare_functor >( val, compare_functor() ),
+                f ) ;
+        }
+
+        /// Extracts an item with minimal key from the tree and disposes it
+        /**
+            The function unlinks the leftmost item, calls the functor \p f for it under RCU lock,
+            and passes the item to RCU for disposing:
+            \code
+            struct functor {
+                void operator()( value_type& item ) ;
+            };
+            \endcode
+            If the tree is empty the function returns \p false.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        template <typename Func>
+        bool extract_min( Func f )
+        {
+            return erase_( ellen_bintree::details::min_direction< internal_node >(), regular_leaf_acceptor(), f ) ;
+        }
+
+        /// Extracts an item with maximal key from the tree and disposes it
+        /**
+            The function is an analog of \ref extract_min(Func) for the rightmost item.
+        */
+        template <typename Func>
+        bool extract_max( Func f )
+        {
+            return erase_( ellen_bintree::details::max_direction< internal_node >(), regular_leaf_acceptor(), f ) ;
+        }
+
+        /// Extracts an item with minimal key from the tree
+        /**
+            The function unlinks the leftmost item and returns a pointer to it.
+            If the tree is empty the function returns \p NULL.
+
+            @note The function does NOT dispose the item found. The caller should lock RCU before calling
+            of the function, and should synchronize RCU outside the RCU lock region before reusing returned pointer.
+            See \ref cds_intrusive_LazyList_rcu_extract "LazyList::extract" for an example.
+
+            @note Due the concurrent nature of the tree, the function extracts <i>nearly</i> minimum key.
+            It means that the function gets leftmost leaf of the tree and tries to unlink it.
+            During unlinking, a concurrent thread may insert an item with key less than leftmost item's key.
+        */
+        value_type * extract_min()
+        {
+            return extract_( ellen_bintree::details::min_direction< internal_node >(), regular_leaf_acceptor() ) ;
+        }
+
+        /// Extracts an item with maximal key from the tree
+        /**
+            The function is an analog of \ref extract_min() for the rightmost item.
+            RCU should be locked by the caller.
+        */
+        value_type * extract_max()
+        {
+            return extract_( ellen_bintree::details::max_direction< internal_node >(), regular_leaf_acceptor() ) ;
+        }
+
+        /// Extracts an item from the tree
+        /** \anchor cds_intrusive_EllenBinTree_rcu_extract
+            The function searches an item with key equal to \p val in the tree,
+            unlinks it, and returns pointer to an item found.
+            If the item with the key equal to \p val is not found the function returns \p NULL.
+
+            @note The function does NOT dispose the item found. RCU should be locked by the caller,
+            the returned pointer may be reused only after RCU synchronization.
+        */
+        template <typename Q>
+        value_type * extract( Q const& val )
+        {
+            return extract_( ellen_bintree::details::key_direction< Q, key_comparator, internal_node >( val, key_comparator() ),
+                key_acceptor< Q, key_comparator >( val, key_comparator() )) ;
+        }
+
+        /// Extracts an item from the tree using \p pred for searching
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_extract "extract(Q const&)"
+            but \p pred is used for key compare.
+        */
+        template <typename Q, typename Less>
+        value_type * extract_with( Q const& val, Less pred )
+        {
+            typedef cds::opt::details::make_comparator_from_less<Less> compare_functor ;
+            return extract_( ellen_bintree::details::key_direction< Q, compare_functor, internal_node >( val, compare_functor() ),
+                key_acceptor< Q, compare_functor >( val, compare_functor() )) ;
+        }
+
+        /// Finds the key \p val
+        /** @anchor cds_intrusive_EllenBinTree_rcu_find_val
+            The function searches the item with key equal to \p val
+            and returns \p true if it is found, and \p false otherwise.
+
+            The function applies RCU lock internally.
+        */
+        template <typename Q>
+        bool find( Q const& val ) const
+        {
+            return find_( val, key_comparator(), empty_find_functor() ) ;
+        }
+
+        /// Finds the key \p val with comparing functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_find_val "find(Q const&)"
+            but \p pred is used for key compare.
+        */
+        template <typename Q, typename Less>
+        bool find_with( Q const& val, Less pred ) const
+        {
+            return find_( val, cds::opt::details::make_comparator_from_less<Less>(), empty_find_functor() ) ;
+        }
+
+        /// Finds the key \p val
+        /** @anchor cds_intrusive_EllenBinTree_rcu_find_func
+            The function searches the item with key equal to \p val and calls the functor \p f for the item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item, Q& val ) ;
+            };
+            \endcode
+            where \p item is the item found, \p val is the <tt>find</tt> function argument.
+
+            The functor is called under RCU lock.
+            The functor can change non-key fields of \p item; the functor does not serialize simultaneous access
+            to the tree \p item.
+
+            The function returns \p true if \p val is found, \p false otherwise.
+        */
+        template <typename Q, typename Func>
+        bool find( Q& val, Func f ) const
+        {
+            return find_( val, key_comparator(), f ) ;
+        }
+
+        /// Finds the key \p val with comparing functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_find_func "find(Q&, Func)"
+            but \p pred is used for key comparison.
+        */
+        template <typename Q, typename Less, typename Func>
+        bool find_with( Q& val, Less pred, Func f ) const
+        {
+            return find_( val, cds::opt::details::make_comparator_from_less<Less>(), f ) ;
+        }
+
+        /// Finds the key \p val
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_find_func "find(Q&, Func)"
+            for const argument \p val.
+        */
+        template <typename Q, typename Func>
+        bool find( Q const& val, Func f ) const
+        {
+            return find_( val, key_comparator(), f ) ;
+        }
+
+        /// Finds the key \p val with comparing functor \p pred
+        template <typename Q, typename Less, typename Func>
+        bool find_with( Q const& val, Less pred, Func f ) const
+        {
+            return find_( val, cds::opt::details::make_comparator_from_less<Less>(), f ) ;
+        }
+
+        /// Finds the key \p val and returns the item found
+        /** \anchor cds_intrusive_EllenBinTree_rcu_get
+            The function searches the item with key equal to \p val and returns the pointer to item found.
+            If \p val is not found it returns \p NULL.
+
+            RCU should be locked before call the function.
+            Returned pointer is valid while RCU is locked.
+        */
+        template <typename Q>
+        value_type * get( Q const& val ) const
+        {
+            return get_( val, key_comparator() ) ;
+        }
+
+        /// Finds the key \p val with comparing functor \p pred and returns the item found
+        /**
+            The function is an analog of \ref cds_intrusive_EllenBinTree_rcu_get "get(Q const&)"
+            but \p pred is used for comparing the keys.
+        */
+        template <typename Q, typename Less>
+        value_type * get_with( Q const& val, Less pred ) const
+        {
+            return get_( val, cds::opt::details::make_comparator_from_less<Less>() ) ;
+        }
+
+        /// Checks if the tree is empty
+        bool empty() const
+        {
+            return m_Root.m_pLeft.load( memory_model::memory_order_relaxed )->is_leaf() ;
+        }
+
+        /// Returns item count in the tree
+        /**
+            Only leaf nodes containing user data are counted.
+
+            The value returned depends on item counter type provided by \p Traits template parameter.
+            If it is atomicity::empty_item_counter this function always returns 0.
+            Therefore, the function is not suitable for checking the tree emptiness, use \ref empty
+            member function for this purpose.
+        */
+        size_t size() const
+        {
+            return m_ItemCounter ;
+        }
+
+        /// Clears the tree (thread safe, non-atomic)
+        /**
+            The function unlinks all items from the tree by \ref extract_min(Func).
+            For each leaf the \ref disposer will be called after unlinking.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        void clear()
+        {
+            while ( extract_min( empty_erase_functor() )) ;
+        }
+
+        /// Clears the tree (not thread safe)
+        /**
+            This function is not thread safe and may be called only when no other thread deals with the tree.
+            The function is used in the tree destructor.
+        */
+        void unsafe_clear()
+        {
+            tree_node * pNode = m_Root.m_pLeft.load( memory_model::memory_order_relaxed ) ;
+            while ( pNode->is_internal() ) {
+                internal_node * pParent = static_cast<internal_node *>( pNode ) ;
+                tree_node * pLeft = pParent->m_pLeft.load( memory_model::memory_order_relaxed ) ;
+                if ( pLeft->is_internal() ) {
+                    // rotate right
+                    internal_node * pLeftInternal = static_cast<internal_node *>( pLeft ) ;
+                    pParent->m_pLeft.store( pLeftInternal->m_pRight.load( memory_model::memory_order_relaxed ), memory_model::memory_order_relaxed ) ;
+                    pLeftInternal->m_pRight.store( pParent, memory_model::memory_order_relaxed ) ;
+                    pNode = pLeftInternal ;
+                }
+                else {
+                    pNode = pParent->m_pRight.load( memory_model::memory_order_relaxed ) ;
+                    if ( pLeft->infinite_key() == 0 )
+                        disposer()( node_to_value( pLeft )) ;
+                    free_internal_node( pParent ) ;
+                }
+            }
+            if ( pNode->infinite_key() == 0 )
+                disposer()( node_to_value( pNode )) ;
+
+            free_update_desc( m_Root.m_pUpdate.load( memory_model::memory_order_relaxed ).ptr() ) ;
+            m_ItemCounter.reset() ;
+            make_empty_tree() ;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat ;
+        }
+
+    protected:
+        //@cond
+        void make_empty_tree()
+        {
+            m_Root.infinite_key( 2 ) ;
+            m_LeafInf1.infinite_key( 1 ) ;
+            m_LeafInf2.infinite_key( 2 ) ;
+            m_Root.m_pLeft.store( &m_LeafInf1, memory_model::memory_order_relaxed ) ;
+            m_Root.m_pRight.store( &m_LeafInf2, memory_model::memory_order_relaxed ) ;
+            m_Root.m_pUpdate.store( update_ptr(), memory_model::memory_order_release ) ;
+        }
+
+        static value_type * node_to_value( tree_node * pNode )
+        {
+            assert( pNode->is_leaf() && pNode->infinite_key() == 0 ) ;
+            return node_traits::to_value_ptr( static_cast<leaf_node *>( pNode )) ;
+        }
+
+        internal_node * alloc_internal_node() const
+        {
+            m_Stat.onInternalNodeCreated() ;
+            return cxx_internal_node_allocator().New() ;
+        }
+
+        void free_internal_node( internal_node * pNode ) const
+        {
+            update_desc * pDesc = pNode->m_pUpdate.load( memory_model::memory_order_relaxed ).ptr() ;
+            if ( pDesc )
+                free_update_desc( pDesc ) ;
+            cxx_internal_node_allocator().Delete( pNode ) ;
+            m_Stat.onInternalNodeDeleted() ;
+        }
+
+        update_desc * alloc_update_desc() const
+        {
+            m_Stat.onUpdateDescCreated() ;
+            return cxx_update_desc_allocator().New() ;
+        }
+
+        void free_update_desc( update_desc * pDesc ) const
+        {
+            if ( pDesc ) {
+                cxx_update_desc_allocator().Delete( pDesc ) ;
+                m_Stat.onUpdateDescDeleted() ;
+            }
+        }
+
+        void retire_node( internal_node * pNode, retired_batch& retired ) const
+        {
+            m_Stat.onInternalNodeDeleted() ;
+            retired.template push< internal_node_deleter >( pNode ) ;
+        }
+
+        static void retire_leaf( tree_node * pLeaf, retired_batch& retired )
+        {
+            retired.template push< disposer >( node_to_value( pLeaf )) ;
+        }
+
+        void retire_update_desc( update_desc * pDesc, retired_batch& retired ) const
+        {
+            // The descriptor is retired when it is displaced from its owner node by a new operation
+            m_Stat.onUpdateDescDeleted() ;
+            retired.template push< update_desc_deleter >( pDesc ) ;
+        }
+
+        // Passes the retired pointers to RCU or defers them if RCU is locked by the caller
+        void dispose( retired_batch& retired )
+        {
+            if ( gc::is_locked() ) {
+                if ( !retired.empty() ) {
+                    deferred_batch * pDeferred = cxx_deferred_allocator().New() ;
+                    pDeferred->batch.swap( retired ) ;
+
+                    deferred_batch * pHead = m_pDeferred.load( memory_model::memory_order_relaxed ) ;
+                    do {
+                        pDeferred->pNext = pHead ;
+                    } while ( !m_pDeferred.compare_exchange_weak( pHead, pDeferred, memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed )) ;
+                }
+            }
+            else {
+                retired.retire() ;
+                flush_deferred() ;
+            }
+        }
+
+        void flush_deferred()
+        {
+            assert( !gc::is_locked() ) ;
+
+            if ( m_pDeferred.load( memory_model::memory_order_relaxed ) != null_ptr<deferred_batch *>() ) {
+                deferred_batch * pDeferred = m_pDeferred.exchange( null_ptr<deferred_batch *>(), memory_model::memory_order_acquire ) ;
+                while ( pDeferred ) {
+                    deferred_batch * pNext = pDeferred->pNext ;
+                    pDeferred->batch.retire() ;
+                    cxx_deferred_allocator().Delete( pDeferred ) ;
+                    pDeferred = pNext ;
+                }
+            }
+        }
+
+        template <typename Q, typename Compare>
+        bool search( search_result& res, Q const& val, Compare cmp ) const
+        {
+            search_( res, ellen_bintree::details::key_direction< Q, Compare, internal_node >( val, cmp )) ;
+            return key_acceptor< Q, Compare >( val, cmp )( res.pLeaf ) ;
+        }
+
+        // RCU should be locked
+        template <typename Direction>
+        void search_( search_result& res, Direction dir ) const
+        {
+            assert( gc::is_locked() ) ;
+
+            internal_node * pParent         = null_ptr<internal_node *>() ;
+            internal_node * pGrandParent    = null_ptr<internal_node *>() ;
+            update_ptr      updParent       ;
+            update_ptr      updGrandParent  ;
+            bool            bRightLeaf      = false ;
+            bool            bRightParent    = false ;
+
+            tree_node * pLeaf = const_cast<internal_node *>( &m_Root ) ;
+            while ( pLeaf->is_internal() ) {
+                pGrandParent = pParent ;
+                pParent = static_cast<internal_node *>( pLeaf ) ;
+                bRightParent = bRightLeaf ;
+                updGrandParent = updParent ;
+
+                // The update field of the parent is read before the child pointer
+                updParent = pParent->m_pUpdate.load( memory_model::memory_order_acquire ) ;
+
+                bRightLeaf = dir( *pParent ) ;
+                pLeaf = pParent->child( bRightLeaf ).load( memory_model::memory_order_acquire ) ;
+            }
+
+            res.pGrandParent    = pGrandParent ;
+            res.pParent         = pParent ;
+            res.pLeaf           = pLeaf ;
+            res.updParent       = updParent ;
+            res.updGrandParent  = updGrandParent ;
+            res.bRightParent    = bRightParent ;
+            res.bRightLeaf      = bRightLeaf ;
+        }
+
+        void help( update_ptr pUpdate, retired_batch& retired ) const
+        {
+            switch ( pUpdate.bits() ) {
+                case update_desc::IFlag:
+                    m_Stat.onHelpInsert() ;
+                    help_insert( pUpdate.ptr() ) ;
+                    break;
+                case update_desc::DFlag:
+                    m_Stat.onHelpDelete() ;
+                    help_delete( pUpdate.ptr(), retired ) ;
+                    break;
+                case update_desc::Mark:
+                    m_Stat.onHelpMark() ;
+                    help_marked( pUpdate.ptr(), retired ) ;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        template <typename Func>
+        bool insert_( value_type& val, Func f, retired_batch& retired )
+        {
+            unique_internal_node_ptr pNewInternal ;
+            search_result res ;
+            back_off bkoff ;
+
+            for ( ;; ) {
+                if ( search( res, val, key_comparator() )) {
+                    if ( pNewInternal.get() )
+                        m_Stat.onInternalNodeDeleted() ;    // unique_internal_node_ptr deletes the node
+                    m_Stat.onInsertFailed() ;
+                    return false ;
+                }
+
+                if ( res.updParent.bits() != update_desc::Clean )
+                    help( res.updParent, retired ) ;
+                else {
+                    if ( !pNewInternal.get() )
+                        pNewInternal.reset( alloc_internal_node() ) ;
+
+                    if ( try_insert( val, pNewInternal.get(), res, retired )) {
+                        cds::unref(f)( val ) ;
+                        pNewInternal.release()  ;   // internal node is linked into the tree
+                        break ;
+                    }
+                }
+
+                bkoff() ;
+                m_Stat.onInsertRetry() ;
+            }
+
+            ++m_ItemCounter ;
+            m_Stat.onInsertSuccess() ;
+            return true ;
+        }
+
+        template <typename Func>
+        std::pair<bool, bool> ensure_( value_type& val, Func func, retired_batch& retired )
+        {
+            unique_internal_node_ptr pNewInternal ;
+            search_result res ;
+            back_off bkoff ;
+
+            for ( ;; ) {
+                if ( search( res, val, key_comparator() )) {
+                    cds::unref(func)( false, *node_to_value( res.pLeaf ), val ) ;
+                    if ( pNewInternal.get() )
+                        m_Stat.onInternalNodeDeleted() ;    // unique_internal_node_ptr deletes the node
+                    m_Stat.onEnsureExist() ;
+                    return std::make_pair( true, false ) ;
+                }
+
+                if ( res.updParent.bits() != update_desc::Clean )
+                    help( res.updParent, retired ) ;
+                else {
+                    if ( !pNewInternal.get() )
+                        pNewInternal.reset( alloc_internal_node() ) ;
+
+                    if ( try_insert( val, pNewInternal.get(), res, retired )) {
+                        cds::unref(func)( true, val, val ) ;
+                        pNewInternal.release()  ;   // internal node is linked into the tree
+                        break ;
+                    }
+                }
+
+                bkoff() ;
+                m_Stat.onEnsureRetry() ;
+            }
+
+            ++m_ItemCounter ;
+            m_Stat.onEnsureNew() ;
+            return std::make_pair( true, true ) ;
+        }
+
+        bool try_insert( value_type& val, internal_node * pNewInternal, search_result& res, retired_batch& retired )
+        {
+            assert( res.updParent.bits() == update_desc::Clean ) ;
+
+            leaf_node * pNewLeaf = node_traits::to_node_ptr( val ) ;
+            tree_node * pLeaf = res.pLeaf ;
+
+            if ( pLeaf->infinite_key() || key_comparator()( val, *node_to_value( pLeaf )) < 0 ) {
+                // new leaf is the left child; the key of the internal node is the key of the leaf found
+                pNewInternal->infinite_key( pLeaf->infinite_key() ) ;
+                if ( pLeaf->infinite_key() == 0 )
+                    key_extractor()( pNewInternal->m_Key, *node_to_value( pLeaf )) ;
+                pNewInternal->m_pLeft.store( static_cast<tree_node *>( pNewLeaf ), memory_model::memory_order_relaxed ) ;
+                pNewInternal->m_pRight.store( pLeaf, memory_model::memory_order_release ) ;
+            }
+            else {
+                assert( key_comparator()( val, *node_to_value( pLeaf )) > 0 ) ;
+                pNewInternal->infinite_key( 0 ) ;
+                key_extractor()( pNewInternal->m_Key, val ) ;
+                pNewInternal->m_pLeft.store( pLeaf, memory_model::memory_order_relaxed ) ;
+                pNewInternal->m_pRight.store( static_cast<tree_node *>( pNewLeaf ), memory_model::memory_order_release ) ;
+            }
+
+            update_desc * pOp = alloc_update_desc() ;
+            pOp->iInfo.pParent = res.pParent ;
+            pOp->iInfo.pNew = pNewInternal ;
+            pOp->iInfo.pLeaf = pLeaf ;
+            pOp->iInfo.bRightLeaf = res.bRightLeaf ;
+
+            update_ptr updCur( res.updParent.ptr() ) ;
+            if ( res.pParent->m_pUpdate.compare_exchange_strong( updCur, update_ptr( pOp, update_desc::IFlag ),
+                memory_model::memory_order_acq_rel, CDS_ATOMIC::memory_order_relaxed ))
+            {
+                if ( updCur.ptr() )
+                    retire_update_desc( updCur.ptr(), retired ) ;
+                help_insert( pOp ) ;
+                return true ;
+            }
+
+            free_update_desc( pOp ) ;
+            return false ;
+        }
+
+        void help_insert( update_desc * pOp ) const
+        {
+            tree_node * pLeaf = pOp->iInfo.pLeaf ;
+            pOp->iInfo.pParent->child( pOp->iInfo.bRightLeaf ).compare_exchange_strong( pLeaf, static_cast<tree_node *>( pOp->iInfo.pNew ),
+                memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ) ;
+
+            update_ptr cur( pOp, update_desc::IFlag ) ;
+            pOp->iInfo.pParent->m_pUpdate.compare_exchange_strong( cur, update_ptr( pOp ),
+                memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ) ;
+        }
+
+        template <typename Direction, typename Accept, typename Func>
+        bool erase_( Direction dir, Accept accept, Func f )
+        {
+            check_deadlock_policy::check() ;
+
+            retired_batch retired ;
+            bool bRet ;
+            {
+                rcu_lock l ;
+                tree_node * pLeaf = remove_( dir, accept, true, retired ) ;
+                if ( pLeaf ) {
+                    cds::unref(f)( *node_to_value( pLeaf )) ;
+                    bRet = true ;
+                }
+                else
+                    bRet = false ;
+            }
+            dispose( retired ) ;
+            return bRet ;
+        }
+
+        template <typename Direction, typename Accept>
+        value_type * extract_( Direction dir, Accept accept )
+        {
+            assert( gc::is_locked() ) ;
+
+            retired_batch retired ;
+            tree_node * pLeaf = remove_( dir, accept, false, retired ) ;
+            dispose( retired ) ;
+            return pLeaf ? node_to_value( pLeaf ) : null_ptr<value_type *>() ;
+        }
+
+        // RCU should be locked. Returns the leaf removed or NULL
+        template <typename Direction, typename Accept>
+        tree_node * remove_( Direction dir, Accept accept, bool bDisposeLeaf, retired_batch& retired )
+        {
+            assert( gc::is_locked() ) ;
+
+            search_result res ;
+            back_off bkoff ;
+
+            for ( ;; ) {
+                search_( res, dir ) ;
+                if ( !accept( res.pLeaf )) {
+                    m_Stat.onEraseFailed() ;
+                    return null_ptr<tree_node *>() ;
+                }
+
+                if ( res.updGrandParent.bits() != update_desc::Clean )
+                    help( res.updGrandParent, retired ) ;
+                else if ( res.updParent.bits() != update_desc::Clean )
+                    help( res.updParent, retired ) ;
+                else if ( try_delete( res, bDisposeLeaf, retired ))
+                    break ;
+
+                bkoff() ;
+                m_Stat.onEraseRetry() ;
+            }
+
+            --m_ItemCounter ;
+            m_Stat.onEraseSuccess() ;
+            return res.pLeaf ;
+        }
+
+        bool try_delete( search_result& res, bool bDisposeLeaf, retired_batch& retired )
+        {
+            assert( res.pGrandParent != null_ptr<internal_node *>() ) ;
+            assert( res.updParent.bits() == update_desc::Clean ) ;
+            assert( res.updGrandParent.bits() == update_desc::Clean ) ;
+
+            update_desc * pOp = alloc_update_desc() ;
+            pOp->dInfo.pGrandParent = res.pGrandParent ;
+            pOp->dInfo.pParent = res.pParent ;
+            pOp->dInfo.pLeaf = res.pLeaf ;
+            pOp->dInfo.pUpdateParent = res.updParent.ptr() ;
+            pOp->dInfo.bRightParent = res.bRightParent ;
+            pOp->dInfo.bRightLeaf = res.bRightLeaf ;
+            pOp->dInfo.bDisposeLeaf = bDisposeLeaf ;
+
+            update_ptr updGP( res.updGrandParent.ptr() ) ;
+            if ( res.pGrandParent->m_pUpdate.compare_exchange_strong( updGP, update_ptr( pOp, update_desc::DFlag ),
+                memory_model::memory_order_acq_rel, CDS_ATOMIC::memory_order_relaxed ))
+            {
+                if ( updGP.ptr() )
+                    retire_update_desc( updGP.ptr(), retired ) ;
+                return help_delete( pOp, retired ) ;
+            }
+
+            free_update_desc( pOp ) ;
+            return false ;
+        }
+
+        bool help_delete( update_desc * pOp, retired_batch& retired ) const
+        {
+            update_ptr pUpdate( pOp->dInfo.pUpdateParent ) ;
+            update_ptr pMark( pOp, update_desc::Mark ) ;
+            if ( pOp->dInfo.pParent->m_pUpdate.compare_exchange_strong( pUpdate, pMark,
+                memory_model::memory_order_acq_rel, CDS_ATOMIC::memory_order_acquire ))
+            {
+                if ( pUpdate.ptr() )
+                    retire_update_desc( pUpdate.ptr(), retired ) ;
+                help_marked( pOp, retired ) ;
+                return true ;
+            }
+            else if ( pUpdate == pMark ) {
+                // some other thread has marked the parent
+                help_marked( pOp, retired ) ;
+                return true ;
+            }
+
+            // The parent has been changed by another operation; help it and backtrack
+            help( pUpdate, retired ) ;
+            update_ptr pDel( pOp, update_desc::DFlag ) ;
+            pOp->dInfo.pGrandParent->m_pUpdate.compare_exchange_strong( pDel, update_ptr( pOp ),
+                memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ) ;
+            m_Stat.onHelpBacktrack() ;
+            return false ;
+        }
+
+        void help_marked( update_desc * pOp, retired_batch& retired ) const
+        {
+            internal_node * pParent = pOp->dInfo.pParent ;
+
+            // The children of the marked node are never changed
+            tree_node * pOther = pParent->child( !pOp->dInfo.bRightLeaf ).load( memory_model::memory_order_acquire ) ;
+
+            tree_node * pExpected = pParent ;
+            if ( pOp->dInfo.pGrandParent->child( pOp->dInfo.bRightParent ).compare_exchange_strong( pExpected, pOther,
+                memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ))
+            {
+                retire_node( pParent, retired ) ;
+                if ( pOp->dInfo.bDisposeLeaf )
+                    retire_leaf( pOp->dInfo.pLeaf, retired ) ;
+            }
+
+            update_ptr pDel( pOp, update_desc::DFlag ) ;
+            pOp->dInfo.pGrandParent->m_pUpdate.compare_exchange_strong( pDel, update_ptr( pOp ),
+                memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ) ;
+        }
+
+        template <typename Q, typename Compare, typename Func>
+        bool find_( Q& val, Compare cmp, Func f ) const
+        {
+            rcu_lock l ;
+            search_result res ;
+            if ( search( res, val, cmp )) {
+                cds::unref(f)( *node_to_value( res.pLeaf ), val ) ;
+                m_Stat.onFindSuccess() ;
+                return true ;
+            }
+
+            m_Stat.onFindFailed() ;
+            return false ;
+        }
+
+        template <typename Q, typename Compare>
+        value_type * get_( Q const& val, Compare cmp ) const
+        {
+            assert( gc::is_locked() ) ;
+
+            search_result res ;
+            if ( search( res, val, cmp )) {
+                m_Stat.onFindSuccess() ;
+                return node_to_value( res.pLeaf ) ;
+            }
+
+            m_Stat.onFindFailed() ;
+            return null_ptr<value_type *>() ;
+        }
+        //@endcond
+    };
+
+}} // namespace cds::intrusive
+
+#endif // #ifndef __CDS_INTRUSIVE_ELLEN_BINTREE_RCU_H
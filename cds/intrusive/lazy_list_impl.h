@@ -13,6 +13,8 @@
 #define __CDS_INTRUSIVE_LAZY_LIST_IMPL_H
 
 #include <cds/intrusive/lazy_list_base.h>
+#include <cds/gc/details/retired_batch.h>
+#include <cds/gc/guarded_ptr.h>
 
 namespace cds { namespace intrusive {
 
@@ -204,6 +206,8 @@ namespace cds { namespace intrusive {
         typedef typename options::item_counter item_counter ;   ///< Item counting policy used
         typedef typename options::memory_model  memory_model;   ///< C++ memory ordering (see lazy_list::type_traits::memory_model)
 
+        typedef cds::gc::guarded_ptr< gc, value_type > guarded_ptr ; ///< Guarded pointer, see \ref get and \ref extract
+
         //@cond
         // Rebind options (split-list support)
         template <CDS_DECL_OPTIONS8>
@@ -683,6 +687,82 @@ namespace cds { namespace intrusive {
             return erase_at( head(), val, cds::opt::details::make_comparator_from_less<Less>(), func )    ;
         }
 
+        /// Extracts the item from the list with specified \p key
+        /** \anchor cds_intrusive_LazyList_hp_extract
+            The function searches an item with key equal to \p key,
+            unlinks it from the list, and returns it in \p dest parameter.
+            If the item with key equal to \p key is not found the function returns \p false.
+
+            Note the compare functor should accept a parameter of type \p Q that can be not the same as \p value_type.
+
+            The \ref disposer specified in \p Traits class template parameter is called automatically
+            by garbage collector \p GC when returned \ref guarded_ptr object will be destroyed or released.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+
+            Usage:
+            \code
+            typedef cds::intrusive::LazyList< cds::gc::PTB, foo, my_traits >  ord_list ;
+            ord_list theList ;
+            // ...
+            {
+                ord_list::guarded_ptr gp ;
+                if ( theList.extract( gp, 5 )) {
+                    // Deal with gp
+                    // ...
+                }
+                // Destructor of gp releases internal guard
+            }
+            \endcode
+        */
+        template <typename Q>
+        bool extract( guarded_ptr& dest, Q const& key )
+        {
+            return extract_at( head(), dest.guard(), key, key_comparator() ) ;
+        }
+
+        /// Extracts the item from the list with comparing functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_LazyList_hp_extract "extract(guarded_ptr&, Q const&)"
+            but \p pred predicate is used for key comparing.
+
+            \p Less functor has the semantics like \p std::less but should take arguments of type \ref value_type and \p Q
+            in any order.
+            \p pred must imply the same element order as the comparator used for building the list.
+        */
+        template <typename Q, typename Less>
+        bool extract_with( guarded_ptr& dest, Q const& key, Less pred )
+        {
+            return extract_at( head(), dest.guard(), key, cds::opt::details::make_comparator_from_less<Less>() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Extracts the item with specified \p key and returns the guarded pointer to it
+        /**
+            The function is an analog of \ref cds_intrusive_LazyList_hp_extract "extract(guarded_ptr&, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr extract( Q const& key )
+        {
+            guarded_ptr gp ;
+            extract( gp, key ) ;
+            return gp ;
+        }
+
+        /// Extracts the item using \p pred predicate and returns the guarded pointer to it
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr extract_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            extract_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Finds the key \p val
         /** \anchor cds_intrusive_LazyList_hp_find
             The function searches the item with key equal to \p val and calls the functor \p f for item found.
@@ -784,11 +864,86 @@ namespace cds { namespace intrusive {
             return find_at( head(), val, cds::opt::details::make_comparator_from_less<Less>() )  ;
         }
 
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /** \anchor cds_intrusive_LazyList_hp_get
+            The function searches the item with key equal to \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if \p key is found, and \p false otherwise.
+            If \p key is not found the \p ptr parameter is not changed.
+
+            The item found is not copied and it is not locked, the guarded pointer
+            only prevents the item from being disposed. The function does not serialize
+            simultaneous access to the item, you should provide your own synchronization schema
+            if the item can be changed by another thread.
+            @note Each \p guarded_ptr object uses one GC's guard which can be limited resource.
+
+            Note the compare functor specified for class \p Traits template parameter
+            should accept a parameter of type \p Q that can be not the same as \p value_type.
+        */
+        template <typename Q>
+        bool get( guarded_ptr& ptr, Q const& key )
+        {
+            return get_at( head(), ptr.guard(), key, key_comparator() ) ;
+        }
+
+        /// Finds the key \p key and returns the guarded pointer to the item found using \p pred predicate
+        /**
+            The function is an analog of \ref cds_intrusive_LazyList_hp_get "get( guarded_ptr& ptr, Q const&)"
+            but \p pred is used for comparing the keys.
+
+            \p Less functor has the semantics like \p std::less but should take arguments of type \ref value_type and \p Q
+            in any order.
+            \p pred must imply the same element order as the comparator used for building the list.
+        */
+        template <typename Q, typename Less>
+        bool get_with( guarded_ptr& ptr, Q const& key, Less pred )
+        {
+            return get_at( head(), ptr.guard(), key, cds::opt::details::make_comparator_from_less<Less>() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /**
+            The function is an analog of \ref cds_intrusive_LazyList_hp_get "get( guarded_ptr& ptr, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr get( Q const& key )
+        {
+            guarded_ptr gp ;
+            get( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the key \p key using \p pred predicate and returns the guarded pointer to the item found
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr get_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            get_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Clears the list
         /**
             The function unlink all items from the list.
+            The items unlinked are passed to the garbage collector by one \p retire_batch call.
         */
         void clear()
+        {
+            cds::gc::details::retired_batch< gc > batch ;
+            clear( batch )  ;
+            batch.retire()  ;
+        }
+
+        //@cond
+        // Unlinks all items from the list and places them into the batch. Used by MichaelHashSet::clear()
+        void clear( cds::gc::details::retired_batch< gc >& batch )
         {
             typename gc::Guard guard    ;
             marked_node_ptr h    ;
@@ -799,15 +954,21 @@ namespace cds { namespace intrusive {
                     head()->m_Lock.lock()       ;
                     h->m_Lock.lock()        ;
 
-                    unlink_node( head(), h.ptr() ) ;
+                    bool bUnlinked = head()->m_pNext.load(memory_model::memory_order_relaxed) == h ;
+                    if ( bUnlinked )
+                        unlink_node( head(), h.ptr() ) ;
 
                     h->m_Lock.unlock()      ;
                     head()->m_Lock.unlock()     ;
 
-                    retire_node( h.ptr() ) ; // free node
+                    if ( bUnlinked ) {
+                        --m_ItemCounter ;
+                        batch.template push<clean_disposer>( node_traits::to_value_ptr( *h.ptr() )) ;
+                    }
                 }
             }
         }
+        //@endcond
 
         /// Checks if the list is empty
         bool empty() const
@@ -1017,6 +1178,38 @@ namespace cds { namespace intrusive {
 #       endif
         }
 
+        template <typename Q, typename Compare>
+        bool extract_at( node_type * pHead, typename gc::Guard& dest, Q const& val, Compare cmp )
+        {
+            position pos    ;
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            if ( erase_at( pHead, val, cmp, [](value_type const &){}, pos )) {
+#       else
+            if ( erase_at( pHead, val, cmp, empty_erase_functor(), pos )) {
+#       endif
+                // The node unlinked is still guarded by pos.guards
+                dest.assign( node_traits::to_value_ptr( *pos.pCur ) ) ;
+                return true ;
+            }
+            return false    ;
+        }
+
+        template <typename Q, typename Compare>
+        bool get_at( node_type * pHead, typename gc::Guard& guard, Q const& val, Compare cmp )
+        {
+            position pos    ;
+
+            search( pHead, val, pos, cmp )   ;
+            if ( pos.pCur != tail()
+                && !pos.pCur->is_marked()
+                && cmp( *node_traits::to_value_ptr( *pos.pCur ), val ) == 0 )
+            {
+                guard.assign( node_traits::to_value_ptr( *pos.pCur ) ) ;
+                return true ;
+            }
+            return false    ;
+        }
+
         template <typename Q, typename Compare, typename Func>
         bool find_at( node_type * pHead, Q& val, Compare cmp, Func f )
         {
@@ -15,6 +15,7 @@
 #include <cds/intrusive/lazy_list_base.h>
 #include <cds/urcu/details/check_deadlock.h>
 #include <cds/details/binary_functor_wrapper.h>
+#include <cds/gc/details/retired_batch.h>
 
 namespace cds { namespace intrusive {
     namespace lazy_list {
@@ -790,35 +791,53 @@ namespace cds { namespace intrusive {
 
             The function can throw cds::urcu::rcu_deadlock exception if deadlock is encountered and
             deadlock checking policy is opt::v::rcu_throw_deadlock.
+
+            The items unlinked are retired by one \p retire_batch call, so RCU \p synchronize
+            is called at most once for whole list.
         */
         void clear()
         {
             if( !empty() ) {
                 check_deadlock_policy::check() ;
 
-                node_type * pHead ;
-                for (;;) {
-                    {
-                        rcu_lock l ;
-                        pHead = m_Head.m_pNext.load(memory_model::memory_order_acquire).ptr() ;
-                        if ( pHead == &m_Tail )
-                            break;
+                cds::gc::details::retired_batch< gc > batch ;
+                clear( batch )  ;
+                batch.retire()  ;
+            }
+        }
+
+        //@cond
+        // Unlinks all items from the list and places them into the batch. Used by MichaelHashSet::clear()
+        // The caller should retire the batch outside of RCU critical section
+        void clear( cds::gc::details::retired_batch< gc >& batch )
+        {
+            node_type * pHead ;
+            for (;;) {
+                bool bUnlinked ;
+                {
+                    rcu_lock l ;
+                    pHead = m_Head.m_pNext.load(memory_model::memory_order_acquire).ptr() ;
+                    if ( pHead == &m_Tail )
+                        break;
 
-                        m_Head.m_Lock.lock()  ;
-                        pHead->m_Lock.lock()   ;
+                    m_Head.m_Lock.lock()  ;
+                    pHead->m_Lock.lock()   ;
 
-                        if ( m_Head.m_pNext.load(memory_model::memory_order_relaxed).all() == pHead )
-                            unlink_node( &m_Head, pHead ) ;
+                    bUnlinked = m_Head.m_pNext.load(memory_model::memory_order_relaxed).all() == pHead ;
+                    if ( bUnlinked )
+                        unlink_node( &m_Head, pHead ) ;
 
-                        pHead->m_Lock.unlock()  ;
-                        m_Head.m_Lock.unlock() ;
-                    }
+                    pHead->m_Lock.unlock()  ;
+                    m_Head.m_Lock.unlock() ;
+                }
 
+                if ( bUnlinked ) {
                     --m_ItemCounter ;
-                    dispose_node( pHead )    ;
+                    batch.template push<clear_and_dispose>( node_traits::to_value_ptr( *pHead )) ;
                 }
             }
         }
+        //@endcond
 
         /// Checks if the list is empty
         bool empty() const
@@ -13,6 +13,8 @@
 #define __CDS_INTRUSIVE_MICHAEL_LIST_IMPL_H
 
 #include <cds/intrusive/michael_list_base.h>
+#include <cds/gc/details/retired_batch.h>
+#include <cds/gc/guarded_ptr.h>
 
 namespace cds { namespace intrusive {
 
@@ -207,6 +209,8 @@ namespace cds { namespace intrusive {
         typedef typename options::item_counter item_counter ;   ///< Item counting policy used
         typedef typename options::memory_model  memory_model;   ///< Memory ordering. See cds::opt::memory_model option
 
+        typedef cds::gc::guarded_ptr< gc, value_type > guarded_ptr ; ///< Guarded pointer, see \ref get and \ref extract
+
         //@cond
         // Rebind options (split-list support)
         template <CDS_DECL_OPTIONS7>
@@ -243,6 +247,11 @@ namespace cds { namespace intrusive {
             void operator()( value_type const & item )
             {}
         };
+
+        struct empty_insert_functor {
+            void operator()( value_type& )
+            {}
+        };
 #   endif
 
         struct clean_disposer {
@@ -522,6 +531,102 @@ namespace cds { namespace intrusive {
             return insert_at( m_pHead, val, f )    ;
         }
 
+        /// Insert hint (finger) for the sequence of inserting
+        /**
+            The hint keeps the node inserted (or found) by the previous
+            \ref insert( insert_hint&, value_type& ) "insert" call.
+            The next insert with the same hint starts the search from that node
+            if its key is less than the key of new item, so inserting the keys in ascending
+            (or nearly ascending) order does not traverse the list from the head each time.
+
+            The hint is not thread-safe, each thread should use its own hint object.
+            If the hint node has been deleted by concurrent thread the search starts from the head
+            of the list. So, the hint affects only the performance, not the correctness.
+
+            The hint holds one guard (hazard pointer) while it is alive.
+        */
+        class insert_hint
+        {
+            //@cond
+            friend class MichaelList ;
+
+            typename gc::Guard  m_Guard ;
+            node_type *         m_pNode ;
+            //@endcond
+
+        public:
+            /// Creates empty hint
+            insert_hint()
+                : m_pNode( null_ptr<node_type *>() )
+            {}
+
+            /// Resets the hint and releases the guard
+            void reset()
+            {
+                m_Guard.clear() ;
+                m_pNode = null_ptr<node_type *>() ;
+            }
+
+            /// Checks if the hint contains a node
+            bool valid() const
+            {
+                return m_pNode != null_ptr<node_type *>() ;
+            }
+        };
+
+        /// Inserts new node using the insert hint
+        /**
+            The function is the same as \ref insert( value_type& ) but the search of
+            the insert position begins from the node stored in \p hint by previous call.
+            After the call \p hint contains \p val (if inserted) or the item with key equal to \p val
+            (if \p val is not inserted).
+
+            Returns \p true if \p val is linked into the list, \p false otherwise.
+        */
+        bool insert( insert_hint& hint, value_type& val )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return insert_at( m_pHead, hint, val, []( value_type& ) {} )    ;
+#       else
+            return insert_at( m_pHead, hint, val, empty_insert_functor() )    ;
+#       endif
+        }
+
+        /// Inserts new node using the insert hint
+        /**
+            The function is the same as \ref insert( value_type&, Func ) but the search of
+            the insert position begins from the node stored in \p hint by previous call.
+        */
+        template <typename Func>
+        bool insert( insert_hint& hint, value_type& val, Func f )
+        {
+            return insert_at( m_pHead, hint, val, f )    ;
+        }
+
+        /// Inserts the sequence of items
+        /**
+            The function inserts the items from the range [\p first, \p last) in the list
+            using \ref insert_hint. The function is intended for the ranges sorted in
+            ascending order of keys (or nearly sorted): in that case each insert continues
+            the search from the previous item instead of the head of the list.
+            Unsorted ranges are allowed too but there is no performance gain for them.
+
+            \p Iterator should dereference to <tt>value_type&</tt>.
+
+            Returns the number of items inserted.
+        */
+        template <typename Iterator>
+        size_t insert_sorted( Iterator first, Iterator last )
+        {
+            insert_hint hint ;
+            size_t nCount = 0 ;
+            for ( ; first != last; ++first ) {
+                if ( insert( hint, *first ))
+                    ++nCount ;
+            }
+            return nCount ;
+        }
+
         /// Ensures that the \p item exists in the list
         /**
             The operation performs inserting or changing data with lock-free manner.
@@ -629,6 +734,90 @@ namespace cds { namespace intrusive {
             return erase_at( m_pHead, val, cds::opt::details::make_comparator_from_less<Less>(), f )  ;
         }
 
+        /// Extracts the item from the list with specified \p key
+        /** \anchor cds_intrusive_MichaelList_hp_extract
+            The function searches an item with key equal to \p key,
+            unlinks it from the list, and returns it in \p dest parameter.
+            If the item with key equal to \p key is not found the function returns \p false.
+
+            Note the compare functor should accept a parameter of type \p Q that can be not the same as \p value_type.
+
+            The \ref disposer specified in \p Traits class template parameter is called automatically
+            by garbage collector \p GC specified in class' template parameters when returned \ref guarded_ptr object
+            will be destroyed or released.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+
+            Usage:
+            \code
+            typedef cds::intrusive::MichaelList< cds::gc::HP, foo, my_traits >  ord_list ;
+            ord_list theList ;
+            // ...
+            {
+                ord_list::guarded_ptr gp ;
+                theList.extract( gp, 5 ) ;
+                // Deal with gp
+                // ...
+
+                // Destructor of gp releases internal HP guard
+            }
+            \endcode
+        */
+        template <typename Q>
+        bool extract( guarded_ptr& dest, Q const& key )
+        {
+            return extract_at( m_pHead, dest.guard(), key, key_comparator() ) ;
+        }
+
+        /// Extracts the item using compare functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_MichaelList_hp_extract "extract(guarded_ptr&, Q const&)"
+            but \p pred predicate is used for key comparing.
+
+            \p Less functor has the semantics like \p std::less but should take arguments of type \ref value_type and \p Q
+            in any order.
+            \p pred must imply the same element order as the comparator used for building the list.
+        */
+        template <typename Q, typename Less>
+        bool extract_with( guarded_ptr& dest, Q const& key, Less pred )
+        {
+            return extract_at( m_pHead, dest.guard(), key, cds::opt::details::make_comparator_from_less<Less>() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Extracts the item with specified \p key and returns the guarded pointer to it
+        /**
+            The function is an analog of \ref cds_intrusive_MichaelList_hp_extract "extract(guarded_ptr&, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            \code
+            ord_list::guarded_ptr gp( theList.extract( 5 )) ;
+            if ( !gp.empty() ) {
+                // Deal with gp
+            }
+            \endcode
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr extract( Q const& key )
+        {
+            guarded_ptr gp ;
+            extract( gp, key ) ;
+            return gp ;
+        }
+
+        /// Extracts the item using \p pred predicate and returns the guarded pointer to it
+        /**
+            The function is an analog of \ref extract(Q const&) but \p pred predicate is used for key comparing.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr extract_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            extract_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Finds the key \p val
         /** \anchor cds_intrusive_MichaelList_hp_find_func
             The function searches the item with key equal to \p val and calls the functor \p f for item found.
@@ -734,11 +923,102 @@ namespace cds { namespace intrusive {
             return find_at( m_pHead, val, cds::opt::details::make_comparator_from_less<Less>() )  ;
         }
 
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /** \anchor cds_intrusive_MichaelList_hp_get
+            The function searches the item with key equal to \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if \p key is found, and \p false otherwise.
+            If \p key is not found the \p ptr parameter is not changed.
+
+            The \ref disposer specified in \p Traits class template parameter is called
+            by garbage collector \p GC automatically when returned \ref guarded_ptr object
+            will be destroyed or released.
+            @note Each \p guarded_ptr object uses one GC's guard which can be limited resource.
+
+            Usage:
+            \code
+            typedef cds::intrusive::MichaelList< cds::gc::HP, foo, my_traits >  ord_list ;
+            ord_list theList ;
+            // ...
+            {
+                ord_list::guarded_ptr gp ;
+                if ( theList.get( gp, 5 )) {
+                    // Deal with gp
+                    //...
+                }
+                // Destructor of guarded_ptr releases internal HP guard
+            }
+            \endcode
+
+            Note the compare functor specified for \p Traits template parameter
+            should accept a parameter of type \p Q that can be not the same as \p value_type.
+        */
+        template <typename Q>
+        bool get( guarded_ptr& ptr, Q const& key )
+        {
+            return get_at( m_pHead, ptr.guard(), key, key_comparator() ) ;
+        }
+
+        /// Finds the key \p key and returns the guarded pointer to the item found using \p pred predicate
+        /**
+            The function is an analog of \ref cds_intrusive_MichaelList_hp_get "get( guarded_ptr& ptr, Q const&)"
+            but \p pred is used for comparing the keys.
+
+            \p Less functor has the semantics like \p std::less but should take arguments of type \ref value_type and \p Q
+            in any order.
+            \p pred must imply the same element order as the comparator used for building the list.
+        */
+        template <typename Q, typename Less>
+        bool get_with( guarded_ptr& ptr, Q const& key, Less pred )
+        {
+            return get_at( m_pHead, ptr.guard(), key, cds::opt::details::make_comparator_from_less<Less>() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /**
+            The function is an analog of \ref cds_intrusive_MichaelList_hp_get "get( guarded_ptr& ptr, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr get( Q const& key )
+        {
+            guarded_ptr gp ;
+            get( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the key \p key using \p pred predicate and returns the guarded pointer to the item found
+        /**
+            The function is an analog of \ref get(Q const&) but \p pred is used for comparing the keys.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr get_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            get_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Clears the list
         /**
             The function unlink all items from the list.
+            The items unlinked are passed to the garbage collector by one \p retire_batch call,
+            so the reclamation cycle is performed once for whole list.
         */
         void clear()
+        {
+            cds::gc::details::retired_batch< gc > batch ;
+            clear( batch )  ;
+            batch.retire()  ;
+        }
+
+        //@cond
+        // Unlinks all items from the list and places them into the batch. Used by MichaelHashSet::clear()
+        void clear( cds::gc::details::retired_batch< gc >& batch )
         {
             typename gc::Guard guard    ;
             marked_node_ptr head        ;
@@ -749,11 +1029,23 @@ namespace cds { namespace intrusive {
                 if ( m_pHead.load(memory_model::memory_order_acquire) == head ) {
                     if ( head.ptr() == null_ptr<node_type *>() )
                         break   ;
-                    value_type& val = *node_traits::to_value_ptr( *head.ptr() ) ;
-                    unlink( val )   ;
+
+                    // Mark the head node (logical deleting) unless it is marked by concurrent erase
+                    marked_node_ptr next = head->m_pNext.load(memory_model::memory_order_relaxed) ;
+                    if ( next.bits() == 0 ) {
+                        if ( !head->m_pNext.compare_exchange_weak( next, marked_node_ptr( next.ptr(), 1 ), memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ))
+                            continue ;
+                        --m_ItemCounter ;
+                    }
+
+                    // Physical deleting. If CAS fails the node is unlinked by another thread
+                    marked_node_ptr cur( head.ptr() ) ;
+                    if ( m_pHead.compare_exchange_strong( cur, marked_node_ptr( next.ptr() ), memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ))
+                        batch.template push<clean_disposer>( node_traits::to_value_ptr( *head.ptr() )) ;
                 }
             }
         }
+        //@endcond
 
         /// Checks if the list is empty
         bool empty() const
@@ -837,6 +1129,37 @@ namespace cds { namespace intrusive {
             }
         }
 
+        template <typename Func>
+        bool insert_at( atomic_node_ptr& refHead, insert_hint& hint, value_type& val, Func f )
+        {
+            node_type * pNode = node_traits::to_node_ptr( val ) ;
+            link_checker::is_empty( pNode ) ;
+            position pos    ;
+
+            typename gc::Guard guard ;
+            guard.assign( &val )    ;
+
+            while ( true ) {
+                if ( search( refHead, val, pos, key_comparator(), hint.m_pNode ) ) {
+                    // The item found is the best start node for the next hinted insert
+                    hint.m_Guard.assign( node_traits::to_value_ptr( pos.pCur )) ;
+                    hint.m_pNode = pos.pCur ;
+                    return false        ;
+                }
+
+                if ( link_node( pNode, pos ) ) {
+                    cds::unref(f)( val ) ;
+                    ++m_ItemCounter ;
+                    hint.m_Guard.copy( guard ) ;
+                    hint.m_pNode = pNode ;
+                    return true ;
+                }
+
+                // clear next field
+                pNode->m_pNext.store( marked_node_ptr(), memory_model::memory_order_relaxed )   ;
+            }
+        }
+
         template <typename Func>
         std::pair<bool, bool> ensure_at( atomic_node_ptr& refHead, value_type& val, Func func )
         {
@@ -922,6 +1245,24 @@ namespace cds { namespace intrusive {
 #       endif
         }
 
+        template <typename Q, typename Compare>
+        bool extract_at( atomic_node_ptr& refHead, typename gc::Guard& dest, Q const& val, Compare cmp )
+        {
+            position pos    ;
+            back_off bkoff  ;
+            while ( search( refHead, val, pos, cmp )) {
+                if ( unlink_node( pos ) ) {
+                    // pos.pCur is guarded by pos.guards until the function returns
+                    dest.assign( node_traits::to_value_ptr( *pos.pCur ) ) ;
+                    --m_ItemCounter ;
+                    return true ;
+                }
+                else
+                    bkoff()     ;
+            }
+            return false ;
+        }
+
         template <typename Q, typename Compare>
         bool find_at( atomic_node_ptr& refHead, Q const & val, Compare cmp )
         {
@@ -929,6 +1270,17 @@ namespace cds { namespace intrusive {
             return search( refHead, val, pos, cmp ) ;
         }
 
+        template <typename Q, typename Compare>
+        bool get_at( atomic_node_ptr& refHead, typename gc::Guard& guard, Q const& val, Compare cmp )
+        {
+            position pos    ;
+            if ( search( refHead, val, pos, cmp )) {
+                guard.assign( node_traits::to_value_ptr( *pos.pCur ) ) ;
+                return true ;
+            }
+            return false    ;
+        }
+
         template <typename Q, typename Compare, typename Func>
         bool find_at( atomic_node_ptr& refHead, Q& val, Compare cmp, Func f )
         {
@@ -945,8 +1297,10 @@ namespace cds { namespace intrusive {
     protected:
 
         //@cond
+        // If pHint is not NULL, the search starts from pHint node when it is possible.
+        // pHint should be guarded by the caller
         template <typename Q, typename Compare >
-        bool search( atomic_node_ptr& refHead, const Q& val, position& pos, Compare cmp )
+        bool search( atomic_node_ptr& refHead, const Q& val, position& pos, Compare cmp, node_type * pHint = null_ptr<node_type *>() )
         {
             atomic_node_ptr * pPrev ;
             marked_node_ptr pNext   ;
@@ -955,7 +1309,15 @@ namespace cds { namespace intrusive {
             back_off        bkoff   ;
 
 try_again:
-            pPrev = &refHead            ;
+            if ( pHint && !pHint->m_pNext.load(memory_model::memory_order_acquire).bits()
+                 && cmp( *node_traits::to_value_ptr( pHint ), val ) < 0 )
+            {
+                pPrev = &( pHint->m_pNext ) ;
+                pos.guards.assign( 2, node_traits::to_value_ptr( pHint ) ) ;
+            }
+            else
+                pPrev = &refHead        ;
+            pHint = null_ptr<node_type *>() ;   // if the search is failed, try again from the head
             pNext = null_ptr<node_type *>() ;
 
             pCur = pPrev->load(memory_model::memory_order_relaxed)   ;
@@ -15,6 +15,7 @@
 #include <cds/intrusive/michael_list_base.h>
 #include <cds/urcu/details/check_deadlock.h>
 #include <cds/details/binary_functor_wrapper.h>
+#include <cds/gc/details/retired_batch.h>
 
 namespace cds { namespace intrusive {
 
@@ -703,31 +704,45 @@ namespace cds { namespace intrusive {
 
             The function can throw cds::urcu::rcu_deadlock exception if an deadlock is encountered and
             deadlock checking policy is opt::v::rcu_throw_deadlock.
+
+            The items unlinked are retired by one \p retire_batch call, so RCU \p synchronize
+            is called at most once for whole list.
         */
         void clear()
         {
             if( !empty() ) {
                 check_deadlock_policy::check() ;
 
-                marked_node_ptr pHead ;
-                for (;;) {
-                    {
-                        rcu_lock l ;
-                        pHead = m_pHead.load(memory_model::memory_order_consume) ;
-                        if ( !pHead.ptr() )
-                            break;
-                        marked_node_ptr pNext( pHead->m_pNext.load(memory_model::memory_order_relaxed) ) ;
-                        if ( !pHead->m_pNext.compare_exchange_weak( pNext, pNext | 1, memory_model::memory_order_acquire, memory_model::memory_order_relaxed ))
-                            continue ;
-                        if ( !m_pHead.compare_exchange_weak( pHead, marked_node_ptr(pNext.ptr()), memory_model::memory_order_release, memory_model::memory_order_relaxed ))
-                            continue;
-                    }
+                cds::gc::details::retired_batch< gc > batch ;
+                clear( batch )  ;
+                batch.retire()  ;
+            }
+        }
 
-                    --m_ItemCounter ;
-                    dispose_node( pHead.ptr() )    ;
+        //@cond
+        // Unlinks all items from the list and places them into the batch. Used by MichaelHashSet::clear()
+        // The caller should retire the batch outside of RCU critical section
+        void clear( cds::gc::details::retired_batch< gc >& batch )
+        {
+            marked_node_ptr pHead ;
+            for (;;) {
+                {
+                    rcu_lock l ;
+                    pHead = m_pHead.load(memory_model::memory_order_consume) ;
+                    if ( !pHead.ptr() )
+                        break;
+                    marked_node_ptr pNext( pHead->m_pNext.load(memory_model::memory_order_relaxed) ) ;
+                    if ( !pHead->m_pNext.compare_exchange_weak( pNext, pNext | 1, memory_model::memory_order_acquire, memory_model::memory_order_relaxed ))
+                        continue ;
+                    if ( !m_pHead.compare_exchange_weak( pHead, marked_node_ptr(pNext.ptr()), memory_model::memory_order_release, memory_model::memory_order_relaxed ))
+                        continue;
                 }
+
+                --m_ItemCounter ;
+                batch.template push<clear_and_dispose>( node_traits::to_value_ptr( *pHead.ptr() )) ;
             }
         }
+        //@endcond
 
         /// Check if the list is empty
         bool empty() const
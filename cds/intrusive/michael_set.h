@@ -14,6 +14,7 @@
 
 #include <cds/intrusive/michael_set_base.h>
 #include <cds/details/allocator.h>
+#include <cds/gc/details/retired_batch.h>
 
 namespace cds { namespace intrusive {
 
@@ -239,6 +240,7 @@ namespace cds { namespace intrusive {
         /// Hash functor for \ref value_type and all its derivatives that you use
         typedef typename cds::opt::v::hash_selector< typename options::hash >::type   hash ;
         typedef typename options::item_counter          item_counter    ;   ///< Item counter type
+        typedef typename bucket_type::guarded_ptr       guarded_ptr     ;   ///< Guarded pointer, see \ref get and \ref extract
 
         /// Bucket table allocator
         typedef cds::details::Allocator< bucket_type, typename options::allocator >  bucket_table_allocator ;
@@ -551,6 +553,88 @@ namespace cds { namespace intrusive {
             return false    ;
         }
 
+        /// Extracts the item with specified \p key
+        /** \anchor cds_intrusive_MichaelHashSet_hp_extract
+            The function searches an item with key equal to \p key,
+            unlinks it from the set, and returns it in \p dest parameter.
+            If the item with key equal to \p key is not found the function returns \p false.
+
+            Note the compare functor should accept a parameter of type \p Q that may be not the same as \p value_type.
+
+            The \ref disposer specified in \p OrderedList class' template parameter is called automatically
+            by garbage collector \p GC when returned \ref guarded_ptr object will be destroyed or released.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+
+            Usage:
+            \code
+            typedef cds::intrusive::MichaelHashSet< your_template_args > michael_set ;
+            michael_set theSet ;
+            // ...
+            {
+                michael_set::guarded_ptr gp ;
+                if ( theSet.extract( gp, 5 )) {
+                    // Deal with gp
+                    // ...
+                }
+                // Destructor of gp releases internal HP guard
+            }
+            \endcode
+        */
+        template <typename Q>
+        bool extract( guarded_ptr& dest, Q const& key )
+        {
+            if ( bucket( key ).extract( dest, key )) {
+                --m_ItemCounter ;
+                return true ;
+            }
+            return false ;
+        }
+
+        /// Extracts the item using compare functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_MichaelHashSet_hp_extract "extract(guarded_ptr&, Q const&)"
+            but \p pred predicate is used for key comparing.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool extract_with( guarded_ptr& dest, Q const& key, Less pred )
+        {
+            if ( bucket( key ).extract_with( dest, key, pred )) {
+                --m_ItemCounter ;
+                return true ;
+            }
+            return false ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Extracts the item with specified \p key and returns the guarded pointer to it
+        /**
+            The function is an analog of \ref cds_intrusive_MichaelHashSet_hp_extract "extract(guarded_ptr&, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr extract( Q const& key )
+        {
+            guarded_ptr gp ;
+            extract( gp, key ) ;
+            return gp ;
+        }
+
+        /// Extracts the item using \p pred predicate and returns the guarded pointer to it
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr extract_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            extract_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Finds the key \p val
         /** \anchor cds_intrusive_MichaelHashSet_hp_find_func
             The function searches the item with key equal to \p val and calls the functor \p f for item found.
@@ -665,6 +749,66 @@ namespace cds { namespace intrusive {
             return bucket( val ).find_with( val, pred )  ;
         }
 
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /** \anchor cds_intrusive_MichaelHashSet_hp_get
+            The function searches the item with key equal to \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if \p key is found, and \p false otherwise.
+            If \p key is not found the \p ptr parameter is not changed.
+
+            The item is not copied: it stays in the set and the guard only prevents it from being disposed.
+            @note Each \p guarded_ptr object uses one GC's guard which can be limited resource.
+
+            Note the hash functor specified for class \p Traits template parameter
+            should accept a parameter of type \p Q that can be not the same as \p value_type.
+        */
+        template <typename Q>
+        bool get( guarded_ptr& ptr, Q const& key )
+        {
+            return bucket( key ).get( ptr, key ) ;
+        }
+
+        /// Finds the key \p key and returns the guarded pointer to the item found using \p pred predicate
+        /**
+            The function is an analog of \ref cds_intrusive_MichaelHashSet_hp_get "get( guarded_ptr& ptr, Q const&)"
+            but \p pred is used for comparing the keys.
+            \p Less functor has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool get_with( guarded_ptr& ptr, Q const& key, Less pred )
+        {
+            return bucket( key ).get_with( ptr, key, pred ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /**
+            The function is an analog of \ref cds_intrusive_MichaelHashSet_hp_get "get( guarded_ptr& ptr, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr get( Q const& key )
+        {
+            guarded_ptr gp ;
+            get( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the key \p key using \p pred predicate and returns the guarded pointer to the item found
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr get_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            get_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Clears the set (non-atomic)
         /**
             The function unlink all items from the set.
@@ -674,12 +818,16 @@ namespace cds { namespace intrusive {
             Therefore, \p clear may be used only for debugging purposes.
 
             For each item the \p disposer is called after unlinking.
+            The items of all buckets are passed to the garbage collector by one \p retire_batch call,
+            so the reclamation cycle is performed once for whole set.
         */
         void clear()
         {
+            cds::gc::details::retired_batch< gc > batch ;
             for ( size_t i = 0; i < bucket_count(); ++i )
-                m_Buckets[i].clear()  ;
+                m_Buckets[i].clear( batch )  ;
             m_ItemCounter.reset()   ;
+            batch.retire()  ;
         }
 
 
@@ -14,6 +14,7 @@
 
 #include <cds/intrusive/michael_set_base.h>
 #include <cds/details/allocator.h>
+#include <cds/gc/details/retired_batch.h>
 
 namespace cds { namespace intrusive {
 
@@ -559,12 +560,16 @@ namespace cds { namespace intrusive {
             Therefore, \p clear may be used only for debugging purposes.
 
             For each item the \p disposer is called after unlinking.
+            The items of all buckets are retired by one \p retire_batch call,
+            so RCU \p synchronize is called at most once for whole set.
         */
         void clear()
         {
+            cds::gc::details::retired_batch< gc > batch ;
             for ( size_t i = 0; i < bucket_count(); ++i )
-                m_Buckets[i].clear()  ;
+                m_Buckets[i].clear( batch )  ;
             m_ItemCounter.reset()   ;
+            batch.retire()  ;
         }
 
 
@@ -0,0 +1,618 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_INTRUSIVE_MSPRIORITY_QUEUE_H
+#define __CDS_INTRUSIVE_MSPRIORITY_QUEUE_H
+
+#include <cds/intrusive/base.h>
+#include <cds/lock/spinlock.h>
+#include <cds/os/thread.h>
+#include <cds/details/bounded_container.h>
+#include <cds/details/comparator.h>
+#include <cds/opt/buffer.h>
+#include <cds/opt/compare.h>
+#include <cds/backoff_strategy.h>
+#include <cds/ref.h>
+
+namespace cds { namespace intrusive {
+
+    /// MSPriorityQueue related definitions
+    /** @ingroup cds_intrusive_helper
+    */
+    namespace mspriority_queue {
+
+        /// MSPriorityQueue statistics
+        /**
+            Template argument \p Counter defines type of counter.
+            Default is cds::atomicity::event_counter.
+            You may use stronger type of counter like as cds::atomicity::item_counter,
+            or even integral type, for example, \p int.
+        */
+        template <typename Counter = cds::atomicity::event_counter>
+        struct stat {
+            typedef Counter   event_counter ; ///< Event counter type
+
+            event_counter   m_nPushCount            ;   ///< Count of success push operation
+            event_counter   m_nPopCount             ;   ///< Count of success pop operation
+            event_counter   m_nPushFailCount        ;   ///< Count of failed ("the queue is full") push operation
+            event_counter   m_nPopFailCount         ;   ///< Count of failed ("the queue is empty") pop operation
+            event_counter   m_nPushHeapifySwapCount ;   ///< Count of item swapping when heapifying in push
+            event_counter   m_nPopHeapifySwapCount  ;   ///< Count of item swapping when heapifying in pop
+
+            //@cond
+            void onPushSuccess()            { ++m_nPushCount            ;}
+            void onPopSuccess()             { ++m_nPopCount             ;}
+            void onPushFailed()             { ++m_nPushFailCount        ;}
+            void onPopFailed()              { ++m_nPopFailCount         ;}
+            void onPushHeapifySwap()        { ++m_nPushHeapifySwapCount ;}
+            void onPopHeapifySwap()         { ++m_nPopHeapifySwapCount  ;}
+            //@endcond
+        };
+
+        /// MSPriorityQueue empty statistics
+        struct empty_stat {
+            //@cond
+            void onPushSuccess()            const {}
+            void onPopSuccess()             const {}
+            void onPushFailed()             const {}
+            void onPopFailed()              const {}
+            void onPushHeapifySwap()        const {}
+            void onPopHeapifySwap()         const {}
+            //@endcond
+        };
+
+        /// MSPriorityQueue traits
+        struct type_traits {
+            /// Storage type
+            /**
+                The storage type for the heap array. Default is cds::opt::v::dynamic_buffer.
+
+                You may specify any type of buffer's value since at instantiation time
+                the \p buffer::rebind member metafunction is called to change type
+                of values stored in the buffer.
+            */
+            typedef opt::v::dynamic_buffer<void *>  buffer  ;
+
+            /// Priority compare functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+            */
+            typedef opt::none       compare ;
+
+            /// specifies binary predicate used for priority comparing.
+            /**
+                Default is \p std::less<T>.
+            */
+            typedef opt::none       less    ;
+
+            /// Type of mutual-exclusion lock
+            typedef cds::lock::Spin lock_type   ;
+
+            /// Back-off strategy
+            typedef backoff::yield  back_off    ;
+
+            /// Internal statistics
+            /**
+                Possible types: mspriority_queue::empty_stat (the default), mspriority_queue::stat
+                or any other with interface like \p %mspriority_queue::stat
+            */
+            typedef empty_stat      stat        ;
+        };
+
+        /// Metafunction converting option list to traits
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+
+            See \ref MSPriorityQueue, \ref type_traits, \ref cds::opt::make_options.
+        */
+        template <CDS_DECL_OPTIONS7>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, CDS_OPTIONS7 >::type
+                ,CDS_OPTIONS7
+            >::type   type ;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+
+            // Bit-reversal counter [Hunt et al.]
+            // The counter maps the count of items to the heap index of the last item.
+            // The indices of a heap level are issued in bit-reversed order,
+            // so consecutive insertions go to different subtrees and do not contend
+            // along the same path to the root.
+            class bit_reverse_counter
+            {
+                size_t  m_nCounter  ;
+                size_t  m_nReversed ;
+                int     m_nHighBit  ;
+
+                // Flips bit nBit of m_nReversed and returns the old value of the bit
+                bool flip( int nBit )
+                {
+                    size_t const nMask = size_t(1) << nBit ;
+                    bool const bOld = (m_nReversed & nMask) != 0 ;
+                    m_nReversed ^= nMask ;
+                    return bOld ;
+                }
+
+            public:
+                bit_reverse_counter()
+                    : m_nCounter(0)
+                    , m_nReversed(0)
+                    , m_nHighBit(-1)
+                {}
+
+                // Increments the counter and returns heap index of the new last item
+                size_t inc()
+                {
+                    ++m_nCounter ;
+                    int nBit ;
+                    for ( nBit = m_nHighBit - 1; nBit >= 0; --nBit ) {
+                        if ( !flip( nBit ))
+                            break ;
+                    }
+                    if ( nBit < 0 ) {
+                        // new heap level
+                        m_nReversed = m_nCounter ;
+                        ++m_nHighBit ;
+                    }
+                    return m_nReversed ;
+                }
+
+                // Returns heap index of the last item and decrements the counter
+                size_t dec()
+                {
+                    size_t const nRet = m_nReversed ;
+                    --m_nCounter ;
+                    int nBit ;
+                    for ( nBit = m_nHighBit - 1; nBit >= 0; --nBit ) {
+                        if ( flip( nBit ))
+                            break ;
+                    }
+                    if ( nBit < 0 ) {
+                        // the heap level becomes empty
+                        m_nReversed = m_nCounter ;
+                        --m_nHighBit ;
+                    }
+                    return nRet ;
+                }
+
+                size_t value() const
+                {
+                    return m_nCounter ;
+                }
+            };
+
+        } // namespace details
+        //@endcond
+
+    } // namespace mspriority_queue
+
+    /// Michael & Scott array-based lock-based concurrent priority queue heap
+    /** @ingroup cds_intrusive_queue
+        Source:
+            - [1996] G.Hunt, M.Michael, S. Parthasarathy, M.Scott
+                "An efficient algorithm for concurrent priority queue heaps"
+
+        \p %MSPriorityQueue augments the standard array-based heap data structure with
+        a mutual-exclusion lock on the heap's size and locks on each node in the heap.
+        Each node also has a tag that indicates whether
+        it is empty, valid, or in a transient state due to an update to the heap
+        by an inserting thread.
+        The algorithm allows concurrent insertions and deletions in opposite directions,
+        without risking deadlock and without the need for special server threads.
+        It also uses a "bit-reversal" technique to scatter accesses across the fringe
+        of the tree to reduce contention.
+        On large heaps the algorithm achieves significant performance improvements
+        over serialized single-lock algorithm, for various insertion/deletion
+        workloads. For small heaps it still performs well, but not as well as
+        single-lock algorithm.
+
+        The heap has fixed capacity that is defined by the buffer. It is a good choice
+        for bounded, cache-resident priority queues.
+
+        The priority queue is max-priority: \p pop() extracts the item with the greatest
+        priority according to the comparator. To get min-priority queue specify
+        reverse comparator, for example, <tt>std::greater<T></tt>.
+        Note that under concurrent \p pop() the order of extracted items is not strict:
+        the last item of the heap that is being moved to the root by one thread is invisible
+        for others for a short while, so another thread can extract an item with lower priority.
+        In quiescent state \p pop() always extracts the item with the greatest priority.
+
+        Template parameters:
+        - \p T - type to be stored in the queue. The priority is a part of \p T type.
+        - \p Traits - type traits. See mspriority_queue::type_traits for explanation.
+
+        It is possible to declare option-based queue with cds::intrusive::mspriority_queue::make_traits
+        metafunction instead of \p Traits template argument.
+        Template argument of the function \p Options is:
+        - opt::buffer - the buffer type for heap array. Possible type are: opt::v::static_buffer, opt::v::dynamic_buffer.
+            Default is \p %opt::v::dynamic_buffer.
+            You may specify any type of values for the buffer since at instantiation time
+            the \p buffer::rebind member metafunction is called to change the type of values stored in the buffer.
+        - opt::compare - priority compare functor. No default functor is provided.
+            If the option is not specified, the opt::less is used.
+        - opt::less - specifies binary predicate used for priority compare. Default is \p std::less<T>.
+        - opt::lock_type - lock type. Default is cds::lock::Spin.
+        - opt::back_off - back-off strategy. Default is cds::backoff::yield
+        - opt::stat - internal statistics. Available types: mspriority_queue::stat, mspriority_queue::empty_stat (the default)
+
+        The queue stores pointers to the items; it does not own them: \p pop() returns
+        the pointer to the extracted item and the caller is responsible for its destruction.
+    */
+    template <typename T, class Traits = mspriority_queue::type_traits >
+    class MSPriorityQueue: public cds::bounded_container
+    {
+    public:
+        typedef T           value_type  ;   ///< Value type stored in the queue
+        typedef Traits      options     ;   ///< Traits template parameter
+
+#   ifdef CDS_DOXYGEN_INVOKED
+        typedef implementation_defined key_comparator ;    ///< priority comparing functor based on opt::compare and opt::less option setter.
+#   else
+        typedef typename opt::details::make_comparator< value_type, options >::type key_comparator ;
+#   endif
+
+        typedef typename options::lock_type lock_type   ;   ///< heap's size lock type
+        typedef typename options::back_off  back_off    ;   ///< Back-off strategy
+        typedef typename options::stat      stat        ;   ///< internal statistics type
+
+    protected:
+        //@cond
+        typedef cds::OS::ThreadId   tag_type ;
+
+        enum tag_value {
+            Available   = -1,
+            Empty       = 0
+        };
+        //@endcond
+
+        //@cond
+        /// Heap item type
+        struct node {
+            value_type *        m_pVal  ;   ///< A value pointer
+            tag_type            m_nTag  ;   ///< A tag
+            mutable lock_type   m_Lock  ;   ///< Node-level lock
+
+            /// Creates empty node
+            node()
+                : m_pVal( null_ptr<value_type *>() )
+                , m_nTag( tag_type(Empty) )
+            {}
+
+            /// Lock the node
+            void lock()
+            {
+                m_Lock.lock()   ;
+            }
+
+            /// Unlock the node
+            void unlock()
+            {
+                m_Lock.unlock() ;
+            }
+        };
+        //@endcond
+
+    public:
+        typedef typename options::buffer::template rebind<node>::other   buffer_type ;   ///< Heap array buffer type
+
+    protected:
+        //@cond
+        typedef mspriority_queue::details::bit_reverse_counter  item_counter_type ;
+
+        struct empty_functor {
+            void operator()( value_type& ) const
+            {}
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        item_counter_type   m_ItemCounter   ;   ///< Item counter
+        mutable lock_type   m_Lock          ;   ///< Heap's size lock
+        buffer_type         m_Heap          ;   ///< Heap array
+        stat                m_Stat          ;   ///< internal statistics accumulator
+        //@endcond
+
+    public:
+        /// Constructs empty priority queue
+        /**
+            For cds::opt::v::static_buffer the \p nCapacity parameter is ignored.
+        */
+        MSPriorityQueue( size_t nCapacity )
+            : m_Heap( nCapacity )
+        {}
+
+        /// Clears priority queue and destructs the object
+        ~MSPriorityQueue()
+        {
+            clear() ;
+        }
+
+        /// Inserts a item into priority queue
+        /**
+            If the priority queue is full, the function returns \p false,
+            no item has been added.
+            Otherwise, the function inserts the pointer to \p val into the heap
+            and returns \p true.
+        */
+        bool push( value_type& val )
+        {
+            tag_type const curId = cds::OS::getCurrentThreadId() ;
+
+            // Insert new item at bottom of the heap
+            m_Lock.lock() ;
+            if ( m_ItemCounter.value() >= capacity() ) {
+                // the heap is full
+                m_Lock.unlock() ;
+                m_Stat.onPushFailed() ;
+                return false ;
+            }
+
+            size_t i = m_ItemCounter.inc() ;
+            assert( i <= capacity() ) ;
+            node& refNode = item( i ) ;
+            refNode.lock() ;
+            m_Lock.unlock() ;
+            refNode.m_pVal = &val ;
+            refNode.m_nTag = curId ;
+            refNode.unlock() ;
+
+            // Move item towards top of the heap while it has higher priority than parent
+            heapify_after_push( i, curId ) ;
+
+            m_Stat.onPushSuccess() ;
+            return true ;
+        }
+
+        /// Extracts item with high priority
+        /**
+            If the priority queue is empty, the function returns \p NULL.
+            Otherwise, it returns the item extracted.
+        */
+        value_type * pop()
+        {
+            m_Lock.lock() ;
+            if ( m_ItemCounter.value() == 0 ) {
+                // the heap is empty
+                m_Lock.unlock() ;
+                m_Stat.onPopFailed() ;
+                return null_ptr<value_type *>() ;
+            }
+            size_t nBottom = m_ItemCounter.dec() ;
+            assert( nBottom <= capacity() ) ;
+            assert( nBottom > 0 ) ;
+
+            node& refBottom = item( nBottom ) ;
+            refBottom.lock() ;
+            m_Lock.unlock() ;
+            refBottom.m_nTag = tag_type(Empty) ;
+            value_type * pVal = refBottom.m_pVal ;
+            refBottom.m_pVal = null_ptr<value_type *>() ;
+            refBottom.unlock() ;
+
+            node& refTop = item( 1 ) ;
+            refTop.lock() ;
+
+            if ( refTop.m_nTag == tag_type(Empty) ) {
+                // nBottom == 1; the heap has only one item that has just been extracted
+                refTop.unlock() ;
+                m_Stat.onPopSuccess() ;
+                return pVal ;
+            }
+
+            std::swap( refTop.m_pVal, pVal ) ;
+            refTop.m_nTag = tag_type( Available ) ;
+
+            // refTop will be unlocked inside heapify_after_pop
+            heapify_after_pop( 1, &refTop ) ;
+
+            m_Stat.onPopSuccess() ;
+            return pVal ;
+        }
+
+        /// Clears the queue (not atomic)
+        /**
+            This function is no atomic, but thread-safe
+        */
+        void clear()
+        {
+            clear_with( empty_functor() ) ;
+        }
+
+        /// Clears the queue (not atomic)
+        /**
+            This function is no atomic, but thread-safe.
+
+            For each item removed the functor \p f is called.
+            \p Func interface is:
+            \code
+                struct clear_functor
+                {
+                    void operator()( value_type& item ) ;
+                };
+            \endcode
+            A lambda function or a function pointer can be used as \p f.
+        */
+        template <typename Func>
+        void clear_with( Func f )
+        {
+            while ( !empty() ) {
+                value_type * pVal = pop() ;
+                if ( pVal )
+                    cds::unref(f)( *pVal ) ;
+            }
+        }
+
+        /// Checks is the priority queue is empty
+        bool empty() const
+        {
+            return size() == 0 ;
+        }
+
+        /// Checks if the priority queue is full
+        bool full() const
+        {
+            return size() == capacity() ;
+        }
+
+        /// Returns current size of priority queue
+        size_t size() const
+        {
+            m_Lock.lock() ;
+            size_t nSize = m_ItemCounter.value() ;
+            m_Lock.unlock() ;
+            return nSize ;
+        }
+
+        /// Return capacity of the priority queue
+        size_t capacity() const
+        {
+            // m_Heap[0] stores the heap item with index 1
+            return m_Heap.capacity() ;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return m_Stat ;
+        }
+
+    protected:
+        //@cond
+
+        // Heap item with index i (1 <= i <= capacity())
+        node& item( size_t i )
+        {
+            return m_Heap[i - 1] ;
+        }
+
+        void heapify_after_push( size_t i, tag_type curId )
+        {
+            key_comparator  cmp     ;
+            back_off        bkoff   ;
+
+            // Move item towards top of the heap while it has a higher priority than its parent
+            while ( i > 1 ) {
+                bool bProgress = true ;
+                size_t nParent = i / 2 ;
+                node& refParent = item( nParent ) ;
+                refParent.lock() ;
+                node& refItem = item( i ) ;
+                refItem.lock() ;
+
+                if ( refParent.m_nTag == tag_type(Available) && refItem.m_nTag == curId ) {
+                    if ( cmp( *refItem.m_pVal, *refParent.m_pVal ) > 0 ) {
+                        std::swap( refItem.m_nTag, refParent.m_nTag ) ;
+                        std::swap( refItem.m_pVal, refParent.m_pVal ) ;
+                        m_Stat.onPushHeapifySwap() ;
+                        i = nParent ;
+                    }
+                    else {
+                        refItem.m_nTag = tag_type(Available) ;
+                        i = 0 ;
+                    }
+                }
+                else if ( refParent.m_nTag == tag_type(Empty) ) {
+                    // the item has been moved to the root by concurrent pop
+                    i = 0 ;
+                }
+                else if ( refItem.m_nTag != curId ) {
+                    // the item has been moved up by concurrent pop
+                    i = nParent ;
+                }
+                else {
+                    // the parent is being inserted by another thread
+                    bProgress = false ;
+                }
+
+                refItem.unlock() ;
+                refParent.unlock() ;
+
+                if ( !bProgress )
+                    bkoff() ;
+                else
+                    bkoff.reset() ;
+            }
+
+            if ( i == 1 ) {
+                node& refItem = item( i ) ;
+                refItem.lock() ;
+                if ( refItem.m_nTag == curId )
+                    refItem.m_nTag = tag_type(Available) ;
+                refItem.unlock() ;
+            }
+        }
+
+        void heapify_after_pop( size_t nParent, node * pParent )
+        {
+            key_comparator cmp ;
+
+            // pParent is locked
+            size_t nChild ;
+            while ( (nChild = nParent * 2) <= capacity() ) {
+                node * pChild ;
+                node * pLeft = &item( nChild ) ;
+                pLeft->lock() ;
+                if ( pLeft->m_nTag == tag_type(Empty) ) {
+                    pLeft->unlock() ;
+                    break ;
+                }
+
+                if ( nChild + 1 <= capacity() ) {
+                    node * pRight = &item( nChild + 1 ) ;
+                    pRight->lock() ;
+                    if ( pRight->m_nTag == tag_type(Empty) ) {
+                        pRight->unlock() ;
+                        pChild = pLeft ;
+                    }
+                    else if ( cmp( *pRight->m_pVal, *pLeft->m_pVal ) > 0 ) {
+                        pLeft->unlock() ;
+                        pChild = pRight ;
+                        ++nChild ;
+                    }
+                    else {
+                        pRight->unlock() ;
+                        pChild = pLeft ;
+                    }
+                }
+                else
+                    pChild = pLeft ;
+
+                // If child has higher priority than parent then swap
+                // Otherwise stop
+                if ( cmp( *pChild->m_pVal, *pParent->m_pVal ) > 0 ) {
+                    std::swap( pParent->m_nTag, pChild->m_nTag ) ;
+                    std::swap( pParent->m_pVal, pChild->m_pVal ) ;
+                    pParent->unlock() ;
+                    m_Stat.onPopHeapifySwap() ;
+                    nParent = nChild ;
+                    pParent = pChild ;
+                }
+                else {
+                    pChild->unlock() ;
+                    break ;
+                }
+            }
+            pParent->unlock() ;
+        }
+        //@endcond
+    };
+
+}} // namespace cds::intrusive
+
+#endif // #ifndef __CDS_INTRUSIVE_MSPRIORITY_QUEUE_H
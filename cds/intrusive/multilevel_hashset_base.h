@@ -0,0 +1,578 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_INTRUSIVE_MULTILEVEL_HASHSET_BASE_H
+#define __CDS_INTRUSIVE_MULTILEVEL_HASHSET_BASE_H
+
+#include <memory.h> // memcmp
+#include <vector>
+#include <cds/intrusive/base.h>
+#include <cds/opt/compare.h>
+#include <cds/details/marked_ptr.h>
+#include <cds/details/std/type_traits.h>
+#include <cds/urcu/options.h>
+
+namespace cds { namespace intrusive {
+
+    /// MultiLevelHashSet related definitions
+    /** @ingroup cds_intrusive_helper
+    */
+    namespace multilevel_hashset {
+
+        /// Hash accessor option
+        /**
+            The functor returns a reference to the hash value of an item:
+            \code
+            struct foo {
+                size_t  nHash ;
+                // ... other fields
+            };
+            struct foo_hash_accessor {
+                size_t const& operator()( foo const& v ) const { return v.nHash ; }
+            };
+            \endcode
+            The option is mandatory, there is no default accessor.
+        */
+        template <typename Accessor>
+        struct hash_accessor {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                typedef Accessor hash_accessor ;
+            };
+            //@endcond
+        };
+
+        /// Hash value type option
+        /**
+            The type of the hash value returned by \ref hash_accessor. Default is \p size_t.
+
+            The hash value is split into bit chunks that are the indices in the arrays of the set.
+            So, the type must have a fixed size and should be a POD type: the hash values are compared
+            bitwise by default (see \ref bitwise_compare).
+        */
+        template <typename T>
+        struct hash_type {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                typedef T hash_type ;
+            };
+            //@endcond
+        };
+
+        /// Bitwise comparator of hash values
+        /**
+            This is the default comparator for the hash values if neither \p opt::compare nor \p opt::less
+            option is specified. The comparator is based on \p memcmp, so the byte order is not important:
+            the set needs the equality of hash values only, the ordering is never used.
+        */
+        template <typename T>
+        struct bitwise_compare
+        {
+            /// Compares \p lhs and \p rhs bitwise
+            int operator()( T const& lhs, T const& rhs ) const
+            {
+                return memcmp( &lhs, &rhs, sizeof(T) ) ;
+            }
+        };
+
+        /// MultiLevelHashSet internal statistics
+        struct stat {
+            typedef cds::atomicity::event_counter   event_counter ; ///< Event counter type
+
+            event_counter   m_nInsertSuccess        ; ///< Count of success insertion
+            event_counter   m_nInsertFailed         ; ///< Count of failed insertion (the item with equal hash is found)
+            event_counter   m_nInsertRetry          ; ///< Count of insertion retries
+            event_counter   m_nEnsureNew            ; ///< Count of \p ensure call that inserts new item
+            event_counter   m_nEnsureExisting       ; ///< Count of \p ensure call for existing item
+            event_counter   m_nUpdateNew            ; ///< Count of \p update call that inserts new item
+            event_counter   m_nUpdateExisting       ; ///< Count of \p update call that replaces existing item
+            event_counter   m_nUpdateFailed         ; ///< Count of \p update call that finds nothing and does not insert
+            event_counter   m_nUpdateRetry          ; ///< Count of \p update retries
+            event_counter   m_nEraseSuccess         ; ///< Count of successful \p erase call
+            event_counter   m_nEraseFailed          ; ///< Count of failed \p erase call
+            event_counter   m_nEraseRetry           ; ///< Count of \p erase retries
+            event_counter   m_nFindSuccess          ; ///< Count of successful \p find call
+            event_counter   m_nFindFailed           ; ///< Count of failed \p find call
+            event_counter   m_nFindRetry            ; ///< Count of \p find retries
+
+            event_counter   m_nExpandNodeSuccess    ; ///< Count of the data slots successfully converted to array node
+            event_counter   m_nExpandNodeFailed     ; ///< Count of failed attempts to convert a data slot to array node
+            event_counter   m_nSlotChanged          ; ///< Count of slot changes detected while guarding the item
+            event_counter   m_nSlotConverting       ; ///< Count of the slots found in "converting" state
+            event_counter   m_nArrayNodeCount       ; ///< Count of array nodes allocated
+
+            //@cond
+            void onInsertSuccess()      { ++m_nInsertSuccess    ; }
+            void onInsertFailed()       { ++m_nInsertFailed     ; }
+            void onInsertRetry()        { ++m_nInsertRetry      ; }
+            void onEnsureNew()          { ++m_nEnsureNew        ; }
+            void onEnsureExisting()     { ++m_nEnsureExisting   ; }
+            void onUpdateNew()          { ++m_nUpdateNew        ; }
+            void onUpdateExisting()     { ++m_nUpdateExisting   ; }
+            void onUpdateFailed()       { ++m_nUpdateFailed     ; }
+            void onUpdateRetry()        { ++m_nUpdateRetry      ; }
+            void onEraseSuccess()       { ++m_nEraseSuccess     ; }
+            void onEraseFailed()        { ++m_nEraseFailed      ; }
+            void onEraseRetry()         { ++m_nEraseRetry       ; }
+            void onFindSuccess()        { ++m_nFindSuccess      ; }
+            void onFindFailed()         { ++m_nFindFailed       ; }
+            void onFindRetry()          { ++m_nFindRetry        ; }
+
+            void onExpandNodeSuccess()  { ++m_nExpandNodeSuccess; }
+            void onExpandNodeFailed()   { ++m_nExpandNodeFailed ; }
+            void onSlotChanged()        { ++m_nSlotChanged      ; }
+            void onSlotConverting()     { ++m_nSlotConverting   ; }
+            void onArrayNodeCreated()   { ++m_nArrayNodeCount   ; }
+            //@endcond
+        };
+
+        /// MultiLevelHashSet empty internal statistics
+        struct empty_stat {
+            //@cond
+            void onInsertSuccess()      const {}
+            void onInsertFailed()       const {}
+            void onInsertRetry()        const {}
+            void onEnsureNew()          const {}
+            void onEnsureExisting()     const {}
+            void onUpdateNew()          const {}
+            void onUpdateExisting()     const {}
+            void onUpdateFailed()       const {}
+            void onUpdateRetry()        const {}
+            void onEraseSuccess()       const {}
+            void onEraseFailed()        const {}
+            void onEraseRetry()         const {}
+            void onFindSuccess()        const {}
+            void onFindFailed()         const {}
+            void onFindRetry()          const {}
+
+            void onExpandNodeSuccess()  const {}
+            void onExpandNodeFailed()   const {}
+            void onSlotChanged()        const {}
+            void onSlotConverting()     const {}
+            void onArrayNodeCreated()   const {}
+            //@endcond
+        };
+
+        /// Statistics of one level of the set's tree
+        /**
+            The statistics is collected by \p get_level_statistics() member function of the set.
+            Level 0 is the head array.
+        */
+        struct level_statistics
+        {
+            size_t  array_node_count    ;   ///< Count of array nodes at the level
+            size_t  node_capacity       ;   ///< Array capacity (slot count) of each node at the level
+
+            size_t  data_cell_count     ;   ///< Count of slots that contain data
+            size_t  array_cell_count    ;   ///< Count of slots that point to a child array node
+            size_t  empty_cell_count    ;   ///< Count of empty slots
+
+            //@cond
+            level_statistics()
+                : array_node_count(0)
+                , node_capacity(0)
+                , data_cell_count(0)
+                , array_cell_count(0)
+                , empty_cell_count(0)
+            {}
+            //@endcond
+        };
+
+        /// Type traits for MultiLevelHashSet class
+        struct type_traits
+        {
+            /// Hash accessor functor
+            /**
+                Mandatory option, see \ref multilevel_hashset::hash_accessor for explanation.
+            */
+            typedef opt::none   hash_accessor ;
+
+            /// Hash value type
+            /**
+                See \ref multilevel_hashset::hash_type. Default is \p size_t.
+            */
+            typedef size_t      hash_type ;
+
+            /// Hash comparing functor
+            /**
+                No default functor is provided. If the option is not specified, the \p less is used.
+                If \p less is not specified too, the hash values are compared bitwise,
+                see \ref multilevel_hashset::bitwise_compare.
+            */
+            typedef opt::none   compare ;
+
+            /// Binary predicate to compare the hash values
+            /**
+                Used if \p compare is not specified. Default is \p opt::none.
+            */
+            typedef opt::none   less ;
+
+            /// Disposer
+            /**
+                The functor used for dispose removed items. Default is opt::v::empty_disposer.
+            */
+            typedef opt::v::empty_disposer  disposer ;
+
+            /// Item counter
+            /**
+                The \p empty() member function of the set depends on the item counting.
+                Therefore, the default is atomicity::item_counter.
+            */
+            typedef atomicity::item_counter item_counter ;
+
+            /// C++ memory ordering model
+            /**
+                List of available memory ordering see opt::memory_model
+            */
+            typedef opt::v::relaxed_ordering    memory_model ;
+
+            /// Back-off strategy
+            typedef cds::backoff::Default       back_off ;
+
+            /// Array node allocator
+            /**
+                Allocator for the head array and for the array nodes. Default is \ref CDS_DEFAULT_ALLOCATOR.
+            */
+            typedef CDS_DEFAULT_ALLOCATOR       allocator ;
+
+            /// Internal statistics
+            /**
+                Possible types: \ref multilevel_hashset::stat, \ref multilevel_hashset::empty_stat (the default)
+            */
+            typedef empty_stat                  stat ;
+
+            /// RCU deadlock checking policy (only for \ref cds_intrusive_MultiLevelHashSet_rcu "RCU-based MultiLevelHashSet")
+            /**
+                List of available options see opt::rcu_check_deadlock
+            */
+            typedef opt::v::rcu_throw_deadlock  rcu_check_deadlock ;
+        };
+
+        /// Metafunction converting option list to MultiLevelHashSet traits
+        /**
+            This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
+            \p Options list see \ref MultiLevelHashSet.
+        */
+        template <CDS_DECL_OPTIONS12>
+        struct make_traits {
+#   ifdef CDS_DOXYGEN_INVOKED
+            typedef implementation_defined type ;   ///< Metafunction result
+#   else
+            typedef typename cds::opt::make_options<
+                typename cds::opt::find_type_traits< type_traits, CDS_OPTIONS12 >::type
+                ,CDS_OPTIONS12
+            >::type   type ;
+#   endif
+        };
+
+        //@cond
+        namespace details {
+
+            // Splits the hash value into bit chunks starting from the least significant bit of the first byte
+            template <typename HashType>
+            class hash_splitter
+            {
+            public:
+                typedef HashType hash_type ;
+                static size_t const c_nHashBitCount = sizeof(hash_type) * 8 ;
+
+            private:
+                unsigned char const *   m_pHash ;
+                size_t                  m_nPos  ;   // position of next bit to cut
+
+            public:
+                explicit hash_splitter( hash_type const& h, size_t nPos = 0 )
+                    : m_pHash( reinterpret_cast<unsigned char const *>( &h ))
+                    , m_nPos( nPos )
+                {}
+
+                // true if all bits are consumed
+                bool eos() const
+                {
+                    return m_nPos >= c_nHashBitCount ;
+                }
+
+                size_t bit_offset() const
+                {
+                    return m_nPos ;
+                }
+
+                // Returns next nBits bits of the hash. If the rest is shorter than nBits, the rest is returned
+                size_t cut( size_t nBits )
+                {
+                    assert( !eos() ) ;
+                    assert( nBits <= sizeof(size_t) * 8 ) ;
+
+                    if ( m_nPos + nBits > c_nHashBitCount )
+                        nBits = c_nHashBitCount - m_nPos ;
+
+                    size_t nResult = 0 ;
+                    size_t nShift = 0 ;
+                    while ( nBits ) {
+                        size_t const nBit = m_nPos & 7 ;
+                        size_t nTake = 8 - nBit ;
+                        if ( nTake > nBits )
+                            nTake = nBits ;
+                        nResult |= ((static_cast<size_t>( m_pHash[ m_nPos >> 3 ] ) >> nBit) & ((size_t(1) << nTake) - 1)) << nShift ;
+                        nShift += nTake ;
+                        nBits  -= nTake ;
+                        m_nPos += nTake ;
+                    }
+                    return nResult ;
+                }
+            };
+
+            // Array structure of MultiLevelHashSet independent of garbage collector.
+            // The slot of an array holds either a pointer to the data or a pointer to the child array node;
+            // the array node pointer is marked with flag_array_node bit.
+            // The array nodes are never deallocated until the set is destroyed.
+            template <typename T, typename Traits>
+            class multilevel_array
+            {
+            public:
+                typedef T       value_type  ;
+                typedef Traits  options     ;
+
+                typedef typename options::hash_accessor hash_accessor ;
+                static_assert( !std::is_same< hash_accessor, cds::opt::none >::value, "hash_accessor functor must be specified" ) ;
+
+                typedef typename options::hash_type     hash_type   ;
+                typedef typename std::conditional<
+                    std::is_same< typename cds::opt::details::make_comparator< hash_type, options, false >::type, cds::opt::none >::value,
+                    bitwise_compare< hash_type >,
+                    typename cds::opt::details::make_comparator< hash_type, options, false >::type
+                >::type hash_comparator ;
+
+                typedef typename options::item_counter  item_counter ;
+                typedef typename options::memory_model  memory_model ;
+                typedef typename options::back_off      back_off     ;
+                typedef typename options::stat          stat         ;
+
+                typedef hash_splitter< hash_type >      splitter_type ;
+
+                enum node_flags {
+                    flag_array_converting = 1,  // the data slot is being converted to array node
+                    flag_array_node = 2         // the slot points to array node
+                };
+
+                typedef cds::details::marked_ptr< value_type, 3 >   node_ptr        ;
+                typedef CDS_ATOMIC::atomic< node_ptr >              atomic_node_ptr ;
+
+                struct array_node {
+                    array_node * const  pParent     ;   // parent array node, NULL for the head
+                    size_t const        idxParent   ;   // index in the parent array
+                    atomic_node_ptr     nodes[1]    ;   // slots, actual size is defined by the metrics
+
+                    array_node( array_node * parent, size_t idx )
+                        : pParent( parent )
+                        , idxParent( idx )
+                    {}
+                };
+
+                struct metrics {
+                    size_t  head_bits   ;   // log2 of the head array size
+                    size_t  array_bits  ;   // log2 of the array node size
+                    size_t  head_size   ;
+                    size_t  array_size  ;
+                };
+
+            protected:
+                typedef typename options::allocator::template rebind<unsigned char>::other  raw_allocator ;
+
+                metrics         m_Metrics       ;
+                array_node *    m_Head          ;
+                item_counter    m_ItemCounter   ;
+                stat            m_Stat          ;
+
+            protected:
+                static metrics make_metrics( size_t nHeadBits, size_t nArrayBits )
+                {
+                    size_t const c_nHashBits = splitter_type::c_nHashBitCount ;
+
+                    if ( nArrayBits < 2 )
+                        nArrayBits = 2 ;
+                    if ( nArrayBits > 16 )
+                        nArrayBits = 16 ;
+                    if ( nHeadBits < 2 )
+                        nHeadBits = 2 ;
+                    if ( nHeadBits > 24 )
+                        nHeadBits = 24 ;
+                    if ( nHeadBits > c_nHashBits )
+                        nHeadBits = c_nHashBits ;
+                    if ( nArrayBits > c_nHashBits )
+                        nArrayBits = c_nHashBits ;
+
+                    metrics m ;
+                    m.head_bits  = nHeadBits ;
+                    m.array_bits = nArrayBits ;
+                    m.head_size  = size_t(1) << nHeadBits ;
+                    m.array_size = size_t(1) << nArrayBits ;
+                    return m ;
+                }
+
+                multilevel_array( size_t nHeadBits, size_t nArrayBits )
+                    : m_Metrics( make_metrics( nHeadBits, nArrayBits ))
+                {
+                    m_Head = alloc_array_node( m_Metrics.head_size, null_ptr<array_node *>(), 0 ) ;
+                }
+
+                ~multilevel_array()
+                {
+                    destroy_tree() ;
+                    free_array_node( m_Head, m_Metrics.head_size ) ;
+                }
+
+                static size_t array_node_bytes( size_t nSize )
+                {
+                    return sizeof(array_node) + sizeof(atomic_node_ptr) * (nSize - 1) ;
+                }
+
+                array_node * alloc_array_node( size_t nSize, array_node * pParent, size_t idxParent )
+                {
+                    unsigned char * pMem = raw_allocator().allocate( array_node_bytes( nSize )) ;
+                    array_node * pNode = new( pMem ) array_node( pParent, idxParent ) ;
+                    // nodes[0] is constructed by array_node ctor
+                    for ( size_t i = 1; i < nSize; ++i )
+                        new( pNode->nodes + i ) atomic_node_ptr ;
+                    for ( size_t i = 0; i < nSize; ++i )
+                        pNode->nodes[i].store( node_ptr(), CDS_ATOMIC::memory_order_relaxed ) ;
+                    return pNode ;
+                }
+
+                static void free_array_node( array_node * pNode, size_t nSize )
+                {
+                    for ( size_t i = 1; i < nSize; ++i )
+                        pNode->nodes[i].~atomic_node_ptr() ;
+                    pNode->~array_node() ;
+                    raw_allocator().deallocate( reinterpret_cast<unsigned char *>( pNode ), array_node_bytes( nSize )) ;
+                }
+
+                static array_node * to_array( value_type * p )
+                {
+                    return reinterpret_cast<array_node *>( p ) ;
+                }
+
+                static value_type * to_node( array_node * p )
+                {
+                    return reinterpret_cast<value_type *>( p ) ;
+                }
+
+                size_t array_size( array_node const * pArr ) const
+                {
+                    return pArr->pParent ? m_Metrics.array_size : m_Metrics.head_size ;
+                }
+
+                // Frees all child array nodes. The data must be removed before
+                void destroy_tree()
+                {
+                    destroy_array_nodes( m_Head, m_Metrics.head_size ) ;
+                }
+
+                void destroy_array_nodes( array_node * pArr, size_t nSize )
+                {
+                    for ( atomic_node_ptr * p = pArr->nodes, *pLast = pArr->nodes + nSize; p != pLast; ++p ) {
+                        node_ptr slot = p->load( CDS_ATOMIC::memory_order_relaxed ) ;
+                        if ( slot.bits() == flag_array_node ) {
+                            destroy_array_nodes( to_array( slot.ptr()), m_Metrics.array_size ) ;
+                            free_array_node( to_array( slot.ptr()), m_Metrics.array_size ) ;
+                            p->store( node_ptr(), CDS_ATOMIC::memory_order_relaxed ) ;
+                        }
+                    }
+                }
+
+                // Converts data slot pArr->nodes[idx] that contains current to the array node.
+                // nOffset is the bit offset of the hash for the new array level.
+                // The caller must guard current.ptr()
+                bool expand_slot( array_node * pParent, size_t idxParent, node_ptr current, size_t nOffset )
+                {
+                    assert( current.bits() == 0 ) ;
+                    assert( current.ptr() ) ;
+
+                    atomic_node_ptr& slot = pParent->nodes[idxParent] ;
+                    {
+                        node_ptr cur( current.ptr()) ;
+                        if ( !slot.compare_exchange_strong( cur, cur | flag_array_converting, memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed )) {
+                            m_Stat.onExpandNodeFailed() ;
+                            return false ;
+                        }
+                    }
+
+                    array_node * pArr = alloc_array_node( m_Metrics.array_size, pParent, idxParent ) ;
+                    m_Stat.onArrayNodeCreated() ;
+
+                    splitter_type splitter( hash_accessor()( *current.ptr()), nOffset ) ;
+                    assert( !splitter.eos()) ;
+                    size_t idx = splitter.cut( m_Metrics.array_bits ) ;
+                    pArr->nodes[idx].store( current, CDS_ATOMIC::memory_order_release ) ;
+
+                    // Nobody but us can change the slot marked as converting
+                    node_ptr cur( current.ptr(), flag_array_converting ) ;
+                    CDS_VERIFY( slot.compare_exchange_strong( cur, node_ptr( to_node( pArr ), flag_array_node ), memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed )) ;
+
+                    m_Stat.onExpandNodeSuccess() ;
+                    return true ;
+                }
+
+                void gather_level_statistics( std::vector< level_statistics >& stat, size_t nLevel, array_node * pArr, size_t nSize ) const
+                {
+                    if ( stat.size() <= nLevel ) {
+                        stat.resize( nLevel + 1 ) ;
+                        stat[nLevel].node_capacity = nSize ;
+                    }
+
+                    ++stat[nLevel].array_node_count ;
+                    for ( size_t i = 0; i < nSize; ++i ) {
+                        node_ptr slot = pArr->nodes[i].load( CDS_ATOMIC::memory_order_relaxed ) ;
+                        if ( slot.bits() == flag_array_node ) {
+                            ++stat[nLevel].array_cell_count ;
+                            gather_level_statistics( stat, nLevel + 1, to_array( slot.ptr()), m_Metrics.array_size ) ;
+                        }
+                        else if ( slot.ptr() )
+                            ++stat[nLevel].data_cell_count ;
+                        else
+                            ++stat[nLevel].empty_cell_count ;
+                    }
+                }
+
+            public:
+                size_t head_size() const
+                {
+                    return m_Metrics.head_size ;
+                }
+
+                size_t array_node_size() const
+                {
+                    return m_Metrics.array_size ;
+                }
+
+                void get_level_statistics( std::vector< level_statistics >& stat ) const
+                {
+                    stat.clear() ;
+                    gather_level_statistics( stat, 0, m_Head, m_Metrics.head_size ) ;
+                }
+            };
+
+        } // namespace details
+        //@endcond
+
+    } // namespace multilevel_hashset
+
+    //@cond
+    // Forward declaration
+    template < class GC, typename T, class Traits = multilevel_hashset::type_traits >
+    class MultiLevelHashSet ;
+    //@endcond
+
+}} // namespace cds::intrusive
+
+#endif // #ifndef __CDS_INTRUSIVE_MULTILEVEL_HASHSET_BASE_H
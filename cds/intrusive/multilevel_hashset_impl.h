@@ -0,0 +1,836 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_INTRUSIVE_MULTILEVEL_HASHSET_IMPL_H
+#define __CDS_INTRUSIVE_MULTILEVEL_HASHSET_IMPL_H
+
+#include <cds/intrusive/multilevel_hashset_base.h>
+#include <cds/gc/details/retired_batch.h>
+#include <cds/details/make_const_type.h>
+#include <cds/ref.h>
+
+namespace cds { namespace intrusive {
+
+    /// Lock-free multi-level hash set
+    /** @ingroup cds_intrusive_map
+        \anchor cds_intrusive_MultiLevelHashSet_hp
+
+        Source:
+            - [2013] Steven Feldman, Pierre LaBorde, Damian Dechev "Concurrent Multi-level Arrays:
+                Wait-free Extensible Hash Maps"
+
+        The set is a tree of arrays indexed by the bits of the hash value. The head array has
+        <tt>2**head_bits</tt> slots, each array node below the head has <tt>2**array_bits</tt> slots.
+        The first \p head_bits bits of the hash value are the index in the head array,
+        the next \p array_bits bits are the index in the array node of the second level, and so on.
+        A slot contains either a pointer to an item or a pointer to the child array node.
+
+        When two items collide in a slot, the slot is converted to an array node that holds the old item
+        one level deeper, and the insertion is retried. So, the set never rehashes: it grows
+        by adding array nodes, and an item is never moved after it has been placed into the deepest slot
+        for its hash prefix. Insertion, erasing and replacing of an item is a single CAS on the slot.
+        The array nodes are never deallocated until the set is destroyed.
+
+        <b>The hash must be perfect</b>: the set stores the hash value only, not the key.
+        Two items with equal hash values are considered equal. Therefore, the hash value type
+        should be wide enough to hold the key itself (for integer keys the identity "hash" is the best choice)
+        or a cryptographic-strength digest of the key.
+        Since the set looks for items by hash value, all search functions of the set accept the hash value
+        as an argument instead of the key.
+
+        <b>Template arguments</b> :
+        - \p GC - garbage collector used: gc::HP, gc::PTB or gc::EBR. See \ref cds_intrusive_MultiLevelHashSet_rcu "RCU specialization"
+        - \p T - type to be stored in the set. The set stores a pointer to \p T in the slot and uses two least bits
+            of the pointer as flags, so the alignment of \p T must be at least 4.
+            The set does not require any hook in \p T.
+        - \p Traits - type traits. See multilevel_hashset::type_traits for explanation.
+
+        It is possible to declare option-based set with cds::intrusive::multilevel_hashset::make_traits metafunction
+        instead of \p Traits template argument. \p Options of the metafunction are:
+        - multilevel_hashset::hash_accessor - mandatory option, the functor returning the hash value of an item.
+        - multilevel_hashset::hash_type - the type of the hash value, default is \p size_t.
+        - opt::compare - hash value comparison functor. If the option is not specified, the opt::less is used.
+        - opt::less - binary predicate for hash value comparing. If neither \p compare nor \p less
+            is specified, the hash values are compared bitwise (multilevel_hashset::bitwise_compare).
+        - opt::disposer - the functor used for dispose removed items. Default is opt::v::empty_disposer.
+            Due the nature of GC schema the disposer may be called asynchronously.
+        - opt::item_counter - the type of item counting feature. Default is atomicity::item_counter.
+        - opt::memory_model - C++ memory ordering model. Can be opt::v::relaxed_ordering (relaxed memory model, the default)
+            or opt::v::sequential_consistent (sequentially consisnent memory model).
+        - opt::back_off - back-off strategy used when a slot is being converted to array node.
+            Default is cds::backoff::Default.
+        - opt::allocator - allocator for the array nodes. Default is \ref CDS_DEFAULT_ALLOCATOR.
+        - opt::stat - internal statistics. Available types: multilevel_hashset::stat, multilevel_hashset::empty_stat (the default)
+
+        The size of the head array and of the array nodes are the constructor arguments.
+
+        Each operation of the set requires one hazard pointer; each iterator object requires one more hazard pointer.
+
+        \note There are several specializations of \p %MultiLevelHashSet for each \p GC. You should include:
+        - <tt><cds/intrusive/multilevel_hashset_hp.h></tt> for gc::HP garbage collector
+        - <tt><cds/intrusive/multilevel_hashset_ptb.h></tt> for gc::PTB garbage collector
+        - <tt><cds/intrusive/multilevel_hashset_ebr.h></tt> for gc::EBR garbage collector
+        - <tt><cds/intrusive/multilevel_hashset_rcu.h></tt> for \ref cds_intrusive_MultiLevelHashSet_rcu "RCU type"
+
+        <b>Iterators</b>
+
+        The class supports a forward iterator (\ref iterator and \ref const_iterator).
+        The iteration is unordered: the items are visited in the order of bits of their hash values.
+        The item pointed by the iterator object is guarded, so, the item cannot be reclaimed while the iterator object is alive.
+        However, passing an iterator object between threads is dangerous.
+
+        \warning Due to concurrent nature of the set it is not guarantee that you can iterate
+        all elements in the set: the items inserted or erased concurrently may be visited or may be not.
+        Therefore, such iteration is more suitable for debugging purpose only.
+
+        <b>How to use</b>
+        \code
+        #include <cds/intrusive/multilevel_hashset_hp.h>
+
+        struct foo {
+            size_t  nKey  ;     // the key is the hash value itself
+            // other data
+        };
+
+        struct foo_hash_accessor {
+            size_t const& operator()( foo const& v ) const { return v.nKey ; }
+        };
+
+        typedef cds::intrusive::MultiLevelHashSet< cds::gc::HP, foo,
+            cds::intrusive::multilevel_hashset::make_traits<
+                cds::intrusive::multilevel_hashset::hash_accessor< foo_hash_accessor >
+            >::type
+        > foo_set ;
+
+        foo_set s( 8, 4 ) ; // head array of 256 slots, array nodes of 16 slots
+        \endcode
+    */
+    template <
+        class GC,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = multilevel_hashset::type_traits
+#else
+        class Traits
+#endif
+    >
+    class MultiLevelHashSet: protected multilevel_hashset::details::multilevel_array< T, Traits >
+    {
+        //@cond
+        typedef multilevel_hashset::details::multilevel_array< T, Traits > base_class ;
+        //@endcond
+
+    public:
+        typedef GC      gc          ;   ///< Garbage collector
+        typedef T       value_type  ;   ///< type of value stored in the set
+        typedef Traits  options     ;   ///< Traits template parameter
+
+        typedef typename base_class::hash_accessor      hash_accessor   ;   ///< Hash accessor functor
+        typedef typename base_class::hash_type          hash_type       ;   ///< Hash value type
+        typedef typename base_class::hash_comparator    hash_comparator ;   ///< Hash value comparing functor
+        typedef typename options::disposer              disposer        ;   ///< Item disposer
+        typedef typename base_class::item_counter       item_counter    ;   ///< Item counting policy used
+        typedef typename base_class::memory_model       memory_model    ;   ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename base_class::back_off           back_off        ;   ///< Back-off strategy
+        typedef typename base_class::stat               stat            ;   ///< Internal statistics type
+
+        typedef multilevel_hashset::level_statistics    level_statistics ;  ///< Level statistics, see \ref get_level_statistics
+
+    protected:
+        //@cond
+        typedef typename base_class::node_ptr           node_ptr        ;
+        typedef typename base_class::atomic_node_ptr    atomic_node_ptr ;
+        typedef typename base_class::array_node         array_node      ;
+        typedef typename base_class::splitter_type      splitter_type   ;
+
+        typedef typename gc::Guard  guard_type ;
+
+        struct position {
+            array_node *    pArr    ;   // array node containing the slot
+            size_t          nSlot   ;   // slot index
+            size_t          nOffset ;   // hash bit offset for the next level
+        };
+
+        struct empty_insert_functor {
+            void operator()( value_type& ) const
+            {}
+        };
+
+        struct empty_erase_functor {
+            void operator()( value_type const& ) const
+            {}
+        };
+
+        struct empty_find_functor {
+            void operator()( value_type const& ) const
+            {}
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        template <bool IsConst>
+        class iterator_type
+        {
+            friend class MultiLevelHashSet ;
+
+        public:
+            typedef T   value_type ;
+            static bool const c_isConst = IsConst ;
+
+        protected:
+            typedef MultiLevelHashSet   set_type    ;
+
+            set_type const *    m_pSet      ;
+            array_node *        m_pNode     ;
+            size_t              m_idx       ;
+            value_type *        m_pValue    ;
+            guard_type          m_Guard     ;
+
+        public:
+            typedef typename cds::details::make_const_type<value_type, IsConst>::pointer   value_ptr ;
+            typedef typename cds::details::make_const_type<value_type, IsConst>::reference value_ref ;
+
+        protected:
+            iterator_type( set_type const& s, array_node * pNode, size_t idx )
+                : m_pSet( &s )
+                , m_pNode( null_ptr<array_node *>())
+                , m_idx( 0 )
+                , m_pValue( null_ptr<value_type *>())
+            {
+                forward( pNode, idx ) ;
+            }
+
+            // Finds first item starting from slot idx of pNode
+            void forward( array_node * pNode, size_t idx )
+            {
+                back_off bkoff ;
+                while ( true ) {
+                    if ( idx >= m_pSet->array_size( pNode )) {
+                        if ( !pNode->pParent ) {
+                            // end of the set
+                            m_pNode = null_ptr<array_node *>() ;
+                            m_idx = 0 ;
+                            m_pValue = null_ptr<value_type *>() ;
+                            m_Guard.clear() ;
+                            return ;
+                        }
+                        idx = pNode->idxParent + 1 ;
+                        pNode = pNode->pParent ;
+                        continue ;
+                    }
+
+                    node_ptr slot = pNode->nodes[idx].load( memory_model::memory_order_acquire ) ;
+                    if ( slot.bits() == base_class::flag_array_node ) {
+                        pNode = base_class::to_array( slot.ptr()) ;
+                        idx = 0 ;
+                    }
+                    else if ( slot.bits() == base_class::flag_array_converting ) {
+                        // the item is being moved to new array node, wait
+                        bkoff() ;
+                    }
+                    else if ( slot.ptr() ) {
+                        m_Guard.assign( slot.ptr() ) ;
+                        if ( pNode->nodes[idx].load( memory_model::memory_order_acquire ) == slot ) {
+                            m_pNode = pNode ;
+                            m_idx = idx ;
+                            m_pValue = slot.ptr() ;
+                            return ;
+                        }
+                    }
+                    else
+                        ++idx ;
+                }
+            }
+
+        public:
+            iterator_type()
+                : m_pSet( null_ptr<set_type const *>())
+                , m_pNode( null_ptr<array_node *>())
+                , m_idx( 0 )
+                , m_pValue( null_ptr<value_type *>())
+            {}
+
+            iterator_type( iterator_type const& src )
+                : m_pSet( src.m_pSet )
+                , m_pNode( src.m_pNode )
+                , m_idx( src.m_idx )
+                , m_pValue( src.m_pValue )
+            {
+                m_Guard.copy( src.m_Guard ) ;
+            }
+
+            iterator_type& operator =( iterator_type const& src )
+            {
+                m_pSet = src.m_pSet ;
+                m_pNode = src.m_pNode ;
+                m_idx = src.m_idx ;
+                m_pValue = src.m_pValue ;
+                m_Guard.copy( src.m_Guard ) ;
+                return *this ;
+            }
+
+            value_ptr operator ->() const
+            {
+                return m_pValue ;
+            }
+
+            value_ref operator *() const
+            {
+                assert( m_pValue != null_ptr<value_type *>() ) ;
+                return *m_pValue ;
+            }
+
+            /// Pre-increment
+            iterator_type& operator ++()
+            {
+                if ( m_pNode )
+                    forward( m_pNode, m_idx + 1 ) ;
+                return *this ;
+            }
+
+            template <bool C>
+            bool operator ==(iterator_type<C> const& i ) const
+            {
+                return m_pNode == i.m_pNode && m_idx == i.m_idx && m_pValue == i.m_pValue ;
+            }
+            template <bool C>
+            bool operator !=(iterator_type<C> const& i ) const
+            {
+                return !( *this == i ) ;
+            }
+        };
+        //@endcond
+
+    public:
+        /// Forward iterator
+        typedef iterator_type<false>    iterator        ;
+        /// Const forward iterator
+        typedef iterator_type<true>     const_iterator  ;
+
+        /// Returns a forward iterator addressing the first element in a set
+        iterator begin()
+        {
+            return iterator( *this, base_class::m_Head, 0 ) ;
+        }
+
+        /// Returns a forward const iterator addressing the first element in a set
+        const_iterator begin() const
+        {
+            return const_iterator( *this, base_class::m_Head, 0 ) ;
+        }
+
+        /// Returns a forward const iterator addressing the first element in a set
+        const_iterator cbegin()
+        {
+            return const_iterator( *this, base_class::m_Head, 0 ) ;
+        }
+
+        /// Returns a forward iterator that addresses the location succeeding the last element in a set.
+        iterator end()
+        {
+            return iterator() ;
+        }
+
+        /// Returns a forward const iterator that addresses the location succeeding the last element in a set.
+        const_iterator end() const
+        {
+            return const_iterator() ;
+        }
+
+        /// Returns a forward const iterator that addresses the location succeeding the last element in a set.
+        const_iterator cend()
+        {
+            return const_iterator() ;
+        }
+
+    protected:
+        //@cond
+        static hash_type const& hash_of( value_type const& val )
+        {
+            return hash_accessor()( val ) ;
+        }
+
+        static bool hash_equal( hash_type const& h1, hash_type const& h2 )
+        {
+            return hash_comparator()( h1, h2 ) == 0 ;
+        }
+
+        static void retire_node( value_type * p )
+        {
+            gc::template retire<disposer>( p ) ;
+        }
+
+        // Finds the data slot for hash. The item in the slot (if any) is guarded by guard
+        node_ptr traverse( hash_type const& hash, guard_type& guard, position& pos )
+        {
+            splitter_type splitter( hash ) ;
+            pos.pArr = base_class::m_Head ;
+            pos.nSlot = splitter.cut( base_class::m_Metrics.head_bits ) ;
+
+            back_off bkoff ;
+            while ( true ) {
+                node_ptr slot = pos.pArr->nodes[pos.nSlot].load( memory_model::memory_order_acquire ) ;
+                if ( slot.bits() == base_class::flag_array_node ) {
+                    assert( !splitter.eos()) ;
+                    pos.pArr = base_class::to_array( slot.ptr()) ;
+                    pos.nSlot = splitter.cut( base_class::m_Metrics.array_bits ) ;
+                    continue ;
+                }
+
+                if ( slot.bits() == base_class::flag_array_converting ) {
+                    base_class::m_Stat.onSlotConverting() ;
+                    bkoff() ;
+                    continue ;
+                }
+
+                if ( slot.ptr() ) {
+                    guard.assign( slot.ptr() ) ;
+                    if ( pos.pArr->nodes[pos.nSlot].load( memory_model::memory_order_acquire ) != slot ) {
+                        base_class::m_Stat.onSlotChanged() ;
+                        continue ;
+                    }
+                }
+                pos.nOffset = splitter.bit_offset() ;
+                return slot ;
+            }
+        }
+
+        // Converts the slot containing an item with another hash to array node.
+        // Returns false if the slot cannot be expanded since all bits of hash are consumed
+        bool expand( position& pos, node_ptr slot )
+        {
+            if ( pos.nOffset >= splitter_type::c_nHashBitCount ) {
+                // Different items with equal hash bits - the hash comparator is inconsistent with bitwise equality
+                assert( false ) ;
+                return false ;
+            }
+            base_class::expand_slot( pos.pArr, pos.nSlot, slot, pos.nOffset ) ;
+            return true ;
+        }
+
+        template <typename Func>
+        bool do_insert( value_type& val, Func f )
+        {
+            hash_type const& hash = hash_of( val ) ;
+            guard_type guard ;
+            position pos ;
+
+            while ( true ) {
+                node_ptr slot = traverse( hash, guard, pos ) ;
+                if ( slot.ptr() ) {
+                    if ( hash_equal( hash_of( *slot.ptr()), hash )) {
+                        base_class::m_Stat.onInsertFailed() ;
+                        return false ;
+                    }
+                    if ( !expand( pos, slot )) {
+                        base_class::m_Stat.onInsertFailed() ;
+                        return false ;
+                    }
+                }
+                else {
+                    // The item should be guarded since it can be erased just after the insertion
+                    guard.assign( &val ) ;
+                    node_ptr pNull ;
+                    if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong( pNull, node_ptr( &val ), memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed )) {
+                        cds::unref(f)( val ) ;
+                        ++base_class::m_ItemCounter ;
+                        base_class::m_Stat.onInsertSuccess() ;
+                        return true ;
+                    }
+                }
+                base_class::m_Stat.onInsertRetry() ;
+            }
+        }
+
+        template <typename Func>
+        bool do_erase( hash_type const& hash, Func f, value_type const * pWhat )
+        {
+            guard_type guard ;
+            position pos ;
+
+            while ( true ) {
+                node_ptr slot = traverse( hash, guard, pos ) ;
+                if ( !slot.ptr() || !hash_equal( hash_of( *slot.ptr()), hash ) || ( pWhat && slot.ptr() != pWhat )) {
+                    base_class::m_Stat.onEraseFailed() ;
+                    return false ;
+                }
+
+                if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong( slot, node_ptr(), memory_model::memory_order_acquire, CDS_ATOMIC::memory_order_relaxed )) {
+                    --base_class::m_ItemCounter ;
+                    cds::unref(f)( *slot.ptr() ) ;
+                    retire_node( slot.ptr() ) ;
+                    base_class::m_Stat.onEraseSuccess() ;
+                    return true ;
+                }
+                base_class::m_Stat.onEraseRetry() ;
+            }
+        }
+
+        template <typename Func>
+        bool do_find( hash_type const& hash, Func f )
+        {
+            guard_type guard ;
+            position pos ;
+
+            node_ptr slot = traverse( hash, guard, pos ) ;
+            if ( slot.ptr() && hash_equal( hash_of( *slot.ptr()), hash )) {
+                cds::unref(f)( *slot.ptr() ) ;
+                base_class::m_Stat.onFindSuccess() ;
+                return true ;
+            }
+            base_class::m_Stat.onFindFailed() ;
+            return false ;
+        }
+
+        void clear_array( array_node * pArr, size_t nSize, cds::gc::details::retired_batch< gc >& batch )
+        {
+            back_off bkoff ;
+            for ( atomic_node_ptr * p = pArr->nodes, *pLast = pArr->nodes + nSize; p != pLast; ++p ) {
+                node_ptr slot = p->load( memory_model::memory_order_acquire ) ;
+                while ( true ) {
+                    if ( slot.bits() == base_class::flag_array_node ) {
+                        clear_array( base_class::to_array( slot.ptr()), base_class::m_Metrics.array_size, batch ) ;
+                        break ;
+                    }
+                    if ( slot.bits() == base_class::flag_array_converting ) {
+                        bkoff() ;
+                        slot = p->load( memory_model::memory_order_acquire ) ;
+                        continue ;
+                    }
+                    if ( !slot.ptr() )
+                        break ;
+                    if ( p->compare_exchange_strong( slot, node_ptr(), memory_model::memory_order_acquire, CDS_ATOMIC::memory_order_relaxed )) {
+                        --base_class::m_ItemCounter ;
+                        batch.template push<disposer>( slot.ptr() ) ;
+                        break ;
+                    }
+                }
+            }
+        }
+        //@endcond
+
+    public:
+        /// Creates empty set
+        /**
+            \p head_bits - 2**head_bits is the size of the head array. Default is 8 (256 slots).
+            \p array_bits - 2**array_bits is the size of each array node. Default is 4 (16 slots).
+
+            The values are bounded: <tt>2 <= head_bits <= 24</tt>, <tt>2 <= array_bits <= 16</tt>,
+            and none of them can exceed the bit count of \ref hash_type.
+        */
+        MultiLevelHashSet( size_t head_bits = 8, size_t array_bits = 4 )
+            : base_class( head_bits, array_bits )
+        {}
+
+        /// Destroys the set
+        /**
+            The destructor calls \ref clear() and frees all array nodes.
+        */
+        ~MultiLevelHashSet()
+        {
+            clear() ;
+        }
+
+        /// Inserts new node
+        /**
+            The function inserts \p val in the set if it does not contain
+            an item with the hash value equal to the hash of \p val.
+
+            Returns \p true if \p val is placed into the set, \p false otherwise.
+        */
+        bool insert( value_type& val )
+        {
+            return do_insert( val, empty_insert_functor() ) ;
+        }
+
+        /// Inserts new node
+        /**
+            This function is intended for derived non-intrusive containers.
+
+            The function allows to split creating of new item into two part:
+            - create item with hash only
+            - insert new item into the set
+            - if inserting is success, calls  \p f functor to initialize value-field of \p val.
+
+            The functor signature is:
+            \code
+                void func( value_type& val ) ;
+            \endcode
+            where \p val is the item inserted. User-defined functor \p f should guarantee that during changing
+            \p val no any other changes could be made on this set's item by concurrent threads.
+            The user-defined functor is called only if the inserting is success and can be passed by reference
+            using <tt>boost::ref</tt>
+        */
+        template <typename Func>
+        bool insert( value_type& val, Func f )
+        {
+            return do_insert( val, f ) ;
+        }
+
+        /// Ensures that the \p val exists in the set
+        /**
+            The operation performs inserting or changing data with lock-free manner.
+
+            If the item with the hash equal to the hash of \p val is not found in the set, then \p val is inserted.
+            Otherwise, the functor \p func is called with item found.
+            The functor signature is:
+            \code
+                void func( bool bNew, value_type& item, value_type& val ) ;
+            \endcode
+            with arguments:
+            - \p bNew - \p true if the item has been inserted, \p false otherwise
+            - \p item - item of the set
+            - \p val - argument \p val passed into the \p ensure function
+            If new item has been inserted (i.e. \p bNew is \p true) then \p item and \p val arguments
+            refers to the same thing.
+
+            The functor may change non-hash fields of the \p item; however, \p func must guarantee
+            that during changing no any other modifications could be made on this item by concurrent threads.
+            To replace the item atomically use \ref update.
+
+            You may pass \p func argument by reference using <tt>boost::ref</tt> or cds::ref.
+
+            Returns std::pair<bool, bool> where \p first is \p true if operation is successfull,
+            \p second is \p true if new item has been added or \p false if the item with the hash of \p val
+            already is in the set.
+        */
+        template <typename Func>
+        std::pair<bool, bool> ensure( value_type& val, Func func )
+        {
+            hash_type const& hash = hash_of( val ) ;
+            guard_type guard ;
+            position pos ;
+
+            while ( true ) {
+                node_ptr slot = traverse( hash, guard, pos ) ;
+                if ( slot.ptr() ) {
+                    if ( hash_equal( hash_of( *slot.ptr()), hash )) {
+                        cds::unref(func)( false, *slot.ptr(), val ) ;
+                        base_class::m_Stat.onEnsureExisting() ;
+                        return std::make_pair( true, false ) ;
+                    }
+                    if ( !expand( pos, slot ))
+                        return std::make_pair( false, false ) ;
+                }
+                else {
+                    guard.assign( &val ) ;
+                    node_ptr pNull ;
+                    if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong( pNull, node_ptr( &val ), memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed )) {
+                        cds::unref(func)( true, val, val ) ;
+                        ++base_class::m_ItemCounter ;
+                        base_class::m_Stat.onEnsureNew() ;
+                        return std::make_pair( true, true ) ;
+                    }
+                }
+                base_class::m_Stat.onInsertRetry() ;
+            }
+        }
+
+        /// Updates the node
+        /**
+            Performs inserting or replacing with lock-free manner.
+
+            If the item with the hash equal to the hash of \p val is found in the set, the item is atomically
+            replaced with \p val and the old item is passed to the garbage collector for disposing.
+            If the item is not found and \p bInsert is \p true, \p val is inserted into the set.
+
+            Returns std::pair<bool, bool> where \p first is \p true if operation is successfull
+            (i.e. the item has been inserted or replaced), \p second is \p true if new item has been added
+            or \p false if the item has been replaced or \p bInsert is \p false and the item is not found.
+        */
+        std::pair<bool, bool> update( value_type& val, bool bInsert = true )
+        {
+            hash_type const& hash = hash_of( val ) ;
+            guard_type guard ;
+            position pos ;
+
+            while ( true ) {
+                node_ptr slot = traverse( hash, guard, pos ) ;
+                if ( slot.ptr() ) {
+                    if ( hash_equal( hash_of( *slot.ptr()), hash )) {
+                        if ( slot.ptr() == &val ) {
+                            base_class::m_Stat.onUpdateExisting() ;
+                            return std::make_pair( true, false ) ;
+                        }
+                        if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong( slot, node_ptr( &val ), memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed )) {
+                            retire_node( slot.ptr() ) ;
+                            base_class::m_Stat.onUpdateExisting() ;
+                            return std::make_pair( true, false ) ;
+                        }
+                    }
+                    else if ( !bInsert ) {
+                        base_class::m_Stat.onUpdateFailed() ;
+                        return std::make_pair( false, false ) ;
+                    }
+                    else if ( !expand( pos, slot ))
+                        return std::make_pair( false, false ) ;
+                }
+                else {
+                    if ( !bInsert ) {
+                        base_class::m_Stat.onUpdateFailed() ;
+                        return std::make_pair( false, false ) ;
+                    }
+                    node_ptr pNull ;
+                    if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong( pNull, node_ptr( &val ), memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed )) {
+                        ++base_class::m_ItemCounter ;
+                        base_class::m_Stat.onUpdateNew() ;
+                        return std::make_pair( true, true ) ;
+                    }
+                }
+                base_class::m_Stat.onUpdateRetry() ;
+            }
+        }
+
+        /// Unlinks the item \p val from the set
+        /**
+            The function searches the item \p val in the set and unlink it from the set
+            if it is found and is equal to \p val (here, the equality means that
+            \p val belongs to the set: if \p item is an item found then
+            unlink is successful iif <tt>&val == &item</tt>)
+
+            The \ref disposer specified in \p Traits class template parameter is called
+            by garbage collector \p GC asynchronously.
+
+            The function returns \p true if success and \p false otherwise.
+        */
+        bool unlink( value_type const& val )
+        {
+            return do_erase( hash_of( val ), empty_erase_functor(), &val ) ;
+        }
+
+        /// Deletes the item from the set
+        /** \anchor cds_intrusive_MultiLevelHashSet_hp_erase
+            The function searches an item with the hash value equal to \p hash in the set,
+            unlinks it from the set, and returns \p true.
+            If the item is not found the function return \p false.
+
+            The \ref disposer specified in \p Traits class template parameter is called
+            by garbage collector \p GC asynchronously.
+        */
+        bool erase( hash_type const& hash )
+        {
+            return do_erase( hash, empty_erase_functor(), null_ptr<value_type const *>() ) ;
+        }
+
+        /// Deletes the item from the set
+        /**
+            The function is an analog of \ref cds_intrusive_MultiLevelHashSet_hp_erase "erase(hash_type const&)"
+            but calls \p f functor with the item unlinked before passing it to the garbage collector.
+            The \p Func interface is
+            \code
+            struct functor {
+                void operator()( value_type const& item ) ;
+            } ;
+            \endcode
+            The functor can be passed by reference with <tt>boost:ref</tt>
+        */
+        template <typename Func>
+        bool erase( hash_type const& hash, Func f )
+        {
+            return do_erase( hash, f, null_ptr<value_type const *>() ) ;
+        }
+
+        /// Finds an item by the hash value
+        /** \anchor cds_intrusive_MultiLevelHashSet_hp_find_func
+            The function searches the item with the hash value equal to \p hash
+            and calls the functor \p f for item found.
+            The interface of \p Func functor is:
+            \code
+            struct functor {
+                void operator()( value_type& item ) ;
+            };
+            \endcode
+            The functor may change non-hash fields of \p item. Note that the functor is only guarantee
+            that \p item cannot be disposed during functor is executing.
+            The functor does not serialize simultaneous access to the set \p item. If such access is
+            possible you must provide your own synchronization schema on item level to exclude unsafe item modifications.
+
+            You can pass \p f argument by value or by reference using <tt>boost::ref</tt> or cds::ref.
+
+            The function returns \p true if the item is found, \p false otherwise.
+        */
+        template <typename Func>
+        bool find( hash_type const& hash, Func f )
+        {
+            return do_find( hash, f ) ;
+        }
+
+        /// Checks if the set contains an item with the hash value \p hash
+        bool find( hash_type const& hash )
+        {
+            return do_find( hash, empty_find_functor() ) ;
+        }
+
+        /// Clears the set (non-atomic)
+        /**
+            The function unlinks all items from the set.
+            The function is not atomic: the items inserted concurrently may stay in the set.
+            The array nodes are not freed, they are reused by further insertions.
+
+            The items unlinked are passed to the garbage collector by one \p retire_batch call,
+            the \ref disposer is called for each item asynchronously.
+        */
+        void clear()
+        {
+            cds::gc::details::retired_batch< gc > batch ;
+            clear_array( base_class::m_Head, base_class::m_Metrics.head_size, batch ) ;
+            batch.retire() ;
+        }
+
+        /// Checks if the set is empty
+        /**
+            Emptiness is checked by item counting: if item count is zero then the set is empty.
+            Thus, the correct item counting feature is an important part of the set implementation.
+        */
+        bool empty() const
+        {
+            return size() == 0 ;
+        }
+
+        /// Returns item count in the set
+        size_t size() const
+        {
+            return base_class::m_ItemCounter ;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return base_class::m_Stat ;
+        }
+
+        /// Returns the size of the head array
+        size_t head_size() const
+        {
+            return base_class::head_size() ;
+        }
+
+        /// Returns the size of the array node
+        size_t array_node_size() const
+        {
+            return base_class::array_node_size() ;
+        }
+
+        /// Collects tree level statistics into \p stat
+        /**
+            The function traverses the set and gathers for each level of the tree the count of array nodes,
+            data slots, array slots and empty slots. The statistics is not consistent if the set is modified concurrently.
+        */
+        void get_level_statistics( std::vector< level_statistics >& stat ) const
+        {
+            base_class::get_level_statistics( stat ) ;
+        }
+    };
+
+}} // namespace cds::intrusive
+
+#endif // #ifndef __CDS_INTRUSIVE_MULTILEVEL_HASHSET_IMPL_H
@@ -0,0 +1,760 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_INTRUSIVE_MULTILEVEL_HASHSET_RCU_H
+#define __CDS_INTRUSIVE_MULTILEVEL_HASHSET_RCU_H
+
+#include <cds/intrusive/multilevel_hashset_base.h>
+#include <cds/gc/details/retired_batch.h>
+#include <cds/urcu/details/check_deadlock.h>
+#include <cds/details/make_const_type.h>
+#include <cds/ref.h>
+
+namespace cds { namespace intrusive {
+
+    /// Lock-free multi-level hash set (template specialization for \ref cds_urcu_desc "RCU")
+    /** @ingroup cds_intrusive_map
+        \anchor cds_intrusive_MultiLevelHashSet_rcu
+
+        Source:
+            - [2013] Steven Feldman, Pierre LaBorde, Damian Dechev "Concurrent Multi-level Arrays:
+                Wait-free Extensible Hash Maps"
+
+        See \ref cds_intrusive_MultiLevelHashSet_hp "MultiLevelHashSet" for the algorithm description
+        and for the list of options. The RCU specialization has the same interface with the following differences:
+        - search and modifying functions lock RCU internally; the functions that may dispose an item
+            (\p erase, \p unlink, \p update, \p clear) must be called outside RCU read-side critical section,
+            the check is performed by opt::rcu_check_deadlock policy;
+        - \ref get and \ref extract functions require RCU to be locked by the caller;
+        - the iterator does not guard the item, RCU must be locked for all the time of iterating.
+
+        Template arguments:
+        - \p RCU - one of \ref cds_urcu_gc "RCU type"
+        - \p T - type to be stored in the set, see \ref cds_intrusive_MultiLevelHashSet_hp "MultiLevelHashSet"
+        - \p Traits - type traits. See multilevel_hashset::type_traits for explanation.
+
+        @note Before including <tt><cds/intrusive/multilevel_hashset_rcu.h></tt> you should include appropriate RCU header file,
+        see \ref cds_urcu_gc "RCU type" for list of existing RCU class and corresponding header files.
+    */
+    template <
+        class RCU,
+        typename T,
+#ifdef CDS_DOXYGEN_INVOKED
+        class Traits = multilevel_hashset::type_traits
+#else
+        class Traits
+#endif
+    >
+    class MultiLevelHashSet< cds::urcu::gc< RCU >, T, Traits >: protected multilevel_hashset::details::multilevel_array< T, Traits >
+    {
+        //@cond
+        typedef multilevel_hashset::details::multilevel_array< T, Traits > base_class ;
+        //@endcond
+
+    public:
+        typedef cds::urcu::gc< RCU >    gc          ;   ///< RCU garbage collector
+        typedef T                       value_type  ;   ///< type of value stored in the set
+        typedef Traits                  options     ;   ///< Traits template parameter
+
+        typedef typename base_class::hash_accessor      hash_accessor   ;   ///< Hash accessor functor
+        typedef typename base_class::hash_type          hash_type       ;   ///< Hash value type
+        typedef typename base_class::hash_comparator    hash_comparator ;   ///< Hash value comparing functor
+        typedef typename options::disposer              disposer        ;   ///< Item disposer
+        typedef typename base_class::item_counter       item_counter    ;   ///< Item counting policy used
+        typedef typename base_class::memory_model       memory_model    ;   ///< Memory ordering. See cds::opt::memory_model option
+        typedef typename base_class::back_off           back_off        ;   ///< Back-off strategy
+        typedef typename base_class::stat               stat            ;   ///< Internal statistics type
+        typedef typename options::rcu_check_deadlock    rcu_check_deadlock ; ///< Deadlock checking policy
+
+        typedef multilevel_hashset::level_statistics    level_statistics ;  ///< Level statistics, see \ref get_level_statistics
+
+        typedef typename gc::scoped_lock    rcu_lock ;  ///< RCU scoped lock
+
+    protected:
+        //@cond
+        typedef typename base_class::node_ptr           node_ptr        ;
+        typedef typename base_class::atomic_node_ptr    atomic_node_ptr ;
+        typedef typename base_class::array_node         array_node      ;
+        typedef typename base_class::splitter_type      splitter_type   ;
+
+        typedef cds::urcu::details::check_deadlock_policy< gc, rcu_check_deadlock>   check_deadlock_policy ;
+
+        struct position {
+            array_node *    pArr    ;
+            size_t          nSlot   ;
+            size_t          nOffset ;
+        };
+
+        struct empty_insert_functor {
+            void operator()( value_type& ) const
+            {}
+        };
+
+        struct empty_erase_functor {
+            void operator()( value_type const& ) const
+            {}
+        };
+
+        struct empty_find_functor {
+            void operator()( value_type const& ) const
+            {}
+        };
+        //@endcond
+
+    protected:
+        //@cond
+        template <bool IsConst>
+        class iterator_type
+        {
+            friend class MultiLevelHashSet ;
+
+        public:
+            typedef T   value_type ;
+            static bool const c_isConst = IsConst ;
+
+        protected:
+            typedef MultiLevelHashSet   set_type    ;
+
+            set_type const *    m_pSet      ;
+            array_node *        m_pNode     ;
+            size_t              m_idx       ;
+            value_type *        m_pValue    ;
+
+        public:
+            typedef typename cds::details::make_const_type<value_type, IsConst>::pointer   value_ptr ;
+            typedef typename cds::details::make_const_type<value_type, IsConst>::reference value_ref ;
+
+        protected:
+            iterator_type( set_type const& s, array_node * pNode, size_t idx )
+                : m_pSet( &s )
+                , m_pNode( null_ptr<array_node *>())
+                , m_idx( 0 )
+                , m_pValue( null_ptr<value_type *>())
+            {
+                forward( pNode, idx ) ;
+            }
+
+            void forward( array_node * pNode, size_t idx )
+            {
+                // RCU should be locked before iterating!!!
+                assert( gc::is_locked() ) ;
+
+                back_off bkoff ;
+                while ( true ) {
+                    if ( idx >= m_pSet->array_size( pNode )) {
+                        if ( !pNode->pParent ) {
+                            m_pNode = null_ptr<array_node *>() ;
+                            m_idx = 0 ;
+                            m_pValue = null_ptr<value_type *>() ;
+                            return ;
+                        }
+                        idx = pNode->idxParent + 1 ;
+                        pNode = pNode->pParent ;
+                        continue ;
+                    }
+
+                    node_ptr slot = pNode->nodes[idx].load( memory_model::memory_order_acquire ) ;
+                    if ( slot.bits() == base_class::flag_array_node ) {
+                        pNode = base_class::to_array( slot.ptr()) ;
+                        idx = 0 ;
+                    }
+                    else if ( slot.bits() == base_class::flag_array_converting )
+                        bkoff() ;
+                    else if ( slot.ptr() ) {
+                        m_pNode = pNode ;
+                        m_idx = idx ;
+                        m_pValue = slot.ptr() ;
+                        return ;
+                    }
+                    else
+                        ++idx ;
+                }
+            }
+
+        public:
+            iterator_type()
+                : m_pSet( null_ptr<set_type const *>())
+                , m_pNode( null_ptr<array_node *>())
+                , m_idx( 0 )
+                , m_pValue( null_ptr<value_type *>())
+            {}
+
+            value_ptr operator ->() const
+            {
+                return m_pValue ;
+            }
+
+            value_ref operator *() const
+            {
+                assert( m_pValue != null_ptr<value_type *>() ) ;
+                return *m_pValue ;
+            }
+
+            /// Pre-increment
+            iterator_type& operator ++()
+            {
+                if ( m_pNode )
+                    forward( m_pNode, m_idx + 1 ) ;
+                return *this ;
+            }
+
+            template <bool C>
+            bool operator ==(iterator_type<C> const& i ) const
+            {
+                return m_pNode == i.m_pNode && m_idx == i.m_idx && m_pValue == i.m_pValue ;
+            }
+            template <bool C>
+            bool operator !=(iterator_type<C> const& i ) const
+            {
+                return !( *this == i ) ;
+            }
+        };
+        //@endcond
+
+    public:
+        /// Forward iterator
+        /**
+            The iterator does not guard the item it points to, so, RCU must be locked
+            during whole life of the iterator object.
+        */
+        typedef iterator_type<false>    iterator        ;
+        /// Const forward iterator
+        typedef iterator_type<true>     const_iterator  ;
+
+        /// Returns a forward iterator addressing the first element in a set
+        iterator begin()
+        {
+            return iterator( *this, base_class::m_Head, 0 ) ;
+        }
+
+        /// Returns a forward const iterator addressing the first element in a set
+        const_iterator begin() const
+        {
+            return const_iterator( *this, base_class::m_Head, 0 ) ;
+        }
+
+        /// Returns a forward const iterator addressing the first element in a set
+        const_iterator cbegin()
+        {
+            return const_iterator( *this, base_class::m_Head, 0 ) ;
+        }
+
+        /// Returns a forward iterator that addresses the location succeeding the last element in a set.
+        iterator end()
+        {
+            return iterator() ;
+        }
+
+        /// Returns a forward const iterator that addresses the location succeeding the last element in a set.
+        const_iterator end() const
+        {
+            return const_iterator() ;
+        }
+
+        /// Returns a forward const iterator that addresses the location succeeding the last element in a set.
+        const_iterator cend()
+        {
+            return const_iterator() ;
+        }
+
+    protected:
+        //@cond
+        static hash_type const& hash_of( value_type const& val )
+        {
+            return hash_accessor()( val ) ;
+        }
+
+        static bool hash_equal( hash_type const& h1, hash_type const& h2 )
+        {
+            return hash_comparator()( h1, h2 ) == 0 ;
+        }
+
+        static void retire_node( value_type * p )
+        {
+            assert( !gc::is_locked() ) ;
+            gc::template retire_ptr<disposer>( p ) ;
+        }
+
+        // Finds the data slot for hash. RCU must be locked
+        node_ptr traverse( hash_type const& hash, position& pos )
+        {
+            assert( gc::is_locked() ) ;
+
+            splitter_type splitter( hash ) ;
+            pos.pArr = base_class::m_Head ;
+            pos.nSlot = splitter.cut( base_class::m_Metrics.head_bits ) ;
+
+            back_off bkoff ;
+            while ( true ) {
+                node_ptr slot = pos.pArr->nodes[pos.nSlot].load( memory_model::memory_order_acquire ) ;
+                if ( slot.bits() == base_class::flag_array_node ) {
+                    assert( !splitter.eos()) ;
+                    pos.pArr = base_class::to_array( slot.ptr()) ;
+                    pos.nSlot = splitter.cut( base_class::m_Metrics.array_bits ) ;
+                    continue ;
+                }
+                if ( slot.bits() == base_class::flag_array_converting ) {
+                    base_class::m_Stat.onSlotConverting() ;
+                    bkoff() ;
+                    continue ;
+                }
+                pos.nOffset = splitter.bit_offset() ;
+                return slot ;
+            }
+        }
+
+        bool expand( position& pos, node_ptr slot )
+        {
+            if ( pos.nOffset >= splitter_type::c_nHashBitCount ) {
+                assert( false ) ;
+                return false ;
+            }
+            base_class::expand_slot( pos.pArr, pos.nSlot, slot, pos.nOffset ) ;
+            return true ;
+        }
+
+        template <typename Func>
+        bool do_insert( value_type& val, Func f )
+        {
+            hash_type const& hash = hash_of( val ) ;
+            position pos ;
+
+            rcu_lock l ;
+            while ( true ) {
+                node_ptr slot = traverse( hash, pos ) ;
+                if ( slot.ptr() ) {
+                    if ( hash_equal( hash_of( *slot.ptr()), hash ) || !expand( pos, slot )) {
+                        base_class::m_Stat.onInsertFailed() ;
+                        return false ;
+                    }
+                }
+                else {
+                    node_ptr pNull ;
+                    if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong( pNull, node_ptr( &val ), memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed )) {
+                        cds::unref(f)( val ) ;
+                        ++base_class::m_ItemCounter ;
+                        base_class::m_Stat.onInsertSuccess() ;
+                        return true ;
+                    }
+                }
+                base_class::m_Stat.onInsertRetry() ;
+            }
+        }
+
+        // Unlinks the item with hash; RCU must be locked
+        template <typename Func>
+        value_type * do_extract( hash_type const& hash, Func f, value_type const * pWhat )
+        {
+            position pos ;
+            while ( true ) {
+                node_ptr slot = traverse( hash, pos ) ;
+                if ( !slot.ptr() || !hash_equal( hash_of( *slot.ptr()), hash ) || ( pWhat && slot.ptr() != pWhat )) {
+                    base_class::m_Stat.onEraseFailed() ;
+                    return null_ptr<value_type *>() ;
+                }
+
+                if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong( slot, node_ptr(), memory_model::memory_order_acquire, CDS_ATOMIC::memory_order_relaxed )) {
+                    --base_class::m_ItemCounter ;
+                    cds::unref(f)( *slot.ptr() ) ;
+                    base_class::m_Stat.onEraseSuccess() ;
+                    return slot.ptr() ;
+                }
+                base_class::m_Stat.onEraseRetry() ;
+            }
+        }
+
+        template <typename Func>
+        bool do_erase( hash_type const& hash, Func f, value_type const * pWhat )
+        {
+            check_deadlock_policy::check() ;
+
+            value_type * pDel ;
+            {
+                rcu_lock l ;
+                pDel = do_extract( hash, f, pWhat ) ;
+            }
+
+            if ( pDel ) {
+                retire_node( pDel ) ;
+                return true ;
+            }
+            return false ;
+        }
+
+        template <typename Func>
+        bool do_find( hash_type const& hash, Func f )
+        {
+            position pos ;
+            rcu_lock l ;
+
+            node_ptr slot = traverse( hash, pos ) ;
+            if ( slot.ptr() && hash_equal( hash_of( *slot.ptr()), hash )) {
+                cds::unref(f)( *slot.ptr() ) ;
+                base_class::m_Stat.onFindSuccess() ;
+                return true ;
+            }
+            base_class::m_Stat.onFindFailed() ;
+            return false ;
+        }
+
+        void clear_array( array_node * pArr, size_t nSize, cds::gc::details::retired_batch< gc >& batch )
+        {
+            back_off bkoff ;
+            for ( atomic_node_ptr * p = pArr->nodes, *pLast = pArr->nodes + nSize; p != pLast; ++p ) {
+                node_ptr slot = p->load( memory_model::memory_order_acquire ) ;
+                while ( true ) {
+                    if ( slot.bits() == base_class::flag_array_node ) {
+                        clear_array( base_class::to_array( slot.ptr()), base_class::m_Metrics.array_size, batch ) ;
+                        break ;
+                    }
+                    if ( slot.bits() == base_class::flag_array_converting ) {
+                        bkoff() ;
+                        slot = p->load( memory_model::memory_order_acquire ) ;
+                        continue ;
+                    }
+                    if ( !slot.ptr() )
+                        break ;
+                    if ( p->compare_exchange_strong( slot, node_ptr(), memory_model::memory_order_acquire, CDS_ATOMIC::memory_order_relaxed )) {
+                        --base_class::m_ItemCounter ;
+                        batch.template push<disposer>( slot.ptr() ) ;
+                        break ;
+                    }
+                }
+            }
+        }
+        //@endcond
+
+    public:
+        /// Creates empty set
+        /**
+            See \ref cds_intrusive_MultiLevelHashSet_hp "MultiLevelHashSet" constructor for explanation of the arguments.
+        */
+        MultiLevelHashSet( size_t head_bits = 8, size_t array_bits = 4 )
+            : base_class( head_bits, array_bits )
+        {}
+
+        /// Destroys the set
+        ~MultiLevelHashSet()
+        {
+            clear() ;
+        }
+
+        /// Inserts new node
+        /**
+            The function inserts \p val in the set if it does not contain
+            an item with the hash value equal to the hash of \p val.
+
+            The function applies RCU lock internally.
+
+            Returns \p true if \p val is placed into the set, \p false otherwise.
+        */
+        bool insert( value_type& val )
+        {
+            return do_insert( val, empty_insert_functor() ) ;
+        }
+
+        /// Inserts new node
+        /**
+            The function is an analog of \ref insert( value_type& ) but calls the functor
+            \code
+                void func( value_type& val ) ;
+            \endcode
+            after successful inserting. The functor is called under RCU lock.
+        */
+        template <typename Func>
+        bool insert( value_type& val, Func f )
+        {
+            return do_insert( val, f ) ;
+        }
+
+        /// Ensures that the \p val exists in the set
+        /**
+            If the item with the hash of \p val is not found in the set, then \p val is inserted.
+            Otherwise, the functor \p func is called with item found.
+            The functor signature is:
+            \code
+                void func( bool bNew, value_type& item, value_type& val ) ;
+            \endcode
+            The functor is called under RCU lock.
+
+            Returns std::pair<bool, bool> where \p first is \p true if operation is successfull,
+            \p second is \p true if new item has been added or \p false if the item with the hash of \p val
+            already is in the set.
+        */
+        template <typename Func>
+        std::pair<bool, bool> ensure( value_type& val, Func func )
+        {
+            hash_type const& hash = hash_of( val ) ;
+            position pos ;
+
+            rcu_lock l ;
+            while ( true ) {
+                node_ptr slot = traverse( hash, pos ) ;
+                if ( slot.ptr() ) {
+                    if ( hash_equal( hash_of( *slot.ptr()), hash )) {
+                        cds::unref(func)( false, *slot.ptr(), val ) ;
+                        base_class::m_Stat.onEnsureExisting() ;
+                        return std::make_pair( true, false ) ;
+                    }
+                    if ( !expand( pos, slot ))
+                        return std::make_pair( false, false ) ;
+                }
+                else {
+                    node_ptr pNull ;
+                    if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong( pNull, node_ptr( &val ), memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed )) {
+                        cds::unref(func)( true, val, val ) ;
+                        ++base_class::m_ItemCounter ;
+                        base_class::m_Stat.onEnsureNew() ;
+                        return std::make_pair( true, true ) ;
+                    }
+                }
+                base_class::m_Stat.onInsertRetry() ;
+            }
+        }
+
+        /// Updates the node
+        /**
+            If the item with the hash of \p val is found in the set, the item is atomically
+            replaced with \p val and the old item is passed to RCU for disposing.
+            If the item is not found and \p bInsert is \p true, \p val is inserted into the set.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+
+            Returns std::pair<bool, bool> where \p first is \p true if operation is successfull,
+            \p second is \p true if new item has been added.
+        */
+        std::pair<bool, bool> update( value_type& val, bool bInsert = true )
+        {
+            check_deadlock_policy::check() ;
+
+            hash_type const& hash = hash_of( val ) ;
+            position pos ;
+            value_type * pOld = null_ptr<value_type *>() ;
+            std::pair<bool, bool> ret ;
+
+            {
+                rcu_lock l ;
+                while ( true ) {
+                    node_ptr slot = traverse( hash, pos ) ;
+                    if ( slot.ptr() ) {
+                        if ( hash_equal( hash_of( *slot.ptr()), hash )) {
+                            if ( slot.ptr() == &val ) {
+                                base_class::m_Stat.onUpdateExisting() ;
+                                ret = std::make_pair( true, false ) ;
+                                break ;
+                            }
+                            if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong( slot, node_ptr( &val ), memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed )) {
+                                pOld = slot.ptr() ;
+                                base_class::m_Stat.onUpdateExisting() ;
+                                ret = std::make_pair( true, false ) ;
+                                break ;
+                            }
+                        }
+                        else if ( !bInsert ) {
+                            base_class::m_Stat.onUpdateFailed() ;
+                            ret = std::make_pair( false, false ) ;
+                            break ;
+                        }
+                        else if ( !expand( pos, slot )) {
+                            ret = std::make_pair( false, false ) ;
+                            break ;
+                        }
+                    }
+                    else {
+                        if ( !bInsert ) {
+                            base_class::m_Stat.onUpdateFailed() ;
+                            ret = std::make_pair( false, false ) ;
+                            break ;
+                        }
+                        node_ptr pNull ;
+                        if ( pos.pArr->nodes[pos.nSlot].compare_exchange_strong( pNull, node_ptr( &val ), memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed )) {
+                            ++base_class::m_ItemCounter ;
+                            base_class::m_Stat.onUpdateNew() ;
+                            ret = std::make_pair( true, true ) ;
+                            break ;
+                        }
+                    }
+                    base_class::m_Stat.onUpdateRetry() ;
+                }
+            }
+
+            if ( pOld )
+                retire_node( pOld ) ;
+            return ret ;
+        }
+
+        /// Unlinks the item \p val from the set
+        /**
+            The function unlinks \p val from the set if \p val belongs to the set.
+            The \ref disposer specified in \p Traits class template parameter is called by RCU asynchronously.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        bool unlink( value_type const& val )
+        {
+            return do_erase( hash_of( val ), empty_erase_functor(), &val ) ;
+        }
+
+        /// Deletes the item from the set
+        /** \anchor cds_intrusive_MultiLevelHashSet_rcu_erase
+            The function searches an item with the hash value equal to \p hash in the set,
+            unlinks it from the set, and returns \p true.
+            If the item is not found the function return \p false.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        bool erase( hash_type const& hash )
+        {
+            return do_erase( hash, empty_erase_functor(), null_ptr<value_type const *>() ) ;
+        }
+
+        /// Deletes the item from the set
+        /**
+            The function is an analog of \ref cds_intrusive_MultiLevelHashSet_rcu_erase "erase(hash_type const&)"
+            but calls \p f functor with the item unlinked. The \p Func interface is
+            \code
+            struct functor {
+                void operator()( value_type const& item ) ;
+            } ;
+            \endcode
+            The functor is called under RCU lock.
+        */
+        template <typename Func>
+        bool erase( hash_type const& hash, Func f )
+        {
+            return do_erase( hash, f, null_ptr<value_type const *>() ) ;
+        }
+
+        /// Extracts an item from the set
+        /**
+            The function searches an item with the hash value equal to \p hash,
+            unlinks it from the set, and returns pointer to an item found.
+            If the item is not found the function returns \p NULL.
+
+            @note The function does NOT lock RCU and does NOT dispose the item found.
+            You should lock RCU before calling of the function, and you should synchronize RCU
+            outside the RCU lock before reusing or deleting returned pointer.
+        */
+        value_type * extract( hash_type const& hash )
+        {
+            assert( gc::is_locked() ) ;
+            return do_extract( hash, empty_erase_functor(), null_ptr<value_type const *>() ) ;
+        }
+
+        /// Finds an item by the hash value
+        /**
+            The function searches the item with the hash value equal to \p hash
+            and calls the functor \p f for item found:
+            \code
+            struct functor {
+                void operator()( value_type& item ) ;
+            };
+            \endcode
+            The functor is called under RCU lock.
+
+            The function returns \p true if the item is found, \p false otherwise.
+        */
+        template <typename Func>
+        bool find( hash_type const& hash, Func f )
+        {
+            return do_find( hash, f ) ;
+        }
+
+        /// Checks if the set contains an item with the hash value \p hash
+        bool find( hash_type const& hash )
+        {
+            return do_find( hash, empty_find_functor() ) ;
+        }
+
+        /// Finds an item by the hash value and returns the pointer to it
+        /**
+            The function returns \p NULL if the item is not found.
+
+            RCU should be locked before call of this function, and the returned pointer is valid
+            only while RCU is locked.
+        */
+        value_type * get( hash_type const& hash )
+        {
+            assert( gc::is_locked() ) ;
+
+            position pos ;
+            node_ptr slot = traverse( hash, pos ) ;
+            if ( slot.ptr() && hash_equal( hash_of( *slot.ptr()), hash )) {
+                base_class::m_Stat.onFindSuccess() ;
+                return slot.ptr() ;
+            }
+            base_class::m_Stat.onFindFailed() ;
+            return null_ptr<value_type *>() ;
+        }
+
+        /// Clears the set (non-atomic)
+        /**
+            The function unlinks all items from the set.
+            The items unlinked are passed to RCU by one \p retire_batch call,
+            so, RCU is synchronized at most once for the whole set.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        void clear()
+        {
+            check_deadlock_policy::check() ;
+
+            cds::gc::details::retired_batch< gc > batch ;
+            {
+                rcu_lock l ;
+                clear_array( base_class::m_Head, base_class::m_Metrics.head_size, batch ) ;
+            }
+            batch.retire() ;
+        }
+
+        /// Checks if the set is empty
+        /**
+            Emptiness is checked by item counting: if item count is zero then the set is empty.
+        */
+        bool empty() const
+        {
+            return size() == 0 ;
+        }
+
+        /// Returns item count in the set
+        size_t size() const
+        {
+            return base_class::m_ItemCounter ;
+        }
+
+        /// Returns const reference to internal statistics
+        stat const& statistics() const
+        {
+            return base_class::m_Stat ;
+        }
+
+        /// Returns the size of the head array
+        size_t head_size() const
+        {
+            return base_class::head_size() ;
+        }
+
+        /// Returns the size of the array node
+        size_t array_node_size() const
+        {
+            return base_class::array_node_size() ;
+        }
+
+        /// Collects tree level statistics into \p stat
+        void get_level_statistics( std::vector< level_statistics >& stat ) const
+        {
+            base_class::get_level_statistics( stat ) ;
+        }
+    };
+
+}} // namespace cds::intrusive
+
+#endif // #ifndef __CDS_INTRUSIVE_MULTILEVEL_HASHSET_RCU_H
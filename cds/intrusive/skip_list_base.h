@@ -366,6 +366,14 @@ namespace cds { namespace intrusive {
             event_counter   m_nFindFastFailed       ; ///< Count of failed call of \p find and all derivatives (via fast-path)
             event_counter   m_nFindSlowSuccess      ; ///< Count of successful call of \p find and all derivatives (via slow-path)
             event_counter   m_nFindSlowFailed       ; ///< Count of failed call of \p find and all derivatives (via slow-path)
+            event_counter   m_nCursorFastStep       ; ///< Count of range cursor steps done by following the link of current node
+            event_counter   m_nCursorSlowStep       ; ///< Count of range cursor steps done by searching from the head (current node has been deleted)
+            event_counter   m_nExtractMinSuccess    ; ///< Count of successful call of \p extract_min
+            event_counter   m_nExtractMinFailed     ; ///< Count of failed call of \p extract_min (the set is empty)
+            event_counter   m_nExtractMinRetries    ; ///< Count of \p extract_min retries (the item found has been removed by another thread)
+            event_counter   m_nExtractMaxSuccess    ; ///< Count of successful call of \p extract_max
+            event_counter   m_nExtractMaxFailed     ; ///< Count of failed call of \p extract_max (the set is empty)
+            event_counter   m_nExtractMaxRetries    ; ///< Count of \p extract_max retries (the item found has been removed by another thread)
 
             //@cond
             void onAddNode( unsigned int nHeight )
@@ -392,6 +400,14 @@ namespace cds { namespace intrusive {
             void onFindFastFailed()     { ++m_nFindFastFailed   ; }
             void onFindSlowSuccess()    { ++m_nFindSlowSuccess  ; }
             void onFindSlowFailed()     { ++m_nFindSlowFailed   ; }
+            void onCursorFastStep()     { ++m_nCursorFastStep   ; }
+            void onCursorSlowStep()     { ++m_nCursorSlowStep   ; }
+            void onExtractMinSuccess()  { ++m_nExtractMinSuccess; }
+            void onExtractMinFailed()   { ++m_nExtractMinFailed ; }
+            void onExtractMinRetry()    { ++m_nExtractMinRetries; }
+            void onExtractMaxSuccess()  { ++m_nExtractMaxSuccess; }
+            void onExtractMaxFailed()   { ++m_nExtractMaxFailed ; }
+            void onExtractMaxRetry()    { ++m_nExtractMaxRetries; }
 
             //@endcond
         };
@@ -414,6 +430,14 @@ namespace cds { namespace intrusive {
             void onFindFastFailed()  const {}
             void onFindSlowSuccess() const {}
             void onFindSlowFailed()  const {}
+            void onCursorFastStep()  const {}
+            void onCursorSlowStep()  const {}
+            void onExtractMinSuccess() const {}
+            void onExtractMinFailed()  const {}
+            void onExtractMinRetry()   const {}
+            void onExtractMaxSuccess() const {}
+            void onExtractMaxFailed()  const {}
+            void onExtractMaxRetry()   const {}
             //@endcond
         };
 
@@ -593,6 +617,37 @@ namespace cds { namespace intrusive {
             template <class GC, typename NodeTraits, typename BackOff, bool IsConst>
             class iterator ;
 
+            // Comparators for lower_bound/upper_bound searching.
+            // The skip-list search stops at the first node for which the comparator returns non-negative value.
+
+            // Makes the search to stop at the first node that is greater than the key (upper bound)
+            template <typename Compare>
+            struct upper_bound_comparator {
+                template <typename T, typename Q>
+                int operator()( T const& item, Q const& key ) const
+                {
+                    return Compare()( item, key ) <= 0 ? -1 : 1 ;
+                }
+            };
+
+            // Makes the search to stop at the first node of the skip-list
+            struct first_node_comparator {
+                template <typename T, typename Q>
+                int operator()( T const& /*item*/, Q const& /*key*/ ) const
+                {
+                    return 1 ;
+                }
+            };
+
+            // Makes the search to pass over all nodes; pPrev[0] of the position found is the last node
+            struct last_node_comparator {
+                template <typename T, typename Q>
+                int operator()( T const& /*item*/, Q const& /*key*/ ) const
+                {
+                    return -1 ;
+                }
+            };
+
         } // namespace details
         //@endcond
 
@@ -13,6 +13,8 @@
 #define __CDS_INTRUSIVE_SKIP_LIST_IMPL_H
 
 #include <cds/intrusive/skip_list_base.h>
+#include <cds/gc/details/retired_batch.h>
+#include <cds/gc/guarded_ptr.h>
 #include <cds/details/std/type_traits.h>
 #include <cds/details/std/memory.h>
 #include <cds/opt/compare.h>
@@ -380,6 +382,8 @@ namespace cds { namespace intrusive {
         typedef typename options::back_off      back_off    ;   ///< Back-off trategy
         typedef typename options::stat          stat        ;   ///< internal statistics type
 
+        typedef cds::gc::guarded_ptr< gc, value_type > guarded_ptr ; ///< Guarded pointer, see \ref get and \ref extract
+
         /// Max node height. The actual node height should be in range <tt>[0 .. c_nMaxHeight)</tt>
         /**
             The max height is specified by \ref skip_list::random_level_generator "random level generator" constant \p m_nUpperBound
@@ -423,6 +427,12 @@ namespace cds { namespace intrusive {
             typename gc::template GuardArray< c_nMaxHeight * 2 > guards  ;   ///< Guards array for pPrev/pSucc
 
             node_type *   pCur  ;   // guarded by guards; needed only for *ensure* function
+
+            cds::gc::details::retired_batch< gc > * pBatch ;   // if not NULL, physically deleted nodes are placed to this batch instead of retiring
+
+            position()
+                : pBatch( null_ptr< cds::gc::details::retired_batch< gc > *>() )
+            {}
         };
 
 #   ifndef CDS_CXX11_LAMBDA_SUPPORT
@@ -455,6 +465,26 @@ namespace cds { namespace intrusive {
 
 #   endif // ifndef CDS_CXX11_LAMBDA_SUPPORT
 
+        // Assigns the item found to the guard; used by get() and extract()
+        struct guard_assign_functor {
+            typename gc::Guard& m_guard ;
+            guard_assign_functor( typename gc::Guard& guard ) : m_guard( guard ) {}
+
+            void operator()( value_type& item )
+            {
+                m_guard.assign( &item ) ;
+            }
+            void operator()( value_type const& item )
+            {
+                m_guard.assign( const_cast<value_type *>( &item )) ;
+            }
+            template <typename Q>
+            void operator()( value_type& item, Q const& )
+            {
+                m_guard.assign( &item ) ;
+            }
+        };
+
         //@endcond
 
     protected:
@@ -492,25 +522,54 @@ namespace cds { namespace intrusive {
             disposer()( pVal )      ;
         }
 
+        // Checks if pos.pPrev[nLevel] left by previous search can be used as a start node
+        // of the search for val at level nLevel instead of pPred.
+        // pos.pPrev[nLevel] is guarded by pos.guards[nLevel * 2]
+        // The ordering is checked by cmp, the comparator of the current search
+        template <typename Q, typename Compare>
+        bool is_hint_usable( position const& pos, int nLevel, node_type * pPred, Q const& val, Compare cmp )
+        {
+            node_type * pHint = pos.pPrev[ nLevel ] ;
+            if ( pHint == pPred || pHint == m_Head.head() )
+                return false ;
+
+            // The hint must not be logically deleted
+            if ( pHint->next( nLevel ).load( memory_model::memory_order_acquire ).bits() )
+                return false ;
+
+            if ( cmp( *node_traits::to_value_ptr( pHint ), val ) >= 0 )
+                return false ;
+            return pPred == m_Head.head() || cmp( *node_traits::to_value_ptr( pHint ), *node_traits::to_value_ptr( pPred )) > 0 ;
+        }
+
         template <typename Q, typename Compare >
-        bool find_position( Q const& val, position& pos, Compare cmp, bool bStopIfFound )
+        bool find_position( Q const& val, position& pos, Compare cmp, bool bStopIfFound, bool bHint = false )
         {
             node_type * pPred ;
             marked_node_ptr pSucc ;
             marked_node_ptr pCur ;
 
             int nCmp = 1    ;
+            int nLevel      ;
+            unsigned int nAttempt = 0 ;
             typename gc::Guard gCur ;
 
             // Hazard pointer array:
             //  pPred: [nLevel * 2]
             //  pSucc: [nLevel * 2 + 1]
+            // If bHint is true, pos contains the result of previous search
+            // and the search at each level may be started from pos.pPrev[nLevel]
 
         retry:
             pPred = m_Head.head() ;
+            if ( nAttempt++ )
+                bHint = false ;     // the hint is outdated, search from the head
 
-            for ( int nLevel = (int) c_nMaxHeight - 1; nLevel >= 0; --nLevel ) {
-                pos.guards.assign( nLevel * 2, node_traits::to_value_ptr( pPred )) ;
+            for ( nLevel = (int) c_nMaxHeight - 1; nLevel >= 0; --nLevel ) {
+                if ( bHint && is_hint_usable( pos, nLevel, pPred, val, cmp ))
+                    pPred = pos.pPrev[ nLevel ] ;   // already guarded by pos.guards[nLevel * 2]
+                else
+                    pos.guards.assign( nLevel * 2, node_traits::to_value_ptr( pPred )) ;
                 while ( true ) {
                     pCur = pPred->next( nLevel ).load( memory_model::memory_order_relaxed ) ;
                     gCur.assign( node_traits::to_value_ptr( pCur.ptr() )) ;
@@ -541,7 +600,10 @@ namespace cds { namespace intrusive {
                         if ( !pPred->next( nLevel ).compare_exchange_strong( p, marked_node_ptr( pSucc.ptr() ), memory_model::memory_order_release, memory_model::memory_order_relaxed ))
                             goto retry ;
                         if ( nLevel == 0 ) {
-                            gc::retire( node_traits::to_value_ptr( pCur.ptr() ), dispose_node ) ;
+                            if ( pos.pBatch )
+                                pos.pBatch->push( node_traits::to_value_ptr( pCur.ptr() ), dispose_node ) ;
+                            else
+                                gc::retire( node_traits::to_value_ptr( pCur.ptr() ), dispose_node ) ;
                         }
                     }
                     else {
@@ -567,6 +629,12 @@ namespace cds { namespace intrusive {
                 return false ;
 
         found:
+            // Make pos.pPrev consistent with the guards for the hinted search
+            for ( ; nLevel >= 0; --nLevel ) {
+                pos.pPrev[ nLevel ] = pPred ;
+                pos.guards.assign( nLevel * 2, node_traits::to_value_ptr( pPred )) ;
+            }
+
             pos.pCur = pCur.ptr() ;
             pos.guards.copy( 1, gCur ) ;
             return pCur.ptr() && nCmp == 0 ;
@@ -774,6 +842,134 @@ namespace cds { namespace intrusive {
         }
 
 
+        template <typename Q, typename Compare>
+        bool extract_( typename gc::Guard& dest, Q const& val, Compare cmp )
+        {
+            // The functor is called while the node is guarded by erase_()
+            return erase_( val, cmp, guard_assign_functor( dest )) ;
+        }
+
+        template <typename Q, typename Compare>
+        bool get_with_( typename gc::Guard& guard, Q const& val, Compare cmp )
+        {
+            return find_with_( val, cmp, guard_assign_functor( guard )) ;
+        }
+
+        template <typename Q, typename Compare>
+        value_type * bound_( typename gc::Guard& guard, Q const& val, Compare cmp )
+        {
+            // The search stops at the first node for which cmp( node, val ) >= 0.
+            // If such node is found it is guarded by pos.guards
+            position pos ;
+            find_position( val, pos, cmp, false ) ;
+
+            node_type * pNode = pos.pSucc[0] ;
+            if ( pNode ) {
+                value_type * pVal = node_traits::to_value_ptr( pNode ) ;
+                guard.assign( pVal ) ;
+                return pVal ;
+            }
+            return null_ptr<value_type *>() ;
+        }
+
+        // Moves the guard from the current item to its successor
+        value_type * cursor_next_( typename gc::Guard& guard )
+        {
+            value_type * pCur = guard.template get<value_type>() ;
+            assert( pCur != null_ptr<value_type *>() ) ;
+
+            {
+                node_type * pNode = node_traits::to_node_ptr( pCur ) ;
+                typename gc::Guard gSucc ;
+                marked_node_ptr pSucc = gSucc.protect( pNode->next(0), gc_protect ) ;
+                if ( !pSucc.bits() ) {
+                    // The current node is not deleted, so pSucc is its actual successor
+                    if ( !pSucc.ptr() ) {
+                        m_Stat.onCursorFastStep() ;
+                        return null_ptr<value_type *>() ;
+                    }
+                    if ( !pSucc->next(0).load( memory_model::memory_order_acquire ).bits() ) {
+                        m_Stat.onCursorFastStep() ;
+                        guard.copy( gSucc ) ;
+                        return node_traits::to_value_ptr( pSucc.ptr() ) ;
+                    }
+                }
+            }
+
+            // The current node or its successor is deleted.
+            // Search the successor of the current key from the head;
+            // the current item stays guarded during the search
+            m_Stat.onCursorSlowStep() ;
+            return bound_( guard, *pCur, skip_list::details::upper_bound_comparator< key_comparator >() ) ;
+        }
+
+        // Unlinks the item with minimal key. If nSkip > 0 the function steps over up to nSkip items
+        // from the minimal one before unlinking, that decreases the contention on the head of the list.
+        // The functor f is called for the item unlinked while it is guarded
+        template <typename Func>
+        bool extract_min_( Func f, unsigned int nSkip )
+        {
+            position pos ;
+            typename gc::Guard gDel ;
+
+            while ( true ) {
+                find_position( 0, pos, skip_list::details::first_node_comparator(), false ) ;
+                node_type * pDel = pos.pSucc[0] ;
+                if ( !pDel ) {
+                    m_Stat.onExtractMinFailed() ;
+                    return false ;
+                }
+                gDel.assign( node_traits::to_value_ptr( pDel )) ;
+
+                if ( nSkip ) {
+                    typename gc::Guard gSucc ;
+                    for ( unsigned int n = 0; n < nSkip; ++n ) {
+                        marked_node_ptr pSucc = gSucc.protect( pDel->next(0), gc_protect ) ;
+                        if ( pSucc.bits() || !pSucc.ptr() )
+                            break ;
+                        gDel.copy( gSucc ) ;
+                        pDel = pSucc.ptr() ;
+                    }
+                }
+
+                unsigned int nHeight = pDel->height() ;
+                if ( try_remove_at( pDel, *node_traits::to_value_ptr( pDel ), pos, f )) {
+                    --m_ItemCounter ;
+                    m_Stat.onRemoveNode( nHeight ) ;
+                    m_Stat.onExtractMinSuccess() ;
+                    return true ;
+                }
+                m_Stat.onExtractMinRetry() ;
+            }
+        }
+
+        // Unlinks the item with maximal key. The functor f is called for the item unlinked while it is guarded
+        template <typename Func>
+        bool extract_max_( Func f )
+        {
+            position pos ;
+            typename gc::Guard gDel ;
+
+            while ( true ) {
+                find_position( 0, pos, skip_list::details::last_node_comparator(), false ) ;
+                node_type * pDel = pos.pPrev[0] ;
+                if ( pDel == m_Head.head() ) {
+                    m_Stat.onExtractMaxFailed() ;
+                    return false ;
+                }
+                gDel.assign( node_traits::to_value_ptr( pDel )) ;
+
+                unsigned int nHeight = pDel->height() ;
+                if ( try_remove_at( pDel, *node_traits::to_value_ptr( pDel ), pos, f )) {
+                    --m_ItemCounter ;
+                    m_Stat.onRemoveNode( nHeight ) ;
+                    m_Stat.onExtractMaxSuccess() ;
+                    return true ;
+                }
+                m_Stat.onExtractMaxRetry() ;
+            }
+        }
+
         void increase_height( unsigned int nHeight )
         {
             unsigned int nCur = m_nHeight.load( memory_model::memory_order_relaxed ) ;
@@ -886,6 +1082,119 @@ namespace cds { namespace intrusive {
         */
         template <typename Func>
         bool insert( value_type& val, Func f )
+        {
+            position pos ;
+            return insert_at( val, f, pos, false, false ) ;
+        }
+
+        /// Insert hint (finger) for the sequence of inserting
+        /**
+            The hint keeps the insert position (the predecessors of the item on each level)
+            found by the previous \ref insert( insert_hint&, value_type& ) "insert" call.
+            The next insert with the same hint starts the search on each level
+            from the saved predecessor if its key is less than the key of new item,
+            so inserting the keys in ascending or nearly ascending order costs O(1) expected time
+            instead of O(log N).
+
+            The hint is not thread-safe, each thread should use its own hint object.
+            The hint may be outdated by concurrent modifications of the set; in that case
+            the search starts from the head of the list. So, the hint affects only the performance,
+            not the correctness.
+
+            The hint holds <tt>c_nMaxHeight * 2</tt> guards (hazard pointers) while it is alive.
+            If the thread calls other operations of the set while it has a live hint,
+            the garbage collector should have enough hazard pointers for both the hint and
+            the operation.
+        */
+        class insert_hint
+        {
+            //@cond
+            friend class SkipListSet ;
+
+            position    m_Pos       ;
+            bool        m_bValid    ;
+            //@endcond
+
+        public:
+            /// Creates empty hint
+            insert_hint()
+                : m_bValid( false )
+            {}
+
+            /// Resets the hint and releases the guards
+            void reset()
+            {
+                m_bValid = false ;
+                for ( size_t i = 0; i < c_nMaxHeight * 2; ++i )
+                    m_Pos.guards.clear( i ) ;
+            }
+
+            /// Checks if the hint contains a position of previous insert
+            bool valid() const
+            {
+                return m_bValid ;
+            }
+        };
+
+        /// Inserts new node using the insert hint
+        /**
+            The function is the same as \ref insert( value_type& ) but the search of
+            the insert position begins from the position stored in \p hint by previous call.
+            After the call \p hint contains the position of \p val (if inserted)
+            or the position of the item with key equal to \p val (if \p val is not inserted).
+
+            Returns \p true if \p val is placed into the set, \p false otherwise.
+        */
+        bool insert( insert_hint& hint, value_type& val )
+        {
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return insert( hint, val, []( value_type& ) {} )    ;
+#       else
+            return insert( hint, val, empty_insert_functor() )    ;
+#       endif
+        }
+
+        /// Inserts new node using the insert hint
+        /**
+            The function is the same as \ref insert( value_type&, Func ) but the search of
+            the insert position begins from the position stored in \p hint by previous call.
+        */
+        template <typename Func>
+        bool insert( insert_hint& hint, value_type& val, Func f )
+        {
+            bool bRet = insert_at( val, f, hint.m_Pos, hint.m_bValid, true ) ;
+            hint.m_bValid = true ;
+            return bRet ;
+        }
+
+        /// Inserts the sequence of items
+        /**
+            The function inserts the items from the range [\p first, \p last) in the set
+            using \ref insert_hint. The function is intended for the ranges sorted in
+            ascending order of keys (or nearly sorted): in that case each insert continues
+            the search from the position of the previous item.
+            Unsorted ranges are allowed too but there is no performance gain for them.
+
+            \p Iterator should dereference to <tt>value_type&</tt>.
+
+            Returns the number of items inserted.
+        */
+        template <typename Iterator>
+        size_t insert_sorted( Iterator first, Iterator last )
+        {
+            insert_hint hint ;
+            size_t nCount = 0 ;
+            for ( ; first != last; ++first ) {
+                if ( insert( hint, *first ))
+                    ++nCount ;
+            }
+            return nCount ;
+        }
+
+    protected:
+        //@cond
+        template <typename Func>
+        bool insert_at( value_type& val, Func f, position& pos, bool bUseHint, bool bSaveHint )
         {
             typename gc::Guard gNew    ;
             gNew.assign( &val )        ;
@@ -896,10 +1205,9 @@ namespace cds { namespace intrusive {
             bool bTowerOk = nHeight > 1 && pNode->get_tower() != null_ptr<atomic_node_ptr *>() ;
             bool bTowerMade = false ;
 
-            position pos ;
             while ( true )
             {
-                bool bFound = find_position( val, pos, key_comparator(), true ) ;
+                bool bFound = find_position( val, pos, key_comparator(), true, bUseHint ) ;
                 if ( bFound ) {
                     // scoped_node_ptr deletes the node tower if we create it
                     if ( !bTowerMade )
@@ -921,6 +1229,15 @@ namespace cds { namespace intrusive {
                     continue ;
                 }
 
+                if ( bSaveHint ) {
+                    // The new node is the best predecessor for the next hinted insert.
+                    // It is guarded by gNew now, so it is safe to guard it in pos
+                    for ( unsigned int nLevel = 0; nLevel < nHeight; ++nLevel ) {
+                        pos.pPrev[ nLevel ] = pNode ;
+                        pos.guards.assign( nLevel * 2, &val ) ;
+                    }
+                }
+
                 increase_height( nHeight )  ;
                 ++m_ItemCounter ;
                 m_Stat.onAddNode( nHeight ) ;
@@ -929,6 +1246,9 @@ namespace cds { namespace intrusive {
                 return true ;
             }
         }
+        //@endcond
+
+    public:
 
         /// Ensures that the \p val exists in the set
         /**
@@ -1031,7 +1351,12 @@ namespace cds { namespace intrusive {
         bool unlink( value_type& val )
         {
             position pos ;
+            return unlink_at( val, pos ) ;
+        }
 
+        //@cond
+        bool unlink_at( value_type& val, position& pos )
+        {
             if ( !find_position( val, pos, key_comparator(), false ) ) {
                 m_Stat.onUnlinkFailed() ;
                 return false ;
@@ -1062,6 +1387,7 @@ namespace cds { namespace intrusive {
             m_Stat.onUnlinkFailed() ;
             return false ;
         }
+        //@endcond
 
         /// Deletes the item from the set
         /** \anchor cds_intrusive_SkipListSet_hp_erase
@@ -1136,6 +1462,159 @@ namespace cds { namespace intrusive {
             return erase_( val, cds::opt::details::make_comparator_from_less<Less>(), f ) ;
         }
 
+        /// Extracts the item from the set with specified \p key
+        /** \anchor cds_intrusive_SkipListSet_hp_extract
+            The function searches an item with key equal to \p key in the set,
+            unlinks it from the set, and returns it in \p dest parameter.
+            If the item with key equal to \p key is not found the function returns \p false.
+
+            Note the compare functor should accept a parameter of type \p Q that can be not the same as \p value_type.
+
+            The \ref disposer specified in \p Traits class template parameter is called automatically
+            by garbage collector \p GC specified in class' template parameters when returned \ref guarded_ptr object
+            will be destroyed or released.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+
+            Usage:
+            \code
+            typedef cds::intrusive::SkipListSet< cds::gc::HP, foo, my_traits >  skip_list ;
+            skip_list theList ;
+            // ...
+            {
+                skip_list::guarded_ptr gp ;
+                theList.extract( gp, 5 ) ;
+                // Deal with gp
+                // ...
+
+                // Destructor of gp releases internal HP guard
+            }
+            \endcode
+        */
+        template <typename Q>
+        bool extract( guarded_ptr& dest, Q const& key )
+        {
+            return extract_( dest.guard(), key, key_comparator() ) ;
+        }
+
+        /// Extracts the item from the set with comparing functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_extract "extract(guarded_ptr&, Q const&)"
+            but \p pred predicate is used for key comparing.
+
+            \p Less functor has the semantics like \p std::less but should take arguments of type \ref value_type and \p Q
+            in any order.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool extract_with( guarded_ptr& dest, Q const& key, Less pred )
+        {
+            return extract_( dest.guard(), key, cds::opt::details::make_comparator_from_less<Less>() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Extracts the item from the set with specified \p key
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_extract "extract(guarded_ptr&, Q const&)"
+            that returns the guarded pointer. The guarded pointer returned is empty if \p key is not found.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr extract( Q const& key )
+        {
+            guarded_ptr gp ;
+            extract( gp, key ) ;
+            return gp ;
+        }
+
+        /// Extracts the item from the set with comparing functor \p pred
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr extract_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            extract_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
+        /// Extracts an item with minimal key from the set
+        /** \anchor cds_intrusive_SkipListSet_hp_extract_min
+            The function searches an item with minimal key, unlinks it from the set, and returns it in \p dest parameter.
+            If the skip-list is empty the function returns \p false.
+
+            The \ref disposer specified in \p Traits class template parameter is called automatically
+            by garbage collector \p GC specified in class' template parameters when returned \ref guarded_ptr object
+            will be destroyed or released.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+
+            Usage:
+            \code
+            typedef cds::intrusive::SkipListSet< cds::gc::HP, foo, my_traits >  skip_list ;
+            skip_list theList ;
+            // ...
+            {
+                skip_list::guarded_ptr gp ;
+                if ( theList.extract_min( gp )) {
+                    // Deal with gp
+                    // ...
+                }
+                // Destructor of gp releases internal HP guard
+            }
+            \endcode
+        */
+        bool extract_min( guarded_ptr& dest )
+        {
+            return extract_min_( guard_assign_functor( dest.guard() ), 0 ) ;
+        }
+
+        /// Extracts an item with maximal key from the set
+        /** \anchor cds_intrusive_SkipListSet_hp_extract_max
+            The function searches an item with maximal key, unlinks it from the set, and returns it in \p dest parameter.
+            If the skip-list is empty the function returns \p false.
+
+            The search of the last item passes over the whole height of the skip-list,
+            so the function is slightly slower than \ref cds_intrusive_SkipListSet_hp_extract_min "extract_min".
+
+            The \ref disposer specified in \p Traits class template parameter is called automatically
+            by garbage collector \p GC specified in class' template parameters when returned \ref guarded_ptr object
+            will be destroyed or released.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+        */
+        bool extract_max( guarded_ptr& dest )
+        {
+            return extract_max_( guard_assign_functor( dest.guard() )) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Extracts an item with minimal key from the set
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_extract_min "extract_min(guarded_ptr&)"
+            that returns the guarded pointer. The guarded pointer returned is empty if the set is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        guarded_ptr extract_min()
+        {
+            guarded_ptr gp ;
+            extract_min( gp ) ;
+            return gp ;
+        }
+
+        /// Extracts an item with maximal key from the set
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_extract_max "extract_max(guarded_ptr&)"
+            that returns the guarded pointer. The guarded pointer returned is empty if the set is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        guarded_ptr extract_max()
+        {
+            guarded_ptr gp ;
+            extract_max( gp ) ;
+            return gp ;
+        }
+#   endif
+
         /// Finds the key \p val
         /** \anchor cds_intrusive_SkipListSet_hp_find_func
             The function searches the item with key equal to \p val and calls the functor \p f for item found.
@@ -1258,6 +1737,319 @@ namespace cds { namespace intrusive {
 #       endif
         }
 
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /** \anchor cds_intrusive_SkipListSet_hp_get
+            The function searches the item with key equal to \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if \p key is found, and \p false otherwise.
+            If \p key is not found the \p ptr parameter is not changed.
+
+            Unlike \p find() the function does not call any functor: the item stays guarded
+            and accessible until \p ptr is released, so the caller can read it without copying.
+            The function does not serialize access to the item.
+            @note Each \p guarded_ptr object uses one GC's guard which can be limited resource.
+
+            Note the compare functor specified for class \p Traits template parameter
+            should accept a parameter of type \p Q that can be not the same as \p value_type.
+        */
+        template <typename Q>
+        bool get( guarded_ptr& ptr, Q const& key )
+        {
+            return get_with_( ptr.guard(), key, key_comparator() ) ;
+        }
+
+        /// Finds the key \p key and returns the guarded pointer to the item found using \p pred predicate
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_get "get( guarded_ptr& ptr, Q const&)"
+            but \p pred is used for comparing the keys.
+
+            \p Less functor has the semantics like \p std::less but should take arguments of type \ref value_type and \p Q
+            in any order.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool get_with( guarded_ptr& ptr, Q const& key, Less pred )
+        {
+            return get_with_( ptr.guard(), key, cds::opt::details::make_comparator_from_less<Less>() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_get "get( guarded_ptr& ptr, Q const&)"
+            that returns the guarded pointer. The guarded pointer returned is empty if \p key is not found.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr get( Q const& key )
+        {
+            guarded_ptr gp ;
+            get( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the key \p key using \p pred predicate and returns the guarded pointer to the item found
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr get_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            get_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
+        /// Finds the first item which key is not less than \p key
+        /** \anchor cds_intrusive_SkipListSet_hp_lower_bound
+            The function searches the first item which key is not less than \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if such item is found. If all items of the set are less
+            than \p key the function returns \p false and the \p ptr parameter is not changed.
+
+            The item stays guarded until \p ptr is released.
+            Use \ref range_cursor to iterate the items starting from the bound.
+
+            Note the compare functor specified for class \p Traits template parameter
+            should accept a parameter of type \p Q that can be not the same as \p value_type.
+        */
+        template <typename Q>
+        bool lower_bound( guarded_ptr& ptr, Q const& key )
+        {
+            return bound_( ptr.guard(), key, key_comparator() ) != null_ptr<value_type *>() ;
+        }
+
+        /// Finds the first item which key is not less than \p key using \p pred predicate
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_lower_bound "lower_bound( guarded_ptr& ptr, Q const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool lower_bound_with( guarded_ptr& ptr, Q const& key, Less pred )
+        {
+            return bound_( ptr.guard(), key, cds::opt::details::make_comparator_from_less<Less>() ) != null_ptr<value_type *>() ;
+        }
+
+        /// Finds the first item which key is greater than \p key
+        /** \anchor cds_intrusive_SkipListSet_hp_upper_bound
+            The function searches the first item which key is greater than \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if such item is found. If no item is greater
+            than \p key the function returns \p false and the \p ptr parameter is not changed.
+
+            Note the compare functor specified for class \p Traits template parameter
+            should accept a parameter of type \p Q that can be not the same as \p value_type.
+        */
+        template <typename Q>
+        bool upper_bound( guarded_ptr& ptr, Q const& key )
+        {
+            return bound_( ptr.guard(), key, skip_list::details::upper_bound_comparator< key_comparator >() ) != null_ptr<value_type *>() ;
+        }
+
+        /// Finds the first item which key is greater than \p key using \p pred predicate
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_hp_upper_bound "upper_bound( guarded_ptr& ptr, Q const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool upper_bound_with( guarded_ptr& ptr, Q const& key, Less pred )
+        {
+            return bound_( ptr.guard(), key,
+                skip_list::details::upper_bound_comparator< cds::opt::details::make_comparator_from_less<Less> >() ) != null_ptr<value_type *>() ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Finds the first item which key is not less than \p key and returns the guarded pointer to it
+        /**
+            The guarded pointer returned is empty if all items are less than \p key.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr lower_bound( Q const& key )
+        {
+            guarded_ptr gp ;
+            lower_bound( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the first item which key is not less than \p key using \p pred predicate and returns the guarded pointer to it
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr lower_bound_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            lower_bound_with( gp, key, pred ) ;
+            return gp ;
+        }
+
+        /// Finds the first item which key is greater than \p key and returns the guarded pointer to it
+        /**
+            The guarded pointer returned is empty if no item is greater than \p key.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr upper_bound( Q const& key )
+        {
+            guarded_ptr gp ;
+            upper_bound( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the first item which key is greater than \p key using \p pred predicate and returns the guarded pointer to it
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr upper_bound_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            upper_bound_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
+        /// Forward range cursor
+        /** \anchor cds_intrusive_SkipListSet_hp_range_cursor
+            The cursor traverses the set in key order and is safe under concurrent insertions and deletions.
+            The current item of the cursor is guarded, so it cannot be reclaimed while the cursor points to it.
+
+            Unlike \ref iterator, the cursor is not stopped when its current item is deleted by another thread:
+            in this case \ref next() searches the successor of the current key from the head of the skip-list.
+            Thus, the keys visited are strictly increasing, each item that is in the set during the whole scan
+            is visited, and the items inserted or deleted concurrently may be visited or not.
+
+            Usage (scan the keys in range <tt>[a, b)</tt>):
+            \code
+            typedef cds::intrusive::SkipListSet< cds::gc::HP, foo, my_traits > skip_list ;
+            skip_list theSet ;
+            // ...
+            skip_list::range_cursor cur( theSet ) ;
+            for ( bool bOk = cur.lower_bound( a ); bOk && cur->key() < b; bOk = cur.next() ) {
+                // Deal with *cur
+            }
+            \endcode
+
+            The cursor uses one GC's guard; \ref next() uses one more guard temporarily.
+            The cursor object should not be passed to another thread.
+        */
+        class range_cursor
+        {
+            //@cond
+            SkipListSet&    m_Set   ;
+            guarded_ptr     m_gp    ;
+            //@endcond
+
+        public:
+            /// Creates empty cursor for set \p s
+            explicit range_cursor( SkipListSet& s )
+                : m_Set( s )
+            {}
+
+            /// Positions the cursor to the first (minimal) item of the set
+            /**
+                Returns \p false if the set is empty; in this case the cursor becomes empty.
+            */
+            bool first()
+            {
+                return set( m_Set.bound_( m_gp.guard(), 0, skip_list::details::first_node_comparator() )) ;
+            }
+
+            /// Positions the cursor to the first item which key is not less than \p key
+            /**
+                Returns \p false if all items are less than \p key; in this case the cursor becomes empty.
+            */
+            template <typename Q>
+            bool lower_bound( Q const& key )
+            {
+                return set( m_Set.bound_( m_gp.guard(), key, key_comparator() )) ;
+            }
+
+            /// Positions the cursor to the first item which key is not less than \p key using \p pred predicate
+            template <typename Q, typename Less>
+            bool lower_bound_with( Q const& key, Less pred )
+            {
+                return set( m_Set.bound_( m_gp.guard(), key, cds::opt::details::make_comparator_from_less<Less>() )) ;
+            }
+
+            /// Positions the cursor to the first item which key is greater than \p key
+            /**
+                Returns \p false if no item is greater than \p key; in this case the cursor becomes empty.
+            */
+            template <typename Q>
+            bool upper_bound( Q const& key )
+            {
+                return set( m_Set.bound_( m_gp.guard(), key, skip_list::details::upper_bound_comparator< key_comparator >() )) ;
+            }
+
+            /// Positions the cursor to the first item which key is greater than \p key using \p pred predicate
+            template <typename Q, typename Less>
+            bool upper_bound_with( Q const& key, Less pred )
+            {
+                return set( m_Set.bound_( m_gp.guard(), key,
+                    skip_list::details::upper_bound_comparator< cds::opt::details::make_comparator_from_less<Less> >() )) ;
+            }
+
+            /// Moves the cursor to the next item
+            /**
+                The cursor must not be empty.
+                Returns \p false if the current item is the last one; in this case the cursor becomes empty.
+            */
+            bool next()
+            {
+                assert( !empty() ) ;
+                return set( m_Set.cursor_next_( m_gp.guard() )) ;
+            }
+
+            /// Returns a pointer to the current item or \p NULL if the cursor is empty
+            value_type * get() const
+            {
+                return m_gp.get() ;
+            }
+
+            /// Returns a pointer to the current item
+            value_type * operator ->() const
+            {
+                return m_gp.get() ;
+            }
+
+            /// Returns a reference to the current item
+            value_type& operator *() const
+            {
+                return *m_gp ;
+            }
+
+            /// Checks if the cursor is empty
+            bool empty() const
+            {
+                return m_gp.empty() ;
+            }
+
+            /// Clears the cursor; the current item may be reclaimed after that
+            void release()
+            {
+                m_gp.release() ;
+            }
+
+        private:
+            //@cond
+            bool set( value_type * pVal )
+            {
+                if ( pVal )
+                    return true ;
+                m_gp.release() ;
+                return false ;
+            }
+
+            range_cursor( range_cursor const& ) CDS_DELETE_SPECIFIER ;
+            range_cursor& operator=( range_cursor const& ) CDS_DELETE_SPECIFIER ;
+            //@endcond
+        };
+
         /// Returns item count in the set
         /**
             The value returned depends on item counter type provided by \p Traits template parameter.
@@ -1288,17 +2080,25 @@ namespace cds { namespace intrusive {
             the assertion could be raised.
 
             For each item the \ref disposer will be called after unlinking.
+            The items unlinked are passed to the garbage collector by one \p retire_batch call,
+            so the reclamation cycle is performed once for whole set.
         */
         void clear()
         {
+            cds::gc::details::retired_batch< gc > batch ;
+            position pos ;
+            pos.pBatch = &batch ;
+
             typename gc::Guard guard ;
             for (;;) {
                 marked_node_ptr pNode = guard.protect( m_Head.head()->next(0), gc_protect ) ;
                 if ( pNode.ptr() )
-                    unlink( *node_traits::to_value_ptr( pNode.ptr() )) ;
+                    unlink_at( *node_traits::to_value_ptr( pNode.ptr() ), pos ) ;
                 else
                     break ;
             }
+
+            batch.retire() ;
         }
 
         /// Returns maximum height of skip-list. The max height is a constant for each object and does not exceed 32.
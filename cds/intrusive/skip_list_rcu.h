@@ -339,7 +339,9 @@ namespace cds { namespace intrusive {
         see \ref cds_urcu_gc "RCU type" for list of existing RCU class and corresponding header files.
 
         @note Unlike other RCU-based intrusive set implementations, the skip list does not provide
-        \p extract method by reason of internal constraints.
+        \p extract method by reason of internal constraints. The \ref cds_intrusive_SkipListSet_rcu_extract_min "extract_min"
+        and \ref cds_intrusive_SkipListSet_rcu_extract_max "extract_max" functions pass the item extracted
+        to a functor instead of returning it.
 
         <b>Iterators</b>
 
@@ -946,36 +948,176 @@ namespace cds { namespace intrusive {
             return bRet ;
         }
 
-        void increase_height( unsigned int nHeight )
+        // RCU should be locked; the nodes deleted during the search are deferred
+        template <typename Q, typename Compare>
+        value_type * bound_( Q const& val, Compare cmp )
         {
-            unsigned int nCur = m_nHeight.load( memory_model::memory_order_relaxed ) ;
-            if ( nCur < nHeight )
-                m_nHeight.compare_exchange_strong( nCur, nHeight, memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ) ;
+            assert( gc::is_locked() ) ;
+
+            // The search stops at the first node for which cmp( node, val ) >= 0
+            position pos ;
+            find_position( val, pos, cmp, false ) ;
+            defer_chain( pos ) ;
+
+            node_type * pNode = pos.pSucc[0] ;
+            return pNode ? node_traits::to_value_ptr( pNode ) : null_ptr<value_type *>() ;
         }
 
-        void dispose_chain( node_type * pHead )
+        // RCU should be locked; returns the successor of pCur
+        value_type * cursor_next_( value_type * pCur )
+        {
+            assert( gc::is_locked() ) ;
+            assert( pCur != null_ptr<value_type *>() ) ;
+
+            node_type * pNode = node_traits::to_node_ptr( pCur ) ;
+            marked_node_ptr pSucc = pNode->next(0).load( memory_model::memory_order_acquire ) ;
+            if ( !pSucc.bits() ) {
+                // The current node is not deleted, so pSucc is its actual successor
+                if ( !pSucc.ptr() ) {
+                    m_Stat.onCursorFastStep() ;
+                    return null_ptr<value_type *>() ;
+                }
+                if ( !pSucc->next(0).load( memory_model::memory_order_acquire ).bits() ) {
+                    m_Stat.onCursorFastStep() ;
+                    return node_traits::to_value_ptr( pSucc.ptr() ) ;
+                }
+            }
+
+            // The current node or its successor is deleted.
+            // The current node cannot be freed while RCU is locked,
+            // so we may search the successor of its key from the head
+            m_Stat.onCursorSlowStep() ;
+            return bound_( *pCur, skip_list::details::upper_bound_comparator< key_comparator >() ) ;
+        }
+
+        // Unlinks the item with minimal key. If nSkip > 0 the function steps over up to nSkip items
+        // from the minimal one before unlinking, that decreases the contention on the head of the list.
+        // The functor f is called for the item unlinked under RCU lock
+        template <typename Func>
+        bool extract_min_( Func f, unsigned int nSkip )
         {
             assert( !gc::is_locked() ) ;
 
-            if ( pHead ) {
-                if ( gc::rcu_implementation::c_bBuffered ) {
-                    // RCU is buffered
-                    while ( pHead ) {
-                        node_type * pNext = pHead->m_pDelChain ;
-                        gc::retire_ptr( node_traits::to_value_ptr( pHead ), dispose_node ) ;
-                        pHead = pNext ;
+            position pos ;
+            bool bRet ;
+
+            {
+                rcu_lock l ;
+
+                while ( true ) {
+                    find_position( 0, pos, skip_list::details::first_node_comparator(), false ) ;
+                    node_type * pDel = pos.pSucc[0] ;
+                    if ( !pDel ) {
+                        m_Stat.onExtractMinFailed() ;
+                        bRet = false ;
+                        break ;
                     }
+
+                    for ( unsigned int n = 0; n < nSkip; ++n ) {
+                        marked_node_ptr pSucc = pDel->next(0).load( memory_model::memory_order_acquire ) ;
+                        if ( pSucc.bits() || !pSucc.ptr() )
+                            break ;
+                        pDel = pSucc.ptr() ;
+                    }
+
+                    unsigned int nHeight = pDel->height() ;
+                    if ( try_remove_at( pDel, *node_traits::to_value_ptr( pDel ), pos, f )) {
+                        --m_ItemCounter ;
+                        m_Stat.onRemoveNode( nHeight ) ;
+                        m_Stat.onExtractMinSuccess() ;
+                        bRet = true ;
+                        break ;
+                    }
+                    m_Stat.onExtractMinRetry() ;
                 }
-                else {
-                    // RCU is not buffered
-                    gc::synchronize()   ;
-                    while ( pHead ) {
-                        node_type * pNext = pHead->m_pDelChain ;
-                        dispose_node( node_traits::to_value_ptr( pHead )) ;
-                        pHead = pNext ;
+            }
+
+            dispose_chain( pos ) ;
+            return bRet ;
+        }
+
+        // Unlinks the item with maximal key. The functor f is called for the item unlinked under RCU lock
+        template <typename Func>
+        bool extract_max_( Func f )
+        {
+            assert( !gc::is_locked() ) ;
+
+            position pos ;
+            bool bRet ;
+
+            {
+                rcu_lock l ;
+
+                while ( true ) {
+                    find_position( 0, pos, skip_list::details::last_node_comparator(), false ) ;
+                    node_type * pDel = pos.pPrev[0] ;
+                    if ( pDel == m_Head.head() ) {
+                        m_Stat.onExtractMaxFailed() ;
+                        bRet = false ;
+                        break ;
+                    }
+
+                    unsigned int nHeight = pDel->height() ;
+                    if ( try_remove_at( pDel, *node_traits::to_value_ptr( pDel ), pos, f )) {
+                        --m_ItemCounter ;
+                        m_Stat.onRemoveNode( nHeight ) ;
+                        m_Stat.onExtractMaxSuccess() ;
+                        bRet = true ;
+                        break ;
                     }
+                    m_Stat.onExtractMaxRetry() ;
                 }
             }
+
+            dispose_chain( pos ) ;
+            return bRet ;
+        }
+
+        void increase_height( unsigned int nHeight )
+        {
+            unsigned int nCur = m_nHeight.load( memory_model::memory_order_relaxed ) ;
+            if ( nCur < nHeight )
+                m_nHeight.compare_exchange_strong( nCur, nHeight, memory_model::memory_order_release, CDS_ATOMIC::memory_order_relaxed ) ;
+        }
+
+        // Iterator over the chain of deleted nodes linked by m_pDelChain field
+        class del_chain_iterator
+        {
+            node_type * m_pNode ;
+        public:
+            explicit del_chain_iterator( node_type * pNode = null_ptr<node_type *>() )
+                : m_pNode( pNode )
+            {}
+
+            cds::urcu::retired_ptr operator *() const
+            {
+                return cds::urcu::retired_ptr( node_traits::to_value_ptr( m_pNode ), dispose_node ) ;
+            }
+
+            del_chain_iterator& operator ++()
+            {
+                m_pNode = m_pNode->m_pDelChain ;
+                return *this ;
+            }
+
+            bool operator ==( del_chain_iterator const& it ) const
+            {
+                return m_pNode == it.m_pNode ;
+            }
+            bool operator !=( del_chain_iterator const& it ) const
+            {
+                return m_pNode != it.m_pNode ;
+            }
+        };
+
+        void dispose_chain( node_type * pHead )
+        {
+            assert( !gc::is_locked() ) ;
+
+            // Non-buffered RCU calls synchronize once for whole chain,
+            // buffered RCU synchronizes at most once if the chain does not fit into the buffer
+            if ( pHead )
+                gc::retire_batch( del_chain_iterator( pHead ), del_chain_iterator() ) ;
         }
 
         void dispose_chain( position& pos )
@@ -1010,6 +1152,37 @@ namespace cds { namespace intrusive {
             }
         }
 
+        // RCU should be locked; the nodes deleted are linked to pos.pDelChain
+        bool unlink_at( value_type& val, position& pos )
+        {
+            if ( !find_position( val, pos, key_comparator(), false ) ) {
+                m_Stat.onUnlinkFailed() ;
+                return false ;
+            }
+
+            node_type * pDel = pos.pCur ;
+            assert( key_comparator()( *node_traits::to_value_ptr( pDel ), val ) == 0 ) ;
+
+            unsigned int nHeight = pDel->height() ;
+
+            if ( node_traits::to_value_ptr( pDel ) == &val && try_remove_at( pDel, val, pos,
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+                [](value_type const&) {}
+#       else
+                empty_erase_functor()
+#       endif
+                ))
+            {
+                --m_ItemCounter ;
+                m_Stat.onRemoveNode( nHeight ) ;
+                m_Stat.onUnlinkSuccess() ;
+                return true ;
+            }
+
+            m_Stat.onUnlinkFailed() ;
+            return false ;
+        }
+
         //@endcond
 
     public:
@@ -1294,35 +1467,7 @@ namespace cds { namespace intrusive {
 
             {
                 rcu_lock rcuLock ;
-
-                if ( !find_position( val, pos, key_comparator(), false ) ) {
-                    m_Stat.onUnlinkFailed() ;
-                    bRet = false ;
-                }
-                else {
-                    node_type * pDel = pos.pCur ;
-                    assert( key_comparator()( *node_traits::to_value_ptr( pDel ), val ) == 0 ) ;
-
-                    unsigned int nHeight = pDel->height() ;
-
-                    if ( node_traits::to_value_ptr( pDel ) == &val && try_remove_at( pDel, val, pos,
-#       ifdef CDS_CXX11_LAMBDA_SUPPORT
-                        [](value_type const&) {}
-#       else
-                        empty_erase_functor()
-#       endif
-                        ))
-                    {
-                        --m_ItemCounter ;
-                        m_Stat.onRemoveNode( nHeight ) ;
-                        m_Stat.onUnlinkSuccess() ;
-                        bRet = true ;
-                    }
-                    else {
-                        m_Stat.onUnlinkFailed() ;
-                        bRet = false ;
-                    }
-                }
+                bRet = unlink_at( val, pos ) ;
             }
 
             dispose_chain( pos ) ;
@@ -1407,6 +1552,46 @@ namespace cds { namespace intrusive {
             return erase_( val, cds::opt::details::make_comparator_from_less<Less>(), f ) ;
         }
 
+        /// Extracts an item with minimal key from the set
+        /** \anchor cds_intrusive_SkipListSet_rcu_extract_min
+            The function searches an item with minimal key, unlinks it from the set
+            and calls \p f functor for the item unlinked. The \p Func interface is
+            \code
+            struct functor {
+                void operator()( value_type& item ) ;
+            } ;
+            \endcode
+            The functor can be passed by reference with <tt>boost:ref</tt>
+
+            The functor is called under RCU lock when the item has been logically deleted,
+            so no other thread can extract the same item. However, concurrent searching can still read the key
+            of the item, therefore the functor must not change the key. After the functor returns
+            the item is passed to RCU for reclamation and the \ref disposer will be called asynchronously.
+
+            If the skip-list is empty the function returns \p false.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        template <typename Func>
+        bool extract_min( Func f )
+        {
+            return extract_min_( f, 0 ) ;
+        }
+
+        /// Extracts an item with maximal key from the set
+        /** \anchor cds_intrusive_SkipListSet_rcu_extract_max
+            The function is an analog of \ref cds_intrusive_SkipListSet_rcu_extract_min "extract_min(Func)"
+            for the item with maximal key. The search of the last item passes over the whole height of the skip-list,
+            so the function is slightly slower than \p extract_min.
+
+            RCU \p synchronize method can be called. RCU should not be locked.
+        */
+        template <typename Func>
+        bool extract_max( Func f )
+        {
+            return extract_max_( f ) ;
+        }
+
         /// Finds the key \p val
         /** @anchor cds_intrusive_SkipListSet_rcu_find_func
             The function searches the item with key equal to \p val and calls the functor \p f for item found.
@@ -1537,6 +1722,195 @@ namespace cds { namespace intrusive {
             );
         }
 
+        /// Finds the first item which key is not less than \p key
+        /** \anchor cds_intrusive_SkipListSet_rcu_lower_bound
+            The function searches the first item which key is not less than \p key
+            and returns the pointer to the item found.
+            If all items of the set are less than \p key the function returns \p NULL.
+
+            RCU should be locked before call the function.
+            Returned pointer is valid while RCU is locked.
+            Use \ref range_cursor to iterate the items starting from the bound.
+
+            Note the compare functor specified for class \p Traits template parameter
+            should accept a parameter of type \p Q that can be not the same as \p value_type.
+        */
+        template <typename Q>
+        value_type * lower_bound( Q const& key )
+        {
+            return bound_( key, key_comparator() ) ;
+        }
+
+        /// Finds the first item which key is not less than \p key using \p pred predicate
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_rcu_lower_bound "lower_bound(Q const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        value_type * lower_bound_with( Q const& key, Less pred )
+        {
+            return bound_( key, cds::opt::details::make_comparator_from_less<Less>() ) ;
+        }
+
+        /// Finds the first item which key is greater than \p key
+        /** \anchor cds_intrusive_SkipListSet_rcu_upper_bound
+            The function searches the first item which key is greater than \p key
+            and returns the pointer to the item found.
+            If no item is greater than \p key the function returns \p NULL.
+
+            RCU should be locked before call the function.
+            Returned pointer is valid while RCU is locked.
+        */
+        template <typename Q>
+        value_type * upper_bound( Q const& key )
+        {
+            return bound_( key, skip_list::details::upper_bound_comparator< key_comparator >() ) ;
+        }
+
+        /// Finds the first item which key is greater than \p key using \p pred predicate
+        /**
+            The function is an analog of \ref cds_intrusive_SkipListSet_rcu_upper_bound "upper_bound(Q const&)"
+            but \p pred is used for comparing the keys.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        value_type * upper_bound_with( Q const& key, Less pred )
+        {
+            return bound_( key, skip_list::details::upper_bound_comparator< cds::opt::details::make_comparator_from_less<Less> >() ) ;
+        }
+
+        /// Forward range cursor
+        /** \anchor cds_intrusive_SkipListSet_rcu_range_cursor
+            The cursor traverses the set in key order and is safe under concurrent insertions and deletions.
+            RCU should be locked while the cursor is used; the current item of the cursor is valid while RCU is locked.
+
+            Unlike \ref iterator, the cursor is not stopped when its current item is deleted by another thread:
+            in this case \ref next() searches the successor of the current key from the head of the skip-list.
+            Thus, the keys visited are strictly increasing, each item that is in the set during the whole scan
+            is visited, and the items inserted or deleted concurrently may be visited or not.
+
+            Usage (scan the keys in range <tt>[a, b)</tt>):
+            \code
+            typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_type ;
+            typedef cds::intrusive::SkipListSet< rcu_type, foo, my_traits > skip_list ;
+            skip_list theSet ;
+            // ...
+            {
+                rcu_type::scoped_lock sl ;
+                skip_list::range_cursor cur( theSet ) ;
+                for ( bool bOk = cur.lower_bound( a ); bOk && cur->key() < b; bOk = cur.next() ) {
+                    // Deal with *cur
+                }
+            }
+            \endcode
+        */
+        class range_cursor
+        {
+            //@cond
+            SkipListSet&    m_Set   ;
+            value_type *    m_pCur  ;
+            //@endcond
+
+        public:
+            /// Creates empty cursor for set \p s
+            explicit range_cursor( SkipListSet& s )
+                : m_Set( s )
+                , m_pCur( null_ptr<value_type *>() )
+            {}
+
+            /// Positions the cursor to the first (minimal) item of the set
+            /**
+                Returns \p false if the set is empty; in this case the cursor becomes empty.
+            */
+            bool first()
+            {
+                m_pCur = m_Set.bound_( 0, skip_list::details::first_node_comparator() ) ;
+                return !empty() ;
+            }
+
+            /// Positions the cursor to the first item which key is not less than \p key
+            /**
+                Returns \p false if all items are less than \p key; in this case the cursor becomes empty.
+            */
+            template <typename Q>
+            bool lower_bound( Q const& key )
+            {
+                m_pCur = m_Set.lower_bound( key ) ;
+                return !empty() ;
+            }
+
+            /// Positions the cursor to the first item which key is not less than \p key using \p pred predicate
+            template <typename Q, typename Less>
+            bool lower_bound_with( Q const& key, Less pred )
+            {
+                m_pCur = m_Set.lower_bound_with( key, pred ) ;
+                return !empty() ;
+            }
+
+            /// Positions the cursor to the first item which key is greater than \p key
+            /**
+                Returns \p false if no item is greater than \p key; in this case the cursor becomes empty.
+            */
+            template <typename Q>
+            bool upper_bound( Q const& key )
+            {
+                m_pCur = m_Set.upper_bound( key ) ;
+                return !empty() ;
+            }
+
+            /// Positions the cursor to the first item which key is greater than \p key using \p pred predicate
+            template <typename Q, typename Less>
+            bool upper_bound_with( Q const& key, Less pred )
+            {
+                m_pCur = m_Set.upper_bound_with( key, pred ) ;
+                return !empty() ;
+            }
+
+            /// Moves the cursor to the next item
+            /**
+                The cursor must not be empty.
+                Returns \p false if the current item is the last one; in this case the cursor becomes empty.
+            */
+            bool next()
+            {
+                assert( !empty() ) ;
+                m_pCur = m_Set.cursor_next_( m_pCur ) ;
+                return !empty() ;
+            }
+
+            /// Returns a pointer to the current item or \p NULL if the cursor is empty
+            value_type * get() const
+            {
+                return m_pCur ;
+            }
+
+            /// Returns a pointer to the current item
+            value_type * operator ->() const
+            {
+                return m_pCur ;
+            }
+
+            /// Returns a reference to the current item
+            value_type& operator *() const
+            {
+                assert( !empty() ) ;
+                return *m_pCur ;
+            }
+
+            /// Checks if the cursor is empty
+            bool empty() const
+            {
+                return m_pCur == null_ptr<value_type *>() ;
+            }
+
+            /// Clears the cursor
+            void release()
+            {
+                m_pCur = null_ptr<value_type *>() ;
+            }
+        };
+
         /// Returns item count in the set
         /**
             The value returned depends on item counter type provided by \p Traits template parameter.
@@ -1570,15 +1944,19 @@ namespace cds { namespace intrusive {
         */
         void clear()
         {
+            assert( !gc::is_locked() ) ;
+
+            // The chain of all deleted nodes is collected in pos and disposed by one retire_batch call
+            position pos ;
             for (;;) {
+                rcu_lock rcuLock ;
                 marked_node_ptr pNode = m_Head.head()->next(0).load( memory_model::memory_order_acquire ) ;
                 if ( pNode.ptr() )
-                    unlink( *node_traits::to_value_ptr( pNode.ptr() )) ;
+                    unlink_at( *node_traits::to_value_ptr( pNode.ptr() ), pos ) ;
                 else
                     break ;
             }
 
-            position pos ;
             dispose_chain( pos ) ;
         }
 
@@ -13,6 +13,7 @@
 #define __CDS_INTRUSIVE_SPLIT_LIST_H
 
 #include <cds/intrusive/split_list_base.h>
+#include <cds/gc/guarded_ptr.h>
 
 namespace cds { namespace intrusive {
 
@@ -76,6 +77,7 @@ namespace cds { namespace intrusive {
             the ordered list.
         - \p Traits - type traits. See split_list::type_traits for explanation.
             Instead of defining \p Traits struct you may use option-based syntax with split_list::make_traits metafunction.
+            The bucket table of this split-list is never shrunk, so split_list::shrink_factor option must be 0.
 
         There are several specialization of the split-list class for different \p GC:
         - for \ref cds_urcu_gc "RCU type" include <tt><cds/intrusive/split_list_rcu.h></tt> - see
@@ -228,6 +230,8 @@ namespace cds { namespace intrusive {
         typedef typename options::back_off              back_off        ;   ///< back-off strategy for spinning
         typedef typename options::memory_model          memory_model    ;   ///< Memory ordering. See cds::opt::memory_model option
 
+        typedef cds::gc::guarded_ptr< gc, value_type > guarded_ptr ; ///< Guarded pointer, see \ref get and \ref extract
+
     protected:
         typedef typename ordered_list::node_type    list_node_type      ;   ///< Node type as declared in ordered list
         typedef split_list::node<list_node_type>    node_type           ;   ///< split-list node type
@@ -323,6 +327,22 @@ namespace cds { namespace intrusive {
                 return base_class::find_at( h, val, cmp )   ;
             }
 
+            template <typename Q, typename Compare>
+            bool extract_at( dummy_node_type * pHead, typename gc::Guard& guard, split_list::details::search_value_type<Q> const& val, Compare cmp )
+            {
+                assert( pHead != null_ptr<dummy_node_type *>() ) ;
+                bucket_head_type h(pHead) ;
+                return base_class::extract_at( h, guard, val, cmp ) ;
+            }
+
+            template <typename Q, typename Compare>
+            bool get_at( dummy_node_type * pHead, typename gc::Guard& guard, split_list::details::search_value_type<Q> const& val, Compare cmp )
+            {
+                assert( pHead != null_ptr<dummy_node_type *>() ) ;
+                bucket_head_type h(pHead) ;
+                return base_class::get_at( h, guard, val, cmp ) ;
+            }
+
             bool insert_aux_node( dummy_node_type * pNode )
             {
                 return base_class::insert_aux_node( pNode ) ;
@@ -430,6 +450,9 @@ namespace cds { namespace intrusive {
             // atomicity::empty_item_counter is not allowed as a item counter
             static_assert(( !std::is_same<item_counter, atomicity::empty_item_counter>::value ), "atomicity::empty_item_counter is not allowed as a item counter")  ;
 
+            // The search is started from unguarded dummy node of the bucket, so the bucket table cannot be shrunk
+            static_assert( options::shrink_factor == 0, "split_list::shrink_factor is supported by RCU-based split-list only" ) ;
+
             // Initialize bucket 0
             dummy_node_type * pNode = alloc_dummy_node( 0 /*split_list::dummy_hash(0)*/ )   ;
 
@@ -506,6 +529,32 @@ namespace cds { namespace intrusive {
             return false    ;
         }
 
+        template <typename Q, typename Compare>
+        bool extract_( typename gc::Guard& guard, Q const& val, Compare cmp )
+        {
+            size_t nHash = hash_value( val )    ;
+            split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash( nHash )) ;
+            dummy_node_type * pHead = get_bucket( nHash ) ;
+            assert( pHead != null_ptr<dummy_node_type *>() ) ;
+
+            if ( m_List.extract_at( pHead, guard, sv, cmp ) ) {
+                --m_ItemCounter     ;
+                return true         ;
+            }
+            return false    ;
+        }
+
+        template <typename Q, typename Compare>
+        bool get_( typename gc::Guard& guard, Q const& val, Compare cmp )
+        {
+            size_t nHash = hash_value( val )    ;
+            split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash( nHash )) ;
+            dummy_node_type * pHead = get_bucket( nHash ) ;
+            assert( pHead != null_ptr<dummy_node_type *>() ) ;
+
+            return m_List.get_at( pHead, guard, sv, cmp ) ;
+        }
+
         //@endcond
 
     public:
@@ -725,6 +774,80 @@ namespace cds { namespace intrusive {
             return erase_( val, typename wrapped_ordered_list::template make_compare_from_less<Less>(), f ) ;
         }
 
+        /// Extracts the item with specified \p key
+        /** \anchor cds_intrusive_SplitListSet_hp_extract
+            The function searches an item with key equal to \p key,
+            unlinks it from the set, and returns it in \p dest parameter.
+            If the item with key equal to \p key is not found the function returns \p false.
+
+            Note the hash functor should accept a parameter of type \p Q that may be not the same as \p value_type.
+
+            The \ref disposer specified in \p OrderedList class' template parameter is called automatically
+            by garbage collector \p GC when returned \ref guarded_ptr object will be destroyed or released.
+            @note Each \p guarded_ptr object uses the GC's guard that can be limited resource.
+
+            Usage:
+            \code
+            typedef cds::intrusive::SplitListSet< your_template_args > splitlist_set ;
+            splitlist_set theSet ;
+            // ...
+            {
+                splitlist_set::guarded_ptr gp ;
+                if ( theSet.extract( gp, 5 )) {
+                    // Deal with gp
+                    // ...
+                }
+                // Destructor of gp releases internal HP guard
+            }
+            \endcode
+        */
+        template <typename Q>
+        bool extract( guarded_ptr& dest, Q const& key )
+        {
+            return extract_( dest.guard(), key, key_comparator() ) ;
+        }
+
+        /// Extracts the item using compare functor \p pred
+        /**
+            The function is an analog of \ref cds_intrusive_SplitListSet_hp_extract "extract(guarded_ptr&, Q const&)"
+            but \p pred predicate is used for key comparing.
+            \p Less has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool extract_with( guarded_ptr& dest, Q const& key, Less pred )
+        {
+            return extract_( dest.guard(), key, typename wrapped_ordered_list::template make_compare_from_less<Less>() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Extracts the item with specified \p key and returns the guarded pointer to it
+        /**
+            The function is an analog of \ref cds_intrusive_SplitListSet_hp_extract "extract(guarded_ptr&, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr extract( Q const& key )
+        {
+            guarded_ptr gp ;
+            extract( gp, key ) ;
+            return gp ;
+        }
+
+        /// Extracts the item using \p pred predicate and returns the guarded pointer to it
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr extract_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            extract_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Finds the key \p val
         /** \anchor cds_intrusive_SplitListSet_hp_find_func
             The function searches the item with key equal to \p val and calls the functor \p f for item found.
@@ -840,6 +963,66 @@ namespace cds { namespace intrusive {
             return find_( val, typename wrapped_ordered_list::template make_compare_from_less<Less>() ) ;
         }
 
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /** \anchor cds_intrusive_SplitListSet_hp_get
+            The function searches the item with key equal to \p key
+            and assigns the item found to guarded pointer \p ptr.
+            The function returns \p true if \p key is found, and \p false otherwise.
+            If \p key is not found the \p ptr parameter is not changed.
+
+            The item is not copied: it stays in the set and the guard only prevents it from being disposed.
+            @note Each \p guarded_ptr object uses one GC's guard which can be limited resource.
+
+            Note the hash functor specified for class \p Traits template parameter
+            should accept a parameter of type \p Q that can be not the same as \p value_type.
+        */
+        template <typename Q>
+        bool get( guarded_ptr& ptr, Q const& key )
+        {
+            return get_( ptr.guard(), key, key_comparator() ) ;
+        }
+
+        /// Finds the key \p key and returns the guarded pointer to the item found using \p pred predicate
+        /**
+            The function is an analog of \ref cds_intrusive_SplitListSet_hp_get "get( guarded_ptr& ptr, Q const&)"
+            but \p pred is used for comparing the keys.
+            \p Less has the interface like \p std::less.
+            \p pred must imply the same element order as the comparator used for building the set.
+        */
+        template <typename Q, typename Less>
+        bool get_with( guarded_ptr& ptr, Q const& key, Less pred )
+        {
+            return get_( ptr.guard(), key, typename wrapped_ordered_list::template make_compare_from_less<Less>() ) ;
+        }
+
+#   ifdef CDS_MOVE_SEMANTICS_SUPPORT
+        /// Finds the key \p key and returns the guarded pointer to the item found
+        /**
+            The function is an analog of \ref cds_intrusive_SplitListSet_hp_get "get( guarded_ptr& ptr, Q const&)"
+            that returns the guarded pointer. If the key is not found the guarded pointer returned is empty.
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q>
+        guarded_ptr get( Q const& key )
+        {
+            guarded_ptr gp ;
+            get( gp, key ) ;
+            return gp ;
+        }
+
+        /// Finds the key \p key using \p pred predicate and returns the guarded pointer to the item found
+        /**
+            @note This function is available only for compiler that supports move semantics
+        */
+        template <typename Q, typename Less>
+        guarded_ptr get_with( Q const& key, Less pred )
+        {
+            guarded_ptr gp ;
+            get_with( gp, key, pred ) ;
+            return gp ;
+        }
+#   endif
+
         /// Returns item count in the set
         size_t size() const
         {
@@ -874,6 +1057,12 @@ namespace cds { namespace intrusive {
             }
         }
 
+        /// Returns current bucket count
+        size_t bucket_count() const
+        {
+            return ((size_t) 1) << m_nBucketCountLog2.load( CDS_ATOMIC::memory_order_relaxed ) ;
+        }
+
     protected:
         //@cond
         template <bool IsConst>
@@ -104,6 +104,21 @@ namespace cds { namespace intrusive {
             */
             static const bool dynamic_bucket_table = true ;
 
+            /// Shrink factor of the bucket table
+            /**
+                The RCU-based split-list halves the bucket count when the erasing makes
+                the average item count per bucket less than <tt>load_factor / shrink_factor</tt>.
+                Zero value disables the shrinking.
+
+                The option is supported by the RCU-based split-list only. The split-list based on
+                Hazard Pointer and Pass-the-Buck GC rejects non-zero value at compile time:
+                the search in the bucket starts from its dummy node that is not guarded, so the dummy node
+                cannot be removed while the set is in use.
+
+                Default is 0 (the bucket table is not shrunk).
+            */
+            static const size_t shrink_factor = 0 ;
+
             /// back-off strategy used
             /**
                 If the option is not specified, the cds::backoff::Default is used.
@@ -129,6 +144,25 @@ namespace cds { namespace intrusive {
             //@endcond
         };
 
+        /// [value-option] Split-list shrink factor option
+        /**
+            The option specifies the floor of the load factor for the RCU-based split-list:
+            the bucket table is halved while the average item count per bucket
+            is less than <tt>load_factor / Value</tt>. \p Value = 0 disables the shrinking.
+            Non-zero \p Value is not allowed for the split-list based on Hazard Pointer and Pass-the-Buck GC.
+            See type_traits::shrink_factor.
+        */
+        template <size_t Value>
+        struct shrink_factor
+        {
+            //@cond
+            template <typename Base> struct pack: public Base
+            {
+                static const size_t shrink_factor = Value ;
+            };
+            //@endcond
+        };
+
         /// Metafunction converting option list to traits struct
         /**
             This is a wrapper for <tt> cds::opt::make_options< type_traits, Options...> </tt>
@@ -142,6 +176,8 @@ namespace cds { namespace intrusive {
             - opt::allocator - optional, bucket table allocator. Default is \ref CDS_DEFAULT_ALLOCATOR.
             - split_list::dynamic_bucket_table - use dynamic or static bucket table implementation.
                 Dynamic bucket table expands its size up to maximum bucket count when necessary
+            - split_list::shrink_factor - the floor of the load factor for \p shrink() function of RCU-based split-list.
+                Default is 0 (no shrinking).
             - opt::back_off - back-off strategy used for spinning. If the option is not specified, the cds::backoff::Default is used.
 
             See \ref MichaelHashSet, \ref type_traits.
@@ -251,6 +287,17 @@ namespace cds { namespace intrusive {
                 m_Table[ nBucket ].store( pNode, memory_model::memory_order_release )   ;
             }
 
+            /// Clears the buckets from \p nBucketCount to the end of the table
+            /**
+                The dummy nodes of the buckets must be unlinked from the split-list before the call,
+                and no thread may access the buckets released.
+            */
+            void shrink( size_t nBucketCount )
+            {
+                for ( size_t nBucket = nBucketCount; nBucket < m_nCapacity; ++nBucket )
+                    m_Table[ nBucket ].store( null_ptr<node_type *>(), memory_model::memory_order_relaxed ) ;
+            }
+
             /// Returns the capacity of the bucket table
             size_t capacity() const
             {
@@ -458,6 +505,36 @@ namespace cds { namespace intrusive {
                 segment.load(memory_model::memory_order_acquire)[ nBucket & (m_metrics.nSegmentSize - 1) ].store( pNode, memory_model::memory_order_release ) ;
             }
 
+            /// Clears the buckets from \p nBucketCount to the end of the table
+            /**
+                The segments that contain only the buckets with index greater than or equal
+                to \p nBucketCount are deallocated.
+                The dummy nodes of the buckets must be unlinked from the split-list before the call,
+                and no thread may access the buckets released.
+            */
+            void shrink( size_t nBucketCount )
+            {
+                // The first segment that will be deallocated
+                size_t nSegment = ( nBucketCount + m_metrics.nSegmentSize - 1 ) >> m_metrics.nSegmentSizeLog2 ;
+
+                // The tail of the last segment kept
+                if ( nSegment > 0 && ( nBucketCount & (m_metrics.nSegmentSize - 1)) != 0 ) {
+                    table_entry * pSegment = m_Segments[ nSegment - 1 ].load( memory_model::memory_order_relaxed ) ;
+                    if ( pSegment != null_ptr<table_entry *>() ) {
+                        for ( size_t i = nBucketCount & (m_metrics.nSegmentSize - 1); i < m_metrics.nSegmentSize; ++i )
+                            pSegment[i].store( null_ptr<node_type *>(), memory_model::memory_order_relaxed ) ;
+                    }
+                }
+
+                for ( ; nSegment < m_metrics.nSegmentCount; ++nSegment ) {
+                    table_entry * pSegment = m_Segments[ nSegment ].load( memory_model::memory_order_relaxed ) ;
+                    if ( pSegment != null_ptr<table_entry *>() ) {
+                        m_Segments[ nSegment ].store( null_ptr<table_entry *>(), memory_model::memory_order_relaxed ) ;
+                        destroy_segment( pSegment ) ;
+                    }
+                }
+            }
+
             /// Returns the capacity of the bucket table
             size_t capacity() const
             {
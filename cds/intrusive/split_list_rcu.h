@@ -185,6 +185,14 @@ namespace cds { namespace intrusive {
                 return base_class::extract_at( h, val, cmp )  ;
             }
 
+            template <typename Compare>
+            value_type * extract_at( dummy_node_type * pHead, value_type& val, Compare cmp )
+            {
+                assert( pHead != null_ptr<dummy_node_type *>() ) ;
+                bucket_head_type h(pHead) ;
+                return base_class::extract_at( h, val, cmp )  ;
+            }
+
             template <typename Q, typename Compare, typename Func>
             bool find_at( dummy_node_type * pHead, split_list::details::search_value_type<Q>& val, Compare cmp, Func f ) const
             {
@@ -210,8 +218,33 @@ namespace cds { namespace intrusive {
                 bucket_head_type h(pHead) ;
                 return base_class::insert_aux_node( h, pNode ) ;
             }
+
+            void dispose( value_type * pVal )
+            {
+                base_class::dispose_node( base_class::node_traits::to_node_ptr( pVal )) ;
+            }
         };
 
+        // Compares the item of the list with the item to unlink.
+        // The item with equal key but other address is treated as greater, so it is not unlinked
+        struct unlink_compare
+        {
+            int operator()( value_type const& item, value_type const& val ) const
+            {
+                int nCmp = key_comparator()( item, val ) ;
+                if ( nCmp != 0 )
+                    return nCmp ;
+                return &item == &val ? 0 : 1 ;
+            }
+        };
+
+#   ifndef CDS_CXX11_LAMBDA_SUPPORT
+        struct empty_erase_functor {
+            void operator()( value_type const& )
+            {}
+        };
+#   endif
+
         template <typename Less>
         struct less_wrapper: public cds::opt::details::make_comparator_from_less<Less>
         {
@@ -235,11 +268,13 @@ namespace cds { namespace intrusive {
         ordered_list_wrapper    m_List              ;   ///< Ordered list containing split-list items
         bucket_table            m_Buckets           ;   ///< bucket table
         CDS_ATOMIC::atomic<size_t> m_nBucketCountLog2  ;   ///< log2( current bucket count )
+        CDS_ATOMIC::atomic<bool>   m_bShrinking     ;   ///< the bucket table is being shrunk, it cannot grow
         item_counter            m_ItemCounter       ;   ///< Item counter
         hash                    m_HashFunctor       ;   ///< Hash functor
 
     protected:
         //@cond
+        typedef typename gc::scoped_lock    rcu_lock ;
         typedef cds::details::Allocator< dummy_node_type, typename options::allocator >   dummy_node_allocator    ;
         static dummy_node_type * alloc_dummy_node( size_t nHash )
         {
@@ -259,7 +294,7 @@ namespace cds { namespace intrusive {
 
         size_t bucket_no( size_t nHash ) const
         {
-            return nHash & ( (1 << m_nBucketCountLog2.load(CDS_ATOMIC::memory_order_relaxed)) - 1 )    ;
+            return nHash & ( (1 << m_nBucketCountLog2.load(CDS_ATOMIC::memory_order_acquire)) - 1 )    ;
         }
 
         static size_t parent_bucket( size_t nBucket )
@@ -305,8 +340,11 @@ namespace cds { namespace intrusive {
             }
         }
 
+        // The bucket head is valid only inside RCU critical section:
+        // the dummy node of the bucket released by shrink() is disposed after RCU synchronization
         dummy_node_type * get_bucket( size_t nHash )
         {
+            assert( gc::is_locked() ) ;
             size_t nBucket = bucket_no( nHash )     ;
 
             dummy_node_type * pHead = m_Buckets.bucket( nBucket )   ;
@@ -337,18 +375,39 @@ namespace cds { namespace intrusive {
 
         void    inc_item_count()
         {
-            size_t sz = m_nBucketCountLog2.load(CDS_ATOMIC::memory_order_relaxed)    ;
-            if ( ( ++m_ItemCounter >> sz ) > m_Buckets.load_factor() && ((size_t)(1 << sz )) < m_Buckets.capacity() )
+            size_t sz = m_nBucketCountLog2.load(CDS_ATOMIC::memory_order_seq_cst)    ;
+            if ( ( ++m_ItemCounter >> sz ) > m_Buckets.load_factor() && ((size_t)(1 << sz )) < m_Buckets.capacity()
+                && !m_bShrinking.load( CDS_ATOMIC::memory_order_seq_cst ))   // the table cannot grow while shrink() is in progress
             {
                 m_nBucketCountLog2.compare_exchange_strong( sz, sz + 1, CDS_ATOMIC::memory_order_seq_cst, CDS_ATOMIC::memory_order_relaxed ) ;
             }
         }
 
+        void    dec_item_count()
+        {
+            --m_ItemCounter ;
+            if ( options::shrink_factor > 0 ) {
+                size_t sz = m_nBucketCountLog2.load(CDS_ATOMIC::memory_order_relaxed)    ;
+                if ( shrink_log2( sz ) < sz )
+                    shrink() ;
+            }
+        }
+
+        // Returns log2 of the bucket count the table can be shrunk to
+        size_t shrink_log2( size_t nLog2 ) const
+        {
+            size_t const nItemCount = m_ItemCounter ;
+            while ( nLog2 > 1 && nItemCount * options::shrink_factor < ( ((size_t) 1) << nLog2 ) * m_Buckets.load_factor() )
+                --nLog2 ;
+            return nLog2 ;
+        }
+
         template <typename Q, typename Compare, typename Func>
         bool find_( Q& val, Compare cmp, Func f )
         {
             size_t nHash = hash_value( val )    ;
             split_list::details::search_value_type<Q>  sv( val, split_list::regular_hash( nHash )) ;
+            rcu_lock l ;
             dummy_node_type * pHead = get_bucket( nHash ) ;
             assert( pHead != null_ptr<dummy_node_type *>() ) ;
 
@@ -366,6 +425,7 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val )    ;
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash( nHash )) ;
+            rcu_lock l ;
             dummy_node_type * pHead = get_bucket( nHash ) ;
             assert( pHead != null_ptr<dummy_node_type *>() ) ;
 
@@ -389,16 +449,11 @@ namespace cds { namespace intrusive {
         template <typename Q, typename Compare>
         bool erase_( const Q& val, Compare cmp )
         {
-            size_t nHash = hash_value( val )    ;
-            split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash( nHash )) ;
-            dummy_node_type * pHead = get_bucket( nHash ) ;
-            assert( pHead != null_ptr<dummy_node_type *>() ) ;
-
-            if ( m_List.erase_at( pHead, sv, cmp ) ) {
-                --m_ItemCounter     ;
-                return true         ;
-            }
-            return false    ;
+#       ifdef CDS_CXX11_LAMBDA_SUPPORT
+            return erase_( val, cmp, [](value_type const&){} ) ;
+#       else
+            return erase_( val, cmp, empty_erase_functor() ) ;
+#       endif
         }
 
         template <typename Q, typename Compare, typename Func>
@@ -406,11 +461,21 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hash_value( val )    ;
             split_list::details::search_value_type<Q const>  sv( val, split_list::regular_hash( nHash )) ;
-            dummy_node_type * pHead = get_bucket( nHash ) ;
-            assert( pHead != null_ptr<dummy_node_type *>() ) ;
+            value_type * pItem ;
 
-            if ( m_List.erase_at( pHead, sv, cmp, f )) {
-                --m_ItemCounter     ;
+            // The item is unlinked under RCU lock since the bucket head is valid only inside RCU critical section,
+            // and it is disposed outside of RCU lock
+            {
+                rcu_lock l ;
+                dummy_node_type * pHead = get_bucket( nHash ) ;
+                assert( pHead != null_ptr<dummy_node_type *>() ) ;
+                pItem = m_List.extract_at( pHead, sv, cmp ) ;
+            }
+
+            if ( pItem ) {
+                cds::unref(f)( *pItem ) ;
+                m_List.dispose( pItem ) ;
+                dec_item_count() ;
                 return true         ;
             }
             return false    ;
@@ -427,6 +492,7 @@ namespace cds { namespace intrusive {
         */
         SplitListSet()
             : m_nBucketCountLog2(1)
+            , m_bShrinking( false )
         {
             init()  ;
         }
@@ -438,6 +504,7 @@ namespace cds { namespace intrusive {
             )
             : m_Buckets( nItemCount, nLoadFactor )
             , m_nBucketCountLog2(1)
+            , m_bShrinking( false )
         {
             init()  ;
         }
@@ -455,16 +522,19 @@ namespace cds { namespace intrusive {
         bool insert( value_type& val )
         {
             size_t nHash = hash_value( val )    ;
-            dummy_node_type * pHead = get_bucket( nHash ) ;
-            assert( pHead != null_ptr<dummy_node_type *>() )             ;
-
             node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash( nHash ) ;
 
-            if ( m_List.insert_at( pHead, val )) {
-                inc_item_count()  ;
-                return true         ;
+            bool bRet ;
+            {
+                rcu_lock l ;
+                dummy_node_type * pHead = get_bucket( nHash ) ;
+                assert( pHead != null_ptr<dummy_node_type *>() )             ;
+                bRet = m_List.insert_at( pHead, val ) ;
             }
-            return false    ;
+
+            if ( bRet )
+                inc_item_count()  ;
+            return bRet ;
         }
 
         /// Inserts new node
@@ -491,16 +561,19 @@ namespace cds { namespace intrusive {
         bool insert( value_type& val, Func f )
         {
             size_t nHash = hash_value( val )    ;
-            dummy_node_type * pHead = get_bucket( nHash ) ;
-            assert( pHead != null_ptr<dummy_node_type *>() ) ;
-
             node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash( nHash ) ;
 
-            if ( m_List.insert_at( pHead, val, f )) {
-                inc_item_count()  ;
-                return true         ;
+            bool bRet ;
+            {
+                rcu_lock l ;
+                dummy_node_type * pHead = get_bucket( nHash ) ;
+                assert( pHead != null_ptr<dummy_node_type *>() ) ;
+                bRet = m_List.insert_at( pHead, val, f ) ;
             }
-            return false    ;
+
+            if ( bRet )
+                inc_item_count()  ;
+            return bRet ;
         }
 
         /// Ensures that the \p val exists in the set
@@ -535,12 +608,15 @@ namespace cds { namespace intrusive {
         std::pair<bool, bool> ensure( value_type& val, Func func )
         {
             size_t nHash = hash_value( val )    ;
-            dummy_node_type * pHead = get_bucket( nHash ) ;
-            assert( pHead != null_ptr<dummy_node_type *>() ) ;
-
             node_traits::to_node_ptr( val )->m_nHash = split_list::regular_hash( nHash ) ;
 
-            std::pair<bool, bool> bRet = m_List.ensure_at( pHead, val, func ) ;
+            std::pair<bool, bool> bRet ;
+            {
+                rcu_lock l ;
+                dummy_node_type * pHead = get_bucket( nHash ) ;
+                assert( pHead != null_ptr<dummy_node_type *>() ) ;
+                bRet = m_List.ensure_at( pHead, val, func ) ;
+            }
             if ( bRet.first && bRet.second )
                 inc_item_count()  ;
             return bRet ;
@@ -563,11 +639,18 @@ namespace cds { namespace intrusive {
         bool unlink( value_type& val )
         {
             size_t nHash = hash_value( val )    ;
-            dummy_node_type * pHead = get_bucket( nHash ) ;
-            assert( pHead != null_ptr<dummy_node_type *>() ) ;
+            value_type * pItem ;
+            {
+                rcu_lock l ;
+                dummy_node_type * pHead = get_bucket( nHash ) ;
+                assert( pHead != null_ptr<dummy_node_type *>() ) ;
+                pItem = m_List.extract_at( pHead, val, unlink_compare() ) ;
+            }
 
-            if ( m_List.unlink_at( pHead, val ) ) {
-                --m_ItemCounter     ;
+            if ( pItem ) {
+                assert( pItem == &val ) ;
+                m_List.dispose( pItem ) ;
+                dec_item_count() ;
                 return true     ;
             }
             return false    ;
@@ -827,6 +910,80 @@ namespace cds { namespace intrusive {
             }
         }
 
+        /// Returns current bucket count
+        size_t bucket_count() const
+        {
+            return ((size_t) 1) << m_nBucketCountLog2.load( CDS_ATOMIC::memory_order_relaxed ) ;
+        }
+
+        /// Shrinks the bucket table
+        /**
+            The bucket table of the split-list grows when the set is being filled.
+            The function halves the bucket count while the average item count per bucket is less than
+            <tt>load_factor / shrink_factor</tt>, where \p shrink_factor is the value of split_list::shrink_factor option.
+            If the option is 0 (the default) the function does nothing.
+            The table is never shrunk to less than two buckets.
+            The function is called automatically by \p erase and \p unlink when the item count falls
+            below the floor, so, usually you do not need to call it.
+
+            The function is thread-safe. Only one thread can shrink the table at a time;
+            if the table is being shrunk by other thread the function returns immediately.
+            The table cannot grow while it is being shrunk.
+            At first, the bucket count is reduced and RCU \p synchronize is called to wait
+            for all operations that may use the released buckets as a head of the search.
+            Then the dummy nodes of the released buckets are unlinked from the list and retired by RCU,
+            and the segments of split_list::expandable_bucket_table that contain only the released buckets
+            are deallocated.
+
+            RCU \p synchronize method is called, therefore, RCU should not be locked.
+
+            Returns the number of buckets the table is reduced by.
+        */
+        size_t shrink()
+        {
+            if ( options::shrink_factor == 0 )
+                return 0 ;
+
+            bool bShrinking = false ;
+            if ( !m_bShrinking.compare_exchange_strong( bShrinking, true, CDS_ATOMIC::memory_order_seq_cst, CDS_ATOMIC::memory_order_relaxed ))
+                return 0 ;
+
+            size_t nOldLog2 = m_nBucketCountLog2.load( CDS_ATOMIC::memory_order_seq_cst ) ;
+            size_t const nNewLog2 = shrink_log2( nOldLog2 ) ;
+            if ( nNewLog2 == nOldLog2
+                || !m_nBucketCountLog2.compare_exchange_strong( nOldLog2, nNewLog2, CDS_ATOMIC::memory_order_seq_cst, CDS_ATOMIC::memory_order_relaxed ))
+            {
+                // Nothing to shrink or the table has been grown by concurrent insert
+                m_bShrinking.store( false, CDS_ATOMIC::memory_order_release ) ;
+                return 0 ;
+            }
+
+            // Wait for the operations that have got the head of a released bucket
+            gc::synchronize() ;
+
+            size_t const nOldCount = ((size_t) 1) << nOldLog2 ;
+            size_t const nNewCount = ((size_t) 1) << nNewLog2 ;
+
+            // Each released bucket follows the bucket (nBucket mod nNewCount) in the split-ordered list,
+            // so its dummy node is unlinked starting from that bucket
+            for ( size_t nBucket = nOldCount - 1; nBucket >= nNewCount; --nBucket ) {
+                dummy_node_type * pBucket = m_Buckets.bucket( nBucket ) ;
+                if ( pBucket != null_ptr<dummy_node_type *>() ) {
+                    dummy_node_type * pHead ;
+                    {
+                        rcu_lock l ;
+                        pHead = get_bucket( nBucket ) ;
+                    }
+                    // pHead is the dummy node of a bucket that is not released, it cannot be disposed
+                    CDS_VERIFY( m_List.unlink_at( pHead, *node_traits::to_value_ptr( pBucket ))) ;
+                }
+            }
+            m_Buckets.shrink( nNewCount ) ;
+
+            m_bShrinking.store( false, CDS_ATOMIC::memory_order_release ) ;
+            return nOldCount - nNewCount ;
+        }
+
     protected:
         //@cond
         template <bool IsConst>
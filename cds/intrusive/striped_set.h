@@ -47,7 +47,7 @@ namespace cds { namespace intrusive {
 
         The \p Options are:
         - opt::mutex_policy - concurrent access policy.
-            Available policies: striped_set::striping, striped_set::refinable.
+            Available policies: striped_set::striping, striped_set::rw_striping, striped_set::refinable.
             Default is striped_set::striping.
         - cds::opt::hash - hash functor. Default option value see <tt>opt::v::hash_selector <opt::none></tt> which selects default hash functor for
             your compiler.
@@ -68,6 +68,9 @@ namespace cds { namespace intrusive {
             For other, non-sequential types of \p Container (like a \p boost::intrusive::set) the resizing policy is not so important.
         - cds::opt::buffer - a buffer type used only for boost::intrusive::unordered_set.
             Default is cds::opt::v::static_buffer< cds::any_type, 256 >.
+        - striped_set::incremental_resize - enables incremental resizing: the old and new bucket tables
+            are kept side by side and the items are migrated by a few buckets per update operation,
+            so no single operation pays for the whole rehash. Default is <tt>incremental_resize<false></tt>.
 
             opt::compare or opt::less options are used in some \p Container class for ordering.
             opt::compare option has the highest priority: if opt::compare is specified, opt::less is not used.
@@ -275,6 +278,8 @@ namespace cds { namespace intrusive {
             typedef cds::opt::none                  resizing_policy ;
             typedef cds::opt::none                  compare         ;
             typedef cds::opt::none                  less            ;
+            static bool const incremental_resize = false ;
+            static size_t const incremental_resize_step = 4 ;
         };
 
         typedef typename cds::opt::make_options<
@@ -309,11 +314,44 @@ namespace cds { namespace intrusive {
 
         static const size_t c_nMinimalCapacity = 16 ;   ///< Minimal capacity
 
+        static bool const   c_bIncrementalResize = options::incremental_resize ;  ///< Incremental resizing, see striped_set::incremental_resize
+        static size_t const c_nMigrateStep = options::incremental_resize_step ;    ///< Count of old buckets migrated by an update operation
+
+        //@cond
+        typedef cds::details::Allocator< size_t, allocator_type > cursor_allocator ;
+
+        // State of incremental resizing.
+        // pOldBuckets and pCursor are changed under scoped_resize_lock only;
+        // the old buckets of cell c (c, c + nLockCount, c + 2 * nLockCount, ...) and pCursor[c]
+        // are guarded by the cell c of lock array
+        struct migration_state {
+            bucket_type *   pOldBuckets     ;   // old bucket table, NULL if migration is not in progress
+            size_t          nOldBucketMask  ;   // old bucket table size - 1
+            size_t          nLockCount      ;   // lock array size at the moment the migration is started
+            size_t *        pCursor         ;   // pCursor[c] - count of old buckets of cell c passed by the migration
+            CDS_ATOMIC::atomic<size_t>  nMigrated   ;   // count of old buckets passed
+            CDS_ATOMIC::atomic<bool>    bActive     ;   // migration is in progress
+            CDS_ATOMIC::atomic<bool>    bFinish     ;   // all old buckets are migrated, the old table can be freed
+
+            migration_state()
+                : pOldBuckets( null_ptr<bucket_type *>() )
+                , nOldBucketMask( 0 )
+                , nLockCount( 0 )
+                , pCursor( null_ptr<size_t *>() )
+                , nMigrated( 0 )
+                , bActive( false )
+                , bFinish( false )
+            {}
+        };
+        migration_state m_Migration ;
+        //@endcond
+
     protected:
         //@cond
         typedef typename mutex_policy::scoped_cell_lock     scoped_cell_lock    ;
         typedef typename mutex_policy::scoped_full_lock     scoped_full_lock    ;
         typedef typename mutex_policy::scoped_resize_lock   scoped_resize_lock  ;
+        typedef typename striped_set::details::select_shared_cell_lock< mutex_policy >::type scoped_cell_shared_lock ;
 
 #   ifndef CDS_CXX11_LAMBDA_SUPPORT
         struct empty_insert_functor {
@@ -370,16 +408,30 @@ namespace cds { namespace intrusive {
         {
             size_t nHash = hashing( val )               ;
 
-            scoped_cell_lock sl( m_MutexPolicy, nHash ) ;
-            return bucket( nHash )->find( val, f )      ;
+            scoped_cell_shared_lock sl( m_MutexPolicy, nHash ) ;
+            return bucket_for_find( nHash )->find( val, f ) ;
         }
 
         template <typename Q, typename Less, typename Func>
         bool find_with_( Q& val, Less pred, Func f )
         {
             size_t nHash = hashing( val )               ;
-            scoped_cell_lock sl( m_MutexPolicy, nHash ) ;
-            return bucket( nHash )->find( val, pred, f ) ;
+            scoped_cell_shared_lock sl( m_MutexPolicy, nHash ) ;
+            return bucket_for_find( nHash )->find( val, pred, f ) ;
+        }
+
+        // Moves all items of pCur bucket into the current bucket table
+        void move_bucket( bucket_type * pCur )
+        {
+            typedef typename bucket_type::iterator bucket_iterator ;
+            bucket_iterator itEnd = pCur->end() ;
+            bucket_iterator itNext ;
+            for ( bucket_iterator it = pCur->begin(); it != itEnd; it = itNext ) {
+                itNext = it ;
+                ++itNext    ;
+                bucket( m_Hash( *it ) )->move_item( *pCur, it ) ;
+            }
+            pCur->clear()   ;
         }
 
         void internal_resize( size_t nNewCapacity )
@@ -392,31 +444,142 @@ namespace cds { namespace intrusive {
 
             alloc_bucket_table( nNewCapacity ) ;
 
-            typedef typename bucket_type::iterator bucket_iterator ;
             bucket_type * pEnd = pOldBuckets + nOldCapacity ;
-            for ( bucket_type * pCur = pOldBuckets; pCur != pEnd; ++pCur ) {
-                bucket_iterator itEnd = pCur->end() ;
-                bucket_iterator itNext ;
-                for ( bucket_iterator it = pCur->begin(); it != itEnd; it = itNext ) {
-                    itNext = it ;
-                    ++itNext    ;
-                    bucket( m_Hash( *it ) )->move_item( *pCur, it ) ;
-                }
-                pCur->clear()   ;
-            }
+            for ( bucket_type * pCur = pOldBuckets; pCur != pEnd; ++pCur )
+                move_bucket( pCur ) ;
 
             free_bucket_table( pOldBuckets, nOldCapacity ) ;
 
             m_ResizingPolicy.reset()    ;
         }
 
+        // Incremental resizing: allocates new bucket table and keeps the old one for migration
+        void start_migration( size_t nNewCapacity )
+        {
+            // Resize lock is held!
+            assert( m_Migration.pOldBuckets == null_ptr<bucket_type *>() ) ;
+
+            size_t const nLockCount = m_MutexPolicy.lock_count() ;
+            assert( cds::beans::is_power2( nLockCount )) ;
+            assert( nLockCount <= bucket_count() ) ;
+
+            m_Migration.pOldBuckets = m_Buckets ;
+            m_Migration.nOldBucketMask = m_nBucketMask ;
+            m_Migration.nLockCount = nLockCount ;
+            m_Migration.pCursor = cursor_allocator().NewArray( nLockCount, 0 ) ;
+            m_Migration.nMigrated.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+            m_Migration.bFinish.store( false, CDS_ATOMIC::memory_order_relaxed ) ;
+
+            alloc_bucket_table( nNewCapacity ) ;
+            m_Migration.bActive.store( true, CDS_ATOMIC::memory_order_release ) ;
+
+            m_ResizingPolicy.reset()    ;
+        }
+
+        // Incremental resizing: frees the old bucket table when all its buckets are migrated
+        void finish_migration()
+        {
+            // Resize lock is held!
+            assert( m_Migration.nMigrated.load( CDS_ATOMIC::memory_order_relaxed ) == m_Migration.nOldBucketMask + 1 ) ;
+
+            free_migration_state() ;
+            m_MutexPolicy.resize( bucket_count() ) ;
+            m_Migration.bFinish.store( false, CDS_ATOMIC::memory_order_relaxed ) ;
+            m_Migration.bActive.store( false, CDS_ATOMIC::memory_order_release ) ;
+        }
+
+        void free_migration_state()
+        {
+            if ( m_Migration.pOldBuckets ) {
+                free_bucket_table( m_Migration.pOldBuckets, m_Migration.nOldBucketMask + 1 ) ;
+                cursor_allocator().Delete( m_Migration.pCursor, m_Migration.nLockCount ) ;
+                m_Migration.pOldBuckets = null_ptr<bucket_type *>() ;
+                m_Migration.pCursor = null_ptr<size_t *>() ;
+            }
+        }
+
+        // Incremental resizing: migrates the old bucket of nHash and up to c_nMigrateStep old buckets of the same cell
+        void migrate( size_t nHash )
+        {
+            // The cell of nHash is locked exclusively!
+            bucket_type * pOld = m_Migration.pOldBuckets + ( nHash & m_Migration.nOldBucketMask ) ;
+            if ( pOld->begin() != pOld->end() )
+                move_bucket( pOld ) ;
+
+            size_t const nLockCount = m_Migration.nLockCount ;
+            size_t const nCellBucketCount = ( m_Migration.nOldBucketMask + 1 ) / nLockCount ;
+            size_t const nCell = nHash & ( nLockCount - 1 ) ;
+            size_t& nCursor = m_Migration.pCursor[ nCell ] ;
+            if ( nCursor < nCellBucketCount ) {
+                size_t nEnd = nCursor + c_nMigrateStep ;
+                if ( nEnd > nCellBucketCount )
+                    nEnd = nCellBucketCount ;
+                size_t const nCount = nEnd - nCursor ;
+                for ( ; nCursor < nEnd; ++nCursor ) {
+                    pOld = m_Migration.pOldBuckets + nCell + nCursor * nLockCount ;
+                    if ( pOld->begin() != pOld->end() )
+                        move_bucket( pOld ) ;
+                }
+                if ( m_Migration.nMigrated.fetch_add( nCount, CDS_ATOMIC::memory_order_relaxed ) + nCount == m_Migration.nOldBucketMask + 1 )
+                    m_Migration.bFinish.store( true, CDS_ATOMIC::memory_order_release ) ;
+            }
+        }
+
+        // Returns the bucket for nHash to be changed. The cell of nHash should be locked exclusively
+        bucket_type * bucket_for_update( size_t nHash )
+        {
+            if ( c_bIncrementalResize && m_Migration.pOldBuckets )
+                migrate( nHash ) ;
+            return bucket( nHash ) ;
+        }
+
+        // Returns the bucket for nHash to be searched. The cell of nHash should be locked in any mode
+        bucket_type * bucket_for_find( size_t nHash ) const
+        {
+            if ( c_bIncrementalResize && m_Migration.pOldBuckets ) {
+                // If the old bucket is not migrated yet all its items are in the old bucket
+                bucket_type * pOld = m_Migration.pOldBuckets + ( nHash & m_Migration.nOldBucketMask ) ;
+                if ( pOld->begin() != pOld->end() )
+                    return pOld ;
+            }
+            return bucket( nHash ) ;
+        }
+
+        // Checks if resize() should be called after update operation
+        bool need_resize( bool bResize ) const
+        {
+            return bResize || ( c_bIncrementalResize && m_Migration.bFinish.load( CDS_ATOMIC::memory_order_relaxed )) ;
+        }
+
         void resize()
         {
             size_t nOldCapacity = bucket_count()    ;
             size_t volatile& refBucketMask = m_nBucketMask    ;
 
+            if ( c_bIncrementalResize
+                && m_Migration.bActive.load( CDS_ATOMIC::memory_order_acquire )
+                && !m_Migration.bFinish.load( CDS_ATOMIC::memory_order_acquire ))
+            {
+                // migration is in progress
+                return ;
+            }
+
             scoped_resize_lock al( m_MutexPolicy )  ;
             if ( al.success() ) {
+                if ( c_bIncrementalResize ) {
+                    if ( m_Migration.pOldBuckets ) {
+                        if ( m_Migration.bFinish.load( CDS_ATOMIC::memory_order_relaxed ))
+                            finish_migration() ;
+                        return ;
+                    }
+                    if ( nOldCapacity != refBucketMask + 1 ) {
+                        // someone resized already
+                        return ;
+                    }
+                    start_migration( nOldCapacity * 2 ) ;
+                    return ;
+                }
+
                 if ( nOldCapacity != refBucketMask + 1 ) {
                     // someone resized already
                     return ;
@@ -487,6 +650,7 @@ namespace cds { namespace intrusive {
         /// Destructor destroys internal data
         ~StripedSet()
         {
+            free_migration_state() ;
             free_bucket_table( m_Buckets, m_nBucketMask + 1 ) ;
         }
 
@@ -532,12 +696,12 @@ namespace cds { namespace intrusive {
             bucket_type * pBucket   ;
             {
                 scoped_cell_lock sl( m_MutexPolicy, nHash ) ;
-                pBucket = bucket( nHash )       ;
+                pBucket = bucket_for_update( nHash )       ;
                 bOk = pBucket->insert( val, f ) ;
                 bResize = bOk && m_ResizingPolicy( ++m_ItemCounter, *this, *pBucket ) ;
             }
 
-            if ( bResize )
+            if ( need_resize( bResize ))
                 resize()    ;
             return bOk  ;
         }
@@ -576,13 +740,13 @@ namespace cds { namespace intrusive {
             bucket_type * pBucket       ;
             {
                 scoped_cell_lock sl( m_MutexPolicy, nHash ) ;
-                pBucket = bucket( nHash )    ;
+                pBucket = bucket_for_update( nHash )    ;
 
                 result = pBucket->ensure( val, func )      ;
                 bResize = result.first && result.second && m_ResizingPolicy( ++m_ItemCounter, *this, *pBucket ) ;
             }
 
-            if ( bResize )
+            if ( need_resize( bResize ))
                 resize() ;
             return result       ;
         }
@@ -602,7 +766,7 @@ namespace cds { namespace intrusive {
             size_t nHash = hashing( val )   ;
             {
                 scoped_cell_lock sl( m_MutexPolicy, nHash ) ;
-                bOk = bucket( nHash )->unlink( val )    ;
+                bOk = bucket_for_update( nHash )->unlink( val )    ;
             }
 
             if ( bOk )
@@ -671,7 +835,7 @@ namespace cds { namespace intrusive {
             value_type * pVal ;
             {
                 scoped_cell_lock sl( m_MutexPolicy, nHash ) ;
-                pVal = bucket( nHash )->erase( val, f )  ;
+                pVal = bucket_for_update( nHash )->erase( val, f )  ;
             }
 
             if ( pVal )
@@ -693,7 +857,7 @@ namespace cds { namespace intrusive {
             value_type * pVal ;
             {
                 scoped_cell_lock sl( m_MutexPolicy, nHash ) ;
-                pVal = bucket( nHash )->erase( val, pred, f )  ;
+                pVal = bucket_for_update( nHash )->erase( val, pred, f )  ;
             }
 
             if ( pVal )
@@ -830,6 +994,12 @@ namespace cds { namespace intrusive {
             bucket_type * pBucket = m_Buckets       ;
             for ( size_t i = 0; i < nBucketCount; ++i, ++pBucket )
                 pBucket->clear()    ;
+            if ( c_bIncrementalResize && m_Migration.pOldBuckets ) {
+                nBucketCount = m_Migration.nOldBucketMask + 1 ;
+                pBucket = m_Migration.pOldBuckets ;
+                for ( size_t i = 0; i < nBucketCount; ++i, ++pBucket )
+                    pBucket->clear()    ;
+            }
             m_ItemCounter.reset()   ;
         }
 
@@ -853,6 +1023,12 @@ namespace cds { namespace intrusive {
             bucket_type * pBucket = m_Buckets       ;
             for ( size_t i = 0; i < nBucketCount; ++i, ++pBucket )
                 pBucket->clear( disposer )      ;
+            if ( c_bIncrementalResize && m_Migration.pOldBuckets ) {
+                nBucketCount = m_Migration.nOldBucketMask + 1 ;
+                pBucket = m_Migration.pOldBuckets ;
+                for ( size_t i = 0; i < nBucketCount; ++i, ++pBucket )
+                    pBucket->clear( disposer )  ;
+            }
             m_ItemCounter.reset()   ;
         }
 
@@ -193,6 +193,35 @@ namespace cds { namespace intrusive { namespace striped_set {
         {}
     };
 
+    /// [value-option] Incremental resizing option
+    /**
+        By default (\p Enable = \p false) the set is resized at once: the resizing thread
+        locks all cells of the lock array and moves all items into the new bucket table
+        in one go, so the operation that fires the resizing pays for the whole rehash.
+
+        If \p Enable is \p true, the resizing thread only allocates the new bucket table,
+        the old table is kept beside it and the items are migrated bucket by bucket.
+        Any update operation (\p insert, \p ensure, \p erase and others) migrates the old bucket of its key
+        and up to \p MigrateStep other old buckets guarded by the same cell of the lock array.
+        The lookup operations do not migrate; they search the old bucket of the key if it is not migrated yet.
+        When all old buckets are migrated the next insertion frees the old table.
+        The resizing policy is not asked while migration is in progress.
+
+        Incremental resizing expects that the cell of lock array for the hash value \p h
+        is <tt>h mod L</tt> where \p L is the size of lock array (power of two), as it is for
+        striped_set::striping, striped_set::rw_striping and striped_set::refinable policies.
+    */
+    template <bool Enable, size_t MigrateStep = 4>
+    struct incremental_resize {
+        //@cond
+        template <typename Base> struct pack: public Base
+        {
+            static bool const incremental_resize = Enable ;
+            static size_t const incremental_resize_step = MigrateStep ;
+        };
+        //@endcond
+    };
+
 }}} // namespace cds::intrusive::striped_set
 
 #endif // #define __CDS_INTRUSIVE_STRIPED_SET_RESIZING_POLICY_H
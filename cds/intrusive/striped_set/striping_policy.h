@@ -16,6 +16,7 @@
 #include <cds/os/thread.h>
 #include <cds/details/std/memory.h>
 #include <cds/lock/spinlock.h>
+#include <cds/details/type_padding.h>
 
 #include <cds/details/std/mutex.h>
 //#include <boost/thread/mutex.hpp>
@@ -111,6 +112,136 @@ namespace cds { namespace intrusive { namespace striped_set {
         //@endcond
     };
 
+    /// Reader-writer lock striping concurrent access policy
+    /**
+        This is one of available opt::mutex_policy option type for StripedSet
+
+        The policy is like striped_set::striping but the cells of lock array are reader-writer locks.
+        Lookup functions (\p find, \p find_with) lock the cell in shared mode,
+        so the lookups of the keys guarded by the same cell do not serialize.
+        Other operations lock the cell exclusively; resizing and \p clear lock all cells exclusively.
+        Each cell is padded to the cache line size, so the readers of adjacent cells do not share a cache line.
+
+        Since \p find locks the cell in shared mode, the functor passed to \p find is called concurrently
+        with other lookups of the same item. If the functor changes the item found you should provide your own synchronization
+        or use \p ensure instead.
+        The bucket container must allow concurrent lookups, so \p boost::intrusive::splay_set
+        that rearranges itself in \p find is not suitable for this policy.
+
+        Template arguments:
+        - \p RWLock - the type of reader-writer lock. The default is cds::lock::RWSpin.
+            The lock should be default-constructible and it should have the interface of \p boost::shared_mutex:
+            \p lock(), \p unlock() for exclusive access and \p lock_shared(), \p unlock_shared() for shared access.
+            For example, \p boost::shared_mutex is suitable.
+        - \p Alloc - allocator type used for lock array memory allocation. Default is \p CDS_DEFAULT_ALLOCATOR.
+    */
+    template <class RWLock = cds::lock::RWSpin, class Alloc = CDS_DEFAULT_ALLOCATOR >
+    class rw_striping
+    {
+    public:
+        typedef RWLock  lock_type       ;   ///< reader-writer lock type
+        typedef Alloc   allocator_type  ;   ///< allocator type
+
+        typedef typename cds::details::type_padding< lock_type, c_nCacheLineSize >::type   lock_cell   ;   ///< lock array cell type (padded \p lock_type)
+        typedef cds::lock::array< lock_cell, cds::lock::pow2_select_policy, allocator_type >    lock_array_type ;   ///< lock array type
+
+    protected:
+        //@cond
+        lock_array_type m_Locks ;
+        //@endcond
+
+    public:
+        //@cond
+        class scoped_cell_lock {
+            cds::lock::scoped_lock< lock_array_type >   m_guard ;
+
+        public:
+            scoped_cell_lock( rw_striping& policy, size_t nHash )
+                : m_guard( policy.m_Locks, nHash )
+            {}
+        };
+
+        class scoped_cell_shared_lock {
+            lock_type&  m_Lock ;
+
+        public:
+            scoped_cell_shared_lock( rw_striping& policy, size_t nHash )
+                : m_Lock( policy.m_Locks.at( nHash & (policy.m_Locks.size() - 1) ))
+            {
+                m_Lock.lock_shared() ;
+            }
+
+            ~scoped_cell_shared_lock()
+            {
+                m_Lock.unlock_shared() ;
+            }
+        };
+
+        class scoped_full_lock {
+            cds::lock::scoped_lock< lock_array_type >   m_guard ;
+        public:
+            scoped_full_lock( rw_striping& policy )
+                : m_guard( policy.m_Locks )
+            {}
+        };
+
+        class scoped_resize_lock: public scoped_full_lock {
+        public:
+            scoped_resize_lock( rw_striping& policy )
+                : scoped_full_lock( policy )
+            {}
+
+            bool success() const
+            {
+                return true ;
+            }
+        };
+        //@endcond
+
+    public:
+        /// Constructor
+        rw_striping(
+            size_t nLockCount   ///< The size of lock array. Must be power of two.
+        )
+            : m_Locks( nLockCount, cds::lock::pow2_select_policy( nLockCount ))
+        {}
+
+        /// Returns lock array size
+        /**
+            Lock array size is unchanged during \p striped object lifetime
+        */
+        size_t lock_count() const
+        {
+            return m_Locks.size()   ;
+        }
+
+        //@cond
+        void resize( size_t /*nNewCapacity*/ )
+        {}
+        //@endcond
+    };
+
+    //@cond
+    namespace details {
+        template <typename T>
+        struct void_type {
+            typedef void type ;
+        };
+
+        // Selects MutexPolicy::scoped_cell_shared_lock if the policy supports shared locking of a cell,
+        // otherwise MutexPolicy::scoped_cell_lock
+        template <class MutexPolicy, typename = void>
+        struct select_shared_cell_lock {
+            typedef typename MutexPolicy::scoped_cell_lock type ;
+        };
+        template <class MutexPolicy>
+        struct select_shared_cell_lock< MutexPolicy, typename void_type< typename MutexPolicy::scoped_cell_shared_lock >::type >
+        {
+            typedef typename MutexPolicy::scoped_cell_shared_lock type ;
+        };
+    }   // namespace details
+    //@endcond
+
 
     /// Refinable concurrent access policy
     /**
@@ -409,6 +409,136 @@ namespace cds {
         /// Recursive spin-lock based on atomic32_t type
         typedef ReentrantSpin32                                     ReentrantSpin    ;
 
+        /// Reader-writer spin-lock
+        /**
+            Light-weight reader-writer spin-lock with writer preference.
+            Many readers may own the lock at the same time via \ref lock_shared; a writer owns the lock exclusively via \ref lock.
+            When a writer is waiting, new readers cannot enter the lock, so the writer cannot starve.
+
+            The state of the lock is one 32bit word:
+            bit 0 - the writer owns the lock, bit 1 - a writer is waiting, other bits - the count of readers.
+
+            The class has the same interface as \p boost::shared_mutex: \p lock(), \p try_lock(), \p unlock()
+            for exclusive access and \p lock_shared(), \p try_lock_shared(), \p unlock_shared() for shared access.
+            The lock is not recursive.
+
+            Template parameters:
+                - @p Backoff    backoff strategy. Used when the lock is busy
+        */
+        template <class Backoff>
+        class RWSpinT
+        {
+        public:
+            typedef Backoff     backoff_strategy    ;   ///< back-off strategy type
+
+        private:
+            //@cond
+            static atomic32u_t const c_nWriter       = 1 ;
+            static atomic32u_t const c_nWriterWait   = 2 ;
+            static atomic32u_t const c_nReader       = 4 ;
+
+            CDS_ATOMIC::atomic<atomic32u_t>   m_State ;
+            //@endcond
+
+        public:
+            /// Construct free (unlocked) lock
+            RWSpinT() CDS_NOEXCEPT
+                : m_State( 0 )
+            {}
+
+            /// Dummy copy constructor
+            /**
+                Like a Spinlock, the copy constructor does no copy in fact
+                and initializes the lock to free (unlocked) state.
+            */
+            RWSpinT( RWSpinT<Backoff> const& ) CDS_NOEXCEPT
+                : m_State( 0 )
+            {}
+
+            /// Destructor. On debug time it checks whether the lock is free
+            ~RWSpinT()
+            {
+                assert( (m_State.load( CDS_ATOMIC::memory_order_relaxed ) & ~c_nWriterWait) == 0 ) ;
+            }
+
+            /// Checks if the lock is owned by a writer
+            bool is_locked() const CDS_NOEXCEPT
+            {
+                return (m_State.load( CDS_ATOMIC::memory_order_relaxed ) & c_nWriter) != 0 ;
+            }
+
+            /// Checks if the lock is owned by any reader or writer
+            bool is_busy() const CDS_NOEXCEPT
+            {
+                return (m_State.load( CDS_ATOMIC::memory_order_relaxed ) & ~c_nWriterWait) != 0 ;
+            }
+
+            /// Try to lock exclusively. Returns \p true if success
+            bool try_lock() CDS_NOEXCEPT
+            {
+                atomic32u_t nState = m_State.load( CDS_ATOMIC::memory_order_relaxed ) ;
+                return (nState & ~c_nWriterWait) == 0
+                    && m_State.compare_exchange_strong( nState, c_nWriter, CDS_ATOMIC::memory_order_acquire, CDS_ATOMIC::memory_order_relaxed ) ;
+            }
+
+            /// Lock exclusively. Waits while the lock is owned by any reader or writer
+            void lock() CDS_NOEXCEPT
+            {
+                backoff_strategy backoff ;
+                while ( true ) {
+                    atomic32u_t nState = m_State.load( CDS_ATOMIC::memory_order_relaxed ) ;
+                    if ( (nState & ~c_nWriterWait) == 0 ) {
+                        // Clears the wait flag; other waiting writers set it again on the next iteration
+                        if ( m_State.compare_exchange_weak( nState, c_nWriter, CDS_ATOMIC::memory_order_acquire, CDS_ATOMIC::memory_order_relaxed ))
+                            return ;
+                    }
+                    else if ( !(nState & c_nWriterWait) )
+                        m_State.fetch_or( c_nWriterWait, CDS_ATOMIC::memory_order_relaxed ) ;
+                    backoff() ;
+                }
+            }
+
+            /// Unlock exclusive lock
+            void unlock() CDS_NOEXCEPT
+            {
+                assert( is_locked() ) ;
+                m_State.fetch_and( ~c_nWriter, CDS_ATOMIC::memory_order_release ) ;
+            }
+
+            /// Try to lock in shared mode. Returns \p true if success
+            bool try_lock_shared() CDS_NOEXCEPT
+            {
+                atomic32u_t nState = m_State.load( CDS_ATOMIC::memory_order_relaxed ) ;
+                return (nState & (c_nWriter | c_nWriterWait)) == 0
+                    && m_State.compare_exchange_strong( nState, nState + c_nReader, CDS_ATOMIC::memory_order_acquire, CDS_ATOMIC::memory_order_relaxed ) ;
+            }
+
+            /// Lock in shared mode. Waits while a writer owns the lock or is waiting for it
+            void lock_shared() CDS_NOEXCEPT
+            {
+                backoff_strategy backoff ;
+                while ( true ) {
+                    atomic32u_t nState = m_State.load( CDS_ATOMIC::memory_order_relaxed ) ;
+                    if ( (nState & (c_nWriter | c_nWriterWait)) == 0
+                        && m_State.compare_exchange_weak( nState, nState + c_nReader, CDS_ATOMIC::memory_order_acquire, CDS_ATOMIC::memory_order_relaxed ))
+                    {
+                        return ;
+                    }
+                    backoff() ;
+                }
+            }
+
+            /// Unlock shared lock
+            void unlock_shared() CDS_NOEXCEPT
+            {
+                assert( m_State.load( CDS_ATOMIC::memory_order_relaxed ) >= c_nReader ) ;
+                m_State.fetch_sub( c_nReader, CDS_ATOMIC::memory_order_release ) ;
+            }
+        };
+
+        /// Reader-writer spin-lock default for the current platform
+        typedef RWSpinT<backoff::LockDefault>   RWSpin  ;
+
         /// The best (for the current platform) auto spin-lock
         typedef scoped_lock<Spin>   AutoSpin    ;
 
@@ -15,6 +15,7 @@
 #include <cds/gc/hp_decl.h>
 #include <cds/gc/hrc_decl.h>
 #include <cds/gc/ptb_decl.h>
+#include <cds/gc/ebr_decl.h>
 
 #include <cds/urcu/details/gp_decl.h>
 #include <cds/urcu/details/sh_decl.h>
@@ -88,6 +89,9 @@ namespace cds {
 
             // Get cds::gc::PTB thread GC implementation for current thread ;
             static gc::PTB::thread_gc_impl&   getPTBGC() ;
+
+            // Get cds::gc::EBR thread GC implementation for current thread ;
+            static gc::EBR::thread_gc_impl&   getEBRGC() ;
         };
         \endcode
 
@@ -124,6 +128,7 @@ namespace cds {
             char CDS_DATA_ALIGNMENT(8) m_hpManagerPlaceholder[sizeof(cds::gc::HP::thread_gc_impl)]   ;   ///< Michael's Hazard Pointer GC placeholder
             char CDS_DATA_ALIGNMENT(8) m_hrcManagerPlaceholder[sizeof(cds::gc::HRC::thread_gc_impl)]  ;   ///< Gidenstam's GC placeholder
             char CDS_DATA_ALIGNMENT(8) m_ptbManagerPlaceholder[sizeof(cds::gc::PTB::thread_gc_impl)]  ;   ///< Pass The Buck GC placeholder
+            char CDS_DATA_ALIGNMENT(8) m_ebrManagerPlaceholder[sizeof(cds::gc::EBR::thread_gc_impl)]  ;   ///< Epoch-based GC placeholder
 
             cds::urcu::details::thread_data< cds::urcu::general_instant_tag > *     m_pGPIRCU   ;
             cds::urcu::details::thread_data< cds::urcu::general_buffered_tag > *    m_pGPBRCU   ;
@@ -138,6 +143,7 @@ namespace cds {
             cds::gc::HP::thread_gc_impl  * m_hpManager     ;   ///< Michael's Hazard Pointer GC thread-specific data
             cds::gc::HRC::thread_gc_impl * m_hrcManager    ;   ///< Gidenstam's GC thread-specific data
             cds::gc::PTB::thread_gc_impl * m_ptbManager    ;   ///< Pass The Buck GC thread-specific data
+            cds::gc::EBR::thread_gc_impl * m_ebrManager    ;   ///< Epoch-based GC thread-specific data
 
             size_t  m_nFakeProcessorNumber  ;   ///< fake "current processor" number
 
@@ -176,6 +182,11 @@ namespace cds {
                     m_ptbManager = new (m_ptbManagerPlaceholder) cds::gc::PTB::thread_gc_impl  ;
                 else
                     m_ptbManager = null_ptr<cds::gc::PTB::thread_gc_impl *>() ;
+
+                if ( cds::gc::EBR::isUsed() )
+                    m_ebrManager = new (m_ebrManagerPlaceholder) cds::gc::EBR::thread_gc_impl  ;
+                else
+                    m_ebrManager = null_ptr<cds::gc::EBR::thread_gc_impl *>() ;
             }
 
             ~ThreadData()
@@ -198,6 +209,12 @@ namespace cds {
                     m_ptbManager = null_ptr<cds::gc::PTB::thread_gc_impl *>() ;
                 }
 
+                if ( m_ebrManager ) {
+                    typedef cds::gc::EBR::thread_gc_impl ebr_thread_gc_impl ;
+                    m_ebrManager->~ebr_thread_gc_impl()  ;
+                    m_ebrManager = null_ptr<cds::gc::EBR::thread_gc_impl *>() ;
+                }
+
                 assert( m_pGPIRCU == NULL ) ;
                 assert( m_pGPBRCU == NULL ) ;
                 assert( m_pGPTRCU == NULL ) ;
@@ -216,6 +233,8 @@ namespace cds {
                         m_hrcManager->init()  ;
                     if ( cds::gc::PTB::isUsed() )
                         m_ptbManager->init()  ;
+                    if ( cds::gc::EBR::isUsed() )
+                        m_ebrManager->init()  ;
 
                     if ( cds::urcu::details::singleton<cds::urcu::general_instant_tag>::isUsed() )
                         m_pGPIRCU = cds::urcu::details::singleton<cds::urcu::general_instant_tag>::attach_thread() ;
@@ -235,6 +254,8 @@ namespace cds {
             bool fini()
             {
                 if ( --m_nAttachCount == 0 ) {
+                    if ( cds::gc::EBR::isUsed() )
+                        m_ebrManager->fini()   ;
                     if ( cds::gc::PTB::isUsed() )
                         m_ptbManager->fini()   ;
                     if ( cds::gc::HRC::isUsed() )
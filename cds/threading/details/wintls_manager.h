@@ -239,6 +239,17 @@ namespace cds { namespace threading {
                 return *(_threadData( do_getData )->m_ptbManager)   ;
             }
 
+            /// Get gc::EBR thread GC implementation for current thread
+            /**
+                The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
+                or if you did not use gc::EBR.
+                To initialize gc::EBR GC you must constuct cds::gc::EBR object in the beginning of your application
+            */
+            static gc::EBR::thread_gc_impl&   getEBRGC()
+            {
+                return *(_threadData( do_getData )->m_ebrManager)   ;
+            }
+
             //@cond
             static size_t fake_current_processor()
             {
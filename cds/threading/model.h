@@ -66,6 +66,19 @@ namespace cds { namespace threading {
         return Manager::getPTBGC()  ;
     }
 
+    /// Get cds::gc::EBR thread GC implementation for current thread
+    /**
+        The object returned may be uninitialized if you did not call attachThread in the beginning of thread execution
+        or if you did not use cds::gc::EBR.
+        To initialize cds::gc::EBR GC you must constuct cds::gc::EBR object in the beginning of your application,
+        see \ref cds_how_to_use "How to use libcds"
+    */
+    template <>
+    inline cds::gc::EBR::thread_gc_impl&   getGC<cds::gc::EBR>()
+    {
+        return Manager::getEBRGC()  ;
+    }
+
     //@cond
     template<>
     inline cds::urcu::details::thread_data<cds::urcu::general_instant_tag> * getRCU<cds::urcu::general_instant_tag>()
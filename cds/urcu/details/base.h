@@ -14,6 +14,7 @@
 
 #include <cds/cxx11_atomic.h>
 #include <cds/gc/details/retired_ptr.h>
+#include <cds/gc/details/retired_memory.h>
 #include <cds/details/allocator.h>
 #include <cds/os/thread.h>
 #include <cds/details/marked_ptr.h>
@@ -228,11 +229,32 @@ namespace cds {
 
             //@cond
             class singleton_vtbl {
+            protected:
+                // Bytes of retired objects waiting in the buffer.
+                // Buffered flavours count an object when it is pushed into the buffer and uncount it when it is freed
+                cds::gc::details::retired_memory    m_RetiredMemory ;
+
             protected:
                 virtual ~singleton_vtbl()
                 {}
+
+                // Frees the range of retired pointers; the iterator is advanced before the pointer is freed
+                template <typename ForwardIterator>
+                static void free_range( ForwardIterator itFirst, ForwardIterator itLast )
+                {
+                    while ( itFirst != itLast ) {
+                        retired_ptr p( *itFirst ) ;
+                        ++itFirst   ;
+                        p.free()    ;
+                    }
+                }
             public:
                 virtual void retire_ptr( retired_ptr& p ) = 0 ;
+
+                cds::gc::details::retired_memory& retired_memory()
+                {
+                    return m_RetiredMemory ;
+                }
             };
 
             class gc_common
@@ -77,7 +77,7 @@ namespace cds { namespace urcu { namespace details {
         template <typename T>
         static void retire( T * p, void (* pFunc)(T *) )
         {
-            retired_ptr rp( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc ) ) ;
+            retired_ptr rp( p, pFunc ) ;
             retire( rp )    ;
         }
 
@@ -126,6 +126,20 @@ namespace cds { namespace urcu {
                 p.free()    ;
         }
 
+        /// Retires the range [\p itFirst, \p itLast) of retired pointers
+        /**
+            The method waits for the end of grace period only once for the whole range
+            and then frees all pointers of the range.
+        */
+        template <typename ForwardIterator>
+        void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
+        {
+            if ( itFirst != itLast ) {
+                synchronize()   ;
+                base_class::free_range( itFirst, itLast ) ;
+            }
+        }
+
         /// Wait to finish a grace period
         void synchronize()
         {
@@ -117,6 +117,7 @@ namespace cds { namespace urcu {
         {
             epoch_retired_ptr p ;
             while ( m_Buffer.pop( p )) {
+                m_RetiredMemory.sub( p.m_nSize ) ;
                 if ( p.m_nEpoch <= nEpoch )
                     p.free() ;
                 else {
@@ -126,9 +127,20 @@ namespace cds { namespace urcu {
             }
         }
 
+        // Pushes ep into the buffer and counts its size in retired memory.
+        // The size is counted before the push, so a concurrent clear_buffer never makes the counter negative
+        bool push_retired( epoch_retired_ptr& ep )
+        {
+            m_RetiredMemory.add( ep.m_nSize ) ;
+            if ( m_Buffer.push( ep ))
+                return true ;
+            m_RetiredMemory.sub( ep.m_nSize ) ;
+            return false ;
+        }
+
         void push_buffer( epoch_retired_ptr& ep )
         {
-            bool bPushed = m_Buffer.push( ep ) ;
+            bool bPushed = push_retired( ep ) ;
             if ( !bPushed || m_Buffer.size() >= capacity() ) {
                 if ( synchronize( ep ))
                     ep.free()    ;
@@ -167,13 +179,41 @@ namespace cds { namespace urcu {
             The method pushes \p p pointer to internal buffer.
             When the buffer becomes full \ref synchronize function is called
             to wait for the end of grace period and then to free all pointers from the buffer.
+            \ref synchronize is called also if the size of retired objects in the buffer exceeds
+            the retired memory ceiling, see \p set_retired_memory_ceiling() of RCU \p gc wrapper.
         */
         virtual void retire_ptr( retired_ptr& p )
         {
             if ( p.m_p ) {
                 epoch_retired_ptr ep( p, m_nCurEpoch.load( CDS_ATOMIC::memory_order_relaxed )) ;
                 push_buffer( ep )   ;
+                if ( m_RetiredMemory.ceiling_hit() )
+                    synchronize()   ;
+            }
+        }
+
+        /// Retires the range [\p itFirst, \p itLast) of retired pointers
+        /**
+            The method pushes the pointers of the range to internal buffer.
+            If the buffer becomes full, \ref synchronize is called once, and the rest of the range
+            is freed immediately: it was unlinked before the grace period started.
+        */
+        template <typename ForwardIterator>
+        void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
+        {
+            uint64_t nEpoch = m_nCurEpoch.load( CDS_ATOMIC::memory_order_relaxed ) ;
+            while ( itFirst != itLast ) {
+                epoch_retired_ptr ep( *itFirst, nEpoch ) ;
+                ++itFirst ;
+                if ( !push_retired( ep )) {
+                    synchronize()   ;
+                    ep.free()       ;
+                    base_class::free_range( itFirst, itLast ) ;
+                    return ;
+                }
             }
+            if ( m_RetiredMemory.ceiling_hit() || m_Buffer.size() >= capacity() )
+                synchronize()   ;
         }
 
         /// Wait to finish a grace period and then clear the buffer
@@ -190,7 +230,7 @@ namespace cds { namespace urcu {
             CDS_ATOMIC::atomic_thread_fence( CDS_ATOMIC::memory_order_acquire ) ;
             {
                 cds::lock::scoped_lock<lock_type> sl( m_Lock )  ;
-                if ( ep.m_p && m_Buffer.push( ep ))
+                if ( ep.m_p && push_retired( ep ))
                     return false    ;
                 nEpoch = m_nCurEpoch.fetch_add( 1, CDS_ATOMIC::memory_order_relaxed ) ;
 
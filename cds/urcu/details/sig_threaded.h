@@ -115,6 +115,16 @@ namespace cds { namespace urcu {
             , m_nCapacity( nBufferCapacity )
         {}
 
+        // Pushes ep into the buffer and counts its size in retired memory.
+        // The size is counted before the push, so the reclamation thread never makes the counter negative
+        bool push_retired( epoch_retired_ptr& ep )
+        {
+            m_RetiredMemory.add( ep.m_nSize ) ;
+            if ( m_Buffer.push( ep ))
+                return true ;
+            m_RetiredMemory.sub( ep.m_nSize ) ;
+            return false ;
+        }
         //@endcond
 
     public:
@@ -133,7 +143,7 @@ namespace cds { namespace urcu {
         {
             if ( !singleton_ptr::s_pRCU ) {
                 std::unique_ptr< signal_threaded, scoped_disposer > pRCU( new signal_threaded( nBufferCapacity, nSignal ) ) ;
-                pRCU->m_DisposerThread.start() ;
+                pRCU->m_DisposerThread.start( &pRCU->m_RetiredMemory ) ;
 
                 singleton_ptr::s_pRCU = pRCU.release() ;
             }
@@ -161,19 +171,49 @@ namespace cds { namespace urcu {
             When the buffer becomes full \ref synchronize function is called
             to wait for the end of grace period and then
             a message is sent to the reclamation thread.
+            If the size of retired objects in the buffer exceeds the retired memory ceiling
+            (see \p set_retired_memory_ceiling() of RCU \p gc wrapper), the caller is blocked until the reclamation thread frees them.
         */
         virtual void retire_ptr( retired_ptr& p )
         {
             if ( p.m_p ) {
-                bool bPushed = m_Buffer.push( epoch_retired_ptr( p, m_nCurEpoch.load( CDS_ATOMIC::memory_order_acquire ) )) ;
-                if ( !bPushed || m_Buffer.size() >= capacity() ) {
-                    synchronize()   ;
+                epoch_retired_ptr ep( p, m_nCurEpoch.load( CDS_ATOMIC::memory_order_acquire )) ;
+                bool bPushed = push_retired( ep ) ;
+                bool bCeiling = m_RetiredMemory.ceiling_hit() ;
+                if ( !bPushed || bCeiling || m_Buffer.size() >= capacity() ) {
+                    synchronize( bCeiling ) ;
                     if ( !bPushed )
                         p.free()    ;
                 }
             }
         }
 
+        /// Retires the range [\p itFirst, \p itLast) of retired pointers
+        /**
+            The method pushes the pointers of the range to internal buffer.
+            When the buffer becomes full, the grace period is waited by \ref synchronize call
+            and the buffer is passed to the reclamation thread; the rest of the range
+            that does not fit into the buffer is freed in the caller thread.
+        */
+        template <typename ForwardIterator>
+        void batch_retire( ForwardIterator itFirst, ForwardIterator itLast )
+        {
+            uint64_t nEpoch = m_nCurEpoch.load( CDS_ATOMIC::memory_order_acquire ) ;
+            while ( itFirst != itLast ) {
+                epoch_retired_ptr ep( *itFirst, nEpoch ) ;
+                ++itFirst ;
+                if ( !push_retired( ep )) {
+                    synchronize()   ;
+                    ep.free()       ;
+                    base_class::free_range( itFirst, itLast ) ;
+                    return ;
+                }
+            }
+            bool bCeiling = m_RetiredMemory.ceiling_hit() ;
+            if ( bCeiling || m_Buffer.size() >= capacity() )
+                synchronize( bCeiling ) ;
+        }
+
         /// Waits to finish a grace period and calls disposing thread
         void synchronize()
         {
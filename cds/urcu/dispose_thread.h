@@ -18,6 +18,7 @@
 #include <cds/details/std/condition_variable.h>
 #include <cds/details/std/memory.h>     // unique_ptr
 #include <cds/details/aligned_type.h>
+#include <cds/gc/details/retired_memory.h>
 
 namespace cds { namespace urcu {
 
@@ -72,6 +73,9 @@ namespace cds { namespace urcu {
         // disposing pass sync
         condvar_type            m_cvReady   ;
         bool volatile           m_bReady    ;
+
+        // retired memory accounting of the RCU
+        cds::gc::details::retired_memory *  m_pRetiredMemory ;
         //@endcond
 
     private: // methods called from disposing thread
@@ -111,14 +115,20 @@ namespace cds { namespace urcu {
         void dispose_buffer( buffer_type * pBuf, uint64_t nCurEpoch )
         {
             epoch_retired_ptr p ;
+            size_t nBytes = 0 ;
             while ( pBuf->pop( p ) ) {
-                if ( p.m_nEpoch <= nCurEpoch )
+                if ( p.m_nEpoch <= nCurEpoch ) {
+                    nBytes += p.m_nSize ;
                     p.free() ;
+                }
                 else {
+                    // The pointer is still counted in retired memory
                     pBuf->push( p ) ;
                     break ;
                 }
             }
+            if ( m_pRetiredMemory )
+                m_pRetiredMemory->sub( nBytes ) ;
         }
         //@endcond
 
@@ -129,6 +139,7 @@ namespace cds { namespace urcu {
             , m_nCurEpoch(0)
             , m_bQuit( false )
             , m_bReady( false )
+            , m_pRetiredMemory( null_ptr<cds::gc::details::retired_memory *>() )
         {}
         //@endcond
 
@@ -137,9 +148,11 @@ namespace cds { namespace urcu {
         /**
             This function is called by \ref general_threaded object to start
             internal reclamation thread.
+            The thread decreases \p pRetiredMemory counter by the size of each object freed.
         */
-        void start()
+        void start( cds::gc::details::retired_memory * pRetiredMemory = null_ptr<cds::gc::details::retired_memory *>() )
         {
+            m_pRetiredMemory = pRetiredMemory ;
             m_DisposeThread = new (m_threadPlaceholder) dispose_thread_starter( this ) ;
         }
 
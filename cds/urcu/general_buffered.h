@@ -52,6 +52,9 @@ namespace cds { namespace urcu {
 
         using details::gc_common::atomic_marked_ptr ;
 
+        /// Retired memory statistics, see \ref get_retired_memory_stat
+        typedef cds::gc::details::retired_memory_stat   retired_memory_stat ;
+
     public:
         /// Creates URCU \p %general_buffered singleton.
         gc( size_t nBufferCapacity = 256 )
@@ -83,7 +86,7 @@ namespace cds { namespace urcu {
         template <typename T>
         static void retire_ptr( T * p, void (* pFunc)(T *) )
         {
-            retired_ptr rp( reinterpret_cast<void *>( p ), reinterpret_cast<free_retired_ptr_func>( pFunc ) ) ;
+            retired_ptr rp( p, pFunc ) ;
             retire_ptr( rp )    ;
         }
 
@@ -106,6 +109,19 @@ namespace cds { namespace urcu {
             rcu_implementation::instance()->retire_ptr(p) ;
         }
 
+        /// Retires the range [\p itFirst, \p itLast) of retired pointers
+        /**
+            The value type of \p ForwardIterator should be convertible to \p retired_ptr.
+            The pointers are placed to internal buffer; if the buffer is full,
+            \ref synchronize is called once for the whole range.
+            The function must not be called inside RCU read-side critical section.
+        */
+        template <typename ForwardIterator>
+        static void retire_batch( ForwardIterator itFirst, ForwardIterator itLast )
+        {
+            rcu_implementation::instance()->batch_retire( itFirst, itLast ) ;
+        }
+
          /// Acquires access lock (so called RCU reader-side lock)
         /**
             For safety reasons, it is better to use \ref scoped_lock class for locking/unlocking
@@ -148,6 +164,22 @@ namespace cds { namespace urcu {
         {
             synchronize()   ;
         }
+
+        /// Sets the ceiling of retired memory in bytes, 0 - no limit
+        /**
+            When the size of retired objects in the internal buffer exceeds the ceiling,
+            the retiring thread calls \ref synchronize without waiting for the buffer to become full.
+        */
+        static void set_retired_memory_ceiling( size_t nBytes )
+        {
+            rcu_implementation::instance()->retired_memory().ceiling( nBytes ) ;
+        }
+
+        /// Returns the snapshot of retired memory statistics
+        static retired_memory_stat& get_retired_memory_stat( retired_memory_stat& st )
+        {
+            return rcu_implementation::instance()->retired_memory().get_stat( st ) ;
+        }
     };
 
 }} // namespace cds::urcu
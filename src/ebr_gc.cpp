@@ -0,0 +1,200 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+// Epoch-based reclamation (EBR) memory manager implementation
+
+#include <cds/gc/ebr/ebr.h>
+
+#define    CDS_EBR_STATISTIC( _x )    if ( m_bStatEnabled ) { _x; }
+
+namespace cds { namespace gc { namespace ebr {
+
+    GarbageCollector * GarbageCollector::m_pManager = null_ptr<GarbageCollector *>() ;
+
+    void CDS_STDCALL GarbageCollector::Construct( size_t nLimboThreshold )
+    {
+        if ( !m_pManager ) {
+            m_pManager = new GarbageCollector( nLimboThreshold ) ;
+        }
+    }
+
+    void CDS_STDCALL GarbageCollector::Destruct()
+    {
+        if ( m_pManager ) {
+            delete m_pManager   ;
+            m_pManager = null_ptr<GarbageCollector *>() ;
+        }
+    }
+
+    GarbageCollector::GarbageCollector( size_t nLimboThreshold )
+        : m_nGlobalEpoch( details::c_nLimboCount )
+        , m_pListHead( null_ptr<details::thread_record *>() )
+        , m_nLimboThreshold( nLimboThreshold ? nLimboThreshold : 1 )
+        , m_bStatEnabled( true )
+    {}
+
+    GarbageCollector::~GarbageCollector()
+    {
+        details::thread_record * pNext ;
+        for ( details::thread_record * pRec = m_pListHead.load( CDS_ATOMIC::memory_order_relaxed ); pRec; pRec = pNext ) {
+            assert( pRec->m_idOwner.load( CDS_ATOMIC::memory_order_relaxed ) == cds::OS::nullThreadId()
+                || pRec->m_idOwner.load( CDS_ATOMIC::memory_order_relaxed ) == cds::OS::getCurrentThreadId()
+                || !cds::OS::isThreadAlive( pRec->m_idOwner.load( CDS_ATOMIC::memory_order_relaxed )) ) ;
+            assert( (pRec->m_nEpoch.load( CDS_ATOMIC::memory_order_relaxed ) & 1) == 0 ) ;
+
+            pNext = pRec->m_pNext   ;
+            for ( size_t i = 0; i < details::c_nLimboCount; ++i )
+                pRec->m_Limbo[i].free_all( 0 )  ;
+            pRec->m_idOwner.store( cds::OS::nullThreadId(), CDS_ATOMIC::memory_order_relaxed )  ;
+            delete pRec ;
+        }
+        m_pListHead.store( null_ptr<details::thread_record *>(), CDS_ATOMIC::memory_order_relaxed ) ;
+    }
+
+    details::thread_record * GarbageCollector::AllocThreadRecord()
+    {
+        const cds::OS::ThreadId nullThreadId = cds::OS::nullThreadId() ;
+        const cds::OS::ThreadId curThreadId  = cds::OS::getCurrentThreadId()    ;
+
+        // First try to reuse a free record
+        details::thread_record * pRec ;
+        for ( pRec = m_pListHead.load( CDS_ATOMIC::memory_order_acquire ); pRec; pRec = pRec->m_pNext ) {
+            cds::OS::ThreadId thId = nullThreadId ;
+            if ( pRec->m_idOwner.compare_exchange_strong( thId, curThreadId, CDS_ATOMIC::memory_order_seq_cst, CDS_ATOMIC::memory_order_relaxed ))
+                return pRec ;
+        }
+
+        // No free records, allocate new one
+        pRec = new details::thread_record ;
+        pRec->m_idOwner.store( curThreadId, CDS_ATOMIC::memory_order_relaxed )  ;
+
+        details::thread_record * pHead = m_pListHead.load( CDS_ATOMIC::memory_order_acquire ) ;
+        do {
+            pRec->m_pNext = pHead   ;
+        } while ( !m_pListHead.compare_exchange_weak( pHead, pRec, CDS_ATOMIC::memory_order_release, CDS_ATOMIC::memory_order_relaxed )) ;
+
+        return pRec ;
+    }
+
+    void GarbageCollector::RetireThreadRecord( details::thread_record * pRec )
+    {
+        assert( pRec != null_ptr<details::thread_record *>() ) ;
+        assert( pRec->m_idOwner.load( CDS_ATOMIC::memory_order_relaxed ) == cds::OS::getCurrentThreadId() ) ;
+
+        pRec->m_nEpoch.store( 0, CDS_ATOMIC::memory_order_release ) ;
+
+        // Free the limbo lists that are safe to free; the rest will be freed by other threads
+        size_t nEpoch ;
+        try_advance( nEpoch )   ;
+        size_t nCount = reclaim( pRec, nEpoch ) ;
+        CDS_EBR_STATISTIC( m_Stat.m_FreedPtr += nCount ) ;
+
+        pRec->m_idOwner.store( cds::OS::nullThreadId(), CDS_ATOMIC::memory_order_release )  ;
+    }
+
+    bool GarbageCollector::try_advance( size_t& nEpoch )
+    {
+        size_t nCurEpoch = m_nGlobalEpoch.load( CDS_ATOMIC::memory_order_acquire ) ;
+        const size_t nActiveEpoch = (nCurEpoch << 1) | 1 ;
+
+        CDS_ATOMIC::atomic_thread_fence( CDS_ATOMIC::memory_order_seq_cst ) ;
+        for ( details::thread_record * pRec = m_pListHead.load( CDS_ATOMIC::memory_order_acquire ); pRec; pRec = pRec->m_pNext ) {
+            size_t nLocal = pRec->m_nEpoch.load( CDS_ATOMIC::memory_order_acquire ) ;
+            if ( (nLocal & 1) && nLocal != nActiveEpoch ) {
+                // The thread is in the critical section of previous epoch
+                CDS_EBR_STATISTIC( ++m_Stat.m_EpochBlocked ) ;
+                nEpoch = nCurEpoch  ;
+                return false    ;
+            }
+        }
+
+        if ( m_nGlobalEpoch.compare_exchange_strong( nCurEpoch, nCurEpoch + 1, CDS_ATOMIC::memory_order_acq_rel, CDS_ATOMIC::memory_order_acquire )) {
+            CDS_EBR_STATISTIC( ++m_Stat.m_EpochAdvance ) ;
+            nEpoch = nCurEpoch + 1  ;
+        }
+        else {
+            // Another thread has advanced the epoch
+            nEpoch = nCurEpoch  ;
+        }
+        return true ;
+    }
+
+    size_t GarbageCollector::reclaim( details::thread_record * pRec, size_t nEpoch )
+    {
+        // The pointers retired in epoch e are safe to free when the global epoch is at least e + 2
+        size_t nCount = 0 ;
+        for ( size_t i = 0; i < details::c_nLimboCount; ++i ) {
+            details::limbo_list& l = pRec->m_Limbo[i] ;
+            if ( !l.empty() && l.epoch() + 2 <= nEpoch )
+                nCount += l.free_all( l.epoch() )   ;
+        }
+        return nCount   ;
+    }
+
+    void GarbageCollector::help_scan( details::thread_record * pThis, size_t nEpoch )
+    {
+        const cds::OS::ThreadId nullThreadId = cds::OS::nullThreadId() ;
+        const cds::OS::ThreadId curThreadId  = cds::OS::getCurrentThreadId()    ;
+
+        for ( details::thread_record * pRec = m_pListHead.load( CDS_ATOMIC::memory_order_acquire ); pRec; pRec = pRec->m_pNext ) {
+            if ( pRec == pThis || pRec->m_idOwner.load( CDS_ATOMIC::memory_order_relaxed ) != nullThreadId )
+                continue    ;
+
+            cds::OS::ThreadId thId = nullThreadId ;
+            if ( !pRec->m_idOwner.compare_exchange_strong( thId, curThreadId, CDS_ATOMIC::memory_order_acquire, CDS_ATOMIC::memory_order_relaxed ))
+                continue    ;
+
+            size_t nCount = reclaim( pRec, nEpoch ) ;
+            CDS_EBR_STATISTIC( m_Stat.m_HelpFreedPtr += nCount ) ;
+            CDS_EBR_STATISTIC( m_Stat.m_FreedPtr += nCount ) ;
+
+            pRec->m_idOwner.store( nullThreadId, CDS_ATOMIC::memory_order_release ) ;
+        }
+    }
+
+    void GarbageCollector::Scan( details::thread_record * pRec )
+    {
+        CDS_EBR_STATISTIC( ++m_Stat.m_ScanCall )   ;
+
+        size_t nEpoch ;
+        try_advance( nEpoch )   ;
+
+        size_t nCount = reclaim( pRec, nEpoch ) ;
+        CDS_EBR_STATISTIC( m_Stat.m_FreedPtr += nCount ) ;
+
+        help_scan( pRec, nEpoch )  ;
+    }
+
+    GarbageCollector::InternalState& GarbageCollector::getInternalState( GarbageCollector::InternalState& stat ) const
+    {
+        stat.nGlobalEpoch       = m_nGlobalEpoch.load( CDS_ATOMIC::memory_order_relaxed ) ;
+        stat.nLimboThreshold    = m_nLimboThreshold ;
+        stat.nThreadRecCount    =
+            stat.nThreadRecUsed =
+            stat.nRetiredPtrCount = 0   ;
+
+        for ( details::thread_record * pRec = m_pListHead.load( CDS_ATOMIC::memory_order_acquire ); pRec; pRec = pRec->m_pNext ) {
+            ++stat.nThreadRecCount  ;
+            if ( pRec->m_idOwner.load( CDS_ATOMIC::memory_order_relaxed ) != cds::OS::nullThreadId() )
+                ++stat.nThreadRecUsed   ;
+            stat.nRetiredPtrCount += pRec->retired_count() ;
+        }
+
+        stat.evcScanCall        = m_Stat.m_ScanCall     ;
+        stat.evcEpochAdvance    = m_Stat.m_EpochAdvance ;
+        stat.evcEpochBlocked    = m_Stat.m_EpochBlocked ;
+        stat.evcFreedPtr        = m_Stat.m_FreedPtr     ;
+        stat.evcHelpFreedPtr    = m_Stat.m_HelpFreedPtr ;
+
+        return stat ;
+    }
+
+}}} // namespace cds::gc::ebr
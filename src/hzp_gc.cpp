@@ -19,6 +19,8 @@
 */
 
 #include <cds/gc/hzp/hzp.h>
+#include <cds/gc/hzp/details/hp_dispose_thread.h>
+#include <cds/int_algo.h>
 
 #include <algorithm>    // std::sort
 #include "hzp_const.h"
@@ -33,16 +35,21 @@ namespace cds { namespace gc {
 
         GarbageCollector *    GarbageCollector::m_pHZPManager = NULL;
 
-        void CDS_STDCALL GarbageCollector::Construct( size_t nHazardPtrCount, size_t nMaxThreadCount, size_t nMaxRetiredPtrCount, scan_type nScanType )
+        void CDS_STDCALL GarbageCollector::Construct( size_t nHazardPtrCount, size_t nMaxThreadCount, size_t nMaxRetiredPtrCount, scan_type nScanType, bool bDynamicHPRec, size_t nDisposeQueueCapacity )
         {
             if ( !m_pHZPManager ) {
-                m_pHZPManager = new GarbageCollector( nHazardPtrCount, nMaxThreadCount, nMaxRetiredPtrCount, nScanType )    ;
+                m_pHZPManager = new GarbageCollector( nHazardPtrCount, nMaxThreadCount, nMaxRetiredPtrCount, nScanType, bDynamicHPRec, nDisposeQueueCapacity )    ;
+                if ( m_pHZPManager->m_pDisposeThread )
+                    m_pHZPManager->start_dispose_thread() ;
             }
         }
 
         void CDS_STDCALL GarbageCollector::Destruct( bool bDetachAll )
         {
             if ( m_pHZPManager ) {
+                if ( m_pHZPManager->m_pDisposeThread )
+                    m_pHZPManager->stop_dispose_thread() ;
+
                 if ( bDetachAll )
                     m_pHZPManager->detachAllThread()    ;
 
@@ -55,7 +62,9 @@ namespace cds { namespace gc {
             size_t nHazardPtrCount,
             size_t nMaxThreadCount,
             size_t nMaxRetiredPtrCount,
-            scan_type nScanType
+            scan_type nScanType,
+            bool bDynamicHPRec,
+            size_t nDisposeQueueCapacity
         )
             : m_pListHead(NULL)
             ,m_bStatEnabled( true )
@@ -63,10 +72,19 @@ namespace cds { namespace gc {
             ,m_nMaxThreadCount( nMaxThreadCount == 0 ? c_nMaxThreadCount : nMaxThreadCount )
             ,m_nMaxRetiredPtrCount( nMaxRetiredPtrCount > c_nMaxRetireNodeCount ? nMaxRetiredPtrCount : c_nMaxRetireNodeCount )
             ,m_nScanType( nScanType )
-        {}
+            ,m_bDynamicHPRec( bDynamicHPRec )
+            ,m_nListEpoch( 1 )
+            ,m_pRemovedList( null_ptr<hplist_node *>() )
+            ,m_pDisposeThread( null_ptr<details::dispose_thread *>() )
+        {
+            if ( nDisposeQueueCapacity )
+                m_pDisposeThread = new details::dispose_thread( *this, nDisposeQueueCapacity ) ;
+        }
 
         GarbageCollector::~GarbageCollector()
         {
+            delete m_pDisposeThread ;
+
             CDS_DEBUG_DO( const cds::OS::ThreadId nullThreadId = cds::OS::nullThreadId() ;)
             CDS_DEBUG_DO( const cds::OS::ThreadId mainThreadId = cds::OS::getCurrentThreadId() ;)
 
@@ -87,10 +105,16 @@ namespace cds { namespace gc {
                     ++itRetired    ;
                 }
                 vect.clear()    ;
-                pNext = hprec->m_pNextNode  ;
+                pNext = hprec->m_pNextNode.load( CDS_ATOMIC::memory_order_relaxed )  ;
                 hprec->m_bFree.store( true, CDS_ATOMIC::memory_order_relaxed )  ;
                 DeleteHPRec( hprec )    ;
             }
+
+            for ( hplist_node * hprec = m_pRemovedList; hprec; hprec = pNext ) {
+                pNext = hprec->m_pNextRemoved   ;
+                DeleteHPRec( hprec )    ;
+            }
+            m_pRemovedList = null_ptr<hplist_node *>()  ;
         }
 
         inline GarbageCollector::hplist_node * GarbageCollector::NewHPRec()
@@ -120,13 +144,24 @@ namespace cds { namespace gc {
             const cds::OS::ThreadId nullThreadId = cds::OS::nullThreadId() ;
             const cds::OS::ThreadId curThreadId  = cds::OS::getCurrentThreadId()    ;
 
+            if ( m_bDynamicHPRec && m_pRemovedList )
+                delete_removed_hprec()  ;
+
             // First try to reuse a retired (non-active) HP record
-            for ( hprec = m_pListHead.load( CDS_ATOMIC::memory_order_acquire ); hprec; hprec = hprec->m_pNextNode ) {
-                cds::OS::ThreadId thId = nullThreadId ;
-                if ( !hprec->m_idOwner.compare_exchange_strong( thId, curThreadId, CDS_ATOMIC::memory_order_seq_cst, CDS_ATOMIC::memory_order_relaxed ) )
-                    continue    ;
-                hprec->m_bFree.store( false, CDS_ATOMIC::memory_order_release ) ;
-                return hprec    ;
+            {
+                list_traverse_guard tg( *this, null_ptr<details::HPRec *>() ) ;
+                for ( hprec = m_pListHead.load( CDS_ATOMIC::memory_order_acquire ); hprec; hprec = hprec->m_pNextNode.load( CDS_ATOMIC::memory_order_acquire )) {
+                    cds::OS::ThreadId thId = nullThreadId ;
+                    if ( !hprec->m_idOwner.compare_exchange_strong( thId, curThreadId, CDS_ATOMIC::memory_order_seq_cst, CDS_ATOMIC::memory_order_relaxed ) )
+                        continue    ;
+                    if ( hprec->m_bRemoved.load( CDS_ATOMIC::memory_order_acquire )) {
+                        // The record has been removed from the list concurrently
+                        hprec->m_idOwner.store( nullThreadId, CDS_ATOMIC::memory_order_release ) ;
+                        continue    ;
+                    }
+                    hprec->m_bFree.store( false, CDS_ATOMIC::memory_order_release ) ;
+                    return hprec    ;
+                }
             }
 
             // No HP records available for reuse
@@ -139,7 +174,7 @@ namespace cds { namespace gc {
 
             hplist_node * pOldHead = m_pListHead.load( CDS_ATOMIC::memory_order_acquire ) ;
             do {
-                hprec->m_pNextNode = pOldHead ;
+                hprec->m_pNextNode.store( pOldHead, CDS_ATOMIC::memory_order_relaxed ) ;
             } while ( !m_pListHead.compare_exchange_weak( pOldHead, hprec, CDS_ATOMIC::memory_order_release, CDS_ATOMIC::memory_order_relaxed )) ;
 
             return hprec ;
@@ -152,15 +187,185 @@ namespace cds { namespace gc {
 
             pRec->clear()   ;
             hplist_node * pNode = static_cast<hplist_node *>( pRec )  ;
+
+            if ( m_bDynamicHPRec ) {
+                // Try to free retired pointers of the record.
+                // If all of them are freed the record is removed from HP list
+                Scan( pRec )    ;
+                if ( pRec->m_arrRetired.size() == 0 ) {
+                    remove_hprec( pNode )   ;
+                    delete_removed_hprec()  ;
+                    return  ;
+                }
+            }
+
             pNode->m_idOwner.store( cds::OS::nullThreadId(), CDS_ATOMIC::memory_order_release ) ;
         }
 
+        void GarbageCollector::remove_hprec( hplist_node * pNode )
+        {
+            // The caller must own pNode and pNode->m_arrRetired must be empty.
+            // Removers are serialized by m_RemoveLock, the new records are pushed only to the head of the list,
+            // so the predecessor of pNode cannot be changed concurrently except the list head.
+            assert( m_bDynamicHPRec )   ;
+            assert( pNode->m_arrRetired.size() == 0 )   ;
+
+            cds::lock::scoped_lock<cds::lock::Spin> al( m_RemoveLock ) ;
+
+            pNode->m_bRemoved.store( true, CDS_ATOMIC::memory_order_seq_cst ) ;
+            pNode->m_bFree.store( true, CDS_ATOMIC::memory_order_release ) ;
+
+            hplist_node * pNext = pNode->m_pNextNode.load( CDS_ATOMIC::memory_order_relaxed ) ;
+            hplist_node * pHead = pNode ;
+            if ( !m_pListHead.compare_exchange_strong( pHead, pNext, CDS_ATOMIC::memory_order_seq_cst, CDS_ATOMIC::memory_order_relaxed )) {
+                // pNode is not the head of the list, search the predecessor
+                hplist_node * pPrev = pHead ;
+                while ( pPrev->m_pNextNode.load( CDS_ATOMIC::memory_order_relaxed ) != pNode ) {
+                    pPrev = pPrev->m_pNextNode.load( CDS_ATOMIC::memory_order_relaxed ) ;
+                    assert( pPrev != null_ptr<hplist_node *>() ) ;
+                }
+                pPrev->m_pNextNode.store( pNext, CDS_ATOMIC::memory_order_seq_cst ) ;
+            }
+
+            // pNode->m_pNextNode is kept unchanged since other threads may traverse the list through pNode.
+            // The traversals started after advancing the list epoch cannot reach pNode
+            pNode->m_nRemoveEpoch = m_nListEpoch.load( CDS_ATOMIC::memory_order_relaxed ) ;
+            m_nListEpoch.store( pNode->m_nRemoveEpoch + 1, CDS_ATOMIC::memory_order_seq_cst ) ;
+
+            pNode->m_nTraverseEpoch.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+            pNode->m_idOwner.store( cds::OS::nullThreadId(), CDS_ATOMIC::memory_order_release ) ;
+            pNode->m_pNextRemoved = m_pRemovedList ;
+            m_pRemovedList = pNode  ;
+
+            CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_RemoveHPRec )   ;
+        }
+
+        void GarbageCollector::delete_removed_hprec()
+        {
+            hplist_node * pList = null_ptr<hplist_node *>() ;
+            {
+                cds::lock::scoped_lock<cds::lock::Spin> al( m_RemoveLock ) ;
+                if ( !m_pRemovedList )
+                    return  ;
+
+                CDS_ATOMIC::atomic_thread_fence( CDS_ATOMIC::memory_order_seq_cst ) ;
+
+                // Find the oldest epoch of the traversals in progress.
+                // The HP list cannot contain removed records here since removers are serialized by m_RemoveLock
+                size_t nMinEpoch = m_nListEpoch.load( CDS_ATOMIC::memory_order_relaxed ) ;
+                for ( hplist_node * hprec = m_pListHead.load( CDS_ATOMIC::memory_order_acquire ); hprec; hprec = hprec->m_pNextNode.load( CDS_ATOMIC::memory_order_acquire )) {
+                    size_t nEpoch = hprec->m_nTraverseEpoch.load( CDS_ATOMIC::memory_order_relaxed ) ;
+                    if ( nEpoch && nEpoch < nMinEpoch )
+                        nMinEpoch = nEpoch ;
+                }
+
+                // The record removed before the oldest traversal has started is unreachable
+                hplist_node ** ppLink = &m_pRemovedList ;
+                while ( *ppLink ) {
+                    hplist_node * hprec = *ppLink ;
+                    if ( hprec->m_nRemoveEpoch < nMinEpoch ) {
+                        *ppLink = hprec->m_pNextRemoved ;
+                        hprec->m_pNextRemoved = pList   ;
+                        pList = hprec   ;
+                    }
+                    else
+                        ppLink = &hprec->m_pNextRemoved ;
+                }
+            }
+
+            hplist_node * pNext ;
+            for ( ; pList; pList = pNext ) {
+                pNext = pList->m_pNextRemoved   ;
+                DeleteHPRec( pList )    ;
+            }
+        }
+
+        void GarbageCollector::grow_retired( details::HPRec * pRec )
+        {
+            CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_GrowRetired )   ;
+            pRec->m_arrRetired.grow( pRec->m_arrRetired.capacity() * 2 ) ;
+        }
+
+        size_t GarbageCollector::ReserveRetired( details::HPRec * pRec, size_t nCount )
+        {
+            details::retired_vector& arr = pRec->m_arrRetired ;
+            size_t nCapacity = arr.capacity() ;
+            if ( arr.size() + nCount > nCapacity ) {
+                CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_RetireBatch )   ;
+                arr.grow( arr.size() + nCount ) ;
+            }
+            return nCapacity ;
+        }
+
+        void GarbageCollector::ReleaseRetired( details::HPRec * pRec, size_t nCapacity )
+        {
+            details::retired_vector& arr = pRec->m_arrRetired ;
+            if ( arr.capacity() > nCapacity && arr.size() < nCapacity )
+                arr.shrink( nCapacity ) ;
+        }
+
+        void GarbageCollector::start_dispose_thread()
+        {
+            assert( m_pDisposeThread != null_ptr<details::dispose_thread *>() ) ;
+            m_pDisposeThread->start() ;
+        }
+
+        void GarbageCollector::stop_dispose_thread()
+        {
+            // The thread frees all retired pointers handed off before stopping.
+            // After that the queue rejects any hand-off, so each thread scans its retired array itself
+            assert( m_pDisposeThread != null_ptr<details::dispose_thread *>() ) ;
+            m_pDisposeThread->stop() ;
+        }
+
+        bool GarbageCollector::DeferScan( details::HPRec * pRec )
+        {
+            if ( !m_pDisposeThread )
+                return false ;
+
+            if ( m_pDisposeThread->push( pRec->m_arrRetired )) {
+                CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_DeferScan )   ;
+                return true ;
+            }
+            CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_DeferScanRejected )   ;
+            return false ;
+        }
+
+        void GarbageCollector::ForceScan( details::HPRec * pRec )
+        {
+            m_RetiredMemory.hit() ;
+            Scan( pRec )     ;
+            HelpScan( pRec ) ;
+        }
+
+        size_t GarbageCollector::retired_bytes( details::HPRec * pRec ) const
+        {
+            // The sum is approximate: the records are changed by their owners concurrently
+            size_t nBytes = m_pDisposeThread ? m_pDisposeThread->pending_bytes() : 0 ;
+
+            list_traverse_guard tg( const_cast<GarbageCollector&>( *this ), pRec ) ;
+            for ( hplist_node * hprec = m_pListHead.load(CDS_ATOMIC::memory_order_acquire); hprec; hprec = hprec->m_pNextNode.load( CDS_ATOMIC::memory_order_acquire ))
+                nBytes += hprec->m_arrRetired.bytes() ;
+            return nBytes ;
+        }
+
+        void GarbageCollector::update_retired_memory( details::HPRec * pRec )
+        {
+            m_RetiredMemory.set( retired_bytes( pRec ) ) ;
+        }
+
+        cds::gc::details::retired_memory_stat& GarbageCollector::getRetiredMemoryStat( cds::gc::details::retired_memory_stat& st ) const
+        {
+            const_cast<GarbageCollector *>( this )->update_retired_memory( null_ptr<details::HPRec *>() ) ;
+            return m_RetiredMemory.get_stat( st ) ;
+        }
+
         void GarbageCollector::detachAllThread()
         {
             hplist_node * pNext = NULL    ;
             const cds::OS::ThreadId nullThreadId = cds::OS::nullThreadId()  ;
             for ( hplist_node * hprec = m_pListHead.load(CDS_ATOMIC::memory_order_acquire); hprec; hprec = pNext ) {
-                pNext = hprec->m_pNextNode  ;
+                pNext = hprec->m_pNextNode.load( CDS_ATOMIC::memory_order_relaxed )  ;
                 if ( hprec->m_idOwner.load(CDS_ATOMIC::memory_order_relaxed) != nullThreadId ) {
                     RetireHPRec( hprec )    ;
                 }
@@ -177,19 +382,25 @@ namespace cds { namespace gc {
 
             // Stage 1: Scan HP list and insert non-null values in plist
 
-            hplist_node * pNode = m_pListHead.load(CDS_ATOMIC::memory_order_acquire);
+            {
+                list_traverse_guard tg( *this, pRec ) ;
+                hplist_node * pNode = m_pListHead.load(CDS_ATOMIC::memory_order_acquire);
 
-            while ( pNode ) {
-                for ( size_t i = 0; i < m_nHazardPointerCount; ++i ) {
-                    void * hptr = pNode->m_hzp[i]   ;
-                    if ( hptr )
-                        plist.push_back( hptr )     ;
+                while ( pNode ) {
+                    for ( hp_block * pBlock = pNode->m_hzp.first_block(); pBlock; pBlock = pBlock->next() ) {
+                        for ( size_t i = 0; i < pBlock->capacity(); ++i ) {
+                            void * hptr = (*pBlock)[i]   ;
+                            if ( hptr )
+                                plist.push_back( hptr )     ;
+                        }
+                    }
+                    pNode = pNode->m_pNextNode.load( CDS_ATOMIC::memory_order_acquire )  ;
                 }
-                pNode = pNode->m_pNextNode  ;
             }
 
             // Sort plist to simplify search in
             std::sort( plist.begin(), plist.end() ) ;
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_ScanHPCount += plist.size() )    ;
 
             // Stage 2: Search plist
             details::retired_vector& arrRetired = pRec->m_arrRetired    ;
@@ -202,6 +413,7 @@ namespace cds { namespace gc {
 
             std::vector< void * >::iterator itBegin = plist.begin()    ;
             std::vector< void * >::iterator itEnd = plist.end()    ;
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_ScanProbeCount += (itRetiredEnd - itRetired) * (cds::beans::log2floor( plist.size() ) + 1) )    ;
             while ( itRetired != itRetiredEnd ) {
                 if ( std::binary_search( itBegin, itEnd, itRetired->m_p) ) {
                     CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_DeferredNode )    ;
@@ -238,23 +450,33 @@ namespace cds { namespace gc {
 
             // Search guarded pointers in retired array
 
-            hplist_node * pNode = m_pListHead.load(CDS_ATOMIC::memory_order_acquire) ;
-
-            while ( pNode ) {
-                for ( size_t i = 0; i < m_nHazardPointerCount; ++i ) {
-                    void * hptr = pNode->m_hzp[i]  ;
-                    if ( hptr ) {
-                        details::retired_ptr    dummyRetired ;
-                        dummyRetired.m_p = hptr ;
-                        details::retired_vector::iterator it = std::lower_bound( itRetired, itRetiredEnd, dummyRetired, cds::gc::details::retired_ptr::less ) ;
-                        if ( it != itRetiredEnd && it->m_p == hptr )  {
-                            // Mark retired pointer as guarded
-                            it->m_p = reinterpret_cast<void *>(reinterpret_cast<ptr_atomic_t>(it->m_p ) | 1) ;
+            size_t const nProbePerHP = cds::beans::log2floor( itRetiredEnd - itRetired ) + 1 ;
+            size_t nHPCount = 0 ;
+            {
+                list_traverse_guard tg( *this, pRec ) ;
+                hplist_node * pNode = m_pListHead.load(CDS_ATOMIC::memory_order_acquire) ;
+
+                while ( pNode ) {
+                    for ( hp_block * pBlock = pNode->m_hzp.first_block(); pBlock; pBlock = pBlock->next() ) {
+                        for ( size_t i = 0; i < pBlock->capacity(); ++i ) {
+                            void * hptr = (*pBlock)[i]  ;
+                            if ( hptr ) {
+                                ++nHPCount ;
+                                details::retired_ptr    dummyRetired ;
+                                dummyRetired.m_p = hptr ;
+                                details::retired_vector::iterator it = std::lower_bound( itRetired, itRetiredEnd, dummyRetired, cds::gc::details::retired_ptr::less ) ;
+                                if ( it != itRetiredEnd && it->m_p == hptr )  {
+                                    // Mark retired pointer as guarded
+                                    it->m_p = reinterpret_cast<void *>(reinterpret_cast<ptr_atomic_t>(it->m_p ) | 1) ;
+                                }
+                            }
                         }
                     }
+                    pNode = pNode->m_pNextNode.load( CDS_ATOMIC::memory_order_acquire )  ;
                 }
-                pNode = pNode->m_pNextNode  ;
             }
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_ScanHPCount += nHPCount )    ;
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_ScanProbeCount += nHPCount * nProbePerHP )    ;
 
             // Move all marked pointers to head of array
             details::retired_vector::iterator itInsert = itRetired ;
@@ -273,6 +495,70 @@ namespace cds { namespace gc {
             pRec->m_arrRetired.size( itInsert - itRetired ) ;
         }
 
+        void GarbageCollector::hashed_scan( details::HPRec * pRec )
+        {
+            CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_ScanCallCount )    ;
+
+            // Stage 1: Scan HP list and insert non-null values in the thread's private HP set.
+            // The set of HP record is allocated by the first hashed scan only,
+            // the subsequent scans do not allocate any memory
+
+            details::hazard_ptr_set<>& setHP = pRec->m_setHP ;
+            setHP.allocate() ;
+            assert( setHP.size() == 0 ) ;
+            size_t nProbe = 0 ;
+
+            bool bOverflow = false ;
+            {
+                list_traverse_guard tg( *this, pRec ) ;
+                hplist_node * pNode = m_pListHead.load(CDS_ATOMIC::memory_order_acquire);
+
+                while ( pNode && !bOverflow ) {
+                    for ( hp_block * pBlock = pNode->m_hzp.first_block(); pBlock && !bOverflow; pBlock = pBlock->next() ) {
+                        for ( size_t i = 0; i < pBlock->capacity(); ++i ) {
+                            void * hptr = (*pBlock)[i]   ;
+                            if ( hptr && !setHP.insert( hptr, nProbe )) {
+                                bOverflow = true ;
+                                break ;
+                            }
+                        }
+                    }
+                    pNode = pNode->m_pNextNode.load( CDS_ATOMIC::memory_order_acquire )  ;
+                }
+            }
+
+            if ( bOverflow ) {
+                // The set is overflowed (too many threads). Use classic scan
+                setHP.clear() ;
+                CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_HashedScanFallback )    ;
+                classic_scan( pRec )    ;
+                return ;
+            }
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_ScanHPCount += setHP.size() )    ;
+
+            // Stage 2: Search HP set
+            details::retired_vector& arrRetired = pRec->m_arrRetired    ;
+
+            details::retired_vector::iterator itRetired     = arrRetired.begin()    ;
+            details::retired_vector::iterator itRetiredEnd  = arrRetired.end()    ;
+            // arrRetired is not a std::vector!
+            // clear is just set up item counter to 0, the items is not destroying
+            arrRetired.clear()    ;
+
+            while ( itRetired != itRetiredEnd ) {
+                if ( setHP.contains( itRetired->m_p, nProbe ) ) {
+                    CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_DeferredNode )    ;
+                    arrRetired.push( *itRetired )    ;
+                }
+                else
+                    DeletePtr( *itRetired )            ;
+                ++itRetired    ;
+            }
+
+            setHP.clear() ;
+            CDS_HAZARDPTR_STATISTIC( m_Stat.m_ScanProbeCount += nProbe )    ;
+        }
+
         void GarbageCollector::HelpScan( details::HPRec * pThis )
         {
             CDS_HAZARDPTR_STATISTIC( ++m_Stat.m_HelpScanCallCount )    ;
@@ -281,7 +567,8 @@ namespace cds { namespace gc {
 
             const cds::OS::ThreadId nullThreadId = cds::OS::nullThreadId()        ;
             const cds::OS::ThreadId curThreadId = cds::OS::getCurrentThreadId()    ;
-            for ( hplist_node * hprec = m_pListHead.load(CDS_ATOMIC::memory_order_acquire); hprec; hprec = hprec->m_pNextNode ) {
+            list_traverse_guard tg( *this, pThis ) ;
+            for ( hplist_node * hprec = m_pListHead.load(CDS_ATOMIC::memory_order_acquire); hprec; hprec = hprec->m_pNextNode.load( CDS_ATOMIC::memory_order_acquire )) {
 
                 // If m_bFree == true then hprec->m_arrRetired is empty - we don't need to see it
                 if ( hprec->m_bFree.load(CDS_ATOMIC::memory_order_acquire) )
@@ -294,12 +581,20 @@ namespace cds { namespace gc {
                     if ( curOwner == nullThreadId || !cds::OS::isThreadAlive( curOwner )) {
                         if ( !hprec->m_idOwner.compare_exchange_strong( curOwner, curThreadId, CDS_ATOMIC::memory_order_release, CDS_ATOMIC::memory_order_relaxed ))
                             continue    ;
+                        // The dead owner might not finish its list traversal
+                        hprec->m_nTraverseEpoch.store( 0, CDS_ATOMIC::memory_order_release ) ;
                     }
                     else {
                         curOwner = nullThreadId ;
                         if ( !hprec->m_idOwner.compare_exchange_strong( curOwner, curThreadId, CDS_ATOMIC::memory_order_release, CDS_ATOMIC::memory_order_relaxed ))
                             continue    ;
                     }
+
+                    if ( hprec->m_bRemoved.load( CDS_ATOMIC::memory_order_acquire )) {
+                        // The record has been removed from the list concurrently
+                        hprec->m_idOwner.store( nullThreadId, CDS_ATOMIC::memory_order_release ) ;
+                        continue    ;
+                    }
                 }
 
                 // We own the thread successfully. Now, we can see whether HPRec has retired pointers.
@@ -319,6 +614,13 @@ namespace cds { namespace gc {
                 }
                 src.clear() ;
 
+                if ( m_bDynamicHPRec && hprec != pThis ) {
+                    // The record is empty and not owned, remove it from HP list
+                    hprec->clear()  ;
+                    remove_hprec( hprec )   ;
+                    continue    ;
+                }
+
                 hprec->m_bFree.store(true, CDS_ATOMIC::memory_order_release) ;
                 hprec->m_idOwner.store( nullThreadId, CDS_ATOMIC::memory_order_release )    ;
             }
@@ -335,11 +637,29 @@ namespace cds { namespace gc {
             stat.nHPRecAllocated         =
                 stat.nHPRecUsed              =
                 stat.nTotalRetiredPtrCount   =
-                stat.nRetiredPtrInFreeHPRecs = 0    ;
-
-            for ( hplist_node * hprec = m_pListHead.load(CDS_ATOMIC::memory_order_acquire); hprec; hprec = hprec->m_pNextNode ) {
+                stat.nRetiredPtrInFreeHPRecs =
+                stat.nTotalHPCount           =
+                stat.nRemovedHPRecs          =
+                stat.nHashedSetBytes         = 0    ;
+
+            cds::gc::details::retired_memory_stat ms ;
+            getRetiredMemoryStat( ms ) ;
+            stat.nRetiredBytes           = ms.nRetiredBytes     ;
+            stat.nPeakRetiredBytes       = ms.nPeakRetiredBytes ;
+            stat.nRetiredBytesCeiling    = ms.nCeiling          ;
+            stat.evcRetiredCeilingHit    = ms.nCeilingHit       ;
+
+            // The guard without HP record locks m_RemoveLock in dynamic mode
+            list_traverse_guard tg( const_cast<GarbageCollector&>( *this ), null_ptr<details::HPRec *>() ) ;
+            for ( hplist_node * hprec = m_pListHead.load(CDS_ATOMIC::memory_order_acquire); hprec; hprec = hprec->m_pNextNode.load( CDS_ATOMIC::memory_order_acquire )) {
                 ++stat.nHPRecAllocated  ;
                 stat.nTotalRetiredPtrCount += hprec->m_arrRetired.size()    ;
+                for ( hp_block * pBlock = hprec->m_hzp.first_block(); pBlock; pBlock = pBlock->next() )
+                    stat.nTotalHPCount += pBlock->capacity()    ;
+
+                // The hazard pointer set is allocated by the first hashed scan of the record only
+                if ( hprec->m_setHP.allocated() )
+                    stat.nHashedSetBytes += sizeof(void *) * hprec->m_setHP.capacity() ;
 
                 if ( hprec->m_bFree.load(CDS_ATOMIC::memory_order_relaxed) ) {
                     // Free HP record
@@ -351,11 +671,19 @@ namespace cds { namespace gc {
                 }
             }
 
+            for ( hplist_node * hprec = m_pRemovedList; hprec; hprec = hprec->m_pNextRemoved )
+                ++stat.nRemovedHPRecs   ;
+
             // Events
             stat.evcAllocHPRec   = m_Stat.m_AllocHPRec  ;
             stat.evcRetireHPRec  = m_Stat.m_RetireHPRec ;
             stat.evcAllocNewHPRec= m_Stat.m_AllocNewHPRec   ;
             stat.evcDeleteHPRec  = m_Stat.m_DeleteHPRec ;
+            stat.evcRemoveHPRec  = m_Stat.m_RemoveHPRec ;
+            stat.evcGrowRetired  = m_Stat.m_GrowRetired ;
+            stat.evcRetireBatch  = m_Stat.m_RetireBatch ;
+            stat.evcDeferScan    = m_Stat.m_DeferScan   ;
+            stat.evcDeferScanRejected = m_Stat.m_DeferScanRejected ;
 
             stat.evcScanCall     = m_Stat.m_ScanCallCount   ;
             stat.evcHelpScanCall = m_Stat.m_HelpScanCallCount   ;
@@ -364,6 +692,10 @@ namespace cds { namespace gc {
             stat.evcDeletedNode  = m_Stat.m_DeletedNode     ;
             stat.evcDeferredNode = m_Stat.m_DeferredNode    ;
 
+            stat.evcScanHPCount  = m_Stat.m_ScanHPCount     ;
+            stat.evcScanProbeCount = m_Stat.m_ScanProbeCount ;
+            stat.evcHashedScanFallback = m_Stat.m_HashedScanFallback ;
+
             return stat ;
         }
 
@@ -14,18 +14,26 @@
 #include <cds/gc/ptb/ptb.h>
 #include <cds/int_algo.h>
 
-#include <cds/details/hash_functor_selector.h>
 #include <algorithm>   // std::fill
 
 namespace cds { namespace gc { namespace ptb {
 
     namespace details {
 
+        /// Hash table of retired pointers used by liberate cycle
+        /**
+            The table is owned by a partition of retired buffer and reused from one liberate cycle to another.
+            \ref free_all leaves the table empty, so the next cycle just fills it again.
+            The table grows when the partition holds more retired pointers than the table has buckets.
+        */
         class liberate_set {
             typedef retired_ptr_node *  item_type ;
             typedef cds::details::Allocator<item_type, CDS_DEFAULT_ALLOCATOR>   allocator_type ;
 
-            size_t const m_nBucketCount ;
+            static const size_t c_nMinBucketCount = 16 ;
+
+            size_t       m_nBucketCount ;
+            size_t       m_nHashShift   ;   ///< shift to get bucket index from the high bits of Fibonacci hash
             item_type *  m_Buckets      ;
 
             item_type&  bucket( retired_ptr_node& node )
@@ -34,18 +42,23 @@ namespace cds { namespace gc { namespace ptb {
             }
             item_type&  bucket( guard_data::guarded_ptr p )
             {
-                return m_Buckets[ cds::details::hash<guard_data::guarded_ptr>()( p ) & (m_nBucketCount - 1)  ];
+                // The low bits of the pointers of one partition are correlated, so we use the high bits of the product
+                uptr_atomic_t h = reinterpret_cast<uptr_atomic_t>( p ) * static_cast<uptr_atomic_t>( 0x9E3779B97F4A7C15ULL ) ;
+                return m_Buckets[ static_cast<size_t>( h >> m_nHashShift ) ];
+            }
+
+            void alloc_buckets( size_t nBucketCount )
+            {
+                m_nBucketCount = nBucketCount < c_nMinBucketCount ? c_nMinBucketCount : beans::ceil2( nBucketCount ) ;
+                m_nHashShift = sizeof(uptr_atomic_t) * 8 - beans::log2( m_nBucketCount ) ;
+                m_Buckets = allocator_type().NewArray( m_nBucketCount )   ;
+                std::fill( m_Buckets, m_Buckets + m_nBucketCount, null_ptr<item_type>()) ;
             }
 
         public:
             liberate_set( size_t nBucketCount )
-                : m_nBucketCount( nBucketCount )
             {
-                assert( nBucketCount > 0 )  ;
-                assert( (nBucketCount & (nBucketCount - 1)) == 0 )    ;
-
-                m_Buckets = allocator_type().NewArray( nBucketCount )   ;
-                std::fill( m_Buckets, m_Buckets + nBucketCount, null_ptr<item_type>()) ;
+                alloc_buckets( nBucketCount ) ;
             }
 
             ~liberate_set()
@@ -53,6 +66,20 @@ namespace cds { namespace gc { namespace ptb {
                 allocator_type().Delete( m_Buckets, m_nBucketCount )    ;
             }
 
+            /// Prepares the empty set for \p nCount items
+            /**
+                The bucket table is reallocated if it is too small for \p nCount items
+                or if it is four times larger than needed (after the threshold has been decreased).
+            */
+            void reserve( size_t nCount )
+            {
+                size_t const nBucketCount = nCount < c_nMinBucketCount ? c_nMinBucketCount : beans::ceil2( nCount ) ;
+                if ( m_nBucketCount < nBucketCount || m_nBucketCount / 4 >= nBucketCount ) {
+                    allocator_type().Delete( m_Buckets, m_nBucketCount )    ;
+                    alloc_buckets( nBucketCount ) ;
+                }
+            }
+
             void insert( retired_ptr_node& node )
             {
                 node.m_pNext = null_ptr<item_type>() ;
@@ -100,7 +127,12 @@ namespace cds { namespace gc { namespace ptb {
 
             typedef std::pair<item_type, item_type>     list_range ;
 
-            list_range free_all()
+            /// Frees all retired pointers of the set and makes the set empty
+            /**
+                Returns the list of retired nodes linked on \p m_pNextFree field,
+                \p nCount is increased by the number of pointers freed.
+            */
+            list_range free_all( size_t& nCount )
             {
                 item_type pTail = null_ptr<item_type>();
                 list_range ret = std::make_pair( pTail, pTail ) ;
@@ -109,6 +141,8 @@ namespace cds { namespace gc { namespace ptb {
                 for ( item_type * ppBucket = m_Buckets; ppBucket < pEndBucket; ++ppBucket ) {
                     item_type pBucket = *ppBucket ;
                     if ( pBucket ) {
+                        *ppBucket = null_ptr<item_type>() ;
+
                         if ( !ret.first )
                             ret.first = pBucket     ;
                         else
@@ -119,11 +153,13 @@ namespace cds { namespace gc { namespace ptb {
                             item_type pNext = pTail->m_pNext ;
                             pTail->m_ptr.free() ;
                             pTail->m_pNext = null_ptr<item_type>() ;
+                            ++nCount ;
 
                             while ( pTail->m_pNextFree ) {
                                 pTail = pTail->m_pNextFree  ;
                                 pTail->m_ptr.free() ;
                                 pTail->m_pNext = null_ptr<item_type>() ;
+                                ++nCount ;
                             }
 
                             if ( pNext )
@@ -144,13 +180,21 @@ namespace cds { namespace gc { namespace ptb {
 
     GarbageCollector * GarbageCollector::m_pManager = NULL  ;
 
+    static inline size_t partition_threshold( size_t nLiberateThreshold, size_t nPartitionCount )
+    {
+        if ( !nLiberateThreshold )
+            nLiberateThreshold = 1024 ;
+        return nLiberateThreshold > nPartitionCount ? nLiberateThreshold / nPartitionCount : 1 ;
+    }
+
     void CDS_STDCALL GarbageCollector::Construct(
         size_t nLiberateThreshold
         , size_t nInitialThreadGuardCount
+        , size_t nLiberatePartitionCount
     )
     {
         if ( !m_pManager ) {
-            m_pManager = new GarbageCollector( nLiberateThreshold, nInitialThreadGuardCount ) ;
+            m_pManager = new GarbageCollector( nLiberateThreshold, nInitialThreadGuardCount, nLiberatePartitionCount ) ;
         }
     }
 
@@ -162,17 +206,26 @@ namespace cds { namespace gc { namespace ptb {
         }
     }
 
-    GarbageCollector::GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount )
-        : m_nLiberateThreshold( nLiberateThreshold ? nLiberateThreshold : 1024 )
+    GarbageCollector::GarbageCollector( size_t nLiberateThreshold, size_t nInitialThreadGuardCount, size_t nLiberatePartitionCount )
+        : m_nPartitionCount( nLiberatePartitionCount > 1 ? beans::ceil2( nLiberatePartitionCount ) : 1 )
+        , m_nLiberateThreshold( partition_threshold( nLiberateThreshold, m_nPartitionCount ))
         , m_nInitialThreadGuardCount( nInitialThreadGuardCount ? nInitialThreadGuardCount : 8 )
         //, m_nInLiberate(0)
+        , m_bStatEnabled( true )
     {
+        m_arrPartition = cds::details::Allocator< details::retired_partition >().NewArray( m_nPartitionCount ) ;
+        for ( size_t i = 0; i < m_nPartitionCount; ++i )
+            m_arrPartition[i].m_nThreshold.store( m_nLiberateThreshold, CDS_ATOMIC::memory_order_relaxed ) ;
     }
 
     GarbageCollector::~GarbageCollector()
     {
         liberate()  ;
 
+        for ( size_t i = 0; i < m_nPartitionCount; ++i )
+            delete m_arrPartition[i].m_pSet ;
+        cds::details::Allocator< details::retired_partition >().Delete( m_arrPartition, m_nPartitionCount ) ;
+
 #if 0
         details::retired_ptr_node * pHead = null_ptr<details::retired_ptr_node *>();
         details::retired_ptr_node * pTail = null_ptr<details::retired_ptr_node *>();
@@ -198,23 +251,46 @@ namespace cds { namespace gc { namespace ptb {
 
     void GarbageCollector::liberate()
     {
-        details::retired_ptr_buffer::privatize_result retiredList = m_RetiredBuffer.privatize() ;
+        for ( size_t i = 0; i < m_nPartitionCount; ++i )
+            liberate( m_arrPartition[i] ) ;
+    }
+
+    void GarbageCollector::liberate( details::retired_partition& part )
+    {
+        // Only one thread may liberate the partition since the liberate set of the partition is reused
+        bool bBusy = false ;
+        if ( !part.m_bBusy.compare_exchange_strong( bBusy, true, CDS_ATOMIC::memory_order_acquire, CDS_ATOMIC::memory_order_relaxed )) {
+            if ( m_bStatEnabled )
+                m_stat.m_nLiberateBusy.fetch_add( 1, CDS_ATOMIC::memory_order_relaxed ) ;
+            return ;
+        }
+
+        details::retired_ptr_buffer::privatize_result retiredList = part.m_Buffer.privatize() ;
         if ( retiredList.first ) {
             //m_nInLiberate.fetch_add( 1, CDS_ATOMIC::memory_order_relaxed )  ;
 
-            size_t nLiberateThreshold = m_nLiberateThreshold.load(CDS_ATOMIC::memory_order_relaxed) ;
-            details::liberate_set set( beans::ceil2( retiredList.second > nLiberateThreshold ? retiredList.second : nLiberateThreshold ) ) ;
+            size_t nLiberateThreshold = part.m_nThreshold.load(CDS_ATOMIC::memory_order_relaxed) ;
+            size_t const nBucketCount = retiredList.second > nLiberateThreshold ? retiredList.second : nLiberateThreshold ;
+            if ( part.m_pSet )
+                part.m_pSet->reserve( nBucketCount ) ;
+            else
+                part.m_pSet = new details::liberate_set( nBucketCount ) ;
+            details::liberate_set& set = *part.m_pSet ;
 
             // Get list of retired pointers
+            size_t nBytes = 0 ;
             details::retired_ptr_node * pHead = retiredList.first ;
             while ( pHead ) {
                 details::retired_ptr_node * pNext = pHead->m_pNext ;
                 pHead->m_pNextFree = null_ptr<details::retired_ptr_node *>() ;
+                nBytes += pHead->m_ptr.m_nSize ;
                 set.insert( *pHead )   ;
                 pHead = pNext ;
             }
+            m_RetiredMemory.set( retired_bytes() ) ;
 
             // Liberate cycle
+            size_t nGuarded = 0 ;
             for ( details::guard_data * pGuard = m_GuardPool.begin(); pGuard; pGuard = pGuard->pGlobalNext.load(CDS_ATOMIC::memory_order_acquire) )
             {
                 // get guarded pointer
@@ -229,15 +305,20 @@ namespace cds { namespace gc { namespace ptb {
 
                         do {
                             details::retired_ptr_node * pNext = pRetired->m_pNextFree ;
-                            m_RetiredBuffer.push( *pRetired )   ;
+                            part.m_Buffer.push( *pRetired )   ;
+                            nBytes -= pRetired->m_ptr.m_nSize ;
                             pRetired = pNext    ;
+                            ++nGuarded ;
                         } while ( pRetired )    ;
                     }
                 }
             }
 
             // Free all retired pointers
-            details::liberate_set::list_range range = set.free_all()    ;
+            size_t nFreed = 0 ;
+            details::liberate_set::list_range range = set.free_all( nFreed )    ;
+            part.m_nBytes.fetch_sub( nBytes, CDS_ATOMIC::memory_order_relaxed ) ;
+            m_RetiredMemory.set( retired_bytes() ) ;
 
             //if ( m_nInLiberate.fetch_sub( 1, CDS_ATOMIC::memory_order_relaxed ) == 1 )
             m_RetiredAllocator.inc_epoch()  ;
@@ -246,11 +327,31 @@ namespace cds { namespace gc { namespace ptb {
                 assert( range.second != null_ptr<details::retired_ptr_node *>() ) ;
                 m_RetiredAllocator.free_range( range.first, range.second )   ;
             }
-            else {
+
+            // Adapt the threshold of the partition
+            if ( nFreed == 0 ) {
                 // liberate cycle did not free any retired pointer - double liberate threshold
-                m_nLiberateThreshold.compare_exchange_strong( nLiberateThreshold, nLiberateThreshold * 2, CDS_ATOMIC::memory_order_release, CDS_ATOMIC::memory_order_relaxed ) ;
+                part.m_nThreshold.store( nLiberateThreshold * 2, CDS_ATOMIC::memory_order_relaxed ) ;
+                if ( m_bStatEnabled )
+                    m_stat.m_nThresholdInc.fetch_add( 1, CDS_ATOMIC::memory_order_relaxed ) ;
+            }
+            else if ( nFreed > nGuarded && nLiberateThreshold > m_nLiberateThreshold ) {
+                // Most of retired pointers are not guarded anymore, the increased threshold just keeps
+                // the memory unfreed - halve the threshold down to its initial value
+                nLiberateThreshold /= 2 ;
+                part.m_nThreshold.store( nLiberateThreshold > m_nLiberateThreshold ? nLiberateThreshold : m_nLiberateThreshold, CDS_ATOMIC::memory_order_relaxed ) ;
+                if ( m_bStatEnabled )
+                    m_stat.m_nThresholdDec.fetch_add( 1, CDS_ATOMIC::memory_order_relaxed ) ;
+            }
+
+            if ( m_bStatEnabled ) {
+                m_stat.m_nLiberateCall.fetch_add( 1, CDS_ATOMIC::memory_order_relaxed ) ;
+                m_stat.m_nFreedPtr.fetch_add( nFreed, CDS_ATOMIC::memory_order_relaxed ) ;
+                m_stat.m_nGuardedPtr.fetch_add( nGuarded, CDS_ATOMIC::memory_order_relaxed ) ;
             }
         }
+
+        part.m_bBusy.store( false, CDS_ATOMIC::memory_order_release ) ;
     }
 
 #if 0
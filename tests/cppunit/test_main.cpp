@@ -30,6 +30,7 @@
 #include <cds/gc/hp.h>
 #include <cds/gc/hrc.h>
 #include <cds/gc/ptb.h>
+#include <cds/gc/ebr.h>
 #include <cds/urcu/general_instant.h>
 #include <cds/urcu/general_buffered.h>
 #include <cds/urcu/general_threaded.h>
@@ -59,16 +60,27 @@ std::ostream& operator << (std::ostream& s, const cds::gc::hzp::GarbageCollector
         << "\n\t\tHP records used=" << stat.nHPRecUsed
         << "\n\t\tTotal retired ptr count=" << stat.nTotalRetiredPtrCount
         << "\n\t\tRetired ptr in free HP records=" << stat.nRetiredPtrInFreeHPRecs
+        << "\n\t\tTotal HP count=" << stat.nTotalHPCount
+        << "\n\t\tRemoved HP records waiting for deletion=" << stat.nRemovedHPRecs
+        << "\n\t\tHP set bytes of hashed scan=" << stat.nHashedSetBytes
         << "\n\tEvents:"
         << "\n\t\tHPRec allocations=" << stat.evcAllocHPRec
         << "\n\t\tHPRec retire events=" << stat.evcRetireHPRec
         << "\n\t\tnew HPRec allocations from heap=" << stat.evcAllocNewHPRec
         << "\n\t\tHPRec deletions=" << stat.evcDeleteHPRec
+        << "\n\t\tHPRec removing from HP list=" << stat.evcRemoveHPRec
+        << "\n\t\tretired array growing=" << stat.evcGrowRetired
+        << "\n\t\tretired batches exceeding retired array=" << stat.evcRetireBatch
+        << "\n\t\tretired arrays handed off to reclamation thread=" << stat.evcDeferScan
+        << "\n\t\thand-offs rejected (queue is full)=" << stat.evcDeferScanRejected
         << "\n\t\tScan calling=" << stat.evcScanCall
         << "\n\t\tHelpScan calling=" << stat.evcHelpScanCall
         << "\n\t\tScan calls from HelpScan=" << stat.evcScanFromHelpScan
         << "\n\t\tretired objects deleting=" << stat.evcDeletedNode
         << "\n\t\tguarded objects on Scan=" << stat.evcDeferredNode
+        << "\n\t\tnon-null HP collected on Scan=" << stat.evcScanHPCount
+        << "\n\t\tHP lookup probes on Scan=" << stat.evcScanProbeCount
+        << "\n\t\thashed Scan fallbacks to classic=" << stat.evcHashedScanFallback
         << std::endl ;
 
     return s;
@@ -357,15 +369,22 @@ int main(int argc, char** argv)
   int num_errors;
   {
       size_t nHazardPtrCount = 0 ;
+      bool bHZPDynamic = false ;
+      size_t nHZPDisposeQueue = 0 ;
+      size_t nPTBPartitionCount = 1 ;
       {
         CppUnitMini::TestCfg& cfg = CppUnitMini::TestCase::m_Cfg.get( "General" )    ;
         nHazardPtrCount = cfg.getULong( "hazard_pointer_count", 0 ) ;
+        bHZPDynamic = cfg.getBool( "HZP_dynamic_hprec", false ) ;
+        nHZPDisposeQueue = cfg.getULong( "HZP_dispose_queue", 0 ) ;
+        nPTBPartitionCount = cfg.getULong( "PTB_liberate_partitions", 1 ) ;
       }
 
       // Safe reclamation schemes
-      cds::gc::HP hzpGC( nHazardPtrCount )  ;
+      cds::gc::HP hzpGC( nHazardPtrCount, 0, 0, cds::gc::hzp::inplace, bHZPDynamic, nHZPDisposeQueue )  ;
       cds::gc::HRC hrcGC( nHazardPtrCount ) ;
-      cds::gc::PTB ptbGC    ;
+      cds::gc::PTB ptbGC( 1024, 8, nPTBPartitionCount ) ;
+      cds::gc::EBR ebrGC    ;
 
       // RCU varieties
       typedef cds::urcu::gc< cds::urcu::general_instant<> >    rcu_gpi ;
@@ -401,6 +420,8 @@ int main(int argc, char** argv)
             hzpGC.setScanType( cds::gc::hzp::inplace )    ;
         else if ( strHZPScanStrategy == "classic" )
             hzpGC.setScanType( cds::gc::hzp::classic )    ;
+        else if ( strHZPScanStrategy == "hashed" )
+            hzpGC.setScanType( cds::gc::hzp::hashed )    ;
         else {
             std::cout << "Error value of HZP_scan_strategy in General section of test config\n" ;
         }
@@ -412,6 +433,9 @@ int main(int argc, char** argv)
         case cds::gc::hzp::classic:
             std::cout << "Use classic scan strategy for Hazad Pointer memory reclamation algorithm\n"   ;
             break;
+        case cds::gc::hzp::hashed:
+            std::cout << "Use hashed scan strategy for Hazad Pointer memory reclamation algorithm\n"   ;
+            break;
         default:
             std::cout << "ERROR: use unknown scan strategy for Hazad Pointer memory reclamation algorithm\n"   ;
             break;
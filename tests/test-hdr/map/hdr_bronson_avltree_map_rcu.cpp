@@ -0,0 +1,99 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "map/hdr_bronson_avltree_map.h"
+
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/general_threaded.h>
+#include <cds/urcu/signal_buffered.h>
+#include <cds/urcu/signal_threaded.h>
+#include <cds/container/bronson_avltree_map_rcu.h>
+
+namespace map {
+
+    namespace {
+        template <typename RCU>
+        struct map_of {
+            typedef cc::BronsonAVLTreeMap< RCU, BronsonAVLTreeMapHdrTest::key_type, BronsonAVLTreeMapHdrTest::value_type,
+                typename cc::bronson_avltree::make_traits<
+                    co::compare< BronsonAVLTreeMapHdrTest::cmp >
+                    ,co::item_counter< cds::atomicity::item_counter >
+                >::type
+            > type ;
+        };
+    }
+
+    void BronsonAVLTreeMapHdrTest::BronsonAVLTree_RCU_GPI_less()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_instant<> > rcu_type ;
+        typedef cc::BronsonAVLTreeMap< rcu_type, key_type, value_type,
+            cc::bronson_avltree::make_traits<
+                co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > map_type ;
+
+        test< map_type >() ;
+    }
+
+    void BronsonAVLTreeMapHdrTest::BronsonAVLTree_RCU_GPI_cmp()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_instant<> > rcu_type ;
+        test< map_of<rcu_type>::type >() ;
+    }
+
+    void BronsonAVLTreeMapHdrTest::BronsonAVLTree_RCU_GPI_cmpless_stat()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_instant<> > rcu_type ;
+        typedef cc::BronsonAVLTreeMap< rcu_type, key_type, value_type,
+            cc::bronson_avltree::make_traits<
+                co::compare< cmp >
+                ,co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::bronson_avltree::stat >
+            >::type
+        > map_type ;
+
+        test< map_type >() ;
+    }
+
+    void BronsonAVLTreeMapHdrTest::BronsonAVLTree_RCU_GPB()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_type ;
+        test< map_of<rcu_type>::type >() ;
+    }
+
+    void BronsonAVLTreeMapHdrTest::BronsonAVLTree_RCU_GPT()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_threaded<> > rcu_type ;
+        test< map_of<rcu_type>::type >() ;
+    }
+
+    void BronsonAVLTreeMapHdrTest::BronsonAVLTree_RCU_SHB()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cds::urcu::gc< cds::urcu::signal_buffered<> > rcu_type ;
+        test< map_of<rcu_type>::type >() ;
+#endif
+    }
+
+    void BronsonAVLTreeMapHdrTest::BronsonAVLTree_RCU_SHT()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cds::urcu::gc< cds::urcu::signal_threaded<> > rcu_type ;
+        test< map_of<rcu_type>::type >() ;
+#endif
+    }
+
+} // namespace map
+
+CPPUNIT_TEST_SUITE_REGISTRATION(map::BronsonAVLTreeMapHdrTest)    ;
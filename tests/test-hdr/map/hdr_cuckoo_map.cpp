@@ -339,6 +339,21 @@ namespace map {
 
             test_cuckoo<map_t>() ;
         }
+
+        CPPUNIT_MESSAGE( "equal, fingerprint, store hash")   ;
+        {
+            typedef cc::CuckooMap< CuckooMapHdrTest::key_type, CuckooMapHdrTest::value_type,
+                cc::cuckoo::make_traits<
+                    co::equal_to< std::equal_to< int > >
+                    ,cc::cuckoo::store_hash< true >
+                    ,cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+                    ,cc::cuckoo::fingerprint<>
+                    ,co::hash< std::tuple< hash1, hash2 > >
+                >::type
+            > map_t ;
+
+            test_cuckoo<map_t>() ;
+        }
     }
 
 
@@ -657,6 +672,36 @@ namespace map {
 
             test_cuckoo<map_t>() ;
         }
+
+        CPPUNIT_MESSAGE( "equal, optimistic find")   ;
+        {
+            typedef cc::CuckooMap< CuckooMapHdrTest::key_type, CuckooMapHdrTest::value_type,
+                cc::cuckoo::make_traits<
+                    co::mutex_policy< cc::cuckoo::refinable<> >
+                    ,co::equal_to< std::equal_to< int > >
+                    ,cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+                    ,cc::cuckoo::optimistic_find< true >
+                    ,co::hash< std::tuple< hash1, hash2 > >
+                >::type
+            > map_t ;
+
+            test_cuckoo<map_t>() ;
+        }
+
+        CPPUNIT_MESSAGE( "cmp, fingerprint 16 bit")   ;
+        {
+            typedef cc::CuckooMap< CuckooMapHdrTest::key_type, CuckooMapHdrTest::value_type,
+                cc::cuckoo::make_traits<
+                    co::mutex_policy< cc::cuckoo::refinable<> >
+                    ,co::compare< CuckooMapHdrTest::cmp >
+                    ,cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+                    ,cc::cuckoo::fingerprint< cds::uint16_t >
+                    ,co::hash< std::tuple< hash1, hash2 > >
+                >::type
+            > map_t ;
+
+            test_cuckoo<map_t>() ;
+        }
     }
 
 }   // namespace map
@@ -0,0 +1,346 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDSTEST_HDR_ELLEN_BINTREE_MAP_H
+#define __CDSTEST_HDR_ELLEN_BINTREE_MAP_H
+#include "size_check.h"
+
+#include "cppunit/cppunit_proxy.h"
+#include <cds/opt/options.h>
+#include <cds/ref.h>
+#include <vector>
+#include <algorithm>    // random_shuffle
+
+namespace cds { namespace container {}}
+
+namespace map {
+    using misc::check_size ;
+
+    namespace cc = cds::container   ;
+    namespace co = cds::opt         ;
+
+    class EllenBinTreeMapHdrTest: public CppUnitMini::TestCase
+    {
+    public:
+        typedef int key_type    ;
+
+        struct value_type {
+            int m_val   ;
+
+            value_type()
+                : m_val(0)
+            {}
+
+            value_type( int n )
+                : m_val( n )
+            {}
+        };
+
+        typedef std::pair<key_type const, value_type> pair_type ;
+
+        struct less {
+            bool operator ()(int v1, int v2 ) const
+            {
+                return v1 < v2  ;
+            }
+        };
+
+        struct cmp {
+            int operator ()(int v1, int v2 ) const
+            {
+                if ( v1 < v2 )
+                    return -1   ;
+                return v1 > v2 ? 1 : 0  ;
+            }
+        };
+
+        struct other_item {
+            int key ;
+
+            other_item( int n )
+                : key(n)
+            {}
+        };
+
+        struct other_less {
+            bool operator ()( int v1, other_item const& v2 ) const
+            {
+                return v1 < v2.key  ;
+            }
+            bool operator ()( other_item const& v1, int v2 ) const
+            {
+                return v1.key < v2  ;
+            }
+            bool operator ()( other_item const& v1, other_item const& v2 ) const
+            {
+                return v1.key < v2.key  ;
+            }
+        };
+
+        struct insert_functor
+        {
+            // insert ftor
+            void operator()( pair_type& item )
+            {
+                item.second.m_val = item.first * 3   ;
+            }
+
+            // ensure ftor
+            void operator()( bool bNew, pair_type& item )
+            {
+                if ( bNew )
+                    item.second.m_val = item.first * 2        ;
+                else
+                    item.second.m_val = item.first * 5       ;
+            }
+        };
+
+        struct check_value {
+            int     m_nExpected ;
+
+            check_value( int nExpected )
+                : m_nExpected( nExpected )
+            {}
+
+            void operator ()( pair_type& pair )
+            {
+                CPPUNIT_ASSERT_CURRENT( pair.second.m_val == m_nExpected )  ;
+            }
+        };
+
+        struct extract_functor
+        {
+            int *   m_pVal  ;
+            void operator()( pair_type const& val )
+            {
+                *m_pVal = val.second.m_val   ;
+            }
+        };
+
+        struct extract_key_functor
+        {
+            int     m_nKey  ;
+
+            extract_key_functor()
+                : m_nKey( -1 )
+            {}
+
+            void operator()( pair_type const& val )
+            {
+                m_nKey = val.first ;
+            }
+        };
+
+        template <class Map>
+        void test_int( Map& m )
+        {
+            std::pair<bool, bool> ensureResult ;
+
+            // insert
+            CPPUNIT_ASSERT( m.empty() )     ;
+            CPPUNIT_ASSERT( check_size( m, 0 )) ;
+            CPPUNIT_ASSERT( !m.find(25) )   ;
+            CPPUNIT_ASSERT( m.insert( 25 ) )    ;   // value = 0
+            CPPUNIT_ASSERT( m.find(25) )   ;
+            CPPUNIT_ASSERT( !m.empty() ) ;
+            CPPUNIT_ASSERT( check_size( m, 1 )) ;
+
+            CPPUNIT_ASSERT( !m.insert( 25 ) )    ;
+            CPPUNIT_ASSERT( check_size( m, 1 )) ;
+
+            CPPUNIT_ASSERT( !m.find_with( other_item(10), other_less()) )   ;
+            CPPUNIT_ASSERT( m.insert( 10, 10 ) )    ;
+            CPPUNIT_ASSERT( check_size( m, 2 )) ;
+            CPPUNIT_ASSERT( m.find_with( other_item(10), other_less()) )   ;
+
+            CPPUNIT_ASSERT( !m.insert( 10, 20 ) )    ;
+            CPPUNIT_ASSERT( check_size( m, 2 )) ;
+
+            CPPUNIT_ASSERT( !m.find(30) )   ;
+            CPPUNIT_ASSERT( m.insert_key( 30, insert_functor() ) )    ; // value = 90
+            CPPUNIT_ASSERT( check_size( m, 3 )) ;
+            CPPUNIT_ASSERT( m.find(30) )   ;
+
+            CPPUNIT_ASSERT( !m.insert_key( 10, insert_functor() ) )    ;
+            CPPUNIT_ASSERT( !m.insert_key( 25, insert_functor() ) )    ;
+            CPPUNIT_ASSERT( !m.insert_key( 30, insert_functor() ) )    ;
+            CPPUNIT_ASSERT( check_size( m, 3 )) ;
+
+            // ensure (new key)
+            CPPUNIT_ASSERT( !m.find(27) )   ;
+            ensureResult = m.ensure( 27, insert_functor() ) ;   // value = 54
+            CPPUNIT_ASSERT( ensureResult.first )    ;
+            CPPUNIT_ASSERT( ensureResult.second )   ;
+            CPPUNIT_ASSERT( m.find(27) )   ;
+
+            // find test
+            check_value chk(10)   ;
+            CPPUNIT_ASSERT( m.find( 10, cds::ref(chk) ))  ;
+            chk.m_nExpected = 0 ;
+            CPPUNIT_ASSERT( m.find_with( 25, less(), boost::ref(chk) ))  ;
+            chk.m_nExpected = 90 ;
+            CPPUNIT_ASSERT( m.find( 30, boost::ref(chk) ))  ;
+            chk.m_nExpected = 54 ;
+            CPPUNIT_ASSERT( m.find( 27, boost::ref(chk) ))  ;
+
+            ensureResult = m.ensure( 10, insert_functor() ) ;   // value = 50
+            CPPUNIT_ASSERT( ensureResult.first )    ;
+            CPPUNIT_ASSERT( !ensureResult.second )  ;
+            chk.m_nExpected = 50 ;
+            CPPUNIT_ASSERT( m.find( 10, boost::ref(chk) ))  ;
+            CPPUNIT_ASSERT( check_size( m, 4 )) ;
+
+            // erase test
+            CPPUNIT_ASSERT( !m.find(100) )   ;
+            CPPUNIT_ASSERT( !m.erase( 100 ))    ;   // not found
+            CPPUNIT_ASSERT( check_size( m, 4 )) ;
+
+            CPPUNIT_ASSERT( m.find(25) )   ;
+            CPPUNIT_ASSERT( m.erase_with( other_item(25), other_less() ))   ;
+            CPPUNIT_ASSERT( !m.find(25) )   ;
+            CPPUNIT_ASSERT( check_size( m, 3 )) ;
+
+            int nVal    ;
+            extract_functor ext ;
+            ext.m_pVal = &nVal  ;
+
+            CPPUNIT_ASSERT( !m.find(29) )   ;
+            CPPUNIT_ASSERT( !m.erase( 29, boost::ref(ext)))    ;   // not found
+
+            CPPUNIT_ASSERT( m.find(30) )   ;
+            CPPUNIT_ASSERT( m.erase_with( 30, less(), boost::ref(ext)))   ;
+            CPPUNIT_ASSERT( nVal == 90 )    ;
+            CPPUNIT_ASSERT( !m.find(30) )   ;
+            CPPUNIT_ASSERT( check_size( m, 2 )) ;
+
+            CPPUNIT_ASSERT( m.erase( 27, boost::ref(ext)))   ;
+            CPPUNIT_ASSERT( nVal == 54 )    ;
+            CPPUNIT_ASSERT( check_size( m, 1 )) ;
+
+            CPPUNIT_ASSERT( m.erase( 10 ))   ;
+            CPPUNIT_ASSERT( m.empty() ) ;
+            CPPUNIT_ASSERT( check_size( m, 0 )) ;
+
+#       ifdef CDS_EMPLACE_SUPPORT
+            // emplace test
+            CPPUNIT_ASSERT( m.emplace(126) ) ; // key = 126, val = 0
+            CPPUNIT_ASSERT( m.emplace(137, 731))    ;   // key = 137, val = 731
+            CPPUNIT_ASSERT( m.emplace( 149, value_type(941) ))   ;   // key = 149, val = 941
+
+            CPPUNIT_ASSERT( check_size( m, 3 )) ;
+
+            chk.m_nExpected = 0 ;
+            CPPUNIT_ASSERT( m.find( 126, cds::ref(chk) ))  ;
+            chk.m_nExpected = 731 ;
+            CPPUNIT_ASSERT( m.find( 137, cds::ref(chk) ))  ;
+            chk.m_nExpected = 941 ;
+            CPPUNIT_ASSERT( m.find( 149, cds::ref(chk) ))  ;
+
+            CPPUNIT_ASSERT( !m.emplace(126, 621)) ; // already in map
+            chk.m_nExpected = 0 ;
+            CPPUNIT_ASSERT( m.find( 126, cds::ref(chk) ))  ;
+            CPPUNIT_ASSERT( check_size( m, 3 )) ;
+#       endif
+
+            m.clear()   ;
+            CPPUNIT_ASSERT( m.empty() ) ;
+            CPPUNIT_ASSERT( check_size( m, 0 )) ;
+        }
+
+        template <class Map>
+        void test_extract( Map& m )
+        {
+            const int nMaxCount = 1000   ;
+            {
+                std::vector<int> arr ;
+                arr.reserve( nMaxCount ) ;
+                for ( int i = 0; i < nMaxCount; ++i )
+                    arr.push_back( i ) ;
+                std::random_shuffle( arr.begin(), arr.end() ) ;
+
+                for ( std::vector<int>::const_iterator it = arr.begin(); it != arr.end(); ++it )
+                    CPPUNIT_ASSERT( m.insert( *it, *it * 2 ))   ;
+            }
+            CPPUNIT_ASSERT( check_size( m, nMaxCount )) ;
+            for ( int i = 0; i < nMaxCount; ++i )
+                CPPUNIT_ASSERT( m.find( i )) ;
+
+            // The keys are extracted in ascending order from the left and in descending order from the right
+            extract_key_functor ext ;
+            for ( int i = 0; i < nMaxCount / 2; ++i ) {
+                CPPUNIT_ASSERT( m.extract_min( cds::ref(ext) )) ;
+                CPPUNIT_ASSERT_EX( ext.m_nKey == i, "expected=" << i << ", extracted=" << ext.m_nKey ) ;
+            }
+            for ( int i = nMaxCount - 1; i >= nMaxCount / 2; --i ) {
+                CPPUNIT_ASSERT( m.extract_max( cds::ref(ext) )) ;
+                CPPUNIT_ASSERT_EX( ext.m_nKey == i, "expected=" << i << ", extracted=" << ext.m_nKey ) ;
+            }
+            CPPUNIT_ASSERT( m.empty() ) ;
+            CPPUNIT_ASSERT( check_size( m, 0 )) ;
+            CPPUNIT_ASSERT( !m.extract_min( cds::ref(ext) )) ;
+            CPPUNIT_ASSERT( !m.extract_max( cds::ref(ext) )) ;
+
+            // Ascending insertion produces the degenerated tree
+            for ( int i = 0; i < nMaxCount; ++i )
+                CPPUNIT_ASSERT( m.insert( i, i )) ;
+            for ( int i = 0; i < nMaxCount; i += 2 )
+                CPPUNIT_ASSERT( m.erase( i )) ;
+            CPPUNIT_ASSERT( check_size( m, nMaxCount / 2 )) ;
+            for ( int i = 0; i < nMaxCount; ++i )
+                CPPUNIT_ASSERT( m.find( i ) == ((i & 1) != 0) ) ;
+
+            m.clear() ;
+            CPPUNIT_ASSERT( m.empty() ) ;
+            CPPUNIT_ASSERT( check_size( m, 0 )) ;
+
+            // The destructor frees the rest
+            for ( int i = nMaxCount; i > 0; --i )
+                CPPUNIT_ASSERT( m.insert( i )) ;
+        }
+
+        template <class Map>
+        void test()
+        {
+            Map m ;
+            test_int( m ) ;
+            test_extract( m ) ;
+        }
+
+        void EllenBinTree_HP_less()         ;
+        void EllenBinTree_HP_cmp()          ;
+        void EllenBinTree_HP_cmpless_stat() ;
+        void EllenBinTree_PTB_less()        ;
+        void EllenBinTree_PTB_cmp()         ;
+        void EllenBinTree_PTB_cmpless_stat();
+        void EllenBinTree_RCU_GPI()         ;
+        void EllenBinTree_RCU_GPB()         ;
+        void EllenBinTree_RCU_GPT()         ;
+        void EllenBinTree_RCU_SHB()         ;
+        void EllenBinTree_RCU_SHT()         ;
+
+        CPPUNIT_TEST_SUITE(EllenBinTreeMapHdrTest)
+            CPPUNIT_TEST(EllenBinTree_HP_less)
+            CPPUNIT_TEST(EllenBinTree_HP_cmp)
+            CPPUNIT_TEST(EllenBinTree_HP_cmpless_stat)
+            CPPUNIT_TEST(EllenBinTree_PTB_less)
+            CPPUNIT_TEST(EllenBinTree_PTB_cmp)
+            CPPUNIT_TEST(EllenBinTree_PTB_cmpless_stat)
+            CPPUNIT_TEST(EllenBinTree_RCU_GPI)
+            CPPUNIT_TEST(EllenBinTree_RCU_GPB)
+            CPPUNIT_TEST(EllenBinTree_RCU_GPT)
+            CPPUNIT_TEST(EllenBinTree_RCU_SHB)
+            CPPUNIT_TEST(EllenBinTree_RCU_SHT)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+} // namespace map
+
+#endif // #ifndef __CDSTEST_HDR_ELLEN_BINTREE_MAP_H
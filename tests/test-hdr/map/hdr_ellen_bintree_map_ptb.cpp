@@ -0,0 +1,51 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "map/hdr_ellen_bintree_map.h"
+#include <cds/container/ellen_bintree_map_ptb.h>
+
+namespace map {
+
+    void EllenBinTreeMapHdrTest::EllenBinTree_PTB_less()
+    {
+        typedef cc::EllenBinTreeMap< cds::gc::PTB, key_type, value_type,
+            cc::ellen_bintree::make_traits<
+                co::less< less >
+            >::type
+        > map_type ;
+        test< map_type >() ;
+    }
+
+    void EllenBinTreeMapHdrTest::EllenBinTree_PTB_cmp()
+    {
+        typedef cc::EllenBinTreeMap< cds::gc::PTB, key_type, value_type,
+            cc::ellen_bintree::make_traits<
+                co::compare< cmp >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > map_type ;
+        test< map_type >() ;
+    }
+
+    void EllenBinTreeMapHdrTest::EllenBinTree_PTB_cmpless_stat()
+    {
+        typedef cc::EllenBinTreeMap< cds::gc::PTB, key_type, value_type,
+            cc::ellen_bintree::make_traits<
+                co::compare< cmp >
+                ,co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::ellen_bintree::stat >
+            >::type
+        > map_type ;
+        test< map_type >() ;
+    }
+
+} // namespace map
@@ -0,0 +1,70 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "map/hdr_ellen_bintree_map.h"
+
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/general_threaded.h>
+#include <cds/urcu/signal_buffered.h>
+#include <cds/urcu/signal_threaded.h>
+#include <cds/container/ellen_bintree_map_rcu.h>
+
+namespace map {
+
+    namespace {
+        template <typename RCU>
+        struct map_of {
+            typedef cc::EllenBinTreeMap< RCU, EllenBinTreeMapHdrTest::key_type, EllenBinTreeMapHdrTest::value_type,
+                typename cc::ellen_bintree::make_traits<
+                    co::compare< EllenBinTreeMapHdrTest::cmp >
+                    ,co::item_counter< cds::atomicity::item_counter >
+                    ,co::stat< cc::ellen_bintree::stat >
+                >::type
+            > type ;
+        };
+    }
+
+    void EllenBinTreeMapHdrTest::EllenBinTree_RCU_GPI()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_instant<> > rcu_type ;
+        test< map_of<rcu_type>::type >() ;
+    }
+
+    void EllenBinTreeMapHdrTest::EllenBinTree_RCU_GPB()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_type ;
+        test< map_of<rcu_type>::type >() ;
+    }
+
+    void EllenBinTreeMapHdrTest::EllenBinTree_RCU_GPT()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_threaded<> > rcu_type ;
+        test< map_of<rcu_type>::type >() ;
+    }
+
+    void EllenBinTreeMapHdrTest::EllenBinTree_RCU_SHB()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cds::urcu::gc< cds::urcu::signal_buffered<> > rcu_type ;
+        test< map_of<rcu_type>::type >() ;
+#endif
+    }
+
+    void EllenBinTreeMapHdrTest::EllenBinTree_RCU_SHT()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cds::urcu::gc< cds::urcu::signal_threaded<> > rcu_type ;
+        test< map_of<rcu_type>::type >() ;
+#endif
+    }
+
+} // namespace map
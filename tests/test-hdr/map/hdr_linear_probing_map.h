@@ -0,0 +1,242 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDSTEST_HDR_LINEAR_PROBING_MAP_H
+#define __CDSTEST_HDR_LINEAR_PROBING_MAP_H
+#include "size_check.h"
+
+#include "cppunit/cppunit_proxy.h"
+#include <cds/opt/hash.h>
+#include <cds/ref.h>
+#include <vector>
+#include <algorithm>    // random_shuffle
+
+namespace cds { namespace container {}}
+
+namespace map {
+    using misc::check_size ;
+
+    namespace cc = cds::container   ;
+    namespace co = cds::opt         ;
+
+    // LinearProbingMap test: the map supports word-sized integral keys and values only
+    class LinearProbingMapHdrTest: public CppUnitMini::TestCase
+    {
+    public:
+        typedef int     key_type    ;
+        typedef size_t  value_type  ;
+
+        // Poor hash: all keys that differ in high bits only collide without the mixing inside the map
+        struct hash_int {
+            size_t operator()( int i ) const
+            {
+                return static_cast<size_t>( static_cast<unsigned int>(i) ) << 16 ;
+            }
+        };
+
+        struct check_value {
+            value_type  m_nExpected ;
+
+            check_value( value_type nExpected )
+                : m_nExpected( nExpected )
+            {}
+
+            void operator ()( key_type /*key*/, value_type val )
+            {
+                CPPUNIT_ASSERT_CURRENT( val == m_nExpected )  ;
+            }
+        };
+
+        struct extract_functor
+        {
+            value_type *    m_pVal  ;
+            void operator()( key_type /*key*/, value_type val )
+            {
+                *m_pVal = val ;
+            }
+        };
+
+        template <class Map>
+        void test_int( Map& m )
+        {
+            std::pair<bool, bool> ensureResult ;
+
+            // insert
+            CPPUNIT_ASSERT( m.empty() )     ;
+            CPPUNIT_ASSERT( check_size( m, 0 )) ;
+            CPPUNIT_ASSERT( !m.find(25) )   ;
+            CPPUNIT_ASSERT( m.insert( 25 ) )    ;   // value = 0
+            CPPUNIT_ASSERT( m.find(25) )   ;
+            CPPUNIT_ASSERT( !m.empty() ) ;
+            CPPUNIT_ASSERT( check_size( m, 1 )) ;
+
+            CPPUNIT_ASSERT( !m.insert( 25 ) )    ;
+            CPPUNIT_ASSERT( check_size( m, 1 )) ;
+
+            CPPUNIT_ASSERT( !m.find(10) )   ;
+            CPPUNIT_ASSERT( m.insert( 10, 10 ) )    ;
+            CPPUNIT_ASSERT( check_size( m, 2 )) ;
+            CPPUNIT_ASSERT( m.find(10) )   ;
+
+            CPPUNIT_ASSERT( !m.insert( 10, 20 ) )    ;
+            CPPUNIT_ASSERT( check_size( m, 2 )) ;
+
+            // ensure (new key)
+            CPPUNIT_ASSERT( !m.find(27) )   ;
+            ensureResult = m.ensure( 27, 54 ) ;
+            CPPUNIT_ASSERT( ensureResult.first )    ;
+            CPPUNIT_ASSERT( ensureResult.second )   ;
+            CPPUNIT_ASSERT( m.find(27) )   ;
+            CPPUNIT_ASSERT( check_size( m, 3 )) ;
+
+            // find test
+            check_value chk(10)   ;
+            CPPUNIT_ASSERT( m.find( 10, cds::ref(chk) ))  ;
+            chk.m_nExpected = 0 ;
+            CPPUNIT_ASSERT( m.find( 25, boost::ref(chk) ))  ;
+            chk.m_nExpected = 54 ;
+            CPPUNIT_ASSERT( m.find( 27, boost::ref(chk) ))  ;
+
+            // ensure (existing key) replaces the value
+            ensureResult = m.ensure( 10, 50 ) ;
+            CPPUNIT_ASSERT( ensureResult.first )    ;
+            CPPUNIT_ASSERT( !ensureResult.second )  ;
+            chk.m_nExpected = 50 ;
+            CPPUNIT_ASSERT( m.find( 10, boost::ref(chk) ))  ;
+            CPPUNIT_ASSERT( check_size( m, 3 )) ;
+
+            // erase test
+            CPPUNIT_ASSERT( !m.find(100) )   ;
+            CPPUNIT_ASSERT( !m.erase( 100 ))    ;   // not found
+            CPPUNIT_ASSERT( check_size( m, 3 )) ;
+
+            CPPUNIT_ASSERT( m.find(25) )   ;
+            CPPUNIT_ASSERT( m.erase( 25 ))   ;
+            CPPUNIT_ASSERT( !m.find(25) )   ;
+            CPPUNIT_ASSERT( !m.erase( 25 ))   ;
+            CPPUNIT_ASSERT( check_size( m, 2 )) ;
+
+            value_type nVal    ;
+            extract_functor ext ;
+            ext.m_pVal = &nVal  ;
+
+            CPPUNIT_ASSERT( !m.find(29) )   ;
+            CPPUNIT_ASSERT( !m.erase( 29, boost::ref(ext)))    ;   // not found
+
+            CPPUNIT_ASSERT( m.erase( 27, boost::ref(ext)))   ;
+            CPPUNIT_ASSERT( nVal == 54 )    ;
+            CPPUNIT_ASSERT( !m.find(27) )   ;
+            CPPUNIT_ASSERT( check_size( m, 1 )) ;
+
+            // the cell of erased key is reused
+            CPPUNIT_ASSERT( m.insert( 25, 125 ))   ;
+            chk.m_nExpected = 125 ;
+            CPPUNIT_ASSERT( m.find( 25, boost::ref(chk) ))  ;
+            CPPUNIT_ASSERT( check_size( m, 2 )) ;
+
+            m.clear()   ;
+            CPPUNIT_ASSERT( m.empty() ) ;
+            CPPUNIT_ASSERT( check_size( m, 0 )) ;
+            CPPUNIT_ASSERT( !m.find(10) )   ;
+            CPPUNIT_ASSERT( !m.find(25) )   ;
+        }
+
+        template <class Map>
+        void test_resize( Map& m )
+        {
+            const int nMaxCount = 5000   ;
+            size_t const nInitCapacity = m.capacity() ;
+            {
+                std::vector<int> arr ;
+                arr.reserve( nMaxCount ) ;
+                for ( int i = 0; i < nMaxCount; ++i )
+                    arr.push_back( i ) ;
+                std::random_shuffle( arr.begin(), arr.end() ) ;
+
+                for ( std::vector<int>::const_iterator it = arr.begin(); it != arr.end(); ++it )
+                    CPPUNIT_ASSERT( m.insert( *it, *it * 2 ))   ;
+            }
+            CPPUNIT_ASSERT( check_size( m, nMaxCount )) ;
+            CPPUNIT_ASSERT( m.capacity() > nInitCapacity ) ;
+            CPPUNIT_ASSERT( m.capacity() >= size_t(nMaxCount) * 4 / 3 ) ;
+
+            for ( int i = 0; i < nMaxCount; ++i ) {
+                check_value chk( i * 2 ) ;
+                CPPUNIT_ASSERT( m.find( i, boost::ref(chk) )) ;
+            }
+
+            for ( int i = 0; i < nMaxCount; i += 2 )
+                CPPUNIT_ASSERT( m.erase( i )) ;
+            CPPUNIT_ASSERT( check_size( m, nMaxCount / 2 )) ;
+            for ( int i = 0; i < nMaxCount; ++i )
+                CPPUNIT_ASSERT( m.find( i ) == ((i & 1) != 0) ) ;
+
+            // Insert/erase churn with distinct keys: the erased cells are purged by migration,
+            // the capacity does not grow
+            size_t const nCapacity = m.capacity() ;
+            for ( int i = nMaxCount; i < nMaxCount * 20; ++i ) {
+                CPPUNIT_ASSERT( m.insert( i, i )) ;
+                CPPUNIT_ASSERT( m.erase( i )) ;
+            }
+            CPPUNIT_ASSERT( check_size( m, nMaxCount / 2 )) ;
+            CPPUNIT_ASSERT( m.capacity() == nCapacity ) ;
+            for ( int i = 0; i < nMaxCount; ++i ) {
+                check_value chk( i * 2 ) ;
+                CPPUNIT_ASSERT( m.find( i, boost::ref(chk) ) == ((i & 1) != 0) ) ;
+            }
+
+            m.clear() ;
+            CPPUNIT_ASSERT( m.empty() ) ;
+            CPPUNIT_ASSERT( check_size( m, 0 )) ;
+            for ( int i = 0; i < nMaxCount; ++i )
+                CPPUNIT_ASSERT( !m.find( i )) ;
+        }
+
+        template <class Map>
+        void test()
+        {
+            // default size
+            {
+                Map m ;
+                CPPUNIT_ASSERT( m.capacity() == 128 ) ;
+                test_int( m ) ;
+                test_resize( m ) ;
+            }
+
+            // minimal table, many migrations
+            {
+                Map m( 1 ) ;
+                CPPUNIT_ASSERT( m.capacity() == 16 ) ;
+                test_int( m ) ;
+                test_resize( m ) ;
+            }
+        }
+
+        void LinearProbing_HP()         ;
+        void LinearProbing_HP_stat()    ;
+        void LinearProbing_HP_hash()    ;
+        void LinearProbing_PTB()        ;
+        void LinearProbing_PTB_stat()   ;
+        void LinearProbing_PTB_hash()   ;
+
+        CPPUNIT_TEST_SUITE(LinearProbingMapHdrTest)
+            CPPUNIT_TEST(LinearProbing_HP)
+            CPPUNIT_TEST(LinearProbing_HP_stat)
+            CPPUNIT_TEST(LinearProbing_HP_hash)
+            CPPUNIT_TEST(LinearProbing_PTB)
+            CPPUNIT_TEST(LinearProbing_PTB_stat)
+            CPPUNIT_TEST(LinearProbing_PTB_hash)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+} // namespace map
+
+#endif // #ifndef __CDSTEST_HDR_LINEAR_PROBING_MAP_H
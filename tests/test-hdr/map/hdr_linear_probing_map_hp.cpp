@@ -0,0 +1,46 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "map/hdr_linear_probing_map.h"
+#include <cds/container/linear_probing_map_hp.h>
+
+namespace map {
+
+    void LinearProbingMapHdrTest::LinearProbing_HP()
+    {
+        typedef cc::LinearProbingMap< cds::gc::HP, key_type, value_type > map_type ;
+        test< map_type >() ;
+    }
+
+    void LinearProbingMapHdrTest::LinearProbing_HP_stat()
+    {
+        typedef cc::LinearProbingMap< cds::gc::HP, key_type, value_type,
+            cc::linear_probing_map::make_traits<
+                co::stat< cc::linear_probing_map::stat >
+            >::type
+        > map_type ;
+        test< map_type >() ;
+    }
+
+    void LinearProbingMapHdrTest::LinearProbing_HP_hash()
+    {
+        typedef cc::LinearProbingMap< cds::gc::HP, key_type, value_type,
+            cc::linear_probing_map::make_traits<
+                co::hash< hash_int >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > map_type ;
+        test< map_type >() ;
+    }
+
+} // namespace map
+
+CPPUNIT_TEST_SUITE_REGISTRATION(map::LinearProbingMapHdrTest)    ;
@@ -171,6 +171,48 @@ namespace map {
             }
         };
 
+        // MichaelHashMap with resizable bucket table
+        template <class Map>
+        void test_resizable()
+        {
+            int const nSize = 1000 ;
+            Map m( 8, 1 ) ;
+            CPPUNIT_ASSERT( m.bucket_count() <= 16 ) ;
+
+            for ( int i = 0; i < nSize; ++i ) {
+                CPPUNIT_ASSERT( m.insert( i, i * 2 )) ;
+                CPPUNIT_ASSERT( m.find( i )) ;
+            }
+            CPPUNIT_ASSERT( check_size( m, nSize )) ;
+            CPPUNIT_ASSERT( m.bucket_count() >= 256 ) ;
+            CPPUNIT_ASSERT( !m.insert( nSize / 2 )) ;
+
+            for ( int i = 0; i < nSize; ++i ) {
+                check_value chk( i * 2 ) ;
+                CPPUNIT_ASSERT( m.find( i, cds::ref(chk) )) ;
+            }
+
+            {
+                size_t nCount = 0 ;
+                for ( typename Map::iterator it = m.begin(); it != m.end(); ++it ) {
+                    CPPUNIT_ASSERT( it->second.m_val == it->first * 2 ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == static_cast<size_t>( nSize )) ;
+            }
+
+            for ( int i = 0; i < nSize; i += 2 )
+                CPPUNIT_ASSERT( m.erase( i )) ;
+            for ( int i = 0; i < nSize; ++i )
+                CPPUNIT_ASSERT( m.find( i ) == ((i & 1) != 0) ) ;
+            CPPUNIT_ASSERT( check_size( m, nSize / 2 )) ;
+
+            m.clear() ;
+            CPPUNIT_ASSERT( m.empty() ) ;
+            CPPUNIT_ASSERT( check_size( m, 0 )) ;
+            CPPUNIT_ASSERT( m.begin() == m.end() ) ;
+        }
+
         template <class Map>
         void test_int()
         {
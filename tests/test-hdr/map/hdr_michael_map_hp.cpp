@@ -54,6 +54,17 @@ namespace map {
             >::type
         > opt_map   ;
         test_int< opt_map >()  ;
+
+        // resizable bucket table
+        typedef cc::MichaelHashMap< cds::gc::HP, list,
+            cc::michael_map::make_traits<
+                cc::opt::hash< hash_int >
+                ,cc::opt::item_counter< simple_item_counter >
+                ,cc::michael_map::resizable< true >
+            >::type
+        > resizable_map   ;
+        test_int< resizable_map >()  ;
+        test_resizable< resizable_map >()  ;
     }
 
     void HashMapHdrTest::Michael_HP_less()
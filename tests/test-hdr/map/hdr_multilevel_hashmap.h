@@ -0,0 +1,330 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDSTEST_HDR_MULTILEVEL_HASHMAP_H
+#define __CDSTEST_HDR_MULTILEVEL_HASHMAP_H
+#include "size_check.h"
+
+#include "cppunit/cppunit_proxy.h"
+#include <cds/opt/hash.h>
+#include <cds/ref.h>
+#include <vector>
+#include <algorithm>    // random_shuffle
+
+namespace cds { namespace container {}}
+
+namespace map {
+    using misc::check_size ;
+
+    namespace cc = cds::container   ;
+    namespace co = cds::opt         ;
+
+    // MultiLevelHashMap test: the map searches by the hash value only, so find_with/erase_with are not tested
+    class MultiLevelHashMapHdrTest: public CppUnitMini::TestCase
+    {
+    public:
+        typedef int key_type    ;
+
+        struct value_type {
+            int m_val   ;
+
+            value_type()
+                : m_val(0)
+            {}
+
+            value_type( int n )
+                : m_val( n )
+            {}
+        };
+
+        typedef std::pair<key_type const, value_type> pair_type ;
+
+        // Perfect hash for int: bijection
+        struct hash_int {
+            size_t operator()( int i ) const
+            {
+                return static_cast<size_t>( static_cast<unsigned int>(i) ) * 0x9e3779b1 ;
+            }
+        };
+
+        struct insert_functor
+        {
+            // insert ftor
+            void operator()( pair_type& item )
+            {
+                item.second.m_val = item.first * 3   ;
+            }
+
+            // ensure ftor
+            void operator()( bool bNew, pair_type& item )
+            {
+                if ( bNew )
+                    item.second.m_val = item.first * 2        ;
+                else
+                    item.second.m_val = item.first * 5       ;
+            }
+        };
+
+        struct check_value {
+            int     m_nExpected ;
+
+            check_value( int nExpected )
+                : m_nExpected( nExpected )
+            {}
+
+            void operator ()( pair_type& pair )
+            {
+                CPPUNIT_ASSERT_CURRENT( pair.second.m_val == m_nExpected )  ;
+            }
+        };
+
+        struct extract_functor
+        {
+            int *   m_pVal  ;
+            void operator()( pair_type const& val )
+            {
+                *m_pVal = val.second.m_val   ;
+            }
+        };
+
+        // Lock stub for the iteration test of non-RCU maps
+        // (it has ctor and dtor like RCU scoped_lock so the unused lock object does not produce a warning)
+        struct no_lock {
+            no_lock() {}
+            ~no_lock() {}
+        };
+
+        template <class Map>
+        void test_int( Map& m )
+        {
+            std::pair<bool, bool> ensureResult ;
+
+            // insert
+            CPPUNIT_ASSERT( m.empty() )     ;
+            CPPUNIT_ASSERT( check_size( m, 0 )) ;
+            CPPUNIT_ASSERT( !m.find(25) )   ;
+            CPPUNIT_ASSERT( m.insert( 25 ) )    ;   // value = 0
+            CPPUNIT_ASSERT( m.find(25) )   ;
+            CPPUNIT_ASSERT( !m.empty() ) ;
+            CPPUNIT_ASSERT( check_size( m, 1 )) ;
+
+            CPPUNIT_ASSERT( !m.insert( 25 ) )    ;
+            CPPUNIT_ASSERT( check_size( m, 1 )) ;
+
+            CPPUNIT_ASSERT( !m.find(10) )   ;
+            CPPUNIT_ASSERT( m.insert( 10, 10 ) )    ;
+            CPPUNIT_ASSERT( check_size( m, 2 )) ;
+            CPPUNIT_ASSERT( m.find(10) )   ;
+
+            CPPUNIT_ASSERT( !m.insert( 10, 20 ) )    ;
+            CPPUNIT_ASSERT( check_size( m, 2 )) ;
+
+            CPPUNIT_ASSERT( !m.find(30) )   ;
+            CPPUNIT_ASSERT( m.insert_key( 30, insert_functor() ) )    ; // value = 90
+            CPPUNIT_ASSERT( check_size( m, 3 )) ;
+            CPPUNIT_ASSERT( m.find(30) )   ;
+
+            CPPUNIT_ASSERT( !m.insert_key( 10, insert_functor() ) )    ;
+            CPPUNIT_ASSERT( !m.insert_key( 25, insert_functor() ) )    ;
+            CPPUNIT_ASSERT( !m.insert_key( 30, insert_functor() ) )    ;
+            CPPUNIT_ASSERT( check_size( m, 3 )) ;
+
+            // ensure (new key)
+            CPPUNIT_ASSERT( !m.find(27) )   ;
+            ensureResult = m.ensure( 27, insert_functor() ) ;   // value = 54
+            CPPUNIT_ASSERT( ensureResult.first )    ;
+            CPPUNIT_ASSERT( ensureResult.second )   ;
+            CPPUNIT_ASSERT( m.find(27) )   ;
+
+            // find test
+            check_value chk(10)   ;
+            CPPUNIT_ASSERT( m.find( 10, cds::ref(chk) ))  ;
+            chk.m_nExpected = 0 ;
+            CPPUNIT_ASSERT( m.find( 25, boost::ref(chk) ))  ;
+            chk.m_nExpected = 90 ;
+            CPPUNIT_ASSERT( m.find( 30, boost::ref(chk) ))  ;
+            chk.m_nExpected = 54 ;
+            CPPUNIT_ASSERT( m.find( 27, boost::ref(chk) ))  ;
+
+            ensureResult = m.ensure( 10, insert_functor() ) ;   // value = 50
+            CPPUNIT_ASSERT( ensureResult.first )    ;
+            CPPUNIT_ASSERT( !ensureResult.second )  ;
+            chk.m_nExpected = 50 ;
+            CPPUNIT_ASSERT( m.find( 10, boost::ref(chk) ))  ;
+            CPPUNIT_ASSERT( check_size( m, 4 )) ;
+
+            // erase test
+            CPPUNIT_ASSERT( !m.find(100) )   ;
+            CPPUNIT_ASSERT( !m.erase( 100 ))    ;   // not found
+            CPPUNIT_ASSERT( check_size( m, 4 )) ;
+
+            CPPUNIT_ASSERT( m.find(25) )   ;
+            CPPUNIT_ASSERT( m.erase( 25 ))   ;
+            CPPUNIT_ASSERT( !m.find(25) )   ;
+            CPPUNIT_ASSERT( check_size( m, 3 )) ;
+
+            int nVal    ;
+            extract_functor ext ;
+            ext.m_pVal = &nVal  ;
+
+            CPPUNIT_ASSERT( !m.find(29) )   ;
+            CPPUNIT_ASSERT( !m.erase( 29, boost::ref(ext)))    ;   // not found
+
+            CPPUNIT_ASSERT( m.find(30) )   ;
+            CPPUNIT_ASSERT( m.erase( 30, boost::ref(ext)))   ;
+            CPPUNIT_ASSERT( nVal == 90 )    ;
+            CPPUNIT_ASSERT( !m.find(30) )   ;
+            CPPUNIT_ASSERT( check_size( m, 2 )) ;
+
+            CPPUNIT_ASSERT( m.erase( 27, boost::ref(ext)))   ;
+            CPPUNIT_ASSERT( nVal == 54 )    ;
+            CPPUNIT_ASSERT( check_size( m, 1 )) ;
+
+#       ifdef CDS_EMPLACE_SUPPORT
+            // emplace test
+            CPPUNIT_ASSERT( m.emplace(126) ) ; // key = 126, val = 0
+            CPPUNIT_ASSERT( m.emplace(137, 731))    ;   // key = 137, val = 731
+            CPPUNIT_ASSERT( m.emplace( 149, value_type(941) ))   ;   // key = 149, val = 941
+
+            CPPUNIT_ASSERT( check_size( m, 4 )) ;
+
+            chk.m_nExpected = 0 ;
+            CPPUNIT_ASSERT( m.find( 126, cds::ref(chk) ))  ;
+            chk.m_nExpected = 731 ;
+            CPPUNIT_ASSERT( m.find( 137, cds::ref(chk) ))  ;
+            chk.m_nExpected = 941 ;
+            CPPUNIT_ASSERT( m.find( 149, cds::ref(chk) ))  ;
+
+            CPPUNIT_ASSERT( !m.emplace(126, 621)) ; // already in map
+            chk.m_nExpected = 0 ;
+            CPPUNIT_ASSERT( m.find( 126, cds::ref(chk) ))  ;
+            CPPUNIT_ASSERT( check_size( m, 4 )) ;
+#       endif
+
+            m.clear()   ;
+            CPPUNIT_ASSERT( m.empty() ) ;
+            CPPUNIT_ASSERT( check_size( m, 0 )) ;
+        }
+
+        template <class Map, typename Lock>
+        void test_iter( Map& m )
+        {
+            typedef typename Map::iterator          iterator ;
+            typedef typename Map::const_iterator    const_iterator ;
+
+            const int nMaxCount = 5000   ;
+            {
+                std::vector<int> arr ;
+                arr.reserve( nMaxCount ) ;
+                for ( int i = 0; i < nMaxCount; ++i )
+                    arr.push_back( i ) ;
+                std::random_shuffle( arr.begin(), arr.end() ) ;
+
+                for ( std::vector<int>::const_iterator it = arr.begin(); it != arr.end(); ++it )
+                    CPPUNIT_ASSERT( m.insert( *it, *it * 2 ))   ;
+            }
+            CPPUNIT_ASSERT( check_size( m, nMaxCount )) ;
+
+            {
+                Lock l ;
+                std::vector<bool> visited( nMaxCount, false ) ;
+                int nCount = 0  ;
+                for ( iterator it = m.begin(), itEnd = m.end(); it != itEnd; ++it ) {
+                    CPPUNIT_ASSERT( it->first * 2 == it->second.m_val )    ;
+                    CPPUNIT_ASSERT( (*it).first * 2 == (*it).second.m_val )    ;
+                    CPPUNIT_ASSERT( !visited[ it->first ] ) ;
+                    visited[ it->first ] = true ;
+                    it->second.m_val = it->first   ;
+                    ++nCount    ;
+                }
+                CPPUNIT_ASSERT( nCount == nMaxCount ) ;
+
+                Map const& refMap = m;
+                nCount = 0  ;
+                for ( const_iterator it = refMap.begin(), itEnd = refMap.end(); it != itEnd; ++it ) {
+                    CPPUNIT_ASSERT( it->first == it->second.m_val )    ;
+                    ++nCount    ;
+                }
+                CPPUNIT_ASSERT( nCount == nMaxCount ) ;
+            }
+
+            // The tree is expanded but each item is reachable
+            std::vector< typename Map::level_statistics > levels ;
+            m.get_level_statistics( levels ) ;
+            CPPUNIT_ASSERT( !levels.empty() ) ;
+            size_t nDataCells = 0 ;
+            for ( size_t i = 0; i < levels.size(); ++i )
+                nDataCells += levels[i].data_cell_count ;
+            CPPUNIT_ASSERT( nDataCells == (size_t) nMaxCount ) ;
+
+            for ( int i = 0; i < nMaxCount; i += 2 )
+                CPPUNIT_ASSERT( m.erase( i )) ;
+            CPPUNIT_ASSERT( check_size( m, nMaxCount / 2 )) ;
+            for ( int i = 0; i < nMaxCount; ++i )
+                CPPUNIT_ASSERT( m.find( i ) == ((i & 1) != 0) ) ;
+
+            m.clear() ;
+            CPPUNIT_ASSERT( m.empty() ) ;
+            CPPUNIT_ASSERT( check_size( m, 0 )) ;
+        }
+
+        template <class Map, typename Lock>
+        void test()
+        {
+            // default size
+            {
+                Map m ;
+                CPPUNIT_ASSERT( m.head_size() == 256 ) ;
+                CPPUNIT_ASSERT( m.array_node_size() == 16 ) ;
+                test_int( m ) ;
+                test_iter<Map, Lock>( m ) ;
+            }
+
+            // small arrays, the tree is deep
+            {
+                Map m( 4, 2 ) ;
+                CPPUNIT_ASSERT( m.head_size() == 16 ) ;
+                CPPUNIT_ASSERT( m.array_node_size() == 4 ) ;
+                test_int( m ) ;
+                test_iter<Map, Lock>( m ) ;
+            }
+        }
+
+        void MultiLevel_HP()        ;
+        void MultiLevel_HP_stat()   ;
+        void MultiLevel_HP_hash()   ;
+        void MultiLevel_PTB()       ;
+        void MultiLevel_PTB_stat()  ;
+        void MultiLevel_PTB_hash()  ;
+        void MultiLevel_RCU_GPI()   ;
+        void MultiLevel_RCU_GPB()   ;
+        void MultiLevel_RCU_GPT()   ;
+        void MultiLevel_RCU_SHB()   ;
+        void MultiLevel_RCU_SHT()   ;
+
+        CPPUNIT_TEST_SUITE(MultiLevelHashMapHdrTest)
+            CPPUNIT_TEST(MultiLevel_HP)
+            CPPUNIT_TEST(MultiLevel_HP_stat)
+            CPPUNIT_TEST(MultiLevel_HP_hash)
+            CPPUNIT_TEST(MultiLevel_PTB)
+            CPPUNIT_TEST(MultiLevel_PTB_stat)
+            CPPUNIT_TEST(MultiLevel_PTB_hash)
+            CPPUNIT_TEST(MultiLevel_RCU_GPI)
+            CPPUNIT_TEST(MultiLevel_RCU_GPB)
+            CPPUNIT_TEST(MultiLevel_RCU_GPT)
+            CPPUNIT_TEST(MultiLevel_RCU_SHB)
+            CPPUNIT_TEST(MultiLevel_RCU_SHT)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+} // namespace map
+
+#endif // #ifndef __CDSTEST_HDR_MULTILEVEL_HASHMAP_H
@@ -0,0 +1,44 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "map/hdr_multilevel_hashmap.h"
+#include <cds/container/multilevel_hashmap_ptb.h>
+
+namespace map {
+
+    void MultiLevelHashMapHdrTest::MultiLevel_PTB()
+    {
+        typedef cc::MultiLevelHashMap< cds::gc::PTB, key_type, value_type > map_type ;
+        test< map_type, no_lock >() ;
+    }
+
+    void MultiLevelHashMapHdrTest::MultiLevel_PTB_stat()
+    {
+        typedef cc::MultiLevelHashMap< cds::gc::PTB, key_type, value_type,
+            cc::multilevel_hashmap::make_traits<
+                co::stat< cc::multilevel_hashmap::stat >
+            >::type
+        > map_type ;
+        test< map_type, no_lock >() ;
+    }
+
+    void MultiLevelHashMapHdrTest::MultiLevel_PTB_hash()
+    {
+        typedef cc::MultiLevelHashMap< cds::gc::PTB, key_type, value_type,
+            cc::multilevel_hashmap::make_traits<
+                co::hash< hash_int >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > map_type ;
+        test< map_type, no_lock >() ;
+    }
+
+} // namespace map
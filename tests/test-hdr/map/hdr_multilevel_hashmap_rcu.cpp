@@ -0,0 +1,69 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "map/hdr_multilevel_hashmap.h"
+
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/general_threaded.h>
+#include <cds/urcu/signal_buffered.h>
+#include <cds/urcu/signal_threaded.h>
+#include <cds/container/multilevel_hashmap_rcu.h>
+
+namespace map {
+
+    namespace {
+        template <typename RCU>
+        struct map_of {
+            typedef cc::MultiLevelHashMap< RCU, MultiLevelHashMapHdrTest::key_type, MultiLevelHashMapHdrTest::value_type,
+                typename cc::multilevel_hashmap::make_traits<
+                    co::hash< MultiLevelHashMapHdrTest::hash_int >
+                    ,co::stat< cc::multilevel_hashmap::stat >
+                >::type
+            > type ;
+        };
+    }
+
+    void MultiLevelHashMapHdrTest::MultiLevel_RCU_GPI()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_instant<> > rcu_type ;
+        test< map_of<rcu_type>::type, rcu_type::scoped_lock >() ;
+    }
+
+    void MultiLevelHashMapHdrTest::MultiLevel_RCU_GPB()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> > rcu_type ;
+        test< map_of<rcu_type>::type, rcu_type::scoped_lock >() ;
+    }
+
+    void MultiLevelHashMapHdrTest::MultiLevel_RCU_GPT()
+    {
+        typedef cds::urcu::gc< cds::urcu::general_threaded<> > rcu_type ;
+        test< map_of<rcu_type>::type, rcu_type::scoped_lock >() ;
+    }
+
+    void MultiLevelHashMapHdrTest::MultiLevel_RCU_SHB()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cds::urcu::gc< cds::urcu::signal_buffered<> > rcu_type ;
+        test< map_of<rcu_type>::type, rcu_type::scoped_lock >() ;
+#endif
+    }
+
+    void MultiLevelHashMapHdrTest::MultiLevel_RCU_SHT()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cds::urcu::gc< cds::urcu::signal_threaded<> > rcu_type ;
+        test< map_of<rcu_type>::type, rcu_type::scoped_lock >() ;
+#endif
+    }
+
+} // namespace map
@@ -78,6 +78,19 @@ namespace map {
             test_striped_with(m)    ;
         }
 
+        CPPUNIT_MESSAGE( "load_factor_resizing<0>(1), incremental_resize<true, 2>")   ;
+        {
+            typedef cc::StripedMap< map_t
+                ,co::mutex_policy< cc::striped_set::refinable<> >
+                , co::hash< hash_int >
+                , co::less< less >
+                , co::resizing_policy< cc::striped_set::load_factor_resizing<0> >
+                , cc::striped_set::incremental_resize< true, 2 >
+            >   map_incremental ;
+            map_incremental m( 30, cc::striped_set::load_factor_resizing<0>(1)) ;
+            test_incremental_resize_with( m ) ;
+        }
+
         CPPUNIT_MESSAGE( "load_factor_resizing<256>")   ;
         typedef cc::StripedMap< map_t
             ,co::mutex_policy< cc::striped_set::refinable<> >
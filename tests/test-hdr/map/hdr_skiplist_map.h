@@ -143,6 +143,116 @@ namespace map {
             CPPUNIT_ASSERT( nCount == nLimit ) ;
         }
 
+        template <class Map, typename PrintStat >
+        void test_hp()
+        {
+            test<Map, PrintStat>() ;
+            test_bounds<Map>() ;
+        }
+
+        template <class Map>
+        void test_bounds()
+        {
+            typedef typename Map::guarded_ptr       guarded_ptr ;
+            typedef typename Map::range_cursor      range_cursor ;
+
+            int const nSize = 100 ;
+
+            Map m ;
+            {
+                range_cursor cur( m ) ;
+                CPPUNIT_ASSERT( !cur.first() ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( !m.lower_bound( gp, 0 )) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+            }
+
+            // Keys are 0, 2, 4, ..., 198
+            for ( int i = 0; i < nSize; ++i )
+                CPPUNIT_ASSERT( m.insert( i * 2, i )) ;
+
+            {
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( m.lower_bound( gp, 5 )) ;
+                CPPUNIT_ASSERT( gp->first == 6 ) ;
+                CPPUNIT_ASSERT( gp->second.m_val == 3 ) ;
+                CPPUNIT_ASSERT( m.lower_bound( gp, 6 )) ;
+                CPPUNIT_ASSERT( gp->first == 6 ) ;
+                CPPUNIT_ASSERT( m.upper_bound( gp, 6 )) ;
+                CPPUNIT_ASSERT( gp->first == 8 ) ;
+                CPPUNIT_ASSERT( m.lower_bound_with( gp, 7, less() )) ;
+                CPPUNIT_ASSERT( gp->first == 8 ) ;
+                CPPUNIT_ASSERT( m.upper_bound_with( gp, -1, less() )) ;
+                CPPUNIT_ASSERT( gp->first == 0 ) ;
+                CPPUNIT_ASSERT( !m.upper_bound( gp, nSize * 2 - 2 )) ;
+                CPPUNIT_ASSERT( gp->first == 0 ) ;
+            }
+#       ifdef CDS_MOVE_SEMANTICS_SUPPORT
+            {
+                guarded_ptr gp( m.lower_bound( 11 )) ;
+                CPPUNIT_ASSERT( gp->first == 12 ) ;
+                gp = m.upper_bound_with( 12, less() ) ;
+                CPPUNIT_ASSERT( gp->first == 14 ) ;
+                gp = m.lower_bound( nSize * 2 ) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+            }
+#       endif
+
+            {
+                range_cursor cur( m ) ;
+
+                // Full scan
+                int nCount = 0 ;
+                for ( bool bOk = cur.first(); bOk; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->first == nCount * 2 ) ;
+                    CPPUNIT_ASSERT( (*cur).second.m_val == nCount ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == nSize ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+
+                // Range [11, 31)
+                nCount = 0 ;
+                for ( bool bOk = cur.lower_bound( 11 ); bOk && cur->first < 31; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->first == 12 + nCount * 2 ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == 10 ) ;
+
+                // Range (10, 20]
+                nCount = 0 ;
+                for ( bool bOk = cur.upper_bound_with( 10, less() ); bOk && cur->first <= 20; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->first == 12 + nCount * 2 ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == 5 ) ;
+
+                // The current item and its successor are deleted
+                CPPUNIT_ASSERT( cur.lower_bound_with( 20, less() )) ;
+                CPPUNIT_ASSERT( m.erase( 20 )) ;
+                CPPUNIT_ASSERT( m.erase( 22 )) ;
+                CPPUNIT_ASSERT( cur->first == 20 ) ;
+                CPPUNIT_ASSERT( cur.next() ) ;
+                CPPUNIT_ASSERT( cur->first == 24 ) ;
+
+                // A new successor is inserted
+                CPPUNIT_ASSERT( m.insert( 25 )) ;
+                CPPUNIT_ASSERT( cur.next() ) ;
+                CPPUNIT_ASSERT( cur->first == 25 ) ;
+                CPPUNIT_ASSERT( cur.next() ) ;
+                CPPUNIT_ASSERT( cur->first == 26 ) ;
+
+                CPPUNIT_ASSERT( cur.upper_bound( nSize * 2 - 4 )) ;
+                CPPUNIT_ASSERT( !cur.next() ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+            }
+            CPPUNIT_ASSERT( check_size( m, nSize - 1 )) ;
+
+            m.clear() ;
+            CPPUNIT_ASSERT( m.empty() ) ;
+        }
+
         template <class Map, typename PrintStat >
         void test_nogc()
         {
@@ -297,6 +407,8 @@ namespace map {
         void SkipList_HP_michaelalloc_less_stat()  ;
         void SkipList_HP_michaelalloc_cmp_stat()  ;
         void SkipList_HP_michaelalloc_cmpless_stat()  ;
+        void SkipList_HP_pool_less()  ;
+        void SkipList_HP_pool_michaelalloc_less_stat()  ;
 
         void SkipList_HRC_less()  ;
         void SkipList_HRC_cmp()  ;
@@ -398,6 +510,8 @@ namespace map {
             CPPUNIT_TEST(SkipList_HP_michaelalloc_less_stat)
             CPPUNIT_TEST(SkipList_HP_michaelalloc_cmp_stat)
             CPPUNIT_TEST(SkipList_HP_michaelalloc_cmpless_stat)
+            CPPUNIT_TEST(SkipList_HP_pool_less)
+            CPPUNIT_TEST(SkipList_HP_pool_michaelalloc_less_stat)
 
             CPPUNIT_TEST(SkipList_HRC_less)
             CPPUNIT_TEST(SkipList_HRC_cmp)
@@ -24,7 +24,7 @@ namespace map {
                 ,co::item_counter< simple_item_counter >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_cmp()
@@ -35,7 +35,7 @@ namespace map {
                 ,co::item_counter< simple_item_counter >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_cmpless()
@@ -47,7 +47,7 @@ namespace map {
                 ,co::item_counter< simple_item_counter >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_less_stat()
@@ -59,7 +59,7 @@ namespace map {
                 ,co::stat< cc::skip_list::stat >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_cmp_stat()
@@ -71,7 +71,7 @@ namespace map {
                 ,co::stat< cc::skip_list::stat >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_cmpless_stat()
@@ -84,7 +84,7 @@ namespace map {
                 ,co::stat< cc::skip_list::stat >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_xorshift_less()
@@ -96,7 +96,7 @@ namespace map {
                 ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_xorshift_cmp()
@@ -108,7 +108,7 @@ namespace map {
                 ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_xorshift_cmpless()
@@ -121,7 +121,7 @@ namespace map {
                 ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_xorshift_less_stat()
@@ -134,7 +134,7 @@ namespace map {
                 ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_xorshift_cmp_stat()
@@ -147,7 +147,7 @@ namespace map {
                 ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_xorshift_cmpless_stat()
@@ -161,7 +161,7 @@ namespace map {
                 ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_turbopas_less()
@@ -173,7 +173,7 @@ namespace map {
                 ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_turbopas_cmp()
@@ -185,7 +185,7 @@ namespace map {
                 ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_turbopas_cmpless()
@@ -198,7 +198,7 @@ namespace map {
                 ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_turbopas_less_stat()
@@ -211,7 +211,7 @@ namespace map {
                 ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_turbopas_cmp_stat()
@@ -224,7 +224,7 @@ namespace map {
                 ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_turbopas_cmpless_stat()
@@ -238,7 +238,7 @@ namespace map {
                 ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_michaelalloc_less()
@@ -250,7 +250,7 @@ namespace map {
                 ,co::allocator< memory::MichaelAllocator<int> >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_michaelalloc_cmp()
@@ -262,7 +262,7 @@ namespace map {
                     ,co::allocator< memory::MichaelAllocator<int> >
                 >::type
             > set ;
-            test< set, misc::print_skiplist_stat<set::stat> >() ;
+            test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_michaelalloc_cmpless()
@@ -275,7 +275,7 @@ namespace map {
                 ,co::allocator< memory::MichaelAllocator<int> >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_michaelalloc_less_stat()
@@ -288,7 +288,7 @@ namespace map {
                 ,co::allocator< memory::MichaelAllocator<int> >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_michaelalloc_cmp_stat()
@@ -301,7 +301,7 @@ namespace map {
                 ,co::allocator< memory::MichaelAllocator<int> >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListMapHdrTest::SkipList_PTB_michaelalloc_cmpless_stat()
@@ -315,6 +315,6 @@ namespace map {
                 ,co::allocator< memory::MichaelAllocator<int> >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 } // namespace map
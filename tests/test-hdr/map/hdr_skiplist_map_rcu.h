@@ -158,6 +158,83 @@ namespace map {
                 }
             }
             CPPUNIT_ASSERT( nCount == nLimit ) ;
+
+            test_bounds<Map>() ;
+        }
+
+        template <class Map>
+        void test_bounds()
+        {
+            typedef typename Map::gc::scoped_lock   rcu_lock ;
+            typedef typename Map::value_type        value_type  ;
+            typedef typename Map::range_cursor      range_cursor ;
+
+            int const nSize = 100 ;
+
+            Map m ;
+            {
+                rcu_lock l ;
+                range_cursor cur( m ) ;
+                CPPUNIT_ASSERT( !cur.first() ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+                CPPUNIT_ASSERT( m.lower_bound( 0 ) == NULL ) ;
+            }
+
+            // Keys are 0, 2, 4, ..., 198
+            for ( int i = 0; i < nSize; ++i )
+                CPPUNIT_ASSERT( m.insert( i * 2, i )) ;
+
+            {
+                rcu_lock l ;
+                value_type * p ;
+                p = m.lower_bound( 5 ) ;
+                CPPUNIT_ASSERT( p && p->first == 6 && p->second.m_val == 3 ) ;
+                p = m.upper_bound( 6 ) ;
+                CPPUNIT_ASSERT( p && p->first == 8 ) ;
+                p = m.lower_bound_with( 7, less() ) ;
+                CPPUNIT_ASSERT( p && p->first == 8 ) ;
+                p = m.upper_bound_with( -1, less() ) ;
+                CPPUNIT_ASSERT( p && p->first == 0 ) ;
+                CPPUNIT_ASSERT( m.upper_bound( nSize * 2 - 2 ) == NULL ) ;
+            }
+
+            {
+                rcu_lock l ;
+                range_cursor cur( m ) ;
+
+                // Full scan
+                int nCount = 0 ;
+                for ( bool bOk = cur.first(); bOk; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->first == nCount * 2 ) ;
+                    CPPUNIT_ASSERT( (*cur).second.m_val == nCount ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == nSize ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+
+                // Range [11, 31)
+                nCount = 0 ;
+                for ( bool bOk = cur.lower_bound( 11 ); bOk && cur->first < 31; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->first == 12 + nCount * 2 ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == 10 ) ;
+
+                // Range (10, 20]
+                nCount = 0 ;
+                for ( bool bOk = cur.upper_bound_with( 10, less() ); bOk && cur->first <= 20; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->first == 12 + nCount * 2 ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == 5 ) ;
+
+                CPPUNIT_ASSERT( cur.upper_bound( nSize * 2 - 4 )) ;
+                CPPUNIT_ASSERT( !cur.next() ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+            }
+
+            m.clear() ;
+            CPPUNIT_ASSERT( m.empty() ) ;
         }
 
     public:
@@ -63,6 +63,15 @@ namespace map {
         >   map_spin ;
         test_striped< map_spin >()    ;
 
+        // Reader-writer lock striping
+        CPPUNIT_MESSAGE( "rw_striping") ;
+        typedef cc::StripedMap< map_t
+            , co::hash< hash_int >
+            , co::less< less >
+            ,co::mutex_policy< cc::striped_set::rw_striping<> >
+        >   map_rw ;
+        test_striped< map_rw >()    ;
+
         // Resizing policy
         CPPUNIT_MESSAGE( "load_factor_resizing<0>(1024)") ;
         {
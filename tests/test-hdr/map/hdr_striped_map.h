@@ -542,6 +542,34 @@ namespace map {
             CPPUNIT_MSG( "   Duration=" << timer.duration() ) ;
         }
 
+        // Checks that no item is lost while the buckets are migrated
+        template <class Map>
+        void test_incremental_resize_with( Map& m )
+        {
+            size_t const nCount = 10000 ;
+            size_t const nBucketCount = m.bucket_count() ;
+
+            for ( size_t i = 0; i < nCount; ++i ) {
+                CPPUNIT_ASSERT( m.insert( (int) i )) ;
+                CPPUNIT_ASSERT( m.find( (int) i / 2 )) ;
+            }
+            CPPUNIT_ASSERT( m.bucket_count() > nBucketCount ) ;
+            CPPUNIT_ASSERT( check_size( m, nCount )) ;
+
+            for ( size_t i = 0; i < nCount; ++i )
+                CPPUNIT_ASSERT( m.find( (int) i )) ;
+            for ( size_t i = 0; i < nCount; i += 2 )
+                CPPUNIT_ASSERT( m.erase( (int) i )) ;
+            for ( size_t i = 0; i < nCount; ++i )
+                CPPUNIT_ASSERT( m.find( (int) i ) == ((i & 1) != 0) ) ;
+            CPPUNIT_ASSERT( check_size( m, nCount / 2 )) ;
+
+            m.clear() ;
+            CPPUNIT_ASSERT( m.empty() ) ;
+            for ( size_t i = 0; i < nCount; ++i )
+                CPPUNIT_ASSERT( !m.find( (int) i )) ;
+        }
+
 #ifndef CDS_CXX11_DEFAULT_FUNCTION_TEMPLATE_ARGS_SUPPORT
         template <class Map>
         void test_striped2()
@@ -568,6 +596,7 @@ namespace map {
         void Striped_boost_flat_map() ;
         void Striped_boost_map() ;
         void Striped_boost_unordered_map() ;
+        void Striped_flat_bucket() ;
 
         void Refinable_hashmap()  ;
         void Refinable_list() ;
@@ -577,6 +606,7 @@ namespace map {
         void Refinable_boost_flat_map() ;
         void Refinable_boost_map() ;
         void Refinable_boost_unordered_map() ;
+        void Refinable_flat_bucket() ;
 
         CPPUNIT_TEST_SUITE(StripedMapHdrTest)
             CPPUNIT_TEST(Striped_hashmap)
@@ -587,6 +617,7 @@ namespace map {
             CPPUNIT_TEST(Striped_boost_flat_map)
             CPPUNIT_TEST(Striped_boost_map)
             CPPUNIT_TEST(Striped_boost_unordered_map)
+            CPPUNIT_TEST(Striped_flat_bucket)
 
             CPPUNIT_TEST(Refinable_hashmap)
             CPPUNIT_TEST(Refinable_list)
@@ -596,6 +627,7 @@ namespace map {
             CPPUNIT_TEST(Refinable_boost_flat_map)
             CPPUNIT_TEST(Refinable_boost_map)
             CPPUNIT_TEST(Refinable_boost_unordered_map)
+            CPPUNIT_TEST(Refinable_flat_bucket)
         CPPUNIT_TEST_SUITE_END()
 
     };
@@ -0,0 +1,203 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "cppunit/thread.h"
+#include <cds/gc/ebr.h>
+#include <cds/threading/model.h>
+#include <cds/os/thread.h>
+
+// Epoch-based GC reclamation test:
+// the retired node is not freed while other thread holds a guard (is in the critical section)
+// and is freed after two epoch advances when the guard is released
+
+namespace {
+    static size_t s_nPassCount = 100 ;
+}
+
+class ebr_retire: public CppUnitMini::TestCase
+{
+    typedef cds::gc::ebr::GarbageCollector  ebr_gc ;
+
+    struct item {
+        CDS_ATOMIC::atomic<bool> *  pFreed ;
+    };
+
+    struct item_disposer {
+        void operator()( item * p )
+        {
+            p->pFreed->store( true, CDS_ATOMIC::memory_order_release ) ;
+            delete p ;
+        }
+    };
+
+    // Test stages
+    enum {
+        stage_start,
+        stage_guarded,      // the reader holds the guard
+        stage_checked,      // the reclaimer has checked the node is not freed
+        stage_released,     // the reader has released the guard
+        stage_done
+    };
+
+    CDS_ATOMIC::atomic<int>     m_nStage    ;
+    CDS_ATOMIC::atomic<bool>    m_bFreed    ;
+
+    void wait_stage( int nStage )
+    {
+        while ( m_nStage.load( CDS_ATOMIC::memory_order_acquire ) != nStage )
+            cds::OS::yield() ;
+    }
+
+    void set_stage( int nStage )
+    {
+        m_nStage.store( nStage, CDS_ATOMIC::memory_order_release ) ;
+    }
+
+    static size_t global_epoch()
+    {
+        ebr_gc::InternalState stat ;
+        return ebr_gc::instance().getInternalState( stat ).nGlobalEpoch ;
+    }
+
+    class Thread: public CppUnitMini::TestThread
+    {
+    public:
+        Thread( CppUnitMini::ThreadPool& pool )
+            : CppUnitMini::TestThread( pool )
+        {}
+        Thread( Thread& src )
+            : CppUnitMini::TestThread( src )
+        {}
+
+        ebr_retire&  getTest()
+        {
+            return reinterpret_cast<ebr_retire&>( m_Pool.m_Test )   ;
+        }
+
+        virtual void init()
+        {
+            cds::threading::Manager::attachThread() ;
+        }
+        virtual void fini()
+        {
+            cds::threading::Manager::detachThread() ;
+        }
+    };
+
+    class ReaderThread: public Thread
+    {
+        virtual TestThread *    clone()
+        {
+            return new ReaderThread( *this )  ;
+        }
+    public:
+        ReaderThread( CppUnitMini::ThreadPool& pool )
+            : Thread( pool )
+        {}
+        ReaderThread( ReaderThread& src )
+            : Thread( src )
+        {}
+
+        virtual void test()
+        {
+            ebr_retire& t = getTest() ;
+            for ( size_t nPass = 0; nPass < s_nPassCount; ++nPass ) {
+                t.wait_stage( stage_start ) ;
+                {
+                    cds::gc::EBR::Guard guard ;
+                    t.set_stage( stage_guarded ) ;
+                    t.wait_stage( stage_checked ) ;
+                }
+                t.set_stage( stage_released ) ;
+                t.wait_stage( stage_done ) ;
+                t.set_stage( stage_start ) ;
+            }
+        }
+    };
+
+    class ReclaimerThread: public Thread
+    {
+        virtual TestThread *    clone()
+        {
+            return new ReclaimerThread( *this )  ;
+        }
+    public:
+        ReclaimerThread( CppUnitMini::ThreadPool& pool )
+            : Thread( pool )
+        {}
+        ReclaimerThread( ReclaimerThread& src )
+            : Thread( src )
+        {}
+
+        virtual void test()
+        {
+            ebr_retire& t = getTest() ;
+            for ( size_t nPass = 0; nPass < s_nPassCount; ++nPass ) {
+                t.wait_stage( stage_guarded ) ;
+
+                t.m_bFreed.store( false, CDS_ATOMIC::memory_order_relaxed ) ;
+                item * p = new item ;
+                p->pFreed = &t.m_bFreed ;
+
+                size_t const nRetireEpoch = global_epoch() ;
+                cds::gc::EBR::retire<item_disposer>( p ) ;
+
+                // The reader is in the critical section: the epoch can be advanced once at most
+                for ( int i = 0; i < 8; ++i ) {
+                    cds::gc::EBR::scan() ;
+                    CPPUNIT_ASSERT( !t.m_bFreed.load( CDS_ATOMIC::memory_order_acquire )) ;
+                }
+                CPPUNIT_ASSERT( global_epoch() <= nRetireEpoch + 1 ) ;
+                t.set_stage( stage_checked ) ;
+
+                t.wait_stage( stage_released ) ;
+
+                // The node is freed when the global epoch reaches retire epoch + 2
+                for ( int i = 0; i < 8 && !t.m_bFreed.load( CDS_ATOMIC::memory_order_acquire ); ++i ) {
+                    CPPUNIT_ASSERT( global_epoch() < nRetireEpoch + 2 ) ;
+                    cds::gc::EBR::scan() ;
+                }
+                CPPUNIT_ASSERT( t.m_bFreed.load( CDS_ATOMIC::memory_order_acquire )) ;
+                CPPUNIT_ASSERT( global_epoch() == nRetireEpoch + 2 ) ;
+
+                t.set_stage( stage_done ) ;
+            }
+        }
+    };
+
+protected:
+    void retire_guarded()
+    {
+        CPPUNIT_MSG( "EBR retire test, pass count=" << s_nPassCount << "..." )   ;
+
+        m_nStage.store( stage_start, CDS_ATOMIC::memory_order_relaxed ) ;
+        m_bFreed.store( false, CDS_ATOMIC::memory_order_relaxed ) ;
+
+        CppUnitMini::ThreadPool pool( *this )   ;
+        pool.add( new ReaderThread( pool ), 1 )     ;
+        pool.add( new ReclaimerThread( pool ), 1 )  ;
+
+        cds::OS::Timer    timer    ;
+        timer.reset()   ;
+        pool.run()  ;
+        CPPUNIT_MSG( "   Duration=" << timer.duration() ) ;
+    }
+
+    void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+        s_nPassCount = cfg.getULong("PassCount", 100 );
+    }
+
+    CPPUNIT_TEST_SUITE(ebr_retire)
+        CPPUNIT_TEST(retire_guarded)  ;
+    CPPUNIT_TEST_SUITE_END();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(ebr_retire);
@@ -0,0 +1,184 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "cppunit/thread.h"
+#include <cds/gc/hp.h>
+#include <cds/threading/model.h>
+
+// Stress test of dynamic HP record pool of gc::HP (HZP_dynamic_hprec=1):
+// the threads attaching/detaching repeatedly remove their HP records from HP list
+// while the scanner threads traverse the list continuously.
+// The removed records must be deleted eventually.
+
+namespace {
+    static size_t s_nScanThreadCount = 4  ;
+    static size_t s_nChurnThreadCount = 4 ;
+    static size_t s_nPassCount = 100000  ;
+}
+
+class hzp_dynamic_hprec: public CppUnitMini::TestCase
+{
+    struct item {
+        size_t  nValue ;
+    };
+
+    struct item_disposer {
+        void operator()( item * p )
+        {
+            delete p ;
+        }
+    };
+
+    typedef cds::gc::hzp::GarbageCollector  hzp_gc ;
+
+    class ScanThread: public CppUnitMini::TestThread
+    {
+        virtual TestThread *    clone()
+        {
+            return new ScanThread( *this )  ;
+        }
+
+    public:
+        ScanThread( CppUnitMini::ThreadPool& pool )
+            : CppUnitMini::TestThread( pool )
+        {}
+        ScanThread( ScanThread& src )
+            : CppUnitMini::TestThread( src )
+        {}
+
+        virtual void init()
+        {
+            cds::threading::Manager::attachThread() ;
+        }
+        virtual void fini()
+        {
+            cds::threading::Manager::detachThread() ;
+        }
+
+        virtual void test()
+        {
+            cds::gc::HP::Guard  guard ;
+            for ( size_t i = 0; i < s_nPassCount; ++i ) {
+                item * p = new item ;
+                p->nValue = i ;
+                guard.assign( p ) ;
+                cds::gc::HP::retire<item_disposer>( p ) ;
+                guard.clear() ;
+                if ( (i & 0xF) == 0 )
+                    cds::gc::HP::scan() ;
+            }
+        }
+    };
+
+    class ChurnThread: public CppUnitMini::TestThread
+    {
+        virtual TestThread *    clone()
+        {
+            return new ChurnThread( *this )  ;
+        }
+
+    public:
+        size_t  m_nMaxRemoved   ;
+
+    public:
+        ChurnThread( CppUnitMini::ThreadPool& pool )
+            : CppUnitMini::TestThread( pool )
+            , m_nMaxRemoved( 0 )
+        {}
+        ChurnThread( ChurnThread& src )
+            : CppUnitMini::TestThread( src )
+            , m_nMaxRemoved( 0 )
+        {}
+
+        virtual void init()
+        {}
+        virtual void fini()
+        {}
+
+        virtual void test()
+        {
+            size_t const nPassCount = s_nPassCount / 16 ;
+            for ( size_t i = 0; i < nPassCount; ++i ) {
+                cds::threading::Manager::attachThread() ;
+                item * p = new item ;
+                p->nValue = i ;
+                cds::gc::HP::retire<item_disposer>( p ) ;
+                cds::threading::Manager::detachThread() ;
+
+                if ( (i & 0xFF) == 0 ) {
+                    hzp_gc::InternalState stat ;
+                    hzp_gc::instance().getInternalState( stat ) ;
+                    if ( stat.nRemovedHPRecs > m_nMaxRemoved )
+                        m_nMaxRemoved = stat.nRemovedHPRecs ;
+                }
+            }
+        }
+    };
+
+protected:
+    void dynamic_hprec()
+    {
+        if ( !hzp_gc::instance().isDynamicHPRec() ) {
+            CPPUNIT_MSG( "Dynamic HP record pool stress test is skipped: HZP_dynamic_hprec is off" ) ;
+            return ;
+        }
+
+        CPPUNIT_MSG( "Dynamic HP record pool stress test,\n    scan thread count=" << s_nScanThreadCount
+            << " churn thread count=" << s_nChurnThreadCount
+            << " pass count=" << s_nPassCount << "..." )   ;
+
+        hzp_gc::InternalState statBefore ;
+        hzp_gc::instance().getInternalState( statBefore ) ;
+
+        CppUnitMini::ThreadPool pool( *this )   ;
+        pool.add( new ScanThread( pool ), s_nScanThreadCount )       ;
+        pool.add( new ChurnThread( pool ), s_nChurnThreadCount )     ;
+
+        cds::OS::Timer    timer    ;
+        timer.reset()   ;
+        pool.run()  ;
+        CPPUNIT_MSG( "   Duration=" << timer.duration() ) ;
+
+        size_t nMaxRemoved = 0 ;
+        for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+            ChurnThread * pThread = dynamic_cast<ChurnThread *>( *it ) ;
+            if ( pThread && pThread->m_nMaxRemoved > nMaxRemoved )
+                nMaxRemoved = pThread->m_nMaxRemoved ;
+        }
+
+        hzp_gc::InternalState stat ;
+        hzp_gc::instance().getInternalState( stat ) ;
+        CPPUNIT_MSG( "   HP records removed=" << (stat.evcRemoveHPRec - statBefore.evcRemoveHPRec)
+            << ", deleted=" << (stat.evcDeleteHPRec - statBefore.evcDeleteHPRec)
+            << ", waiting for deletion: max=" << nMaxRemoved << " at the end=" << stat.nRemovedHPRecs ) ;
+
+        // The records are deleted while the scanner threads traverse HP list
+        CPPUNIT_ASSERT( stat.evcRemoveHPRec > statBefore.evcRemoveHPRec ) ;
+        CPPUNIT_ASSERT( stat.evcDeleteHPRec > statBefore.evcDeleteHPRec ) ;
+
+        // Nobody traverses HP list now, so the scan of the main thread deletes all removed records
+        cds::gc::HP::scan() ;
+        hzp_gc::instance().getInternalState( stat ) ;
+        CPPUNIT_ASSERT_EX( stat.nRemovedHPRecs == 0, "removed HP records=" << stat.nRemovedHPRecs ) ;
+    }
+
+    void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+        s_nScanThreadCount = cfg.getULong("ScanThreadCount", 4 ) ;
+        s_nChurnThreadCount = cfg.getULong("ChurnThreadCount", 4 ) ;
+        s_nPassCount = cfg.getULong("PassCount", 100000 );
+    }
+
+    CPPUNIT_TEST_SUITE(hzp_dynamic_hprec)
+        CPPUNIT_TEST(dynamic_hprec)  ;
+    CPPUNIT_TEST_SUITE_END();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(hzp_dynamic_hprec);
@@ -0,0 +1,368 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "cppunit/thread.h"
+#include <cds/container/striped_set/std_list.h>
+#include <cds/container/striped_set.h>
+#include <cds/container/striped_map/std_map.h>
+#include <cds/container/striped_map.h>
+#include <cds/opt/hash.h>
+#include <cds/os/thread.h>
+#include <cds/os/timer.h>
+#include <cds/ref.h>
+
+// Multi-threaded test of StripedSet/StripedMap with striped_set::rw_striping mutex policy:
+//  - the lookups of the same key own the cell lock in shared mode at the same time;
+//  - the lookups see consistent items while other threads insert and erase items
+//    under the exclusive cell lock and resize the container under the full lock.
+
+namespace {
+    static size_t s_nReaderThreadCount = 4  ;
+    static size_t s_nWriterThreadCount = 2  ;
+    static size_t s_nKeyCount = 1000        ;
+    static size_t s_nPassCount = 100        ;
+    static size_t s_nOverlapTimeout = 10    ;   // seconds
+}
+
+class striped_rw_lookup: public CppUnitMini::TestCase
+{
+    struct item {
+        int     nKey    ;
+        int     nVal    ;
+
+        item( int key )
+            : nKey( key )
+            , nVal( key * 2 )
+        {}
+    };
+
+    struct less {
+        bool operator()( item const& i1, item const& i2 ) const { return i1.nKey < i2.nKey ; }
+        bool operator()( item const& i, int k ) const { return i.nKey < k ; }
+        bool operator()( int k, item const& i ) const { return k < i.nKey ; }
+        bool operator()( int k1, int k2 ) const { return k1 < k2 ; }
+    };
+
+    struct hash_int {
+        size_t operator()( int k ) const { return cds::opt::v::hash<int>()( k ) ; }
+        size_t operator()( item const& i ) const { return (*this)( i.nKey ) ; }
+    };
+
+    typedef cds::container::StripedSet< std::list<item>
+        , cds::opt::hash< hash_int >
+        , cds::opt::less< less >
+        , cds::opt::mutex_policy< cds::container::striped_set::rw_striping<> >
+    > set_type ;
+
+    // std::map buckets are not resized by default
+    typedef cds::container::StripedMap< std::map<int, int>
+        , cds::opt::hash< hash_int >
+        , cds::opt::less< less >
+        , cds::opt::mutex_policy< cds::container::striped_set::rw_striping<> >
+        , cds::opt::resizing_policy< cds::container::striped_set::load_factor_resizing<4> >
+    > map_type ;
+
+    // Find functor for set and map: checks the item found is consistent
+    struct check_functor {
+        size_t  nFound  ;
+        size_t  nBad    ;
+
+        check_functor()
+            : nFound( 0 )
+            , nBad( 0 )
+        {}
+
+        void check( int nKey, int nVal )
+        {
+            ++nFound ;
+            if ( nVal != nKey * 2 )
+                ++nBad ;
+        }
+
+        template <typename Q>
+        void operator()( item& i, Q const& )
+        {
+            check( i.nKey, i.nVal ) ;
+        }
+        void operator()( std::pair<int const, int>& p )
+        {
+            check( p.first, p.second ) ;
+        }
+    };
+
+    // Find functor of overlap test: holds the cell lock until all readers are inside
+    struct overlap_functor {
+        striped_rw_lookup&  m_Test  ;
+
+        overlap_functor( striped_rw_lookup& t )
+            : m_Test( t )
+        {}
+
+        void wait()
+        {
+            m_Test.m_nInside.fetch_add( 1, CDS_ATOMIC::memory_order_acq_rel ) ;
+            m_Test.m_nArrived.fetch_add( 1, CDS_ATOMIC::memory_order_acq_rel ) ;
+            cds::OS::Timer timer ;
+            while ( m_Test.m_nArrived.load( CDS_ATOMIC::memory_order_acquire ) < s_nReaderThreadCount
+                && timer.duration() < s_nOverlapTimeout )
+            {
+                cds::OS::yield() ;
+            }
+            size_t nInside = m_Test.m_nInside.load( CDS_ATOMIC::memory_order_acquire ) ;
+            size_t nMax = m_Test.m_nMaxInside.load( CDS_ATOMIC::memory_order_relaxed ) ;
+            while ( nInside > nMax && !m_Test.m_nMaxInside.compare_exchange_weak( nMax, nInside, CDS_ATOMIC::memory_order_relaxed, CDS_ATOMIC::memory_order_relaxed )) ;
+            m_Test.m_nInside.fetch_sub( 1, CDS_ATOMIC::memory_order_acq_rel ) ;
+        }
+
+        template <typename Q>
+        void operator()( item&, Q const& )
+        {
+            wait() ;
+        }
+        void operator()( std::pair<int const, int>& )
+        {
+            wait() ;
+        }
+    };
+
+    CDS_ATOMIC::atomic<size_t>  m_nInside       ;   // readers inside find() now
+    CDS_ATOMIC::atomic<size_t>  m_nArrived      ;   // readers entered find() so far
+    CDS_ATOMIC::atomic<size_t>  m_nMaxInside    ;
+
+    template <class Container>
+    class OverlapThread: public CppUnitMini::TestThread
+    {
+        virtual TestThread *    clone()
+        {
+            return new OverlapThread( *this )  ;
+        }
+    public:
+        Container&  m_Cont  ;
+
+    public:
+        OverlapThread( CppUnitMini::ThreadPool& pool, Container& c )
+            : CppUnitMini::TestThread( pool )
+            , m_Cont( c )
+        {}
+        OverlapThread( OverlapThread& src )
+            : CppUnitMini::TestThread( src )
+            , m_Cont( src.m_Cont )
+        {}
+
+        striped_rw_lookup&  getTest()
+        {
+            return reinterpret_cast<striped_rw_lookup&>( m_Pool.m_Test )   ;
+        }
+
+        virtual void init()
+        {}
+        virtual void fini()
+        {}
+
+        virtual void test()
+        {
+            overlap_functor f( getTest() ) ;
+            CPPUNIT_ASSERT( m_Cont.find( 0, cds::ref(f) )) ;
+        }
+    };
+
+    template <class Container>
+    class ReaderThread: public CppUnitMini::TestThread
+    {
+        virtual TestThread *    clone()
+        {
+            return new ReaderThread( *this )  ;
+        }
+    public:
+        Container&  m_Cont      ;
+        size_t      m_nFound    ;
+        size_t      m_nBad      ;
+
+    public:
+        ReaderThread( CppUnitMini::ThreadPool& pool, Container& c )
+            : CppUnitMini::TestThread( pool )
+            , m_Cont( c )
+        {}
+        ReaderThread( ReaderThread& src )
+            : CppUnitMini::TestThread( src )
+            , m_Cont( src.m_Cont )
+        {}
+
+        virtual void init()
+        {
+            m_nFound =
+                m_nBad = 0 ;
+        }
+        virtual void fini()
+        {}
+
+        virtual void test()
+        {
+            check_functor f ;
+            for ( size_t nPass = 0; nPass < s_nPassCount; ++nPass ) {
+                for ( int nKey = 0; nKey < (int) s_nKeyCount; ++nKey ) {
+                    // The even keys are never erased
+                    bool bFound = m_Cont.find( nKey, cds::ref(f) ) ;
+                    if ( (nKey & 1) == 0 )
+                        CPPUNIT_ASSERT( bFound ) ;
+                }
+            }
+            m_nFound = f.nFound ;
+            m_nBad = f.nBad ;
+        }
+    };
+
+    template <class Container>
+    class WriterThread: public CppUnitMini::TestThread
+    {
+        virtual TestThread *    clone()
+        {
+            return new WriterThread( *this )  ;
+        }
+    public:
+        Container&  m_Cont      ;
+
+    public:
+        WriterThread( CppUnitMini::ThreadPool& pool, Container& c )
+            : CppUnitMini::TestThread( pool )
+            , m_Cont( c )
+        {}
+        WriterThread( WriterThread& src )
+            : CppUnitMini::TestThread( src )
+            , m_Cont( src.m_Cont )
+        {}
+
+        virtual void init()
+        {}
+        virtual void fini()
+        {}
+
+        virtual void test()
+        {
+            // Each writer inserts and erases its own odd keys
+            int const nStep = (int) s_nWriterThreadCount * 2 ;
+            int const nFirst = (int) (m_nThreadNo - s_nReaderThreadCount) * 2 + 1 ;
+            for ( size_t nPass = 0; nPass < s_nPassCount; ++nPass ) {
+                for ( int nKey = nFirst; nKey < (int) s_nKeyCount; nKey += nStep )
+                    CPPUNIT_ASSERT( insert( m_Cont, nKey )) ;
+                for ( int nKey = nFirst; nKey < (int) s_nKeyCount; nKey += nStep )
+                    CPPUNIT_ASSERT( m_Cont.erase( nKey )) ;
+            }
+        }
+    };
+
+    static bool insert( set_type& s, int nKey )
+    {
+        return s.insert( nKey ) ;
+    }
+    static bool insert( map_type& m, int nKey )
+    {
+        return m.insert( nKey, nKey * 2 ) ;
+    }
+
+    template <class Container>
+    void test_overlap( Container& c )
+    {
+        CPPUNIT_MSG( "   Lookup overlap test, reader count=" << s_nReaderThreadCount << "..." ) ;
+
+        m_nInside.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+        m_nArrived.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+        m_nMaxInside.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+        CPPUNIT_ASSERT( insert( c, 0 )) ;
+
+        CppUnitMini::ThreadPool pool( *this )   ;
+        pool.add( new OverlapThread<Container>( pool, c ), s_nReaderThreadCount )  ;
+        pool.run()  ;
+
+        // All readers were inside find() for the same key at the same time
+        CPPUNIT_ASSERT_EX( m_nMaxInside.load( CDS_ATOMIC::memory_order_relaxed ) == s_nReaderThreadCount,
+            "Expected=" << s_nReaderThreadCount << " real=" << m_nMaxInside.load( CDS_ATOMIC::memory_order_relaxed )) ;
+
+        CPPUNIT_ASSERT( c.erase( 0 )) ;
+        CPPUNIT_ASSERT( c.empty() ) ;
+    }
+
+    template <class Container>
+    void test_find_modify( Container& c )
+    {
+        CPPUNIT_MSG( "   Find/modify test, reader count=" << s_nReaderThreadCount
+            << " writer count=" << s_nWriterThreadCount
+            << " key count=" << s_nKeyCount
+            << " pass count=" << s_nPassCount << "..." ) ;
+
+        for ( int nKey = 0; nKey < (int) s_nKeyCount; nKey += 2 )
+            CPPUNIT_ASSERT( insert( c, nKey )) ;
+        size_t const nEvenCount = c.size() ;
+        size_t const nBucketCount = c.bucket_count() ;
+
+        CppUnitMini::ThreadPool pool( *this )   ;
+        // The writers are numbered after the readers
+        pool.add( new ReaderThread<Container>( pool, c ), s_nReaderThreadCount )  ;
+        pool.add( new WriterThread<Container>( pool, c ), s_nWriterThreadCount )  ;
+
+        cds::OS::Timer    timer    ;
+        pool.run()  ;
+        CPPUNIT_MSG( "     Duration=" << timer.duration() ) ;
+
+        size_t nFound = 0 ;
+        size_t nBad = 0 ;
+        for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+            ReaderThread<Container> * pThread = dynamic_cast<ReaderThread<Container> *>( *it ) ;
+            if ( pThread ) {
+                nFound += pThread->m_nFound ;
+                nBad += pThread->m_nBad ;
+            }
+        }
+        CPPUNIT_MSG( "     Found=" << nFound << ", bucket count: before=" << nBucketCount << " after=" << c.bucket_count() ) ;
+
+        CPPUNIT_ASSERT( nFound >= nEvenCount * s_nReaderThreadCount * s_nPassCount ) ;
+        CPPUNIT_ASSERT_EX( nBad == 0, "inconsistent items found=" << nBad ) ;
+        CPPUNIT_ASSERT( c.size() == nEvenCount ) ;
+
+        c.clear() ;
+        CPPUNIT_ASSERT( c.empty() ) ;
+    }
+
+protected:
+    void rw_striping_set()
+    {
+        set_type s( 16 ) ;
+        test_overlap( s ) ;
+        test_find_modify( s ) ;
+    }
+
+    void rw_striping_map()
+    {
+        map_type m( 16 ) ;
+        test_overlap( m ) ;
+        test_find_modify( m ) ;
+    }
+
+    void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+        s_nReaderThreadCount = cfg.getULong("ReaderThreadCount", 4 ) ;
+        s_nWriterThreadCount = cfg.getULong("WriterThreadCount", 2 ) ;
+        s_nKeyCount = cfg.getULong("KeyCount", 1000 ) ;
+        s_nPassCount = cfg.getULong("PassCount", 100 ) ;
+        s_nOverlapTimeout = cfg.getULong("OverlapTimeout", 10 ) ;
+
+        if ( s_nReaderThreadCount < 2 )
+            s_nReaderThreadCount = 2 ;
+        if ( s_nWriterThreadCount == 0 )
+            s_nWriterThreadCount = 1 ;
+    }
+
+    CPPUNIT_TEST_SUITE(striped_rw_lookup)
+        CPPUNIT_TEST(rw_striping_set)  ;
+        CPPUNIT_TEST(rw_striping_map)  ;
+    CPPUNIT_TEST_SUITE_END();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(striped_rw_lookup);
@@ -433,6 +433,92 @@ namespace ordlist {
             CPPUNIT_ASSERT( v3.s.nDisposeCount == 4 ) ;
         }
 
+        template <class OrdList>
+        void test_hp_int()
+        {
+            test_int<OrdList>() ;
+
+            // get() / extract() tests
+            typedef typename OrdList::value_type    value_type  ;
+            typedef typename OrdList::guarded_ptr   guarded_ptr ;
+
+            value_type v1( 10, 50 ) ;
+            value_type v2( 5, 25  ) ;
+            value_type v3( 20, 100 );
+            {
+                OrdList l   ;
+                CPPUNIT_ASSERT( l.insert( v1 )) ;
+                CPPUNIT_ASSERT( l.insert( v2 )) ;
+                CPPUNIT_ASSERT( l.insert( v3 )) ;
+
+                {
+                    guarded_ptr gp ;
+                    CPPUNIT_ASSERT( gp.empty() ) ;
+                    CPPUNIT_ASSERT( l.get( gp, v1.key() )) ;
+                    CPPUNIT_ASSERT( !gp.empty() ) ;
+                    CPPUNIT_ASSERT( gp.get() == &v1 ) ;
+                    CPPUNIT_ASSERT( gp->nVal == 50 ) ;
+
+                    CPPUNIT_ASSERT( !l.get( gp, 15 )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v1 ) ;
+
+                    CPPUNIT_ASSERT( l.get_with( gp, v2.key(), less<value_type>() )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v2 ) ;
+                    CPPUNIT_ASSERT( (*gp).nVal == 25 ) ;
+
+                    gp.release() ;
+                    CPPUNIT_ASSERT( gp.empty() ) ;
+                }
+
+                {
+                    guarded_ptr gp ;
+                    CPPUNIT_ASSERT( l.extract( gp, v1.key() )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v1 ) ;
+                    CPPUNIT_ASSERT( !l.find( v1.key() )) ;
+                    CPPUNIT_ASSERT( !l.extract( gp, v1.key() )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v1 ) ;
+
+                    // The item extracted is guarded and cannot be disposed
+                    OrdList::gc::force_dispose() ;
+                    CPPUNIT_ASSERT( v1.s.nDisposeCount == 0 ) ;
+                }
+                OrdList::gc::force_dispose() ;
+                CPPUNIT_ASSERT( v1.s.nDisposeCount == 1 ) ;
+
+#           ifdef CDS_MOVE_SEMANTICS_SUPPORT
+                {
+                    guarded_ptr gp( l.extract_with( v2.key(), less<value_type>() )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v2 ) ;
+                    CPPUNIT_ASSERT( !l.find( v2.key() )) ;
+
+                    gp = l.get( v3.key() ) ;
+                    CPPUNIT_ASSERT( gp.get() == &v3 ) ;
+                    gp = l.get_with( v2.key(), less<value_type>() ) ;
+                    CPPUNIT_ASSERT( gp.empty() ) ;
+
+                    gp = l.extract( v3.key() ) ;
+                    CPPUNIT_ASSERT( gp.get() == &v3 ) ;
+                    gp = l.extract( v3.key() ) ;
+                    CPPUNIT_ASSERT( gp.empty() ) ;
+                }
+#           else
+                {
+                    guarded_ptr gp ;
+                    CPPUNIT_ASSERT( l.extract_with( gp, v2.key(), less<value_type>() )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v2 ) ;
+                    CPPUNIT_ASSERT( l.extract( gp, v3.key() )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v3 ) ;
+                }
+#           endif
+                CPPUNIT_ASSERT( l.empty() ) ;
+            }
+
+            OrdList::gc::force_dispose() ;
+            CPPUNIT_ASSERT( v1.s.nDisposeCount == 1 ) ;
+            CPPUNIT_ASSERT( v2.s.nDisposeCount == 1 ) ;
+            CPPUNIT_ASSERT( v3.s.nDisposeCount == 1 ) ;
+        }
+
         template <class OrdList>
         void test_nogc_int()
         {
@@ -560,6 +646,14 @@ namespace ordlist {
         void PTB_member_less()      ;
         void PTB_member_cmpmix()    ;
         void PTB_member_ic()        ;
+        void EBR_base_cmp()         ;
+        void EBR_base_less()        ;
+        void EBR_base_cmpmix()      ;
+        void EBR_base_ic()          ;
+        void EBR_member_cmp()       ;
+        void EBR_member_less()      ;
+        void EBR_member_cmpmix()    ;
+        void EBR_member_ic()        ;
 
         void HRC_base_cmp()         ;
         void HRC_base_less()        ;
@@ -639,6 +733,14 @@ namespace ordlist {
             CPPUNIT_TEST(PTB_member_less)
             CPPUNIT_TEST(PTB_member_cmpmix)
             CPPUNIT_TEST(PTB_member_ic)
+            CPPUNIT_TEST(EBR_base_cmp)
+            CPPUNIT_TEST(EBR_base_less)
+            CPPUNIT_TEST(EBR_base_cmpmix)
+            CPPUNIT_TEST(EBR_base_ic)
+            CPPUNIT_TEST(EBR_member_cmp)
+            CPPUNIT_TEST(EBR_member_less)
+            CPPUNIT_TEST(EBR_member_cmpmix)
+            CPPUNIT_TEST(EBR_member_ic)
 
             CPPUNIT_TEST(HRC_base_cmp)
             CPPUNIT_TEST(HRC_base_less)
@@ -24,7 +24,7 @@ namespace ordlist {
                 ,ci::opt::disposer< faked_disposer >
             >::type
         >    list    ;
-        test_int<list>()    ;
+        test_hp_int<list>()    ;
     }
     void IntrusiveMichaelListHeaderTest::PTB_base_less()
     {
@@ -37,7 +37,7 @@ namespace ordlist {
                 ,ci::opt::disposer< faked_disposer >
             >::type
         >    list    ;
-        test_int<list>()    ;
+        test_hp_int<list>()    ;
     }
     void IntrusiveMichaelListHeaderTest::PTB_base_cmpmix()
     {
@@ -51,7 +51,7 @@ namespace ordlist {
                 ,ci::opt::disposer< faked_disposer >
             >::type
         >    list    ;
-        test_int<list>()    ;
+        test_hp_int<list>()    ;
     }
     void IntrusiveMichaelListHeaderTest::PTB_base_ic()
     {
@@ -66,7 +66,7 @@ namespace ordlist {
                 ,co::item_counter< cds::atomicity::item_counter >
             >::type
         >    list    ;
-        test_int<list>()    ;
+        test_hp_int<list>()    ;
     }
     void IntrusiveMichaelListHeaderTest::PTB_member_cmp()
     {
@@ -82,7 +82,7 @@ namespace ordlist {
                 ,ci::opt::disposer< faked_disposer >
             >::type
         >    list    ;
-        test_int<list>()    ;
+        test_hp_int<list>()    ;
     }
     void IntrusiveMichaelListHeaderTest::PTB_member_less()
     {
@@ -98,7 +98,7 @@ namespace ordlist {
                 ,ci::opt::disposer< faked_disposer >
             >::type
         >    list    ;
-        test_int<list>()    ;
+        test_hp_int<list>()    ;
     }
     void IntrusiveMichaelListHeaderTest::PTB_member_cmpmix()
     {
@@ -115,7 +115,7 @@ namespace ordlist {
                 ,ci::opt::disposer< faked_disposer >
             >::type
         >    list    ;
-        test_int<list>()    ;
+        test_hp_int<list>()    ;
     }
     void IntrusiveMichaelListHeaderTest::PTB_member_ic()
     {
@@ -132,7 +132,7 @@ namespace ordlist {
                 ,co::item_counter< cds::atomicity::item_counter >
             >::type
         >    list    ;
-        test_int<list>()    ;
+        test_hp_int<list>()    ;
     }
 
 } // namespace ordlist
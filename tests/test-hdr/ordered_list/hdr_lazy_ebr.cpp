@@ -0,0 +1,109 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "ordered_list/hdr_lazy.h"
+#include <cds/container/lazy_list_ebr.h>
+
+namespace ordlist {
+    namespace {
+        struct EBR_cmp_traits: public cc::lazy_list::type_traits
+        {
+            typedef LazyListTestHeader::cmp<LazyListTestHeader::item>   compare ;
+        };
+    }
+    void LazyListTestHeader::EBR_cmp()
+    {
+        // traits-based version
+        typedef cc::LazyList< cds::gc::EBR, item, EBR_cmp_traits > list   ;
+        test_hp< list >()  ;
+
+        // option-based version
+
+        typedef cc::LazyList< cds::gc::EBR, item,
+            cc::lazy_list::make_traits<
+                cc::opt::compare< cmp<item> >
+            >::type
+        > opt_list   ;
+        test_hp< opt_list >()  ;
+    }
+
+    namespace {
+        struct EBR_less_traits: public cc::lazy_list::type_traits
+        {
+            typedef LazyListTestHeader::lt<LazyListTestHeader::item>   less ;
+        };
+    }
+    void LazyListTestHeader::EBR_less()
+    {
+        // traits-based version
+        typedef cc::LazyList< cds::gc::EBR, item, EBR_less_traits > list   ;
+        test_hp< list >()  ;
+
+        // option-based version
+
+        typedef cc::LazyList< cds::gc::EBR, item,
+            cc::lazy_list::make_traits<
+                cc::opt::less< lt<item> >
+            >::type
+        > opt_list   ;
+        test_hp< opt_list >()  ;
+    }
+
+    namespace {
+        struct EBR_cmpmix_traits: public cc::lazy_list::type_traits
+        {
+            typedef LazyListTestHeader::cmp<LazyListTestHeader::item>   compare ;
+            typedef LazyListTestHeader::lt<LazyListTestHeader::item>  less    ;
+        };
+    }
+    void LazyListTestHeader::EBR_cmpmix()
+    {
+        // traits-based version
+        typedef cc::LazyList< cds::gc::EBR, item, EBR_cmpmix_traits > list   ;
+        test_hp< list >()  ;
+
+        // option-based version
+
+        typedef cc::LazyList< cds::gc::EBR, item,
+            cc::lazy_list::make_traits<
+                cc::opt::compare< cmp<item> >
+                ,cc::opt::less< lt<item> >
+            >::type
+        > opt_list   ;
+        test_hp< opt_list >()  ;
+    }
+
+    namespace {
+        struct EBR_ic_traits: public cc::lazy_list::type_traits
+        {
+            typedef LazyListTestHeader::lt<LazyListTestHeader::item>   less ;
+            typedef cds::atomicity::item_counter item_counter   ;
+        };
+    }
+    void LazyListTestHeader::EBR_ic()
+    {
+        // traits-based version
+        typedef cc::LazyList< cds::gc::EBR, item, EBR_ic_traits > list   ;
+        test_hp< list >()  ;
+
+        // option-based version
+
+        typedef cc::LazyList< cds::gc::EBR, item,
+            cc::lazy_list::make_traits<
+                cc::opt::less< lt<item> >
+                ,cc::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > opt_list   ;
+        test_hp< opt_list >()  ;
+    }
+
+}   // namespace ordlist
+
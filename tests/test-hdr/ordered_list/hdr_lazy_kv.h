@@ -428,6 +428,10 @@ namespace ordlist {
         void PTB_less()         ;
         void PTB_cmpmix()       ;
         void PTB_ic()           ;
+        void EBR_cmp()          ;
+        void EBR_less()         ;
+        void EBR_cmpmix()       ;
+        void EBR_ic()           ;
 
         void RCU_GPI_cmp()          ;
         void RCU_GPI_less()         ;
@@ -474,6 +478,10 @@ namespace ordlist {
             CPPUNIT_TEST(PTB_less)
             CPPUNIT_TEST(PTB_cmpmix)
             CPPUNIT_TEST(PTB_ic)
+            CPPUNIT_TEST(EBR_cmp)
+            CPPUNIT_TEST(EBR_less)
+            CPPUNIT_TEST(EBR_cmpmix)
+            CPPUNIT_TEST(EBR_ic)
 
             CPPUNIT_TEST(HRC_cmp)
             CPPUNIT_TEST(HRC_less)
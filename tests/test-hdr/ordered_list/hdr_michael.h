@@ -11,6 +11,7 @@
 
 #include "cppunit/cppunit_proxy.h"
 #include <cds/container/michael_list_base.h>
+#include <vector>
 
 namespace ordlist {
     namespace cc = cds::container       ;
@@ -420,6 +421,125 @@ namespace ordlist {
             }
         }
 
+        template <class OrdList>
+        void test_hp()
+        {
+            test<OrdList>() ;
+
+            // get() / extract() tests
+            typedef typename OrdList::guarded_ptr   guarded_ptr ;
+
+            OrdList l   ;
+            CPPUNIT_ASSERT( l.insert( item( 25 )) ) ;
+            CPPUNIT_ASSERT( l.insert( item( 50, 500 )) ) ;
+            CPPUNIT_ASSERT( l.insert( item( 100 )) ) ;
+
+            {
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+                CPPUNIT_ASSERT( l.get( gp, 50 )) ;
+                CPPUNIT_ASSERT( !gp.empty() ) ;
+                CPPUNIT_ASSERT( gp->nKey == 50 ) ;
+                CPPUNIT_ASSERT( gp->nVal == 500 ) ;
+
+                // The value is not copied
+                gp->nVal = 5000 ;
+                CPPUNIT_ASSERT( l.find( 50, check_exact_value( 5000 )) ) ;
+
+                CPPUNIT_ASSERT( !l.get( gp, 75 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 50 ) ;
+
+                CPPUNIT_ASSERT( l.get_with( gp, 25, lt<item>() )) ;
+                CPPUNIT_ASSERT( (*gp).nKey == 25 ) ;
+
+                gp.release() ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+            }
+
+            {
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( l.extract( gp, 50 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 50 ) ;
+                CPPUNIT_ASSERT( gp->nVal == 5000 ) ;
+                CPPUNIT_ASSERT( !l.find( 50 )) ;
+                CPPUNIT_ASSERT( !l.extract( gp, 50 )) ;
+
+                // The item extracted is guarded and is still accessible
+                OrdList::gc::force_dispose() ;
+                CPPUNIT_ASSERT( gp->nKey == 50 ) ;
+                CPPUNIT_ASSERT( gp->nVal == 5000 ) ;
+            }
+
+#       ifdef CDS_MOVE_SEMANTICS_SUPPORT
+            {
+                guarded_ptr gp( l.extract_with( 25, lt<item>() )) ;
+                CPPUNIT_ASSERT( !gp.empty() ) ;
+                CPPUNIT_ASSERT( gp->nKey == 25 ) ;
+                CPPUNIT_ASSERT( !l.find( 25 )) ;
+
+                gp = l.get( 100 ) ;
+                CPPUNIT_ASSERT( gp->nKey == 100 ) ;
+                gp = l.get_with( 25, lt<item>() ) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+
+                gp = l.extract( 100 ) ;
+                CPPUNIT_ASSERT( gp->nKey == 100 ) ;
+                gp = l.extract( 100 ) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+            }
+#       else
+            {
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( l.extract_with( gp, 25, lt<item>() )) ;
+                CPPUNIT_ASSERT( gp->nKey == 25 ) ;
+                CPPUNIT_ASSERT( l.extract( gp, 100 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 100 ) ;
+            }
+#       endif
+            CPPUNIT_ASSERT( l.empty() ) ;
+
+            // insert with hint, insert_sorted
+            {
+                int const nSize = 100 ;
+                std::vector<int> arr ;
+                for ( int i = 0; i < nSize; ++i )
+                    arr.push_back( i * 2 ) ;
+                CPPUNIT_ASSERT( l.insert_sorted( arr.begin(), arr.end() ) == size_t(nSize) ) ;
+                CPPUNIT_ASSERT( l.insert_sorted( arr.begin(), arr.end() ) == 0 ) ;
+
+                typename OrdList::insert_hint hint ;
+                CPPUNIT_ASSERT( !hint.valid() ) ;
+                for ( int i = 0; i < nSize; i += 2 ) {
+                    // odd keys in nearly ascending order: 3, 1, 7, 5, ...
+                    CPPUNIT_ASSERT( l.insert( hint, (i + 1) * 2 + 1 )) ;
+                    CPPUNIT_ASSERT( hint.valid() ) ;
+                    CPPUNIT_ASSERT( l.insert( hint, i * 2 + 1 )) ;
+                }
+                CPPUNIT_ASSERT( !l.insert( hint, 10 )) ;
+
+                // The hint item is deleted
+                CPPUNIT_ASSERT( l.erase( 10 )) ;
+                CPPUNIT_ASSERT( l.erase( 11 )) ;
+                CPPUNIT_ASSERT( l.insert( hint, 11 )) ;
+                CPPUNIT_ASSERT( l.insert( hint, 10 )) ;
+                CPPUNIT_ASSERT( l.insert( hint, -1 )) ;
+                hint.reset() ;
+                CPPUNIT_ASSERT( !hint.valid() ) ;
+
+                int nPrev = -2 ;
+                int nCount = 0 ;
+                for ( typename OrdList::iterator it = l.begin(); it != l.end(); ++it ) {
+                    CPPUNIT_ASSERT( it->nKey == nPrev + 1 ) ;
+                    CPPUNIT_ASSERT( it->nVal == it->nKey * 2 ) ;
+                    nPrev = it->nKey ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == nSize * 2 + 1 ) ;
+                l.clear() ;
+                CPPUNIT_ASSERT( l.empty() ) ;
+            }
+        }
+
         template <class OrdList>
         void nogc_test()
         {
@@ -506,6 +626,10 @@ namespace ordlist {
         void PTB_less()         ;
         void PTB_cmpmix()       ;
         void PTB_ic()           ;
+        void EBR_cmp()          ;
+        void EBR_less()         ;
+        void EBR_cmpmix()       ;
+        void EBR_ic()           ;
 
         void HRC_cmp()          ;
         void HRC_less()         ;
@@ -552,6 +676,10 @@ namespace ordlist {
             CPPUNIT_TEST(PTB_less)
             CPPUNIT_TEST(PTB_cmpmix)
             CPPUNIT_TEST(PTB_ic)
+            CPPUNIT_TEST(EBR_cmp)
+            CPPUNIT_TEST(EBR_less)
+            CPPUNIT_TEST(EBR_cmpmix)
+            CPPUNIT_TEST(EBR_ic)
 
             CPPUNIT_TEST(HRC_cmp)
             CPPUNIT_TEST(HRC_less)
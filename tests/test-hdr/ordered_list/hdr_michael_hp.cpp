@@ -24,7 +24,7 @@ namespace ordlist {
     {
         // traits-based version
         typedef cc::MichaelList< cds::gc::HP, item, HP_cmp_traits > list   ;
-        test< list >()  ;
+        test_hp< list >()  ;
 
         // option-based version
 
@@ -33,7 +33,7 @@ namespace ordlist {
                 cc::opt::compare< cmp<item> >
             >::type
         > opt_list   ;
-        test< opt_list >()  ;
+        test_hp< opt_list >()  ;
     }
 
     namespace {
@@ -46,7 +46,7 @@ namespace ordlist {
     {
         // traits-based version
         typedef cc::MichaelList< cds::gc::HP, item, HP_less_traits > list   ;
-        test< list >()  ;
+        test_hp< list >()  ;
 
         // option-based version
 
@@ -55,7 +55,7 @@ namespace ordlist {
                 cc::opt::less< lt<item> >
             >::type
         > opt_list   ;
-        test< opt_list >()  ;
+        test_hp< opt_list >()  ;
     }
 
     namespace {
@@ -69,7 +69,7 @@ namespace ordlist {
     {
         // traits-based version
         typedef cc::MichaelList< cds::gc::HP, item, HP_cmpmix_traits > list   ;
-        test< list >()  ;
+        test_hp< list >()  ;
 
         // option-based version
 
@@ -79,7 +79,7 @@ namespace ordlist {
                 ,cc::opt::less< lt<item> >
             >::type
         > opt_list   ;
-        test< opt_list >()  ;
+        test_hp< opt_list >()  ;
     }
 
     namespace {
@@ -93,7 +93,7 @@ namespace ordlist {
     {
         // traits-based version
         typedef cc::MichaelList< cds::gc::HP, item, HP_ic_traits > list   ;
-        test< list >()  ;
+        test_hp< list >()  ;
 
         // option-based version
 
@@ -103,7 +103,7 @@ namespace ordlist {
                 ,cc::opt::item_counter< cds::atomicity::item_counter >
             >::type
         > opt_list   ;
-        test< opt_list >()  ;
+        test_hp< opt_list >()  ;
     }
 
 }   // namespace ordlist
@@ -438,6 +438,10 @@ namespace ordlist {
         void PTB_less()         ;
         void PTB_cmpmix()       ;
         void PTB_ic()           ;
+        void EBR_cmp()          ;
+        void EBR_less()         ;
+        void EBR_cmpmix()       ;
+        void EBR_ic()           ;
 
         void HRC_cmp()          ;
         void HRC_less()         ;
@@ -484,6 +488,10 @@ namespace ordlist {
             CPPUNIT_TEST(PTB_less)
             CPPUNIT_TEST(PTB_cmpmix)
             CPPUNIT_TEST(PTB_ic)
+            CPPUNIT_TEST(EBR_cmp)
+            CPPUNIT_TEST(EBR_less)
+            CPPUNIT_TEST(EBR_cmpmix)
+            CPPUNIT_TEST(EBR_ic)
 
             CPPUNIT_TEST(HRC_cmp)
             CPPUNIT_TEST(HRC_less)
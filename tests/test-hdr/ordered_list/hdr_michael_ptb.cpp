@@ -23,7 +23,7 @@ namespace ordlist {
     {
         // traits-based version
         typedef cc::MichaelList< cds::gc::PTB, item, PTB_cmp_traits > list   ;
-        test< list >()  ;
+        test_hp< list >()  ;
 
         // option-based version
 
@@ -32,7 +32,7 @@ namespace ordlist {
                 cc::opt::compare< cmp<item> >
             >::type
         > opt_list   ;
-        test< opt_list >()  ;
+        test_hp< opt_list >()  ;
     }
 
     namespace {
@@ -45,7 +45,7 @@ namespace ordlist {
     {
         // traits-based version
         typedef cc::MichaelList< cds::gc::PTB, item, PTB_less_traits > list   ;
-        test< list >()  ;
+        test_hp< list >()  ;
 
         // option-based version
 
@@ -54,7 +54,7 @@ namespace ordlist {
                 cc::opt::less< lt<item> >
             >::type
         > opt_list   ;
-        test< opt_list >()  ;
+        test_hp< opt_list >()  ;
     }
 
     namespace {
@@ -68,7 +68,7 @@ namespace ordlist {
     {
         // traits-based version
         typedef cc::MichaelList< cds::gc::PTB, item, PTB_cmpmix_traits > list   ;
-        test< list >()  ;
+        test_hp< list >()  ;
 
         // option-based version
 
@@ -78,7 +78,7 @@ namespace ordlist {
                 ,cc::opt::less< lt<item> >
             >::type
         > opt_list   ;
-        test< opt_list >()  ;
+        test_hp< opt_list >()  ;
     }
 
     namespace {
@@ -92,7 +92,7 @@ namespace ordlist {
     {
         // traits-based version
         typedef cc::MichaelList< cds::gc::PTB, item, PTB_ic_traits > list   ;
-        test< list >()  ;
+        test_hp< list >()  ;
 
         // option-based version
 
@@ -102,7 +102,7 @@ namespace ordlist {
                 ,cc::opt::item_counter< cds::atomicity::item_counter >
             >::type
         > opt_list   ;
-        test< opt_list >()  ;
+        test_hp< opt_list >()  ;
     }
 
 }   // namespace ordlist
@@ -0,0 +1,111 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "queue/hdr_mspriority_queue.h"
+#include <cds/intrusive/mspriority_queue.h>
+
+namespace queue {
+    namespace {
+        namespace ci = cds::intrusive ;
+        typedef MSPriorityQueueHdrTest::value_type  value_type ;
+    }
+
+    void MSPriorityQueueHdrTest::MSPQueue_intrusive_dyn()
+    {
+        typedef ci::MSPriorityQueue< value_type,
+            ci::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< char > >
+                ,cds::opt::less< less >
+            >::type
+        > pqueue ;
+
+        pqueue pq( c_nCapacity ) ;
+        test_intrusive( pq ) ;
+    }
+
+    void MSPriorityQueueHdrTest::MSPQueue_intrusive_dyn_cmp()
+    {
+        typedef ci::MSPriorityQueue< value_type,
+            ci::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< char > >
+                ,cds::opt::compare< compare >
+            >::type
+        > pqueue ;
+
+        pqueue pq( c_nCapacity ) ;
+        test_intrusive( pq ) ;
+    }
+
+    void MSPriorityQueueHdrTest::MSPQueue_intrusive_dyn_min()
+    {
+        typedef ci::MSPriorityQueue< value_type,
+            ci::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< char > >
+                ,cds::opt::less< greater >
+            >::type
+        > pqueue ;
+
+        pqueue pq( c_nCapacity ) ;
+        test_intrusive( pq, true ) ;
+    }
+
+    void MSPriorityQueueHdrTest::MSPQueue_intrusive_dyn_stat()
+    {
+        typedef ci::MSPriorityQueue< value_type,
+            ci::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< char > >
+                ,cds::opt::less< less >
+                ,cds::opt::stat< ci::mspriority_queue::stat<> >
+            >::type
+        > pqueue ;
+
+        pqueue pq( c_nCapacity ) ;
+        test_intrusive( pq ) ;
+
+        pqueue::stat const& s = pq.statistics() ;
+        CPPUNIT_ASSERT( s.m_nPushCount.get() == s.m_nPopCount.get() ) ;
+        CPPUNIT_ASSERT( s.m_nPushFailCount.get() == 1 ) ;
+        CPPUNIT_ASSERT( s.m_nPopFailCount.get() > 0 ) ;
+        CPPUNIT_ASSERT( s.m_nPushHeapifySwapCount.get() > 0 ) ;
+        CPPUNIT_ASSERT( s.m_nPopHeapifySwapCount.get() > 0 ) ;
+    }
+
+    void MSPriorityQueueHdrTest::MSPQueue_intrusive_static()
+    {
+        typedef ci::MSPriorityQueue< value_type,
+            ci::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::static_buffer< char, 1024 > >
+                ,cds::opt::less< less >
+            >::type
+        > pqueue ;
+
+        pqueue pq( 0 ) ;
+        CPPUNIT_ASSERT( pq.capacity() == 1024 ) ;
+        test_intrusive( pq ) ;
+    }
+
+    void MSPriorityQueueHdrTest::MSPQueue_intrusive_static_stat()
+    {
+        typedef ci::MSPriorityQueue< value_type,
+            ci::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::static_buffer< char, 1024 > >
+                ,cds::opt::compare< compare >
+                ,cds::opt::stat< ci::mspriority_queue::stat<> >
+            >::type
+        > pqueue ;
+
+        pqueue pq( 0 ) ;
+        test_intrusive( pq ) ;
+    }
+
+} // namespace queue
+
+CPPUNIT_TEST_SUITE_REGISTRATION(queue::MSPriorityQueueHdrTest) ;
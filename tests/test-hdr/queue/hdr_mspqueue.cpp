@@ -0,0 +1,101 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "queue/hdr_mspriority_queue.h"
+#include <cds/container/mspriority_queue.h>
+
+namespace queue {
+    namespace {
+        namespace cc = cds::container ;
+        typedef MSPriorityQueueHdrTest::value_type  value_type ;
+    }
+
+    void MSPriorityQueueHdrTest::MSPQueue_dyn()
+    {
+        typedef cc::MSPriorityQueue< value_type,
+            cc::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< char > >
+                ,cds::opt::less< less >
+            >::type
+        > pqueue ;
+
+        pqueue pq( c_nCapacity ) ;
+        test_container( pq ) ;
+    }
+
+    void MSPriorityQueueHdrTest::MSPQueue_dyn_cmp()
+    {
+        typedef cc::MSPriorityQueue< value_type,
+            cc::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< char > >
+                ,cds::opt::compare< compare >
+            >::type
+        > pqueue ;
+
+        pqueue pq( c_nCapacity ) ;
+        test_container( pq ) ;
+    }
+
+    void MSPriorityQueueHdrTest::MSPQueue_dyn_min()
+    {
+        typedef cc::MSPriorityQueue< value_type,
+            cc::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< char > >
+                ,cds::opt::less< greater >
+                ,cds::opt::lock_type< cds::lock::Spin >
+            >::type
+        > pqueue ;
+
+        pqueue pq( c_nCapacity ) ;
+        test_container( pq, true ) ;
+    }
+
+    void MSPriorityQueueHdrTest::MSPQueue_dyn_stat()
+    {
+        typedef cc::MSPriorityQueue< value_type,
+            cc::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< char > >
+                ,cds::opt::less< less >
+                ,cds::opt::stat< cc::mspriority_queue::stat<> >
+            >::type
+        > pqueue ;
+
+        pqueue pq( c_nCapacity ) ;
+        test_container( pq ) ;
+    }
+
+    void MSPriorityQueueHdrTest::MSPQueue_static()
+    {
+        typedef cc::MSPriorityQueue< value_type,
+            cc::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::static_buffer< char, 1024 > >
+                ,cds::opt::less< less >
+            >::type
+        > pqueue ;
+
+        pqueue pq( 0 ) ;
+        test_container( pq ) ;
+    }
+
+    void MSPriorityQueueHdrTest::MSPQueue_static_min()
+    {
+        typedef cc::MSPriorityQueue< value_type,
+            cc::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::static_buffer< char, 1024 > >
+                ,cds::opt::less< greater >
+            >::type
+        > pqueue ;
+
+        pqueue pq( 0 ) ;
+        test_container( pq, true ) ;
+    }
+
+} // namespace queue
@@ -0,0 +1,277 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDSTEST_HDR_MSPRIORITY_QUEUE_H
+#define __CDSTEST_HDR_MSPRIORITY_QUEUE_H
+
+#include "cppunit/cppunit_proxy.h"
+#include <cds/ref.h>
+#include <algorithm>
+#include <vector>
+
+namespace queue {
+
+    class MSPriorityQueueHdrTest: public CppUnitMini::TestCase
+    {
+    public:
+        static size_t const c_nCapacity = 1024 * 16 ;
+
+        struct value_type {
+            int     nKey ;
+            int     nVal ;
+
+            value_type()
+                : nKey(0)
+                , nVal(0)
+            {}
+            value_type( int key )
+                : nKey( key )
+                , nVal( key * 2 )
+            {}
+            value_type( int key, int val )
+                : nKey( key )
+                , nVal( val )
+            {}
+        };
+
+        struct less {
+            bool operator()( value_type const& v1, value_type const& v2 ) const
+            {
+                return v1.nKey < v2.nKey ;
+            }
+        };
+
+        struct greater {
+            bool operator()( value_type const& v1, value_type const& v2 ) const
+            {
+                return v1.nKey > v2.nKey ;
+            }
+        };
+
+        struct compare {
+            int operator()( value_type const& v1, value_type const& v2 ) const
+            {
+                return v1.nKey < v2.nKey ? -1 : (v1.nKey > v2.nKey ? 1 : 0) ;
+            }
+        };
+
+        struct disposer {
+            size_t  m_nCount ;
+
+            disposer()
+                : m_nCount(0)
+            {}
+
+            void operator()( value_type& )
+            {
+                ++m_nCount ;
+            }
+        };
+
+    protected:
+        static std::vector<int> shuffled_keys( size_t nSize )
+        {
+            std::vector<int> arr ;
+            arr.reserve( nSize ) ;
+            for ( size_t i = 0; i < nSize; ++i )
+                arr.push_back( int(i) ) ;
+            std::random_shuffle( arr.begin(), arr.end() ) ;
+            return arr ;
+        }
+
+        // Intrusive priority queue, max-priority by default
+        template <class PQueue>
+        void test_intrusive( PQueue& pq, bool bMinQueue = false )
+        {
+            size_t const nCapacity = pq.capacity() ;
+            std::vector<int> arrKeys = shuffled_keys( nCapacity ) ;
+            std::vector<value_type> arrItems ;
+            arrItems.reserve( nCapacity ) ;
+            for ( size_t i = 0; i < nCapacity; ++i )
+                arrItems.push_back( value_type( arrKeys[i] )) ;
+            value_type vExtra( static_cast<int>( nCapacity )) ;
+
+            CPPUNIT_ASSERT( pq.empty() ) ;
+            CPPUNIT_ASSERT( !pq.full() ) ;
+            CPPUNIT_ASSERT( pq.size() == 0 ) ;
+            CPPUNIT_ASSERT( pq.pop() == NULL ) ;
+
+            for ( size_t i = 0; i < nCapacity; ++i ) {
+                CPPUNIT_ASSERT( !pq.full() ) ;
+                CPPUNIT_ASSERT( pq.push( arrItems[i] )) ;
+                CPPUNIT_ASSERT( !pq.empty() ) ;
+                CPPUNIT_ASSERT( pq.size() == i + 1 ) ;
+            }
+            CPPUNIT_ASSERT( pq.full() ) ;
+            CPPUNIT_ASSERT( !pq.push( vExtra )) ;
+            CPPUNIT_ASSERT( pq.size() == nCapacity ) ;
+
+            for ( size_t i = 0; i < nCapacity; ++i ) {
+                value_type * p = pq.pop() ;
+                CPPUNIT_ASSERT( p != NULL ) ;
+                int nExpected = bMinQueue ? int(i) : int(nCapacity - 1 - i) ;
+                CPPUNIT_ASSERT( p->nKey == nExpected ) ;
+                CPPUNIT_ASSERT( p->nVal == nExpected * 2 ) ;
+                CPPUNIT_ASSERT( pq.size() == nCapacity - i - 1 ) ;
+            }
+            CPPUNIT_ASSERT( pq.empty() ) ;
+            CPPUNIT_ASSERT( pq.pop() == NULL ) ;
+
+            // clear_with
+            for ( size_t i = 0; i < nCapacity / 2; ++i )
+                CPPUNIT_ASSERT( pq.push( arrItems[i] )) ;
+            CPPUNIT_ASSERT( pq.size() == nCapacity / 2 ) ;
+            {
+                disposer d ;
+                pq.clear_with( cds::ref(d) ) ;
+                CPPUNIT_ASSERT( d.m_nCount == nCapacity / 2 ) ;
+            }
+            CPPUNIT_ASSERT( pq.empty() ) ;
+            CPPUNIT_ASSERT( pq.size() == 0 ) ;
+
+            // push/pop interleaving
+            for ( size_t i = 0; i < nCapacity; ++i ) {
+                CPPUNIT_ASSERT( pq.push( arrItems[i] )) ;
+                if ( i & 1 ) {
+                    value_type * p = pq.pop() ;
+                    CPPUNIT_ASSERT( p != NULL ) ;
+                }
+            }
+            CPPUNIT_ASSERT( pq.size() == nCapacity / 2 ) ;
+            {
+                value_type * pPrev = pq.pop() ;
+                CPPUNIT_ASSERT( pPrev != NULL ) ;
+                value_type * p ;
+                while ( (p = pq.pop()) != NULL ) {
+                    if ( bMinQueue ) {
+                        CPPUNIT_ASSERT( pPrev->nKey < p->nKey ) ;
+                    }
+                    else {
+                        CPPUNIT_ASSERT( pPrev->nKey > p->nKey ) ;
+                    }
+                    pPrev = p ;
+                }
+            }
+            CPPUNIT_ASSERT( pq.empty() ) ;
+        }
+
+        struct pop_functor {
+            int nKey ;
+            int nVal ;
+
+            void operator()( value_type& v )
+            {
+                nKey = v.nKey ;
+                nVal = v.nVal ;
+            }
+        };
+
+        // Non-intrusive priority queue, max-priority by default
+        template <class PQueue>
+        void test_container( PQueue& pq, bool bMinQueue = false )
+        {
+            size_t const nCapacity = pq.capacity() ;
+            std::vector<int> arrKeys = shuffled_keys( nCapacity ) ;
+
+            value_type v ;
+            CPPUNIT_ASSERT( pq.empty() ) ;
+            CPPUNIT_ASSERT( pq.size() == 0 ) ;
+            CPPUNIT_ASSERT( !pq.pop( v )) ;
+
+            for ( size_t i = 0; i < nCapacity; ++i ) {
+                CPPUNIT_ASSERT( pq.push( value_type( arrKeys[i] ))) ;
+                CPPUNIT_ASSERT( pq.size() == i + 1 ) ;
+            }
+            CPPUNIT_ASSERT( pq.full() ) ;
+            CPPUNIT_ASSERT( !pq.push( value_type( int(nCapacity) ))) ;
+
+            for ( size_t i = 0; i < nCapacity; ++i ) {
+                CPPUNIT_ASSERT( pq.pop( v )) ;
+                int nExpected = bMinQueue ? int(i) : int(nCapacity - 1 - i) ;
+                CPPUNIT_ASSERT( v.nKey == nExpected ) ;
+                CPPUNIT_ASSERT( v.nVal == nExpected * 2 ) ;
+            }
+            CPPUNIT_ASSERT( pq.empty() ) ;
+            CPPUNIT_ASSERT( !pq.pop( v )) ;
+
+            // pop_with
+            CPPUNIT_ASSERT( pq.push( value_type( 10, 1 ))) ;
+            CPPUNIT_ASSERT( pq.push( value_type( 20, 2 ))) ;
+            {
+                pop_functor f ;
+                CPPUNIT_ASSERT( pq.pop_with( cds::ref(f) )) ;
+                CPPUNIT_ASSERT( f.nKey == (bMinQueue ? 10 : 20) ) ;
+                CPPUNIT_ASSERT( pq.pop_with( cds::ref(f) )) ;
+                CPPUNIT_ASSERT( f.nKey == (bMinQueue ? 20 : 10) ) ;
+                CPPUNIT_ASSERT( !pq.pop_with( cds::ref(f) )) ;
+            }
+
+#       ifdef CDS_EMPLACE_SUPPORT
+            CPPUNIT_ASSERT( pq.emplace( 5, 15 )) ;
+            CPPUNIT_ASSERT( pq.pop( v )) ;
+            CPPUNIT_ASSERT( v.nKey == 5 ) ;
+            CPPUNIT_ASSERT( v.nVal == 15 ) ;
+#       endif
+
+            // clear
+            for ( size_t i = 0; i < nCapacity / 2; ++i )
+                CPPUNIT_ASSERT( pq.push( value_type( arrKeys[i] ))) ;
+            CPPUNIT_ASSERT( pq.size() == nCapacity / 2 ) ;
+            pq.clear() ;
+            CPPUNIT_ASSERT( pq.empty() ) ;
+
+            // clear_with
+            for ( size_t i = 0; i < nCapacity / 2; ++i )
+                CPPUNIT_ASSERT( pq.push( value_type( arrKeys[i] ))) ;
+            {
+                disposer d ;
+                pq.clear_with( cds::ref(d) ) ;
+                CPPUNIT_ASSERT( d.m_nCount == nCapacity / 2 ) ;
+            }
+            CPPUNIT_ASSERT( pq.empty() ) ;
+
+            // The destructor should free remaining items
+            for ( size_t i = 0; i < nCapacity / 2; ++i )
+                CPPUNIT_ASSERT( pq.push( value_type( arrKeys[i] ))) ;
+        }
+
+        void MSPQueue_intrusive_dyn()           ;
+        void MSPQueue_intrusive_dyn_cmp()       ;
+        void MSPQueue_intrusive_dyn_min()       ;
+        void MSPQueue_intrusive_dyn_stat()      ;
+        void MSPQueue_intrusive_static()        ;
+        void MSPQueue_intrusive_static_stat()   ;
+        void MSPQueue_dyn()                     ;
+        void MSPQueue_dyn_cmp()                 ;
+        void MSPQueue_dyn_min()                 ;
+        void MSPQueue_dyn_stat()                ;
+        void MSPQueue_static()                  ;
+        void MSPQueue_static_min()              ;
+
+        CPPUNIT_TEST_SUITE(MSPriorityQueueHdrTest)
+            CPPUNIT_TEST(MSPQueue_intrusive_dyn)
+            CPPUNIT_TEST(MSPQueue_intrusive_dyn_cmp)
+            CPPUNIT_TEST(MSPQueue_intrusive_dyn_min)
+            CPPUNIT_TEST(MSPQueue_intrusive_dyn_stat)
+            CPPUNIT_TEST(MSPQueue_intrusive_static)
+            CPPUNIT_TEST(MSPQueue_intrusive_static_stat)
+            CPPUNIT_TEST(MSPQueue_dyn)
+            CPPUNIT_TEST(MSPQueue_dyn_cmp)
+            CPPUNIT_TEST(MSPQueue_dyn_min)
+            CPPUNIT_TEST(MSPQueue_dyn_stat)
+            CPPUNIT_TEST(MSPQueue_static)
+            CPPUNIT_TEST(MSPQueue_static_min)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+} // namespace queue
+
+#endif // #ifndef __CDSTEST_HDR_MSPRIORITY_QUEUE_H
@@ -0,0 +1,200 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDSTEST_HDR_SKIPLIST_PQUEUE_H
+#define __CDSTEST_HDR_SKIPLIST_PQUEUE_H
+
+#include "cppunit/cppunit_proxy.h"
+#include <cds/ref.h>
+#include <vector>
+
+namespace queue {
+
+    class SkipListPQueueHdrTest: public CppUnitMini::TestCase
+    {
+    public:
+        struct value_type {
+            int     nKey ;
+            int     nVal ;
+
+            value_type()
+                : nKey(0)
+                , nVal(0)
+            {}
+            value_type( int key, int val )
+                : nKey( key )
+                , nVal( val )
+            {}
+        };
+
+        struct less {
+            bool operator()( value_type const& v1, value_type const& v2 ) const
+            {
+                return v1.nKey < v2.nKey ;
+            }
+        };
+
+        struct pop_functor {
+            int nKey    ;
+            int nCount  ;
+
+            pop_functor()
+                : nKey( -1 )
+                , nCount( 0 )
+            {}
+
+            void operator()( value_type& item )
+            {
+                nKey = item.nKey ;
+                ++nCount ;
+            }
+        };
+
+        static int const c_nSize = 1000 ;
+
+    protected:
+        template <class PQueue>
+        void fill( PQueue& pq )
+        {
+            // Keys 0..c_nSize-1 are pushed in shuffled order
+            for ( int i = 0; i < c_nSize; ++i ) {
+                int nKey = (i * 37) % c_nSize ;
+                CPPUNIT_ASSERT( pq.push( value_type( nKey, nKey * 2 ))) ;
+            }
+            CPPUNIT_ASSERT( !pq.empty() ) ;
+            CPPUNIT_ASSERT( pq.size() == c_nSize ) ;
+        }
+
+        template <class PQueue>
+        void test()
+        {
+            PQueue pq ;
+            value_type v ;
+
+            CPPUNIT_ASSERT( pq.empty() ) ;
+            CPPUNIT_ASSERT( pq.size() == 0 ) ;
+            CPPUNIT_ASSERT( !pq.pop( v )) ;
+
+            fill( pq ) ;
+
+            // Duplicate key
+            CPPUNIT_ASSERT( !pq.push( value_type( 5, 0 ))) ;
+            CPPUNIT_ASSERT( pq.size() == c_nSize ) ;
+
+            for ( int i = 0; i < c_nSize; ++i ) {
+                CPPUNIT_ASSERT( pq.pop( v )) ;
+                CPPUNIT_ASSERT( v.nKey == i ) ;
+                CPPUNIT_ASSERT( v.nVal == i * 2 ) ;
+            }
+            CPPUNIT_ASSERT( pq.empty() ) ;
+            CPPUNIT_ASSERT( pq.size() == 0 ) ;
+            CPPUNIT_ASSERT( !pq.pop( v )) ;
+
+            // pop_with
+            CPPUNIT_ASSERT( pq.push( value_type( 20, 1 ))) ;
+            CPPUNIT_ASSERT( pq.push( value_type( 10, 2 ))) ;
+            {
+                pop_functor f ;
+                CPPUNIT_ASSERT( pq.pop_with( cds::ref(f) )) ;
+                CPPUNIT_ASSERT( f.nKey == 10 ) ;
+                CPPUNIT_ASSERT( pq.pop_with( cds::ref(f) )) ;
+                CPPUNIT_ASSERT( f.nKey == 20 ) ;
+                CPPUNIT_ASSERT( !pq.pop_with( cds::ref(f) )) ;
+                CPPUNIT_ASSERT( f.nCount == 2 ) ;
+            }
+            CPPUNIT_ASSERT( pq.empty() ) ;
+
+#       ifdef CDS_EMPLACE_SUPPORT
+            CPPUNIT_ASSERT( pq.emplace( 7, 14 )) ;
+            CPPUNIT_ASSERT( !pq.emplace( 7, 0 )) ;
+            CPPUNIT_ASSERT( pq.pop( v )) ;
+            CPPUNIT_ASSERT( v.nKey == 7 ) ;
+            CPPUNIT_ASSERT( v.nVal == 14 ) ;
+#       endif
+
+            fill( pq ) ;
+            pq.clear() ;
+            CPPUNIT_ASSERT( pq.empty() ) ;
+            CPPUNIT_ASSERT( pq.size() == 0 ) ;
+
+            PQueue::gc::force_dispose() ;
+        }
+
+        template <class PQueue>
+        void test_relaxed()
+        {
+            unsigned int const nSprayWidth = PQueue::pop_mode::c_nSprayWidth ;
+
+            PQueue pq ;
+            value_type v ;
+
+            CPPUNIT_ASSERT( !pq.pop( v )) ;
+            fill( pq ) ;
+
+            // Each popped item must be one of nSprayWidth minimal items of the queue
+            std::vector<bool> arrPopped( c_nSize, false ) ;
+            int nMin = 0 ;
+            for ( int i = 0; i < c_nSize; ++i ) {
+                CPPUNIT_ASSERT( pq.pop( v )) ;
+                CPPUNIT_ASSERT( v.nKey >= 0 && v.nKey < c_nSize ) ;
+                CPPUNIT_ASSERT( v.nVal == v.nKey * 2 ) ;
+                CPPUNIT_ASSERT( !arrPopped[ v.nKey ] ) ;
+                arrPopped[ v.nKey ] = true ;
+
+                unsigned int nLess = 0 ;
+                for ( int k = nMin; k < v.nKey; ++k ) {
+                    if ( !arrPopped[k] )
+                        ++nLess ;
+                }
+                CPPUNIT_ASSERT( nLess < nSprayWidth ) ;
+
+                while ( nMin < c_nSize && arrPopped[nMin] )
+                    ++nMin ;
+            }
+            CPPUNIT_ASSERT( nMin == c_nSize ) ;
+            CPPUNIT_ASSERT( pq.empty() ) ;
+            CPPUNIT_ASSERT( !pq.pop( v )) ;
+
+            PQueue::gc::force_dispose() ;
+        }
+
+        void SkipList_HP()              ;
+        void SkipList_HP_relaxed()      ;
+        void SkipList_HP_stat()         ;
+        void SkipList_PTB()             ;
+        void SkipList_PTB_relaxed()     ;
+        void SkipList_PTB_stat()        ;
+        void SkipList_RCU_GPI()         ;
+        void SkipList_RCU_GPI_relaxed() ;
+        void SkipList_RCU_GPB()         ;
+        void SkipList_RCU_GPB_relaxed() ;
+        void SkipList_RCU_GPT()         ;
+        void SkipList_RCU_GPT_relaxed() ;
+
+        CPPUNIT_TEST_SUITE(SkipListPQueueHdrTest)
+            CPPUNIT_TEST(SkipList_HP)
+            CPPUNIT_TEST(SkipList_HP_relaxed)
+            CPPUNIT_TEST(SkipList_HP_stat)
+            CPPUNIT_TEST(SkipList_PTB)
+            CPPUNIT_TEST(SkipList_PTB_relaxed)
+            CPPUNIT_TEST(SkipList_PTB_stat)
+            CPPUNIT_TEST(SkipList_RCU_GPI)
+            CPPUNIT_TEST(SkipList_RCU_GPI_relaxed)
+            CPPUNIT_TEST(SkipList_RCU_GPB)
+            CPPUNIT_TEST(SkipList_RCU_GPB_relaxed)
+            CPPUNIT_TEST(SkipList_RCU_GPT)
+            CPPUNIT_TEST(SkipList_RCU_GPT_relaxed)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+} // namespace queue
+
+#endif // #ifndef __CDSTEST_HDR_SKIPLIST_PQUEUE_H
@@ -0,0 +1,59 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "queue/hdr_skiplist_pqueue.h"
+
+#include <cds/container/skip_list_set_hp.h>
+#include <cds/container/skip_list_priority_queue.h>
+
+namespace queue {
+    namespace {
+        namespace cc = cds::container ;
+        typedef cc::skip_list_priority_queue::relaxed<4>  relaxed ;
+    }
+
+    void SkipListPQueueHdrTest::SkipList_HP()
+    {
+        typedef cc::SkipListPriorityQueue< cds::gc::HP, value_type,
+            cc::skip_list_priority_queue::make_traits<
+                cds::opt::less< less >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        > pqueue ;
+        test< pqueue >() ;
+    }
+
+    void SkipListPQueueHdrTest::SkipList_HP_relaxed()
+    {
+        typedef cc::SkipListPriorityQueue< cds::gc::HP, value_type,
+            cc::skip_list_priority_queue::make_traits<
+                cds::opt::less< less >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cc::skip_list_priority_queue::pop_mode< relaxed >
+            >::type
+        > pqueue ;
+        test_relaxed< pqueue >() ;
+    }
+
+    void SkipListPQueueHdrTest::SkipList_HP_stat()
+    {
+        typedef cc::SkipListPriorityQueue< cds::gc::HP, value_type,
+            cc::skip_list_priority_queue::make_traits<
+                cds::opt::less< less >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::stat< cc::skip_list::stat >
+            >::type
+        > pqueue ;
+        test< pqueue >() ;
+    }
+} // namespace queue
+
+CPPUNIT_TEST_SUITE_REGISTRATION(queue::SkipListPQueueHdrTest) ;
@@ -0,0 +1,101 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "queue/hdr_skiplist_pqueue.h"
+
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/general_threaded.h>
+#include <cds/container/skip_list_set_rcu.h>
+#include <cds/container/skip_list_priority_queue.h>
+
+namespace queue {
+    namespace {
+        namespace cc = cds::container ;
+        typedef cc::skip_list_priority_queue::relaxed<4>  relaxed ;
+
+        typedef cds::urcu::gc< cds::urcu::general_instant<> >   rcu_gpi ;
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> >  rcu_gpb ;
+        typedef cds::urcu::gc< cds::urcu::general_threaded<> >  rcu_gpt ;
+    }
+
+    void SkipListPQueueHdrTest::SkipList_RCU_GPI()
+    {
+        typedef cc::SkipListPriorityQueue< rcu_gpi, value_type,
+            cc::skip_list_priority_queue::make_traits<
+                cds::opt::less< less >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::stat< cc::skip_list::stat >
+            >::type
+        > pqueue ;
+        test< pqueue >() ;
+    }
+
+    void SkipListPQueueHdrTest::SkipList_RCU_GPI_relaxed()
+    {
+        typedef cc::SkipListPriorityQueue< rcu_gpi, value_type,
+            cc::skip_list_priority_queue::make_traits<
+                cds::opt::less< less >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cc::skip_list_priority_queue::pop_mode< relaxed >
+            >::type
+        > pqueue ;
+        test_relaxed< pqueue >() ;
+    }
+
+    void SkipListPQueueHdrTest::SkipList_RCU_GPB()
+    {
+        typedef cc::SkipListPriorityQueue< rcu_gpb, value_type,
+            cc::skip_list_priority_queue::make_traits<
+                cds::opt::less< less >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::stat< cc::skip_list::stat >
+            >::type
+        > pqueue ;
+        test< pqueue >() ;
+    }
+
+    void SkipListPQueueHdrTest::SkipList_RCU_GPB_relaxed()
+    {
+        typedef cc::SkipListPriorityQueue< rcu_gpb, value_type,
+            cc::skip_list_priority_queue::make_traits<
+                cds::opt::less< less >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cc::skip_list_priority_queue::pop_mode< relaxed >
+            >::type
+        > pqueue ;
+        test_relaxed< pqueue >() ;
+    }
+
+    void SkipListPQueueHdrTest::SkipList_RCU_GPT()
+    {
+        typedef cc::SkipListPriorityQueue< rcu_gpt, value_type,
+            cc::skip_list_priority_queue::make_traits<
+                cds::opt::less< less >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::stat< cc::skip_list::stat >
+            >::type
+        > pqueue ;
+        test< pqueue >() ;
+    }
+
+    void SkipListPQueueHdrTest::SkipList_RCU_GPT_relaxed()
+    {
+        typedef cc::SkipListPriorityQueue< rcu_gpt, value_type,
+            cc::skip_list_priority_queue::make_traits<
+                cds::opt::less< less >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cc::skip_list_priority_queue::pop_mode< relaxed >
+            >::type
+        > pqueue ;
+        test_relaxed< pqueue >() ;
+    }
+} // namespace queue
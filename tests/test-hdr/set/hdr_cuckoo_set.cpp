@@ -634,6 +634,51 @@ namespace set {
         test_int<set_t, less<item> >() ;
     }
 
+    void CuckooSetHdrTest::Cuckoo_Refinable_vector_unord_optimistic()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::equal_to< equal< item > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+                ,co::mutex_policy< cc::cuckoo::refinable<> >
+                ,cc::cuckoo::optimistic_find< true >
+            >::type
+        > set_t ;
+
+        test_int<set_t, equal< item > >() ;
+    }
+
+    void CuckooSetHdrTest::Cuckoo_Striped_vector_unord_fingerprint()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::equal_to< equal< item > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,cc::cuckoo::store_hash< true >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+                ,cc::cuckoo::fingerprint<>
+            >::type
+        > set_t ;
+
+        test_int<set_t, equal< item > >() ;
+    }
+
+    void CuckooSetHdrTest::Cuckoo_Refinable_vector_cmp_fingerprint16()
+    {
+        typedef cc::CuckooSet< item,
+             cc::cuckoo::make_traits<
+                co::compare< cmp< item > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+                ,co::mutex_policy< cc::cuckoo::refinable<> >
+                ,cc::cuckoo::fingerprint< cds::uint16_t >
+            >::type
+        > set_t ;
+
+        test_int<set_t, less< item > >() ;
+    }
+
 } // namespace set
 
 CPPUNIT_TEST_SUITE_REGISTRATION(set::CuckooSetHdrTest)    ;
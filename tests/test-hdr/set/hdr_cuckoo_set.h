@@ -567,6 +567,9 @@ namespace set {
         void Cuckoo_Refinable_vector_less_cmp_storehash() ;
         void Cuckoo_Refinable_vector_less_cmp_eq() ;
         void Cuckoo_Refinable_vector_less_cmp_eq_storehash() ;
+        void Cuckoo_Refinable_vector_unord_optimistic() ;
+        void Cuckoo_Striped_vector_unord_fingerprint() ;
+        void Cuckoo_Refinable_vector_cmp_fingerprint16() ;
 
         CPPUNIT_TEST_SUITE(CuckooSetHdrTest)
             CPPUNIT_TEST( Cuckoo_Striped_list_unord)
@@ -590,6 +593,7 @@ namespace set {
             CPPUNIT_TEST( Cuckoo_Striped_vector_less_cmp_storehash)
             CPPUNIT_TEST( Cuckoo_Striped_vector_less_cmp_eq)
             CPPUNIT_TEST( Cuckoo_Striped_vector_less_cmp_eq_storehash)
+            CPPUNIT_TEST( Cuckoo_Striped_vector_unord_fingerprint)
 
             CPPUNIT_TEST( Cuckoo_Refinable_list_unord)
             CPPUNIT_TEST( Cuckoo_Refinable_list_unord_storehash)
@@ -612,6 +616,8 @@ namespace set {
             CPPUNIT_TEST( Cuckoo_Refinable_vector_less_cmp_storehash)
             CPPUNIT_TEST( Cuckoo_Refinable_vector_less_cmp_eq)
             CPPUNIT_TEST( Cuckoo_Refinable_vector_less_cmp_eq_storehash)
+            CPPUNIT_TEST( Cuckoo_Refinable_vector_unord_optimistic)
+            CPPUNIT_TEST( Cuckoo_Refinable_vector_cmp_fingerprint16)
         CPPUNIT_TEST_SUITE_END()
     };
 
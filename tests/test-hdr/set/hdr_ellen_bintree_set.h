@@ -0,0 +1,127 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDSTEST_HDR_ELLEN_BINTREE_SET_H
+#define __CDSTEST_HDR_ELLEN_BINTREE_SET_H
+
+#include "set/hdr_set.h"
+
+namespace set {
+
+    class EllenBinTreeSetHdrTest: public HashSetHdrTest
+    {
+        typedef HashSetHdrTest base_class ;
+
+    public:
+        typedef int key_type ;
+
+        struct key_extractor {
+            void operator()( key_type& dest, item const& src ) const
+            {
+                dest = src.nKey ;
+            }
+        };
+
+        struct extract_key_functor {
+            int     nKey ;
+
+            extract_key_functor()
+                : nKey( -1 )
+            {}
+
+            void operator()( item const& i )
+            {
+                nKey = i.nKey ;
+            }
+        };
+
+    protected:
+        template <class Set>
+        void test()
+        {
+            Set s ;
+            base_class::test_int_with( s ) ;
+
+            static int const nLimit = 1000 ;
+            {
+                std::vector<int> arr ;
+                arr.reserve( nLimit ) ;
+                for ( int i = 0; i < nLimit; ++i )
+                    arr.push_back( i ) ;
+                std::random_shuffle( arr.begin(), arr.end() ) ;
+
+                for ( std::vector<int>::const_iterator it = arr.begin(); it != arr.end(); ++it )
+                    CPPUNIT_ASSERT( s.insert( *it )) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, nLimit )) ;
+
+            // extract_min / extract_max remove the leftmost and the rightmost leaf
+            extract_key_functor f ;
+            for ( int i = 0; i < nLimit / 2; ++i ) {
+                CPPUNIT_ASSERT( s.extract_min( boost::ref(f) )) ;
+                CPPUNIT_ASSERT_EX( f.nKey == i, "expected=" << i << ", extracted=" << f.nKey ) ;
+                CPPUNIT_ASSERT( !s.find( i )) ;
+            }
+            for ( int i = nLimit - 1; i >= nLimit / 2; --i ) {
+                CPPUNIT_ASSERT( s.extract_max( boost::ref(f) )) ;
+                CPPUNIT_ASSERT_EX( f.nKey == i, "expected=" << i << ", extracted=" << f.nKey ) ;
+            }
+            CPPUNIT_ASSERT( s.empty() ) ;
+            CPPUNIT_ASSERT( check_size( s, 0 )) ;
+            CPPUNIT_ASSERT( !s.extract_min( boost::ref(f) )) ;
+            CPPUNIT_ASSERT( !s.extract_max( boost::ref(f) )) ;
+
+            // Descending insertion order: the tree degenerates to the list
+            for ( int i = nLimit; i > 0; --i )
+                CPPUNIT_ASSERT( s.insert( std::make_pair( i, i * 2 ))) ;
+            for ( int i = 1; i <= nLimit; ++i ) {
+                CPPUNIT_ASSERT( s.find( i )) ;
+                CPPUNIT_ASSERT( s.find_with( i, less<item>() )) ;
+            }
+            for ( int i = 1; i <= nLimit; i += 2 )
+                CPPUNIT_ASSERT( s.erase( i )) ;
+            CPPUNIT_ASSERT( check_size( s, nLimit / 2 )) ;
+
+            s.clear() ;
+            CPPUNIT_ASSERT( s.empty() ) ;
+            CPPUNIT_ASSERT( check_size( s, 0 )) ;
+        }
+
+        void EllenBinTree_HP_less()         ;
+        void EllenBinTree_HP_cmp()          ;
+        void EllenBinTree_HP_cmpless_stat() ;
+        void EllenBinTree_PTB_less()        ;
+        void EllenBinTree_PTB_cmp()         ;
+        void EllenBinTree_PTB_cmpless_stat();
+        void EllenBinTree_RCU_GPI()         ;
+        void EllenBinTree_RCU_GPB()         ;
+        void EllenBinTree_RCU_GPT()         ;
+        void EllenBinTree_RCU_SHB()         ;
+        void EllenBinTree_RCU_SHT()         ;
+
+        CPPUNIT_TEST_SUITE(EllenBinTreeSetHdrTest)
+            CPPUNIT_TEST(EllenBinTree_HP_less)
+            CPPUNIT_TEST(EllenBinTree_HP_cmp)
+            CPPUNIT_TEST(EllenBinTree_HP_cmpless_stat)
+            CPPUNIT_TEST(EllenBinTree_PTB_less)
+            CPPUNIT_TEST(EllenBinTree_PTB_cmp)
+            CPPUNIT_TEST(EllenBinTree_PTB_cmpless_stat)
+            CPPUNIT_TEST(EllenBinTree_RCU_GPI)
+            CPPUNIT_TEST(EllenBinTree_RCU_GPB)
+            CPPUNIT_TEST(EllenBinTree_RCU_GPT)
+            CPPUNIT_TEST(EllenBinTree_RCU_SHB)
+            CPPUNIT_TEST(EllenBinTree_RCU_SHT)
+        CPPUNIT_TEST_SUITE_END()
+    };
+
+} // namespace set
+
+#endif // #ifndef __CDSTEST_HDR_ELLEN_BINTREE_SET_H
@@ -0,0 +1,57 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "set/hdr_ellen_bintree_set.h"
+#include <cds/container/ellen_bintree_set_hp.h>
+
+namespace set {
+
+    void EllenBinTreeSetHdrTest::EllenBinTree_HP_less()
+    {
+        typedef cc::EllenBinTreeSet< cds::gc::HP, key_type, item,
+            cc::ellen_bintree::make_traits<
+                cc::ellen_bintree::key_extractor< key_extractor >
+                ,co::less< less<item> >
+                ,co::item_counter< simple_item_counter >
+            >::type
+        > set ;
+        test< set >() ;
+    }
+
+    void EllenBinTreeSetHdrTest::EllenBinTree_HP_cmp()
+    {
+        typedef cc::EllenBinTreeSet< cds::gc::HP, key_type, item,
+            cc::ellen_bintree::make_traits<
+                cc::ellen_bintree::key_extractor< key_extractor >
+                ,co::compare< cmp<item> >
+                ,co::item_counter< simple_item_counter >
+            >::type
+        > set ;
+        test< set >() ;
+    }
+
+    void EllenBinTreeSetHdrTest::EllenBinTree_HP_cmpless_stat()
+    {
+        typedef cc::EllenBinTreeSet< cds::gc::HP, key_type, item,
+            cc::ellen_bintree::make_traits<
+                cc::ellen_bintree::key_extractor< key_extractor >
+                ,co::compare< cmp<item> >
+                ,co::less< less<item> >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::ellen_bintree::stat >
+            >::type
+        > set ;
+        test< set >() ;
+    }
+
+} // namespace set
+
+CPPUNIT_TEST_SUITE_REGISTRATION(set::EllenBinTreeSetHdrTest)    ;
@@ -0,0 +1,66 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "set/hdr_ellen_bintree_set.h"
+
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/general_threaded.h>
+#include <cds/urcu/signal_buffered.h>
+#include <cds/urcu/signal_threaded.h>
+#include <cds/container/ellen_bintree_set_rcu.h>
+
+namespace set {
+
+    namespace {
+        template <typename RCU>
+        struct set_of {
+            typedef cc::EllenBinTreeSet< RCU, EllenBinTreeSetHdrTest::key_type, EllenBinTreeSetHdrTest::item,
+                typename cc::ellen_bintree::make_traits<
+                    cc::ellen_bintree::key_extractor< EllenBinTreeSetHdrTest::key_extractor >
+                    ,co::compare< EllenBinTreeSetHdrTest::cmp<EllenBinTreeSetHdrTest::item> >
+                    ,co::item_counter< EllenBinTreeSetHdrTest::simple_item_counter >
+                    ,co::stat< cc::ellen_bintree::stat >
+                >::type
+            > type ;
+        };
+    }
+
+    void EllenBinTreeSetHdrTest::EllenBinTree_RCU_GPI()
+    {
+        test< set_of< cds::urcu::gc< cds::urcu::general_instant<> > >::type >() ;
+    }
+
+    void EllenBinTreeSetHdrTest::EllenBinTree_RCU_GPB()
+    {
+        test< set_of< cds::urcu::gc< cds::urcu::general_buffered<> > >::type >() ;
+    }
+
+    void EllenBinTreeSetHdrTest::EllenBinTree_RCU_GPT()
+    {
+        test< set_of< cds::urcu::gc< cds::urcu::general_threaded<> > >::type >() ;
+    }
+
+    void EllenBinTreeSetHdrTest::EllenBinTree_RCU_SHB()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        test< set_of< cds::urcu::gc< cds::urcu::signal_buffered<> > >::type >() ;
+#endif
+    }
+
+    void EllenBinTreeSetHdrTest::EllenBinTree_RCU_SHT()
+    {
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        test< set_of< cds::urcu::gc< cds::urcu::signal_threaded<> > >::type >() ;
+#endif
+    }
+
+} // namespace set
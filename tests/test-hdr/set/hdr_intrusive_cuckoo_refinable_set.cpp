@@ -182,8 +182,99 @@ namespace set {
         CPPUNIT_MSG( s.statistics() << s.mutex_policy_statistics() ) ;
     }
 
+    void IntrusiveCuckooSetHdrTest::Cuckoo_refinable_vector_basehook_sort_cmp_optimistic()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 0 > >  item_type   ;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::mutex_policy< ci::cuckoo::refinable<> >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::compare< IntrusiveCuckooSetHdrTest::cmp<item_type> >
+                ,ci::cuckoo::optimistic_find< true >
+            >::type
+        > set_type ;
+
+        test_cuckoo<set_type>() ;
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_refinable_vector_basehook_equal_fingerprint32()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 0 > >  item_type   ;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::mutex_policy< ci::cuckoo::refinable<> >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::equal_to< equal_to<item_type> >
+                ,ci::cuckoo::fingerprint< cds::uint32_t >
+            >::type
+        > set_type ;
+
+        test_cuckoo<set_type>() ;
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_refinable_vector_basehook_sort_cmp_fingerprint_optimistic()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 2 > >  item_type   ;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                    ,ci::cuckoo::store_hash< item_type::hash_array_size >
+                > >
+                ,co::mutex_policy< ci::cuckoo::refinable<> >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::compare< IntrusiveCuckooSetHdrTest::cmp<item_type> >
+                ,ci::cuckoo::fingerprint<>
+                ,ci::cuckoo::optimistic_find< true >
+            >::type
+        > set_type ;
+
+        test_cuckoo<set_type>() ;
+    }
+
 
     // base hook, store hash
+    void IntrusiveCuckooSetHdrTest::Cuckoo_refinable_list_basehook_equal_grow_mt()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::list, 0 > >  item_type   ;
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                co::hash< std::tuple< hash1, hash2 > >
+                ,co::mutex_policy< ci::cuckoo::refinable<> >
+                ,co::equal_to< equal_to<item_type> >
+            >::type
+        > set_type ;
+
+        test_grow_mt<set_type>() ;
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_refinable_vector_basehook_sort_cmp_grow_mt()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 0 > >  item_type   ;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::mutex_policy< ci::cuckoo::refinable<> >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::compare< IntrusiveCuckooSetHdrTest::cmp<item_type> >
+            >::type
+        > set_type ;
+
+        test_grow_mt<set_type>() ;
+    }
+
     void IntrusiveCuckooSetHdrTest::Cuckoo_refinable_list_basehook_equal_storehash()
     {
         typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::list, 2 > >  item_type   ;
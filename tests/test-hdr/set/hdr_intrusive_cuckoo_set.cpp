@@ -173,8 +173,99 @@ namespace set {
         CPPUNIT_MSG( s.statistics() << s.mutex_policy_statistics() ) ;
     }
 
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_vector_basehook_equal_optimistic_stat()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 0 > >  item_type   ;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::equal_to< equal_to<item_type> >
+                ,co::stat< ci::cuckoo::stat >
+                ,ci::cuckoo::optimistic_find< true >
+            >::type
+        > set_type ;
+
+        set_type s ;
+        test_with( s )  ;
+        CPPUNIT_MSG( s.statistics() << s.mutex_policy_statistics() ) ;
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_vector_basehook_equal_fingerprint()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 2 > >  item_type   ;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                    ,ci::cuckoo::store_hash< item_type::hash_array_size >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::equal_to< equal_to<item_type> >
+                ,ci::cuckoo::fingerprint<>
+            >::type
+        > set_type ;
+
+        test_cuckoo<set_type>() ;
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_vector_basehook_sort_cmp_fingerprint16_stat()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::vector<8>, 0 > >  item_type   ;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::compare< IntrusiveCuckooSetHdrTest::cmp<item_type> >
+                ,co::stat< ci::cuckoo::stat >
+                ,ci::cuckoo::fingerprint< cds::uint16_t >
+            >::type
+        > set_type ;
+
+        set_type s( 256, 8, 4 )  ;
+        test_with( s )  ;
+        CPPUNIT_MSG( s.statistics() << s.mutex_policy_statistics() ) ;
+    }
+
 
     // base hook, store hash
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_list_basehook_equal_grow_mt()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::list, 0 > >  item_type   ;
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                co::hash< std::tuple< hash1, hash2 > >
+                ,co::equal_to< equal_to<item_type> >
+            >::type
+        > set_type ;
+
+        test_grow_mt<set_type>() ;
+    }
+
+    void IntrusiveCuckooSetHdrTest::Cuckoo_striped_vector_basehook_sort_cmp_grow_mt()
+    {
+        typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::vector<4>, 0 > >  item_type   ;
+
+        typedef ci::CuckooSet< item_type
+            ,ci::cuckoo::make_traits<
+                ci::opt::hook< ci::cuckoo::base_hook<
+                    ci::cuckoo::probeset_type< item_type::probeset_type >
+                > >
+                ,co::hash< std::tuple< hash1, hash2 > >
+                ,co::compare< IntrusiveCuckooSetHdrTest::cmp<item_type> >
+            >::type
+        > set_type ;
+
+        test_grow_mt<set_type>() ;
+    }
+
     void IntrusiveCuckooSetHdrTest::Cuckoo_striped_list_basehook_equal_storehash()
     {
         typedef IntrusiveCuckooSetHdrTest::base_item< ci::cuckoo::node< ci::cuckoo::list, 2 > >  item_type   ;
@@ -10,6 +10,7 @@
 
 
 #include "cppunit/cppunit_proxy.h"
+#include "cppunit/thread.h"
 #include <cds/opt/hash.h>
 
 // cds::intrusive namespace forward declaration
@@ -494,6 +495,86 @@ namespace set {
             test_with( s )  ;
         }
 
+        // Multi-threaded growing from the minimal capacity:
+        // each thread inserts its own range of keys, checks them and erases every other key.
+        // The set is resized many times while other threads are moving the items into new tables
+        template <class Set>
+        class grow_thread: public CppUnitMini::TestThread
+        {
+            typedef typename Set::value_type value_type ;
+
+            virtual TestThread *    clone()
+            {
+                return new grow_thread( *this ) ;
+            }
+
+        public:
+            Set&            m_Set   ;
+            value_type *    m_pArr  ;
+            size_t          m_nPerThread ;
+
+        public:
+            grow_thread( CppUnitMini::ThreadPool& pool, Set& s, value_type * pArr, size_t nPerThread )
+                : CppUnitMini::TestThread( pool )
+                , m_Set( s )
+                , m_pArr( pArr )
+                , m_nPerThread( nPerThread )
+            {}
+            grow_thread( grow_thread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Set( src.m_Set )
+                , m_pArr( src.m_pArr )
+                , m_nPerThread( src.m_nPerThread )
+            {}
+
+            virtual void test()
+            {
+                value_type * pArr = m_pArr + m_nThreadNo * m_nPerThread ;
+                for ( size_t i = 0; i < m_nPerThread; ++i )
+                    CPPUNIT_ASSERT( m_Set.insert( pArr[i] )) ;
+                for ( size_t i = 0; i < m_nPerThread; ++i )
+                    CPPUNIT_ASSERT( m_Set.find( pArr[i].key() )) ;
+                for ( size_t i = 0; i < m_nPerThread; i += 2 )
+                    CPPUNIT_ASSERT( m_Set.erase( pArr[i].key() ) == &pArr[i] ) ;
+            }
+        };
+
+        template <class Set>
+        void test_grow_mt()
+        {
+            typedef typename Set::value_type value_type ;
+
+            size_t const nThreadCount = 4 ;
+            size_t const nPerThread = 8 * 1024 ;
+            size_t const nSize = nThreadCount * nPerThread ;
+
+            value_type * pArr = new value_type[ nSize ] ;
+            auto_dispose<value_type> ad( pArr ) ;
+            for ( size_t i = 0; i < nSize; ++i ) {
+                pArr[i].nKey = (int) i ;
+                pArr[i].nVal = (int) i * 2 ;
+            }
+
+            unsigned int nProbesetSize = Set::node_type::probeset_size ? Set::node_type::probeset_size : 4 ;
+            Set s( 16, nProbesetSize, nProbesetSize / 2 )  ;
+
+            CppUnitMini::ThreadPool pool( *this ) ;
+            pool.add( new grow_thread<Set>( pool, s, pArr, nPerThread ), nThreadCount ) ;
+            pool.run() ;
+
+            CPPUNIT_ASSERT( s.bucket_count() > 16 ) ;
+            CPPUNIT_ASSERT( s.size() == nSize / 2 ) ;
+            for ( size_t i = 0; i < nSize; ++i ) {
+                if ( i & 1 ) {
+                    CPPUNIT_ASSERT_EX( s.find( (int) i ), "Key " << i << " is not found" ) ;
+                }
+                else {
+                    CPPUNIT_ASSERT_EX( !s.find( (int) i ), "Key " << i << " is found" ) ;
+                }
+            }
+            s.clear() ;
+        }
+
         // ***********************************************************
         // Cuckoo hashing (striped)
 
@@ -506,6 +587,11 @@ namespace set {
         void Cuckoo_striped_list_basehook_sort_cmpmix()     ;
         void Cuckoo_striped_vector_basehook_sort_cmpmix()   ;
         void Cuckoo_striped_vector_basehook_sort_cmpmix_stat()   ;
+        void Cuckoo_striped_vector_basehook_equal_optimistic_stat() ;
+        void Cuckoo_striped_vector_basehook_equal_fingerprint() ;
+        void Cuckoo_striped_vector_basehook_sort_cmp_fingerprint16_stat() ;
+        void Cuckoo_striped_list_basehook_equal_grow_mt()     ;
+        void Cuckoo_striped_vector_basehook_sort_cmp_grow_mt() ;
 
         void Cuckoo_striped_list_basehook_equal_storehash()           ;
         void Cuckoo_striped_vector_basehook_equal_storehash()         ;
@@ -546,6 +632,11 @@ namespace set {
         void Cuckoo_refinable_list_basehook_sort_cmpmix()     ;
         void Cuckoo_refinable_vector_basehook_sort_cmpmix()   ;
         void Cuckoo_refinable_vector_basehook_sort_cmpmix_stat() ;
+        void Cuckoo_refinable_vector_basehook_sort_cmp_optimistic() ;
+        void Cuckoo_refinable_vector_basehook_equal_fingerprint32() ;
+        void Cuckoo_refinable_vector_basehook_sort_cmp_fingerprint_optimistic() ;
+        void Cuckoo_refinable_list_basehook_equal_grow_mt()     ;
+        void Cuckoo_refinable_vector_basehook_sort_cmp_grow_mt() ;
 
         void Cuckoo_refinable_list_basehook_equal_storehash()           ;
         void Cuckoo_refinable_vector_basehook_equal_storehash()         ;
@@ -587,6 +678,11 @@ namespace set {
             CPPUNIT_TEST( Cuckoo_striped_list_basehook_sort_cmpmix)
             CPPUNIT_TEST( Cuckoo_striped_vector_basehook_sort_cmpmix)
             CPPUNIT_TEST( Cuckoo_striped_vector_basehook_sort_cmpmix_stat)
+            CPPUNIT_TEST( Cuckoo_striped_vector_basehook_equal_optimistic_stat)
+            CPPUNIT_TEST( Cuckoo_striped_vector_basehook_equal_fingerprint)
+            CPPUNIT_TEST( Cuckoo_striped_vector_basehook_sort_cmp_fingerprint16_stat)
+            CPPUNIT_TEST( Cuckoo_striped_list_basehook_equal_grow_mt)
+            CPPUNIT_TEST( Cuckoo_striped_vector_basehook_sort_cmp_grow_mt)
 
             CPPUNIT_TEST( Cuckoo_striped_list_basehook_equal_storehash)
             CPPUNIT_TEST( Cuckoo_striped_vector_basehook_equal_storehash)
@@ -627,6 +723,11 @@ namespace set {
             CPPUNIT_TEST( Cuckoo_refinable_list_basehook_sort_cmpmix)
             CPPUNIT_TEST( Cuckoo_refinable_vector_basehook_sort_cmpmix)
             CPPUNIT_TEST( Cuckoo_refinable_vector_basehook_sort_cmpmix_stat)
+            CPPUNIT_TEST( Cuckoo_refinable_vector_basehook_sort_cmp_optimistic)
+            CPPUNIT_TEST( Cuckoo_refinable_vector_basehook_equal_fingerprint32)
+            CPPUNIT_TEST( Cuckoo_refinable_vector_basehook_sort_cmp_fingerprint_optimistic)
+            CPPUNIT_TEST( Cuckoo_refinable_list_basehook_equal_grow_mt)
+            CPPUNIT_TEST( Cuckoo_refinable_vector_basehook_sort_cmp_grow_mt)
 
             CPPUNIT_TEST( Cuckoo_refinable_list_basehook_equal_storehash)
             CPPUNIT_TEST( Cuckoo_refinable_vector_basehook_equal_storehash)
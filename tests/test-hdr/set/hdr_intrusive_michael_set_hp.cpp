@@ -33,7 +33,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::HP_base_less()
@@ -54,7 +54,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::HP_base_cmpmix()
@@ -77,7 +77,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::HP_member_cmp()
@@ -101,7 +101,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::HP_member_less()
@@ -125,7 +125,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::HP_member_cmpmix()
@@ -151,7 +151,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
 
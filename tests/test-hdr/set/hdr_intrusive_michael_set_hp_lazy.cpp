@@ -34,7 +34,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::HP_base_less_lazy()
@@ -55,7 +55,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::HP_base_cmpmix_lazy()
@@ -78,7 +78,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::HP_member_cmp_lazy()
@@ -102,7 +102,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::HP_member_less_lazy()
@@ -126,7 +126,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::HP_member_cmpmix_lazy()
@@ -152,7 +152,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
 
@@ -33,7 +33,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::PTB_base_less_lazy()
@@ -54,7 +54,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::PTB_base_cmpmix_lazy()
@@ -77,7 +77,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::PTB_member_cmp_lazy()
@@ -101,7 +101,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::PTB_member_less_lazy()
@@ -125,7 +125,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::PTB_member_cmpmix_lazy()
@@ -151,7 +151,7 @@ namespace set {
             >::type
         > set ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
 
@@ -489,6 +489,100 @@ namespace set {
             test_iter<Set>()    ;
         }
 
+        template <class Set>
+        void test_hp_int()
+        {
+            test_int<Set>() ;
+
+            Set s( 30, 2 )  ;
+            test_hp_int_with( s ) ;
+        }
+
+        // get() / extract() tests for HP-like GC
+        template <class Set>
+        void test_hp_int_with( Set& s )
+        {
+            typedef typename Set::value_type    value_type  ;
+            typedef typename Set::guarded_ptr   guarded_ptr ;
+
+            value_type v1( 10, 50 ) ;
+            value_type v2( 5, 25  ) ;
+            value_type v3( 20, 100 );
+
+            {
+                CPPUNIT_ASSERT( s.insert( v1 )) ;
+                CPPUNIT_ASSERT( s.insert( v2 )) ;
+                CPPUNIT_ASSERT( s.insert( v3 )) ;
+
+                {
+                    guarded_ptr gp ;
+                    CPPUNIT_ASSERT( gp.empty() ) ;
+                    CPPUNIT_ASSERT( s.get( gp, 10 )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v1 ) ;
+                    CPPUNIT_ASSERT( gp->nVal == 50 ) ;
+
+                    CPPUNIT_ASSERT( !s.get( gp, 15 )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v1 ) ;
+
+                    CPPUNIT_ASSERT( s.get_with( gp, 5, less<value_type>() )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v2 ) ;
+
+                    gp.release() ;
+                    CPPUNIT_ASSERT( gp.empty() ) ;
+                }
+
+                {
+                    guarded_ptr gp ;
+                    CPPUNIT_ASSERT( s.extract( gp, 10 )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v1 ) ;
+                    CPPUNIT_ASSERT( !s.find( 10 ))  ;
+                    CPPUNIT_ASSERT( s.find( 5 ))  ;
+                    CPPUNIT_ASSERT( s.find( 20 ))  ;
+                    CPPUNIT_ASSERT( !s.extract( gp, 10 )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v1 ) ;
+
+                    // The item extracted is guarded and cannot be disposed
+                    Set::gc::force_dispose() ;
+                    CPPUNIT_ASSERT( v1.nDisposeCount == 0 ) ;
+                }
+                Set::gc::force_dispose() ;
+                CPPUNIT_ASSERT( v1.nDisposeCount == 1 ) ;
+
+#           ifdef CDS_MOVE_SEMANTICS_SUPPORT
+                {
+                    guarded_ptr gp( s.extract_with( 5, less<value_type>() )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v2 ) ;
+                    CPPUNIT_ASSERT( !s.find( 5 ))  ;
+
+                    gp = s.get( 20 ) ;
+                    CPPUNIT_ASSERT( gp.get() == &v3 ) ;
+                    gp = s.get( 5 ) ;
+                    CPPUNIT_ASSERT( gp.empty() ) ;
+
+                    gp = s.extract( 20 ) ;
+                    CPPUNIT_ASSERT( gp.get() == &v3 ) ;
+                    gp = s.extract( 20 ) ;
+                    CPPUNIT_ASSERT( gp.empty() ) ;
+                }
+#           else
+                {
+                    guarded_ptr gp ;
+                    CPPUNIT_ASSERT( s.extract_with( gp, 5, less<value_type>() )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v2 ) ;
+                    CPPUNIT_ASSERT( s.extract( gp, 20 )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v3 ) ;
+                }
+#           endif
+                CPPUNIT_ASSERT( s.empty() ) ;
+                CPPUNIT_ASSERT( check_size( s, 0 )) ;
+            }
+
+            Set::gc::force_dispose() ;
+            CPPUNIT_ASSERT( v1.nDisposeCount == 1 ) ;
+            CPPUNIT_ASSERT( v2.nDisposeCount == 1 ) ;
+            CPPUNIT_ASSERT( v3.nDisposeCount == 1 ) ;
+        }
+
         template <class Set>
         void test_iter()
         {
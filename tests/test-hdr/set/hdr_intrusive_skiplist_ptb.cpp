@@ -29,7 +29,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_less()
@@ -45,7 +45,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_cmpmix()
@@ -62,7 +62,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_cmp_stat()
@@ -79,7 +79,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_less_stat()
@@ -96,7 +96,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_cmpmix_stat()
@@ -114,7 +114,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_cmp_xorshift()
@@ -131,7 +131,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_less_xorshift()
@@ -148,7 +148,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_cmpmix_xorshift()
@@ -166,7 +166,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
         void IntrusiveSkipListSet::skiplist_ptb_base_cmp_xorshift_stat()
@@ -184,7 +184,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_less_xorshift_stat()
@@ -202,7 +202,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_cmpmix_xorshift_stat()
@@ -221,7 +221,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
 
@@ -240,7 +240,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_less_pascal()
@@ -257,7 +257,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_cmpmix_pascal()
@@ -275,7 +275,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
         void IntrusiveSkipListSet::skiplist_ptb_base_cmp_pascal_stat()
@@ -293,7 +293,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_less_pascal_stat()
@@ -311,7 +311,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_base_cmpmix_pascal_stat()
@@ -330,7 +330,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
 }   // namespace set
@@ -28,7 +28,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_less()
@@ -44,7 +44,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_cmpmix()
@@ -61,7 +61,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_cmp_stat()
@@ -78,7 +78,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_less_stat()
@@ -95,7 +95,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_cmpmix_stat()
@@ -113,7 +113,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_cmp_xorshift()
@@ -130,7 +130,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_less_xorshift()
@@ -147,7 +147,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_cmpmix_xorshift()
@@ -165,7 +165,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
         void IntrusiveSkipListSet::skiplist_ptb_member_cmp_xorshift_stat()
@@ -183,7 +183,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_less_xorshift_stat()
@@ -201,7 +201,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_cmpmix_xorshift_stat()
@@ -220,7 +220,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
 
@@ -238,7 +238,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_less_pascal()
@@ -255,7 +255,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_cmpmix_pascal()
@@ -273,7 +273,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
         void IntrusiveSkipListSet::skiplist_ptb_member_cmp_pascal_stat()
@@ -291,7 +291,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_less_pascal_stat()
@@ -309,7 +309,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
     void IntrusiveSkipListSet::skiplist_ptb_member_cmpmix_pascal_stat()
@@ -328,7 +328,7 @@ namespace set {
             >::type
         >   set_type ;
 
-        test_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
+        test_hp_skiplist<set_type, misc::print_skiplist_stat<set_type::stat> >() ;
     }
 
 } // namespace set
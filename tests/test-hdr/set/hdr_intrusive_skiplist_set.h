@@ -29,6 +29,220 @@ namespace set {
             test_skiplist_<Set, PrintStat >() ;
         }
 
+        template <class Set, typename PrintStat>
+        void test_hp_skiplist()
+        {
+            test_skiplist<Set, PrintStat>() ;
+
+            {
+                Set s ;
+                base_class::test_hp_int_with( s ) ;
+            }
+
+            test_skiplist_bounds<Set>() ;
+            test_skiplist_extract_minmax<Set>() ;
+        }
+
+        template <class Set>
+        void test_skiplist_extract_minmax()
+        {
+            typedef typename Set::value_type        value_type  ;
+            typedef typename Set::guarded_ptr       guarded_ptr ;
+
+            value_type  v[100]  ;
+            value_type  vMove[10] ;
+            int const nSize = (int)( sizeof(v) / sizeof(v[0]) ) ;
+
+            Set s ;
+            {
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( !s.extract_min( gp )) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+                CPPUNIT_ASSERT( !s.extract_max( gp )) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+            }
+
+            // Keys 0..99 are inserted in shuffled order
+            for ( int i = 0; i < nSize; ++i ) {
+                int nKey = (i * 37) % nSize ;
+                v[nKey].nKey = nKey ;
+                v[nKey].nVal = i ;
+                CPPUNIT_ASSERT( s.insert( v[nKey] )) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, nSize )) ;
+
+            {
+                guarded_ptr gp ;
+                int nMin = 0 ;
+                int nMax = nSize - 1 ;
+                while ( nMin < nMax ) {
+                    CPPUNIT_ASSERT( s.extract_min( gp )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v[nMin] ) ;
+                    CPPUNIT_ASSERT( s.extract_max( gp )) ;
+                    CPPUNIT_ASSERT( gp.get() == &v[nMax] ) ;
+                    ++nMin ;
+                    --nMax ;
+                }
+                CPPUNIT_ASSERT( s.empty() ) ;
+                CPPUNIT_ASSERT( !s.extract_min( gp )) ;
+                CPPUNIT_ASSERT( !s.extract_max( gp )) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, 0 )) ;
+
+            Set::gc::force_dispose() ;
+            for ( int i = 0; i < nSize; ++i ) {
+                CPPUNIT_ASSERT( v[i].nDisposeCount == 1 ) ;
+            }
+
+#       ifdef CDS_MOVE_SEMANTICS_SUPPORT
+            for ( int i = 0; i < (int)( sizeof(vMove) / sizeof(vMove[0]) ); ++i ) {
+                vMove[i].nKey = i ;
+                CPPUNIT_ASSERT( s.insert( vMove[i] )) ;
+            }
+            {
+                guarded_ptr gp( s.extract_min() ) ;
+                CPPUNIT_ASSERT( gp.get() == &vMove[0] ) ;
+                gp = s.extract_max() ;
+                CPPUNIT_ASSERT( gp.get() == &vMove[9] ) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, 8 )) ;
+#       endif
+
+            s.clear() ;
+            CPPUNIT_ASSERT( s.empty() ) ;
+            Set::gc::force_dispose() ;
+        }
+
+        template <class Set>
+        void test_skiplist_bounds()
+        {
+            typedef typename Set::value_type        value_type  ;
+            typedef typename Set::guarded_ptr       guarded_ptr ;
+            typedef typename Set::range_cursor      range_cursor ;
+            typedef typename base_class::less<value_type>   less    ;
+
+            value_type  v[100]  ;
+            value_type  vNew    ;
+            int const nSize = (int)( sizeof(v) / sizeof(v[0]) ) ;
+
+            Set s ;
+            {
+                range_cursor cur( s ) ;
+                CPPUNIT_ASSERT( !cur.first() ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+                CPPUNIT_ASSERT( !cur.lower_bound( 0 )) ;
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( !s.lower_bound( gp, 0 )) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+            }
+
+            // Keys are 0, 2, 4, ..., 198
+            for ( int i = 0; i < nSize; ++i ) {
+                v[i].nKey = i * 2 ;
+                v[i].nVal = i ;
+                CPPUNIT_ASSERT( s.insert( v[i] )) ;
+            }
+
+            {
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( s.lower_bound( gp, 5 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 6 ) ;
+                CPPUNIT_ASSERT( s.lower_bound( gp, 6 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 6 ) ;
+                CPPUNIT_ASSERT( s.upper_bound( gp, 6 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 8 ) ;
+                CPPUNIT_ASSERT( s.lower_bound_with( gp, 7, less() )) ;
+                CPPUNIT_ASSERT( gp->nKey == 8 ) ;
+                CPPUNIT_ASSERT( s.upper_bound_with( gp, -1, less() )) ;
+                CPPUNIT_ASSERT( gp->nKey == 0 ) ;
+
+                CPPUNIT_ASSERT( !s.upper_bound( gp, nSize * 2 - 2 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 0 ) ;
+                CPPUNIT_ASSERT( !s.lower_bound( gp, nSize * 2 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 0 ) ;
+                CPPUNIT_ASSERT( s.lower_bound( gp, nSize * 2 - 2 )) ;
+                CPPUNIT_ASSERT( gp->nKey == nSize * 2 - 2 ) ;
+            }
+#       ifdef CDS_MOVE_SEMANTICS_SUPPORT
+            {
+                guarded_ptr gp( s.lower_bound( 11 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 12 ) ;
+                gp = s.upper_bound_with( 12, less() ) ;
+                CPPUNIT_ASSERT( gp->nKey == 14 ) ;
+                gp = s.upper_bound( nSize * 2 ) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+            }
+#       endif
+
+            {
+                range_cursor cur( s ) ;
+
+                // Full scan
+                int nCount = 0 ;
+                int nPrevKey = -1 ;
+                for ( bool bOk = cur.first(); bOk; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->nKey > nPrevKey ) ;
+                    nPrevKey = (*cur).nKey ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == nSize ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+
+                // Range [11, 31)
+                nCount = 0 ;
+                for ( bool bOk = cur.lower_bound( 11 ); bOk && cur->nKey < 31; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->nKey == 12 + nCount * 2 ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == 10 ) ;
+
+                // Range (10, 20]
+                nCount = 0 ;
+                for ( bool bOk = cur.upper_bound_with( 10, less() ); bOk && cur->nKey <= 20; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->nKey == 12 + nCount * 2 ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == 5 ) ;
+
+                // The current item and its successor are deleted
+                CPPUNIT_ASSERT( cur.lower_bound_with( 20, less() )) ;
+                CPPUNIT_ASSERT( cur.get() == &v[10] ) ;
+                CPPUNIT_ASSERT( s.unlink( v[10] )) ;
+                CPPUNIT_ASSERT( s.erase( 22 )) ;
+                CPPUNIT_ASSERT( cur->nKey == 20 ) ;
+                CPPUNIT_ASSERT( cur.next() ) ;
+                CPPUNIT_ASSERT( cur->nKey == 24 ) ;
+
+                // The successor is deleted
+                CPPUNIT_ASSERT( s.erase( 26 )) ;
+                CPPUNIT_ASSERT( cur.next() ) ;
+                CPPUNIT_ASSERT( cur->nKey == 28 ) ;
+
+                // A new successor is inserted
+                CPPUNIT_ASSERT( cur.upper_bound( 17 )) ;
+                CPPUNIT_ASSERT( cur->nKey == 18 ) ;
+                vNew.nKey = 19 ;
+                CPPUNIT_ASSERT( s.insert( vNew )) ;
+                CPPUNIT_ASSERT( cur.next() ) ;
+                CPPUNIT_ASSERT( cur->nKey == 19 ) ;
+                CPPUNIT_ASSERT( cur.next() ) ;
+                CPPUNIT_ASSERT( cur->nKey == 24 ) ;
+
+                CPPUNIT_ASSERT( cur.lower_bound( nSize * 2 - 2 )) ;
+                CPPUNIT_ASSERT( !cur.next() ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+
+                CPPUNIT_ASSERT( cur.first() ) ;
+                cur.release() ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, nSize - 2 )) ;
+
+            s.clear() ;
+            CPPUNIT_ASSERT( s.empty() ) ;
+            Set::gc::force_dispose() ;
+        }
+
         template <class Set, typename PrintStat>
         void test_skiplist_()
         {
@@ -451,6 +665,45 @@ namespace set {
         void skiplist_ptb_member_less_pascal_stat() ;
         void skiplist_ptb_member_cmpmix_pascal_stat() ;
 
+        // Skip-list - gc::EBR
+        void skiplist_ebr_base_cmp() ;
+        void skiplist_ebr_base_less() ;
+        void skiplist_ebr_base_cmpmix() ;
+        void skiplist_ebr_base_cmp_stat() ;
+        void skiplist_ebr_base_less_stat() ;
+        void skiplist_ebr_base_cmpmix_stat() ;
+        void skiplist_ebr_base_cmp_xorshift() ;
+        void skiplist_ebr_base_less_xorshift() ;
+        void skiplist_ebr_base_cmpmix_xorshift() ;
+        void skiplist_ebr_base_cmp_xorshift_stat() ;
+        void skiplist_ebr_base_less_xorshift_stat() ;
+        void skiplist_ebr_base_cmpmix_xorshift_stat() ;
+        void skiplist_ebr_base_cmp_pascal() ;
+        void skiplist_ebr_base_less_pascal() ;
+        void skiplist_ebr_base_cmpmix_pascal() ;
+        void skiplist_ebr_base_cmp_pascal_stat() ;
+        void skiplist_ebr_base_less_pascal_stat() ;
+        void skiplist_ebr_base_cmpmix_pascal_stat() ;
+
+        void skiplist_ebr_member_cmp() ;
+        void skiplist_ebr_member_less() ;
+        void skiplist_ebr_member_cmpmix() ;
+        void skiplist_ebr_member_cmp_stat() ;
+        void skiplist_ebr_member_less_stat() ;
+        void skiplist_ebr_member_cmpmix_stat() ;
+        void skiplist_ebr_member_cmp_xorshift() ;
+        void skiplist_ebr_member_less_xorshift() ;
+        void skiplist_ebr_member_cmpmix_xorshift() ;
+        void skiplist_ebr_member_cmp_xorshift_stat() ;
+        void skiplist_ebr_member_less_xorshift_stat() ;
+        void skiplist_ebr_member_cmpmix_xorshift_stat() ;
+        void skiplist_ebr_member_cmp_pascal() ;
+        void skiplist_ebr_member_less_pascal() ;
+        void skiplist_ebr_member_cmpmix_pascal() ;
+        void skiplist_ebr_member_cmp_pascal_stat() ;
+        void skiplist_ebr_member_less_pascal_stat() ;
+        void skiplist_ebr_member_cmpmix_pascal_stat() ;
+
         // Skip-list - gc::nogc
         void skiplist_nogc_base_cmp() ;
         void skiplist_nogc_base_less() ;
@@ -586,6 +839,44 @@ namespace set {
             CPPUNIT_TEST(skiplist_ptb_member_less_pascal_stat)
             CPPUNIT_TEST(skiplist_ptb_member_cmpmix_pascal_stat)
 
+            CPPUNIT_TEST(skiplist_ebr_base_cmp)
+            CPPUNIT_TEST(skiplist_ebr_base_less)
+            CPPUNIT_TEST(skiplist_ebr_base_cmpmix)
+            CPPUNIT_TEST(skiplist_ebr_base_cmp_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_less_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_cmpmix_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_cmp_xorshift)
+            CPPUNIT_TEST(skiplist_ebr_base_less_xorshift)
+            CPPUNIT_TEST(skiplist_ebr_base_cmpmix_xorshift)
+            CPPUNIT_TEST(skiplist_ebr_base_cmp_xorshift_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_less_xorshift_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_cmpmix_xorshift_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_cmp_pascal)
+            CPPUNIT_TEST(skiplist_ebr_base_less_pascal)
+            CPPUNIT_TEST(skiplist_ebr_base_cmpmix_pascal)
+            CPPUNIT_TEST(skiplist_ebr_base_cmp_pascal_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_less_pascal_stat)
+            CPPUNIT_TEST(skiplist_ebr_base_cmpmix_pascal_stat)
+
+            CPPUNIT_TEST(skiplist_ebr_member_cmp)
+            CPPUNIT_TEST(skiplist_ebr_member_less)
+            CPPUNIT_TEST(skiplist_ebr_member_cmpmix)
+            CPPUNIT_TEST(skiplist_ebr_member_cmp_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_less_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_cmpmix_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_cmp_xorshift)
+            CPPUNIT_TEST(skiplist_ebr_member_less_xorshift)
+            CPPUNIT_TEST(skiplist_ebr_member_cmpmix_xorshift)
+            CPPUNIT_TEST(skiplist_ebr_member_cmp_xorshift_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_less_xorshift_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_cmpmix_xorshift_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_cmp_pascal)
+            CPPUNIT_TEST(skiplist_ebr_member_less_pascal)
+            CPPUNIT_TEST(skiplist_ebr_member_cmpmix_pascal)
+            CPPUNIT_TEST(skiplist_ebr_member_cmp_pascal_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_less_pascal_stat)
+            CPPUNIT_TEST(skiplist_ebr_member_cmpmix_pascal_stat)
+
             CPPUNIT_TEST(skiplist_nogc_base_cmp)
             CPPUNIT_TEST(skiplist_nogc_base_less)
             CPPUNIT_TEST(skiplist_nogc_base_cmpmix)
@@ -25,6 +25,24 @@ namespace set {
             }
         };
 
+        struct extract_minmax_functor
+        {
+            int nKey    ;
+            int nCount  ;
+
+            extract_minmax_functor()
+                : nKey( -1 )
+                , nCount( 0 )
+            {}
+
+            template <typename Item>
+            void operator()( Item& item )
+            {
+                nKey = item.nKey ;
+                ++nCount ;
+            }
+        };
+
     protected:
 
         template <class Set, typename PrintStat>
@@ -36,6 +54,163 @@ namespace set {
             }
 
             test_skiplist_<Set, PrintStat >() ;
+            test_skiplist_bounds<Set>() ;
+            test_skiplist_extract_minmax<Set>() ;
+        }
+
+        template <class Set>
+        void test_skiplist_extract_minmax()
+        {
+            typedef typename Set::value_type        value_type  ;
+
+            value_type  v[100]  ;
+            int const nSize = (int)( sizeof(v) / sizeof(v[0]) ) ;
+
+            Set s ;
+            {
+                extract_minmax_functor f ;
+                CPPUNIT_ASSERT( !s.extract_min( cds::ref(f) )) ;
+                CPPUNIT_ASSERT( !s.extract_max( cds::ref(f) )) ;
+                CPPUNIT_ASSERT( f.nCount == 0 ) ;
+            }
+
+            // Keys 0..99 are inserted in shuffled order
+            for ( int i = 0; i < nSize; ++i ) {
+                int nKey = (i * 37) % nSize ;
+                v[nKey].nKey = nKey ;
+                v[nKey].nVal = i ;
+                CPPUNIT_ASSERT( s.insert( v[nKey] )) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, nSize )) ;
+
+            {
+                extract_minmax_functor f ;
+                int nMin = 0 ;
+                int nMax = nSize - 1 ;
+                while ( nMin < nMax ) {
+                    CPPUNIT_ASSERT( s.extract_min( cds::ref(f) )) ;
+                    CPPUNIT_ASSERT( f.nKey == nMin ) ;
+                    CPPUNIT_ASSERT( s.extract_max( cds::ref(f) )) ;
+                    CPPUNIT_ASSERT( f.nKey == nMax ) ;
+                    ++nMin ;
+                    --nMax ;
+                }
+                CPPUNIT_ASSERT( f.nCount == nSize ) ;
+                CPPUNIT_ASSERT( s.empty() ) ;
+                CPPUNIT_ASSERT( !s.extract_min( cds::ref(f) )) ;
+                CPPUNIT_ASSERT( !s.extract_max( cds::ref(f) )) ;
+                CPPUNIT_ASSERT( f.nCount == nSize ) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, 0 )) ;
+
+            Set::gc::force_dispose() ;
+            for ( int i = 0; i < nSize; ++i ) {
+                CPPUNIT_ASSERT( v[i].nDisposeCount == 1 ) ;
+            }
+        }
+
+        template <class Set>
+        void test_skiplist_bounds()
+        {
+            typedef typename Set::gc::scoped_lock   rcu_lock ;
+            typedef typename Set::value_type        value_type  ;
+            typedef typename Set::range_cursor      range_cursor ;
+            typedef typename base_class::less<value_type>   less    ;
+
+            value_type  v[100]  ;
+            value_type  vNew    ;
+            int const nSize = (int)( sizeof(v) / sizeof(v[0]) ) ;
+
+            Set s ;
+            {
+                rcu_lock l ;
+                range_cursor cur( s ) ;
+                CPPUNIT_ASSERT( !cur.first() ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+                CPPUNIT_ASSERT( s.lower_bound( 0 ) == NULL ) ;
+            }
+
+            // Keys are 0, 2, 4, ..., 198
+            for ( int i = 0; i < nSize; ++i ) {
+                v[i].nKey = i * 2 ;
+                v[i].nVal = i ;
+                CPPUNIT_ASSERT( s.insert( v[i] )) ;
+            }
+
+            {
+                rcu_lock l ;
+                value_type * p ;
+                p = s.lower_bound( 5 ) ;
+                CPPUNIT_ASSERT( p && p->nKey == 6 ) ;
+                p = s.lower_bound( 6 ) ;
+                CPPUNIT_ASSERT( p && p->nKey == 6 ) ;
+                p = s.upper_bound( 6 ) ;
+                CPPUNIT_ASSERT( p && p->nKey == 8 ) ;
+                p = s.lower_bound_with( 7, less() ) ;
+                CPPUNIT_ASSERT( p && p->nKey == 8 ) ;
+                p = s.upper_bound_with( -1, less() ) ;
+                CPPUNIT_ASSERT( p && p->nKey == 0 ) ;
+                CPPUNIT_ASSERT( s.upper_bound( nSize * 2 - 2 ) == NULL ) ;
+                CPPUNIT_ASSERT( s.lower_bound( nSize * 2 ) == NULL ) ;
+                p = s.lower_bound( nSize * 2 - 2 ) ;
+                CPPUNIT_ASSERT( p && p->nKey == nSize * 2 - 2 ) ;
+            }
+
+            {
+                rcu_lock l ;
+                range_cursor cur( s ) ;
+
+                // Full scan
+                int nCount = 0 ;
+                int nPrevKey = -1 ;
+                for ( bool bOk = cur.first(); bOk; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->nKey > nPrevKey ) ;
+                    nPrevKey = (*cur).nKey ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == nSize ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+
+                // Range [11, 31)
+                nCount = 0 ;
+                for ( bool bOk = cur.lower_bound( 11 ); bOk && cur->nKey < 31; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->nKey == 12 + nCount * 2 ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == 10 ) ;
+
+                // Range (10, 20]
+                nCount = 0 ;
+                for ( bool bOk = cur.upper_bound_with( 10, less() ); bOk && cur->nKey <= 20; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->nKey == 12 + nCount * 2 ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == 5 ) ;
+
+            }
+
+            // New item; insert() cannot be called under RCU lock
+            vNew.nKey = 19 ;
+            CPPUNIT_ASSERT( s.insert( vNew )) ;
+            {
+                rcu_lock l ;
+                range_cursor cur( s ) ;
+                CPPUNIT_ASSERT( cur.upper_bound( 17 )) ;
+                CPPUNIT_ASSERT( cur->nKey == 18 ) ;
+                CPPUNIT_ASSERT( cur.next() ) ;
+                CPPUNIT_ASSERT( cur->nKey == 19 ) ;
+                CPPUNIT_ASSERT( cur.next() ) ;
+                CPPUNIT_ASSERT( cur->nKey == 20 ) ;
+
+                CPPUNIT_ASSERT( cur.lower_bound( nSize * 2 - 2 )) ;
+                CPPUNIT_ASSERT( !cur.next() ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, nSize + 1 )) ;
+
+            s.clear() ;
+            CPPUNIT_ASSERT( s.empty() ) ;
+            Set::gc::force_dispose() ;
         }
 
         template <class Set, typename PrintStat>
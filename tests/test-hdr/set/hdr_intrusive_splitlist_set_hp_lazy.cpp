@@ -37,7 +37,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_HP_base_less_lazy()
@@ -60,7 +60,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_HP_base_cmpmix_lazy()
@@ -85,7 +85,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_HP_member_cmp_lazy()
@@ -111,7 +111,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_HP_member_less_lazy()
@@ -137,7 +137,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_HP_member_cmpmix_lazy()
@@ -164,7 +164,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
 
@@ -190,7 +190,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_HP_base_less_lazy()
@@ -214,7 +214,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_HP_base_cmpmix_lazy()
@@ -239,7 +239,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_HP_member_cmp_lazy()
@@ -266,7 +266,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_HP_member_less_lazy()
@@ -293,7 +293,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_HP_member_cmpmix_lazy()
@@ -321,7 +321,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
 
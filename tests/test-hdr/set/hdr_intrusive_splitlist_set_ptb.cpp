@@ -36,7 +36,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_PTB_base_less()
@@ -59,7 +59,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_PTB_base_cmpmix()
@@ -84,7 +84,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_PTB_member_cmp()
@@ -109,7 +109,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_PTB_member_less()
@@ -135,7 +135,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_PTB_member_cmpmix()
@@ -163,7 +163,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
 
@@ -189,7 +189,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_PTB_base_less()
@@ -213,7 +213,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_PTB_base_cmpmix()
@@ -238,7 +238,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_PTB_member_cmp()
@@ -265,7 +265,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_PTB_member_less()
@@ -292,7 +292,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_PTB_member_cmpmix()
@@ -320,7 +320,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
 
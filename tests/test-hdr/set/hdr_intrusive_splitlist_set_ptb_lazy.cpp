@@ -36,7 +36,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_PTB_base_less_lazy()
@@ -59,7 +59,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_PTB_base_cmpmix_lazy()
@@ -84,7 +84,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_PTB_member_cmp_lazy()
@@ -110,7 +110,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_PTB_member_less_lazy()
@@ -136,7 +136,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_dyn_PTB_member_cmpmix_lazy()
@@ -163,7 +163,7 @@ namespace set {
         > set ;
         static_assert( set::options::dynamic_bucket_table, "Set has static bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
 
@@ -189,7 +189,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_PTB_base_less_lazy()
@@ -213,7 +213,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_PTB_base_cmpmix_lazy()
@@ -238,7 +238,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_PTB_member_cmp_lazy()
@@ -265,7 +265,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_PTB_member_less_lazy()
@@ -292,7 +292,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
     void IntrusiveHashSetHdrTest::split_st_PTB_member_cmpmix_lazy()
@@ -320,7 +320,7 @@ namespace set {
         > set ;
         static_assert( !set::options::dynamic_bucket_table, "Set has dynamic bucket table" )    ;
 
-        test_int<set>()    ;
+        test_hp_int<set>()    ;
     }
 
 
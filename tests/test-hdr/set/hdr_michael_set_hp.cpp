@@ -45,7 +45,7 @@ namespace set {
 
         // traits-based version
         typedef cc::MichaelHashSet< cds::gc::HP, list, set_traits > set     ;
-        test_int< set >()  ;
+        test_hp_int< set >()  ;
 
         // option-based version
         typedef cc::MichaelHashSet< cds::gc::HP, list,
@@ -54,7 +54,18 @@ namespace set {
                 ,cc::opt::item_counter< simple_item_counter >
             >::type
         > opt_set   ;
-        test_int< opt_set >()  ;
+        test_hp_int< opt_set >()  ;
+
+        // resizable bucket table
+        typedef cc::MichaelHashSet< cds::gc::HP, list,
+            cc::michael_set::make_traits<
+                cc::opt::hash< hash_int >
+                ,cc::opt::item_counter< simple_item_counter >
+                ,cc::michael_set::resizable< true >
+            >::type
+        > resizable_set   ;
+        test_hp_int< resizable_set >()  ;
+        test_resizable< resizable_set >()  ;
     }
 
     void HashSetHdrTest::Michael_HP_less()
@@ -63,7 +74,7 @@ namespace set {
 
         // traits-based version
         typedef cc::MichaelHashSet< cds::gc::HP, list, set_traits > set     ;
-        test_int< set >()  ;
+        test_hp_int< set >()  ;
 
         // option-based version
         typedef cc::MichaelHashSet< cds::gc::HP, list,
@@ -72,7 +83,7 @@ namespace set {
                 ,cc::opt::item_counter< simple_item_counter >
             >::type
         > opt_set   ;
-        test_int< opt_set >()  ;
+        test_hp_int< opt_set >()  ;
     }
 
     void HashSetHdrTest::Michael_HP_cmpmix()
@@ -81,7 +92,7 @@ namespace set {
 
         // traits-based version
         typedef cc::MichaelHashSet< cds::gc::HP, list, set_traits > set     ;
-        test_int< set >()  ;
+        test_hp_int< set >()  ;
 
         // option-based version
         typedef cc::MichaelHashSet< cds::gc::HP, list,
@@ -90,7 +101,7 @@ namespace set {
                 ,cc::opt::item_counter< simple_item_counter >
             >::type
         > opt_set   ;
-        test_int< opt_set >()  ;
+        test_hp_int< opt_set >()  ;
     }
 
 
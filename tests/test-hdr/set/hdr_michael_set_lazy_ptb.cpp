@@ -45,7 +45,7 @@ namespace set {
 
         // traits-based version
         typedef cc::MichaelHashSet< cds::gc::PTB, list, set_traits > set     ;
-        test_int< set >()  ;
+        test_hp_int< set >()  ;
 
         // option-based version
         typedef cc::MichaelHashSet< cds::gc::PTB, list,
@@ -54,7 +54,7 @@ namespace set {
                 ,cc::opt::item_counter< simple_item_counter >
             >::type
         > opt_set   ;
-        test_int< opt_set >()  ;
+        test_hp_int< opt_set >()  ;
     }
 
     void HashSetHdrTest::Lazy_PTB_less()
@@ -63,7 +63,7 @@ namespace set {
 
         // traits-based version
         typedef cc::MichaelHashSet< cds::gc::PTB, list, set_traits > set     ;
-        test_int< set >()  ;
+        test_hp_int< set >()  ;
 
         // option-based version
         typedef cc::MichaelHashSet< cds::gc::PTB, list,
@@ -72,7 +72,7 @@ namespace set {
                 ,cc::opt::item_counter< simple_item_counter >
             >::type
         > opt_set   ;
-        test_int< opt_set >()  ;
+        test_hp_int< opt_set >()  ;
     }
 
     void HashSetHdrTest::Lazy_PTB_cmpmix()
@@ -81,7 +81,7 @@ namespace set {
 
         // traits-based version
         typedef cc::MichaelHashSet< cds::gc::PTB, list, set_traits > set     ;
-        test_int< set >()  ;
+        test_hp_int< set >()  ;
 
         // option-based version
         typedef cc::MichaelHashSet< cds::gc::PTB, list,
@@ -90,7 +90,7 @@ namespace set {
                 ,cc::opt::item_counter< simple_item_counter >
             >::type
         > opt_set   ;
-        test_int< opt_set >()  ;
+        test_hp_int< opt_set >()  ;
     }
 
 
@@ -45,7 +45,7 @@ namespace set {
 
         // traits-based version
         typedef cc::MichaelHashSet< cds::gc::PTB, list, set_traits > set     ;
-        test_int< set >()  ;
+        test_hp_int< set >()  ;
 
         // option-based version
         typedef cc::MichaelHashSet< cds::gc::PTB, list,
@@ -54,7 +54,18 @@ namespace set {
                 ,cc::opt::item_counter< simple_item_counter >
             >::type
         > opt_set   ;
-        test_int< opt_set >()  ;
+        test_hp_int< opt_set >()  ;
+
+        // resizable bucket table
+        typedef cc::MichaelHashSet< cds::gc::PTB, list,
+            cc::michael_set::make_traits<
+                cc::opt::hash< hash_int >
+                ,cc::opt::item_counter< simple_item_counter >
+                ,cc::michael_set::resizable< true >
+            >::type
+        > resizable_set   ;
+        test_hp_int< resizable_set >()  ;
+        test_resizable< resizable_set >()  ;
     }
 
     void HashSetHdrTest::Michael_PTB_less()
@@ -63,7 +74,7 @@ namespace set {
 
         // traits-based version
         typedef cc::MichaelHashSet< cds::gc::PTB, list, set_traits > set     ;
-        test_int< set >()  ;
+        test_hp_int< set >()  ;
 
         // option-based version
         typedef cc::MichaelHashSet< cds::gc::PTB, list,
@@ -72,7 +83,7 @@ namespace set {
                 ,cc::opt::item_counter< simple_item_counter >
             >::type
         > opt_set   ;
-        test_int< opt_set >()  ;
+        test_hp_int< opt_set >()  ;
     }
 
     void HashSetHdrTest::Michael_PTB_cmpmix()
@@ -81,7 +92,7 @@ namespace set {
 
         // traits-based version
         typedef cc::MichaelHashSet< cds::gc::PTB, list, set_traits > set     ;
-        test_int< set >()  ;
+        test_hp_int< set >()  ;
 
         // option-based version
         typedef cc::MichaelHashSet< cds::gc::PTB, list,
@@ -90,7 +101,7 @@ namespace set {
                 ,cc::opt::item_counter< simple_item_counter >
             >::type
         > opt_set   ;
-        test_int< opt_set >()  ;
+        test_hp_int< opt_set >()  ;
     }
 
 
@@ -79,6 +79,19 @@ namespace set {
             test_striped_with(s)    ;
         }
 
+        CPPUNIT_MESSAGE( "load_factor_resizing<0>(1), incremental_resize<true, 2>")   ;
+        {
+            typedef cc::StripedSet< sequence_t
+                ,co::mutex_policy< cc::striped_set::refinable<> >
+                , co::hash< hash_int >
+                , co::less< less<item> >
+                , co::resizing_policy< cc::striped_set::load_factor_resizing<0> >
+                , cc::striped_set::incremental_resize< true, 2 >
+            >   set_incremental ;
+            set_incremental s( 30, cc::striped_set::load_factor_resizing<0>(1)) ;
+            test_incremental_resize_with( s ) ;
+        }
+
         CPPUNIT_MESSAGE( "load_factor_resizing<4>")    ;
         typedef cc::StripedSet< sequence_t
             ,co::mutex_policy< cc::striped_set::refinable<> >
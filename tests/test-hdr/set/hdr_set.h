@@ -13,6 +13,7 @@
 #define __CDSTEST_HDR_SET_H
 
 #include "cppunit/cppunit_proxy.h"
+#include "cppunit/thread.h"
 #include "size_check.h"
 
 #include <cds/opt/hash.h>
@@ -193,6 +194,12 @@ namespace set {
             {
                 return v1.key() < v2.first  ;
             }
+
+            // key-to-key comparison (for trees which keep the keys in internal nodes)
+            bool operator ()( int v1, int v2 ) const
+            {
+                return v1 < v2  ;
+            }
         };
 
         template <typename T>
@@ -233,6 +240,13 @@ namespace set {
                     return -1   ;
                 return v1.key() > v2.first ? 1 : 0  ;
             }
+
+            int operator()( int v1, int v2 ) const
+            {
+                if ( v1 < v2 )
+                    return -1   ;
+                return v1 > v2 ? 1 : 0  ;
+            }
         };
 
         template <typename T>
@@ -334,6 +348,259 @@ namespace set {
             test_iter<Set>() ;
         }
 
+        // split-list bucket table shrinking
+        template <class Set>
+        void test_shrink()
+        {
+            int const nSize = 1000 ;
+            Set s( nSize, 1 ) ;
+
+            CPPUNIT_ASSERT( s.bucket_count() == 2 ) ;
+            CPPUNIT_ASSERT( s.shrink() == 0 ) ;
+
+            for ( int i = 0; i < nSize; ++i )
+                CPPUNIT_ASSERT( s.insert( i )) ;
+            for ( int i = 0; i < nSize; ++i )
+                CPPUNIT_ASSERT( s.find( i )) ;
+            size_t const nBucketCount = s.bucket_count() ;
+            CPPUNIT_ASSERT( nBucketCount >= 256 ) ;
+
+            // The load factor is not less than the floor
+            CPPUNIT_ASSERT( s.shrink() == 0 ) ;
+            CPPUNIT_ASSERT( s.bucket_count() == nBucketCount ) ;
+
+            // erase() shrinks the table automatically
+            for ( int i = 10; i < nSize; ++i )
+                CPPUNIT_ASSERT( s.erase( i )) ;
+            CPPUNIT_ASSERT( check_size( s, 10 )) ;
+            CPPUNIT_ASSERT( s.bucket_count() < nBucketCount ) ;
+            CPPUNIT_ASSERT( s.bucket_count() <= 10 * 4 ) ;
+            CPPUNIT_ASSERT( s.shrink() == 0 ) ;
+
+            for ( int i = 0; i < 10; ++i )
+                CPPUNIT_ASSERT( s.find( i )) ;
+            for ( int i = 10; i < nSize; ++i )
+                CPPUNIT_ASSERT( !s.find( i )) ;
+            {
+                size_t nCount = 0 ;
+                for ( typename Set::iterator it = s.begin(); it != s.end(); ++it )
+                    ++nCount ;
+                CPPUNIT_ASSERT( nCount == 10 ) ;
+            }
+
+            // The table grows again
+            for ( int i = 10; i < nSize; ++i )
+                CPPUNIT_ASSERT( s.insert( i )) ;
+            for ( int i = 0; i < nSize; ++i )
+                CPPUNIT_ASSERT( s.find( i )) ;
+            CPPUNIT_ASSERT( s.bucket_count() == nBucketCount ) ;
+
+            s.clear() ;
+            CPPUNIT_ASSERT( s.empty() ) ;
+            CPPUNIT_ASSERT( s.bucket_count() == 2 ) ;
+            CPPUNIT_ASSERT( s.shrink() == 0 ) ;
+
+            CPPUNIT_ASSERT( s.insert( 5 )) ;
+            CPPUNIT_ASSERT( s.find( 5 )) ;
+        }
+
+        template <class Set>
+        class shrink_thread: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new shrink_thread( *this ) ;
+            }
+
+        public:
+            Set&    m_Set       ;
+            int     m_nPerThread ;
+            int     m_nPassCount ;
+
+        public:
+            shrink_thread( CppUnitMini::ThreadPool& pool, Set& s, int nPerThread, int nPassCount )
+                : CppUnitMini::TestThread( pool )
+                , m_Set( s )
+                , m_nPerThread( nPerThread )
+                , m_nPassCount( nPassCount )
+            {}
+            shrink_thread( shrink_thread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Set( src.m_Set )
+                , m_nPerThread( src.m_nPerThread )
+                , m_nPassCount( src.m_nPassCount )
+            {}
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                int const nFirst = (int) m_nThreadNo * m_nPerThread ;
+                int const nLast = nFirst + m_nPerThread ;
+                for ( int nPass = 0; nPass < m_nPassCount; ++nPass ) {
+                    for ( int i = nFirst; i < nLast; ++i )
+                        CPPUNIT_ASSERT( m_Set.insert( i )) ;
+                    for ( int i = nFirst; i < nLast; ++i )
+                        CPPUNIT_ASSERT( m_Set.find( i )) ;
+                    for ( int i = nFirst; i < nLast; ++i )
+                        CPPUNIT_ASSERT( m_Set.erase( i )) ;
+                    for ( int i = nFirst; i < nLast; ++i )
+                        CPPUNIT_ASSERT( !m_Set.find( i )) ;
+                }
+            }
+        };
+
+        // The bucket table is grown and shrunk by concurrent insert/erase
+        template <class Set>
+        void test_shrink_mt()
+        {
+            size_t const nThreadCount = 4 ;
+            int const nPerThread = 4 * 1024 ;
+
+            Set s( nThreadCount * nPerThread, 1 ) ;
+
+            CppUnitMini::ThreadPool pool( *this ) ;
+            pool.add( new shrink_thread<Set>( pool, s, nPerThread, 8 ), nThreadCount ) ;
+            pool.run() ;
+
+            CPPUNIT_ASSERT( s.empty() ) ;
+            s.shrink() ;
+            CPPUNIT_ASSERT( s.bucket_count() == 2 ) ;
+        }
+
+        // MichaelHashSet with resizable bucket table
+        template <class Set>
+        void test_resizable()
+        {
+            int const nSize = 1000 ;
+            Set s( 8, 1 ) ;
+            CPPUNIT_ASSERT( s.bucket_count() <= 16 ) ;
+
+            for ( int i = 0; i < nSize; ++i ) {
+                CPPUNIT_ASSERT( s.insert( i )) ;
+                CPPUNIT_ASSERT( s.find( i )) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, nSize )) ;
+            CPPUNIT_ASSERT( s.bucket_count() >= 256 ) ;
+
+            for ( int i = 0; i < nSize; ++i )
+                CPPUNIT_ASSERT( s.find( i )) ;
+            CPPUNIT_ASSERT( !s.insert( nSize / 2 )) ;
+
+            {
+                size_t nCount = 0 ;
+                for ( typename Set::iterator it = s.begin(); it != s.end(); ++it ) {
+                    CPPUNIT_ASSERT( it->nKey >= 0 && it->nKey < nSize ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == static_cast<size_t>( nSize )) ;
+            }
+
+            for ( int i = 0; i < nSize; i += 2 )
+                CPPUNIT_ASSERT( s.erase( i )) ;
+            for ( int i = 0; i < nSize; ++i )
+                CPPUNIT_ASSERT( s.find( i ) == ((i & 1) != 0) ) ;
+            CPPUNIT_ASSERT( check_size( s, nSize / 2 )) ;
+
+            s.clear() ;
+            CPPUNIT_ASSERT( s.empty() ) ;
+            CPPUNIT_ASSERT( check_size( s, 0 )) ;
+            CPPUNIT_ASSERT( s.begin() == s.end() ) ;
+        }
+
+        template <class Set>
+        void test_hp_int()
+        {
+            test_int<Set>() ;
+
+            Set s( 50, 4 )  ;
+            test_hp_int_with( s ) ;
+        }
+
+        // get() / extract() tests for HP-like GC
+        template <class Set>
+        void test_hp_int_with( Set& s )
+        {
+            typedef typename Set::value_type    value_type  ;
+            typedef typename Set::guarded_ptr   guarded_ptr ;
+
+            CPPUNIT_ASSERT( s.empty() ) ;
+            CPPUNIT_ASSERT( s.insert( item( 10, 100 ))) ;
+            CPPUNIT_ASSERT( s.insert( item( 20, 200 ))) ;
+            CPPUNIT_ASSERT( s.insert( item( 30, 300 ))) ;
+
+            {
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+                CPPUNIT_ASSERT( s.get( gp, 20 )) ;
+                CPPUNIT_ASSERT( !gp.empty() ) ;
+                CPPUNIT_ASSERT( gp->nKey == 20 ) ;
+                CPPUNIT_ASSERT( gp->nVal == 200 ) ;
+
+                // The value is not copied
+                gp->nVal = 2000 ;
+                {
+                    copy_found<item> f  ;
+                    CPPUNIT_ASSERT( s.find( 20, boost::ref(f)) ) ;
+                    CPPUNIT_ASSERT( f.m_found.nVal == 2000 ) ;
+                }
+
+                CPPUNIT_ASSERT( !s.get( gp, 25 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 20 ) ;
+
+                CPPUNIT_ASSERT( s.get_with( gp, 10, less<value_type>() )) ;
+                CPPUNIT_ASSERT( (*gp).nKey == 10 ) ;
+
+                gp.release() ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+            }
+
+            {
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( s.extract( gp, 20 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 20 ) ;
+                CPPUNIT_ASSERT( gp->nVal == 2000 ) ;
+                CPPUNIT_ASSERT( !s.find( 20 )) ;
+                CPPUNIT_ASSERT( check_size( s, 2 )) ;
+                CPPUNIT_ASSERT( !s.extract( gp, 20 )) ;
+
+                // The item extracted is guarded and is still accessible
+                Set::gc::force_dispose() ;
+                CPPUNIT_ASSERT( gp->nKey == 20 ) ;
+                CPPUNIT_ASSERT( gp->nVal == 2000 ) ;
+            }
+
+#       ifdef CDS_MOVE_SEMANTICS_SUPPORT
+            {
+                guarded_ptr gp( s.extract_with( 10, less<value_type>() )) ;
+                CPPUNIT_ASSERT( !gp.empty() ) ;
+                CPPUNIT_ASSERT( gp->nKey == 10 ) ;
+                CPPUNIT_ASSERT( !s.find( 10 )) ;
+
+                gp = s.get( 30 ) ;
+                CPPUNIT_ASSERT( gp->nKey == 30 ) ;
+                gp = s.get_with( 10, less<value_type>() ) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+
+                gp = s.extract( 30 ) ;
+                CPPUNIT_ASSERT( gp->nKey == 30 ) ;
+                gp = s.extract( 30 ) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+            }
+#       else
+            {
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( s.extract_with( gp, 10, less<value_type>() )) ;
+                CPPUNIT_ASSERT( gp->nKey == 10 ) ;
+                CPPUNIT_ASSERT( s.extract( gp, 30 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 30 ) ;
+            }
+#       endif
+            CPPUNIT_ASSERT( s.empty() ) ;
+            CPPUNIT_ASSERT( check_size( s, 0 )) ;
+        }
+
         template <class Set>
         void test_int_with( Set& s)
         {
@@ -10,6 +10,7 @@
 
 
 #include "set/hdr_set.h"
+#include <vector>
 
 namespace set {
 
@@ -17,6 +18,247 @@ namespace set {
     {
         typedef HashSetHdrTest base_class ;
 
+        template <class Set, typename PrintStat >
+        void test_hp()
+        {
+            test<Set, PrintStat>() ;
+
+            {
+                Set s ;
+                base_class::test_hp_int_with( s ) ;
+            }
+
+            test_bounds<Set>() ;
+            test_extract_minmax<Set>() ;
+            test_insert_sorted<Set>() ;
+        }
+
+        template <class Set>
+        void test_insert_sorted()
+        {
+            typedef typename Set::insert_hint   insert_hint ;
+
+            int const nSize = 1000 ;
+
+            Set s ;
+
+            // Even keys 0, 2, ..., 1998 in ascending order
+            {
+                std::vector<int> arr ;
+                arr.reserve( nSize ) ;
+                for ( int i = 0; i < nSize; ++i )
+                    arr.push_back( i * 2 ) ;
+                CPPUNIT_ASSERT( s.insert_sorted( arr.begin(), arr.end() ) == size_t(nSize) ) ;
+                CPPUNIT_ASSERT( check_size( s, nSize )) ;
+
+                // All keys are duplicates
+                CPPUNIT_ASSERT( s.insert_sorted( arr.begin(), arr.end() ) == 0 ) ;
+                CPPUNIT_ASSERT( check_size( s, nSize )) ;
+            }
+
+            // Odd keys in nearly ascending order: 3, 1, 7, 5, ...
+            {
+                insert_hint hint ;
+                CPPUNIT_ASSERT( !hint.valid() ) ;
+                for ( int i = 0; i < nSize; i += 2 ) {
+                    CPPUNIT_ASSERT( s.insert( hint, (i + 1) * 2 + 1 )) ;
+                    CPPUNIT_ASSERT( hint.valid() ) ;
+                    CPPUNIT_ASSERT( s.insert( hint, i * 2 + 1 )) ;
+                }
+                CPPUNIT_ASSERT( !s.insert( hint, 10 )) ;
+
+                // The hint is behind of the key
+                CPPUNIT_ASSERT( s.insert( hint, nSize * 2 + 10 )) ;
+                CPPUNIT_ASSERT( s.insert( hint, -1 )) ;
+
+                hint.reset() ;
+                CPPUNIT_ASSERT( !hint.valid() ) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, nSize * 2 + 2 )) ;
+
+            {
+                int nPrev = -2 ;
+                size_t nCount = 0 ;
+                for ( typename Set::iterator it = s.begin(); it != s.end(); ++it ) {
+                    CPPUNIT_ASSERT( it->nKey > nPrev ) ;
+                    CPPUNIT_ASSERT( it->nKey == it->nVal ) ;
+                    nPrev = it->nKey ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == size_t(nSize * 2 + 2) ) ;
+            }
+            for ( int i = -1; i < nSize * 2; ++i )
+                CPPUNIT_ASSERT( s.find( i )) ;
+
+            s.clear() ;
+            CPPUNIT_ASSERT( s.empty() ) ;
+        }
+
+        template <class Set>
+        void test_extract_minmax()
+        {
+            typedef typename Set::guarded_ptr       guarded_ptr ;
+
+            int const nSize = 100 ;
+
+            Set s ;
+            {
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( !s.extract_min( gp )) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+                CPPUNIT_ASSERT( !s.extract_max( gp )) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+            }
+
+            // Keys 0..99 are inserted in shuffled order
+            for ( int i = 0; i < nSize; ++i ) {
+                int nKey = (i * 37) % nSize ;
+                CPPUNIT_ASSERT( s.insert( item( nKey, nKey * 2 ))) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, nSize )) ;
+
+            {
+                guarded_ptr gp ;
+                int nMin = 0 ;
+                int nMax = nSize - 1 ;
+                while ( nMin < nMax ) {
+                    CPPUNIT_ASSERT( s.extract_min( gp )) ;
+                    CPPUNIT_ASSERT( gp->nKey == nMin ) ;
+                    CPPUNIT_ASSERT( gp->nVal == nMin * 2 ) ;
+                    CPPUNIT_ASSERT( s.extract_max( gp )) ;
+                    CPPUNIT_ASSERT( gp->nKey == nMax ) ;
+                    CPPUNIT_ASSERT( gp->nVal == nMax * 2 ) ;
+                    ++nMin ;
+                    --nMax ;
+                }
+                CPPUNIT_ASSERT( s.empty() ) ;
+                CPPUNIT_ASSERT( !s.extract_min( gp )) ;
+                CPPUNIT_ASSERT( !s.extract_max( gp )) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, 0 )) ;
+
+#       ifdef CDS_MOVE_SEMANTICS_SUPPORT
+            for ( int i = 0; i < 10; ++i )
+                CPPUNIT_ASSERT( s.insert( item( i, i ))) ;
+            {
+                guarded_ptr gp( s.extract_min() ) ;
+                CPPUNIT_ASSERT( !gp.empty() ) ;
+                CPPUNIT_ASSERT( gp->nKey == 0 ) ;
+                gp = s.extract_max() ;
+                CPPUNIT_ASSERT( !gp.empty() ) ;
+                CPPUNIT_ASSERT( gp->nKey == 9 ) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, 8 )) ;
+#       endif
+
+            s.clear() ;
+            CPPUNIT_ASSERT( s.empty() ) ;
+        }
+
+        template <class Set>
+        void test_bounds()
+        {
+            typedef typename Set::value_type        value_type  ;
+            typedef typename Set::guarded_ptr       guarded_ptr ;
+            typedef typename Set::range_cursor      range_cursor ;
+
+            int const nSize = 100 ;
+
+            Set s ;
+            {
+                range_cursor cur( s ) ;
+                CPPUNIT_ASSERT( !cur.first() ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( !s.lower_bound( gp, 0 )) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+            }
+
+            // Keys are 0, 2, 4, ..., 198
+            for ( int i = 0; i < nSize; ++i )
+                CPPUNIT_ASSERT( s.insert( item( i * 2, i ))) ;
+
+            {
+                guarded_ptr gp ;
+                CPPUNIT_ASSERT( s.lower_bound( gp, 5 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 6 ) ;
+                CPPUNIT_ASSERT( gp->nVal == 3 ) ;
+                CPPUNIT_ASSERT( s.lower_bound( gp, 6 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 6 ) ;
+                CPPUNIT_ASSERT( s.upper_bound( gp, 6 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 8 ) ;
+                CPPUNIT_ASSERT( s.lower_bound_with( gp, 7, less<value_type>() )) ;
+                CPPUNIT_ASSERT( gp->nKey == 8 ) ;
+                CPPUNIT_ASSERT( s.upper_bound_with( gp, -1, less<value_type>() )) ;
+                CPPUNIT_ASSERT( gp->nKey == 0 ) ;
+                CPPUNIT_ASSERT( !s.upper_bound( gp, nSize * 2 - 2 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 0 ) ;
+            }
+#       ifdef CDS_MOVE_SEMANTICS_SUPPORT
+            {
+                guarded_ptr gp( s.lower_bound( 11 )) ;
+                CPPUNIT_ASSERT( gp->nKey == 12 ) ;
+                gp = s.upper_bound_with( 12, less<value_type>() ) ;
+                CPPUNIT_ASSERT( gp->nKey == 14 ) ;
+                gp = s.lower_bound( nSize * 2 ) ;
+                CPPUNIT_ASSERT( gp.empty() ) ;
+            }
+#       endif
+
+            {
+                range_cursor cur( s ) ;
+
+                // Full scan
+                int nCount = 0 ;
+                for ( bool bOk = cur.first(); bOk; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->nKey == nCount * 2 ) ;
+                    CPPUNIT_ASSERT( (*cur).nVal == nCount ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == nSize ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+
+                // Range [11, 31)
+                nCount = 0 ;
+                for ( bool bOk = cur.lower_bound( 11 ); bOk && cur->nKey < 31; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->nKey == 12 + nCount * 2 ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == 10 ) ;
+
+                // Range (10, 20]
+                nCount = 0 ;
+                for ( bool bOk = cur.upper_bound_with( 10, less<value_type>() ); bOk && cur->nKey <= 20; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->nKey == 12 + nCount * 2 ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == 5 ) ;
+
+                // The current item and its successor are deleted
+                CPPUNIT_ASSERT( cur.lower_bound_with( 20, less<value_type>() )) ;
+                CPPUNIT_ASSERT( s.erase( 20 )) ;
+                CPPUNIT_ASSERT( s.erase( 22 )) ;
+                CPPUNIT_ASSERT( cur->nKey == 20 ) ;
+                CPPUNIT_ASSERT( cur.next() ) ;
+                CPPUNIT_ASSERT( cur->nKey == 24 ) ;
+
+                // A new successor is inserted
+                CPPUNIT_ASSERT( s.insert( 25 )) ;
+                CPPUNIT_ASSERT( cur.next() ) ;
+                CPPUNIT_ASSERT( cur->nKey == 25 ) ;
+                CPPUNIT_ASSERT( cur.next() ) ;
+                CPPUNIT_ASSERT( cur->nKey == 26 ) ;
+
+                CPPUNIT_ASSERT( cur.upper_bound( nSize * 2 - 4 )) ;
+                CPPUNIT_ASSERT( !cur.next() ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, nSize - 1 )) ;
+
+            s.clear() ;
+            CPPUNIT_ASSERT( s.empty() ) ;
+        }
+
         template <class Set, typename PrintStat >
         void test()
         {
@@ -302,6 +544,8 @@ namespace set {
         void SkipList_HP_michaelalloc_less_stat()  ;
         void SkipList_HP_michaelalloc_cmp_stat()  ;
         void SkipList_HP_michaelalloc_cmpless_stat()  ;
+        void SkipList_HP_pool_less()  ;
+        void SkipList_HP_pool_michaelalloc_less_stat()  ;
 
         void SkipList_HRC_less()  ;
         void SkipList_HRC_cmp()  ;
@@ -352,6 +596,30 @@ namespace set {
         void SkipList_PTB_michaelalloc_less_stat()  ;
         void SkipList_PTB_michaelalloc_cmp_stat()  ;
         void SkipList_PTB_michaelalloc_cmpless_stat()  ;
+        void SkipList_EBR_less()  ;
+        void SkipList_EBR_cmp()  ;
+        void SkipList_EBR_cmpless()  ;
+        void SkipList_EBR_less_stat()  ;
+        void SkipList_EBR_cmp_stat()  ;
+        void SkipList_EBR_cmpless_stat()  ;
+        void SkipList_EBR_xorshift_less()  ;
+        void SkipList_EBR_xorshift_cmp()  ;
+        void SkipList_EBR_xorshift_cmpless()  ;
+        void SkipList_EBR_xorshift_less_stat()  ;
+        void SkipList_EBR_xorshift_cmp_stat()  ;
+        void SkipList_EBR_xorshift_cmpless_stat()  ;
+        void SkipList_EBR_turbopas_less()  ;
+        void SkipList_EBR_turbopas_cmp()  ;
+        void SkipList_EBR_turbopas_cmpless()  ;
+        void SkipList_EBR_turbopas_less_stat()  ;
+        void SkipList_EBR_turbopas_cmp_stat()  ;
+        void SkipList_EBR_turbopas_cmpless_stat()  ;
+        void SkipList_EBR_michaelalloc_less()  ;
+        void SkipList_EBR_michaelalloc_cmp()  ;
+        void SkipList_EBR_michaelalloc_cmpless()  ;
+        void SkipList_EBR_michaelalloc_less_stat()  ;
+        void SkipList_EBR_michaelalloc_cmp_stat()  ;
+        void SkipList_EBR_michaelalloc_cmpless_stat()  ;
 
         void SkipList_NOGC_less()  ;
         void SkipList_NOGC_cmp()  ;
@@ -403,6 +671,8 @@ namespace set {
             CPPUNIT_TEST(SkipList_HP_michaelalloc_less_stat)
             CPPUNIT_TEST(SkipList_HP_michaelalloc_cmp_stat)
             CPPUNIT_TEST(SkipList_HP_michaelalloc_cmpless_stat)
+            CPPUNIT_TEST(SkipList_HP_pool_less)
+            CPPUNIT_TEST(SkipList_HP_pool_michaelalloc_less_stat)
 
             CPPUNIT_TEST(SkipList_HRC_less)
             CPPUNIT_TEST(SkipList_HRC_cmp)
@@ -453,6 +723,30 @@ namespace set {
             CPPUNIT_TEST(SkipList_PTB_michaelalloc_less_stat)
             CPPUNIT_TEST(SkipList_PTB_michaelalloc_cmp_stat)
             CPPUNIT_TEST(SkipList_PTB_michaelalloc_cmpless_stat)
+            CPPUNIT_TEST(SkipList_EBR_less)
+            CPPUNIT_TEST(SkipList_EBR_cmp)
+            CPPUNIT_TEST(SkipList_EBR_cmpless)
+            CPPUNIT_TEST(SkipList_EBR_less_stat)
+            CPPUNIT_TEST(SkipList_EBR_cmp_stat)
+            CPPUNIT_TEST(SkipList_EBR_cmpless_stat)
+            CPPUNIT_TEST(SkipList_EBR_xorshift_less)
+            CPPUNIT_TEST(SkipList_EBR_xorshift_cmp)
+            CPPUNIT_TEST(SkipList_EBR_xorshift_cmpless)
+            CPPUNIT_TEST(SkipList_EBR_xorshift_less_stat)
+            CPPUNIT_TEST(SkipList_EBR_xorshift_cmp_stat)
+            CPPUNIT_TEST(SkipList_EBR_xorshift_cmpless_stat)
+            CPPUNIT_TEST(SkipList_EBR_turbopas_less)
+            CPPUNIT_TEST(SkipList_EBR_turbopas_cmp)
+            CPPUNIT_TEST(SkipList_EBR_turbopas_cmpless)
+            CPPUNIT_TEST(SkipList_EBR_turbopas_less_stat)
+            CPPUNIT_TEST(SkipList_EBR_turbopas_cmp_stat)
+            CPPUNIT_TEST(SkipList_EBR_turbopas_cmpless_stat)
+            CPPUNIT_TEST(SkipList_EBR_michaelalloc_less)
+            CPPUNIT_TEST(SkipList_EBR_michaelalloc_cmp)
+            CPPUNIT_TEST(SkipList_EBR_michaelalloc_cmpless)
+            CPPUNIT_TEST(SkipList_EBR_michaelalloc_less_stat)
+            CPPUNIT_TEST(SkipList_EBR_michaelalloc_cmp_stat)
+            CPPUNIT_TEST(SkipList_EBR_michaelalloc_cmpless_stat)
 
             CPPUNIT_TEST(SkipList_NOGC_less)
             CPPUNIT_TEST(SkipList_NOGC_cmp)
@@ -0,0 +1,320 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "set/hdr_skiplist_set.h"
+#include <cds/container/skip_list_set_ebr.h>
+#include "unit/michael_alloc.h"
+#include "map/print_skiplist_stat.h"
+
+namespace set {
+
+    void SkipListSetHdrTest::SkipList_EBR_less()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_cmp()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+            co::compare< cmp<item > >
+            ,co::item_counter< simple_item_counter >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_cmpless()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+            co::less< less<item > >
+            ,co::compare< cmp<item > >
+            ,co::item_counter< simple_item_counter >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_less_stat()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_cmp_stat()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_cmpless_stat()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_xorshift_less()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_xorshift_cmp()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_xorshift_cmpless()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_xorshift_less_stat()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_xorshift_cmp_stat()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_xorshift_cmpless_stat()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_turbopas_less()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_turbopas_cmp()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_turbopas_cmpless()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_turbopas_less_stat()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_turbopas_cmp_stat()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_turbopas_cmpless_stat()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_michaelalloc_less()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_michaelalloc_cmp()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_michaelalloc_cmpless()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_michaelalloc_less_stat()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat >
+                ,co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_michaelalloc_cmp_stat()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat >
+                ,co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_EBR_michaelalloc_cmpless_stat()
+    {
+        typedef cc::SkipListSet< cds::gc::EBR, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::compare< cmp<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat >
+                ,co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+} // namespace set
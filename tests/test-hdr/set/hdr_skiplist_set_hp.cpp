@@ -24,7 +24,7 @@ namespace set {
                 ,co::item_counter< simple_item_counter >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_cmp()
@@ -35,7 +35,7 @@ namespace set {
             ,co::item_counter< simple_item_counter >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_cmpless()
@@ -47,7 +47,7 @@ namespace set {
             ,co::item_counter< simple_item_counter >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_less_stat()
@@ -59,7 +59,7 @@ namespace set {
                 ,co::stat< cc::skip_list::stat >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_cmp_stat()
@@ -71,7 +71,7 @@ namespace set {
                 ,co::stat< cc::skip_list::stat >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_cmpless_stat()
@@ -84,7 +84,7 @@ namespace set {
                 ,co::stat< cc::skip_list::stat >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_xorshift_less()
@@ -96,7 +96,7 @@ namespace set {
                 ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_xorshift_cmp()
@@ -108,7 +108,7 @@ namespace set {
                 ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_xorshift_cmpless()
@@ -121,7 +121,7 @@ namespace set {
                 ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_xorshift_less_stat()
@@ -134,7 +134,7 @@ namespace set {
                 ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_xorshift_cmp_stat()
@@ -147,7 +147,7 @@ namespace set {
                 ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_xorshift_cmpless_stat()
@@ -161,7 +161,7 @@ namespace set {
                 ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_turbopas_less()
@@ -173,7 +173,7 @@ namespace set {
                 ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_turbopas_cmp()
@@ -185,7 +185,7 @@ namespace set {
                 ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_turbopas_cmpless()
@@ -198,7 +198,7 @@ namespace set {
                 ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_turbopas_less_stat()
@@ -211,7 +211,7 @@ namespace set {
                 ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_turbopas_cmp_stat()
@@ -224,7 +224,7 @@ namespace set {
                 ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_turbopas_cmpless_stat()
@@ -238,7 +238,7 @@ namespace set {
                 ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_michaelalloc_less()
@@ -250,7 +250,7 @@ namespace set {
                 ,co::allocator< memory::MichaelAllocator<int> >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_michaelalloc_cmp()
@@ -262,7 +262,7 @@ namespace set {
                 ,co::allocator< memory::MichaelAllocator<int> >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_michaelalloc_cmpless()
@@ -275,7 +275,7 @@ namespace set {
                 ,co::allocator< memory::MichaelAllocator<int> >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_michaelalloc_less_stat()
@@ -288,7 +288,7 @@ namespace set {
                 ,co::allocator< memory::MichaelAllocator<int> >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_michaelalloc_cmp_stat()
@@ -301,7 +301,7 @@ namespace set {
                 ,co::allocator< memory::MichaelAllocator<int> >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 
     void SkipListSetHdrTest::SkipList_HP_michaelalloc_cmpless_stat()
@@ -315,7 +315,33 @@ namespace set {
                 ,co::allocator< memory::MichaelAllocator<int> >
             >::type
         > set ;
-        test< set, misc::print_skiplist_stat<set::stat> >() ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_HP_pool_less()
+    {
+        typedef cc::SkipListSet< cds::gc::HP, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,cc::skip_list::node_pool< cc::skip_list::per_height_pool<> >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
+    }
+
+    void SkipListSetHdrTest::SkipList_HP_pool_michaelalloc_less_stat()
+    {
+        typedef cc::SkipListSet< cds::gc::HP, item,
+            cc::skip_list::make_traits<
+                co::less< less<item > >
+                ,co::item_counter< simple_item_counter >
+                ,co::stat< cc::skip_list::stat >
+                ,co::allocator< memory::MichaelAllocator<int> >
+                ,cc::skip_list::node_pool< cc::skip_list::per_height_pool< 16 > >
+            >::type
+        > set ;
+        test_hp< set, misc::print_skiplist_stat<set::stat> >() ;
     }
 } // namespace set
 
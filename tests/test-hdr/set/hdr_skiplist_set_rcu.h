@@ -157,6 +157,143 @@ namespace set {
                 }
             }
             CPPUNIT_ASSERT( nCount == nLimit ) ;
+
+            test_bounds<Set>() ;
+            test_extract_minmax<Set>() ;
+        }
+
+        struct extract_minmax_functor
+        {
+            int nKey    ;
+            int nVal    ;
+
+            extract_minmax_functor()
+                : nKey( -1 )
+                , nVal( -1 )
+            {}
+
+            template <typename Item>
+            void operator()( Item& item )
+            {
+                nKey = item.nKey ;
+                nVal = item.nVal ;
+            }
+        };
+
+        template <class Set>
+        void test_extract_minmax()
+        {
+            int const nSize = 100 ;
+
+            Set s ;
+            {
+                extract_minmax_functor f ;
+                CPPUNIT_ASSERT( !s.extract_min( cds::ref(f) )) ;
+                CPPUNIT_ASSERT( !s.extract_max( cds::ref(f) )) ;
+                CPPUNIT_ASSERT( f.nKey == -1 ) ;
+            }
+
+            // Keys 0..99 are inserted in shuffled order
+            for ( int i = 0; i < nSize; ++i ) {
+                int nKey = (i * 37) % nSize ;
+                CPPUNIT_ASSERT( s.insert( item( nKey, nKey * 2 ))) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, nSize )) ;
+
+            {
+                extract_minmax_functor f ;
+                int nMin = 0 ;
+                int nMax = nSize - 1 ;
+                while ( nMin < nMax ) {
+                    CPPUNIT_ASSERT( s.extract_min( cds::ref(f) )) ;
+                    CPPUNIT_ASSERT( f.nKey == nMin ) ;
+                    CPPUNIT_ASSERT( f.nVal == nMin * 2 ) ;
+                    CPPUNIT_ASSERT( s.extract_max( cds::ref(f) )) ;
+                    CPPUNIT_ASSERT( f.nKey == nMax ) ;
+                    CPPUNIT_ASSERT( f.nVal == nMax * 2 ) ;
+                    ++nMin ;
+                    --nMax ;
+                }
+                CPPUNIT_ASSERT( s.empty() ) ;
+                CPPUNIT_ASSERT( !s.extract_min( cds::ref(f) )) ;
+                CPPUNIT_ASSERT( !s.extract_max( cds::ref(f) )) ;
+            }
+            CPPUNIT_ASSERT( check_size( s, 0 )) ;
+        }
+
+        template <class Set>
+        void test_bounds()
+        {
+            typedef typename Set::gc::scoped_lock   rcu_lock ;
+            typedef typename Set::value_type        value_type  ;
+            typedef typename Set::range_cursor      range_cursor ;
+
+            int const nSize = 100 ;
+
+            Set s ;
+            {
+                rcu_lock l ;
+                range_cursor cur( s ) ;
+                CPPUNIT_ASSERT( !cur.first() ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+                CPPUNIT_ASSERT( s.lower_bound( 0 ) == NULL ) ;
+            }
+
+            // Keys are 0, 2, 4, ..., 198
+            for ( int i = 0; i < nSize; ++i )
+                CPPUNIT_ASSERT( s.insert( item( i * 2, i ))) ;
+
+            {
+                rcu_lock l ;
+                value_type * p ;
+                p = s.lower_bound( 5 ) ;
+                CPPUNIT_ASSERT( p && p->nKey == 6 && p->nVal == 3 ) ;
+                p = s.upper_bound( 6 ) ;
+                CPPUNIT_ASSERT( p && p->nKey == 8 ) ;
+                p = s.lower_bound_with( 7, less<value_type>() ) ;
+                CPPUNIT_ASSERT( p && p->nKey == 8 ) ;
+                p = s.upper_bound_with( -1, less<value_type>() ) ;
+                CPPUNIT_ASSERT( p && p->nKey == 0 ) ;
+                CPPUNIT_ASSERT( s.upper_bound( nSize * 2 - 2 ) == NULL ) ;
+            }
+
+            {
+                rcu_lock l ;
+                range_cursor cur( s ) ;
+
+                // Full scan
+                int nCount = 0 ;
+                for ( bool bOk = cur.first(); bOk; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->nKey == nCount * 2 ) ;
+                    CPPUNIT_ASSERT( (*cur).nVal == nCount ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == nSize ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+
+                // Range [11, 31)
+                nCount = 0 ;
+                for ( bool bOk = cur.lower_bound( 11 ); bOk && cur->nKey < 31; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->nKey == 12 + nCount * 2 ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == 10 ) ;
+
+                // Range (10, 20]
+                nCount = 0 ;
+                for ( bool bOk = cur.upper_bound_with( 10, less<value_type>() ); bOk && cur->nKey <= 20; bOk = cur.next() ) {
+                    CPPUNIT_ASSERT( cur->nKey == 12 + nCount * 2 ) ;
+                    ++nCount ;
+                }
+                CPPUNIT_ASSERT( nCount == 5 ) ;
+
+                CPPUNIT_ASSERT( cur.upper_bound( nSize * 2 - 4 )) ;
+                CPPUNIT_ASSERT( !cur.next() ) ;
+                CPPUNIT_ASSERT( cur.empty() ) ;
+            }
+
+            s.clear() ;
+            CPPUNIT_ASSERT( s.empty() ) ;
         }
 
     public:
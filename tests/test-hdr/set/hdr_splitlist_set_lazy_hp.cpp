@@ -63,7 +63,7 @@ namespace set {
         // traits-based version
         typedef cc::SplitListSet< cds::gc::HP, item, HP_cmp_traits > set   ;
 
-        test_int< set >()  ;
+        test_hp_int< set >()  ;
 
         // option-based version
         typedef cc::SplitListSet< cds::gc::HP, item,
@@ -80,7 +80,7 @@ namespace set {
                 >
             >::type
         > opt_set   ;
-        test_int< opt_set >()  ;
+        test_hp_int< opt_set >()  ;
     }
 
     void HashSetHdrTest::Split_Lazy_HP_less()
@@ -88,7 +88,7 @@ namespace set {
         // traits-based version
         typedef cc::SplitListSet< cds::gc::HP, item, HP_less_traits > set   ;
 
-        test_int< set >()  ;
+        test_hp_int< set >()  ;
 
         // option-based version
         typedef cc::SplitListSet< cds::gc::HP, item,
@@ -105,14 +105,14 @@ namespace set {
                 >
             >::type
         > opt_set   ;
-        test_int< opt_set >()  ;
+        test_hp_int< opt_set >()  ;
     }
 
     void HashSetHdrTest::Split_Lazy_HP_cmpmix()
     {
         // traits-based version
         typedef cc::SplitListSet< cds::gc::HP, item, HP_cmpmix_traits > set   ;
-        test_int< set >()  ;
+        test_hp_int< set >()  ;
 
         // option-based version
         typedef cc::SplitListSet< cds::gc::HP, item,
@@ -128,7 +128,7 @@ namespace set {
                 >
             >::type
         > opt_set   ;
-        test_int< opt_set >()  ;
+        test_hp_int< opt_set >()  ;
     }
 
 
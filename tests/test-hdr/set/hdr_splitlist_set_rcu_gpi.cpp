@@ -26,6 +26,7 @@ namespace set {
             typedef HashSetHdrTest::simple_item_counter item_counter    ;
             typedef cc::opt::v::relaxed_ordering        memory_model    ;
             enum { dynamic_bucket_table = false };
+            static const size_t shrink_factor = 4 ;
 
             struct ordered_list_traits: public cc::michael_list::type_traits
             {
@@ -76,6 +77,7 @@ namespace set {
                 ,cc::opt::item_counter< simple_item_counter >
                 ,cc::opt::memory_model< cc::opt::v::relaxed_ordering >
                 ,cc::split_list::dynamic_bucket_table< true >
+                ,cc::split_list::shrink_factor< 4 >
                 ,cc::split_list::ordered_list_traits<
                     cc::michael_list::make_traits<
                         cc::opt::compare< cmp<item> >
@@ -84,6 +86,10 @@ namespace set {
             >::type
         > opt_set   ;
         test_int< opt_set >()  ;
+
+        test_shrink< set >() ;
+        test_shrink< opt_set >() ;
+        test_shrink_mt< set >() ;
     }
 
     void HashSetHdrTest::Split_RCU_GPI_less()
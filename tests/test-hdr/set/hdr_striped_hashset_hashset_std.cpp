@@ -76,6 +76,15 @@ namespace set {
         >   set_spin ;
         test_striped< set_spin >()    ;
 
+        // Reader-writer lock striping
+        CPPUNIT_MESSAGE( "rw_striping") ;
+        typedef cc::StripedSet< set_t
+            , co::hash< hash_int >
+            , co::less< less<item> >
+            ,co::mutex_policy< cc::striped_set::rw_striping<> >
+        >   set_rw ;
+        test_striped< set_rw >()    ;
+
         // Resizing policy
         CPPUNIT_MESSAGE( "load_factor_resizing<0>(1024)")   ;
         {
@@ -521,6 +521,34 @@ namespace set {
 
         //*******************************************
         // If erase_with && find_with are supported
+        // Checks that no item is lost while the buckets are migrated
+        template <class Set>
+        void test_incremental_resize_with( Set& s )
+        {
+            size_t const nCount = 10000 ;
+            size_t const nBucketCount = s.bucket_count() ;
+
+            for ( size_t i = 0; i < nCount; ++i ) {
+                CPPUNIT_ASSERT( s.insert( (int) i )) ;
+                CPPUNIT_ASSERT( s.find( (int) i / 2 )) ;
+            }
+            CPPUNIT_ASSERT( s.bucket_count() > nBucketCount ) ;
+            CPPUNIT_ASSERT( check_size( s, nCount )) ;
+
+            for ( size_t i = 0; i < nCount; ++i )
+                CPPUNIT_ASSERT( s.find( (int) i )) ;
+            for ( size_t i = 0; i < nCount; i += 2 )
+                CPPUNIT_ASSERT( s.erase( (int) i )) ;
+            for ( size_t i = 0; i < nCount; ++i )
+                CPPUNIT_ASSERT( s.find( (int) i ) == ((i & 1) != 0) ) ;
+            CPPUNIT_ASSERT( check_size( s, nCount / 2 )) ;
+
+            s.clear() ;
+            CPPUNIT_ASSERT( s.empty() ) ;
+            for ( size_t i = 0; i < nCount; ++i )
+                CPPUNIT_ASSERT( !s.find( (int) i )) ;
+        }
+
 #ifndef CDS_CXX11_DEFAULT_FUNCTION_TEMPLATE_ARGS_SUPPORT
         template <class Set>
         void test_striped2()
@@ -734,6 +762,7 @@ namespace set {
         void Striped_boost_flat_set() ;
         void Striped_boost_set() ;
         void Striped_boost_unordered_set() ;
+        void Striped_flat_bucket() ;
 
         void Refinable_list() ;
         void Refinable_vector() ;
@@ -746,6 +775,7 @@ namespace set {
         void Refinable_boost_flat_set() ;
         void Refinable_boost_set() ;
         void Refinable_boost_unordered_set() ;
+        void Refinable_flat_bucket() ;
 
         CPPUNIT_TEST_SUITE(StripedSetHdrTest)
             CPPUNIT_TEST(Striped_list)
@@ -759,6 +789,7 @@ namespace set {
             CPPUNIT_TEST(Striped_boost_flat_set)
             CPPUNIT_TEST(Striped_boost_set)
             CPPUNIT_TEST(Striped_boost_unordered_set)
+            CPPUNIT_TEST(Striped_flat_bucket)
 
             CPPUNIT_TEST(Refinable_list)
             CPPUNIT_TEST(Refinable_vector)
@@ -771,6 +802,7 @@ namespace set {
             CPPUNIT_TEST(Refinable_boost_flat_set)
             CPPUNIT_TEST(Refinable_boost_set)
             CPPUNIT_TEST(Refinable_boost_unordered_set)
+            CPPUNIT_TEST(Refinable_flat_bucket)
 
         CPPUNIT_TEST_SUITE_END()
     };
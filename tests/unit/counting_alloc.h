@@ -0,0 +1,77 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __CDS_UNIT_COUNTING_ALLOC_H
+#define __CDS_UNIT_COUNTING_ALLOC_H
+
+#include <cds/cxx11_atomic.h>
+#include <memory>
+
+namespace memory {
+
+    //@cond
+    template <int Dummy = 0>
+    struct counting_allocator_stat
+    {
+        static CDS_ATOMIC::atomic<size_t>   s_nAllocated    ;   // bytes allocated and not freed yet
+    };
+
+    template <int Dummy>
+    CDS_ATOMIC::atomic<size_t> counting_allocator_stat<Dummy>::s_nAllocated( 0 ) ;
+    //@endcond
+
+    // std::allocator that counts the bytes allocated by all its instances
+    template <class T>
+    class CountingAllocator: public std::allocator<T>
+    {
+        typedef std::allocator<T>               std_allocator   ;
+        typedef counting_allocator_stat<>       stat            ;
+    public:
+        typedef typename std_allocator::pointer     pointer     ;
+        typedef typename std_allocator::size_type   size_type   ;
+
+        CountingAllocator()
+        {}
+        CountingAllocator( CountingAllocator const& )
+        {}
+        template <class Other>
+        CountingAllocator( CountingAllocator<Other> const& )
+        {}
+
+        // Allocation function
+        pointer allocate( size_type _Count, const void* _Hint = NULL )
+        {
+            stat::s_nAllocated.fetch_add( sizeof(T) * _Count, CDS_ATOMIC::memory_order_relaxed ) ;
+            return std_allocator::allocate( _Count, _Hint ) ;
+        }
+
+        // Deallocation function
+        void deallocate( pointer _Ptr, size_type _Count )
+        {
+            stat::s_nAllocated.fetch_sub( sizeof(T) * _Count, CDS_ATOMIC::memory_order_relaxed ) ;
+            std_allocator::deallocate( _Ptr, _Count ) ;
+        }
+
+        // Returns the count of bytes allocated and not freed yet
+        static size_t allocated()
+        {
+            return stat::s_nAllocated.load( CDS_ATOMIC::memory_order_relaxed ) ;
+        }
+
+        // Rebinding allocator to other type
+        template <class Other>
+        struct rebind {
+            typedef CountingAllocator<Other> other;
+        };
+    };
+}   // namespace memory
+
+#endif // #ifndef __CDS_UNIT_COUNTING_ALLOC_H
@@ -12,6 +12,7 @@
 #include "cppunit/thread.h"
 
 #include <cds/lock/spinlock.h>
+#include <cds/os/thread.h>
 
 // Multi-threaded stack test for push operation
 namespace lock {
@@ -72,6 +73,179 @@ namespace lock {
             }
         };
 
+        // Reader-writer lock test state
+        CDS_ATOMIC::atomic<size_t>  m_nActiveReaders    ;
+        CDS_ATOMIC::atomic<size_t>  m_nActiveWriters    ;
+        CDS_ATOMIC::atomic<size_t>  m_nMaxReaders       ;
+        CDS_ATOMIC::atomic<size_t>  m_nArrivedReaders   ;
+        CDS_ATOMIC::atomic<size_t>  m_nReaderCount      ;
+        size_t                      m_nWriteData1       ;   // written by the writers under exclusive lock,
+        size_t                      m_nWriteData2       ;   // the readers check m_nWriteData1 == m_nWriteData2
+
+        void reader_enter()
+        {
+            size_t nReaders = m_nActiveReaders.fetch_add( 1, CDS_ATOMIC::memory_order_acq_rel ) + 1 ;
+            size_t nMax = m_nMaxReaders.load( CDS_ATOMIC::memory_order_relaxed ) ;
+            while ( nReaders > nMax && !m_nMaxReaders.compare_exchange_weak( nMax, nReaders, CDS_ATOMIC::memory_order_relaxed, CDS_ATOMIC::memory_order_relaxed )) ;
+        }
+        void reader_leave()
+        {
+            m_nActiveReaders.fetch_sub( 1, CDS_ATOMIC::memory_order_acq_rel ) ;
+        }
+
+        // Reader overlap: every reader holds the shared lock until all readers have entered
+        template <class RWLOCK>
+        class RWOverlapThread: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new RWOverlapThread( *this )  ;
+            }
+        public:
+            RWLOCK&     m_Lock  ;
+
+        public:
+            RWOverlapThread( CppUnitMini::ThreadPool& pool, RWLOCK& l )
+                : CppUnitMini::TestThread( pool )
+                , m_Lock( l )
+            {}
+            RWOverlapThread( RWOverlapThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Lock( src.m_Lock )
+            {}
+
+            Spinlock_MT&  getTest()
+            {
+                return reinterpret_cast<Spinlock_MT&>( m_Pool.m_Test )   ;
+            }
+
+            virtual void init()
+            {}
+            virtual void fini()
+            {}
+
+            virtual void test()
+            {
+                Spinlock_MT& t = getTest() ;
+                size_t const nReaderCount = t.m_nReaderCount.load( CDS_ATOMIC::memory_order_relaxed ) ;
+
+                // No writer: try_lock_shared fails only if other reader changes the lock state concurrently
+                while ( !m_Lock.try_lock_shared() )
+                    cds::OS::yield() ;
+                t.reader_enter() ;
+                t.m_nArrivedReaders.fetch_add( 1, CDS_ATOMIC::memory_order_acq_rel ) ;
+                while ( t.m_nArrivedReaders.load( CDS_ATOMIC::memory_order_acquire ) < nReaderCount )
+                    cds::OS::yield() ;
+
+                // The lock is owned by the readers, a writer cannot get it
+                CPPUNIT_ASSERT( !m_Lock.try_lock() ) ;
+
+                t.reader_leave() ;
+                m_Lock.unlock_shared() ;
+            }
+        };
+
+        template <class RWLOCK>
+        class RWReaderThread: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new RWReaderThread( *this )  ;
+            }
+        public:
+            RWLOCK&     m_Lock  ;
+
+        public:
+            RWReaderThread( CppUnitMini::ThreadPool& pool, RWLOCK& l )
+                : CppUnitMini::TestThread( pool )
+                , m_Lock( l )
+            {}
+            RWReaderThread( RWReaderThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Lock( src.m_Lock )
+            {}
+
+            Spinlock_MT&  getTest()
+            {
+                return reinterpret_cast<Spinlock_MT&>( m_Pool.m_Test )   ;
+            }
+
+            virtual void init()
+            {}
+            virtual void fini()
+            {}
+
+            virtual void test()
+            {
+                Spinlock_MT& t = getTest() ;
+
+                for ( size_t i  = 0; i < s_nLoopCount; ++i ) {
+                    if ( (i & 1) == 0 || !m_Lock.try_lock_shared() )
+                        m_Lock.lock_shared() ;
+                    t.reader_enter() ;
+
+                    CPPUNIT_ASSERT( t.m_nActiveWriters.load( CDS_ATOMIC::memory_order_acquire ) == 0 ) ;
+                    CPPUNIT_ASSERT( t.m_nWriteData1 == t.m_nWriteData2 ) ;
+
+                    // Give other readers a chance to enter while the lock is owned
+                    if ( (i & 0xFF) == 0 )
+                        cds::OS::yield() ;
+
+                    t.reader_leave() ;
+                    m_Lock.unlock_shared() ;
+                }
+            }
+        };
+
+        template <class RWLOCK>
+        class RWWriterThread: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new RWWriterThread( *this )  ;
+            }
+        public:
+            RWLOCK&     m_Lock  ;
+
+        public:
+            RWWriterThread( CppUnitMini::ThreadPool& pool, RWLOCK& l )
+                : CppUnitMini::TestThread( pool )
+                , m_Lock( l )
+            {}
+            RWWriterThread( RWWriterThread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Lock( src.m_Lock )
+            {}
+
+            Spinlock_MT&  getTest()
+            {
+                return reinterpret_cast<Spinlock_MT&>( m_Pool.m_Test )   ;
+            }
+
+            virtual void init()
+            {}
+            virtual void fini()
+            {}
+
+            virtual void test()
+            {
+                Spinlock_MT& t = getTest() ;
+
+                for ( size_t i  = 0; i < s_nLoopCount; ++i ) {
+                    m_Lock.lock()   ;
+                    CPPUNIT_ASSERT( t.m_nActiveWriters.fetch_add( 1, CDS_ATOMIC::memory_order_acq_rel ) == 0 ) ;
+                    CPPUNIT_ASSERT( t.m_nActiveReaders.load( CDS_ATOMIC::memory_order_acquire ) == 0 ) ;
+
+                    ++t.m_nWriteData1 ;
+                    ++s_nSharedInt  ;
+                    ++t.m_nWriteData2 ;
+
+                    t.m_nActiveWriters.fetch_sub( 1, CDS_ATOMIC::memory_order_acq_rel ) ;
+                    m_Lock.unlock() ;
+                }
+            }
+        };
+
     protected:
         void setUpParams( const CppUnitMini::TestCfg& cfg ) {
             s_nThreadCount = cfg.getULong("ThreadCount", 8 ) ;
@@ -102,6 +276,57 @@ namespace lock {
             }
         }
 
+        template <class RWLOCK>
+        void test_rw()
+        {
+            RWLOCK  testLock    ;
+            size_t const nReaderCount = s_nThreadCount > 2 ? s_nThreadCount : 2 ;
+
+            CPPUNIT_MSG( "   Reader overlap test, reader count=" << nReaderCount << "...")   ;
+            {
+                m_nActiveReaders.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+                m_nMaxReaders.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+                m_nArrivedReaders.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+                m_nReaderCount.store( nReaderCount, CDS_ATOMIC::memory_order_release ) ;
+
+                CppUnitMini::ThreadPool pool( *this )   ;
+                pool.add( new RWOverlapThread<RWLOCK>( pool, testLock ), nReaderCount )  ;
+                pool.run()  ;
+
+                CPPUNIT_ASSERT_EX( m_nMaxReaders.load( CDS_ATOMIC::memory_order_relaxed ) == nReaderCount,
+                    "Expected=" << nReaderCount << " real=" << m_nMaxReaders.load( CDS_ATOMIC::memory_order_relaxed )) ;
+                CPPUNIT_ASSERT( !testLock.is_busy() ) ;
+            }
+
+            for ( size_t nThreadCount = 1; nThreadCount <= s_nThreadCount; nThreadCount *= 2 ) {
+                size_t const nWriterCount = (nThreadCount + 1) / 2 ;
+                s_nSharedInt = 0    ;
+                m_nWriteData1 = m_nWriteData2 = 0 ;
+                m_nActiveReaders.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+                m_nActiveWriters.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+                m_nMaxReaders.store( 0, CDS_ATOMIC::memory_order_relaxed ) ;
+
+                CppUnitMini::ThreadPool pool( *this )   ;
+                pool.add( new RWReaderThread<RWLOCK>( pool, testLock ), nThreadCount )  ;
+                pool.add( new RWWriterThread<RWLOCK>( pool, testLock ), nWriterCount )  ;
+
+                CPPUNIT_MSG( "   Reader-writer lock test, reader count=" << nThreadCount
+                    << " writer count=" << nWriterCount
+                    << " loop per thread=" << s_nLoopCount
+                    << "...")   ;
+                cds::OS::Timer      timer   ;
+                pool.run()  ;
+                CPPUNIT_MSG( "     Duration=" << timer.duration()
+                    << ", max concurrent readers=" << m_nMaxReaders.load( CDS_ATOMIC::memory_order_relaxed ))     ;
+
+                CPPUNIT_ASSERT_EX( s_nSharedInt == nWriterCount * s_nLoopCount,
+                    "Expected=" << nWriterCount * s_nLoopCount
+                    << " real=" << s_nSharedInt ) ;
+                CPPUNIT_ASSERT( m_nWriteData1 == s_nSharedInt && m_nWriteData2 == s_nSharedInt ) ;
+                CPPUNIT_ASSERT( !testLock.is_busy() ) ;
+            }
+        }
+
         typedef cds::lock::Spinlock<cds::backoff::exponential<cds::backoff::hint, cds::backoff::yield> > Spinlock_exp ;
 
         typedef cds::lock::ReentrantSpinT<unsigned int, cds::backoff::exponential<cds::backoff::hint, cds::backoff::yield> > reentrantSpin_exp ;
@@ -123,6 +348,9 @@ namespace lock {
         TEST_CASE(reentrantSpinlock_hint,       reentrantSpin_hint )  ;
         TEST_CASE(reentrantSpinlock_empty,      reentrantSpin_empty )  ;
 
+        TEST_CASE(rwSpinLock,           cds::lock::RWSpin )  ;
+        void rwSpinLock_shared()    { test_rw<cds::lock::RWSpin>(); }
+
     protected:
         CPPUNIT_TEST_SUITE(Spinlock_MT)
             CPPUNIT_TEST(spinLock_exp)          ;
@@ -138,6 +366,9 @@ namespace lock {
             CPPUNIT_TEST(reentrantSpinlock_yield)
             CPPUNIT_TEST(reentrantSpinlock_hint)
             CPPUNIT_TEST(reentrantSpinlock_empty)
+
+            CPPUNIT_TEST(rwSpinLock)
+            CPPUNIT_TEST(rwSpinLock_shared)
         CPPUNIT_TEST_SUITE_END();
     };
 
@@ -53,6 +53,8 @@
     TEST_MAP(MichaelMap_HRC_less_michaelAlloc) \
     TEST_MAP(MichaelMap_PTB_cmp_stdAlloc) \
     TEST_MAP(MichaelMap_PTB_less_michaelAlloc) \
+    TEST_MAP(MichaelMap_EBR_cmp_stdAlloc) \
+    TEST_MAP(MichaelMap_EBR_less_michaelAlloc) \
     TEST_MAP(MichaelMap_RCU_GPI_cmp_stdAlloc) \
     TEST_MAP(MichaelMap_RCU_GPI_less_michaelAlloc) \
     TEST_MAP(MichaelMap_RCU_GPB_cmp_stdAlloc) \
@@ -65,6 +67,8 @@
     TEST_MAP(MichaelMap_Lazy_HRC_less_michaelAlloc) \
     TEST_MAP(MichaelMap_Lazy_PTB_cmp_stdAlloc) \
     TEST_MAP(MichaelMap_Lazy_PTB_less_michaelAlloc) \
+    TEST_MAP(MichaelMap_Lazy_EBR_cmp_stdAlloc) \
+    TEST_MAP(MichaelMap_Lazy_EBR_less_michaelAlloc) \
     TEST_MAP(MichaelMap_Lazy_RCU_GPI_cmp_stdAlloc) \
     TEST_MAP(MichaelMap_Lazy_RCU_GPI_less_michaelAlloc) \
     TEST_MAP(MichaelMap_Lazy_RCU_GPB_cmp_stdAlloc) \
@@ -80,6 +84,8 @@
     CPPUNIT_TEST(MichaelMap_HRC_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_PTB_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_PTB_less_michaelAlloc) \
+    CPPUNIT_TEST(MichaelMap_EBR_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelMap_EBR_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_RCU_GPI_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_RCU_GPI_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_RCU_GPB_cmp_stdAlloc) \
@@ -92,6 +98,8 @@
     CPPUNIT_TEST(MichaelMap_Lazy_HRC_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_Lazy_PTB_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_Lazy_PTB_less_michaelAlloc) \
+    CPPUNIT_TEST(MichaelMap_Lazy_EBR_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelMap_Lazy_EBR_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_Lazy_RCU_GPI_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelMap_Lazy_RCU_GPI_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelMap_Lazy_RCU_GPB_cmp_stdAlloc) \
@@ -100,6 +108,20 @@
     CPPUNIT_TEST(MichaelMap_Lazy_RCU_GPT_less_michaelAlloc)\
     CDSUNIT_TEST_MichaelMap_RCU_signal
 
+#define CDSUNIT_DECLARE_MichaelMap_resizable  \
+    TEST_MAP(MichaelMap_HP_cmp_stdAlloc_undersized) \
+    TEST_MAP(MichaelMap_HP_cmp_stdAlloc_resizable) \
+    TEST_MAP(MichaelMap_PTB_cmp_stdAlloc_resizable) \
+    TEST_MAP(MichaelMap_Lazy_HP_cmp_stdAlloc_undersized) \
+    TEST_MAP(MichaelMap_Lazy_HP_cmp_stdAlloc_resizable)
+
+#define CDSUNIT_TEST_MichaelMap_resizable  \
+    CPPUNIT_TEST(MichaelMap_HP_cmp_stdAlloc_undersized) \
+    CPPUNIT_TEST(MichaelMap_HP_cmp_stdAlloc_resizable) \
+    CPPUNIT_TEST(MichaelMap_PTB_cmp_stdAlloc_resizable) \
+    CPPUNIT_TEST(MichaelMap_Lazy_HP_cmp_stdAlloc_undersized) \
+    CPPUNIT_TEST(MichaelMap_Lazy_HP_cmp_stdAlloc_resizable)
+
 #define CDSUNIT_DECLARE_MichaelMap_nogc  \
     TEST_MAP(MichaelMap_NOGC_cmp_stdAlloc) \
     TEST_MAP(MichaelMap_NOGC_less_michaelAlloc) \
@@ -167,6 +189,10 @@
     TEST_MAP(SplitList_Michael_PTB_st_cmp)\
     TEST_MAP(SplitList_Michael_PTB_dyn_less)\
     TEST_MAP(SplitList_Michael_PTB_st_less)\
+    TEST_MAP(SplitList_Michael_EBR_dyn_cmp)\
+    TEST_MAP(SplitList_Michael_EBR_st_cmp)\
+    TEST_MAP(SplitList_Michael_EBR_dyn_less)\
+    TEST_MAP(SplitList_Michael_EBR_st_less)\
     TEST_MAP(SplitList_Michael_RCU_GPI_dyn_cmp)\
     TEST_MAP(SplitList_Michael_RCU_GPI_st_cmp)\
     TEST_MAP(SplitList_Michael_RCU_GPI_dyn_less)\
@@ -191,6 +217,10 @@
     TEST_MAP(SplitList_Lazy_PTB_st_cmp)\
     TEST_MAP(SplitList_Lazy_PTB_dyn_less)\
     TEST_MAP(SplitList_Lazy_PTB_st_less)\
+    TEST_MAP(SplitList_Lazy_EBR_dyn_cmp)\
+    TEST_MAP(SplitList_Lazy_EBR_st_cmp)\
+    TEST_MAP(SplitList_Lazy_EBR_dyn_less)\
+    TEST_MAP(SplitList_Lazy_EBR_st_less)\
     TEST_MAP(SplitList_Lazy_RCU_GPI_dyn_cmp)\
     TEST_MAP(SplitList_Lazy_RCU_GPI_st_cmp)\
     TEST_MAP(SplitList_Lazy_RCU_GPI_dyn_less)\
@@ -218,6 +248,10 @@
     CPPUNIT_TEST(SplitList_Michael_PTB_st_cmp)\
     CPPUNIT_TEST(SplitList_Michael_PTB_dyn_less)\
     CPPUNIT_TEST(SplitList_Michael_PTB_st_less)\
+    CPPUNIT_TEST(SplitList_Michael_EBR_dyn_cmp)\
+    CPPUNIT_TEST(SplitList_Michael_EBR_st_cmp)\
+    CPPUNIT_TEST(SplitList_Michael_EBR_dyn_less)\
+    CPPUNIT_TEST(SplitList_Michael_EBR_st_less)\
     CPPUNIT_TEST(SplitList_Michael_RCU_GPI_dyn_cmp)\
     CPPUNIT_TEST(SplitList_Michael_RCU_GPI_st_cmp)\
     CPPUNIT_TEST(SplitList_Michael_RCU_GPI_dyn_less)\
@@ -242,6 +276,10 @@
     CPPUNIT_TEST(SplitList_Lazy_PTB_st_cmp)\
     CPPUNIT_TEST(SplitList_Lazy_PTB_dyn_less)\
     CPPUNIT_TEST(SplitList_Lazy_PTB_st_less)\
+    CPPUNIT_TEST(SplitList_Lazy_EBR_dyn_cmp)\
+    CPPUNIT_TEST(SplitList_Lazy_EBR_st_cmp)\
+    CPPUNIT_TEST(SplitList_Lazy_EBR_dyn_less)\
+    CPPUNIT_TEST(SplitList_Lazy_EBR_st_less)\
     CPPUNIT_TEST(SplitList_Lazy_RCU_GPI_dyn_cmp)\
     CPPUNIT_TEST(SplitList_Lazy_RCU_GPI_st_cmp)\
     CPPUNIT_TEST(SplitList_Lazy_RCU_GPI_dyn_less)\
@@ -307,6 +345,8 @@
     TEST_MAP_NOLF(SkipListMap_hp_cmp_pascal_stat)\
     TEST_MAP_NOLF(SkipListMap_hp_less_xorshift)\
     TEST_MAP_NOLF(SkipListMap_hp_cmp_xorshift_stat)\
+    TEST_MAP_NOLF(SkipListMap_hp_less_pascal_mem)\
+    TEST_MAP_NOLF(SkipListMap_hp_less_pascal_pool)\
     TEST_MAP_NOLF(SkipListMap_hrc_less_pascal)\
     TEST_MAP_NOLF(SkipListMap_hrc_cmp_pascal_stat)\
     TEST_MAP_NOLF(SkipListMap_hrc_less_xorshift)\
@@ -315,6 +355,10 @@
     TEST_MAP_NOLF(SkipListMap_ptb_cmp_pascal_stat)\
     TEST_MAP_NOLF(SkipListMap_ptb_less_xorshift)\
     TEST_MAP_NOLF(SkipListMap_ptb_cmp_xorshift_stat)\
+    TEST_MAP_NOLF(SkipListMap_ebr_less_pascal)\
+    TEST_MAP_NOLF(SkipListMap_ebr_cmp_pascal_stat)\
+    TEST_MAP_NOLF(SkipListMap_ebr_less_xorshift)\
+    TEST_MAP_NOLF(SkipListMap_ebr_cmp_xorshift_stat)\
     TEST_MAP_NOLF(SkipListMap_rcu_gpi_less_pascal)\
     TEST_MAP_NOLF(SkipListMap_rcu_gpi_cmp_pascal_stat)\
     TEST_MAP_NOLF(SkipListMap_rcu_gpi_less_xorshift)\
@@ -335,6 +379,8 @@
     CPPUNIT_TEST(SkipListMap_hp_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListMap_hp_less_xorshift)\
     CPPUNIT_TEST(SkipListMap_hp_cmp_xorshift_stat)\
+    CPPUNIT_TEST(SkipListMap_hp_less_pascal_mem)\
+    CPPUNIT_TEST(SkipListMap_hp_less_pascal_pool)\
     CPPUNIT_TEST(SkipListMap_hrc_less_pascal)\
     CPPUNIT_TEST(SkipListMap_hrc_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListMap_hrc_less_xorshift)\
@@ -343,6 +389,10 @@
     CPPUNIT_TEST(SkipListMap_ptb_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListMap_ptb_less_xorshift)\
     CPPUNIT_TEST(SkipListMap_ptb_cmp_xorshift_stat)\
+    CPPUNIT_TEST(SkipListMap_ebr_less_pascal)\
+    CPPUNIT_TEST(SkipListMap_ebr_cmp_pascal_stat)\
+    CPPUNIT_TEST(SkipListMap_ebr_less_xorshift)\
+    CPPUNIT_TEST(SkipListMap_ebr_cmp_xorshift_stat)\
     CPPUNIT_TEST(SkipListMap_rcu_gpi_less_pascal)\
     CPPUNIT_TEST(SkipListMap_rcu_gpi_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListMap_rcu_gpi_less_xorshift)\
@@ -369,14 +419,190 @@
     CPPUNIT_TEST(SkipListMap_nogc_less_xorshift)\
     CPPUNIT_TEST(SkipListMap_nogc_cmp_xorshift_stat)
 
+// Range scan is supported by HP, PTB and RCU-based skip-list maps only
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+#   define CDSUNIT_DECLARE_SkipListMap_RangeScan_RCU_signal \
+    TEST_MAP_NOLF(SkipListMap_rcu_shb_less_pascal)\
+    TEST_MAP_NOLF(SkipListMap_rcu_shb_cmp_xorshift_stat)\
+    TEST_MAP_NOLF(SkipListMap_rcu_sht_less_pascal)\
+    TEST_MAP_NOLF(SkipListMap_rcu_sht_cmp_xorshift_stat)
+
+#   define CDSUNIT_TEST_SkipListMap_RangeScan_RCU_signal \
+    CPPUNIT_TEST(SkipListMap_rcu_shb_less_pascal)\
+    CPPUNIT_TEST(SkipListMap_rcu_shb_cmp_xorshift_stat)\
+    CPPUNIT_TEST(SkipListMap_rcu_sht_less_pascal)\
+    CPPUNIT_TEST(SkipListMap_rcu_sht_cmp_xorshift_stat)
+#else
+#   define CDSUNIT_DECLARE_SkipListMap_RangeScan_RCU_signal
+#   define CDSUNIT_TEST_SkipListMap_RangeScan_RCU_signal
+#endif
+
+#define CDSUNIT_DECLARE_SkipListMap_RangeScan \
+    TEST_MAP_NOLF(SkipListMap_hp_less_pascal)\
+    TEST_MAP_NOLF(SkipListMap_hp_cmp_xorshift_stat)\
+    TEST_MAP_NOLF(SkipListMap_ptb_less_pascal)\
+    TEST_MAP_NOLF(SkipListMap_ptb_cmp_xorshift_stat)\
+    TEST_MAP_NOLF(SkipListMap_rcu_gpi_less_pascal)\
+    TEST_MAP_NOLF(SkipListMap_rcu_gpi_cmp_xorshift_stat)\
+    TEST_MAP_NOLF(SkipListMap_rcu_gpb_less_pascal)\
+    TEST_MAP_NOLF(SkipListMap_rcu_gpb_cmp_xorshift_stat)\
+    TEST_MAP_NOLF(SkipListMap_rcu_gpt_less_pascal)\
+    TEST_MAP_NOLF(SkipListMap_rcu_gpt_cmp_xorshift_stat)\
+    CDSUNIT_DECLARE_SkipListMap_RangeScan_RCU_signal
+
+#define CDSUNIT_TEST_SkipListMap_RangeScan \
+    CPPUNIT_TEST(SkipListMap_hp_less_pascal)\
+    CPPUNIT_TEST(SkipListMap_hp_cmp_xorshift_stat)\
+    CPPUNIT_TEST(SkipListMap_ptb_less_pascal)\
+    CPPUNIT_TEST(SkipListMap_ptb_cmp_xorshift_stat)\
+    CPPUNIT_TEST(SkipListMap_rcu_gpi_less_pascal)\
+    CPPUNIT_TEST(SkipListMap_rcu_gpi_cmp_xorshift_stat)\
+    CPPUNIT_TEST(SkipListMap_rcu_gpb_less_pascal)\
+    CPPUNIT_TEST(SkipListMap_rcu_gpb_cmp_xorshift_stat)\
+    CPPUNIT_TEST(SkipListMap_rcu_gpt_less_pascal)\
+    CPPUNIT_TEST(SkipListMap_rcu_gpt_cmp_xorshift_stat)\
+    CDSUNIT_TEST_SkipListMap_RangeScan_RCU_signal
+
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+#   define CDSUNIT_DECLARE_MultiLevelHashMap_RCU_signal \
+    TEST_MAP_NOLF(MultiLevelHashMap_rcu_shb)\
+    TEST_MAP_NOLF(MultiLevelHashMap_rcu_shb_stat)\
+    TEST_MAP_NOLF(MultiLevelHashMap_rcu_sht)\
+    TEST_MAP_NOLF(MultiLevelHashMap_rcu_sht_stat)
+
+#   define CDSUNIT_TEST_MultiLevelHashMap_RCU_signal \
+    CPPUNIT_TEST(MultiLevelHashMap_rcu_shb)\
+    CPPUNIT_TEST(MultiLevelHashMap_rcu_shb_stat)\
+    CPPUNIT_TEST(MultiLevelHashMap_rcu_sht)\
+    CPPUNIT_TEST(MultiLevelHashMap_rcu_sht_stat)
+
+#else
+#   define CDSUNIT_DECLARE_MultiLevelHashMap_RCU_signal
+#   define CDSUNIT_TEST_MultiLevelHashMap_RCU_signal
+#endif
+
+#define CDSUNIT_DECLARE_MultiLevelHashMap \
+    TEST_MAP_NOLF(MultiLevelHashMap_hp)\
+    TEST_MAP_NOLF(MultiLevelHashMap_hp_stat)\
+    TEST_MAP_NOLF(MultiLevelHashMap_ptb)\
+    TEST_MAP_NOLF(MultiLevelHashMap_ptb_stat)\
+    TEST_MAP_NOLF(MultiLevelHashMap_ebr)\
+    TEST_MAP_NOLF(MultiLevelHashMap_ebr_stat)\
+    TEST_MAP_NOLF(MultiLevelHashMap_rcu_gpi)\
+    TEST_MAP_NOLF(MultiLevelHashMap_rcu_gpi_stat)\
+    TEST_MAP_NOLF(MultiLevelHashMap_rcu_gpb)\
+    TEST_MAP_NOLF(MultiLevelHashMap_rcu_gpb_stat)\
+    TEST_MAP_NOLF(MultiLevelHashMap_rcu_gpt)\
+    TEST_MAP_NOLF(MultiLevelHashMap_rcu_gpt_stat)\
+    CDSUNIT_DECLARE_MultiLevelHashMap_RCU_signal
+
+#define CDSUNIT_TEST_MultiLevelHashMap \
+    CPPUNIT_TEST(MultiLevelHashMap_hp)\
+    CPPUNIT_TEST(MultiLevelHashMap_hp_stat)\
+    CPPUNIT_TEST(MultiLevelHashMap_ptb)\
+    CPPUNIT_TEST(MultiLevelHashMap_ptb_stat)\
+    CPPUNIT_TEST(MultiLevelHashMap_ebr)\
+    CPPUNIT_TEST(MultiLevelHashMap_ebr_stat)\
+    CPPUNIT_TEST(MultiLevelHashMap_rcu_gpi)\
+    CPPUNIT_TEST(MultiLevelHashMap_rcu_gpi_stat)\
+    CPPUNIT_TEST(MultiLevelHashMap_rcu_gpb)\
+    CPPUNIT_TEST(MultiLevelHashMap_rcu_gpb_stat)\
+    CPPUNIT_TEST(MultiLevelHashMap_rcu_gpt)\
+    CPPUNIT_TEST(MultiLevelHashMap_rcu_gpt_stat)\
+    CDSUNIT_TEST_MultiLevelHashMap_RCU_signal
+
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+#   define CDSUNIT_DECLARE_EllenBinTreeMap_RCU_signal \
+    TEST_MAP_NOLF(EllenBinTreeMap_rcu_shb)\
+    TEST_MAP_NOLF(EllenBinTreeMap_rcu_shb_stat)\
+    TEST_MAP_NOLF(EllenBinTreeMap_rcu_sht)\
+    TEST_MAP_NOLF(EllenBinTreeMap_rcu_sht_stat)
+
+#   define CDSUNIT_TEST_EllenBinTreeMap_RCU_signal \
+    CPPUNIT_TEST(EllenBinTreeMap_rcu_shb)\
+    CPPUNIT_TEST(EllenBinTreeMap_rcu_shb_stat)\
+    CPPUNIT_TEST(EllenBinTreeMap_rcu_sht)\
+    CPPUNIT_TEST(EllenBinTreeMap_rcu_sht_stat)
+
+#else
+#   define CDSUNIT_DECLARE_EllenBinTreeMap_RCU_signal
+#   define CDSUNIT_TEST_EllenBinTreeMap_RCU_signal
+#endif
+
+#define CDSUNIT_DECLARE_EllenBinTreeMap \
+    TEST_MAP_NOLF(EllenBinTreeMap_hp)\
+    TEST_MAP_NOLF(EllenBinTreeMap_hp_stat)\
+    TEST_MAP_NOLF(EllenBinTreeMap_ptb)\
+    TEST_MAP_NOLF(EllenBinTreeMap_ptb_stat)\
+    TEST_MAP_NOLF(EllenBinTreeMap_rcu_gpi)\
+    TEST_MAP_NOLF(EllenBinTreeMap_rcu_gpi_stat)\
+    TEST_MAP_NOLF(EllenBinTreeMap_rcu_gpb)\
+    TEST_MAP_NOLF(EllenBinTreeMap_rcu_gpb_stat)\
+    TEST_MAP_NOLF(EllenBinTreeMap_rcu_gpt)\
+    TEST_MAP_NOLF(EllenBinTreeMap_rcu_gpt_stat)\
+    CDSUNIT_DECLARE_EllenBinTreeMap_RCU_signal
+
+#define CDSUNIT_TEST_EllenBinTreeMap \
+    CPPUNIT_TEST(EllenBinTreeMap_hp)\
+    CPPUNIT_TEST(EllenBinTreeMap_hp_stat)\
+    CPPUNIT_TEST(EllenBinTreeMap_ptb)\
+    CPPUNIT_TEST(EllenBinTreeMap_ptb_stat)\
+    CPPUNIT_TEST(EllenBinTreeMap_rcu_gpi)\
+    CPPUNIT_TEST(EllenBinTreeMap_rcu_gpi_stat)\
+    CPPUNIT_TEST(EllenBinTreeMap_rcu_gpb)\
+    CPPUNIT_TEST(EllenBinTreeMap_rcu_gpb_stat)\
+    CPPUNIT_TEST(EllenBinTreeMap_rcu_gpt)\
+    CPPUNIT_TEST(EllenBinTreeMap_rcu_gpt_stat)\
+    CDSUNIT_TEST_EllenBinTreeMap_RCU_signal
+
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+#   define CDSUNIT_DECLARE_BronsonAVLTreeMap_RCU_signal \
+    TEST_MAP_NOLF(BronsonAVLTreeMap_rcu_shb)\
+    TEST_MAP_NOLF(BronsonAVLTreeMap_rcu_shb_stat)\
+    TEST_MAP_NOLF(BronsonAVLTreeMap_rcu_sht)\
+    TEST_MAP_NOLF(BronsonAVLTreeMap_rcu_sht_stat)
+
+#   define CDSUNIT_TEST_BronsonAVLTreeMap_RCU_signal \
+    CPPUNIT_TEST(BronsonAVLTreeMap_rcu_shb)\
+    CPPUNIT_TEST(BronsonAVLTreeMap_rcu_shb_stat)\
+    CPPUNIT_TEST(BronsonAVLTreeMap_rcu_sht)\
+    CPPUNIT_TEST(BronsonAVLTreeMap_rcu_sht_stat)
+
+#else
+#   define CDSUNIT_DECLARE_BronsonAVLTreeMap_RCU_signal
+#   define CDSUNIT_TEST_BronsonAVLTreeMap_RCU_signal
+#endif
+
+#define CDSUNIT_DECLARE_BronsonAVLTreeMap \
+    TEST_MAP_NOLF(BronsonAVLTreeMap_rcu_gpi)\
+    TEST_MAP_NOLF(BronsonAVLTreeMap_rcu_gpi_stat)\
+    TEST_MAP_NOLF(BronsonAVLTreeMap_rcu_gpb)\
+    TEST_MAP_NOLF(BronsonAVLTreeMap_rcu_gpb_stat)\
+    TEST_MAP_NOLF(BronsonAVLTreeMap_rcu_gpt)\
+    TEST_MAP_NOLF(BronsonAVLTreeMap_rcu_gpt_stat)\
+    CDSUNIT_DECLARE_BronsonAVLTreeMap_RCU_signal
+
+#define CDSUNIT_TEST_BronsonAVLTreeMap \
+    CPPUNIT_TEST(BronsonAVLTreeMap_rcu_gpi)\
+    CPPUNIT_TEST(BronsonAVLTreeMap_rcu_gpi_stat)\
+    CPPUNIT_TEST(BronsonAVLTreeMap_rcu_gpb)\
+    CPPUNIT_TEST(BronsonAVLTreeMap_rcu_gpb_stat)\
+    CPPUNIT_TEST(BronsonAVLTreeMap_rcu_gpt)\
+    CPPUNIT_TEST(BronsonAVLTreeMap_rcu_gpt_stat)\
+    CDSUNIT_TEST_BronsonAVLTreeMap_RCU_signal
+
 #define CDSUNIT_DECLARE_StripedMap_common \
     TEST_MAP(StripedMap_list) \
+    TEST_MAP(StripedMap_list_incremental) \
+    TEST_MAP(StripedMap_flat_bucket) \
     TEST_MAP(StripedMap_map) \
     TEST_MAP(StripedMap_hashmap) \
     TEST_MAP(StripedMap_boost_unordered_map)
 
 #define CDSUNIT_TEST_StripedMap_common \
     CPPUNIT_TEST(StripedMap_list) \
+    CPPUNIT_TEST(StripedMap_list_incremental) \
+    CPPUNIT_TEST(StripedMap_flat_bucket) \
     CPPUNIT_TEST(StripedMap_map) \
     CPPUNIT_TEST(StripedMap_hashmap) \
     CPPUNIT_TEST(StripedMap_boost_unordered_map)
@@ -416,13 +642,31 @@
 
 
 
+#define CDSUNIT_DECLARE_RWStripedMap \
+    TEST_MAP(RWStripedMap_list) \
+    TEST_MAP(RWStripedMap_flat_bucket) \
+    TEST_MAP(RWStripedMap_map) \
+    TEST_MAP(RWStripedMap_hashmap) \
+    TEST_MAP(RWStripedMap_boost_unordered_map)
+#define CDSUNIT_TEST_RWStripedMap \
+    CPPUNIT_TEST(RWStripedMap_list) \
+    CPPUNIT_TEST(RWStripedMap_flat_bucket) \
+    CPPUNIT_TEST(RWStripedMap_map) \
+    CPPUNIT_TEST(RWStripedMap_hashmap) \
+    CPPUNIT_TEST(RWStripedMap_boost_unordered_map)
+
+
 #define CDSUNIT_DECLARE_RefinableMap_common \
     TEST_MAP(RefinableMap_list) \
+    TEST_MAP(RefinableMap_list_incremental) \
+    TEST_MAP(RefinableMap_flat_bucket) \
     TEST_MAP(RefinableMap_map) \
     TEST_MAP(RefinableMap_hashmap) \
     TEST_MAP(RefinableMap_boost_unordered_map)
 #define CDSUNIT_TEST_RefinableMap_common \
     CPPUNIT_TEST(RefinableMap_list) \
+    CPPUNIT_TEST(RefinableMap_list_incremental) \
+    CPPUNIT_TEST(RefinableMap_flat_bucket) \
     CPPUNIT_TEST(RefinableMap_map) \
     CPPUNIT_TEST(RefinableMap_hashmap) \
     CPPUNIT_TEST(RefinableMap_boost_unordered_map)
@@ -512,4 +756,16 @@
     CPPUNIT_TEST(CuckooRefinableMap_vector_ord_stat)\
     CPPUNIT_TEST(CuckooRefinableMap_vector_ord_storehash)
 
+#define CDSUNIT_DECLARE_LinearProbingMap \
+    TEST_MAP(LinearProbingMap_hp)\
+    TEST_MAP(LinearProbingMap_hp_stat)\
+    TEST_MAP(LinearProbingMap_ptb)\
+    TEST_MAP(LinearProbingMap_ptb_stat)
+
+#define CDSUNIT_TEST_LinearProbingMap \
+    CPPUNIT_TEST(LinearProbingMap_hp)\
+    CPPUNIT_TEST(LinearProbingMap_hp_stat)\
+    CPPUNIT_TEST(LinearProbingMap_ptb)\
+    CPPUNIT_TEST(LinearProbingMap_ptb_stat)
+
 #endif // #ifndef _CDSUNIT_MAP2_MAP_DEFS_H
@@ -257,9 +257,12 @@ namespace map2 {
         CDSUNIT_DECLARE_SplitList_nogc
         CDSUNIT_DECLARE_SkipListMap
         CDSUNIT_DECLARE_SkipListMap_nogc
+        CDSUNIT_DECLARE_BronsonAVLTreeMap
         CDSUNIT_DECLARE_StripedMap
+        CDSUNIT_DECLARE_RWStripedMap
         CDSUNIT_DECLARE_RefinableMap
         CDSUNIT_DECLARE_CuckooMap
+        CDSUNIT_DECLARE_LinearProbingMap
         CDSUNIT_DECLARE_StdMap
 
         CPPUNIT_TEST_SUITE( Map_find_int )
@@ -269,9 +272,12 @@ namespace map2 {
             CDSUNIT_TEST_SplitList_nogc
             CDSUNIT_TEST_SkipListMap
             CDSUNIT_TEST_SkipListMap_nogc
+            CDSUNIT_TEST_BronsonAVLTreeMap
             CDSUNIT_TEST_StripedMap
+            CDSUNIT_TEST_RWStripedMap
             CDSUNIT_TEST_RefinableMap
             CDSUNIT_TEST_CuckooMap
+            CDSUNIT_TEST_LinearProbingMap
             CDSUNIT_TEST_StdMap
         CPPUNIT_TEST_SUITE_END()
     } ;
@@ -255,6 +255,7 @@ namespace map2 {
         CDSUNIT_DECLARE_SkipListMap
         CDSUNIT_DECLARE_SkipListMap_nogc
         CDSUNIT_DECLARE_StripedMap
+        CDSUNIT_DECLARE_RWStripedMap
         CDSUNIT_DECLARE_RefinableMap
         CDSUNIT_DECLARE_CuckooMap
         CDSUNIT_DECLARE_StdMap
@@ -267,6 +268,7 @@ namespace map2 {
             CDSUNIT_TEST_SkipListMap
             CDSUNIT_TEST_SkipListMap_nogc
             CDSUNIT_TEST_StripedMap
+            CDSUNIT_TEST_RWStripedMap
             CDSUNIT_TEST_RefinableMap
             CDSUNIT_TEST_CuckooMap
             CDSUNIT_TEST_StdMap
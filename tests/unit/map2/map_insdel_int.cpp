@@ -249,20 +249,24 @@ namespace map2 {
 
 #   include "map2/map_defs.h"
         CDSUNIT_DECLARE_MichaelMap
+        CDSUNIT_DECLARE_MichaelMap_resizable
         CDSUNIT_DECLARE_SplitList
         CDSUNIT_DECLARE_SkipListMap
         CDSUNIT_DECLARE_StripedMap
         CDSUNIT_DECLARE_RefinableMap
         CDSUNIT_DECLARE_CuckooMap
+        CDSUNIT_DECLARE_LinearProbingMap
         CDSUNIT_DECLARE_StdMap
 
         CPPUNIT_TEST_SUITE( Map_InsDel_int )
             CDSUNIT_TEST_MichaelMap
+            CDSUNIT_TEST_MichaelMap_resizable
             CDSUNIT_TEST_SplitList
             CDSUNIT_TEST_SkipListMap
             CDSUNIT_TEST_StripedMap
             CDSUNIT_TEST_RefinableMap
             CDSUNIT_TEST_CuckooMap
+            CDSUNIT_TEST_LinearProbingMap
             CDSUNIT_TEST_StdMap
         CPPUNIT_TEST_SUITE_END()
 
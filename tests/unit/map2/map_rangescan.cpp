@@ -0,0 +1,277 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "map2/map_types.h"
+#include "cppunit/thread.h"
+
+namespace map2 {
+
+#    define TEST_MAP(X)         void X() { test<MapTypes<key_type, value_type>::X >()    ; }
+#    define TEST_MAP_NOLF(X)    void X() { test<MapTypes<key_type, value_type>::X >()    ; }
+
+    namespace {
+        static size_t  c_nInitialMapSize = 500000   ;  // initial map size
+        static size_t  c_nScanThreadCount = 4       ;  // count of range scan threads
+        static size_t  c_nWriterThreadCount = 4     ;  // count of insert/erase threads
+        static size_t  c_nScanLength = 1000         ;  // key range length of each scan
+        static unsigned int c_nDuration = 30        ;  // test duration, seconds
+        static bool    c_bPrintGCState = true       ;
+
+        // RCU-based maps require the RCU to be locked while the range cursor is alive
+        template <class GC>
+        struct scan_lock
+        {};
+
+        template <class RCU>
+        struct scan_lock< cds::urcu::gc<RCU> >
+        {
+            typename cds::urcu::gc<RCU>::scoped_lock m_lock ;
+        };
+    }
+
+    class Map_RangeScan: public CppUnitMini::TestCase
+    {
+    protected:
+        typedef size_t  key_type    ;
+        typedef size_t  value_type  ;
+
+        template <class MAP>
+        class Scanner: public CppUnitMini::TestThread
+        {
+            MAP&     m_Map      ;
+
+            virtual Scanner *    clone()
+            {
+                return new Scanner( *this )    ;
+            }
+        public:
+            size_t  m_nScanCount        ;
+            size_t  m_nItemCount        ;
+            size_t  m_nOrderViolation   ;
+
+        public:
+            Scanner( CppUnitMini::ThreadPool& pool, MAP& rMap )
+                : CppUnitMini::TestThread( pool )
+                , m_Map( rMap )
+            {}
+            Scanner( Scanner& src )
+                : CppUnitMini::TestThread( src )
+                , m_Map( src.m_Map )
+            {}
+
+            Map_RangeScan&  getTest()
+            {
+                return reinterpret_cast<Map_RangeScan&>( m_Pool.m_Test )   ;
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                MAP& rMap = m_Map   ;
+
+                m_nScanCount =
+                    m_nItemCount =
+                    m_nOrderViolation = 0 ;
+
+                size_t const nNormalize = size_t(-1) / (c_nInitialMapSize * 2) ;
+
+                size_t nRand = m_nThreadNo + 1 ;
+                while ( !time_elapsed() ) {
+                    nRand = cds::bitop::RandXorShift(nRand) ;
+                    key_type const nFrom = nRand / nNormalize ;
+                    key_type const nTo = nFrom + c_nScanLength ;
+
+                    {
+                        scan_lock< typename MAP::gc > sl    ;
+                        typename MAP::range_cursor cur( rMap )  ;
+
+                        key_type nPrev = nFrom  ;
+                        bool bFirst = true      ;
+                        for ( bool bOk = cur.lower_bound( nFrom ); bOk && cur->first < nTo; bOk = cur.next() ) {
+                            if ( !bFirst && cur->first <= nPrev )
+                                ++m_nOrderViolation ;
+                            nPrev = cur->first  ;
+                            bFirst = false      ;
+                            ++m_nItemCount      ;
+                        }
+                    }
+                    ++m_nScanCount  ;
+                }
+            }
+        };
+
+        template <class MAP>
+        class Writer: public CppUnitMini::TestThread
+        {
+            MAP&     m_Map      ;
+
+            virtual Writer *    clone()
+            {
+                return new Writer( *this )    ;
+            }
+        public:
+            size_t  m_nInsertSuccess    ;
+            size_t  m_nInsertFailed     ;
+            size_t  m_nDeleteSuccess    ;
+            size_t  m_nDeleteFailed     ;
+
+        public:
+            Writer( CppUnitMini::ThreadPool& pool, MAP& rMap )
+                : CppUnitMini::TestThread( pool )
+                , m_Map( rMap )
+            {}
+            Writer( Writer& src )
+                : CppUnitMini::TestThread( src )
+                , m_Map( src.m_Map )
+            {}
+
+            Map_RangeScan&  getTest()
+            {
+                return reinterpret_cast<Map_RangeScan&>( m_Pool.m_Test )   ;
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                MAP& rMap = m_Map   ;
+
+                m_nInsertSuccess =
+                    m_nInsertFailed =
+                    m_nDeleteSuccess =
+                    m_nDeleteFailed = 0 ;
+
+                size_t const nNormalize = size_t(-1) / (c_nInitialMapSize * 2) ;
+
+                size_t nRand = m_nThreadNo + 1 ;
+                while ( !time_elapsed() ) {
+                    nRand = cds::bitop::RandXorShift(nRand) ;
+                    key_type const n = nRand / nNormalize ;
+                    if ( nRand & 1 ) {
+                        if ( rMap.insert( n, n ))
+                            ++m_nInsertSuccess ;
+                        else
+                            ++m_nInsertFailed ;
+                    }
+                    else {
+                        if ( rMap.erase( n ))
+                            ++m_nDeleteSuccess ;
+                        else
+                            ++m_nDeleteFailed ;
+                    }
+                }
+            }
+        };
+
+    protected:
+        template <class MAP>
+        void do_test( MAP& testMap )
+        {
+            typedef Scanner<MAP>    scan_thread     ;
+            typedef Writer<MAP>     writer_thread   ;
+
+            // fill map - only odd number
+            for ( size_t i = 0; i < c_nInitialMapSize; ++i )
+                testMap.insert( i * 2 + 1, i * 2 + 1 )  ;
+
+            cds::OS::Timer    timer    ;
+
+            CppUnitMini::ThreadPool pool( *this )   ;
+            pool.add( new scan_thread( pool, testMap ), c_nScanThreadCount ) ;
+            if ( c_nWriterThreadCount )
+                pool.add( new writer_thread( pool, testMap ), c_nWriterThreadCount ) ;
+            pool.run( c_nDuration ) ;
+            CPPUNIT_MSG( "   Duration=" << pool.avgDuration() ) ;
+
+            size_t nScanCount = 0       ;
+            size_t nItemCount = 0       ;
+            size_t nOrderViolation = 0  ;
+            size_t nInsertSuccess = 0   ;
+            size_t nInsertFailed = 0    ;
+            size_t nDeleteSuccess = 0   ;
+            size_t nDeleteFailed = 0    ;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                scan_thread * pScanner = dynamic_cast<scan_thread *>( *it )   ;
+                if ( pScanner ) {
+                    nScanCount += pScanner->m_nScanCount            ;
+                    nItemCount += pScanner->m_nItemCount            ;
+                    nOrderViolation += pScanner->m_nOrderViolation  ;
+                }
+                else {
+                    writer_thread * p = static_cast<writer_thread *>( *it ) ;
+                    nInsertSuccess += p->m_nInsertSuccess   ;
+                    nInsertFailed += p->m_nInsertFailed     ;
+                    nDeleteSuccess += p->m_nDeleteSuccess   ;
+                    nDeleteFailed += p->m_nDeleteFailed     ;
+                }
+            }
+
+            CPPUNIT_MSG( "  Totals (success/failed): \n\t"
+                      << "      Insert=" << nInsertSuccess << '/' << nInsertFailed << "\n\t"
+                      << "      Delete=" << nDeleteSuccess << '/' << nDeleteFailed << "\n\t"
+                      << "        Scan=" << nScanCount << ", items=" << nItemCount << "\n\t"
+                      << "       Speed=" << nScanCount / c_nDuration << " scan/sec\n\t"
+                      << "             " << nItemCount / c_nDuration << " item/sec\n\t"
+                      << "             " << (nInsertSuccess + nDeleteSuccess) / c_nDuration << " modify/sec\n\t"
+                      << "      Map size=" << testMap.size()
+                ) ;
+            CPPUNIT_CHECK_EX( nOrderViolation == 0, "Key order violations: " << nOrderViolation ) ;
+
+            CPPUNIT_MSG( "  Clear map (single-threaded)..." ) ;
+            timer.reset()   ;
+            testMap.clear() ;
+            CPPUNIT_MSG( "   Duration=" << timer.duration() ) ;
+            CPPUNIT_ASSERT_EX( testMap.empty(), ((long long) testMap.size()) ) ;
+
+            print_stat( testMap ) ;
+        }
+
+        template <class MAP>
+        void test()
+        {
+            CPPUNIT_MSG( "Thread count: scan=" << c_nScanThreadCount
+                << " writer=" << c_nWriterThreadCount
+                << " initial map size=" << c_nInitialMapSize
+                << " scan length=" << c_nScanLength
+                << " duration=" << c_nDuration << "s"
+                );
+
+            MAP testMap ;
+            do_test( testMap )     ;
+            if ( c_bPrintGCState )
+                print_gc_state()            ;
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            c_nInitialMapSize = cfg.getULong("InitialMapSize", 500000 ) ;
+            c_nScanThreadCount = cfg.getULong("ScanThreadCount", 4 )    ;
+            c_nWriterThreadCount = cfg.getULong("WriterThreadCount", 4 );
+            c_nScanLength = cfg.getULong("ScanLength", 1000 )           ;
+            c_nDuration = cfg.getUInt("Duration", 30 )   ;
+            c_bPrintGCState = cfg.getBool("PrintGCStateFlag", true )    ;
+
+            if ( c_nScanThreadCount == 0 )
+                c_nScanThreadCount = cds::OS::topology::processor_count()   ;
+        }
+
+#   include "map2/map_defs.h"
+        CDSUNIT_DECLARE_SkipListMap_RangeScan
+
+        CPPUNIT_TEST_SUITE( Map_RangeScan )
+            CDSUNIT_TEST_SkipListMap_RangeScan
+        CPPUNIT_TEST_SUITE_END()
+    } ;
+
+    CPPUNIT_TEST_SUITE_REGISTRATION( Map_RangeScan );
+} // namespace map2
@@ -21,12 +21,14 @@
 #include <cds/container/michael_kvlist_hp.h>
 #include <cds/container/michael_kvlist_hrc.h>
 #include <cds/container/michael_kvlist_ptb.h>
+#include <cds/container/michael_kvlist_ebr.h>
 #include <cds/container/michael_kvlist_rcu.h>
 #include <cds/container/michael_kvlist_nogc.h>
 
 #include <cds/container/lazy_kvlist_hp.h>
 #include <cds/container/lazy_kvlist_hrc.h>
 #include <cds/container/lazy_kvlist_ptb.h>
+#include <cds/container/lazy_kvlist_ebr.h>
 #include <cds/container/lazy_kvlist_rcu.h>
 #include <cds/container/lazy_kvlist_nogc.h>
 
@@ -41,14 +43,28 @@
 #include <cds/container/striped_map/std_list.h>
 #include <cds/container/striped_map/std_map.h>
 #include <cds/container/striped_map/std_hash_map.h>
+#include <cds/container/striped_map/flat_bucket.h>
 #include <cds/container/cuckoo_map.h>
 
 #include <cds/container/skip_list_map_hp.h>
 #include <cds/container/skip_list_map_hrc.h>
 #include <cds/container/skip_list_map_ptb.h>
+#include <cds/container/skip_list_map_ebr.h>
 #include <cds/container/skip_list_map_rcu.h>
 #include <cds/container/skip_list_map_nogc.h>
 
+#include <cds/container/multilevel_hashmap_hp.h>
+#include <cds/container/multilevel_hashmap_ptb.h>
+#include <cds/container/multilevel_hashmap_ebr.h>
+#include <cds/container/multilevel_hashmap_rcu.h>
+#include <cds/container/linear_probing_map_hp.h>
+#include <cds/container/linear_probing_map_ptb.h>
+
+#include <cds/container/ellen_bintree_map_hp.h>
+#include <cds/container/ellen_bintree_map_ptb.h>
+#include <cds/container/ellen_bintree_map_rcu.h>
+#include <cds/container/bronson_avltree_map_rcu.h>
+
 #include <boost/version.hpp>
 #if BOOST_VERSION >= 104800
 #   include <cds/container/striped_map/boost_list.h>
@@ -66,8 +82,13 @@
 #include "map2/std_map.h"
 #include "map2/std_hash_map.h"
 #include "michael_alloc.h"
+#include "counting_alloc.h"
 #include "print_cuckoo_stat.h"
 #include "print_skip_list_stat.h"
+#include "print_multilevel_hashset_stat.h"
+#include "print_linear_probing_map_stat.h"
+#include "print_ellen_bintree_stat.h"
+#include "print_bronson_avltree_stat.h"
 
 namespace map2 {
     namespace cc = cds::container   ;
@@ -165,6 +186,42 @@ namespace map2 {
         {}
     };
 
+    // LinearProbingMap keeps word-sized integral values only.
+    // Map_find_int stores a struct as the value, so the wrapper keeps the word values as is
+    // and stores the default value instead of any other value type; the benchmarks check the keys only
+    template <class GC, typename K, typename V, CDS_DECL_OPTIONS6>
+    class LinearProbingMapWrapper:
+        public cc::LinearProbingMap< GC, K, size_t,
+            typename cc::linear_probing_map::make_traits< CDS_OPTIONS6 >::type
+        >
+    {
+    public:
+        typedef cc::LinearProbingMap< GC, K, size_t,
+            typename cc::linear_probing_map::make_traits< CDS_OPTIONS6 >::type
+        > linear_probing_base_class ;
+
+    public:
+        LinearProbingMapWrapper( size_t nCapacity, size_t nLoadFactor )
+            : linear_probing_base_class( nCapacity / nLoadFactor )
+        {}
+
+        bool insert( K key )
+        {
+            return linear_probing_base_class::insert( key ) ;
+        }
+
+        bool insert( K key, size_t val )
+        {
+            return linear_probing_base_class::insert( key, val ) ;
+        }
+
+        template <typename Q>
+        bool insert( K key, Q const& /*val*/ )
+        {
+            return linear_probing_base_class::insert( key ) ;
+        }
+    };
+
     template <typename Key, typename Value>
     struct MapTypes {
         typedef co::v::hash<Key>    hash    ;
@@ -311,6 +368,46 @@ namespace map2 {
             >::type
         >   MichaelList_PTB_less_michaelAlloc ;
 
+        typedef cc::MichaelKVList< cds::gc::EBR, Key, Value,
+            typename cc::michael_list::make_traits<
+                co::compare< compare >
+            >::type
+        >   MichaelList_EBR_cmp_stdAlloc ;
+
+        typedef cc::MichaelKVList< cds::gc::EBR, Key, Value,
+            typename cc::michael_list::make_traits<
+                co::compare< compare >
+                ,co::memory_model< co::v::sequential_consistent >
+            >::type
+        >   MichaelList_EBR_cmp_stdAlloc_seqcst ;
+
+        typedef cc::MichaelKVList< cds::gc::EBR, Key, Value,
+            typename cc::michael_list::make_traits<
+                co::compare< compare >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   MichaelList_EBR_cmp_michaelAlloc ;
+
+        typedef cc::MichaelKVList< cds::gc::EBR, Key, Value,
+            typename cc::michael_list::make_traits<
+                co::less< less >
+            >::type
+        >   MichaelList_EBR_less_stdAlloc ;
+
+        typedef cc::MichaelKVList< cds::gc::EBR, Key, Value,
+            typename cc::michael_list::make_traits<
+                co::less< less >
+                ,co::memory_model< co::v::sequential_consistent >
+            >::type
+        >   MichaelList_EBR_less_stdAlloc_seqcst ;
+
+        typedef cc::MichaelKVList< cds::gc::EBR, Key, Value,
+            typename cc::michael_list::make_traits<
+                co::less< less >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   MichaelList_EBR_less_michaelAlloc ;
+
         // RCU
         typedef cc::MichaelKVList< rcu_gpi, Key, Value,
             typename cc::michael_list::make_traits<
@@ -742,6 +839,44 @@ namespace map2 {
             >::type
         >   MichaelMap_PTB_less_michaelAlloc  ;
 
+        typedef cc::MichaelHashMap< cds::gc::EBR, MichaelList_EBR_cmp_stdAlloc,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelMap_EBR_cmp_stdAlloc  ;
+
+        typedef cc::MichaelHashMap< cds::gc::EBR, MichaelList_EBR_cmp_stdAlloc_seqcst,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelMap_EBR_cmp_stdAlloc_seqcst  ;
+
+        typedef cc::MichaelHashMap< cds::gc::EBR, MichaelList_EBR_cmp_michaelAlloc,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   MichaelMap_EBR_cmp_michaelAlloc ;
+
+        typedef cc::MichaelHashMap< cds::gc::EBR, MichaelList_EBR_less_stdAlloc,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelMap_EBR_less_stdAlloc  ;
+
+        typedef cc::MichaelHashMap< cds::gc::EBR, MichaelList_EBR_less_stdAlloc_seqcst,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelMap_EBR_less_stdAlloc_seqcst  ;
+
+        typedef cc::MichaelHashMap< cds::gc::EBR, MichaelList_EBR_less_michaelAlloc,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   MichaelMap_EBR_less_michaelAlloc  ;
+
         //RCU
         typedef cc::MichaelHashMap< rcu_gpi, MichaelList_RCU_GPI_cmp_stdAlloc,
             typename cc::michael_map::make_traits<
@@ -1101,6 +1236,46 @@ namespace map2 {
             >::type
         >   LazyList_PTB_less_michaelAlloc ;
 
+        typedef cc::LazyKVList< cds::gc::EBR, Key, Value,
+            typename cc::lazy_list::make_traits<
+                co::compare< compare >
+            >::type
+        >   LazyList_EBR_cmp_stdAlloc ;
+
+        typedef cc::LazyKVList< cds::gc::EBR, Key, Value,
+            typename cc::lazy_list::make_traits<
+                co::compare< compare >
+                ,co::memory_model< co::v::sequential_consistent >
+            >::type
+        >   LazyList_EBR_cmp_stdAlloc_seqcst ;
+
+        typedef cc::LazyKVList< cds::gc::EBR, Key, Value,
+            typename cc::lazy_list::make_traits<
+                co::compare< compare >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   LazyList_EBR_cmp_michaelAlloc ;
+
+        typedef cc::LazyKVList< cds::gc::EBR, Key, Value,
+            typename cc::lazy_list::make_traits<
+                co::less< less >
+            >::type
+        >   LazyList_EBR_less_stdAlloc ;
+
+        typedef cc::LazyKVList< cds::gc::EBR, Key, Value,
+            typename cc::lazy_list::make_traits<
+                co::less< less >
+                ,co::memory_model< co::v::sequential_consistent >
+            >::type
+        >   LazyList_EBR_less_stdAlloc_seqcst ;
+
+        typedef cc::LazyKVList< cds::gc::EBR, Key, Value,
+            typename cc::lazy_list::make_traits<
+                co::less< less >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   LazyList_EBR_less_michaelAlloc ;
+
         // RCU
         typedef cc::LazyKVList< rcu_gpi, Key, Value,
             typename cc::lazy_list::make_traits<
@@ -1466,6 +1641,44 @@ namespace map2 {
             >::type
         >   MichaelMap_Lazy_PTB_less_michaelAlloc  ;
 
+        typedef cc::MichaelHashMap< cds::gc::EBR, LazyList_EBR_cmp_stdAlloc,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelMap_Lazy_EBR_cmp_stdAlloc  ;
+
+        typedef cc::MichaelHashMap< cds::gc::EBR, LazyList_EBR_cmp_stdAlloc_seqcst,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelMap_Lazy_EBR_cmp_stdAlloc_seqcst  ;
+
+        typedef cc::MichaelHashMap< cds::gc::EBR, LazyList_EBR_cmp_michaelAlloc,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   MichaelMap_Lazy_EBR_cmp_michaelAlloc ;
+
+        typedef cc::MichaelHashMap< cds::gc::EBR, LazyList_EBR_less_stdAlloc,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelMap_Lazy_EBR_less_stdAlloc  ;
+
+        typedef cc::MichaelHashMap< cds::gc::EBR, LazyList_EBR_less_stdAlloc_seqcst,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelMap_Lazy_EBR_less_stdAlloc_seqcst  ;
+
+        typedef cc::MichaelHashMap< cds::gc::EBR, LazyList_EBR_less_michaelAlloc,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   MichaelMap_Lazy_EBR_less_michaelAlloc  ;
+
         // RCU
         typedef cc::MichaelHashMap< rcu_gpi, LazyList_RCU_GPI_cmp_stdAlloc,
             typename cc::michael_map::make_traits<
@@ -1703,6 +1916,47 @@ namespace map2 {
         > >  MichaelMap_Lazy_NOGC_less_michaelAlloc  ;
 
 
+        // ***************************************************************************
+        // MichaelHashMap started from undersized bucket table
+
+        // The bucket table is 256 times smaller than the estimated map size
+        template <typename Map>
+        class UndersizedMapWrapper: public Map
+        {
+            typedef Map base_class ;
+        public:
+            UndersizedMapWrapper( size_t nMapSize, size_t nLoadFactor )
+                : base_class( nMapSize / 256, nLoadFactor )
+            {}
+        };
+
+        // Fixed-size bucket table
+        typedef UndersizedMapWrapper< MichaelMap_HP_cmp_stdAlloc >      MichaelMap_HP_cmp_stdAlloc_undersized  ;
+        typedef UndersizedMapWrapper< MichaelMap_Lazy_HP_cmp_stdAlloc > MichaelMap_Lazy_HP_cmp_stdAlloc_undersized  ;
+
+        // Resizable bucket table
+        typedef UndersizedMapWrapper< cc::MichaelHashMap< cds::gc::HP, MichaelList_HP_cmp_stdAlloc,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >
+                ,cc::michael_map::resizable< true >
+            >::type
+        > >   MichaelMap_HP_cmp_stdAlloc_resizable  ;
+
+        typedef UndersizedMapWrapper< cc::MichaelHashMap< cds::gc::PTB, MichaelList_PTB_cmp_stdAlloc,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >
+                ,cc::michael_map::resizable< true >
+            >::type
+        > >   MichaelMap_PTB_cmp_stdAlloc_resizable  ;
+
+        typedef UndersizedMapWrapper< cc::MichaelHashMap< cds::gc::HP, LazyList_HP_cmp_stdAlloc,
+            typename cc::michael_map::make_traits<
+                co::hash< hash >
+                ,cc::michael_map::resizable< true >
+            >::type
+        > >   MichaelMap_Lazy_HP_cmp_stdAlloc_resizable  ;
+
+
         // ***************************************************************************
         // SplitListMap based on MichaelList
 
@@ -2036,6 +2290,116 @@ namespace map2 {
             >::type
         > SplitList_Michael_PTB_st_less_seqcst ;
 
+        // EBR
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::compare< compare >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_dyn_cmp ;
+
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,co::hash< hash >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::compare< compare >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_dyn_cmp_seqcst ;
+
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::compare< compare >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_st_cmp ;
+
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::compare< compare >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_st_cmp_seqcst ;
+
+        // EBR + less
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::less< less >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_dyn_less ;
+
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,co::hash< hash >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::less< less >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_dyn_less_seqcst ;
+
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::less< less >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_st_less ;
+
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::less< less >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_st_less_seqcst ;
+
         // RCU
         typedef cc::SplitListMap< rcu_gpi, Key, Value,
             typename cc::split_list::make_traits<
@@ -3033,8 +3397,8 @@ namespace map2 {
             >::type
         > SplitList_Lazy_PTB_st_less_seqcst ;
 
-        // RCU
-        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+        // EBR
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
             typename cc::split_list::make_traits<
                 cc::split_list::ordered_list<cc::lazy_list_tag>
                 ,co::hash< hash >
@@ -3044,9 +3408,9 @@ namespace map2 {
                     >::type
                 >
             >::type
-        > SplitList_Lazy_RCU_GPI_dyn_cmp ;
+        > SplitList_Lazy_EBR_dyn_cmp ;
 
-        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
             typename cc::split_list::make_traits<
                 cc::split_list::ordered_list<cc::lazy_list_tag>
                 ,co::hash< hash >
@@ -3058,9 +3422,9 @@ namespace map2 {
                     >::type
                 >
             >::type
-        > SplitList_Lazy_RCU_GPI_dyn_cmp_seqcst ;
+        > SplitList_Lazy_EBR_dyn_cmp_seqcst ;
 
-        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
             typename cc::split_list::make_traits<
                 cc::split_list::ordered_list<cc::lazy_list_tag>
                 ,cc::split_list::dynamic_bucket_table< false >
@@ -3071,9 +3435,9 @@ namespace map2 {
                     >::type
                 >
             >::type
-        > SplitList_Lazy_RCU_GPI_st_cmp ;
+        > SplitList_Lazy_EBR_st_cmp ;
 
-        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
             typename cc::split_list::make_traits<
                 cc::split_list::ordered_list<cc::lazy_list_tag>
                 ,co::hash< hash >
@@ -3086,10 +3450,10 @@ namespace map2 {
                     >::type
                 >
             >::type
-        > SplitList_Lazy_RCU_GPI_st_cmp_seqcst ;
+        > SplitList_Lazy_EBR_st_cmp_seqcst ;
 
-        // RCU_GPI + less
-        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+        // EBR + less
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
             typename cc::split_list::make_traits<
                 cc::split_list::ordered_list<cc::lazy_list_tag>
                 ,co::hash< hash >
@@ -3099,9 +3463,9 @@ namespace map2 {
                     >::type
                 >
             >::type
-        > SplitList_Lazy_RCU_GPI_dyn_less ;
+        > SplitList_Lazy_EBR_dyn_less ;
 
-        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
             typename cc::split_list::make_traits<
                 cc::split_list::ordered_list<cc::lazy_list_tag>
                 ,co::hash< hash >
@@ -3113,9 +3477,9 @@ namespace map2 {
                     >::type
                 >
             >::type
-        > SplitList_Lazy_RCU_GPI_dyn_less_seqcst ;
+        > SplitList_Lazy_EBR_dyn_less_seqcst ;
 
-        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
             typename cc::split_list::make_traits<
                 cc::split_list::ordered_list<cc::lazy_list_tag>
                 ,cc::split_list::dynamic_bucket_table< false >
@@ -3126,7 +3490,117 @@ namespace map2 {
                     >::type
                 >
             >::type
-        > SplitList_Lazy_RCU_GPI_st_less ;
+        > SplitList_Lazy_EBR_st_less ;
+
+        typedef cc::SplitListMap< cds::gc::EBR, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::less< less >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_EBR_st_less_seqcst ;
+
+        // RCU
+        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::compare< compare >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_RCU_GPI_dyn_cmp ;
+
+        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,co::hash< hash >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::compare< compare >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_RCU_GPI_dyn_cmp_seqcst ;
+
+        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::compare< compare >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_RCU_GPI_st_cmp ;
+
+        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::compare< compare >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_RCU_GPI_st_cmp_seqcst ;
+
+        // RCU_GPI + less
+        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::less< less >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_RCU_GPI_dyn_less ;
+
+        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,co::hash< hash >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::less< less >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_RCU_GPI_dyn_less_seqcst ;
+
+        typedef cc::SplitListMap< rcu_gpi, Key, Value,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::less< less >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_RCU_GPI_st_less ;
 
         typedef cc::SplitListMap< rcu_gpi, Key, Value,
             typename cc::split_list::make_traits<
@@ -3752,6 +4226,19 @@ namespace map2 {
             , co::less< less >
         > StripedMap_list   ;
 
+        typedef StripedHashMap_seq<
+            std::list< std::pair< Key const, Value > >
+            , co::hash< hash2 >
+            , co::less< less >
+            , cc::striped_set::incremental_resize< true >
+        > StripedMap_list_incremental   ;
+
+        typedef StripedHashMap_seq<
+            cc::striped_set::flat_bucket< std::pair< Key const, Value > >
+            , co::hash< hash2 >
+            , co::less< less >
+        > StripedMap_flat_bucket   ;
+
 #if CDS_COMPILER == CDS_COMPILER_MSVC && CDS_COMPILER_VERSION < 1600
         typedef StripedHashMap_ord<
             stdext::hash_map< Key, Value, stdext::hash_compare<Key, less > >
@@ -3800,6 +4287,89 @@ namespace map2 {
 //#   endif
 #endif  // BOOST_VERSION >= 104800
 
+        // ***************************************************************************
+        // StripedHashMap with reader-writer lock striping
+
+        // for sequential containers
+        template <class BucketEntry, CDS_DECL_OPTIONS7>
+        class RWStripedHashMap_seq:
+            public cc::StripedMap< BucketEntry,
+                co::mutex_policy< cc::striped_set::rw_striping<> >
+                ,co::resizing_policy<cc::striped_set::load_factor_resizing<0> >
+                , CDS_OPTIONS7
+            >
+        {
+            typedef cc::StripedMap< BucketEntry,
+                co::mutex_policy< cc::striped_set::rw_striping<> >
+                ,co::resizing_policy<cc::striped_set::load_factor_resizing<0> >
+                , CDS_OPTIONS7
+            > base_class   ;
+            typedef typename base_class::resizing_policy resizing_policy_t ;
+
+            resizing_policy_t   m_placeHolder ;
+        public:
+            RWStripedHashMap_seq( size_t nCapacity, size_t nLoadFactor )
+                : base_class( nCapacity / nLoadFactor / 16, *(new(&m_placeHolder) resizing_policy_t( nLoadFactor )) )
+            {}
+        };
+
+        // for non-sequential ordered containers
+        template <class BucketEntry, CDS_DECL_OPTIONS7>
+        class RWStripedHashMap_ord:
+            public cc::StripedMap< BucketEntry,
+                co::resizing_policy<cc::striped_set::load_factor_resizing<0> >
+                ,co::mutex_policy< cc::striped_set::rw_striping<> >
+                , CDS_OPTIONS7
+            >
+        {
+            typedef cc::StripedMap< BucketEntry,
+               co::resizing_policy<cc::striped_set::load_factor_resizing<0> >
+                ,co::mutex_policy< cc::striped_set::rw_striping<> >
+                , CDS_OPTIONS7
+            > base_class   ;
+            typedef typename base_class::resizing_policy resizing_policy_t ;
+
+            resizing_policy_t   m_placeHolder ;
+        public:
+            RWStripedHashMap_ord( size_t nCapacity, size_t nLoadFactor )
+                : base_class( 0, *(new(&m_placeHolder) resizing_policy_t( nLoadFactor * 1024 )) )
+            {}
+        };
+
+        typedef RWStripedHashMap_seq<
+            std::list< std::pair< Key const, Value > >
+            , co::hash< hash2 >
+            , co::less< less >
+        > RWStripedMap_list   ;
+
+        typedef RWStripedHashMap_seq<
+            cc::striped_set::flat_bucket< std::pair< Key const, Value > >
+            , co::hash< hash2 >
+            , co::less< less >
+        > RWStripedMap_flat_bucket   ;
+
+#if CDS_COMPILER == CDS_COMPILER_MSVC && CDS_COMPILER_VERSION < 1600
+        typedef RWStripedHashMap_ord<
+            stdext::hash_map< Key, Value, stdext::hash_compare<Key, less > >
+            , co::hash< hash2 >
+        > RWStripedMap_hashmap    ;
+#else
+        typedef RWStripedHashMap_ord<
+            std::unordered_map< Key, Value, hash, equal_to >
+            , co::hash< hash2 >
+        > RWStripedMap_hashmap    ;
+#endif
+
+        typedef RWStripedHashMap_ord<
+            std::map< Key, Value, less >
+            , co::hash< hash2 >
+        > RWStripedMap_map   ;
+
+        typedef RWStripedHashMap_ord<
+            boost::unordered_map< Key, Value, hash, equal_to >
+            , co::hash< hash2 >
+        > RWStripedMap_boost_unordered_map    ;
+
         // ***************************************************************************
         // RefinableHashMap
 
@@ -3856,6 +4426,19 @@ namespace map2 {
             , co::less< less >
         > RefinableMap_list   ;
 
+        typedef RefinableHashMap_seq<
+            std::list< std::pair< Key const, Value > >
+            , co::hash< hash2 >
+            , co::less< less >
+            , cc::striped_set::incremental_resize< true >
+        > RefinableMap_list_incremental   ;
+
+        typedef RefinableHashMap_seq<
+            cc::striped_set::flat_bucket< std::pair< Key const, Value > >
+            , co::hash< hash2 >
+            , co::less< less >
+        > RefinableMap_flat_bucket   ;
+
 #if BOOST_VERSION >= 104800
         typedef RefinableHashMap_seq<
             boost::container::slist< std::pair< Key const, Value > >
@@ -4149,6 +4732,26 @@ namespace map2 {
             >::type
         > SkipListMap_hp_cmp_xorshift_stat ;
 
+        // Memory per key: one-block node allocation with and without per-height node pool
+        typedef cc::SkipListMap< cds::gc::HP, Key, Value,
+            typename cc::skip_list::make_traits <
+                co::less< less >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,co::allocator< memory::CountingAllocator<int> >
+            >::type
+        > SkipListMap_hp_less_pascal_mem ;
+
+        typedef cc::SkipListMap< cds::gc::HP, Key, Value,
+            typename cc::skip_list::make_traits <
+                co::less< less >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,co::allocator< memory::CountingAllocator<int> >
+                ,cc::skip_list::node_pool< cc::skip_list::per_height_pool<> >
+            >::type
+        > SkipListMap_hp_less_pascal_pool ;
+
         // ***************************************************************************
         // SkipListMap - HRC
 
@@ -4309,6 +4912,86 @@ namespace map2 {
             >::type
         > SkipListMap_ptb_cmp_xorshift_stat ;
 
+        // ***************************************************************************
+        // SkipListMap - EBR
+
+        typedef cc::SkipListMap< cds::gc::EBR, Key, Value,
+            typename cc::skip_list::make_traits <
+                co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > SkipListMap_ebr_less_pascal ;
+
+        typedef cc::SkipListMap< cds::gc::EBR, Key, Value,
+            typename cc::skip_list::make_traits <
+                co::less< less >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > SkipListMap_ebr_less_pascal_seqcst ;
+
+        typedef cc::SkipListMap< cds::gc::EBR, Key, Value,
+            typename cc::skip_list::make_traits <
+                co::less< less >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+                ,co::stat< cc::skip_list::stat >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > SkipListMap_ebr_less_pascal_stat ;
+
+        typedef cc::SkipListMap< cds::gc::EBR, Key, Value,
+            typename cc::skip_list::make_traits <
+                co::compare< compare >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > SkipListMap_ebr_cmp_pascal ;
+
+        typedef cc::SkipListMap< cds::gc::EBR, Key, Value,
+            typename cc::skip_list::make_traits <
+                co::compare< compare >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::skip_list::stat >
+            >::type
+        > SkipListMap_ebr_cmp_pascal_stat ;
+
+        typedef cc::SkipListMap< cds::gc::EBR, Key, Value,
+            typename cc::skip_list::make_traits <
+                co::less< less >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > SkipListMap_ebr_less_xorshift ;
+
+        typedef cc::SkipListMap< cds::gc::EBR, Key, Value,
+            typename cc::skip_list::make_traits <
+                co::less< less >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+                ,co::stat< cc::skip_list::stat >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > SkipListMap_ebr_less_xorshift_stat ;
+
+        typedef cc::SkipListMap< cds::gc::EBR, Key, Value,
+            typename cc::skip_list::make_traits <
+                co::compare< compare >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > SkipListMap_ebr_cmp_xorshift ;
+
+        typedef cc::SkipListMap< cds::gc::EBR, Key, Value,
+            typename cc::skip_list::make_traits <
+                co::compare< compare >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+                ,co::stat< cc::skip_list::stat >
+            >::type
+        > SkipListMap_ebr_cmp_xorshift_stat ;
+
         // ***************************************************************************
         // SkipListMap< gc::nogc >
 
@@ -4791,6 +5474,186 @@ namespace map2 {
         > SkipListMap_rcu_sht_cmp_xorshift_stat ;
 #endif
 
+        // ***************************************************************************
+        // MultiLevelHashMap
+
+        typedef cc::MultiLevelHashMap< cds::gc::HP, Key, Value >    MultiLevelHashMap_hp ;
+        typedef cc::MultiLevelHashMap< cds::gc::HP, Key, Value,
+            typename cc::multilevel_hashmap::make_traits <
+                co::stat< cc::multilevel_hashmap::stat >
+            >::type
+        > MultiLevelHashMap_hp_stat ;
+
+        typedef cc::MultiLevelHashMap< cds::gc::PTB, Key, Value >   MultiLevelHashMap_ptb ;
+        typedef cc::MultiLevelHashMap< cds::gc::PTB, Key, Value,
+            typename cc::multilevel_hashmap::make_traits <
+                co::stat< cc::multilevel_hashmap::stat >
+            >::type
+        > MultiLevelHashMap_ptb_stat ;
+
+        typedef cc::MultiLevelHashMap< cds::gc::EBR, Key, Value >   MultiLevelHashMap_ebr ;
+        typedef cc::MultiLevelHashMap< cds::gc::EBR, Key, Value,
+            typename cc::multilevel_hashmap::make_traits <
+                co::stat< cc::multilevel_hashmap::stat >
+            >::type
+        > MultiLevelHashMap_ebr_stat ;
+
+        typedef cc::MultiLevelHashMap< rcu_gpi, Key, Value >    MultiLevelHashMap_rcu_gpi ;
+        typedef cc::MultiLevelHashMap< rcu_gpi, Key, Value,
+            typename cc::multilevel_hashmap::make_traits <
+                co::stat< cc::multilevel_hashmap::stat >
+            >::type
+        > MultiLevelHashMap_rcu_gpi_stat ;
+
+        typedef cc::MultiLevelHashMap< rcu_gpb, Key, Value >    MultiLevelHashMap_rcu_gpb ;
+        typedef cc::MultiLevelHashMap< rcu_gpb, Key, Value,
+            typename cc::multilevel_hashmap::make_traits <
+                co::stat< cc::multilevel_hashmap::stat >
+            >::type
+        > MultiLevelHashMap_rcu_gpb_stat ;
+
+        typedef cc::MultiLevelHashMap< rcu_gpt, Key, Value >    MultiLevelHashMap_rcu_gpt ;
+        typedef cc::MultiLevelHashMap< rcu_gpt, Key, Value,
+            typename cc::multilevel_hashmap::make_traits <
+                co::stat< cc::multilevel_hashmap::stat >
+            >::type
+        > MultiLevelHashMap_rcu_gpt_stat ;
+
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cc::MultiLevelHashMap< rcu_shb, Key, Value >    MultiLevelHashMap_rcu_shb ;
+        typedef cc::MultiLevelHashMap< rcu_shb, Key, Value,
+            typename cc::multilevel_hashmap::make_traits <
+                co::stat< cc::multilevel_hashmap::stat >
+            >::type
+        > MultiLevelHashMap_rcu_shb_stat ;
+
+        typedef cc::MultiLevelHashMap< rcu_sht, Key, Value >    MultiLevelHashMap_rcu_sht ;
+        typedef cc::MultiLevelHashMap< rcu_sht, Key, Value,
+            typename cc::multilevel_hashmap::make_traits <
+                co::stat< cc::multilevel_hashmap::stat >
+            >::type
+        > MultiLevelHashMap_rcu_sht_stat ;
+#endif
+
+        // ***************************************************************************
+        // LinearProbingMap
+
+        typedef LinearProbingMapWrapper< cds::gc::HP, Key, Value >  LinearProbingMap_hp ;
+        typedef LinearProbingMapWrapper< cds::gc::HP, Key, Value,
+            co::stat< cc::linear_probing_map::stat >
+        > LinearProbingMap_hp_stat ;
+
+        typedef LinearProbingMapWrapper< cds::gc::PTB, Key, Value > LinearProbingMap_ptb ;
+        typedef LinearProbingMapWrapper< cds::gc::PTB, Key, Value,
+            co::stat< cc::linear_probing_map::stat >
+        > LinearProbingMap_ptb_stat ;
+
+        // ***************************************************************************
+        // EllenBinTreeMap
+
+        typedef cc::EllenBinTreeMap< cds::gc::HP, Key, Value >   EllenBinTreeMap_hp ;
+        typedef cc::EllenBinTreeMap< cds::gc::HP, Key, Value,
+            typename cc::ellen_bintree::make_traits <
+                co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::ellen_bintree::stat >
+            >::type
+        > EllenBinTreeMap_hp_stat ;
+
+        typedef cc::EllenBinTreeMap< cds::gc::PTB, Key, Value >   EllenBinTreeMap_ptb ;
+        typedef cc::EllenBinTreeMap< cds::gc::PTB, Key, Value,
+            typename cc::ellen_bintree::make_traits <
+                co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::ellen_bintree::stat >
+            >::type
+        > EllenBinTreeMap_ptb_stat ;
+
+        typedef cc::EllenBinTreeMap< rcu_gpi, Key, Value >    EllenBinTreeMap_rcu_gpi ;
+        typedef cc::EllenBinTreeMap< rcu_gpi, Key, Value,
+            typename cc::ellen_bintree::make_traits <
+                co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::ellen_bintree::stat >
+            >::type
+        > EllenBinTreeMap_rcu_gpi_stat ;
+
+        typedef cc::EllenBinTreeMap< rcu_gpb, Key, Value >    EllenBinTreeMap_rcu_gpb ;
+        typedef cc::EllenBinTreeMap< rcu_gpb, Key, Value,
+            typename cc::ellen_bintree::make_traits <
+                co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::ellen_bintree::stat >
+            >::type
+        > EllenBinTreeMap_rcu_gpb_stat ;
+
+        typedef cc::EllenBinTreeMap< rcu_gpt, Key, Value >    EllenBinTreeMap_rcu_gpt ;
+        typedef cc::EllenBinTreeMap< rcu_gpt, Key, Value,
+            typename cc::ellen_bintree::make_traits <
+                co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::ellen_bintree::stat >
+            >::type
+        > EllenBinTreeMap_rcu_gpt_stat ;
+
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cc::EllenBinTreeMap< rcu_shb, Key, Value >    EllenBinTreeMap_rcu_shb ;
+        typedef cc::EllenBinTreeMap< rcu_shb, Key, Value,
+            typename cc::ellen_bintree::make_traits <
+                co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::ellen_bintree::stat >
+            >::type
+        > EllenBinTreeMap_rcu_shb_stat ;
+
+        typedef cc::EllenBinTreeMap< rcu_sht, Key, Value >    EllenBinTreeMap_rcu_sht ;
+        typedef cc::EllenBinTreeMap< rcu_sht, Key, Value,
+            typename cc::ellen_bintree::make_traits <
+                co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::ellen_bintree::stat >
+            >::type
+        > EllenBinTreeMap_rcu_sht_stat ;
+#endif
+
+        // ***************************************************************************
+        // BronsonAVLTreeMap
+
+        typedef cc::BronsonAVLTreeMap< rcu_gpi, Key, Value >    BronsonAVLTreeMap_rcu_gpi ;
+        typedef cc::BronsonAVLTreeMap< rcu_gpi, Key, Value,
+            typename cc::bronson_avltree::make_traits <
+                co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::bronson_avltree::stat >
+            >::type
+        > BronsonAVLTreeMap_rcu_gpi_stat ;
+
+        typedef cc::BronsonAVLTreeMap< rcu_gpb, Key, Value >    BronsonAVLTreeMap_rcu_gpb ;
+        typedef cc::BronsonAVLTreeMap< rcu_gpb, Key, Value,
+            typename cc::bronson_avltree::make_traits <
+                co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::bronson_avltree::stat >
+            >::type
+        > BronsonAVLTreeMap_rcu_gpb_stat ;
+
+        typedef cc::BronsonAVLTreeMap< rcu_gpt, Key, Value >    BronsonAVLTreeMap_rcu_gpt ;
+        typedef cc::BronsonAVLTreeMap< rcu_gpt, Key, Value,
+            typename cc::bronson_avltree::make_traits <
+                co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::bronson_avltree::stat >
+            >::type
+        > BronsonAVLTreeMap_rcu_gpt_stat ;
+
+#ifdef CDS_URCU_SIGNAL_HANDLING_ENABLED
+        typedef cc::BronsonAVLTreeMap< rcu_shb, Key, Value >    BronsonAVLTreeMap_rcu_shb ;
+        typedef cc::BronsonAVLTreeMap< rcu_shb, Key, Value,
+            typename cc::bronson_avltree::make_traits <
+                co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::bronson_avltree::stat >
+            >::type
+        > BronsonAVLTreeMap_rcu_shb_stat ;
+
+        typedef cc::BronsonAVLTreeMap< rcu_sht, Key, Value >    BronsonAVLTreeMap_rcu_sht ;
+        typedef cc::BronsonAVLTreeMap< rcu_sht, Key, Value,
+            typename cc::bronson_avltree::make_traits <
+                co::item_counter< cds::atomicity::item_counter >
+                ,co::stat< cc::bronson_avltree::stat >
+            >::type
+        > BronsonAVLTreeMap_rcu_sht_stat ;
+#endif
+
         // ***************************************************************************
         // Standard implementations
 
@@ -4812,8 +5675,38 @@ namespace map2 {
         CPPUNIT_MSG( m.statistics() << m.mutex_policy_statistics() ) ;
     }
 
+    template <typename Allocator>
+    static inline void print_memory_stat( size_t /*nSize*/ )
+    {}
+
+    template <>
+    inline void print_memory_stat< memory::CountingAllocator<int> >( size_t nSize )
+    {
+        size_t nAllocated = memory::CountingAllocator<int>::allocated() ;
+        CPPUNIT_MSG( "   Memory allocated=" << nAllocated << " bytes, per key=" << (nSize ? double(nAllocated) / nSize : 0.0) ) ;
+    }
+
     template <typename GC, typename K, typename T, typename Traits >
     static inline void print_stat( cc::SkipListMap< GC, K, T, Traits > const& m )
+    {
+        CPPUNIT_MSG( m.statistics() ) ;
+        print_memory_stat< typename Traits::allocator >( m.size() ) ;
+    }
+
+    template <typename GC, typename K, typename T, typename Traits >
+    static inline void print_stat( cc::MultiLevelHashMap< GC, K, T, Traits > const& m )
+    {
+        CPPUNIT_MSG( m.statistics() ) ;
+    }
+
+    template <typename GC, typename K, typename T, typename Traits >
+    static inline void print_stat( cc::EllenBinTreeMap< GC, K, T, Traits > const& m )
+    {
+        CPPUNIT_MSG( m.statistics() ) ;
+    }
+
+    template <typename GC, typename K, typename T, typename Traits >
+    static inline void print_stat( cc::BronsonAVLTreeMap< GC, K, T, Traits > const& m )
     {
         CPPUNIT_MSG( m.statistics() ) ;
     }
@@ -4832,6 +5725,12 @@ namespace map2 {
         print_stat( static_cast<typename map_type::cuckoo_base_class const&>(m) )   ;
     }
 
+    template <class GC, typename K, typename V, CDS_SPEC_OPTIONS6>
+    static inline void print_stat( LinearProbingMapWrapper< GC, K, V, CDS_OPTIONS6 > const& m )
+    {
+        CPPUNIT_MSG( m.statistics() ) ;
+    }
+
 }   // namespace map2
 
 #endif // ifndef _CDSUNIT_MAP2_MAP_TYPES_H
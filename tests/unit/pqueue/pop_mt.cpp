@@ -0,0 +1,235 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "cppunit/thread.h"
+#include "pqueue/pqueue_type.h"
+
+// Multi-threaded priority queue test for pop operation
+namespace pqueue {
+
+#define TEST_CASE( Q, V )    void Q() { test< Types<V>::Q >(); }
+#define TEST_BOUNDED( Q, V ) void Q() { test_bounded< Types<V>::Q >(); }
+
+    namespace ns_PQueue_Pop {
+        static size_t s_nThreadCount = 8  ;
+        static size_t s_nQueueSize = 2000000 ;
+
+        struct SimpleValue {
+            size_t    nNo ;
+
+            SimpleValue(): nNo(0) {}
+            SimpleValue( size_t n ): nNo(n) {}
+            size_t getNo() const { return  nNo; }
+        };
+    }
+    using namespace ns_PQueue_Pop ;
+
+    class PQueue_Pop: public CppUnitMini::TestCase
+    {
+        template <class PQUEUE>
+        class Thread: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new Thread( *this )  ;
+            }
+        public:
+            PQUEUE&             m_Queue ;
+            double              m_fTime ;
+            long *              m_arr   ;
+            size_t              m_nPopCount ;
+            size_t              m_nOrderViolation ;
+
+        public:
+            Thread( CppUnitMini::ThreadPool& pool, PQUEUE& q )
+                : CppUnitMini::TestThread( pool )
+                , m_Queue( q )
+            {
+                m_arr = new long[s_nQueueSize]  ;
+            }
+            Thread( Thread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Queue( src.m_Queue )
+            {
+                m_arr = new long[s_nQueueSize]  ;
+            }
+            ~Thread()
+            {
+                delete [] m_arr ;
+            }
+
+            PQueue_Pop&  getTest()
+            {
+                return reinterpret_cast<PQueue_Pop&>( m_Pool.m_Test )   ;
+            }
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread()     ;
+                memset(m_arr, 0, sizeof(m_arr[0]) * s_nQueueSize ) ;
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread()   ;
+            }
+
+            virtual void test()
+            {
+                m_fTime = m_Timer.duration()        ;
+
+                // No push during the test, so the items popped by a thread
+                // must be increasing if the queue is strict
+                typedef typename PQUEUE::value_type value_type ;
+                value_type value = value_type() ;
+                size_t nPopCount = 0    ;
+                size_t nOrderViolation = 0 ;
+                size_t nPrev = 0        ;
+                while ( m_Queue.pop( value ) ) {
+                    if ( nPopCount && value.getNo() <= nPrev )
+                        ++nOrderViolation ;
+                    nPrev = value.getNo()   ;
+                    ++m_arr[ value.getNo() ]        ;
+                    ++nPopCount        ;
+                }
+                m_nPopCount = nPopCount    ;
+                m_nOrderViolation = nOrderViolation ;
+
+                m_fTime = m_Timer.duration() - m_fTime  ;
+            }
+        };
+
+    protected:
+
+        template <class PQUEUE>
+        void analyze( CppUnitMini::ThreadPool& pool, PQUEUE& testQueue  )
+        {
+            size_t * arr = new size_t[ s_nQueueSize ]           ;
+            memset(arr, 0, sizeof(arr[0]) * s_nQueueSize )      ;
+
+            double fTime = 0    ;
+            size_t nTotalPops = 0   ;
+            size_t nOrderViolation = 0 ;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Thread<PQUEUE> * pThread = reinterpret_cast<Thread<PQUEUE> *>(*it)  ;
+                for ( size_t i = 0; i < s_nQueueSize; ++i )
+                    arr[i] += pThread->m_arr[i]     ;
+                nTotalPops += pThread->m_nPopCount  ;
+                nOrderViolation += pThread->m_nOrderViolation ;
+                fTime += pThread->m_fTime   ;
+            }
+            CPPUNIT_MSG( "     Duration=" << (fTime / s_nThreadCount) )   ;
+            CPPUNIT_ASSERT( nTotalPops == s_nQueueSize )    ;
+            CPPUNIT_ASSERT( testQueue.empty() )
+            if ( is_strict<PQUEUE>::value ) {
+                CPPUNIT_CHECK_EX( nOrderViolation == 0, "Priority order violations: " << nOrderViolation ) ;
+            }
+            else
+                CPPUNIT_MSG( "     Out-of-order pops=" << nOrderViolation ) ;
+
+            size_t nError = 0   ;
+            for ( size_t i = 0; i < s_nQueueSize; ++i ) {
+                if ( arr[i] != 1 ) {
+                    CPPUNIT_MSG( "   ERROR: Item " << i << " has not been popped" ) ;
+                    CPPUNIT_ASSERT( ++nError <= 10 ) ;
+                }
+            }
+
+            delete [] arr ;
+        }
+
+        template <class PQUEUE>
+        void test()
+        {
+            PQUEUE testQueue ;
+            do_test( testQueue ) ;
+        }
+
+        template <class PQUEUE>
+        void test_bounded()
+        {
+            PQUEUE testQueue( s_nQueueSize ) ;
+            do_test( testQueue ) ;
+        }
+
+        template <class PQUEUE>
+        void do_test( PQUEUE& testQueue )
+        {
+            CppUnitMini::ThreadPool pool( *this )   ;
+            pool.add( new Thread<PQUEUE>( pool, testQueue ), s_nThreadCount )       ;
+
+            CPPUNIT_MSG( "   Create queue size =" << s_nQueueSize << " ...")   ;
+            cds::OS::Timer      timer   ;
+            for ( size_t i = 0; i < s_nQueueSize; ++i )
+                testQueue.push( i )    ;
+            CPPUNIT_MSG( "     Duration=" << timer.duration() )   ;
+
+            CPPUNIT_MSG( "   Pop test, thread count=" << s_nThreadCount << " ...")   ;
+            pool.run()  ;
+
+            analyze( pool, testQueue )     ;
+
+            CPPUNIT_MSG( testQueue.statistics() )   ;
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nThreadCount = cfg.getULong("ThreadCount", 8 ) ;
+            s_nQueueSize = cfg.getULong("QueueSize", 2000000 );
+        }
+
+    protected:
+        TEST_CASE( SkipListPQ_HP, SimpleValue )
+        TEST_CASE( SkipListPQ_HP_relaxed, SimpleValue )
+        TEST_CASE( SkipListPQ_HP_stat, SimpleValue )
+        TEST_CASE( SkipListPQ_HP_relaxed_stat, SimpleValue )
+        TEST_CASE( SkipListPQ_PTB, SimpleValue )
+        TEST_CASE( SkipListPQ_PTB_relaxed, SimpleValue )
+        TEST_CASE( SkipListPQ_PTB_stat, SimpleValue )
+        TEST_CASE( SkipListPQ_PTB_relaxed_stat, SimpleValue )
+        TEST_CASE( SkipListPQ_RCU_GPI, SimpleValue )
+        TEST_CASE( SkipListPQ_RCU_GPI_relaxed, SimpleValue )
+        TEST_CASE( SkipListPQ_RCU_GPB, SimpleValue )
+        TEST_CASE( SkipListPQ_RCU_GPB_relaxed, SimpleValue )
+        TEST_CASE( SkipListPQ_RCU_GPT, SimpleValue )
+        TEST_CASE( SkipListPQ_RCU_GPT_relaxed, SimpleValue )
+
+        TEST_BOUNDED( MSPriorityQueue_dyn, SimpleValue )
+        TEST_BOUNDED( MSPriorityQueue_dyn_stat, SimpleValue )
+
+        TEST_CASE( StdPQueue_Spinlock, SimpleValue )
+        TEST_CASE( StdPQueue_BoostMutex, SimpleValue )
+
+        CPPUNIT_TEST_SUITE(PQueue_Pop)
+            CPPUNIT_TEST(SkipListPQ_HP)                 ;
+            CPPUNIT_TEST(SkipListPQ_HP_relaxed)         ;
+            CPPUNIT_TEST(SkipListPQ_HP_stat)            ;
+            CPPUNIT_TEST(SkipListPQ_HP_relaxed_stat)    ;
+            CPPUNIT_TEST(SkipListPQ_PTB)                ;
+            CPPUNIT_TEST(SkipListPQ_PTB_relaxed)        ;
+            CPPUNIT_TEST(SkipListPQ_PTB_stat)           ;
+            CPPUNIT_TEST(SkipListPQ_PTB_relaxed_stat)   ;
+            CPPUNIT_TEST(SkipListPQ_RCU_GPI)            ;
+            CPPUNIT_TEST(SkipListPQ_RCU_GPI_relaxed)    ;
+            CPPUNIT_TEST(SkipListPQ_RCU_GPB)            ;
+            CPPUNIT_TEST(SkipListPQ_RCU_GPB_relaxed)    ;
+            CPPUNIT_TEST(SkipListPQ_RCU_GPT)            ;
+            CPPUNIT_TEST(SkipListPQ_RCU_GPT_relaxed)    ;
+
+            CPPUNIT_TEST(MSPriorityQueue_dyn)           ;
+            CPPUNIT_TEST(MSPriorityQueue_dyn_stat)      ;
+
+            CPPUNIT_TEST(StdPQueue_Spinlock)            ;
+            CPPUNIT_TEST(StdPQueue_BoostMutex)          ;
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace pqueue
+
+CPPUNIT_TEST_SUITE_REGISTRATION(pqueue::PQueue_Pop);
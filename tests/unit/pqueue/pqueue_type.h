@@ -0,0 +1,178 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __UNIT_PQUEUE_TYPES_H
+#define __UNIT_PQUEUE_TYPES_H
+
+#include <cds/gc/hp.h>
+#include <cds/gc/ptb.h>
+#include <cds/urcu/general_instant.h>
+#include <cds/urcu/general_buffered.h>
+#include <cds/urcu/general_threaded.h>
+
+#include <cds/container/skip_list_set_hp.h>
+#include <cds/container/skip_list_set_ptb.h>
+#include <cds/container/skip_list_set_rcu.h>
+#include <cds/container/skip_list_priority_queue.h>
+#include <cds/container/mspriority_queue.h>
+
+#include "pqueue/std_pqueue.h"
+#include "print_skip_list_stat.h"
+#include <boost/thread/mutex.hpp>
+
+namespace pqueue {
+    namespace cc = cds::container ;
+
+    // is_strict<PQueue>::value is true if pop() always returns the minimal item.
+    // MSPriorityQueue is not strict: the item moved from the bottom to the root by concurrent pop()
+    // is invisible for other threads for a while
+    template <class PQueue>
+    struct is_strict
+    {
+        static bool const value = false ;
+    };
+
+    template <typename GC, typename T, typename Traits>
+    struct is_strict< cc::SkipListPriorityQueue< GC, T, Traits > >
+    {
+        static bool const value = std::is_same< typename Traits::pop_mode, cc::skip_list_priority_queue::strict >::value ;
+    };
+
+    template <typename T, class LESS, class LOCK>
+    struct is_strict< StdPQueue< T, LESS, LOCK > >
+    {
+        static bool const value = true ;
+    };
+
+    template <typename VALUE>
+    struct Types {
+        struct less {
+            bool operator()( VALUE const& v1, VALUE const& v2 ) const
+            {
+                return v1.getNo() < v2.getNo() ;
+            }
+        };
+
+        // MSPriorityQueue is max-priority queue, so the comparator is reversed
+        struct greater {
+            bool operator()( VALUE const& v1, VALUE const& v2 ) const
+            {
+                return v1.getNo() > v2.getNo() ;
+            }
+        };
+
+        typedef cds::urcu::gc< cds::urcu::general_instant<> >   rcu_gpi ;
+        typedef cds::urcu::gc< cds::urcu::general_buffered<> >  rcu_gpb ;
+        typedef cds::urcu::gc< cds::urcu::general_threaded<> >  rcu_gpt ;
+
+        typedef cc::skip_list_priority_queue::relaxed<>    relaxed ;
+
+        struct traits_SkipListPQ: public
+            cc::skip_list_priority_queue::make_traits<
+                cds::opt::less< less >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+            >::type
+        {};
+
+        struct traits_SkipListPQ_relaxed: public
+            cc::skip_list_priority_queue::make_traits<
+                cds::opt::less< less >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cc::skip_list_priority_queue::pop_mode< relaxed >
+            >::type
+        {};
+
+        struct traits_SkipListPQ_stat: public
+            cc::skip_list_priority_queue::make_traits<
+                cds::opt::less< less >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cds::opt::stat< cc::skip_list::stat >
+            >::type
+        {};
+
+        struct traits_SkipListPQ_relaxed_stat: public
+            cc::skip_list_priority_queue::make_traits<
+                cds::opt::less< less >
+                ,cds::opt::item_counter< cds::atomicity::item_counter >
+                ,cc::skip_list_priority_queue::pop_mode< relaxed >
+                ,cds::opt::stat< cc::skip_list::stat >
+            >::type
+        {};
+
+        // SkipListPriorityQueue
+        typedef cc::SkipListPriorityQueue< cds::gc::HP, VALUE, traits_SkipListPQ >                 SkipListPQ_HP ;
+        typedef cc::SkipListPriorityQueue< cds::gc::HP, VALUE, traits_SkipListPQ_relaxed >         SkipListPQ_HP_relaxed ;
+        typedef cc::SkipListPriorityQueue< cds::gc::HP, VALUE, traits_SkipListPQ_stat >            SkipListPQ_HP_stat ;
+        typedef cc::SkipListPriorityQueue< cds::gc::HP, VALUE, traits_SkipListPQ_relaxed_stat >    SkipListPQ_HP_relaxed_stat ;
+
+        typedef cc::SkipListPriorityQueue< cds::gc::PTB, VALUE, traits_SkipListPQ >                SkipListPQ_PTB ;
+        typedef cc::SkipListPriorityQueue< cds::gc::PTB, VALUE, traits_SkipListPQ_relaxed >        SkipListPQ_PTB_relaxed ;
+        typedef cc::SkipListPriorityQueue< cds::gc::PTB, VALUE, traits_SkipListPQ_stat >           SkipListPQ_PTB_stat ;
+        typedef cc::SkipListPriorityQueue< cds::gc::PTB, VALUE, traits_SkipListPQ_relaxed_stat >   SkipListPQ_PTB_relaxed_stat ;
+
+        typedef cc::SkipListPriorityQueue< rcu_gpi, VALUE, traits_SkipListPQ >                     SkipListPQ_RCU_GPI ;
+        typedef cc::SkipListPriorityQueue< rcu_gpi, VALUE, traits_SkipListPQ_relaxed >             SkipListPQ_RCU_GPI_relaxed ;
+        typedef cc::SkipListPriorityQueue< rcu_gpb, VALUE, traits_SkipListPQ >                     SkipListPQ_RCU_GPB ;
+        typedef cc::SkipListPriorityQueue< rcu_gpb, VALUE, traits_SkipListPQ_relaxed >             SkipListPQ_RCU_GPB_relaxed ;
+        typedef cc::SkipListPriorityQueue< rcu_gpt, VALUE, traits_SkipListPQ >                     SkipListPQ_RCU_GPT ;
+        typedef cc::SkipListPriorityQueue< rcu_gpt, VALUE, traits_SkipListPQ_relaxed >             SkipListPQ_RCU_GPT_relaxed ;
+
+        // MSPriorityQueue
+        struct traits_MSPriorityQueue_dyn: public
+            cc::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< char > >
+                ,cds::opt::less< greater >
+            >::type
+        {};
+
+        struct traits_MSPriorityQueue_dyn_stat: public
+            cc::mspriority_queue::make_traits<
+                cds::opt::buffer< cds::opt::v::dynamic_buffer< char > >
+                ,cds::opt::less< greater >
+                ,cds::opt::stat< cc::mspriority_queue::stat<> >
+            >::type
+        {};
+
+        typedef cc::MSPriorityQueue< VALUE, traits_MSPriorityQueue_dyn >       MSPriorityQueue_dyn ;
+        typedef cc::MSPriorityQueue< VALUE, traits_MSPriorityQueue_dyn_stat >  MSPriorityQueue_dyn_stat ;
+
+        // Lock-based std::priority_queue
+        typedef StdPQueue< VALUE, less >                    StdPQueue_Spinlock      ;
+        typedef StdPQueue< VALUE, less, boost::mutex >      StdPQueue_BoostMutex    ;
+    };
+}
+
+namespace std {
+    static inline std::ostream& operator <<( std::ostream& o, cds::opt::none )
+    {
+        return o ;
+    }
+
+    static inline std::ostream& operator <<( std::ostream& o, cds::container::mspriority_queue::empty_stat const& )
+    {
+        return o ;
+    }
+
+    template <typename Counter>
+    static inline std::ostream& operator <<( std::ostream& o, cds::container::mspriority_queue::stat<Counter> const& s )
+    {
+        return o << "\tStatistics:\n"
+            << "\t\t                 Push: " << s.m_nPushCount.get() << "\n"
+            << "\t\t                  Pop: " << s.m_nPopCount.get() << "\n"
+            << "\t\t   Push failed (full): " << s.m_nPushFailCount.get() << "\n"
+            << "\t\t   Pop failed (empty): " << s.m_nPopFailCount.get() << "\n"
+            << "\t\tPush heapify swapping: " << s.m_nPushHeapifySwapCount.get() << "\n"
+            << "\t\t Pop heapify swapping: " << s.m_nPopHeapifySwapCount.get() << "\n"
+            ;
+    }
+}
+
+#endif // #ifndef __UNIT_PQUEUE_TYPES_H
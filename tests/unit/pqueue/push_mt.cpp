@@ -0,0 +1,218 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "cppunit/thread.h"
+#include "pqueue/pqueue_type.h"
+
+// Multi-threaded priority queue test for push operation
+namespace pqueue {
+
+#define TEST_CASE( Q, V ) void Q() { test< Types<V>::Q >(); }
+#define TEST_BOUNDED( Q, V ) void Q() { test_bounded< Types<V>::Q >(); }
+
+    namespace ns_PQueue_Push {
+        static size_t s_nThreadCount = 8  ;
+        static size_t s_nQueueSize = 2000000 ;
+
+        struct SimpleValue {
+            size_t      nNo ;
+
+            SimpleValue(): nNo(0) {}
+            SimpleValue( size_t n ): nNo(n) {}
+            size_t getNo() const { return  nNo; }
+        };
+    }
+    using namespace ns_PQueue_Push ;
+
+    class PQueue_Push: public CppUnitMini::TestCase
+    {
+        template <class PQUEUE>
+        class Thread: public CppUnitMini::TestThread
+        {
+            virtual TestThread *    clone()
+            {
+                return new Thread( *this )  ;
+            }
+        public:
+            PQUEUE&             m_Queue         ;
+            double              m_fTime         ;
+            size_t              m_nStartItem    ;
+            size_t              m_nEndItem      ;
+            size_t              m_nPushError    ;
+
+        public:
+            Thread( CppUnitMini::ThreadPool& pool, PQUEUE& q )
+                : CppUnitMini::TestThread( pool )
+                , m_Queue( q )
+            {}
+            Thread( Thread& src )
+                : CppUnitMini::TestThread( src )
+                , m_Queue( src.m_Queue )
+            {}
+
+            PQueue_Push&  getTest()
+            {
+                return reinterpret_cast<PQueue_Push&>( m_Pool.m_Test )   ;
+            }
+
+            virtual void init()
+            {
+                cds::threading::Manager::attachThread()     ;
+            }
+            virtual void fini()
+            {
+                cds::threading::Manager::detachThread()   ;
+            }
+
+            virtual void test()
+            {
+                m_fTime = m_Timer.duration()    ;
+
+                // Interleave the keys of the threads: thread i pushes i, i + nThreadCount, ...
+                m_nPushError = 0    ;
+                for ( size_t nItem = m_nStartItem; nItem < m_nEndItem; nItem += s_nThreadCount ) {
+                    if ( !m_Queue.push( nItem ))
+                        ++m_nPushError ;
+                }
+
+                m_fTime = m_Timer.duration() - m_fTime  ;
+            }
+        };
+
+    protected:
+        template <class PQUEUE>
+        void analyze( CppUnitMini::ThreadPool& pool, PQUEUE& testQueue, size_t nTotalItems )
+        {
+            double fTime = 0    ;
+            size_t nPushError = 0   ;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Thread<PQUEUE> * pThread = reinterpret_cast<Thread<PQUEUE> *>(*it)  ;
+                fTime += pThread->m_fTime   ;
+                nPushError += pThread->m_nPushError ;
+            }
+            CPPUNIT_MSG( "     Duration=" << (fTime / s_nThreadCount) )   ;
+            CPPUNIT_CHECK_EX( nPushError == 0, "push error count=" << nPushError ) ;
+            CPPUNIT_ASSERT( !testQueue.empty() )
+
+            size_t * arr = new size_t[ nTotalItems ]           ;
+            memset(arr, 0, sizeof(arr[0]) * nTotalItems )      ;
+
+            cds::OS::Timer      timer   ;
+            CPPUNIT_MSG( "   Pop (single-threaded)..." )    ;
+            size_t nPopped = 0      ;
+            size_t nOrderViolation = 0 ;
+            size_t nPrev = 0        ;
+            SimpleValue val = SimpleValue() ;
+            while ( testQueue.pop( val )) {
+                if ( nPopped && val.getNo() <= nPrev )
+                    ++nOrderViolation ;
+                nPrev = val.getNo() ;
+                nPopped++   ;
+                ++arr[ val.getNo() ]    ;
+            }
+            CPPUNIT_MSG( "     Duration=" << timer.duration() )     ;
+            CPPUNIT_ASSERT( testQueue.empty() ) ;
+            if ( is_strict<PQUEUE>::value ) {
+                CPPUNIT_CHECK_EX( nOrderViolation == 0, "Priority order violations: " << nOrderViolation ) ;
+            }
+
+            size_t nError = 0   ;
+            for ( size_t i = 0; i < nTotalItems; ++i ) {
+                if ( arr[i] != 1 ) {
+                    CPPUNIT_MSG( "   ERROR: Item " << i << " has not been pushed" ) ;
+                    CPPUNIT_ASSERT( ++nError <= 10 ) ;
+                }
+            }
+
+            delete [] arr ;
+        }
+
+        template <class PQUEUE>
+        void test()
+        {
+            PQUEUE testQueue ;
+            do_test( testQueue ) ;
+        }
+
+        template <class PQUEUE>
+        void test_bounded()
+        {
+            PQUEUE testQueue( s_nQueueSize ) ;
+            do_test( testQueue ) ;
+        }
+
+        template <class PQUEUE>
+        void do_test( PQUEUE& testQueue )
+        {
+            CppUnitMini::ThreadPool pool( *this )   ;
+            pool.add( new Thread<PQUEUE>( pool, testQueue ), s_nThreadCount )       ;
+
+            size_t nThreadItemCount = s_nQueueSize / s_nThreadCount ;
+            size_t nTotalItems = nThreadItemCount * s_nThreadCount  ;
+            size_t nStart = 0   ;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                Thread<PQUEUE> * pThread = reinterpret_cast<Thread<PQUEUE> *>(*it)  ;
+                pThread->m_nStartItem = nStart++    ;
+                pThread->m_nEndItem = nTotalItems   ;
+            }
+
+            CPPUNIT_MSG( "   Push test, thread count=" << s_nThreadCount << ", queue size=" << nTotalItems << " ...")   ;
+            pool.run()  ;
+
+            analyze( pool, testQueue, nTotalItems ) ;
+
+            CPPUNIT_MSG( testQueue.statistics() )   ;
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            s_nThreadCount = cfg.getULong("ThreadCount", 8 ) ;
+            s_nQueueSize = cfg.getULong("QueueSize", 2000000 );
+        }
+
+    protected:
+        TEST_CASE( SkipListPQ_HP, SimpleValue )
+        TEST_CASE( SkipListPQ_HP_relaxed, SimpleValue )
+        TEST_CASE( SkipListPQ_HP_stat, SimpleValue )
+        TEST_CASE( SkipListPQ_PTB, SimpleValue )
+        TEST_CASE( SkipListPQ_PTB_relaxed, SimpleValue )
+        TEST_CASE( SkipListPQ_PTB_stat, SimpleValue )
+        TEST_CASE( SkipListPQ_RCU_GPI, SimpleValue )
+        TEST_CASE( SkipListPQ_RCU_GPB, SimpleValue )
+        TEST_CASE( SkipListPQ_RCU_GPT, SimpleValue )
+
+        TEST_BOUNDED( MSPriorityQueue_dyn, SimpleValue )
+        TEST_BOUNDED( MSPriorityQueue_dyn_stat, SimpleValue )
+
+        TEST_CASE( StdPQueue_Spinlock, SimpleValue )
+        TEST_CASE( StdPQueue_BoostMutex, SimpleValue )
+
+        CPPUNIT_TEST_SUITE(PQueue_Push)
+            CPPUNIT_TEST(SkipListPQ_HP)             ;
+            CPPUNIT_TEST(SkipListPQ_HP_relaxed)     ;
+            CPPUNIT_TEST(SkipListPQ_HP_stat)        ;
+            CPPUNIT_TEST(SkipListPQ_PTB)            ;
+            CPPUNIT_TEST(SkipListPQ_PTB_relaxed)    ;
+            CPPUNIT_TEST(SkipListPQ_PTB_stat)       ;
+            CPPUNIT_TEST(SkipListPQ_RCU_GPI)        ;
+            CPPUNIT_TEST(SkipListPQ_RCU_GPB)        ;
+            CPPUNIT_TEST(SkipListPQ_RCU_GPT)        ;
+
+            CPPUNIT_TEST(MSPriorityQueue_dyn)           ;
+            CPPUNIT_TEST(MSPriorityQueue_dyn_stat)      ;
+
+            CPPUNIT_TEST(StdPQueue_Spinlock)        ;
+            CPPUNIT_TEST(StdPQueue_BoostMutex)      ;
+        CPPUNIT_TEST_SUITE_END();
+    };
+
+} // namespace pqueue
+
+CPPUNIT_TEST_SUITE_REGISTRATION(pqueue::PQueue_Push);
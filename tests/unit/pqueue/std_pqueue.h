@@ -0,0 +1,76 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __UNIT_PQUEUE_STD_PQUEUE_H
+#define __UNIT_PQUEUE_STD_PQUEUE_H
+
+#include <queue>
+#include <vector>
+#include <functional>   // std::greater
+#include <cds/lock/spinlock.h>
+
+namespace pqueue {
+
+    // Lock-based min-priority queue
+    template <typename T, class LESS, class LOCK = cds::lock::Spin >
+    class StdPQueue
+    {
+        struct greater {
+            bool operator()( T const& v1, T const& v2 ) const
+            {
+                return LESS()( v2, v1 ) ;
+            }
+        };
+
+        typedef std::priority_queue< T, std::vector<T>, greater >   pqueue_type ;
+        pqueue_type m_PQueue    ;
+        mutable LOCK m_Locker   ;
+
+    public:
+        typedef T   value_type  ;
+
+        bool push( value_type const& val )
+        {
+            cds::lock::scoped_lock<LOCK> a(m_Locker) ;
+            m_PQueue.push( val ) ;
+            return true ;
+        }
+
+        bool pop( value_type& dest )
+        {
+            cds::lock::scoped_lock<LOCK> a(m_Locker) ;
+            if ( m_PQueue.empty() )
+                return false ;
+            dest = m_PQueue.top() ;
+            m_PQueue.pop() ;
+            return true ;
+        }
+
+        bool empty() const
+        {
+            cds::lock::scoped_lock<LOCK> a(m_Locker) ;
+            return m_PQueue.empty() ;
+        }
+
+        size_t size() const
+        {
+            cds::lock::scoped_lock<LOCK> a(m_Locker) ;
+            return m_PQueue.size() ;
+        }
+
+        cds::opt::none statistics() const
+        {
+            return cds::opt::none() ;
+        }
+    };
+}
+
+#endif // #ifndef __UNIT_PQUEUE_STD_PQUEUE_H
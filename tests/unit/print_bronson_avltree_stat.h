@@ -0,0 +1,54 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __UNIT_PRINT_BRONSON_AVLTREE_STAT_H
+#define __UNIT_PRINT_BRONSON_AVLTREE_STAT_H
+
+#include <cds/container/bronson_avltree_base.h>
+#include <ostream>
+
+namespace std {
+
+    static inline ostream& operator <<( ostream& o, cds::container::bronson_avltree::stat const& s )
+    {
+        return o
+            << "BronsonAVLTree stat [cds::container::bronson_avltree::stat]\n"
+            << "\t\t         m_nFindSuccess: " << s.m_nFindSuccess.get()            << "\n"
+            << "\t\t          m_nFindFailed: " << s.m_nFindFailed.get()             << "\n"
+            << "\t\t           m_nFindRetry: " << s.m_nFindRetry.get()              << "\n"
+            << "\t\t   m_nFindWaitShrinking: " << s.m_nFindWaitShrinking.get()      << "\n"
+            << "\t\t       m_nInsertSuccess: " << s.m_nInsertSuccess.get()          << "\n"
+            << "\t\t        m_nInsertFailed: " << s.m_nInsertFailed.get()           << "\n"
+            << "\t\t    m_nReuseRoutingNode: " << s.m_nReuseRoutingNode.get()       << "\n"
+            << "\t\t         m_nEnsureExist: " << s.m_nEnsureExist.get()            << "\n"
+            << "\t\t           m_nEnsureNew: " << s.m_nEnsureNew.get()              << "\n"
+            << "\t\t         m_nUpdateRetry: " << s.m_nUpdateRetry.get()            << "\n"
+            << "\t\t m_nUpdateWaitShrinking: " << s.m_nUpdateWaitShrinking.get()    << "\n"
+            << "\t\t        m_nEraseSuccess: " << s.m_nEraseSuccess.get()           << "\n"
+            << "\t\t         m_nEraseFailed: " << s.m_nEraseFailed.get()            << "\n"
+            << "\t\t          m_nEraseRetry: " << s.m_nEraseRetry.get()             << "\n"
+            << "\t\t     m_nMakeRoutingNode: " << s.m_nMakeRoutingNode.get()        << "\n"
+            << "\t\t          m_nUnlinkNode: " << s.m_nUnlinkNode.get()             << "\n"
+            << "\t\t         m_nRotateRight: " << s.m_nRotateRight.get()            << "\n"
+            << "\t\t          m_nRotateLeft: " << s.m_nRotateLeft.get()             << "\n"
+            << "\t\t m_nRotateRightOverLeft: " << s.m_nRotateRightOverLeft.get()    << "\n"
+            << "\t\t m_nRotateLeftOverRight: " << s.m_nRotateLeftOverRight.get()    << "\n"
+            ;
+    }
+
+    static inline ostream& operator <<( ostream& o, cds::container::bronson_avltree::empty_stat const& s )
+    {
+        return o ;
+    }
+
+} // namespace std
+
+#endif // #ifndef __UNIT_PRINT_BRONSON_AVLTREE_STAT_H
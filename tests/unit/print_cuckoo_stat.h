@@ -67,6 +67,10 @@ namespace std {
             << "\t\t            m_nFalseResizeCount: " << s.m_nFalseResizeCount.get()               << "\n"
             << "\t\t       m_nResizeSuccessNodeMove: " << s.m_nResizeSuccessNodeMove.get()          << "\n"
             << "\t\t          m_nResizeRelocateCall: " << s.m_nResizeRelocateCall.get()             << "\n"
+            << "\t\t              m_nResizeDuration: " << s.m_nResizeDuration.get()                << "\n"
+            << "\t\t           m_nResizeHelperCount: " << s.m_nResizeHelperCount.get()             << "\n"
+            << "\t\t      m_nResizeHelpedChunkCount: " << s.m_nResizeHelpedChunkCount.get()        << "\n"
+            << "\t\t          m_nResizeDeferredMove: " << s.m_nResizeDeferredMove.get()            << "\n"
             << "\t\t               m_nInsertSuccess: " << s.m_nInsertSuccess.get()                  << "\n"
             << "\t\t                m_nInsertFailed: " << s.m_nInsertFailed.get()                   << "\n"
             << "\t\t           m_nInsertResizeCount: " << s.m_nInsertResizeCount.get()              << "\n"
@@ -85,6 +89,8 @@ namespace std {
             << "\t\t                  m_nFindFailed: " << s.m_nFindFailed.get()                     << "\n"
             << "\t\t             m_nFindWithSuccess: " << s.m_nFindWithSuccess.get()                << "\n"
             << "\t\t              m_nFindWithFailed: " << s.m_nFindWithFailed.get()                 << "\n"
+            << "\t\t         m_nFindOptimisticRetry: " << s.m_nFindOptimisticRetry.get()          << "\n"
+            << "\t\t      m_nFindOptimisticFallback: " << s.m_nFindOptimisticFallback.get()       << "\n"
             ;
     }
 
@@ -0,0 +1,54 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __UNIT_PRINT_ELLEN_BINTREE_STAT_H
+#define __UNIT_PRINT_ELLEN_BINTREE_STAT_H
+
+#include <cds/intrusive/ellen_bintree_base.h>
+#include <ostream>
+
+namespace std {
+
+    static inline ostream& operator <<( ostream& o, cds::intrusive::ellen_bintree::stat const& s )
+    {
+        return o
+            << "EllenBinTree stat [cds::intrusive::ellen_bintree::stat]\n"
+            << "\t\t m_nInternalNodeCreated: " << s.m_nInternalNodeCreated.get()    << "\n"
+            << "\t\t m_nInternalNodeDeleted: " << s.m_nInternalNodeDeleted.get()    << "\n"
+            << "\t\t   m_nUpdateDescCreated: " << s.m_nUpdateDescCreated.get()      << "\n"
+            << "\t\t   m_nUpdateDescDeleted: " << s.m_nUpdateDescDeleted.get()      << "\n"
+            << "\t\t         m_nFindSuccess: " << s.m_nFindSuccess.get()            << "\n"
+            << "\t\t          m_nFindFailed: " << s.m_nFindFailed.get()             << "\n"
+            << "\t\t       m_nInsertSuccess: " << s.m_nInsertSuccess.get()          << "\n"
+            << "\t\t        m_nInsertFailed: " << s.m_nInsertFailed.get()           << "\n"
+            << "\t\t       m_nInsertRetries: " << s.m_nInsertRetries.get()          << "\n"
+            << "\t\t         m_nEnsureExist: " << s.m_nEnsureExist.get()            << "\n"
+            << "\t\t           m_nEnsureNew: " << s.m_nEnsureNew.get()              << "\n"
+            << "\t\t       m_nEnsureRetries: " << s.m_nEnsureRetries.get()          << "\n"
+            << "\t\t        m_nEraseSuccess: " << s.m_nEraseSuccess.get()           << "\n"
+            << "\t\t         m_nEraseFailed: " << s.m_nEraseFailed.get()            << "\n"
+            << "\t\t        m_nEraseRetries: " << s.m_nEraseRetries.get()           << "\n"
+            << "\t\t       m_nSearchRetries: " << s.m_nSearchRetries.get()          << "\n"
+            << "\t\t          m_nHelpInsert: " << s.m_nHelpInsert.get()             << "\n"
+            << "\t\t          m_nHelpDelete: " << s.m_nHelpDelete.get()             << "\n"
+            << "\t\t            m_nHelpMark: " << s.m_nHelpMark.get()               << "\n"
+            << "\t\t       m_nHelpBacktrack: " << s.m_nHelpBacktrack.get()          << "\n"
+            ;
+    }
+
+    static inline ostream& operator <<( ostream& o, cds::intrusive::ellen_bintree::empty_stat const& s )
+    {
+        return o ;
+    }
+
+} // namespace std
+
+#endif // #ifndef __UNIT_PRINT_ELLEN_BINTREE_STAT_H
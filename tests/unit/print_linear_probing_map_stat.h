@@ -0,0 +1,49 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#ifndef __UNIT_PRINT_LINEAR_PROBING_MAP_STAT_H
+#define __UNIT_PRINT_LINEAR_PROBING_MAP_STAT_H
+
+#include <cds/container/linear_probing_map_base.h>
+#include <ostream>
+
+namespace std {
+
+    static inline ostream& operator <<( ostream& o, cds::container::linear_probing_map::stat const& s )
+    {
+        return o
+            << "LinearProbingMap stat [cds::container::linear_probing_map::stat]\n"
+            << "\t\t       m_nInsertSuccess: " << s.m_nInsertSuccess.get()      << "\n"
+            << "\t\t        m_nInsertFailed: " << s.m_nInsertFailed.get()       << "\n"
+            << "\t\t           m_nEnsureNew: " << s.m_nEnsureNew.get()          << "\n"
+            << "\t\t      m_nEnsureExisting: " << s.m_nEnsureExisting.get()     << "\n"
+            << "\t\t        m_nEraseSuccess: " << s.m_nEraseSuccess.get()       << "\n"
+            << "\t\t         m_nEraseFailed: " << s.m_nEraseFailed.get()        << "\n"
+            << "\t\t         m_nFindSuccess: " << s.m_nFindSuccess.get()        << "\n"
+            << "\t\t          m_nFindFailed: " << s.m_nFindFailed.get()         << "\n"
+            << "\t\t          m_nCellReused: " << s.m_nCellReused.get()         << "\n"
+            << "\t\t            m_nRedirect: " << s.m_nRedirect.get()           << "\n"
+            << "\t\t      m_nMigrationStart: " << s.m_nMigrationStart.get()     << "\n"
+            << "\t\t  m_nMigrationCollision: " << s.m_nMigrationCollision.get() << "\n"
+            << "\t\t           m_nTableGrow: " << s.m_nTableGrow.get()          << "\n"
+            << "\t\t          m_nTablePurge: " << s.m_nTablePurge.get()         << "\n"
+            << "\t\t       m_nChunkMigrated: " << s.m_nChunkMigrated.get()      << "\n"
+            ;
+    }
+
+    static inline ostream& operator <<( ostream& o, cds::container::linear_probing_map::empty_stat const& s )
+    {
+        return o ;
+    }
+
+} // namespace std
+
+#endif // #ifndef __UNIT_PRINT_LINEAR_PROBING_MAP_STAT_H
@@ -41,6 +41,14 @@ namespace std {
             << "\t\t    m_nFindFastFailed: " << s.m_nFindFastFailed.get()   << "\n"
             << "\t\t   m_nFindSlowSuccess: " << s.m_nFindSlowSuccess.get()  << "\n"
             << "\t\t    m_nFindSlowFailed: " << s.m_nFindSlowFailed.get()   << "\n"
+            << "\t\t    m_nCursorFastStep: " << s.m_nCursorFastStep.get()   << "\n"
+            << "\t\t    m_nCursorSlowStep: " << s.m_nCursorSlowStep.get()   << "\n"
+            << "\t\t m_nExtractMinSuccess: " << s.m_nExtractMinSuccess.get() << "\n"
+            << "\t\t  m_nExtractMinFailed: " << s.m_nExtractMinFailed.get()  << "\n"
+            << "\t\t m_nExtractMinRetries: " << s.m_nExtractMinRetries.get() << "\n"
+            << "\t\t m_nExtractMaxSuccess: " << s.m_nExtractMaxSuccess.get() << "\n"
+            << "\t\t  m_nExtractMaxFailed: " << s.m_nExtractMaxFailed.get()  << "\n"
+            << "\t\t m_nExtractMaxRetries: " << s.m_nExtractMaxRetries.get() << "\n"
             ;
     }
 
@@ -52,6 +52,8 @@
     TEST_SET(MichaelSet_HRC_less_michaelAlloc) \
     TEST_SET(MichaelSet_PTB_cmp_stdAlloc) \
     TEST_SET(MichaelSet_PTB_less_michaelAlloc) \
+    TEST_SET(MichaelSet_EBR_cmp_stdAlloc) \
+    TEST_SET(MichaelSet_EBR_less_michaelAlloc) \
     TEST_SET(MichaelSet_RCU_GPI_cmp_stdAlloc) \
     TEST_SET(MichaelSet_RCU_GPI_less_michaelAlloc) \
     TEST_SET(MichaelSet_RCU_GPB_cmp_stdAlloc) \
@@ -64,6 +66,8 @@
     TEST_SET(MichaelSet_Lazy_HRC_less_michaelAlloc) \
     TEST_SET(MichaelSet_Lazy_PTB_cmp_stdAlloc) \
     TEST_SET(MichaelSet_Lazy_PTB_less_michaelAlloc) \
+    TEST_SET(MichaelSet_Lazy_EBR_cmp_stdAlloc) \
+    TEST_SET(MichaelSet_Lazy_EBR_less_michaelAlloc) \
     TEST_SET(MichaelSet_Lazy_RCU_GPI_cmp_stdAlloc) \
     TEST_SET(MichaelSet_Lazy_RCU_GPI_less_michaelAlloc) \
     TEST_SET(MichaelSet_Lazy_RCU_GPB_cmp_stdAlloc) \
@@ -79,6 +83,8 @@
     CPPUNIT_TEST(MichaelSet_HRC_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_PTB_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelSet_PTB_less_michaelAlloc) \
+    CPPUNIT_TEST(MichaelSet_EBR_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelSet_EBR_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_RCU_GPI_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelSet_RCU_GPI_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_RCU_GPB_cmp_stdAlloc) \
@@ -91,6 +97,8 @@
     CPPUNIT_TEST(MichaelSet_Lazy_HRC_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_Lazy_PTB_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelSet_Lazy_PTB_less_michaelAlloc) \
+    CPPUNIT_TEST(MichaelSet_Lazy_EBR_cmp_stdAlloc) \
+    CPPUNIT_TEST(MichaelSet_Lazy_EBR_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_Lazy_RCU_GPI_cmp_stdAlloc) \
     CPPUNIT_TEST(MichaelSet_Lazy_RCU_GPI_less_michaelAlloc) \
     CPPUNIT_TEST(MichaelSet_Lazy_RCU_GPB_cmp_stdAlloc) \
@@ -155,6 +163,10 @@
     TEST_SET(SplitList_Michael_PTB_st_cmp)\
     TEST_SET(SplitList_Michael_PTB_dyn_less)\
     TEST_SET(SplitList_Michael_PTB_st_less)\
+    TEST_SET(SplitList_Michael_EBR_dyn_cmp)\
+    TEST_SET(SplitList_Michael_EBR_st_cmp)\
+    TEST_SET(SplitList_Michael_EBR_dyn_less)\
+    TEST_SET(SplitList_Michael_EBR_st_less)\
     TEST_SET(SplitList_Michael_RCU_GPI_dyn_cmp)\
     TEST_SET(SplitList_Michael_RCU_GPI_st_cmp)\
     TEST_SET(SplitList_Michael_RCU_GPI_dyn_less)\
@@ -179,6 +191,10 @@
     TEST_SET(SplitList_Lazy_PTB_st_cmp)\
     TEST_SET(SplitList_Lazy_PTB_dyn_less)\
     TEST_SET(SplitList_Lazy_PTB_st_less)\
+    TEST_SET(SplitList_Lazy_EBR_dyn_cmp)\
+    TEST_SET(SplitList_Lazy_EBR_st_cmp)\
+    TEST_SET(SplitList_Lazy_EBR_dyn_less)\
+    TEST_SET(SplitList_Lazy_EBR_st_less)\
     TEST_SET(SplitList_Lazy_RCU_GPI_dyn_cmp)\
     TEST_SET(SplitList_Lazy_RCU_GPI_st_cmp)\
     TEST_SET(SplitList_Lazy_RCU_GPI_dyn_less)\
@@ -206,6 +222,10 @@
     CPPUNIT_TEST(SplitList_Michael_PTB_st_cmp)\
     CPPUNIT_TEST(SplitList_Michael_PTB_dyn_less)\
     CPPUNIT_TEST(SplitList_Michael_PTB_st_less)\
+    CPPUNIT_TEST(SplitList_Michael_EBR_dyn_cmp)\
+    CPPUNIT_TEST(SplitList_Michael_EBR_st_cmp)\
+    CPPUNIT_TEST(SplitList_Michael_EBR_dyn_less)\
+    CPPUNIT_TEST(SplitList_Michael_EBR_st_less)\
     CPPUNIT_TEST(SplitList_Michael_RCU_GPI_dyn_cmp)\
     CPPUNIT_TEST(SplitList_Michael_RCU_GPI_st_cmp)\
     CPPUNIT_TEST(SplitList_Michael_RCU_GPI_dyn_less)\
@@ -230,6 +250,10 @@
     CPPUNIT_TEST(SplitList_Lazy_PTB_st_cmp)\
     CPPUNIT_TEST(SplitList_Lazy_PTB_dyn_less)\
     CPPUNIT_TEST(SplitList_Lazy_PTB_st_less)\
+    CPPUNIT_TEST(SplitList_Lazy_EBR_dyn_cmp)\
+    CPPUNIT_TEST(SplitList_Lazy_EBR_st_cmp)\
+    CPPUNIT_TEST(SplitList_Lazy_EBR_dyn_less)\
+    CPPUNIT_TEST(SplitList_Lazy_EBR_st_less)\
     CPPUNIT_TEST(SplitList_Lazy_RCU_GPI_dyn_cmp)\
     CPPUNIT_TEST(SplitList_Lazy_RCU_GPI_st_cmp)\
     CPPUNIT_TEST(SplitList_Lazy_RCU_GPI_dyn_less)\
@@ -269,7 +293,12 @@
     TEST_SET(CuckooRefinableSet_list_unord_storehash)\
     TEST_SET(CuckooRefinableSet_list_ord_storehash)\
     TEST_SET(CuckooRefinableSet_vector_unord_storehash)\
-    TEST_SET(CuckooRefinableSet_vector_ord_storehash)
+    TEST_SET(CuckooRefinableSet_vector_ord_storehash)\
+    TEST_SET(CuckooStripedSet_vector_unord_fingerprint)\
+    TEST_SET(CuckooStripedSet_vector_unord_storehash_fingerprint)\
+    TEST_SET(CuckooStripedSet_vector_ord_fingerprint16)\
+    TEST_SET(CuckooRefinableSet_vector_unord_fingerprint)\
+    TEST_SET(CuckooRefinableSet_vector_unord_storehash_fingerprint)
 
 
 #define CDSUNIT_TEST_CuckooSet \
@@ -296,7 +325,21 @@
     CPPUNIT_TEST(CuckooRefinableSet_vector_unord_storehash)\
     CPPUNIT_TEST(CuckooRefinableSet_vector_ord) \
     CPPUNIT_TEST(CuckooRefinableSet_vector_ord_stat) \
-    CPPUNIT_TEST(CuckooRefinableSet_vector_ord_storehash)
+    CPPUNIT_TEST(CuckooRefinableSet_vector_ord_storehash)\
+    CPPUNIT_TEST(CuckooStripedSet_vector_unord_fingerprint)\
+    CPPUNIT_TEST(CuckooStripedSet_vector_unord_storehash_fingerprint)\
+    CPPUNIT_TEST(CuckooStripedSet_vector_ord_fingerprint16)\
+    CPPUNIT_TEST(CuckooRefinableSet_vector_unord_fingerprint)\
+    CPPUNIT_TEST(CuckooRefinableSet_vector_unord_storehash_fingerprint)
+
+// Optimistic find is for vector probe set and integral keys only: the container frees erased items at once
+#define CDSUNIT_DECLARE_CuckooSet_optimistic \
+    TEST_SET(CuckooStripedSet_vector_ord_optimistic_stat)\
+    TEST_SET(CuckooRefinableSet_vector_ord_optimistic_stat)
+
+#define CDSUNIT_TEST_CuckooSet_optimistic \
+    CPPUNIT_TEST(CuckooStripedSet_vector_ord_optimistic_stat)\
+    CPPUNIT_TEST(CuckooRefinableSet_vector_ord_optimistic_stat)
 
 
 
@@ -339,6 +382,10 @@
     TEST_SET_NOLF(SkipListSet_ptb_cmp_pascal_stat)\
     TEST_SET_NOLF(SkipListSet_ptb_less_xorshift)\
     TEST_SET_NOLF(SkipListSet_ptb_cmp_xorshift_stat)\
+    TEST_SET_NOLF(SkipListSet_ebr_less_pascal)\
+    TEST_SET_NOLF(SkipListSet_ebr_cmp_pascal_stat)\
+    TEST_SET_NOLF(SkipListSet_ebr_less_xorshift)\
+    TEST_SET_NOLF(SkipListSet_ebr_cmp_xorshift_stat)\
     TEST_SET_NOLF(SkipListSet_rcu_gpi_less_pascal)\
     TEST_SET_NOLF(SkipListSet_rcu_gpi_cmp_pascal_stat)\
     TEST_SET_NOLF(SkipListSet_rcu_gpi_less_xorshift)\
@@ -366,6 +413,10 @@
     CPPUNIT_TEST(SkipListSet_ptb_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListSet_ptb_less_xorshift)\
     CPPUNIT_TEST(SkipListSet_ptb_cmp_xorshift_stat)\
+    CPPUNIT_TEST(SkipListSet_ebr_less_pascal)\
+    CPPUNIT_TEST(SkipListSet_ebr_cmp_pascal_stat)\
+    CPPUNIT_TEST(SkipListSet_ebr_less_xorshift)\
+    CPPUNIT_TEST(SkipListSet_ebr_cmp_xorshift_stat)\
     CPPUNIT_TEST(SkipListSet_rcu_gpi_less_pascal)\
     CPPUNIT_TEST(SkipListSet_rcu_gpi_cmp_pascal_stat)\
     CPPUNIT_TEST(SkipListSet_rcu_gpi_less_xorshift)\
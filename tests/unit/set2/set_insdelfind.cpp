@@ -253,6 +253,7 @@ namespace set2 {
         CDSUNIT_DECLARE_StripedSet
         CDSUNIT_DECLARE_RefinableSet
         CDSUNIT_DECLARE_CuckooSet
+        CDSUNIT_DECLARE_CuckooSet_optimistic
         CDSUNIT_DECLARE_SkipListSet
         CDSUNIT_DECLARE_StdSet
 
@@ -263,6 +264,7 @@ namespace set2 {
             CDSUNIT_TEST_StripedSet
             CDSUNIT_TEST_RefinableSet
             CDSUNIT_TEST_CuckooSet
+            CDSUNIT_TEST_CuckooSet_optimistic
             CDSUNIT_TEST_StdSet
         CPPUNIT_TEST_SUITE_END()
     };
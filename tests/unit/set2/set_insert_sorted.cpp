@@ -0,0 +1,219 @@
+/*
+    This file is a part of libcds - Concurrent Data Structures library
+    See http://libcds.sourceforge.net/
+
+    (C) Copyright Maxim Khiszinsky (libcds.sf.com) 2006-2013
+    Distributed under the BSD license (see accompanying file license.txt)
+
+    Version 1.4.0
+*/
+
+
+#include "set2/set_types.h"
+#include "cppunit/thread.h"
+
+#include <vector>
+#include <algorithm>    // random_shuffle
+
+namespace set2 {
+
+#    define TEST_SET(X)     void X() { test<SetTypes<key_type, value_type>::X >( c_nSetSize )   ; }
+#    define TEST_LIST(X)    void X() { test<SetTypes<key_type, value_type>::X >( c_nListSize )  ; }
+
+    namespace {
+        static size_t  c_nSetSize = 1000000     ;  // skip-list set size
+        static size_t  c_nListSize = 10000      ;  // ordered list size
+        static size_t  c_nThreadCount = 4       ;  // count of insertion thread
+        static size_t  c_nShuffleWidth = 8      ;  // width of shuffled window for nearly sorted stream
+        static bool    c_bPrintGCState = true   ;
+    }
+
+    // Inserts the sorted and nearly sorted streams of keys
+    // by plain insert and by insert with hint (finger search)
+    class Set_InsertSorted: public CppUnitMini::TestCase
+    {
+        typedef size_t  key_type    ;
+        typedef size_t  value_type  ;
+
+        // m_arrKeys[i] is the stream of the keys for thread i
+        std::vector< std::vector<key_type> >    m_arrKeys ;
+
+        template <class Set>
+        class Inserter: public CppUnitMini::TestThread
+        {
+            Set&     m_Set      ;
+            bool     m_bHint    ;
+
+            virtual Inserter *    clone()
+            {
+                return new Inserter( *this )    ;
+            }
+        public:
+            size_t  m_nInsertSuccess    ;
+            size_t  m_nInsertFailed     ;
+
+        public:
+            Inserter( CppUnitMini::ThreadPool& pool, Set& rSet, bool bHint )
+                : CppUnitMini::TestThread( pool )
+                , m_Set( rSet )
+                , m_bHint( bHint )
+            {}
+            Inserter( Inserter& src )
+                : CppUnitMini::TestThread( src )
+                , m_Set( src.m_Set )
+                , m_bHint( src.m_bHint )
+            {}
+
+            Set_InsertSorted&  getTest()
+            {
+                return reinterpret_cast<Set_InsertSorted&>( m_Pool.m_Test )   ;
+            }
+
+            virtual void init() { cds::threading::Manager::attachThread()   ; }
+            virtual void fini() { cds::threading::Manager::detachThread()   ; }
+
+            virtual void test()
+            {
+                Set& rSet = m_Set   ;
+
+                m_nInsertSuccess =
+                    m_nInsertFailed = 0 ;
+
+                std::vector<key_type> const& arrKeys = getTest().m_arrKeys[ m_nThreadNo ] ;
+                typedef typename std::vector<key_type>::const_iterator key_iterator ;
+
+                if ( m_bHint ) {
+                    typename Set::insert_hint hint ;
+                    for ( key_iterator it = arrKeys.begin(); it != arrKeys.end(); ++it ) {
+                        if ( rSet.insert( hint, *it ))
+                            ++m_nInsertSuccess  ;
+                        else
+                            ++m_nInsertFailed   ;
+                    }
+                }
+                else {
+                    for ( key_iterator it = arrKeys.begin(); it != arrKeys.end(); ++it ) {
+                        if ( rSet.insert( *it ))
+                            ++m_nInsertSuccess  ;
+                        else
+                            ++m_nInsertFailed   ;
+                    }
+                }
+            }
+        };
+
+    protected:
+        // Thread i gets the keys i, i + nThreadCount, i + 2 * nThreadCount, ...
+        // so the threads insert into the same region of the set.
+        // For nearly sorted stream each window of c_nShuffleWidth keys is shuffled
+        void make_keys( size_t nSize, bool bNearlySorted )
+        {
+            size_t const nThreadCount = c_nThreadCount ;
+            m_arrKeys.clear() ;
+            m_arrKeys.resize( nThreadCount ) ;
+            for ( size_t nThread = 0; nThread < nThreadCount; ++nThread ) {
+                std::vector<key_type>& arr = m_arrKeys[ nThread ] ;
+                arr.reserve( nSize / nThreadCount + 1 ) ;
+                for ( size_t nKey = nThread; nKey < nSize; nKey += nThreadCount )
+                    arr.push_back( nKey ) ;
+
+                if ( bNearlySorted && c_nShuffleWidth > 1 ) {
+                    for ( size_t i = 0; i < arr.size(); i += c_nShuffleWidth )
+                        std::random_shuffle( arr.begin() + i, arr.begin() + std::min( i + c_nShuffleWidth, arr.size() )) ;
+                }
+            }
+        }
+
+        template <class Set>
+        void do_test( bool bHint )
+        {
+            typedef Inserter<Set>       InserterThread  ;
+
+            CPPUNIT_MSG( "  " << (bHint ? "Insert with hint" : "Plain insert") << "..." ) ;
+
+            Set  testSet ;
+
+            CppUnitMini::ThreadPool pool( *this )   ;
+            pool.add( new InserterThread( pool, testSet, bHint ), c_nThreadCount ) ;
+            pool.run()  ;
+            CPPUNIT_MSG( "   Duration=" << pool.avgDuration() ) ;
+
+            size_t nInsertSuccess = 0   ;
+            size_t nInsertFailed = 0    ;
+            for ( CppUnitMini::ThreadPool::iterator it = pool.begin(); it != pool.end(); ++it ) {
+                InserterThread * pThread = static_cast<InserterThread *>( *it )   ;
+                nInsertSuccess += pThread->m_nInsertSuccess ;
+                nInsertFailed += pThread->m_nInsertFailed   ;
+            }
+
+            CPPUNIT_MSG( "    Totals: Ins succ=" << nInsertSuccess << " Ins fail=" << nInsertFailed ) ;
+            CPPUNIT_CHECK( nInsertFailed == 0 ) ;
+
+            size_t nKeyCount = 0 ;
+            for ( size_t i = 0; i < m_arrKeys.size(); ++i )
+                nKeyCount += m_arrKeys[i].size() ;
+            CPPUNIT_CHECK( nInsertSuccess == nKeyCount ) ;
+
+            // The set must contain all keys
+            size_t nNotFound = 0 ;
+            for ( size_t i = 0; i < m_arrKeys.size(); ++i ) {
+                for ( size_t k = 0; k < m_arrKeys[i].size(); ++k ) {
+                    if ( !testSet.find( m_arrKeys[i][k] ))
+                        ++nNotFound ;
+                }
+            }
+            CPPUNIT_CHECK_EX( nNotFound == 0, "Not found " << nNotFound << " keys" ) ;
+
+            testSet.clear() ;
+            CPPUNIT_CHECK( testSet.empty() ) ;
+        }
+
+        template <class Set>
+        void test( size_t nSize )
+        {
+            CPPUNIT_MSG( "Thread count=" << c_nThreadCount
+                << " set size=" << nSize
+                << " shuffle width=" << c_nShuffleWidth
+                );
+
+            for ( int nStream = 0; nStream < 2; ++nStream ) {
+                bool bNearlySorted = nStream != 0 ;
+                CPPUNIT_MSG( (bNearlySorted ? "Nearly sorted stream" : "Sorted stream") ) ;
+                make_keys( nSize, bNearlySorted ) ;
+
+                do_test<Set>( false ) ;
+                do_test<Set>( true ) ;
+                if ( c_bPrintGCState )
+                    print_gc_state()  ;
+            }
+            m_arrKeys.clear() ;
+        }
+
+        void setUpParams( const CppUnitMini::TestCfg& cfg ) {
+            c_nThreadCount = cfg.getULong("ThreadCount", 4 )          ;
+            c_nSetSize = cfg.getULong("SetSize", 1000000 )            ;
+            c_nListSize = cfg.getULong("ListSize", 10000 )            ;
+            c_nShuffleWidth = cfg.getULong("ShuffleWidth", 8 )        ;
+            c_bPrintGCState = cfg.getBool("PrintGCStateFlag", true )  ;
+
+            if ( c_nThreadCount == 0 )
+                c_nThreadCount = cds::OS::topology::processor_count() ;
+        }
+
+        TEST_SET( SkipListSet_hp_less_pascal )
+        TEST_SET( SkipListSet_hp_less_xorshift )
+        TEST_SET( SkipListSet_ptb_less_pascal )
+        TEST_LIST( MichaelList_HP_cmp_stdAlloc )
+        TEST_LIST( MichaelList_PTB_cmp_stdAlloc )
+
+        CPPUNIT_TEST_SUITE_( Set_InsertSorted, "Map_InsertSorted" )
+            CPPUNIT_TEST( SkipListSet_hp_less_pascal )
+            CPPUNIT_TEST( SkipListSet_hp_less_xorshift )
+            CPPUNIT_TEST( SkipListSet_ptb_less_pascal )
+            CPPUNIT_TEST( MichaelList_HP_cmp_stdAlloc )
+            CPPUNIT_TEST( MichaelList_PTB_cmp_stdAlloc )
+        CPPUNIT_TEST_SUITE_END()
+    } ;
+
+    CPPUNIT_TEST_SUITE_REGISTRATION( Set_InsertSorted );
+} // namespace set2
@@ -21,10 +21,12 @@
 #include <cds/container/michael_list_hp.h>
 #include <cds/container/michael_list_hrc.h>
 #include <cds/container/michael_list_ptb.h>
+#include <cds/container/michael_list_ebr.h>
 #include <cds/container/michael_list_rcu.h>
 #include <cds/container/lazy_list_hp.h>
 #include <cds/container/lazy_list_hrc.h>
 #include <cds/container/lazy_list_ptb.h>
+#include <cds/container/lazy_list_ebr.h>
 #include <cds/container/lazy_list_rcu.h>
 
 #include <cds/container/michael_set.h>
@@ -38,6 +40,7 @@
 #include <cds/container/skip_list_set_hp.h>
 #include <cds/container/skip_list_set_hrc.h>
 #include <cds/container/skip_list_set_ptb.h>
+#include <cds/container/skip_list_set_ebr.h>
 #include <cds/container/skip_list_set_rcu.h>
 
 #include <cds/container/striped_set/std_list.h>
@@ -416,6 +419,46 @@ namespace set2 {
             >::type
         >   MichaelList_PTB_less_michaelAlloc ;
 
+        typedef cc::MichaelList< cds::gc::EBR, key_val,
+            typename cc::michael_list::make_traits<
+                co::compare< compare >
+            >::type
+        >   MichaelList_EBR_cmp_stdAlloc ;
+
+        typedef cc::MichaelList< cds::gc::EBR, key_val,
+            typename cc::michael_list::make_traits<
+                co::compare< compare >
+                ,co::memory_model< co::v::sequential_consistent >
+            >::type
+        >   MichaelList_EBR_cmp_stdAlloc_seqcst ;
+
+        typedef cc::MichaelList< cds::gc::EBR, key_val,
+            typename cc::michael_list::make_traits<
+                co::compare< compare >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   MichaelList_EBR_cmp_michaelAlloc ;
+
+        typedef cc::MichaelList< cds::gc::EBR, key_val,
+            typename cc::michael_list::make_traits<
+                co::less< less >
+            >::type
+        >   MichaelList_EBR_less_stdAlloc ;
+
+        typedef cc::MichaelList< cds::gc::EBR, key_val,
+            typename cc::michael_list::make_traits<
+                co::less< less >
+                ,co::memory_model< co::v::sequential_consistent >
+            >::type
+        >   MichaelList_EBR_less_stdAlloc_seqcst ;
+
+        typedef cc::MichaelList< cds::gc::EBR, key_val,
+            typename cc::michael_list::make_traits<
+                co::less< less >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   MichaelList_EBR_less_michaelAlloc ;
+
 
         typedef cc::MichaelList< rcu_gpi, key_val,
             typename cc::michael_list::make_traits<
@@ -739,6 +782,44 @@ namespace set2 {
             >::type
         >   MichaelSet_PTB_less_michaelAlloc  ;
 
+        typedef cc::MichaelHashSet< cds::gc::EBR, MichaelList_EBR_cmp_stdAlloc,
+            typename cc::michael_set::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelSet_EBR_cmp_stdAlloc  ;
+
+        typedef cc::MichaelHashSet< cds::gc::EBR, MichaelList_EBR_cmp_stdAlloc_seqcst,
+            typename cc::michael_set::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelSet_EBR_cmp_stdAlloc_seqcst  ;
+
+        typedef cc::MichaelHashSet< cds::gc::EBR, MichaelList_EBR_cmp_michaelAlloc,
+            typename cc::michael_set::make_traits<
+                co::hash< hash >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   MichaelSet_EBR_cmp_michaelAlloc ;
+
+        typedef cc::MichaelHashSet< cds::gc::EBR, MichaelList_EBR_less_stdAlloc,
+            typename cc::michael_set::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelSet_EBR_less_stdAlloc  ;
+
+        typedef cc::MichaelHashSet< cds::gc::EBR, MichaelList_EBR_less_stdAlloc_seqcst,
+            typename cc::michael_set::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelSet_EBR_less_stdAlloc_seqcst  ;
+
+        typedef cc::MichaelHashSet< cds::gc::EBR, MichaelList_EBR_less_michaelAlloc,
+            typename cc::michael_set::make_traits<
+                co::hash< hash >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   MichaelSet_EBR_less_michaelAlloc  ;
+
         // general_instant RCU
         typedef cc::MichaelHashSet< rcu_gpi, MichaelList_RCU_GPI_cmp_stdAlloc,
             typename cc::michael_set::make_traits<
@@ -1060,6 +1141,46 @@ namespace set2 {
             >::type
         >   LazyList_PTB_less_michaelAlloc ;
 
+        typedef cc::LazyList< cds::gc::EBR, key_val,
+            typename cc::lazy_list::make_traits<
+                co::compare< compare >
+            >::type
+        >   LazyList_EBR_cmp_stdAlloc ;
+
+        typedef cc::LazyList< cds::gc::EBR, key_val,
+            typename cc::lazy_list::make_traits<
+                co::compare< compare >
+                ,co::memory_model< co::v::sequential_consistent >
+            >::type
+        >   LazyList_EBR_cmp_stdAlloc_seqcst ;
+
+        typedef cc::LazyList< cds::gc::EBR, key_val,
+            typename cc::lazy_list::make_traits<
+                co::compare< compare >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   LazyList_EBR_cmp_michaelAlloc ;
+
+        typedef cc::LazyList< cds::gc::EBR, key_val,
+            typename cc::lazy_list::make_traits<
+                co::less< less >
+            >::type
+        >   LazyList_EBR_less_stdAlloc ;
+
+        typedef cc::LazyList< cds::gc::EBR, key_val,
+            typename cc::lazy_list::make_traits<
+                co::less< less >
+                ,co::memory_model< co::v::sequential_consistent >
+            >::type
+        >   LazyList_EBR_less_stdAlloc_seqcst ;
+
+        typedef cc::LazyList< cds::gc::EBR, key_val,
+            typename cc::lazy_list::make_traits<
+                co::less< less >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   LazyList_EBR_less_michaelAlloc ;
+
         // RCU
         typedef cc::LazyList< rcu_gpi, key_val,
             typename cc::lazy_list::make_traits<
@@ -1383,6 +1504,44 @@ namespace set2 {
             >::type
         >   MichaelSet_Lazy_PTB_less_michaelAlloc  ;
 
+        typedef cc::MichaelHashSet< cds::gc::EBR, LazyList_EBR_cmp_stdAlloc,
+            typename cc::michael_set::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelSet_Lazy_EBR_cmp_stdAlloc  ;
+
+        typedef cc::MichaelHashSet< cds::gc::EBR, LazyList_EBR_cmp_stdAlloc_seqcst,
+            typename cc::michael_set::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelSet_Lazy_EBR_cmp_stdAlloc_seqcst  ;
+
+        typedef cc::MichaelHashSet< cds::gc::EBR, LazyList_EBR_cmp_michaelAlloc,
+            typename cc::michael_set::make_traits<
+                co::hash< hash >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   MichaelSet_Lazy_EBR_cmp_michaelAlloc ;
+
+        typedef cc::MichaelHashSet< cds::gc::EBR, LazyList_EBR_less_stdAlloc,
+            typename cc::michael_set::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelSet_Lazy_EBR_less_stdAlloc  ;
+
+        typedef cc::MichaelHashSet< cds::gc::EBR, LazyList_EBR_less_stdAlloc_seqcst,
+            typename cc::michael_set::make_traits<
+                co::hash< hash >
+            >::type
+        >   MichaelSet_Lazy_EBR_less_stdAlloc_seqcst  ;
+
+        typedef cc::MichaelHashSet< cds::gc::EBR, LazyList_EBR_less_michaelAlloc,
+            typename cc::michael_set::make_traits<
+                co::hash< hash >,
+                co::allocator< memory::MichaelAllocator<int> >
+            >::type
+        >   MichaelSet_Lazy_EBR_less_michaelAlloc  ;
+
         // RCU
         typedef cc::MichaelHashSet< rcu_gpi, LazyList_RCU_GPI_cmp_stdAlloc,
             typename cc::michael_set::make_traits<
@@ -1912,6 +2071,116 @@ namespace set2 {
             >::type
         > SplitList_Michael_PTB_st_less_seqcst ;
 
+        // EBR
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::compare< compare >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_dyn_cmp ;
+
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,co::hash< hash >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::compare< compare >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_dyn_cmp_seqcst ;
+
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::compare< compare >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_st_cmp ;
+
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::compare< compare >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_st_cmp_seqcst ;
+
+        // EBR + less
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::less< less >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_dyn_less ;
+
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,co::hash< hash >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::less< less >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_dyn_less_seqcst ;
+
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::less< less >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_st_less ;
+
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::michael_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::michael_list::make_traits<
+                        co::less< less >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Michael_EBR_st_less_seqcst ;
+
         // RCU
         typedef cc::SplitListSet< rcu_gpi, key_val,
             typename cc::split_list::make_traits<
@@ -2799,6 +3068,116 @@ namespace set2 {
             >::type
         > SplitList_Lazy_PTB_st_less_seqcst ;
 
+        // EBR
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::compare< compare >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_EBR_dyn_cmp ;
+
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,co::hash< hash >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::compare< compare >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_EBR_dyn_cmp_seqcst ;
+
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::compare< compare >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_EBR_st_cmp ;
+
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::compare< compare >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_EBR_st_cmp_seqcst ;
+
+        // EBR + less
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::less< less >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_EBR_dyn_less ;
+
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,co::hash< hash >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::less< less >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_EBR_dyn_less_seqcst ;
+
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::hash< hash >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::less< less >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_EBR_st_less ;
+
+        typedef cc::SplitListSet< cds::gc::EBR, key_val,
+            typename cc::split_list::make_traits<
+                cc::split_list::ordered_list<cc::lazy_list_tag>
+                ,co::hash< hash >
+                ,cc::split_list::dynamic_bucket_table< false >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,cc::split_list::ordered_list_traits<
+                    typename cc::lazy_list::make_traits<
+                        co::less< less >
+                        ,co::memory_model< co::v::sequential_consistent >
+                    >::type
+                >
+            >::type
+        > SplitList_Lazy_EBR_st_less_seqcst ;
+
 
         // RCU
         typedef cc::SplitListSet< rcu_gpi, key_val,
@@ -3760,6 +4139,59 @@ namespace set2 {
             ,cc::cuckoo::store_hash< true >
         > CuckooRefinableSet_vector_ord_storehash ;
 
+        typedef CuckooStripedSet< key_val,
+            cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+            ,co::equal_to< equal_to >
+            ,co::hash< std::tuple< hash, hash2 > >
+            ,cc::cuckoo::fingerprint<>
+        > CuckooStripedSet_vector_unord_fingerprint ;
+
+        typedef CuckooStripedSet< key_val,
+            cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+            ,co::equal_to< equal_to >
+            ,co::hash< std::tuple< hash, hash2 > >
+            ,cc::cuckoo::store_hash< true >
+            ,cc::cuckoo::fingerprint<>
+        > CuckooStripedSet_vector_unord_storehash_fingerprint ;
+
+        typedef CuckooStripedSet< key_val,
+            cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+            ,co::compare< compare >
+            ,co::hash< std::tuple< hash, hash2 > >
+            ,cc::cuckoo::fingerprint< cds::uint16_t >
+        > CuckooStripedSet_vector_ord_fingerprint16 ;
+
+        typedef CuckooRefinableSet< key_val,
+            cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+            ,co::equal_to< equal_to >
+            ,co::hash< std::tuple< hash, hash2 > >
+            ,cc::cuckoo::fingerprint<>
+        > CuckooRefinableSet_vector_unord_fingerprint ;
+
+        typedef CuckooRefinableSet< key_val,
+            cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+            ,co::equal_to< equal_to >
+            ,co::hash< std::tuple< hash, hash2 > >
+            ,cc::cuckoo::store_hash< true >
+            ,cc::cuckoo::fingerprint<>
+        > CuckooRefinableSet_vector_unord_storehash_fingerprint ;
+
+        typedef CuckooStripedSet< key_val,
+            cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+            ,co::compare< compare >
+            ,co::hash< std::tuple< hash, hash2 > >
+            ,co::stat< cc::cuckoo::stat >
+            ,cc::cuckoo::optimistic_find< true >
+        > CuckooStripedSet_vector_ord_optimistic_stat ;
+
+        typedef CuckooRefinableSet< key_val,
+            cc::cuckoo::probeset_type< cc::cuckoo::vector<4> >
+            ,co::compare< compare >
+            ,co::hash< std::tuple< hash, hash2 > >
+            ,co::stat< cc::cuckoo::stat >
+            ,cc::cuckoo::optimistic_find< true >
+        > CuckooRefinableSet_vector_ord_optimistic_stat ;
+
 
         // ***************************************************************************
         // SkipListSet - HP
@@ -4001,6 +4433,86 @@ namespace set2 {
             >::type
         > SkipListSet_ptb_cmp_xorshift_stat ;
 
+        // ***************************************************************************
+        // SkipListSet - EBR
+
+        typedef cc::SkipListSet< cds::gc::EBR, key_val,
+            typename cc::skip_list::make_traits <
+                co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+            >::type
+        > SkipListSet_ebr_less_pascal ;
+
+        typedef cc::SkipListSet< cds::gc::EBR, key_val,
+            typename cc::skip_list::make_traits <
+                co::less< less >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+                ,co::memory_model< co::v::sequential_consistent >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > SkipListSet_ebr_less_pascal_seqcst ;
+
+        typedef cc::SkipListSet< cds::gc::EBR, key_val,
+            typename cc::skip_list::make_traits <
+                co::less< less >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+                ,co::stat< cc::skip_list::stat >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > SkipListSet_ebr_less_pascal_stat ;
+
+        typedef cc::SkipListSet< cds::gc::EBR, key_val,
+            typename cc::skip_list::make_traits <
+                co::compare< compare >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > SkipListSet_ebr_cmp_pascal ;
+
+        typedef cc::SkipListSet< cds::gc::EBR, key_val,
+            typename cc::skip_list::make_traits <
+                co::compare< compare >
+                ,cc::skip_list::random_level_generator< cc::skip_list::turbo_pascal >
+                ,co::stat< cc::skip_list::stat >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > SkipListSet_ebr_cmp_pascal_stat ;
+
+        typedef cc::SkipListSet< cds::gc::EBR, key_val,
+            typename cc::skip_list::make_traits <
+                co::less< less >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > SkipListSet_ebr_less_xorshift ;
+
+        typedef cc::SkipListSet< cds::gc::EBR, key_val,
+            typename cc::skip_list::make_traits <
+                co::less< less >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+                ,co::stat< cc::skip_list::stat >
+            >::type
+        > SkipListSet_ebr_less_xorshift_stat ;
+
+        typedef cc::SkipListSet< cds::gc::EBR, key_val,
+            typename cc::skip_list::make_traits <
+                co::compare< compare >
+                ,co::item_counter< cds::atomicity::item_counter >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+            >::type
+        > SkipListSet_ebr_cmp_xorshift ;
+
+        typedef cc::SkipListSet< cds::gc::EBR, key_val,
+            typename cc::skip_list::make_traits <
+                co::compare< compare >
+                ,cc::skip_list::random_level_generator< cc::skip_list::xorshift >
+                ,co::stat< cc::skip_list::stat >
+                ,co::item_counter< cds::atomicity::item_counter >
+            >::type
+        > SkipListSet_ebr_cmp_xorshift_stat ;
+
 
         // ***************************************************************************
         // SkipListSet - RCU general_instant